@@ -0,0 +1,405 @@
+// Host backend for device.h: records the EPD command/data stream with virtual
+// timestamps and simulates the UC8179 controller of the 7.5" V2 panel (RAM
+// planes, partial window, BUSY timing and the resulting panel image).
+#include "device.h"
+#include "epd_mock.h"
+#include "epd_7in5_v2.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define RAM_SIZE    (EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT / 8)
+#define PARAM_MAX   16
+
+// Modeled BUSY-low times in ms. Refresh times follow the Waveshare wiki for
+// this panel; the 4-gray time and the power on/off times are estimates.
+#define BUSY_POWER_ON_MS    40
+#define BUSY_POWER_OFF_MS   30
+
+typedef enum {
+    WAVEFORM_FULL,
+    WAVEFORM_FAST,
+    WAVEFORM_PART,
+    WAVEFORM_4GRAY,
+} waveform_t;
+
+static const uint32_t refresh_ms[] = {
+    [WAVEFORM_FULL] = 4000,
+    [WAVEFORM_FAST] = 1500,
+    [WAVEFORM_PART] = 400,
+    [WAVEFORM_4GRAY] = 2500,
+};
+
+int host_log_level = 1;
+
+static struct {
+    uint8_t ram[2][RAM_SIZE];
+    uint8_t panel[EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT];
+    uint8_t cmd;
+    uint8_t params[PARAM_MAX];
+    uint32_t param_count;
+    uint32_t write_index;       // byte offset for 0x10/0x13 writes
+    uint8_t cdi[2];             // 0x50 VCOM and data interval
+    uint8_t window[9];          // 0x90 partial window
+    int partial;                // 0x91 entered
+    int sleeping;
+    int reset_level;
+    waveform_t waveform;
+    waveform_t last_refresh;
+    uint64_t busy_until_us;
+} ctl;
+
+static epd_mock_stats_t stats;
+static uint64_t epoch_us = 0;   // virtual time consumed before the last epd_mock_reset()
+static epd_mock_rec_t *records = NULL;
+static uint32_t record_count = 0;
+static uint32_t record_cap = 0;
+static int panel_initialized = 0;
+
+static void record(epd_mock_rec_type_t type, uint8_t value, uint32_t len)
+{
+    if (record_count == record_cap) {
+        uint32_t cap = record_cap ? record_cap * 2 : 1024;
+        epd_mock_rec_t *p = realloc(records, cap * sizeof(*p));
+        if (p == NULL) {
+            return;
+        }
+        records = p;
+        record_cap = cap;
+    }
+    records[record_count++] = (epd_mock_rec_t){ stats.now_us, type, value, len };
+}
+
+static void controller_reset(void)
+{
+    ctl.cmd = 0;
+    ctl.param_count = 0;
+    ctl.write_index = 0;
+    ctl.cdi[0] = 0x10;
+    ctl.cdi[1] = 0x07;
+    ctl.partial = 0;
+    ctl.sleeping = 0;
+    ctl.waveform = WAVEFORM_FULL;
+    ctl.busy_until_us = 0;
+}
+
+static void ensure_init(void)
+{
+    if (!panel_initialized) {
+        memset(ctl.panel, 3, sizeof(ctl.panel));
+        controller_reset();
+        ctl.reset_level = 1;
+        panel_initialized = 1;
+    }
+}
+
+static void spi_transaction(uint32_t bytes)
+{
+    uint64_t t = EPD_MOCK_SPI_OVERHEAD_US + (uint64_t)bytes * 8 * 1000000 / EPD_SPI_CLOCK_HZ;
+    stats.now_us += t;
+    stats.spi_us += t;
+}
+
+static int busy(void)
+{
+    return stats.now_us < ctl.busy_until_us;
+}
+
+static void window_bounds(uint32_t *x0, uint32_t *x1, uint32_t *y0, uint32_t *y1)
+{
+    *x0 = ((ctl.window[0] << 8) | ctl.window[1]) & ~7u;
+    *x1 = ((ctl.window[2] << 8) | ctl.window[3]) | 7u;
+    *y0 = (ctl.window[4] << 8) | ctl.window[5];
+    *y1 = (ctl.window[6] << 8) | ctl.window[7];
+    if (*x1 >= EPD_7IN5_V2_WIDTH) *x1 = EPD_7IN5_V2_WIDTH - 1;
+    if (*y1 >= EPD_7IN5_V2_HEIGHT) *y1 = EPD_7IN5_V2_HEIGHT - 1;
+}
+
+static void ram_write(int plane, uint8_t value)
+{
+    uint32_t offset;
+    if (ctl.partial) {
+        uint32_t x0, x1, y0, y1;
+        window_bounds(&x0, &x1, &y0, &y1);
+        uint32_t wbytes = (x1 - x0 + 1) / 8;
+        uint32_t row = y0 + ctl.write_index / wbytes;
+        if (row > y1) {
+            return;
+        }
+        offset = row * (EPD_7IN5_V2_WIDTH / 8) + x0 / 8 + ctl.write_index % wbytes;
+    } else {
+        offset = ctl.write_index;
+    }
+    ctl.write_index++;
+    if (offset < RAM_SIZE) {
+        ctl.ram[plane][offset] = value;
+    }
+}
+
+static uint8_t pixel_level(uint32_t x, uint32_t y)
+{
+    uint32_t i = y * (EPD_7IN5_V2_WIDTH / 8) + x / 8;
+    uint8_t mask = 0x80 >> (x % 8);
+    int old_bit = (ctl.ram[0][i] & mask) != 0;
+    int new_bit = (ctl.ram[1][i] & mask) != 0;
+
+    if (ctl.waveform == WAVEFORM_4GRAY) {
+        static const uint8_t levels[2][2] = { { 3, 1 }, { 2, 0 } };  // [old][new]
+        return levels[old_bit][new_bit];
+    }
+    // KW mode: DDX[0] (CDI bit 0) is the data polarity, 0: new data 1 = black
+    int ddx0 = ctl.cdi[0] & 1;
+    return new_bit != ddx0 ? 0 : 3;
+}
+
+static void refresh(void)
+{
+    uint32_t x0 = 0, x1 = EPD_7IN5_V2_WIDTH - 1, y0 = 0, y1 = EPD_7IN5_V2_HEIGHT - 1;
+    if (ctl.partial) {
+        window_bounds(&x0, &x1, &y0, &y1);
+    }
+    for (uint32_t y = y0; y <= y1; y++) {
+        for (uint32_t x = x0; x <= x1; x++) {
+            ctl.panel[y * EPD_7IN5_V2_WIDTH + x] = pixel_level(x, y);
+        }
+    }
+    // N2OCP: copy new data to old data after refresh
+    if (ctl.cdi[0] & 0x08) {
+        memcpy(ctl.ram[0], ctl.ram[1], RAM_SIZE);
+    }
+    ctl.last_refresh = ctl.waveform;
+    ctl.busy_until_us = stats.now_us + (uint64_t)refresh_ms[ctl.waveform] * 1000;
+    stats.refresh_count++;
+    record(EPD_MOCK_REC_REFRESH, ctl.waveform, refresh_ms[ctl.waveform]);
+}
+
+static void controller_cmd(uint8_t cmd)
+{
+    ctl.cmd = cmd;
+    ctl.param_count = 0;
+    switch (cmd) {
+    case 0x10:
+    case 0x13:
+        ctl.write_index = 0;
+        break;
+    case 0x12:
+        refresh();
+        break;
+    case 0x04:
+        ctl.busy_until_us = stats.now_us + BUSY_POWER_ON_MS * 1000;
+        break;
+    case 0x02:
+        ctl.busy_until_us = stats.now_us + BUSY_POWER_OFF_MS * 1000;
+        break;
+    case 0x91:
+        ctl.partial = 1;
+        break;
+    case 0x92:
+        ctl.partial = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+static void controller_data(uint8_t value)
+{
+    uint32_t n = ctl.param_count++;
+    switch (ctl.cmd) {
+    case 0x10:
+        ram_write(0, value);
+        return;
+    case 0x13:
+        ram_write(1, value);
+        return;
+    case 0x50:
+        if (n < 2) ctl.cdi[n] = value;
+        break;
+    case 0x90:
+        if (n < 9) ctl.window[n] = value;
+        break;
+    case 0xE5:
+        ctl.waveform = value == 0x5A ? WAVEFORM_FAST :
+                       value == 0x6E ? WAVEFORM_PART :
+                       value == 0x5F ? WAVEFORM_4GRAY : WAVEFORM_FULL;
+        break;
+    case 0x07:
+        if (value == 0xA5) ctl.sleeping = 1;
+        break;
+    default:
+        break;
+    }
+    if (n < PARAM_MAX) {
+        ctl.params[n] = value;
+    }
+}
+
+void epd_cmd(const uint8_t cmd)
+{
+    ensure_init();
+    spi_transaction(1);
+    stats.cmd_count++;
+    record(EPD_MOCK_REC_CMD, cmd, 1);
+    // Status reads (0x71) are allowed while busy, everything else is dropped
+    if (busy() && cmd != 0x71) {
+        stats.busy_violations++;
+        return;
+    }
+    if (!ctl.sleeping) {
+        controller_cmd(cmd);
+    }
+}
+
+void epd_data(const uint8_t data)
+{
+    epd_data2(&data, 1);
+}
+
+void epd_data2(const uint8_t *data, int len)
+{
+    if (len == 0) {
+        return;
+    }
+    ensure_init();
+    spi_transaction(len);
+    stats.data_transactions++;
+    stats.data_bytes += len;
+    record(EPD_MOCK_REC_DATA, data[0], len);
+    if (busy()) {
+        stats.busy_violations++;
+        return;
+    }
+    if (ctl.sleeping) {
+        return;
+    }
+    for (int i = 0; i < len; i++) {
+        controller_data(data[i]);
+    }
+}
+
+void host_gpio_set_level(int pin, int value)
+{
+    ensure_init();
+    record(EPD_MOCK_REC_GPIO, value, pin);
+    if (pin == PIN_NUM_N_RST) {
+        // Rising edge on RST restarts the controller (also leaves deep sleep)
+        if (value && !ctl.reset_level) {
+            controller_reset();
+        }
+        ctl.reset_level = value;
+    }
+}
+
+int host_gpio_get_level(int pin)
+{
+    ensure_init();
+    if (pin == PIN_NUM_BUSY) {
+        return busy() ? 0 : 1;
+    }
+    return 0;
+}
+
+void host_delay_ms(uint32_t ms)
+{
+    ensure_init();
+    record(EPD_MOCK_REC_DELAY, 0, ms);
+    stats.now_us += (uint64_t)ms * 1000;
+    stats.delay_us += (uint64_t)ms * 1000;
+}
+
+int64_t host_time_us(void)
+{
+    return (int64_t)(epoch_us + stats.now_us);
+}
+
+void device_init(void)
+{
+    ensure_init();
+}
+
+void epd_mock_reset(void)
+{
+    ensure_init();
+    epoch_us += stats.now_us;
+    memset(&stats, 0, sizeof(stats));
+    ctl.busy_until_us = 0;
+    record_count = 0;
+}
+
+void epd_mock_get_stats(epd_mock_stats_t *out)
+{
+    *out = stats;
+}
+
+const epd_mock_rec_t *epd_mock_records(uint32_t *count)
+{
+    *count = record_count;
+    return records;
+}
+
+int epd_mock_dump_log(const char *path)
+{
+    static const char *const names[] = { "CMD", "DATA", "GPIO", "DELAY", "REFRESH" };
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < record_count; i++) {
+        const epd_mock_rec_t *r = &records[i];
+        fprintf(f, "%10.3f ms  %-7s", r->time_us / 1000.0, names[r->type]);
+        switch (r->type) {
+        case EPD_MOCK_REC_CMD:
+            fprintf(f, " 0x%02X\n", r->value);
+            break;
+        case EPD_MOCK_REC_DATA:
+            fprintf(f, " 0x%02X x%" PRIu32 "\n", r->value, r->len);
+            break;
+        case EPD_MOCK_REC_GPIO:
+            fprintf(f, " pin %" PRIu32 " = %d\n", r->len, r->value);
+            break;
+        case EPD_MOCK_REC_DELAY:
+        case EPD_MOCK_REC_REFRESH:
+            fprintf(f, " %" PRIu32 " ms\n", r->len);
+            break;
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+const uint8_t *epd_mock_ram(int plane)
+{
+    ensure_init();
+    return ctl.ram[plane ? 1 : 0];
+}
+
+const uint8_t *epd_mock_panel(void)
+{
+    ensure_init();
+    return ctl.panel;
+}
+
+int epd_mock_write_image(const char *path)
+{
+    ensure_init();
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+    if (ctl.last_refresh == WAVEFORM_4GRAY) {
+        fprintf(f, "P5\n%d %d\n3\n", EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+        fwrite(ctl.panel, 1, sizeof(ctl.panel), f);
+    } else {
+        // PBM: 1 = black
+        fprintf(f, "P4\n%d %d\n", EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+        for (int i = 0; i < EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT; i += 8) {
+            uint8_t b = 0;
+            for (int k = 0; k < 8; k++) {
+                b = (b << 1) | (ctl.panel[i + k] < 2);
+            }
+            fputc(b, f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
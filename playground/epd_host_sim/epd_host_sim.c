@@ -0,0 +1,364 @@
+// Runs the playground EPD driver against the host mock backend.
+// Writes the simulated panel image of every scenario into the output folder
+// and prints the modeled bus/latency numbers. Exits non-zero when any
+// scenario leaves pixel errors on the panel.
+//
+//   cmake -S . -B build && cmake --build build && ./build/epd_host_sim [out_dir]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "device.h"
+#include "epd_7in5_v2.h"
+#include "epd_mock.h"
+#include "epd_panel.h"
+#include "vendor_bench.h"
+#include "epd_lvgl.h"
+
+#define FRAME_SIZE (EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT / 8)
+
+extern unsigned char photo[];
+
+static const char *out_dir = ".";
+static int total_errors;
+
+static void report(const char *name, const epd_mock_stats_t *s)
+{
+    printf("%-16s %9.1f ms  spi %8.1f ms  delay %8.1f ms  cmds %5" PRIu32 "  data tx %6" PRIu32
+           "  bytes %7" PRIu64 "  busy violations %" PRIu32 "\n",
+           name, s->now_us / 1000.0, s->spi_us / 1000.0, s->delay_us / 1000.0,
+           s->cmd_count, s->data_transactions, s->data_bytes, s->busy_violations);
+}
+
+static void save(const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.%s", out_dir, name,
+             epd_7in5_v2_get_mode() == EPD_7IN5_V2_MODE_4GRAY ? "pgm" : "pbm");
+    if (epd_mock_write_image(path) != 0) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return;
+    }
+    snprintf(path, sizeof(path), "%s/%s.log", out_dir, name);
+    epd_mock_dump_log(path);
+}
+
+static void report_errors(int errors)
+{
+    total_errors += errors;
+    printf("  pixel errors: %d\n", errors);
+}
+
+// Compares the panel against a 1bpp image (bit set = white) inside a window
+static int check_1bpp(const uint8_t *image, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+    const uint8_t *panel = epd_mock_panel();
+    int stride = (x1 - x0) / 8;
+    int errors = 0;
+    for (uint32_t y = y0; y < y1; y++) {
+        for (uint32_t x = x0; x < x1; x++) {
+            int white = (image[(y - y0) * stride + (x - x0) / 8] >> (7 - (x - x0) % 8)) & 1;
+            if ((panel[y * EPD_7IN5_V2_WIDTH + x] == 3) != white) {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+static void scenario(const char *name, epd_7in5_v2_mode_t mode, void (*body)(void))
+{
+    epd_mock_stats_t s;
+    epd_mock_reset();
+    epd_7in5_v2_init_mode(mode);
+    epd_mock_get_stats(&s);
+    char label[64];
+    snprintf(label, sizeof(label), "%s/init", name);
+    report(label, &s);
+
+    epd_mock_reset();
+    body();
+    epd_mock_get_stats(&s);
+    snprintf(label, sizeof(label), "%s/frame", name);
+    report(label, &s);
+    save(name);
+}
+
+static void full_frame(void)
+{
+    static uint8_t frame[FRAME_SIZE];
+    memcpy(frame, photo, FRAME_SIZE);
+    epd_7in5_v2_display(frame);
+    int errors = check_1bpp(photo, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    total_errors += errors;
+    printf("  pixel errors: %d, source %s\n", errors, memcmp(frame, photo, FRAME_SIZE) ? "modified" : "untouched");
+}
+
+// Builds an LVGL I1 flush buffer for rows [y0, y1) and columns [x0, x1) of
+// the photo: palette header, padded stride, optionally inverted polarity
+static const uint8_t *lvgl_i1_buffer(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1,
+                                     uint32_t stride, int black_is_one)
+{
+    static uint8_t buf[EPD_LVGL_I1_PALETTE_SIZE + (EPD_7IN5_V2_WIDTH / 8 + 8) * EPD_7IN5_V2_HEIGHT];
+    static const uint8_t black[4] = { 0x00, 0x00, 0x00, 0xFF };
+    static const uint8_t white[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    memcpy(buf, black_is_one ? white : black, 4);
+    memcpy(buf + 4, black_is_one ? black : white, 4);
+    memset(buf + EPD_LVGL_I1_PALETTE_SIZE, 0xA5, stride * (y1 - y0));
+    for (uint32_t y = y0; y < y1; y++) {
+        const uint8_t *src = photo + y * (EPD_7IN5_V2_WIDTH / 8) + x0 / 8;
+        uint8_t *dst = buf + EPD_LVGL_I1_PALETTE_SIZE + (y - y0) * stride;
+        for (uint32_t i = 0; i < (x1 - x0) / 8; i++) {
+            dst[i] = black_is_one ? ~src[i] : src[i];
+        }
+    }
+    return buf;
+}
+
+// LVGL-style bands through the I1 adapter, bottom band first, then one
+// refresh. Odd passes use a padded stride and the inverted palette.
+static void band_frame(void)
+{
+    int errors = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t stride = EPD_7IN5_V2_WIDTH / 8 + (pass ? 4 : 0);
+        for (int y = EPD_7IN5_V2_HEIGHT - 40; y >= 0; y -= 40) {
+            const uint8_t *buf = lvgl_i1_buffer(0, y, EPD_7IN5_V2_WIDTH, y + 40, stride, pass);
+            epd_7in5_v2_view_t view;
+            epd_lvgl_i1_view(buf, stride, 0, y, EPD_7IN5_V2_WIDTH - 1, y + 39, &view);
+            epd_7in5_v2_write_view(&view);
+        }
+        epd_7in5_v2_refresh();
+        errors += check_1bpp(photo, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+    }
+
+    // A narrow area on top of a cleared frame: only that rectangle may change
+    epd_7in5_v2_clear();
+    const uint8_t *buf = lvgl_i1_buffer(96, 200, 304, 260, 28, 0);
+    epd_7in5_v2_view_t view;
+    epd_lvgl_i1_view(buf, 28, 96, 200, 303, 259, &view);
+    epd_7in5_v2_write_view(&view);
+    epd_7in5_v2_refresh();
+    const uint8_t *panel = epd_mock_panel();
+    for (int y = 0; y < EPD_7IN5_V2_HEIGHT; y++) {
+        for (int x = 0; x < EPD_7IN5_V2_WIDTH; x++) {
+            int inside = x >= 96 && x < 304 && y >= 200 && y < 260;
+            int white = inside ? (photo[y * (EPD_7IN5_V2_WIDTH / 8) + x / 8] >> (7 - x % 8)) & 1 : 1;
+            errors += (panel[y * EPD_7IN5_V2_WIDTH + x] == 3) != white;
+        }
+    }
+    report_errors(errors);
+}
+
+static void partial_window(void)
+{
+    // 200x96 checkerboard of 8x8 cells at (304, 192)
+    static uint8_t win[200 / 8 * 96];
+    for (int y = 0; y < 96; y++) {
+        for (int b = 0; b < 200 / 8; b++) {
+            win[y * (200 / 8) + b] = ((y / 8 + b) & 1) ? 0xFF : 0x00;
+        }
+    }
+    epd_7in5_v2_display_part(win, 304, 192, 504, 288);
+    report_errors(check_1bpp(win, 304, 192, 504, 288));
+}
+
+static void gray_ramp(void)
+{
+    // Four vertical bands: black, gray2, gray1, white
+    static uint8_t image[EPD_7IN5_V2_WIDTH / 4 * EPD_7IN5_V2_HEIGHT];
+    for (int y = 0; y < EPD_7IN5_V2_HEIGHT; y++) {
+        for (int b = 0; b < EPD_7IN5_V2_WIDTH / 4; b++) {
+            uint8_t level = b * 4 / (EPD_7IN5_V2_WIDTH / 4);
+            image[y * (EPD_7IN5_V2_WIDTH / 4) + b] = level * 0x55;
+        }
+    }
+    epd_7in5_v2_display_4gray(image);
+
+    const uint8_t *panel = epd_mock_panel();
+    int errors = 0;
+    for (int y = 0; y < EPD_7IN5_V2_HEIGHT; y++) {
+        for (int x = 0; x < EPD_7IN5_V2_WIDTH; x++) {
+            if (panel[y * EPD_7IN5_V2_WIDTH + x] != x * 4 / EPD_7IN5_V2_WIDTH) {
+                errors++;
+            }
+        }
+    }
+    report_errors(errors);
+}
+
+// Runs the 7.5" V2 descriptor through the generic engine and checks the panel
+static void engine_scenarios(void)
+{
+    const epd_panel_t *panel = epd_panel_find("7in5_v2");
+    static uint8_t gray[EPD_7IN5_V2_WIDTH / 4 * EPD_7IN5_V2_HEIGHT];
+    for (int y = 0; y < EPD_7IN5_V2_HEIGHT; y++) {
+        for (int b = 0; b < EPD_7IN5_V2_WIDTH / 4; b++) {
+            gray[y * (EPD_7IN5_V2_WIDTH / 4) + b] = (b * 4 / (EPD_7IN5_V2_WIDTH / 4)) * 0x55;
+        }
+    }
+
+    printf("\nengine, %s:\n", panel->name);
+    for (uint8_t m = 0; m < panel->mode_count; m++) {
+        const epd_panel_mode_t *mode = &panel->modes[m];
+        epd_mock_stats_t s;
+        char label[64];
+
+        epd_mock_reset();
+        epd_panel_init(panel, m);
+        epd_mock_get_stats(&s);
+        snprintf(label, sizeof(label), "%s/init", mode->name);
+        report(label, &s);
+
+        epd_mock_reset();
+        epd_panel_display(mode->bpp == 2 ? gray : photo);
+        epd_mock_get_stats(&s);
+        snprintf(label, sizeof(label), "%s/frame", mode->name);
+        report(label, &s);
+
+        int errors = 0;
+        if (mode->bpp == 2) {
+            const uint8_t *p = epd_mock_panel();
+            for (int i = 0; i < EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT; i++) {
+                errors += p[i] != (i % EPD_7IN5_V2_WIDTH) * 4 / EPD_7IN5_V2_WIDTH;
+            }
+        } else {
+            errors = check_1bpp(photo, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+        }
+        report_errors(errors);
+    }
+    epd_mock_reset();
+    epd_panel_sleep();
+}
+
+typedef struct {
+    int64_t init_us;
+    uint32_t init_tx;
+    int64_t frame_us;
+    int64_t frame_spi_us;
+    uint32_t frame_tx;
+} bench_t;
+
+static void bench_row(const char *panel, const char *impl, const bench_t *b)
+{
+    printf("%-9s %-8s %9.1f %7" PRIu32 " %9.1f %9.1f %7" PRIu32 " %9.1f\n", panel, impl,
+           b->init_us / 1000.0, b->init_tx, b->frame_spi_us / 1000.0, b->frame_us / 1000.0,
+           b->frame_tx, (b->init_us + b->frame_us) / 1000.0);
+}
+
+static void bench_measure(bench_t *b, void (*init)(void), void (*display)(uint8_t *), uint8_t *image)
+{
+    epd_mock_stats_t s;
+    epd_mock_reset();
+    init();
+    epd_mock_get_stats(&s);
+    b->init_us = s.now_us;
+    b->init_tx = s.cmd_count + s.data_transactions;
+
+    epd_mock_reset();
+    display(image);
+    epd_mock_get_stats(&s);
+    b->frame_us = s.now_us;
+    b->frame_spi_us = s.spi_us;
+    b->frame_tx = s.cmd_count + s.data_transactions;
+}
+
+static const epd_panel_t *s_bench_panel;
+static void engine_init(void) { epd_panel_init(s_bench_panel, 0); }
+static void engine_display(uint8_t *image) { epd_panel_display(image); }
+static void vendor_7in3f_display_rw(uint8_t *image) { vendor_7in3f_display(image); }
+
+// Init + frame upload of the vendor byte-at-a-time drivers vs the engine on
+// the same descriptor. The engine also drives the PWR pin (power_settle_ms).
+static void engine_benchmark(void)
+{
+    static uint8_t image[800 / 2 * 480];
+    static const struct {
+        const char *panel;
+        void (*vendor_init)(void);
+        void (*vendor_display)(uint8_t *);
+        size_t size;
+    } cases[] = {
+        { "7in5_v2", vendor_7in5_v2_init, vendor_7in5_v2_display, 800 / 8 * 480 },
+        { "5in83_v2", vendor_5in83_v2_init, vendor_5in83_v2_display, 648 / 8 * 480 },
+        { "7in3f", vendor_7in3f_init, vendor_7in3f_display_rw, 800 / 2 * 480 },
+    };
+
+    printf("\ninit + upload, vendor driver vs engine (ms, tx = SPI transactions):\n");
+    printf("%-9s %-8s %9s %7s %9s %9s %7s %9s\n", "panel", "impl", "init", "init tx",
+           "frame spi", "frame", "frame tx", "total");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_t vendor, engine;
+        memcpy(image, photo, cases[i].size < FRAME_SIZE ? cases[i].size : FRAME_SIZE);
+        bench_measure(&vendor, cases[i].vendor_init, cases[i].vendor_display, image);
+        bench_row(cases[i].panel, "vendor", &vendor);
+
+        s_bench_panel = epd_panel_find(cases[i].panel);
+        memcpy(image, photo, cases[i].size < FRAME_SIZE ? cases[i].size : FRAME_SIZE);
+        bench_measure(&engine, engine_init, engine_display, image);
+        bench_row(cases[i].panel, "engine", &engine);
+    }
+}
+
+// Wake-to-image budget of init + full frame for every timing profile
+static void latency_budget(epd_7in5_v2_mode_t mode, const char *mode_name)
+{
+    static const char *const phases[] = { "power", "reset", "init", "upload", "refresh" };
+    static uint8_t frame[FRAME_SIZE];
+
+    printf("\nwake to image, %s refresh (ms):\n%-10s", mode_name, "timing");
+    for (int p = 0; p < EPD_7IN5_V2_PHASE_COUNT; p++) {
+        printf(" %8s", phases[p]);
+    }
+    printf(" %8s\n", "total");
+
+    for (int id = 0; id < EPD_7IN5_V2_TIMING_COUNT; id++) {
+        epd_7in5_v2_set_timing(id);
+        epd_mock_reset();
+        int64_t wake = host_time_us();
+        epd_7in5_v2_latency_reset();
+        memcpy(frame, photo, FRAME_SIZE);
+        epd_7in5_v2_init_mode(mode);
+        epd_7in5_v2_display(frame);
+
+        epd_7in5_v2_latency_t lat;
+        epd_7in5_v2_get_latency(&lat);
+        printf("%-10s", epd_7in5_v2_get_timing()->name);
+        for (int p = 0; p < EPD_7IN5_V2_PHASE_COUNT; p++) {
+            printf(" %8.1f", lat.phase_us[p] / 1000.0);
+        }
+        printf(" %8.1f\n", (lat.first_image_us - wake) / 1000.0);
+    }
+    epd_7in5_v2_set_timing(EPD_7IN5_V2_TIMING_WAVESHARE);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) {
+        out_dir = argv[1];
+    }
+    device_init();
+
+    scenario("full", EPD_7IN5_V2_MODE_FULL, full_frame);
+    scenario("fast", EPD_7IN5_V2_MODE_FAST, full_frame);
+    scenario("bands", EPD_7IN5_V2_MODE_FULL, band_frame);
+    scenario("partial", EPD_7IN5_V2_MODE_PART, partial_window);
+    scenario("gray4", EPD_7IN5_V2_MODE_4GRAY, gray_ramp);
+
+    epd_mock_stats_t s;
+    epd_mock_reset();
+    epd_7in5_v2_sleep();
+    epd_mock_get_stats(&s);
+    report("sleep", &s);
+
+    latency_budget(EPD_7IN5_V2_MODE_FULL, "full");
+    latency_budget(EPD_7IN5_V2_MODE_FAST, "fast");
+
+    engine_scenarios();
+    engine_benchmark();
+
+    if (total_errors) {
+        fprintf(stderr, "\n%d pixel errors\n", total_errors);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+#ifndef _EPD_MOCK_H_
+#define _EPD_MOCK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Modeled SPI cost: fixed setup time per polling transaction plus bit time
+#define EPD_MOCK_SPI_OVERHEAD_US    20
+
+typedef enum {
+    EPD_MOCK_REC_CMD,
+    EPD_MOCK_REC_DATA,      // value: first byte, len: byte count
+    EPD_MOCK_REC_GPIO,      // value: level, len: pin
+    EPD_MOCK_REC_DELAY,     // len: milliseconds
+    EPD_MOCK_REC_REFRESH,   // value: waveform, len: modeled refresh time in ms
+} epd_mock_rec_type_t;
+
+typedef struct {
+    uint64_t time_us;
+    epd_mock_rec_type_t type;
+    uint8_t value;
+    uint32_t len;
+} epd_mock_rec_t;
+
+typedef struct {
+    uint64_t now_us;            // virtual clock
+    uint64_t spi_us;            // time spent clocking commands and data
+    uint64_t delay_us;          // time spent in DELAY_MS
+    uint32_t cmd_count;
+    uint32_t data_transactions;
+    uint64_t data_bytes;
+    uint32_t refresh_count;
+    uint32_t busy_violations;   // commands or data sent while BUSY was low
+} epd_mock_stats_t;
+
+// Clears the record log, statistics and virtual clock; RAM and panel are kept
+void epd_mock_reset(void);
+void epd_mock_get_stats(epd_mock_stats_t *stats);
+
+const epd_mock_rec_t *epd_mock_records(uint32_t *count);
+int epd_mock_dump_log(const char *path);
+
+// Controller RAM: plane 0 is DTM1 (0x10, old data), plane 1 is DTM2 (0x13, new data)
+const uint8_t *epd_mock_ram(int plane);
+
+// Panel contents after the last refresh, one byte per pixel, 0 = black .. 3 = white
+const uint8_t *epd_mock_panel(void);
+
+// Writes the panel as PBM, or as PGM when the last refresh used the 4-gray waveform
+int epd_mock_write_image(const char *path);
+
+#endif
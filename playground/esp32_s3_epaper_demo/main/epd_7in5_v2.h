@@ -2,16 +2,87 @@
 #define _EPD_7IN5_V2_H_
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 // Display resolution
 #define EPD_7IN5_V2_WIDTH       800
 #define EPD_7IN5_V2_HEIGHT      480
 
+// Refresh profiles, selected at init time
+typedef enum {
+    EPD_7IN5_V2_MODE_FULL = 0,  // slow full refresh, 1bpp, best contrast
+    EPD_7IN5_V2_MODE_FAST,      // fast full refresh, 1bpp, for frequent updates
+    EPD_7IN5_V2_MODE_PART,      // partial refresh, 1bpp, use with display_part
+    EPD_7IN5_V2_MODE_4GRAY,     // 4-level grayscale, 2bpp (panels sold after 2023-10-24)
+} epd_7in5_v2_mode_t;
+
+// Wait times used around reset, power on and refresh
+typedef enum {
+    EPD_7IN5_V2_TIMING_LEGACY = 0,  // original playground waits (3 x 200 ms reset)
+    EPD_7IN5_V2_TIMING_WAVESHARE,   // Waveshare driver values (20/2/20 ms reset), default
+    EPD_7IN5_V2_TIMING_FAST,        // Waveshare reset, BUSY-driven settles
+    EPD_7IN5_V2_TIMING_COUNT,
+} epd_7in5_v2_timing_id_t;
+
+typedef struct {
+    const char *name;
+    uint16_t power_settle_ms;       // after the PWR pin goes high
+    uint16_t reset_high_ms;
+    uint16_t reset_low_ms;
+    uint16_t reset_release_ms;
+    uint16_t power_on_settle_ms;    // after POWER ON (0x04), before polling BUSY
+    uint16_t refresh_settle_ms;     // after DISPLAY REFRESH (0x12), before polling BUSY
+    uint16_t busy_poll_ms;
+    uint16_t busy_release_ms;       // after BUSY goes high
+} epd_7in5_v2_timing_t;
+
+typedef enum {
+    EPD_7IN5_V2_PHASE_POWER = 0,
+    EPD_7IN5_V2_PHASE_RESET,
+    EPD_7IN5_V2_PHASE_INIT,         // register setup incl. POWER ON
+    EPD_7IN5_V2_PHASE_UPLOAD,       // frame data transfer
+    EPD_7IN5_V2_PHASE_REFRESH,      // DISPLAY REFRESH until BUSY releases
+    EPD_7IN5_V2_PHASE_COUNT,
+} epd_7in5_v2_phase_t;
+
+// Time accumulated per phase since the last epd_7in5_v2_latency_reset()
+typedef struct {
+    int64_t phase_us[EPD_7IN5_V2_PHASE_COUNT];
+    int64_t first_image_us;         // clock time when the first refresh finished
+} epd_7in5_v2_latency_t;
+
+// 1bpp image rectangle inside a larger buffer, MSB = leftmost pixel
+typedef struct {
+    const uint8_t *pixels;      // byte holding the top-left pixel
+    uint32_t stride;            // bytes from one row to the next
+    uint32_t x_start, y_start;  // panel position, x_start a multiple of 8
+    uint32_t x_end, y_end;      // exclusive, x_end a multiple of 8
+    bool black_is_one;          // false: bit set = white
+} epd_7in5_v2_view_t;
+
+void epd_7in5_v2_set_timing(epd_7in5_v2_timing_id_t id);
+const epd_7in5_v2_timing_t *epd_7in5_v2_get_timing(void);
+void epd_7in5_v2_latency_reset(void);
+void epd_7in5_v2_get_latency(epd_7in5_v2_latency_t *latency);
+void epd_7in5_v2_latency_report(void);
+
 void epd_7in5_v2_init(void);
+void epd_7in5_v2_init_mode(epd_7in5_v2_mode_t mode);
+epd_7in5_v2_mode_t epd_7in5_v2_get_mode(void);
 void epd_7in5_v2_clear(void);
 void epd_7in5_v2_clearblack(void);
-void epd_7in5_v2_display(uint8_t *image);
+// image: 1bpp, bit set = white; not modified
+void epd_7in5_v2_display(const uint8_t *image);
 void epd_7in5_v2_display_part(uint8_t *blackimage,uint32_t x_start, uint32_t y_start, uint32_t x_end, uint32_t y_end);
+// image: 2bpp, 4 pixels per byte MSB first, 0 = black .. 3 = white
+void epd_7in5_v2_display_4gray(const uint8_t *image);
+// Writes the view into both RAM planes at its position without refreshing;
+// FULL and FAST modes. One plane is streamed straight from the view; the other
+// needs the opposite polarity and is inverted a few rows at a time into a
+// driver buffer on its way out. The view itself is not modified.
+void epd_7in5_v2_write_view(const epd_7in5_v2_view_t *view);
+// Refreshes the panel from controller RAM
+void epd_7in5_v2_refresh(void);
 void epd_7in5_v2_sleep(void);
 
-#endif
\ No newline at end of file
+#endif
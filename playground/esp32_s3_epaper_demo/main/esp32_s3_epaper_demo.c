@@ -3,18 +3,25 @@
 #include "epd_7in5_v2.h"
 #include "esp_log.h"
 
+// Optional wait before touching the panel, e.g. to attach a serial monitor.
+// Every millisecond here adds to the wake-to-image latency.
+#define DEMO_START_DELAY_MS 0
+
 static const char *TAG = "main";
 extern uint8_t photo[];
 void app_main(void)
 {
-    ESP_LOGI(TAG, "Hello, please wait 3 seconds");
-    DELAY_MS(3000);
+    if (DEMO_START_DELAY_MS > 0) {
+        ESP_LOGI(TAG, "Hello, please wait %d ms", DEMO_START_DELAY_MS);
+        DELAY_MS(DEMO_START_DELAY_MS);
+    }
     device_init();
+    epd_7in5_v2_set_timing(EPD_7IN5_V2_TIMING_WAVESHARE);
+    epd_7in5_v2_latency_reset();
     epd_7in5_v2_init();
-    epd_7in5_v2_clear();
-    DELAY_MS(500);
     ESP_LOGI(TAG, "Showing image...");
     epd_7in5_v2_display(photo);
+    epd_7in5_v2_latency_report();
     DELAY_MS(3000);
     epd_7in5_v2_init();
     epd_7in5_v2_clear();
@@ -0,0 +1,15 @@
+#ifndef CALENDAR_EVENT_H
+#define CALENDAR_EVENT_H
+
+#include <time.h>
+
+#define MAX_SUMMARY_LEN 100 // 事件摘要最大長度
+
+// --- 事件結構 ---
+typedef struct {
+    time_t start_time;                // 事件開始時間 (UTC time_t)
+    time_t end_time;                  // 事件結束時間 (UTC time_t)；沒有 DTEND 時由開始時間推得
+    char summary[MAX_SUMMARY_LEN]; // 事件摘要
+} calendar_event_t;
+
+#endif // CALENDAR_EVENT_H
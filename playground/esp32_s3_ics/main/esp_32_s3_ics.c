@@ -14,10 +14,15 @@
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "esp_netif.h"
-#include "esp_sntp.h"         // For SNTP
 #include "esp_http_client.h"  // For HTTP Client
 #include "esp_tls.h"          // For HTTPS
 #include "esp_crt_bundle.h" // Include if using certificate bundle for validation
+#include "esp_timer.h"
+#include "lwip/netdb.h"       // For the timed DNS lookup
+#include "wake_trace.h"
+#include "time_service.h"
+#include "calendar_event.h"
+#include "refresh_scheduler.h"
 
 // --- 設定您的 Wi-Fi 和 ICS URL ---
 #define WIFI_SSID      "HowDareYou" // Wi-Fi SSID
@@ -26,10 +31,10 @@
 
 // --- 常數 ---
 #define MAX_EVENTS              50   // 最多處理的未來事件數量
-#define MAX_SUMMARY_LEN         100  // 事件摘要最大長度
 #define MAX_HTTP_RECV_BUFFER    1024 // HTTP 接收緩衝區大小
 #define MAX_ICS_LINE_LEN        256  // ICS 每行最大長度 (考慮折行前)
 #define MAX_DT_STR_LEN          32   // 用於日期時間字串操作的緩衝區大小
+#define WAKE_TRACE_CONSOLE_S    10   // 開機或按 reset 後，睡前開 console 幾秒 (`trace dump`)；0 不開
 
 static const char *TAG = "ICS_DEMO";
 
@@ -40,14 +45,9 @@ const int WIFI_FAIL_BIT      = BIT1;
 static int s_retry_num = 0;
 #define WIFI_MAX_RETRY 5
 
-// --- SNTP 同步狀態 ---
-static bool sntp_synchronized = false;
-
-// --- 事件結構 ---
-typedef struct {
-    time_t start_time;                // 事件開始時間 (UTC time_t)
-    char summary[MAX_SUMMARY_LEN]; // 事件摘要
-} calendar_event_t;
+// --- Wake trace 的 HTTP 階段狀態 ---
+static bool http_connected = false;   // TLS span ended, download span open
+static uint32_t http_bytes = 0;
 
 // --- 全局事件陣列和計數 ---
 static calendar_event_t future_events[MAX_EVENTS];
@@ -56,13 +56,11 @@ static int future_event_count = 0;
 // --- Forward Declarations ---
 static void wifi_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
 static void wifi_init_sta(void);
-static void initialize_sntp(void);
-static void time_sync_notification_cb(struct timeval *tv);
 esp_err_t http_get_ics(const char *url);
 static void parse_ics_data(const char *ics_data_chunk, size_t len);
 static time_t parse_dtstart(const char* dtstart_str);
 static int compare_events(const void *a, const void *b);
-static void print_upcoming_events(int count);
+static void print_upcoming_events(const calendar_event_t *events, int count);
 
 
 // --- Wi-Fi Event Handler ---
@@ -70,7 +68,12 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                                 int32_t event_id, void* event_data) {
     if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
         esp_wifi_connect();
+    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_CONNECTED) {
+        wake_trace_end(WAKE_TRACE_WIFI_ASSOC, 0);
+        wake_trace_begin(WAKE_TRACE_DHCP);
     } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*) event_data;
+        wake_trace_instant(WAKE_TRACE_WIFI_ASSOC, event->reason); // A failed attempt
         if (s_retry_num < WIFI_MAX_RETRY) {
             esp_wifi_connect();
             s_retry_num++;
@@ -82,6 +85,7 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         ESP_LOGI(TAG, "got ip:" IPSTR, IP2STR(&event->ip_info.ip));
+        wake_trace_end(WAKE_TRACE_DHCP, 0);
         s_retry_num = 0;
         xEventGroupSetBits(wifi_event_group, WIFI_CONNECTED_BIT);
     }
@@ -124,6 +128,7 @@ static void wifi_init_sta(void) {
     };
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA) );
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config) );
+    wake_trace_begin(WAKE_TRACE_WIFI_ASSOC);
     ESP_ERROR_CHECK(esp_wifi_start() );
 
     ESP_LOGI(TAG, "wifi_init_sta finished.");
@@ -145,27 +150,6 @@ static void wifi_init_sta(void) {
     // Wi-Fi stack keeps event handlers registered after connect
 }
 
-// --- SNTP Initialization ---
-static void initialize_sntp(void) {
-    ESP_LOGI(TAG, "Initializing SNTP");
-    esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
-    esp_sntp_setservername(0, "pool.ntp.org"); // Use NTP pool server
-    esp_sntp_set_time_sync_notification_cb(time_sync_notification_cb);
-    // esp_sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH); // Optional: Smooth sync
-    esp_sntp_init();
-
-    // Set Timezone to CST (UTC+8) - China Standard Time (also Taiwan Standard Time)
-    setenv("TZ", "CST-8", 1); // Format is std<offset>[dst[offset][,start[/time],end[/time]]]
-    tzset(); // Apply the timezone setting
-    ESP_LOGI(TAG, "Timezone set to CST-8");
-}
-
-// --- SNTP Time Sync Callback ---
-static void time_sync_notification_cb(struct timeval *tv) {
-    ESP_LOGI(TAG, "SNTP time synchronized: %ld seconds", tv->tv_sec);
-    sntp_synchronized = true;
-}
-
 // --- HTTP Event Handler (for reading response body) ---
 esp_err_t _http_event_handler(esp_http_client_event_t *evt) {
     switch(evt->event_id) {
@@ -174,6 +158,11 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt) {
             break;
         case HTTP_EVENT_ON_CONNECTED:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
+            if (!http_connected) { // Once per request, also across redirects
+                http_connected = true;
+                wake_trace_end(WAKE_TRACE_TLS, 0);
+                wake_trace_begin(WAKE_TRACE_DOWNLOAD);
+            }
             break;
         case HTTP_EVENT_HEADER_SENT:
             ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
@@ -184,8 +173,11 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt) {
         case HTTP_EVENT_ON_DATA:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
             // Process incoming data chunk by chunk
+             http_bytes += evt->data_len;
              if (evt->user_data) { // Check if context pointer is valid
+                 int64_t parse_start_us = esp_timer_get_time();
                  parse_ics_data(evt->data, evt->data_len);
+                 wake_trace_add(WAKE_TRACE_PARSE, parse_start_us);
              }
              // Example of storing chunked data (if not parsing directly)
              /*
@@ -249,10 +241,37 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt) {
     return ESP_OK;
 }
 
+// --- Timed DNS Lookup ---
+// Resolves the URL's host on its own, so the trace shows DNS apart from the
+// TLS handshake; lwIP caches the answer for the HTTP client's own lookup
+static void trace_dns_lookup(const char *url) {
+    char host[128] = {0};
+    const char *start = strstr(url, "://");
+    start = start ? start + 3 : url;
+    size_t len = strcspn(start, ":/?");
+    if (len == 0 || len >= sizeof(host)) {
+        return;
+    }
+    memcpy(host, start, len);
+
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *res = NULL;
+    wake_trace_begin(WAKE_TRACE_DNS);
+    int err = getaddrinfo(host, NULL, &hints, &res);
+    wake_trace_end(WAKE_TRACE_DNS, (uint32_t)err);
+    if (err != 0) {
+        ESP_LOGW(TAG, "DNS lookup for %s failed (%d)", host, err);
+    }
+    if (res) {
+        freeaddrinfo(res);
+    }
+}
+
 // --- Fetch ICS Data via HTTP GET ---
 esp_err_t http_get_ics(const char *url) {
     future_event_count = 0; // Reset event counter for new fetch
     memset(future_events, 0, sizeof(future_events)); // Clear event array
+    trace_dns_lookup(url);
 
     esp_http_client_config_t config = {
         .url = url,
@@ -270,7 +289,15 @@ esp_err_t http_get_ics(const char *url) {
          return ESP_FAIL;
     }
 
+    http_connected = false;
+    http_bytes = 0;
+    wake_trace_begin(WAKE_TRACE_TLS); // Through the TCP connect to HTTP_EVENT_ON_CONNECTED
     esp_err_t err = esp_http_client_perform(client);
+    if (http_connected) {
+        wake_trace_end(WAKE_TRACE_DOWNLOAD, http_bytes);
+    } else {
+        wake_trace_end(WAKE_TRACE_TLS, (uint32_t)err); // Never connected
+    }
     if (err == ESP_OK) {
         ESP_LOGI(TAG, "HTTPS GET Status = %d, content_length = %"PRId64,
                 esp_http_client_get_status_code(client),
@@ -363,6 +390,46 @@ static char line_buffer[MAX_ICS_LINE_LEN] = {0};
 static int line_buffer_len = 0;
 static bool in_vevent = false;
 static calendar_event_t current_event = {0};
+static bool current_all_day = false; // DTSTART 只有日期
+
+// DTSTART/DTEND 的值轉成 UTC time_t；失敗回傳 -1
+static time_t ics_value_to_time(const char *dt_value_raw) {
+    struct tm parsed_tm;
+    bool is_event_utc = false;
+    if (!manual_parse_dtstart(dt_value_raw, &parsed_tm, &is_event_utc)) {
+        return (time_t)-1; // manual_parse_dtstart already logged the error
+    }
+
+    time_t event_time_t;
+    char *original_tz_env = getenv("TZ"); // Get current TZ set by time_service_init
+
+    if (is_event_utc) {
+        // Convert UTC tm to UTC time_t
+        setenv("TZ", "UTC0", 1); // Temporarily set system TZ to UTC
+        tzset();
+        event_time_t = mktime(&parsed_tm); 
+        
+        // Restore original/application TZ
+        if (original_tz_env && strlen(original_tz_env) > 0) {
+            setenv("TZ", original_tz_env, 1);
+        } else { 
+            // If original was NULL or empty, revert to system default (often by unsetting)
+            // For this app, it means back to the TZ time_service_init set
+            setenv("TZ", TIME_SERVICE_TZ, 1);
+        }
+        tzset();
+    } else {
+        // Time is floating or local. mktime will use ESP32's current TZ setting (e.g., "CST-8").
+        event_time_t = mktime(&parsed_tm);
+    }
+
+    if (event_time_t == (time_t)-1) {
+        ESP_LOGW(TAG, "mktime failed for parsed value: %s", dt_value_raw);
+    } else {
+        ESP_LOGI(TAG, "Parsed [%s] (UTC flag: %s) -> UTC time_t: %lld", dt_value_raw, is_event_utc ? "Yes" : "No", (long long)event_time_t);
+    }
+    return event_time_t;
+}
 
 static void process_ics_line(const char *line) {
     // ESP_LOGD(TAG, "Processing line: [%s]", line); // DEBUG: See every line
@@ -370,6 +437,7 @@ static void process_ics_line(const char *line) {
         ESP_LOGD(TAG, "Found BEGIN:VEVENT");
         in_vevent = true;
         memset(&current_event, 0, sizeof(current_event)); 
+        current_all_day = false;
         return;
     }
     if (strncmp(line, "END:VEVENT", 10) == 0) {
@@ -377,20 +445,27 @@ static void process_ics_line(const char *line) {
         if (in_vevent) {
             time_t now_utc;
             time(&now_utc); // time() returns UTC time_t
+
+            // 沒有 DTEND：全天事件持續一天，其他的只有開始那一刻 (RFC 5545)
+            if (current_event.start_time > 0 && current_event.end_time <= current_event.start_time) {
+                current_event.end_time = current_event.start_time + (current_all_day ? 24 * 3600 : 0);
+            }
             
-            ESP_LOGD(TAG, "Event Summary: [%s], Raw DTSTART time_t: %lld, Current UTC time_t: %lld", 
-                     current_event.summary, (long long)current_event.start_time, (long long)now_utc);
+            ESP_LOGD(TAG, "Event Summary: [%s], Raw DTSTART time_t: %lld, DTEND time_t: %lld, Current UTC time_t: %lld", 
+                     current_event.summary, (long long)current_event.start_time,
+                     (long long)current_event.end_time, (long long)now_utc);
 
-            if (current_event.start_time > 0 && current_event.start_time > now_utc) {
+            // 進行中的事件也留著，畫面上顯示到它結束
+            if (current_event.start_time > 0 && current_event.end_time > now_utc) {
                  if (future_event_count < MAX_EVENTS) {
                     memcpy(&future_events[future_event_count], &current_event, sizeof(calendar_event_t));
-                    ESP_LOGI(TAG, "Added future event: [%s] at %lld", current_event.summary, (long long)current_event.start_time);
+                    ESP_LOGI(TAG, "Added event: [%s] at %lld", current_event.summary, (long long)current_event.start_time);
                     future_event_count++;
                  } else {
                       ESP_LOGW(TAG, "Max future events limit reached (%d)", MAX_EVENTS);
                  }
             } else if (current_event.start_time > 0) {
-                 ESP_LOGD(TAG, "Event [%s] is in the past or now.", current_event.summary);
+                 ESP_LOGD(TAG, "Event [%s] has ended.", current_event.summary);
             }
         }
         in_vevent = false;
@@ -413,52 +488,20 @@ static void process_ics_line(const char *line) {
 
                 ESP_LOGD(TAG, "Found Summary: [%s]", current_event.summary);
             }
-        } else if (strncmp(line, "DTSTART", 7) == 0) {
-            ESP_LOGD(TAG, "Found DTSTART line: [%s]", line);
+        } else if (strncmp(line, "DTSTART", 7) == 0 || strncmp(line, "DTEND", 5) == 0) {
+            ESP_LOGD(TAG, "Found DTSTART/DTEND line: [%s]", line);
             const char *dt_value_raw = strchr(line, ':');
             if (dt_value_raw) {
                 dt_value_raw++; 
-
-                struct tm parsed_tm;
-                bool is_event_utc = false;
-                if (manual_parse_dtstart(dt_value_raw, &parsed_tm, &is_event_utc)) {
-                    time_t event_time_t;
-                    char *original_tz_env = getenv("TZ"); // Get current TZ set by initialize_sntp
-
-                    if (is_event_utc) {
-                        // Convert UTC tm to UTC time_t
-                        setenv("TZ", "UTC0", 1); // Temporarily set system TZ to UTC
-                        tzset();
-                        event_time_t = mktime(&parsed_tm); 
-                        
-                        // Restore original/application TZ
-                        if (original_tz_env && strlen(original_tz_env) > 0) {
-                            setenv("TZ", original_tz_env, 1);
-                        } else { 
-                            // If original was NULL or empty, revert to system default (often by unsetting)
-                            // For this app, it means back to CST-8 if initialize_sntp set it
-                            // If unsure, re-set to application default:
-                            setenv("TZ", "CST-8", 1); // Or use original_timezone_str if saved globally
-                        }
-                        tzset();
-                    } else {
-                        // Time is floating or local. mktime will use ESP32's current TZ setting (e.g., "CST-8").
-                        event_time_t = mktime(&parsed_tm);
-                    }
-
-                    if (event_time_t == (time_t)-1) {
-                        ESP_LOGW(TAG, "mktime failed for parsed DTSTART value: %s", dt_value_raw);
-                        current_event.start_time = (time_t)-1; 
-                    } else {
-                        current_event.start_time = event_time_t;
-                         ESP_LOGI(TAG, "Parsed DTSTART [%s] (UTC flag: %s) -> UTC time_t: %lld", dt_value_raw, is_event_utc ? "Yes" : "No", (long long)event_time_t);
-                    }
+                time_t t = ics_value_to_time(dt_value_raw);
+                if (line[2] == 'S') {
+                    current_event.start_time = t;
+                    current_all_day = strchr(dt_value_raw, 'T') == NULL;
                 } else {
-                    // manual_parse_dtstart already logged the error
-                    current_event.start_time = (time_t)-1; 
+                    current_event.end_time = t;
                 }
             } else {
-                 ESP_LOGW(TAG, "DTSTART line format error (no colon?): [%s]", line);
+                 ESP_LOGW(TAG, "DTSTART/DTEND line format error (no colon?): [%s]", line);
             }
         }
     }
@@ -572,23 +615,21 @@ static int compare_events(const void *a, const void *b) {
 }
 
 // --- Print Upcoming Events ---
-static void print_upcoming_events(int count) {
-    if (future_event_count == 0) {
-        ESP_LOGI(TAG, "No upcoming events found in ICS.");
-        return;
-    }
-
-    ESP_LOGI(TAG, "--- Upcoming Events (Max %d) ---", count);
-    int print_count = (future_event_count < count) ? future_event_count : count;
-
+// 目前的「畫面」：事件在 refresh_scheduler 算出的範圍內，開始或結束時畫面跟著變
+static void print_upcoming_events(const calendar_event_t *events, int count) {
     time_t now;
     time(&now);
     ESP_LOGI(TAG, "Current Time: %s", ctime(&now)); // ctime adds newline
 
-    for (int i = 0; i < print_count; i++) {
+    if (count == 0) {
+        ESP_LOGI(TAG, "No upcoming events.");
+        return;
+    }
+
+    ESP_LOGI(TAG, "--- Upcoming Events (Max %d) ---", REFRESH_VIEW_EVENTS);
+    for (int i = 0; i < count; i++) {
         // Convert UTC start_time to local time string for printing
-        // time_t local_start = future_events[i].start_time; // Already UTC time_t
-        struct tm *local_tm = localtime(&future_events[i].start_time);
+        struct tm *local_tm = localtime(&events[i].start_time);
         char time_buf[64];
         if (local_tm) {
              strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S %Z", local_tm); // Format as local time with TZ name
@@ -596,81 +637,115 @@ static void print_upcoming_events(int count) {
              snprintf(time_buf, sizeof(time_buf), "Invalid Time");
         }
 
-        ESP_LOGI(TAG, "%d: %s - %s", i + 1, time_buf, future_events[i].summary);
+        ESP_LOGI(TAG, "%d: %s - %s%s", i + 1, time_buf, events[i].summary,
+                 events[i].start_time <= now ? " (now)" : "");
     }
      ESP_LOGI(TAG, "-----------------------------");
 }
 
-
-// --- Main Application ---
-void app_main(void) {
+// --- Fetch over Wi-Fi ---
+// 連上 Wi-Fi、必要時對時、抓 ICS；成功就存進 refresh_scheduler
+static void fetch_over_wifi(void) {
     // Initialize NVS
+    wake_trace_begin(WAKE_TRACE_NVS_INIT);
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
       ESP_ERROR_CHECK(nvs_flash_erase());
       ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+    wake_trace_end(WAKE_TRACE_NVS_INIT, 0);
 
     // Initialize Wi-Fi and connect
     ESP_LOGI(TAG, "Initializing Wi-Fi...");
     wifi_init_sta();
 
-    // Wait until Wi-Fi is connected
+    time_t now;
     EventBits_t bits = xEventGroupGetBits(wifi_event_group);
     if (!(bits & WIFI_CONNECTED_BIT)) {
-         ESP_LOGE(TAG, "Wi-Fi connection failed. Cannot proceed.");
-         // Maybe block or restart?
-         vTaskDelay(portMAX_DELAY);
-         return; // Should not happen if wifi_init_sta blocks
+         ESP_LOGE(TAG, "Wi-Fi connection failed, showing the kept events.");
+         esp_wifi_stop();
+         time(&now);
+         refresh_scheduler_fetch_failed(now);
+         return;
     }
     ESP_LOGI(TAG, "Wi-Fi Connected.");
 
-    // Initialize SNTP and wait for sync
-    ESP_LOGI(TAG, "Initializing SNTP...");
-    initialize_sntp();
-    int max_sntp_wait_sec = 30;
-    while (!sntp_synchronized && max_sntp_wait_sec-- > 0) {
-        vTaskDelay(1000 / portTICK_PERIOD_MS);
-    }
-    if (!sntp_synchronized) {
+    // SNTP only if the expected clock error calls for it, and in the background;
+    // waiting is needed only when there is no usable time (after power-on),
+    // since parsing drops past events
+    time_service_start_sync();
+    if (time_service_wait_valid(pdMS_TO_TICKS(30000)) != ESP_OK) {
         ESP_LOGE(TAG, "SNTP time synchronization failed. Event times may be incorrect.");
         // Proceed anyway? Or stop? For demo, proceed.
     } else {
-         time_t now;
          time(&now);
          struct tm timeinfo;
          localtime_r(&now, &timeinfo);
          char strftime_buf[64];
          strftime(strftime_buf, sizeof(strftime_buf), "%c", &timeinfo);
-         ESP_LOGI(TAG, "Current local time set: %s", strftime_buf);
+         ESP_LOGI(TAG, "Current local time: %s (expected error %ld ms)", strftime_buf,
+                  (long)time_service_expected_error_ms());
     }
 
 
     // Fetch and parse ICS data
     ESP_LOGI(TAG, "Fetching ICS data from %s", ICS_URL);
     ret = http_get_ics(ICS_URL);
+    time(&now);
 
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "ICS data fetched successfully. Parsed %d future events.", future_event_count);
 
         // Sort events by start time
         if (future_event_count > 0) {
+            int64_t sort_start_us = esp_timer_get_time();
             qsort(future_events, future_event_count, sizeof(calendar_event_t), compare_events);
+            wake_trace_add(WAKE_TRACE_PARSE, sort_start_us);
             ESP_LOGI(TAG, "Future events sorted.");
         }
+        refresh_scheduler_store(future_events, future_event_count, now);
+    } else {
+        ESP_LOGE(TAG, "Failed to fetch or process ICS data.");
+        refresh_scheduler_fetch_failed(now);
+    }
+
+    time_service_stop(pdMS_TO_TICKS(3000)); // A sync still running gets a little longer
+    esp_wifi_stop();
+}
 
-        // Print the upcoming events
-        print_upcoming_events(10); // Print the nearest 10
 
+// --- Main Application ---
+// 每次喚醒跑一遍：需要時才連網抓 ICS，畫出目前的畫面，再深睡到下一次畫面變化
+void app_main(void) {
+    wake_trace_init();
+    time_service_init(); // After deep sleep the clock is good without SNTP
+
+    time_t now;
+    time(&now);
+    if (refresh_scheduler_fetch_due(now)) {
+        fetch_over_wifi();
     } else {
-        ESP_LOGE(TAG, "Failed to fetch or process ICS data.");
+        ESP_LOGI(TAG, "No fetch due, re-rendering the kept events without Wi-Fi.");
     }
 
+    time(&now);
+    calendar_event_t view[REFRESH_VIEW_EVENTS];
+    int view_count = refresh_scheduler_view(now, view, REFRESH_VIEW_EVENTS);
+    print_upcoming_events(view, view_count);
+
     ESP_LOGI(TAG, "ICS Demo finished.");
+#if WAKE_TRACE_CONSOLE_S > 0
+    // `trace dump` prints this and the earlier cycles. Only after a power-on or
+    // a reset (press reset to read the trace); timer wakes go straight back to
+    // sleep, so the console costs no energy in normal operation.
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP) {
+        wake_trace_flush();
+        wake_trace_console_start();
+        vTaskDelay(pdMS_TO_TICKS(WAKE_TRACE_CONSOLE_S * 1000));
+        time(&now);
+    }
+#endif
 
-     // Keep task running or enter deep sleep etc.
-     while(1) {
-         vTaskDelay(pdMS_TO_TICKS(60000));
-     }
-}
\ No newline at end of file
+    refresh_scheduler_sleep(now);
+}
@@ -0,0 +1,140 @@
+#include "refresh_scheduler.h"
+
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "time_service.h"
+#include "wake_trace.h"
+
+#define REFRESH_CACHE_MAGIC 0x52534331 // "RSC1"; change with calendar_event_t
+
+static const char *TAG = "REFRESH";
+
+// --- Events Kept in RTC Memory ---
+typedef struct {
+    uint32_t magic;             // Set by the first successful fetch since power-on
+    bool truncated;             // The fetch had more events than fit
+    uint8_t count;
+    uint32_t retry_s;           // Back-off of the next failed fetch
+    time_t next_fetch;
+    calendar_event_t events[REFRESH_CACHE_EVENTS]; // By start time
+} refresh_cache_t;
+
+static RTC_DATA_ATTR refresh_cache_t s_cache;
+
+// --- Helpers ---
+static time_t next_local_midnight(time_t now) {
+    struct tm tm;
+    localtime_r(&now, &tm);
+    tm.tm_mday += 1;
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return mktime(&tm);
+}
+
+static void earliest_after(time_t* next, time_t t, time_t now) {
+    if (t > now && t < *next) {
+        *next = t;
+    }
+}
+
+// --- Public Functions ---
+
+bool refresh_scheduler_fetch_due(time_t now) {
+    if (s_cache.magic != REFRESH_CACHE_MAGIC || !time_service_is_valid() || now >= s_cache.next_fetch) {
+        return true;
+    }
+    if (s_cache.truncated) {
+        calendar_event_t view[REFRESH_VIEW_EVENTS];
+        if (refresh_scheduler_view(now, view, REFRESH_VIEW_EVENTS) < REFRESH_VIEW_EVENTS) {
+            return true; // The events behind the kept ones are needed now
+        }
+    }
+    return false;
+}
+
+void refresh_scheduler_store(const calendar_event_t* events, int count, time_t now) {
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (events[i].end_time <= now) {
+            continue;
+        }
+        if (kept == REFRESH_CACHE_EVENTS) {
+            break;
+        }
+        s_cache.events[kept++] = events[i];
+    }
+    s_cache.count = kept;
+    s_cache.truncated = kept == REFRESH_CACHE_EVENTS && count > kept;
+    s_cache.next_fetch = now + REFRESH_FETCH_INTERVAL_S;
+    s_cache.retry_s = REFRESH_RETRY_MIN_S;
+    s_cache.magic = REFRESH_CACHE_MAGIC;
+    ESP_LOGI(TAG, "Kept %d events%s, next fetch in %d s", kept, s_cache.truncated ? " (more in the ICS)" : "",
+             REFRESH_FETCH_INTERVAL_S);
+}
+
+void refresh_scheduler_fetch_failed(time_t now) {
+    if (s_cache.retry_s < REFRESH_RETRY_MIN_S) {
+        s_cache.retry_s = REFRESH_RETRY_MIN_S; // First failure since power-on
+    }
+    s_cache.next_fetch = now + s_cache.retry_s;
+    ESP_LOGW(TAG, "Fetch failed, retrying in %lu s", (unsigned long)s_cache.retry_s);
+    s_cache.retry_s *= 2;
+    if (s_cache.retry_s > REFRESH_FETCH_INTERVAL_S) {
+        s_cache.retry_s = REFRESH_FETCH_INTERVAL_S;
+    }
+}
+
+int refresh_scheduler_view(time_t now, calendar_event_t* out, int max) {
+    if (s_cache.magic != REFRESH_CACHE_MAGIC) {
+        return 0;
+    }
+    int n = 0;
+    for (int i = 0; i < s_cache.count && n < max; i++) {
+        if (s_cache.events[i].end_time > now) {
+            out[n++] = s_cache.events[i];
+        }
+    }
+    return n;
+}
+
+time_t refresh_scheduler_next_change(time_t now) {
+    time_t next = next_local_midnight(now);
+    earliest_after(&next, s_cache.next_fetch, now);
+
+    // The screen changes when an event on it starts (upcoming to ongoing) or
+    // ends (it leaves and the next one comes in)
+    calendar_event_t view[REFRESH_VIEW_EVENTS];
+    int n = refresh_scheduler_view(now, view, REFRESH_VIEW_EVENTS);
+    for (int i = 0; i < n; i++) {
+        earliest_after(&next, view[i].start_time, now);
+        earliest_after(&next, view[i].end_time, now);
+    }
+    return next;
+}
+
+void refresh_scheduler_sleep(time_t now) {
+    uint32_t sleep_s;
+    if (!time_service_is_valid()) {
+        // No usable clock to plan with: try the network again after the back-off
+        sleep_s = s_cache.retry_s ? s_cache.retry_s : REFRESH_RETRY_MIN_S;
+    } else {
+        time_t next = refresh_scheduler_next_change(now);
+        sleep_s = (uint32_t)(next > now ? next - now : 0) + REFRESH_WAKE_MARGIN_S;
+
+        struct tm tm;
+        char buf[32];
+        localtime_r(&next, &tm);
+        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+        ESP_LOGI(TAG, "Next change at %s", buf);
+    }
+
+    ESP_LOGI(TAG, "Deep sleep for %lu s", (unsigned long)sleep_s);
+    wake_trace_flush();
+    wake_trace_instant(WAKE_TRACE_SLEEP, sleep_s);
+    esp_sleep_enable_timer_wakeup(time_service_rtc_us((uint64_t)sleep_s * 1000000));
+    esp_deep_sleep_start();
+}
@@ -0,0 +1,63 @@
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include <stdbool.h>
+#include <time.h>
+#include "calendar_event.h"
+
+// When the screen has to change next, and deep sleep until then.
+//
+// The parsed events are kept in RTC memory, so a wake for a change of the
+// screen (midnight, an event starting or ending) re-renders without Wi-Fi.
+// The network is used only when a fetch is due: every
+// REFRESH_FETCH_INTERVAL_S, sooner when the kept events run short, and with a
+// growing back-off after a failure.
+
+#define REFRESH_VIEW_EVENTS         10          // Events on the screen
+#define REFRESH_CACHE_EVENTS        16          // Events kept in RTC memory: ~2 KB of the 8 KB
+#define REFRESH_FETCH_INTERVAL_S    (30 * 60)   // Fetch the ICS at most this often
+#define REFRESH_RETRY_MIN_S         120         // First retry after a failed fetch, doubling up to the interval
+#define REFRESH_WAKE_MARGIN_S       2           // Wake this long after a change, so the screen is past it
+
+/**
+ * @brief Whether this wake needs the network: no events kept since power-on,
+ * no usable time, the fetch interval is up, or the kept events no longer
+ * fill the screen.
+ */
+bool refresh_scheduler_fetch_due(time_t now);
+
+/**
+ * @brief Keeps the events of a successful fetch in RTC memory.
+ *
+ * @param events Sorted by start time.
+ */
+void refresh_scheduler_store(const calendar_event_t* events, int count, time_t now);
+
+/**
+ * @brief Records a failed fetch (Wi-Fi or HTTP); the next one is tried after
+ * the back-off. The kept events stay on the screen.
+ */
+void refresh_scheduler_fetch_failed(time_t now);
+
+/**
+ * @brief Events on the screen at `now`: the first ones that have not ended,
+ * by start time.
+ *
+ * @return int Number of events written to out, at most max.
+ */
+int refresh_scheduler_view(time_t now, calendar_event_t* out, int max);
+
+/**
+ * @brief The next moment after `now` the screen changes or a fetch is due:
+ * local midnight, the start or end of an event on the screen, or the next
+ * fetch.
+ */
+time_t refresh_scheduler_next_change(time_t now);
+
+/**
+ * @brief Flushes the wake trace and deep sleeps until the next change. Does
+ * not return; the wake starts over in app_main.
+ */
+void refresh_scheduler_sleep(time_t now);
+
+#endif // REFRESH_SCHEDULER_H
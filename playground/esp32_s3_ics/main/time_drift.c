@@ -0,0 +1,31 @@
+#include "time_drift.h"
+
+#define PPB 1000000000LL
+
+// --- Conversions ---
+// The products with 1e9 overflow int64 after about 2.5 h of microseconds, so
+// the whole multiples of the divisor are taken out first and only the
+// remainder, which is smaller than the divisor, is scaled.
+int64_t time_drift_utc_elapsed_us(int64_t rtc_elapsed_us, int32_t drift_ppb) {
+    int64_t divisor = PPB + drift_ppb;
+    int64_t whole = rtc_elapsed_us / divisor;
+    int64_t rest = rtc_elapsed_us % divisor;
+    return whole * PPB + rest * PPB / divisor;
+}
+
+int32_t time_drift_measure_ppb(int64_t rtc_span_us, int64_t utc_span_us) {
+    int64_t diff = rtc_span_us - utc_span_us;
+    int64_t whole = diff / utc_span_us;
+    int64_t rest = diff % utc_span_us;
+    // rest * 1e9 fits while the span is under about 2.5 h; longer spans lose
+    // the sub-ppb digits of the remainder instead
+    while (rest > INT64_MAX / PPB || rest < -(INT64_MAX / PPB)) {
+        rest /= 10;
+        utc_span_us /= 10;
+    }
+    int64_t ppb = whole * PPB + rest * PPB / utc_span_us;
+    if (ppb > INT32_MAX) {
+        return INT32_MAX;
+    }
+    return ppb < INT32_MIN ? INT32_MIN : (int32_t)ppb;
+}
@@ -0,0 +1,22 @@
+#ifndef TIME_DRIFT_H
+#define TIME_DRIFT_H
+
+#include <stdint.h>
+
+// Drift arithmetic of time_service, kept free of ESP-IDF so it can be checked
+// on the host (ics_host_test). Drift is in ppb, positive when the RTC clock
+// runs faster than UTC. Spans of any length are handled without overflow.
+
+/**
+ * @brief UTC time that passed while the RTC clock counted rtc_elapsed_us,
+ * i.e. rtc_elapsed_us * 1e9 / (1e9 + drift_ppb).
+ */
+int64_t time_drift_utc_elapsed_us(int64_t rtc_elapsed_us, int32_t drift_ppb);
+
+/**
+ * @brief Drift measured over a span: (rtc_span_us - utc_span_us) * 1e9 / utc_span_us.
+ * utc_span_us must be positive.
+ */
+int32_t time_drift_measure_ppb(int64_t rtc_span_us, int64_t utc_span_us);
+
+#endif // TIME_DRIFT_H
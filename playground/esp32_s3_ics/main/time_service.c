@@ -0,0 +1,186 @@
+#include "time_service.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <sys/time.h>
+#include "freertos/event_groups.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_rtc_time.h"
+#include "esp_sntp.h"
+#include "time_drift.h"
+#include "wake_trace.h"
+
+#define TIME_SERVICE_MAGIC          0x54535631 // "TSV1"
+#define TIME_SERVICE_SYNC_ERROR_MS  100     // Error right after an SNTP sync
+#define TIME_SERVICE_DEFAULT_PPM    1000    // Assumed drift bound before one is measured
+#define TIME_SERVICE_MIN_PPM        20      // Floor of the drift uncertainty
+#define TIME_SERVICE_MIN_SPAN_S     1800    // Shortest span a drift is measured over
+
+static const char *TAG = "TIME_SVC";
+
+// --- State in RTC Memory ---
+// RTC time is esp_rtc_get_time_us(): counts through deep sleep and is never
+// set, unlike the system time. The drift is how much faster it runs than UTC.
+typedef struct {
+    uint32_t magic;
+    bool synced;                // Synced since power-on
+    bool drift_known;
+    int64_t sync_utc_us;        // Last sync
+    int64_t sync_rtc_us;
+    int64_t anchor_utc_us;      // Start of the span the next drift is measured over
+    int64_t anchor_rtc_us;
+    int32_t drift_ppb;          // Smoothed over the measurements
+    int32_t uncertainty_ppb;    // Last change of the estimate, at least TIME_SERVICE_MIN_PPM
+} time_service_state_t;
+
+static RTC_DATA_ATTR time_service_state_t s_state;
+
+static EventGroupHandle_t s_event_group = NULL;
+#define TIME_SERVICE_SYNCED_BIT BIT0
+static bool s_sntp_running = false;
+
+// --- Helpers ---
+static int64_t utc_now_us(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// UTC now from the last sync and the RTC time since, corrected for the drift
+static int64_t estimated_utc_us(void) {
+    int64_t rtc_elapsed = (int64_t)esp_rtc_get_time_us() - s_state.sync_rtc_us;
+    int32_t drift_ppb = s_state.drift_known ? s_state.drift_ppb : 0;
+    return s_state.sync_utc_us + time_drift_utc_elapsed_us(rtc_elapsed, drift_ppb);
+}
+
+// Runs in the SNTP task
+static void time_service_sync_cb(struct timeval *tv) {
+    int64_t utc_us = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+    int64_t rtc_us = (int64_t)esp_rtc_get_time_us();
+    int64_t offset_ms = s_state.synced ? (estimated_utc_us() - utc_us) / 1000 : 0;
+
+    if (!s_state.synced) {
+        s_state.anchor_utc_us = utc_us;
+        s_state.anchor_rtc_us = rtc_us;
+    } else if (utc_us - s_state.anchor_utc_us >= TIME_SERVICE_MIN_SPAN_S * 1000000LL) {
+        int64_t utc_span = utc_us - s_state.anchor_utc_us;
+        int64_t rtc_span = rtc_us - s_state.anchor_rtc_us;
+        int32_t measured_ppb = time_drift_measure_ppb(rtc_span, utc_span);
+        if (s_state.drift_known) {
+            int32_t change = abs(measured_ppb - s_state.drift_ppb);
+            s_state.drift_ppb += (measured_ppb - s_state.drift_ppb) / 4;
+            s_state.uncertainty_ppb = change > TIME_SERVICE_MIN_PPM * 1000 ? change : TIME_SERVICE_MIN_PPM * 1000;
+        } else {
+            s_state.drift_ppb = measured_ppb;
+            s_state.uncertainty_ppb = TIME_SERVICE_DEFAULT_PPM * 1000 / 10; // One measurement
+        }
+        s_state.drift_known = true;
+        s_state.anchor_utc_us = utc_us;
+        s_state.anchor_rtc_us = rtc_us;
+    }
+    s_state.sync_utc_us = utc_us;
+    s_state.sync_rtc_us = rtc_us;
+    s_state.synced = true;
+    s_state.magic = TIME_SERVICE_MAGIC;
+
+    ESP_LOGI(TAG, "SNTP sync: clock was off by %lld ms, RTC drift %ld ppm (+/- %ld)", (long long)offset_ms,
+             (long)(s_state.drift_ppb / 1000), (long)((s_state.drift_known ? s_state.uncertainty_ppb : 0) / 1000));
+    if (s_event_group && !(xEventGroupGetBits(s_event_group) & TIME_SERVICE_SYNCED_BIT)) {
+        xEventGroupSetBits(s_event_group, TIME_SERVICE_SYNCED_BIT);
+        wake_trace_end(WAKE_TRACE_SNTP, 1);
+    }
+}
+
+// --- Public Functions ---
+
+void time_service_init(void) {
+    setenv("TZ", TIME_SERVICE_TZ, 1);
+    tzset();
+    if (s_event_group == NULL) {
+        s_event_group = xEventGroupCreate();
+    }
+    if (s_state.magic != TIME_SERVICE_MAGIC) {
+        s_state = (time_service_state_t){ 0 }; // Power-on: nothing to go on
+        ESP_LOGI(TAG, "No time since power-on, SNTP needed");
+        return;
+    }
+    if (!s_state.synced) {
+        return;
+    }
+
+    // The system time kept through deep sleep runs with the RTC drift; replace
+    // it with the corrected estimate
+    int64_t estimate_us = estimated_utc_us();
+    int64_t correction_ms = (estimate_us - utc_now_us()) / 1000;
+    struct timeval tv = { .tv_sec = estimate_us / 1000000, .tv_usec = estimate_us % 1000000 };
+    settimeofday(&tv, NULL);
+    ESP_LOGI(TAG, "Clock corrected by %lld ms, expected error %ld ms", (long long)correction_ms,
+             (long)time_service_expected_error_ms());
+}
+
+int32_t time_service_expected_error_ms(void) {
+    if (s_state.magic != TIME_SERVICE_MAGIC || !s_state.synced) {
+        return INT32_MAX;
+    }
+    int64_t elapsed_us = (int64_t)esp_rtc_get_time_us() - s_state.sync_rtc_us;
+    int64_t ppb = s_state.drift_known ? s_state.uncertainty_ppb : TIME_SERVICE_DEFAULT_PPM * 1000LL;
+    int64_t error_ms = TIME_SERVICE_SYNC_ERROR_MS + elapsed_us / 1000 * ppb / 1000000000LL;
+    return error_ms > INT32_MAX ? INT32_MAX : (int32_t)error_ms;
+}
+
+bool time_service_is_valid(void) {
+    return time_service_expected_error_ms() <= TIME_SERVICE_USABLE_ERROR_MS;
+}
+
+uint64_t time_service_rtc_us(uint64_t duration_us) {
+    if (s_state.magic != TIME_SERVICE_MAGIC || !s_state.drift_known) {
+        return duration_us;
+    }
+    int64_t drift_us = (int64_t)(duration_us / 1000) * s_state.drift_ppb / 1000000;
+    return (uint64_t)((int64_t)duration_us + drift_us);
+}
+
+esp_err_t time_service_start_sync(void) {
+    int32_t error_ms = time_service_expected_error_ms();
+    int64_t age_s = ((int64_t)esp_rtc_get_time_us() - s_state.sync_rtc_us) / 1000000;
+    if (error_ms <= TIME_SERVICE_RESYNC_ERROR_MS && age_s < TIME_SERVICE_MAX_SYNC_AGE_S) {
+        ESP_LOGI(TAG, "Skipping SNTP: expected error %ld ms, last sync %lld s ago", (long)error_ms, (long long)age_s);
+        wake_trace_instant(WAKE_TRACE_SNTP, (uint32_t)error_ms);
+        return ESP_OK;
+    }
+    if (s_sntp_running) {
+        return ESP_OK;
+    }
+
+    ESP_LOGI(TAG, "Starting SNTP in the background");
+    xEventGroupClearBits(s_event_group, TIME_SERVICE_SYNCED_BIT);
+    wake_trace_begin(WAKE_TRACE_SNTP);
+    esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    esp_sntp_setservername(0, "pool.ntp.org"); // Use NTP pool server
+    esp_sntp_set_time_sync_notification_cb(time_service_sync_cb);
+    esp_sntp_init();
+    s_sntp_running = true;
+    return ESP_OK;
+}
+
+esp_err_t time_service_wait_valid(TickType_t timeout_ticks) {
+    if (time_service_is_valid()) {
+        return ESP_OK;
+    }
+    EventBits_t bits = xEventGroupWaitBits(s_event_group, TIME_SERVICE_SYNCED_BIT, pdFALSE, pdFALSE, timeout_ticks);
+    return (bits & TIME_SERVICE_SYNCED_BIT) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+void time_service_stop(TickType_t timeout_ticks) {
+    if (!s_sntp_running) {
+        return;
+    }
+    EventBits_t bits = xEventGroupWaitBits(s_event_group, TIME_SERVICE_SYNCED_BIT, pdFALSE, pdFALSE, timeout_ticks);
+    if (!(bits & TIME_SERVICE_SYNCED_BIT)) {
+        ESP_LOGW(TAG, "SNTP did not answer, trying again next wake");
+        wake_trace_end(WAKE_TRACE_SNTP, 0);
+    }
+    esp_sntp_stop();
+    s_sntp_running = false;
+}
@@ -0,0 +1,66 @@
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+// Wall clock across deep sleep without an SNTP round-trip on every wake.
+//
+// The last sync and the measured drift of the RTC clock are kept in RTC
+// memory. On wake the clock is corrected for the drift, and SNTP runs only
+// when the expected error has grown past TIME_SERVICE_RESYNC_ERROR_MS, in the
+// background next to the other network work.
+
+#define TIME_SERVICE_TZ                 "CST-8" // POSIX TZ of the calendar
+#define TIME_SERVICE_RESYNC_ERROR_MS    2000    // Re-sync once the expected error is above this
+#define TIME_SERVICE_USABLE_ERROR_MS    60000   // Up to this the clock is used while a sync runs
+#define TIME_SERVICE_MAX_SYNC_AGE_S     (24 * 3600) // Re-sync at least this often
+
+/**
+ * @brief Sets the time zone and, after deep sleep, corrects the clock for the
+ * RTC drift measured so far. Call early in app_main, before the time is used.
+ */
+void time_service_init(void);
+
+/**
+ * @brief Whether the clock can be used now: synced since power-on and the
+ * expected error within TIME_SERVICE_USABLE_ERROR_MS.
+ */
+bool time_service_is_valid(void);
+
+/**
+ * @brief Expected error of the clock in ms, from the time since the last sync
+ * and the drift uncertainty; INT32_MAX if it never synced.
+ */
+int32_t time_service_expected_error_ms(void);
+
+/**
+ * @brief Starts SNTP in the background if the clock needs a sync, else does
+ * nothing. Call once the network is up. Returns at once.
+ *
+ * @return esp_err_t ESP_OK if a sync was started or none is needed.
+ */
+esp_err_t time_service_start_sync(void);
+
+/**
+ * @brief Waits until the clock is valid (see time_service_is_valid).
+ *
+ * @return esp_err_t ESP_OK if valid, ESP_ERR_TIMEOUT otherwise.
+ */
+esp_err_t time_service_wait_valid(TickType_t timeout_ticks);
+
+/**
+ * @brief Converts a wall-clock duration to RTC timer time with the measured
+ * drift, for esp_sleep_enable_timer_wakeup(), so a long sleep ends on time.
+ */
+uint64_t time_service_rtc_us(uint64_t duration_us);
+
+/**
+ * @brief Gives a running sync up to timeout_ticks to finish, then stops SNTP.
+ * Call before Wi-Fi goes down or the chip sleeps.
+ */
+void time_service_stop(TickType_t timeout_ticks);
+
+#endif // TIME_SERVICE_H
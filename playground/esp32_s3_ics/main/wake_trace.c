@@ -0,0 +1,207 @@
+#include "wake_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_app_desc.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+
+#define WAKE_TRACE_MAGIC 0x57544b31 // "WTK1"; change with the record layout
+#define WAKE_TRACE_DUMP_PER_LINE 8  // Events per dump line
+
+static const char *TAG = "WAKE_TRACE";
+
+// --- Ring in RTC Slow Memory ---
+typedef struct {
+    uint32_t t_us;              // esp_timer time of this wake cycle
+    uint32_t arg;
+    uint16_t cycle;
+    uint8_t stage;              // wake_trace_stage_t
+    uint8_t phase;              // 'B' begin, 'E' end, 'I' instant, 'T' total (t_us first start, arg summed us)
+} wake_trace_event_t;
+
+_Static_assert(sizeof(wake_trace_event_t) == 12, "wake_trace_decode.py reads 12-byte records");
+
+typedef struct {
+    uint32_t magic;
+    uint32_t build;             // Start of the app ELF SHA-256: another firmware starts over
+    uint32_t head;              // Events written so far; the oldest kept is head - WAKE_TRACE_CAPACITY
+    uint16_t cycle;             // Current wake cycle
+    uint16_t reserved;
+    wake_trace_event_t events[WAKE_TRACE_CAPACITY];
+} wake_trace_ring_t;
+
+// Not initialized on any reset, so it also survives a software reset or panic
+static RTC_NOINIT_ATTR wake_trace_ring_t s_ring;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_ready = false;
+
+// Totals of wake_trace_add(), kept in RAM until wake_trace_flush()
+static uint32_t s_total_us[WAKE_TRACE_STAGE_COUNT];
+static uint32_t s_total_first_us[WAKE_TRACE_STAGE_COUNT];
+
+// --- Recording ---
+static void wake_trace_record(wake_trace_stage_t stage, char phase, uint32_t t_us, uint32_t arg) {
+    if (!s_ready || stage >= WAKE_TRACE_STAGE_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    wake_trace_event_t* e = &s_ring.events[s_ring.head % WAKE_TRACE_CAPACITY];
+    e->t_us = t_us;
+    e->arg = arg;
+    e->cycle = s_ring.cycle;
+    e->stage = stage;
+    e->phase = phase;
+    s_ring.head++;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+static uint32_t wake_trace_build_id(void) {
+    char sha[9];
+    esp_app_get_elf_sha256(sha, sizeof(sha));
+    return (uint32_t)strtoul(sha, NULL, 16);
+}
+
+// --- Public Functions ---
+
+void wake_trace_init(void) {
+    uint32_t now_us = (uint32_t)esp_timer_get_time();
+    uint32_t build = wake_trace_build_id();
+    esp_reset_reason_t reason = esp_reset_reason();
+
+    // Power-on leaves RTC memory undefined; after a firmware update the layout may differ
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT ||
+        s_ring.magic != WAKE_TRACE_MAGIC || s_ring.build != build) {
+        memset(&s_ring, 0, sizeof(s_ring));
+        s_ring.magic = WAKE_TRACE_MAGIC;
+        s_ring.build = build;
+    } else {
+        s_ring.cycle++;
+    }
+    memset(s_total_us, 0, sizeof(s_total_us));
+    s_ready = true;
+
+    wake_trace_record(WAKE_TRACE_BOOT, 'B', 0, reason);
+    wake_trace_record(WAKE_TRACE_BOOT, 'E', now_us, 0);
+    ESP_LOGI(TAG, "Wake cycle %u, %lu events kept", s_ring.cycle,
+             (unsigned long)(s_ring.head < WAKE_TRACE_CAPACITY ? s_ring.head : WAKE_TRACE_CAPACITY));
+}
+
+void wake_trace_begin(wake_trace_stage_t stage) {
+    wake_trace_record(stage, 'B', (uint32_t)esp_timer_get_time(), 0);
+}
+
+void wake_trace_end(wake_trace_stage_t stage, uint32_t arg) {
+    wake_trace_record(stage, 'E', (uint32_t)esp_timer_get_time(), arg);
+}
+
+void wake_trace_instant(wake_trace_stage_t stage, uint32_t arg) {
+    wake_trace_record(stage, 'I', (uint32_t)esp_timer_get_time(), arg);
+}
+
+void wake_trace_add(wake_trace_stage_t stage, int64_t start_us) {
+    if (stage >= WAKE_TRACE_STAGE_COUNT) {
+        return;
+    }
+    uint32_t took_us = (uint32_t)(esp_timer_get_time() - start_us);
+    portENTER_CRITICAL(&s_lock);
+    if (s_total_us[stage] == 0) {
+        s_total_first_us[stage] = (uint32_t)start_us;
+    }
+    s_total_us[stage] += took_us ? took_us : 1; // Nonzero marks the stage as seen
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void wake_trace_flush(void) {
+    for (int i = 0; i < WAKE_TRACE_STAGE_COUNT; i++) {
+        if (s_total_us[i]) {
+            wake_trace_record(i, 'T', s_total_first_us[i], s_total_us[i]);
+            s_total_us[i] = 0;
+        }
+    }
+}
+
+void wake_trace_dump(void) {
+    // Copied first: printing takes long enough for events to arrive
+    static wake_trace_ring_t copy;
+    portENTER_CRITICAL(&s_lock);
+    copy = s_ring;
+    portEXIT_CRITICAL(&s_lock);
+
+    uint32_t count = copy.head < WAKE_TRACE_CAPACITY ? copy.head : WAKE_TRACE_CAPACITY;
+    const esp_app_desc_t* app = esp_app_get_description();
+    printf("wake_trace begin build=%08lx version=%s count=%lu cycle=%u\n",
+           (unsigned long)copy.build, app->version, (unsigned long)count, copy.cycle);
+    for (uint32_t i = 0; i < count; i += WAKE_TRACE_DUMP_PER_LINE) {
+        printf("wt");
+        for (uint32_t j = i; j < count && j < i + WAKE_TRACE_DUMP_PER_LINE; j++) {
+            const uint8_t* b = (const uint8_t*)&copy.events[(copy.head - count + j) % WAKE_TRACE_CAPACITY];
+            printf(" ");
+            for (int k = 0; k < sizeof(wake_trace_event_t); k++) {
+                printf("%02x", b[k]);
+            }
+        }
+        printf("\n");
+    }
+    printf("wake_trace end\n");
+}
+
+void wake_trace_clear(void) {
+    portENTER_CRITICAL(&s_lock);
+    s_ring.head = 0;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+// --- Console Command ---
+static int wake_trace_cmd(int argc, char** argv) {
+    if (argc == 2 && strcmp(argv[1], "dump") == 0) {
+        wake_trace_dump();
+        return 0;
+    }
+    if (argc == 2 && strcmp(argv[1], "clear") == 0) {
+        wake_trace_clear();
+        printf("Trace cleared.\n");
+        return 0;
+    }
+    printf("Usage: trace dump|clear\n");
+    return 1;
+}
+
+esp_err_t wake_trace_console_start(void) {
+    esp_console_repl_t* repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "ics>";
+    esp_err_t err;
+#if defined(CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG)
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    err = esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl);
+#elif defined(CONFIG_ESP_CONSOLE_USB_CDC)
+    esp_console_dev_usb_cdc_config_t hw_config = ESP_CONSOLE_DEV_CDC_CONFIG_DEFAULT();
+    err = esp_console_new_repl_usb_cdc(&hw_config, &repl_config, &repl);
+#else
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    err = esp_console_new_repl_uart(&hw_config, &repl_config, &repl);
+#endif
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Console REPL not started (%s)", esp_err_to_name(err));
+        return err;
+    }
+
+    const esp_console_cmd_t cmd = {
+        .command = "trace",
+        .help = "Wake cycle trace: 'trace dump' prints it for wake_trace_decode.py, 'trace clear' empties it",
+        .hint = "dump|clear",
+        .func = &wake_trace_cmd,
+    };
+    err = esp_console_cmd_register(&cmd);
+    if (err == ESP_OK) {
+        err = esp_console_start_repl(repl);
+    }
+    return err;
+}
@@ -0,0 +1,91 @@
+#ifndef WAKE_TRACE_H
+#define WAKE_TRACE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// Where the time of each wake cycle goes. Events are 12-byte binary records in
+// a ring in RTC slow memory (RTC_NOINIT), so the history survives deep sleep
+// and software resets; a power-on or a new firmware starts it over.
+//
+// `trace dump` on the console prints the ring; wake_trace_decode.py turns the
+// log into Chrome trace JSON (chrome://tracing, ui.perfetto.dev), one process
+// per wake cycle, plus a per-stage time and charge summary.
+
+#define WAKE_TRACE_CAPACITY 256 // Events kept: 3 KB of the 8 KB RTC slow memory
+
+// Stage ids are part of the dump format: append only, and keep the names in
+// wake_trace_decode.py in step
+typedef enum {
+    WAKE_TRACE_BOOT,            // Reset to wake_trace_init() (ROM, bootloader, startup)
+    WAKE_TRACE_NVS_INIT,
+    WAKE_TRACE_WIFI_ASSOC,      // esp_wifi_start() to associated; instants mark failed attempts
+    WAKE_TRACE_DHCP,            // Associated to IP
+    WAKE_TRACE_SNTP,            // End arg: 1 synced, 0 gave up; instant: skipped, arg expected error in ms
+    WAKE_TRACE_DNS,             // End arg: 0 or the getaddrinfo error
+    WAKE_TRACE_TLS,             // TCP connect and TLS handshake
+    WAKE_TRACE_DOWNLOAD,        // Connected to body received; end arg: bytes
+    WAKE_TRACE_PARSE,           // Usually a total of many pieces (wake_trace_add)
+    WAKE_TRACE_LVGL_RENDER,
+    WAKE_TRACE_SPI_UPLOAD,
+    WAKE_TRACE_PANEL_REFRESH,
+    WAKE_TRACE_SLEEP,           // Instant before deep sleep; arg: planned sleep in seconds
+    WAKE_TRACE_STAGE_COUNT,
+} wake_trace_stage_t;
+
+/**
+ * @brief Starts a new wake cycle: checks the ring kept in RTC memory and
+ * records the boot span. Call first thing in app_main.
+ */
+void wake_trace_init(void);
+
+/**
+ * @brief Records the start of a stage.
+ */
+void wake_trace_begin(wake_trace_stage_t stage);
+
+/**
+ * @brief Records the end of a stage.
+ *
+ * @param arg Stage result, e.g. bytes or an error code (see wake_trace_stage_t).
+ */
+void wake_trace_end(wake_trace_stage_t stage, uint32_t arg);
+
+/**
+ * @brief Records a point event, e.g. a retry.
+ */
+void wake_trace_instant(wake_trace_stage_t stage, uint32_t arg);
+
+/**
+ * @brief Adds the time of one piece of a stage that runs in many short pieces
+ * (parsing each received chunk). The pieces are kept in RAM and written as one
+ * total by wake_trace_flush(), instead of two events per piece.
+ *
+ * @param start_us esp_timer_get_time() at the start of the piece.
+ */
+void wake_trace_add(wake_trace_stage_t stage, int64_t start_us);
+
+/**
+ * @brief Writes the totals of wake_trace_add(). Call at the end of the cycle,
+ * before deep sleep.
+ */
+void wake_trace_flush(void);
+
+/**
+ * @brief Prints the ring to stdout as hex lines for wake_trace_decode.py.
+ */
+void wake_trace_dump(void);
+
+/**
+ * @brief Empties the ring.
+ */
+void wake_trace_clear(void);
+
+/**
+ * @brief Starts a console REPL with the `trace dump` and `trace clear` commands.
+ *
+ * @return esp_err_t ESP_OK on success, error code from esp_console otherwise.
+ */
+esp_err_t wake_trace_console_start(void);
+
+#endif // WAKE_TRACE_H
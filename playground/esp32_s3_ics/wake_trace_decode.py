@@ -0,0 +1,263 @@
+"""把 `trace dump` 的輸出 (main/wake_trace.c) 轉成 Chrome trace JSON
+
+每個喚醒週期是一個 process，每個階段一條 track；在 chrome://tracing 或
+ui.perfetto.dev 開啟。另外印出各階段的平均時間與估計電量，
+給 --baseline 另一次 dump 時列出差異，用來比較不同韌體版本。
+
+電量是以各階段的平均電流估計：同一時間有數個階段時取電流最大的那個，
+沒有階段時以 awake 計。預設電流是 S3 模組的粗估值，請換成板子上量到的
+(--current wifi_assoc=120)。
+
+  python3 wake_trace_decode.py monitor.log -o trace.json
+  python3 wake_trace_decode.py new.log --baseline old.log
+  python3 wake_trace_decode.py --self-test
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+EVENT = struct.Struct('<IIHBB')  # t_us, arg, cycle, stage, phase
+
+# 與 wake_trace_stage_t 同順序
+STAGES = [
+    'boot', 'nvs_init', 'wifi_assoc', 'dhcp', 'sntp', 'dns', 'tls',
+    'download', 'parse', 'lvgl_render', 'spi_upload', 'panel_refresh', 'sleep',
+]
+
+# 平均電流 (mA)
+DEFAULT_CURRENT_MA = {
+    'awake': 40,
+    'boot': 40,
+    'nvs_init': 40,
+    'wifi_assoc': 110,
+    'dhcp': 90,
+    'sntp': 90,
+    'dns': 90,
+    'tls': 100,
+    'download': 90,
+    'parse': 45,
+    'lvgl_render': 45,
+    'spi_upload': 45,
+    'panel_refresh': 35,
+    'sleep': 0,
+}
+
+BEGIN_RE = re.compile(r'wake_trace begin build=([0-9a-f]+) version=(\S*) count=(\d+)')
+LINE_RE = re.compile(r'\bwt((?: [0-9a-f]{%d})+)\s*$' % (EVENT.size * 2))
+
+
+def stage_name(stage):
+    return STAGES[stage] if stage < len(STAGES) else 'stage%d' % stage
+
+
+def parse_dump(text):
+    """回傳 (資訊, [(t_us, arg, cycle, stage, phase)])，取 log 裡最後一份 dump"""
+    info, events, current = None, [], None
+    for line in text.splitlines():
+        m = BEGIN_RE.search(line)
+        if m:
+            current = []
+            info = {'build': m.group(1), 'version': m.group(2), 'count': int(m.group(3))}
+            continue
+        if current is None:
+            continue
+        if 'wake_trace end' in line:
+            events, current = current, None
+            continue
+        m = LINE_RE.search(line)
+        if m:
+            for word in m.group(1).split():
+                t_us, arg, cycle, stage, phase = EVENT.unpack(bytes.fromhex(word))
+                current.append((t_us, arg, cycle, stage, chr(phase)))
+    if info is None:
+        raise ValueError('no complete wake_trace dump in the input')
+    if len(events) != info['count']:
+        print('warning: %d of %d events read' % (len(events), info['count']), file=sys.stderr)
+    return info, events
+
+
+def cycle_spans(events):
+    """回傳 {cycle: {'spans': [(stage, start, end, arg)], 'instants': [...], 'end': us}}
+
+    週期最早的事件若因 ring 覆蓋而遺失，那個週期就不完整，捨棄。
+    沒有結束的階段以週期最後的事件時間結束。
+    """
+    cycles = {}
+    order = []
+    for t_us, arg, cycle, stage, phase in events:
+        if cycle not in cycles:
+            cycles[cycle] = {'spans': [], 'instants': [], 'open': {}, 'end': 0, 'complete': False}
+            order.append(cycle)
+        c = cycles[cycle]
+        c['end'] = max(c['end'], t_us)
+        if phase == 'B':
+            if stage == 0:
+                c['complete'] = True  # 從開機記錄起
+            c['open'][stage] = t_us
+        elif phase == 'E' and stage in c['open']:
+            c['spans'].append((stage, c['open'].pop(stage), t_us, arg))
+        elif phase == 'T':
+            c['spans'].append((stage, t_us, t_us + arg, arg))
+            c['end'] = max(c['end'], t_us + arg)
+        elif phase == 'I':
+            c['instants'].append((stage, t_us, arg))
+    result = {}
+    for cycle in order:
+        c = cycles[cycle]
+        if not c['complete']:
+            continue
+        for stage, start in c['open'].items():
+            c['spans'].append((stage, start, c['end'], None))
+        c['spans'].sort(key=lambda s: s[1])
+        result[cycle] = c
+    return result
+
+
+def charge_by_stage(cycle, current_ma):
+    """各階段的時間 (us) 與電量 (uAh)；重疊時歸給電流最大的階段"""
+    spans = cycle['spans']
+    points = sorted({0, cycle['end']} | {s[1] for s in spans} | {s[2] for s in spans})
+    time_us, charge = {}, {}
+    for a, b in zip(points, points[1:]):
+        active = [stage_name(s[0]) for s in spans if s[1] <= a and s[2] >= b and s[2] > s[1]]
+        name = max(active, key=lambda n: current_ma.get(n, 0)) if active else 'awake'
+        time_us[name] = time_us.get(name, 0) + (b - a)
+        charge[name] = charge.get(name, 0.0) + current_ma.get(name, 0) * (b - a) / 3.6e6
+    return time_us, charge
+
+
+def to_chrome_trace(info, cycles):
+    trace = []
+    for cycle, c in cycles.items():
+        trace.append({'ph': 'M', 'name': 'process_name', 'pid': cycle, 'tid': 0,
+                      'args': {'name': 'wake cycle %d' % cycle}})
+        stages = sorted({s[0] for s in c['spans']} | {i[0] for i in c['instants']})
+        for stage in stages:
+            trace.append({'ph': 'M', 'name': 'thread_name', 'pid': cycle, 'tid': stage,
+                          'args': {'name': stage_name(stage)}})
+        for stage, start, end, arg in c['spans']:
+            event = {'ph': 'X', 'name': stage_name(stage), 'pid': cycle, 'tid': stage,
+                     'ts': start, 'dur': end - start}
+            if arg is not None:
+                event['args'] = {'arg': arg}
+            trace.append(event)
+        for stage, t_us, arg in c['instants']:
+            trace.append({'ph': 'i', 's': 't', 'name': stage_name(stage), 'pid': cycle,
+                          'tid': stage, 'ts': t_us, 'args': {'arg': arg}})
+    return {'traceEvents': trace, 'displayTimeUnit': 'ms',
+            'otherData': {'build': info['build'], 'version': info['version']}}
+
+
+def summarize(cycles, current_ma):
+    """回傳 {名稱: (平均 ms, 平均 uAh)}，含 'total'"""
+    sums = {}
+    for c in cycles.values():
+        time_us, charge = charge_by_stage(c, current_ma)
+        time_us['total'] = c['end']
+        charge['total'] = sum(charge.values())
+        for name in time_us:
+            t, q = sums.get(name, (0, 0.0))
+            sums[name] = (t + time_us[name], q + charge.get(name, 0.0))
+    n = max(len(cycles), 1)
+    return {name: (t / 1000 / n, q / n) for name, (t, q) in sums.items()}
+
+
+def print_summary(info, cycles, summary, baseline=None):
+    print('build %s, version %s, %d complete cycles' % (info['build'], info['version'], len(cycles)))
+    names = [n for n in ['awake'] + STAGES if n in summary] + ['total']
+    header = '%-14s %10s %10s' % ('stage', 'avg ms', 'avg uAh')
+    if baseline:
+        header += ' %10s %10s' % ('d ms', 'd uAh')
+    print(header)
+    for name in names:
+        ms, uah = summary.get(name, (0, 0))
+        line = '%-14s %10.1f %10.2f' % (name, ms, uah)
+        if baseline:
+            bms, buah = baseline.get(name, (0, 0))
+            line += ' %+10.1f %+10.2f' % (ms - bms, uah - buah)
+        print(line)
+
+
+def parse_currents(values):
+    current = dict(DEFAULT_CURRENT_MA)
+    for value in values:
+        name, _, ma = value.partition('=')
+        if name not in current:
+            raise SystemExit('unknown stage %r (known: %s)' % (name, ', '.join(current)))
+        current[name] = float(ma)
+    return current
+
+
+def self_test():
+    def ev(t, arg, cycle, stage, phase):
+        return EVENT.pack(t, arg, cycle, stage, ord(phase)).hex()
+
+    words = [
+        ev(900, 5, 6, 2, 'E'),        # 週期 6 前段已被覆蓋
+        ev(0, 1, 7, 0, 'B'), ev(300000, 0, 7, 0, 'E'),
+        ev(310000, 0, 7, 2, 'B'), ev(800000, 0, 7, 2, 'E'),
+        ev(800000, 0, 7, 3, 'B'), ev(1000000, 0, 7, 3, 'E'),
+        ev(1000000, 0, 7, 7, 'B'), ev(1100000, 200000, 7, 8, 'T'),
+        ev(1400000, 4096, 7, 7, 'E'), ev(1500000, 900, 7, 12, 'I'),
+    ]
+    log = ['I (12) ICS_DEMO: noise', 'wake_trace begin build=0badf00d version=v1 count=%d cycle=7' % len(words)]
+    log += ['wt ' + ' '.join(words[i:i + 8]) for i in range(0, len(words), 8)]
+    log.append('wake_trace end')
+    info, events = parse_dump('\n'.join(log))
+    assert info['build'] == '0badf00d' and len(events) == len(words)
+
+    cycles = cycle_spans(events)
+    assert list(cycles) == [7], cycles
+    spans = {stage_name(s[0]): s for s in cycles[7]['spans']}
+    assert spans['download'][3] == 4096 and spans['parse'][1:3] == (1100000, 1300000)
+
+    # 下載中的解析算在電流較大的下載；階段之間的空檔算 awake
+    time_us, charge = charge_by_stage(cycles[7], DEFAULT_CURRENT_MA)
+    assert sum(time_us.values()) == cycles[7]['end'] == 1500000
+    assert time_us['download'] == 400000 and 'parse' not in time_us, time_us
+    assert time_us['awake'] == 110000, time_us
+    assert abs(charge['wifi_assoc'] - 110 * 490000 / 3.6e6) < 1e-9
+
+    trace = to_chrome_trace(info, cycles)
+    json.dumps(trace)
+    assert any(e['ph'] == 'i' and e['name'] == 'sleep' for e in trace['traceEvents'])
+    print('self-test passed')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('log', nargs='?', help='含 `trace dump` 輸出的 monitor log')
+    parser.add_argument('-o', '--output', help='Chrome trace JSON 輸出檔')
+    parser.add_argument('--baseline', help='比較用的另一份 log (例如舊韌體)')
+    parser.add_argument('--current', action='append', default=[], metavar='STAGE=MA',
+                        help='覆寫某階段的平均電流')
+    parser.add_argument('--self-test', action='store_true')
+    args = parser.parse_args()
+
+    if args.self_test:
+        self_test()
+        return
+    if not args.log:
+        parser.error('log is required')
+
+    current = parse_currents(args.current)
+    with open(args.log, 'r', encoding='utf-8', errors='replace') as f:
+        info, events = parse_dump(f.read())
+    cycles = cycle_spans(events)
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(to_chrome_trace(info, cycles), f)
+
+    baseline = None
+    if args.baseline:
+        with open(args.baseline, 'r', encoding='utf-8', errors='replace') as f:
+            _, base_events = parse_dump(f.read())
+        baseline = summarize(cycle_spans(base_events), current)
+    print_summary(info, cycles, summarize(cycles, current), baseline)
+
+
+if __name__ == '__main__':
+    main()
@@ -76,10 +76,10 @@ void epd_spi_init()
         .sclk_io_num = PIN_NUM_CLK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = 800 * 480 / 8,
+        .max_transfer_sz = EPD_SPI_MAX_TRANSFER,
     };
     spi_device_interface_config_t devcfg = {
-        .clock_speed_hz = 2* 1000 * 1000,     //Clock out at 10 MHz
+        .clock_speed_hz = EPD_SPI_CLOCK_HZ,     //Clock out at 2 MHz
         .mode = 0,                              //SPI mode 0
         .spics_io_num = PIN_NUM_CS,             //CS pin
         .queue_size = 7,                        //We want to be able to queue 7 transactions at a time
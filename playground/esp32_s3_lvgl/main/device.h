@@ -1,10 +1,17 @@
 #ifndef _DEVICE_H_
 #define _DEVICE_H_
 
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 #define EPD_HOST    SPI2_HOST
+#endif
 
 #define PIN_NUM_MOSI 11
 #define PIN_NUM_CLK  12
@@ -14,13 +21,40 @@
 #define PIN_NUM_BUSY 7
 #define PIN_NUM_PWR  3
 
+#define EPD_SPI_CLOCK_HZ (2 * 1000 * 1000)
+#define EPD_SPI_MAX_TRANSFER (800 * 480 / 8)
+
+#ifdef ESP_PLATFORM
+static inline void device_delay_ms(uint32_t ms)
+{
+    // Rounds up to whole ticks and always blocks for at least one, so the
+    // BUSY poll sleeps (and lets the chip light sleep) instead of spinning
+    // or degrading to a bare yield at the 100 Hz tick
+    TickType_t ticks = (ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
 #define GPIO_SET_LEVEL(_pin, _value) gpio_set_level(_pin, _value)
 #define GPIO_GET_LEVEL(_pin) gpio_get_level(_pin)
-#define DELAY_MS(__xms) vTaskDelay(__xms / portTICK_PERIOD_MS)
+#define DELAY_MS(__xms) device_delay_ms(__xms)
+#define TIME_US() esp_timer_get_time()
+#else
+// Host build: playground/epd_host_sim/device_host.c records the traffic,
+// simulates the controller and advances a virtual clock instead of sleeping.
+void host_gpio_set_level(int pin, int value);
+int host_gpio_get_level(int pin);
+void host_delay_ms(uint32_t ms);
+int64_t host_time_us(void);
+
+#define GPIO_SET_LEVEL(_pin, _value) host_gpio_set_level(_pin, _value)
+#define GPIO_GET_LEVEL(_pin) host_gpio_get_level(_pin)
+#define DELAY_MS(__xms) host_delay_ms(__xms)
+#define TIME_US() host_time_us()
+#endif
 
 void epd_cmd(const uint8_t cmd);
 void epd_data(const uint8_t data);
 void epd_data2(const uint8_t *data, int len);
 void device_init(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,25 +1,69 @@
 #include "epd_7in5_v2.h"
 #include "device.h"
 #include "esp_log.h"
+#include <string.h>
 
 static const char *TAG = "epd_7in5_v2";
 
+static const epd_7in5_v2_timing_t timing_profiles[EPD_7IN5_V2_TIMING_COUNT] = {
+    [EPD_7IN5_V2_TIMING_LEGACY] = {
+        .name = "legacy",
+        .power_settle_ms = 100,
+        .reset_high_ms = 200, .reset_low_ms = 200, .reset_release_ms = 200,
+        .power_on_settle_ms = 100, .refresh_settle_ms = 100,
+        .busy_poll_ms = 5, .busy_release_ms = 20,
+    },
+    // Reset pulse and settle times of the Waveshare EPD_7in5_V2 driver
+    [EPD_7IN5_V2_TIMING_WAVESHARE] = {
+        .name = "waveshare",
+        .power_settle_ms = 20,
+        .reset_high_ms = 20, .reset_low_ms = 2, .reset_release_ms = 20,
+        .power_on_settle_ms = 100, .refresh_settle_ms = 100,
+        .busy_poll_ms = 5, .busy_release_ms = 5,
+    },
+    // Waveshare reset timing, but rely on BUSY instead of fixed waits after
+    // POWER ON and DISPLAY REFRESH (the controller needs >= 200 us there)
+    [EPD_7IN5_V2_TIMING_FAST] = {
+        .name = "fast",
+        .power_settle_ms = 10,
+        .reset_high_ms = 20, .reset_low_ms = 2, .reset_release_ms = 20,
+        .power_on_settle_ms = 1, .refresh_settle_ms = 1,
+        .busy_poll_ms = 10, .busy_release_ms = 1,
+    },
+};
+
+static const char *const phase_names[EPD_7IN5_V2_PHASE_COUNT] = {
+    "power", "reset", "init", "upload", "refresh",
+};
+
+static const epd_7in5_v2_timing_t *s_timing = &timing_profiles[EPD_7IN5_V2_TIMING_WAVESHARE];
+static epd_7in5_v2_latency_t s_latency;
+
+static void phase_add(epd_7in5_v2_phase_t phase, int64_t start_us)
+{
+    s_latency.phase_us[phase] += TIME_US() - start_us;
+}
+
 static void epd_power_on(void)
 {
+    int64_t t = TIME_US();
     ESP_LOGI(TAG, "e-Paper power on");
     GPIO_SET_LEVEL(PIN_NUM_PWR, 1);
-    DELAY_MS(100);
+    DELAY_MS(s_timing->power_settle_ms);
+    phase_add(EPD_7IN5_V2_PHASE_POWER, t);
 }
 
 static void epd_reset(void)
 {
+    int64_t t = TIME_US();
     ESP_LOGI(TAG, "e-Paper reset");
     GPIO_SET_LEVEL(PIN_NUM_N_RST, 1);
-    DELAY_MS(200);
+    DELAY_MS(s_timing->reset_high_ms);
     GPIO_SET_LEVEL(PIN_NUM_N_RST, 0);
-    DELAY_MS(200);
+    DELAY_MS(s_timing->reset_low_ms);
     GPIO_SET_LEVEL(PIN_NUM_N_RST, 1);
-    DELAY_MS(200);
+    DELAY_MS(s_timing->reset_release_ms);
+    phase_add(EPD_7IN5_V2_PHASE_RESET, t);
 }
 
 static void epd_wait_until_idle(void)
@@ -27,25 +71,57 @@ static void epd_wait_until_idle(void)
     ESP_LOGI(TAG, "e-Paper busy");
     do{
         epd_cmd(0x71);
-        DELAY_MS(5);
+        DELAY_MS(s_timing->busy_poll_ms);
     } while (GPIO_GET_LEVEL(PIN_NUM_BUSY) == 0);
-    DELAY_MS(20);
+    DELAY_MS(s_timing->busy_release_ms);
     ESP_LOGI(TAG, "e-Paper busy release");
 }
 
 static void epd_7in5_v2_trun_on_display(void)
 {
+    int64_t t = TIME_US();
     ESP_LOGI(TAG, "e-Paper turn on display");
     epd_cmd(0x12);
-    DELAY_MS(100);
+    DELAY_MS(s_timing->refresh_settle_ms);
     epd_wait_until_idle();
+    phase_add(EPD_7IN5_V2_PHASE_REFRESH, t);
+    if (s_latency.first_image_us == 0) {
+        s_latency.first_image_us = TIME_US();
+    }
 }
 
-void epd_7in5_v2_init(void)
-{
-    epd_power_on();
-    epd_reset();
+// Input byte (four 2bpp pixels) -> high nibble: bits for the old-data plane (0x10),
+// low nibble: bits for the new-data plane (0x13). Pixel 3 (white) maps to 0/0,
+// 0 (black) to 1/1, 2 (gray1) to 1/0 and 1 (gray2) to 0/1, as in the Waveshare driver.
+static const uint8_t gray4_plane_lut[256] = {
+    0xFF, 0xEF, 0xFE, 0xEE, 0xDF, 0xCF, 0xDE, 0xCE, 0xFD, 0xED, 0xFC, 0xEC, 0xDD, 0xCD, 0xDC, 0xCC,
+    0xBF, 0xAF, 0xBE, 0xAE, 0x9F, 0x8F, 0x9E, 0x8E, 0xBD, 0xAD, 0xBC, 0xAC, 0x9D, 0x8D, 0x9C, 0x8C,
+    0xFB, 0xEB, 0xFA, 0xEA, 0xDB, 0xCB, 0xDA, 0xCA, 0xF9, 0xE9, 0xF8, 0xE8, 0xD9, 0xC9, 0xD8, 0xC8,
+    0xBB, 0xAB, 0xBA, 0xAA, 0x9B, 0x8B, 0x9A, 0x8A, 0xB9, 0xA9, 0xB8, 0xA8, 0x99, 0x89, 0x98, 0x88,
+    0x7F, 0x6F, 0x7E, 0x6E, 0x5F, 0x4F, 0x5E, 0x4E, 0x7D, 0x6D, 0x7C, 0x6C, 0x5D, 0x4D, 0x5C, 0x4C,
+    0x3F, 0x2F, 0x3E, 0x2E, 0x1F, 0x0F, 0x1E, 0x0E, 0x3D, 0x2D, 0x3C, 0x2C, 0x1D, 0x0D, 0x1C, 0x0C,
+    0x7B, 0x6B, 0x7A, 0x6A, 0x5B, 0x4B, 0x5A, 0x4A, 0x79, 0x69, 0x78, 0x68, 0x59, 0x49, 0x58, 0x48,
+    0x3B, 0x2B, 0x3A, 0x2A, 0x1B, 0x0B, 0x1A, 0x0A, 0x39, 0x29, 0x38, 0x28, 0x19, 0x09, 0x18, 0x08,
+    0xF7, 0xE7, 0xF6, 0xE6, 0xD7, 0xC7, 0xD6, 0xC6, 0xF5, 0xE5, 0xF4, 0xE4, 0xD5, 0xC5, 0xD4, 0xC4,
+    0xB7, 0xA7, 0xB6, 0xA6, 0x97, 0x87, 0x96, 0x86, 0xB5, 0xA5, 0xB4, 0xA4, 0x95, 0x85, 0x94, 0x84,
+    0xF3, 0xE3, 0xF2, 0xE2, 0xD3, 0xC3, 0xD2, 0xC2, 0xF1, 0xE1, 0xF0, 0xE0, 0xD1, 0xC1, 0xD0, 0xC0,
+    0xB3, 0xA3, 0xB2, 0xA2, 0x93, 0x83, 0x92, 0x82, 0xB1, 0xA1, 0xB0, 0xA0, 0x91, 0x81, 0x90, 0x80,
+    0x77, 0x67, 0x76, 0x66, 0x57, 0x47, 0x56, 0x46, 0x75, 0x65, 0x74, 0x64, 0x55, 0x45, 0x54, 0x44,
+    0x37, 0x27, 0x36, 0x26, 0x17, 0x07, 0x16, 0x06, 0x35, 0x25, 0x34, 0x24, 0x15, 0x05, 0x14, 0x04,
+    0x73, 0x63, 0x72, 0x62, 0x53, 0x43, 0x52, 0x42, 0x71, 0x61, 0x70, 0x60, 0x51, 0x41, 0x50, 0x40,
+    0x33, 0x23, 0x32, 0x22, 0x13, 0x03, 0x12, 0x02, 0x31, 0x21, 0x30, 0x20, 0x11, 0x01, 0x10, 0x00,
+};
+
+// Rows converted per SPI transaction when a plane has to be transformed
+// (4-gray split, view inversion)
+#define CHUNK_ROWS 16
+
+static uint8_t s_chunk[CHUNK_ROWS * EPD_7IN5_V2_WIDTH / 8];
+
+static epd_7in5_v2_mode_t s_mode = EPD_7IN5_V2_MODE_FULL;
 
+static void epd_init_full(void)
+{
     epd_cmd(0x06);
     epd_data(0x17);
     epd_data(0x17);
@@ -59,7 +135,7 @@ void epd_7in5_v2_init(void)
     epd_data(0x3F);
 
     epd_cmd(0x04);
-    DELAY_MS(100);
+    DELAY_MS(s_timing->power_on_settle_ms);
     epd_wait_until_idle();
 
     epd_cmd(0x00);
@@ -82,8 +158,149 @@ void epd_7in5_v2_init(void)
     epd_data(0x22);
 }
 
+static void epd_init_fast(void)
+{
+    epd_cmd(0x00);
+    epd_data(0x1F);
+
+    epd_cmd(0x50);
+    epd_data(0x10);
+    epd_data(0x07);
+
+    epd_cmd(0x04);
+    DELAY_MS(s_timing->power_on_settle_ms);
+    epd_wait_until_idle();
+
+    epd_cmd(0x06);
+    epd_data(0x27);
+    epd_data(0x27);
+    epd_data(0x18);
+    epd_data(0x17);
+
+    // Load the fast waveform for the 0x5A temperature slot
+    epd_cmd(0xE0);
+    epd_data(0x02);
+    epd_cmd(0xE5);
+    epd_data(0x5A);
+}
+
+static void epd_init_part(void)
+{
+    epd_cmd(0x00);
+    epd_data(0x1F);
+
+    epd_cmd(0x04);
+    DELAY_MS(s_timing->power_on_settle_ms);
+    epd_wait_until_idle();
+
+    epd_cmd(0xE0);
+    epd_data(0x02);
+    epd_cmd(0xE5);
+    epd_data(0x6E);
+}
+
+static void epd_init_4gray(void)
+{
+    epd_cmd(0x00);
+    epd_data(0x1F);
+
+    epd_cmd(0x50);
+    epd_data(0x10);
+    epd_data(0x07);
+
+    epd_cmd(0x04);
+    DELAY_MS(s_timing->power_on_settle_ms);
+    epd_wait_until_idle();
+
+    epd_cmd(0x06);
+    epd_data(0x27);
+    epd_data(0x27);
+    epd_data(0x18);
+    epd_data(0x17);
+
+    epd_cmd(0xE0);
+    epd_data(0x02);
+    epd_cmd(0xE5);
+    epd_data(0x5F);
+}
+
+void epd_7in5_v2_init(void)
+{
+    epd_7in5_v2_init_mode(EPD_7IN5_V2_MODE_FULL);
+}
+
+void epd_7in5_v2_init_mode(epd_7in5_v2_mode_t mode)
+{
+    epd_power_on();
+    epd_reset();
+
+    int64_t t = TIME_US();
+    switch (mode) {
+    case EPD_7IN5_V2_MODE_FAST:
+        epd_init_fast();
+        break;
+    case EPD_7IN5_V2_MODE_PART:
+        epd_init_part();
+        break;
+    case EPD_7IN5_V2_MODE_4GRAY:
+        epd_init_4gray();
+        break;
+    case EPD_7IN5_V2_MODE_FULL:
+    default:
+        mode = EPD_7IN5_V2_MODE_FULL;
+        epd_init_full();
+        break;
+    }
+    s_mode = mode;
+    phase_add(EPD_7IN5_V2_PHASE_INIT, t);
+    ESP_LOGI(TAG, "e-Paper init done, mode %d", mode);
+}
+
+void epd_7in5_v2_set_timing(epd_7in5_v2_timing_id_t id)
+{
+    if (id < EPD_7IN5_V2_TIMING_COUNT) {
+        s_timing = &timing_profiles[id];
+        ESP_LOGI(TAG, "e-Paper timing profile: %s", s_timing->name);
+    }
+}
+
+const epd_7in5_v2_timing_t *epd_7in5_v2_get_timing(void)
+{
+    return s_timing;
+}
+
+void epd_7in5_v2_latency_reset(void)
+{
+    memset(&s_latency, 0, sizeof(s_latency));
+}
+
+void epd_7in5_v2_get_latency(epd_7in5_v2_latency_t *latency)
+{
+    *latency = s_latency;
+}
+
+void epd_7in5_v2_latency_report(void)
+{
+    int64_t total = 0;
+    ESP_LOGI(TAG, "e-Paper latency (%s timing):", s_timing->name);
+    for (int i = 0; i < EPD_7IN5_V2_PHASE_COUNT; i++) {
+        ESP_LOGI(TAG, "  %-8s %7lld us", phase_names[i], (long long)s_latency.phase_us[i]);
+        total += s_latency.phase_us[i];
+    }
+    ESP_LOGI(TAG, "  %-8s %7lld us", "total", (long long)total);
+    if (s_latency.first_image_us) {
+        ESP_LOGI(TAG, "  boot to first image: %lld ms", (long long)(s_latency.first_image_us / 1000));
+    }
+}
+
+epd_7in5_v2_mode_t epd_7in5_v2_get_mode(void)
+{
+    return s_mode;
+}
+
 void epd_7in5_v2_clear(void)
 {
+    int64_t t = TIME_US();
     int width = EPD_7IN5_V2_WIDTH / 8;
     uint8_t image[EPD_7IN5_V2_WIDTH / 8] = {0x00};
     epd_cmd(0x10);
@@ -102,26 +319,173 @@ void epd_7in5_v2_clear(void)
         epd_data2(image, width);
     }
 
+    phase_add(EPD_7IN5_V2_PHASE_UPLOAD, t);
     epd_7in5_v2_trun_on_display();
 }
 
-void epd_7in5_v2_display(uint8_t *image)
+void epd_7in5_v2_display(const uint8_t *image)
 {
+    const epd_7in5_v2_view_t view = {
+        .pixels = image,
+        .stride = EPD_7IN5_V2_WIDTH / 8,
+        .x_start = 0, .y_start = 0,
+        .x_end = EPD_7IN5_V2_WIDTH, .y_end = EPD_7IN5_V2_HEIGHT,
+        .black_is_one = false,
+    };
+    epd_7in5_v2_write_view(&view);
+    epd_7in5_v2_trun_on_display();
+}
+
+void epd_7in5_v2_clearblack(void)
+{
+    int64_t t = TIME_US();
     int width = EPD_7IN5_V2_WIDTH / 8;
+    uint8_t image[EPD_7IN5_V2_WIDTH / 8] = {0x00};
     epd_cmd(0x10);
-    for (int j = 0; j < EPD_7IN5_V2_HEIGHT; j++) {
-        epd_data2((uint8_t *)(image + j * width), width);
+    for(int i = 0; i < EPD_7IN5_V2_HEIGHT; i++) {
+        epd_data2(image, width);
     }
 
     epd_cmd(0x13);
-    for (int j = 0; j < EPD_7IN5_V2_HEIGHT; j++) {
-        for (int i = 0; i < width; i++) {
-            image[i + j * width] = ~image[i + j * width];
+    for(int i = 0; i < width; i++) {
+        image[i] = 0xFF;
+    }
+    for(int i = 0; i < EPD_7IN5_V2_HEIGHT; i++) {
+        epd_data2(image, width);
+    }
+
+    phase_add(EPD_7IN5_V2_PHASE_UPLOAD, t);
+    epd_7in5_v2_trun_on_display();
+}
+
+void epd_7in5_v2_display_part(uint8_t *blackimage, uint32_t x_start, uint32_t y_start, uint32_t x_end, uint32_t y_end)
+{
+    int64_t t = TIME_US();
+    // The controller addresses x in whole bytes: round the window out to byte edges
+    x_start = x_start / 8;
+    x_end = (x_end + 7) / 8;
+    uint32_t width = x_end - x_start;
+    uint32_t count = width * (y_end - y_start);
+
+    x_start = x_start * 8;
+    x_end = x_end * 8 - 1;
+    y_end -= 1;
+
+    epd_cmd(0x50);
+    epd_data(0xA9);
+    epd_data(0x07);
+
+    epd_cmd(0x91);      // enter partial mode
+    epd_cmd(0x90);      // partial window
+    epd_data(x_start / 256);
+    epd_data(x_start % 256);
+    epd_data(x_end / 256);
+    epd_data(x_end % 256);
+    epd_data(y_start / 256);
+    epd_data(y_start % 256);
+    epd_data(y_end / 256);
+    epd_data(y_end % 256);
+    epd_data(0x01);
+
+    epd_cmd(0x13);
+    epd_data2(blackimage, count);
+    phase_add(EPD_7IN5_V2_PHASE_UPLOAD, t);
+    epd_7in5_v2_trun_on_display();
+}
+
+static void epd_send_4gray_plane(const uint8_t *image, uint8_t cmd, int new_plane)
+{
+    const int out_width = EPD_7IN5_V2_WIDTH / 8;
+    const int in_width = EPD_7IN5_V2_WIDTH / 4;
+
+    epd_cmd(cmd);
+    for (int y = 0; y < EPD_7IN5_V2_HEIGHT; y += CHUNK_ROWS) {
+        int rows = EPD_7IN5_V2_HEIGHT - y < CHUNK_ROWS ? EPD_7IN5_V2_HEIGHT - y : CHUNK_ROWS;
+        const uint8_t *src = image + y * in_width;
+        uint8_t *dst = s_chunk;
+        for (int i = 0; i < rows * out_width; i++) {
+            uint8_t hi = gray4_plane_lut[src[0]];
+            uint8_t lo = gray4_plane_lut[src[1]];
+            *dst++ = new_plane ? (uint8_t)((hi << 4) | (lo & 0x0F)) : (uint8_t)((hi & 0xF0) | (lo >> 4));
+            src += 2;
         }
+        epd_data2(s_chunk, rows * out_width);
     }
-    for (int j = 0; j < EPD_7IN5_V2_HEIGHT; j++) {
-        epd_data2((uint8_t *)(image + j * width), width);
+}
+
+void epd_7in5_v2_display_4gray(const uint8_t *image)
+{
+    if (s_mode != EPD_7IN5_V2_MODE_4GRAY) {
+        ESP_LOGW(TAG, "4-gray frame sent while panel is in mode %d", s_mode);
     }
+    int64_t t = TIME_US();
+    epd_send_4gray_plane(image, 0x10, 0);
+    epd_send_4gray_plane(image, 0x13, 1);
+    phase_add(EPD_7IN5_V2_PHASE_UPLOAD, t);
+    epd_7in5_v2_trun_on_display();
+}
+
+// Streams one plane of a view. Rows go out straight from the caller's buffer
+// (one transaction when they are contiguous); inverted planes are converted
+// through the chunk buffer, the source is never modified.
+static void epd_send_view_plane(const epd_7in5_v2_view_t *view, uint8_t cmd, bool invert)
+{
+    const uint32_t width = (view->x_end - view->x_start) / 8;
+    const uint32_t rows = view->y_end - view->y_start;
+
+    epd_cmd(cmd);
+    if (!invert) {
+        if (view->stride == width) {
+            epd_data2(view->pixels, width * rows);
+        } else {
+            for (uint32_t y = 0; y < rows; y++) {
+                epd_data2(view->pixels + y * view->stride, width);
+            }
+        }
+        return;
+    }
+
+    const uint32_t chunk_rows = sizeof(s_chunk) / width;
+    for (uint32_t y = 0; y < rows; y += chunk_rows) {
+        uint32_t n = rows - y < chunk_rows ? rows - y : chunk_rows;
+        uint8_t *dst = s_chunk;
+        for (uint32_t r = 0; r < n; r++) {
+            const uint8_t *src = view->pixels + (y + r) * view->stride;
+            for (uint32_t i = 0; i < width; i++) {
+                *dst++ = ~src[i];
+            }
+        }
+        epd_data2(s_chunk, n * width);
+    }
+}
+
+void epd_7in5_v2_write_view(const epd_7in5_v2_view_t *view)
+{
+    int64_t t = TIME_US();
+    const uint32_t x_last = view->x_end - 1;
+    const uint32_t y_last = view->y_end - 1;
+    const uint8_t window[9] = {
+        view->x_start >> 8, view->x_start & 0xFF, x_last >> 8, x_last & 0xFF,
+        view->y_start >> 8, view->y_start & 0xFF, y_last >> 8, y_last & 0xFF, 0x01,
+    };
+
+    // In partial mode RAM writes only land inside the window, so the view
+    // goes to its place without touching the rest of the frame
+    epd_cmd(0x91);
+    epd_cmd(0x90);
+    epd_data2(window, sizeof(window));
+
+    // KW mode wants the old plane as the image and the new plane inverted
+    // (black = 1 with DDX = 00); the view polarity decides which one to flip
+    epd_send_view_plane(view, 0x10, view->black_is_one);
+    epd_send_view_plane(view, 0x13, !view->black_is_one);
+
+    epd_cmd(0x92);      // partial out: the next refresh covers the whole screen
+    phase_add(EPD_7IN5_V2_PHASE_UPLOAD, t);
+}
+
+void epd_7in5_v2_refresh(void)
+{
     epd_7in5_v2_trun_on_display();
 }
 
@@ -0,0 +1,40 @@
+#include "epd_lvgl.h"
+#include "esp_log.h"
+
+static const char *TAG = "epd_lvgl";
+
+// Sum of the color channels of a palette entry (lv_color32_t: B, G, R, A)
+static int palette_brightness(const uint8_t *entry)
+{
+    return entry[0] + entry[1] + entry[2];
+}
+
+esp_err_t epd_lvgl_i1_view(const uint8_t *px_map, uint32_t stride, int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2, epd_7in5_v2_view_t *view)
+{
+    if (x1 < 0 || y1 < 0 || x2 >= EPD_7IN5_V2_WIDTH || y2 >= EPD_7IN5_V2_HEIGHT || x1 > x2 || y1 > y2 ||
+        (x1 & 7) != 0 || (x2 & 7) != 7) {
+        ESP_LOGE(TAG, "Area (%ld,%ld)-(%ld,%ld) cannot be sent to the panel",
+                 (long)x1, (long)y1, (long)x2, (long)y2);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (stride < (uint32_t)(x2 - x1 + 1) / 8) {
+        ESP_LOGE(TAG, "Stride %lu shorter than the area", (unsigned long)stride);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The software renderer sets a bit for light pixels and leaves the palette
+    // zeroed; only trust the palette when its two entries differ
+    const uint8_t *palette = px_map;
+    int b0 = palette_brightness(palette);
+    int b1 = palette_brightness(palette + 4);
+
+    view->pixels = px_map + EPD_LVGL_I1_PALETTE_SIZE;
+    view->stride = stride;
+    view->x_start = x1;
+    view->y_start = y1;
+    view->x_end = x2 + 1;
+    view->y_end = y2 + 1;
+    view->black_is_one = b1 < b0;
+    return ESP_OK;
+}
@@ -0,0 +1,25 @@
+#ifndef _EPD_LVGL_H_
+#define _EPD_LVGL_H_
+
+// Adapter from LVGL I1 flush buffers to the panel driver. Builds views into
+// the LVGL buffer instead of copying: the palette header is skipped, the
+// stride is kept and the bit polarity is read from the palette.
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "epd_7in5_v2.h"
+
+// LVGL puts the 2-entry I1 palette (2 x lv_color32_t) in front of the pixels
+#define EPD_LVGL_I1_PALETTE_SIZE 8
+
+/**
+ * Fills view for an I1 flush of area (x1, y1)-(x2, y2), inclusive as in
+ * lv_area_t. stride is the row pitch of the pixel data, e.g.
+ * lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_I1).
+ * Returns ESP_ERR_INVALID_ARG if the area is outside the panel or not byte
+ * aligned horizontally (LVGL rounds I1 areas to multiples of 8).
+ */
+esp_err_t epd_lvgl_i1_view(const uint8_t *px_map, uint32_t stride, int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2, epd_7in5_v2_view_t *view);
+
+#endif
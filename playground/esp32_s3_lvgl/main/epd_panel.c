@@ -0,0 +1,245 @@
+#include "epd_panel.h"
+#include "device.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "epd_panel";
+
+// Converted plane bytes per SPI transaction. Untransformed planes are sent
+// straight from the caller's buffer in transfers of up to the bus limit.
+#define CHUNK_SIZE      4096
+#define MAX_TRANSFER    EPD_SPI_MAX_TRANSFER
+
+static const epd_panel_t *s_panel = NULL;
+static uint8_t s_mode = 0;
+static uint8_t s_chunk[CHUNK_SIZE];
+
+static void wait_until_idle(void)
+{
+    ESP_LOGI(TAG, "e-Paper busy");
+    do {
+        if (s_panel->busy_poll_cmd) {
+            epd_cmd(s_panel->busy_poll_cmd);
+        }
+        DELAY_MS(s_panel->busy_poll_ms);
+    } while (GPIO_GET_LEVEL(PIN_NUM_BUSY) == s_panel->busy_level);
+    DELAY_MS(s_panel->busy_release_ms);
+    ESP_LOGI(TAG, "e-Paper busy release");
+}
+
+static void reset(void)
+{
+    GPIO_SET_LEVEL(PIN_NUM_N_RST, 1);
+    DELAY_MS(s_panel->reset_high_ms);
+    GPIO_SET_LEVEL(PIN_NUM_N_RST, 0);
+    DELAY_MS(s_panel->reset_low_ms);
+    GPIO_SET_LEVEL(PIN_NUM_N_RST, 1);
+    DELAY_MS(s_panel->reset_release_ms);
+}
+
+static esp_err_t run_sequence(const uint8_t *seq)
+{
+    if (seq == NULL) {
+        return ESP_OK;
+    }
+    while (*seq != EPD_OP_END) {
+        uint8_t op = *seq++;
+        if (op <= EPD_OP_CMD_MAX) {
+            // Register write: one command transaction plus one data transaction
+            epd_cmd(seq[0]);
+            epd_data2(seq + 1, op);
+            seq += 1 + op;
+            continue;
+        }
+        switch (op) {
+        case EPD_OP_DELAY:
+            DELAY_MS((seq[0] << 8) | seq[1]);
+            seq += 2;
+            break;
+        case EPD_OP_BUSY:
+            wait_until_idle();
+            break;
+        case EPD_OP_RESET:
+            reset();
+            break;
+        case EPD_OP_LUT:
+            if (seq[1] >= s_panel->lut_count) {
+                ESP_LOGE(TAG, "%s: LUT %d out of range", s_panel->name, seq[1]);
+                return ESP_ERR_INVALID_ARG;
+            }
+            epd_cmd(seq[0]);
+            epd_data2(s_panel->luts[seq[1]].data, s_panel->luts[seq[1]].len);
+            seq += 2;
+            break;
+        default:
+            ESP_LOGE(TAG, "%s: bad sequence opcode 0x%02X", s_panel->name, op);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+const epd_panel_t *epd_panel_find(const char *name)
+{
+    for (size_t i = 0; i < epd_panel_count; i++) {
+        if (strcmp(epd_panels[i]->name, name) == 0) {
+            return epd_panels[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t epd_panel_init(const epd_panel_t *panel, uint8_t mode)
+{
+    if (panel == NULL || mode >= panel->mode_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_panel = panel;
+    s_mode = mode;
+
+    GPIO_SET_LEVEL(PIN_NUM_PWR, 1);
+    DELAY_MS(panel->power_settle_ms);
+    esp_err_t err = run_sequence(panel->modes[mode].init);
+    ESP_LOGI(TAG, "%s init done, mode %s", panel->name, panel->modes[mode].name);
+    return err;
+}
+
+const epd_panel_t *epd_panel_current(void)
+{
+    return s_panel;
+}
+
+uint8_t epd_panel_current_mode(void)
+{
+    return s_mode;
+}
+
+size_t epd_panel_frame_size(void)
+{
+    if (s_panel == NULL) {
+        return 0;
+    }
+    size_t stride = ((size_t)s_panel->width * s_panel->modes[s_mode].bpp + 7) / 8;
+    return stride * s_panel->height;
+}
+
+// Picks the bit of every 2bpp pixel selected by mask (0x55 low, 0xAA high)
+// out of two input bytes and returns the eight inverted bits, MSB first
+static inline uint8_t gray4_bits(uint8_t a, uint8_t b, uint8_t mask)
+{
+    uint16_t v = (uint16_t)(((a & mask) << 8) | (b & mask));
+    if (mask == 0xAA) {
+        v >>= 1;
+    }
+    // Compress bits 14,12,..,0 into bits 7..0
+    v = (v | (v >> 1)) & 0x3333;
+    v = (v | (v >> 2)) & 0x0F0F;
+    v = (v | (v >> 4)) & 0x00FF;
+    return (uint8_t)~v;
+}
+
+// Converts n plane bytes from in (n input bytes, 2n for 2bpp sources) into out
+static void convert(uint8_t src, const uint8_t *in, uint8_t *out, size_t n)
+{
+    switch (src) {
+    case EPD_PLANE_COPY:
+        memcpy(out, in, n);
+        break;
+    case EPD_PLANE_INVERT:
+        for (size_t i = 0; i < n; i++) {
+            out[i] = ~in[i];
+        }
+        break;
+    case EPD_PLANE_GRAY4_OLD:
+    case EPD_PLANE_GRAY4_NEW: {
+        // White (3) -> 0/0, black (0) -> 1/1, gray1 (2) -> 1/0, gray2 (1) -> 0/1
+        uint8_t mask = src == EPD_PLANE_GRAY4_OLD ? 0x55 : 0xAA;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = gray4_bits(in[0], in[1], mask);
+            in += 2;
+        }
+        break;
+    }
+    case EPD_PLANE_FILL_00:
+        memset(out, 0x00, n);
+        break;
+    case EPD_PLANE_FILL_FF:
+    default:
+        memset(out, 0xFF, n);
+        break;
+    }
+}
+
+// image == NULL sends a frame where every input byte is fill
+static void send_plane(const epd_plane_t *plane, const uint8_t *image, uint8_t fill, size_t plane_size)
+{
+    int in_scale = (plane->src == EPD_PLANE_GRAY4_OLD || plane->src == EPD_PLANE_GRAY4_NEW) ? 2 : 1;
+    epd_cmd(plane->cmd);
+
+    if (image == NULL) {
+        uint8_t in[2] = { fill, fill };
+        uint8_t out;
+        convert(plane->src, in, &out, 1);
+        memset(s_chunk, out, CHUNK_SIZE);
+        for (size_t off = 0; off < plane_size; off += CHUNK_SIZE) {
+            epd_data2(s_chunk, plane_size - off < CHUNK_SIZE ? plane_size - off : CHUNK_SIZE);
+        }
+        return;
+    }
+
+    if (plane->src == EPD_PLANE_COPY) {
+        // Straight from the caller's buffer, no copy
+        for (size_t off = 0; off < plane_size; off += MAX_TRANSFER) {
+            epd_data2(image + off, plane_size - off < MAX_TRANSFER ? plane_size - off : MAX_TRANSFER);
+        }
+        return;
+    }
+
+    for (size_t off = 0; off < plane_size; off += CHUNK_SIZE) {
+        size_t n = plane_size - off < CHUNK_SIZE ? plane_size - off : CHUNK_SIZE;
+        convert(plane->src, image + off * in_scale, s_chunk, n);
+        epd_data2(s_chunk, n);
+    }
+}
+
+static esp_err_t write_planes(const uint8_t *image, uint8_t fill)
+{
+    if (s_panel == NULL) {
+        ESP_LOGE(TAG, "No panel initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+    const epd_panel_mode_t *mode = &s_panel->modes[s_mode];
+    // 2bpp input is split into two 1bpp planes, other formats map 1:1 to RAM
+    size_t plane_bpp = mode->bpp == 2 ? 1 : mode->bpp;
+    size_t plane_size = ((size_t)s_panel->width * plane_bpp + 7) / 8 * s_panel->height;
+
+    esp_err_t err = run_sequence(mode->prepare);
+    if (err != ESP_OK) {
+        return err;
+    }
+    for (int i = 0; i < mode->plane_count; i++) {
+        send_plane(&mode->planes[i], image, fill, plane_size);
+    }
+    return run_sequence(mode->refresh);
+}
+
+esp_err_t epd_panel_display(const uint8_t *image)
+{
+    if (image == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return write_planes(image, 0);
+}
+
+esp_err_t epd_panel_fill(uint8_t value)
+{
+    return write_planes(NULL, value);
+}
+
+esp_err_t epd_panel_sleep(void)
+{
+    if (s_panel == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return run_sequence(s_panel->sleep);
+}
@@ -0,0 +1,106 @@
+#ifndef _EPD_PANEL_H_
+#define _EPD_PANEL_H_
+
+// Data-driven e-paper engine. A panel is described by a const descriptor
+// (geometry, BUSY polarity, init/refresh/sleep sequences, RAM plane layout
+// and LUTs) and driven by one generic engine that batches every register
+// write into a command + data transaction and streams frames in large
+// chunks. Descriptors live in epd_panels.c.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// Sequence opcodes. A sequence is a byte string terminated by EPD_SEQ_END:
+//   EPD_SEQ_CMD(n), cmd, d0 .. dn-1    register write with n data bytes (n <= 63)
+//   EPD_SEQ_DELAY(ms)                  fixed wait, ms < 65536
+//   EPD_SEQ_BUSY                       wait until the controller releases BUSY
+//   EPD_SEQ_RESET                      hardware reset pulse with the panel timing
+//   EPD_SEQ_LUT(cmd, idx)              write the panel LUT idx to register cmd
+#define EPD_OP_CMD_MAX  0x3F
+#define EPD_OP_DELAY    0x40
+#define EPD_OP_BUSY     0x41
+#define EPD_OP_RESET    0x42
+#define EPD_OP_LUT      0x43
+#define EPD_OP_END      0xFF
+
+#define EPD_SEQ_CMD(n)          (n)
+#define EPD_SEQ_DELAY(ms)       EPD_OP_DELAY, ((ms) >> 8) & 0xFF, (ms) & 0xFF
+#define EPD_SEQ_BUSY            EPD_OP_BUSY
+#define EPD_SEQ_RESET           EPD_OP_RESET
+#define EPD_SEQ_LUT(cmd, idx)   EPD_OP_LUT, (cmd), (idx)
+#define EPD_SEQ_END             EPD_OP_END
+
+#define EPD_PANEL_MAX_PLANES    2
+
+// How a RAM plane is produced from the caller's image
+typedef enum {
+    EPD_PLANE_COPY = 0,     // image bytes as they are
+    EPD_PLANE_INVERT,       // image bytes inverted (1bpp, 1 = white input)
+    EPD_PLANE_GRAY4_OLD,    // 2bpp input, old-data bit of each pixel (UC8179 4-gray)
+    EPD_PLANE_GRAY4_NEW,    // 2bpp input, new-data bit of each pixel
+    EPD_PLANE_FILL_00,      // constant 0x00, image ignored
+    EPD_PLANE_FILL_FF,      // constant 0xFF, image ignored
+} epd_plane_src_t;
+
+typedef struct {
+    uint8_t cmd;            // RAM write command (0x10/0x13 on UC8179, 0x24/0x26 on SSD1680)
+    uint8_t src;            // epd_plane_src_t
+} epd_plane_t;
+
+typedef struct {
+    const char *name;
+    uint8_t bpp;            // bits per pixel of the caller's image, MSB first
+    uint8_t plane_count;
+    epd_plane_t planes[EPD_PANEL_MAX_PLANES];
+    const uint8_t *init;    // after power on, starts with EPD_SEQ_RESET
+    const uint8_t *prepare; // before the planes are written, may be NULL
+    const uint8_t *refresh; // after the planes are written
+} epd_panel_mode_t;
+
+typedef struct {
+    const uint8_t *data;
+    uint16_t len;
+} epd_panel_lut_t;
+
+typedef struct {
+    const char *name;
+    uint16_t width;
+    uint16_t height;
+    uint8_t busy_level;     // BUSY pin level while the controller is busy
+    uint8_t busy_poll_cmd;  // sent on every BUSY poll (UC8179 needs 0x71), 0 = none
+    uint16_t busy_poll_ms;
+    uint16_t busy_release_ms;
+    uint16_t power_settle_ms;
+    uint16_t reset_high_ms;
+    uint16_t reset_low_ms;
+    uint16_t reset_release_ms;
+    const epd_panel_mode_t *modes;
+    uint8_t mode_count;
+    const epd_panel_lut_t *luts;
+    uint8_t lut_count;
+    const uint8_t *sleep;
+} epd_panel_t;
+
+extern const epd_panel_t *const epd_panels[];
+extern const size_t epd_panel_count;
+
+const epd_panel_t *epd_panel_find(const char *name);
+
+// Powers the panel, resets it and runs the init sequence of the mode
+esp_err_t epd_panel_init(const epd_panel_t *panel, uint8_t mode);
+const epd_panel_t *epd_panel_current(void);
+uint8_t epd_panel_current_mode(void);
+
+// Bytes of one frame in the caller's format for the current mode
+size_t epd_panel_frame_size(void);
+
+// Writes every plane of the current mode from image and refreshes.
+// The image is never modified; transformed planes go through a chunk buffer.
+esp_err_t epd_panel_display(const uint8_t *image);
+
+// Displays a frame in which every input byte is value (0xFF: white for 1bpp modes)
+esp_err_t epd_panel_fill(uint8_t value);
+esp_err_t epd_panel_sleep(void);
+
+#endif
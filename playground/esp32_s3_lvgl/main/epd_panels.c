@@ -0,0 +1,326 @@
+// Panel descriptors for epd_panel.c. Sequences are transcribed from the
+// Waveshare drivers in third_party/waveshare (utility/EPD_*.cpp).
+#include "epd_panel.h"
+
+// ---------------------------------------------------------------------------
+// 7.5" V2, 800x480, UC8179. BUSY low = busy, polled with GET STATUS (0x71).
+// 1bpp input: bit set = white.
+
+static const uint8_t epd_7in5_v2_init_full[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_CMD(4), 0x06, 0x17, 0x17, 0x28, 0x17,  // booster soft start
+    EPD_SEQ_CMD(4), 0x01, 0x07, 0x07, 0x3F, 0x3F,  // power setting
+    EPD_SEQ_CMD(0), 0x04,                          // power on
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x00, 0x1F,                    // panel setting, KW
+    EPD_SEQ_CMD(4), 0x61, 0x03, 0x20, 0x01, 0xE0,  // resolution 800x480
+    EPD_SEQ_CMD(1), 0x15, 0x00,
+    EPD_SEQ_CMD(2), 0x50, 0x10, 0x07,              // VCOM and data interval
+    EPD_SEQ_CMD(1), 0x60, 0x22,                    // TCON
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in5_v2_init_fast[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_CMD(1), 0x00, 0x1F,
+    EPD_SEQ_CMD(2), 0x50, 0x10, 0x07,
+    EPD_SEQ_CMD(0), 0x04,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(4), 0x06, 0x27, 0x27, 0x18, 0x17,
+    EPD_SEQ_CMD(1), 0xE0, 0x02,                    // load waveform for ...
+    EPD_SEQ_CMD(1), 0xE5, 0x5A,                    // ... temperature slot 0x5A
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in5_v2_init_part[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_CMD(1), 0x00, 0x1F,
+    EPD_SEQ_CMD(0), 0x04,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0xE0, 0x02,
+    EPD_SEQ_CMD(1), 0xE5, 0x6E,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in5_v2_init_4gray[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_CMD(1), 0x00, 0x1F,
+    EPD_SEQ_CMD(2), 0x50, 0x10, 0x07,
+    EPD_SEQ_CMD(0), 0x04,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(4), 0x06, 0x27, 0x27, 0x18, 0x17,
+    EPD_SEQ_CMD(1), 0xE0, 0x02,
+    EPD_SEQ_CMD(1), 0xE5, 0x5F,
+    EPD_SEQ_END,
+};
+
+// Whole-screen window: partial waveform without the full flash
+static const uint8_t epd_7in5_v2_prepare_part[] = {
+    EPD_SEQ_CMD(2), 0x50, 0xA9, 0x07,
+    EPD_SEQ_CMD(0), 0x91,                          // partial in
+    EPD_SEQ_CMD(9), 0x90, 0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x01, 0xDF, 0x01,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in5_v2_refresh[] = {
+    EPD_SEQ_CMD(0), 0x12,
+    EPD_SEQ_DELAY(100),                            // >= 200 us before BUSY is valid
+    EPD_SEQ_BUSY,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in5_v2_sleep[] = {
+    EPD_SEQ_CMD(1), 0x50, 0xF7,
+    EPD_SEQ_CMD(0), 0x02,                          // power off
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x07, 0xA5,                    // deep sleep
+    EPD_SEQ_END,
+};
+
+static const epd_panel_mode_t epd_7in5_v2_modes[] = {
+    {
+        .name = "full", .bpp = 1, .plane_count = 2,
+        .planes = { { 0x10, EPD_PLANE_COPY }, { 0x13, EPD_PLANE_INVERT } },
+        .init = epd_7in5_v2_init_full, .refresh = epd_7in5_v2_refresh,
+    },
+    {
+        .name = "fast", .bpp = 1, .plane_count = 2,
+        .planes = { { 0x10, EPD_PLANE_COPY }, { 0x13, EPD_PLANE_INVERT } },
+        .init = epd_7in5_v2_init_fast, .refresh = epd_7in5_v2_refresh,
+    },
+    {
+        // DDX = 10 in partial mode: new data is not inverted
+        .name = "part", .bpp = 1, .plane_count = 1,
+        .planes = { { 0x13, EPD_PLANE_COPY } },
+        .init = epd_7in5_v2_init_part, .prepare = epd_7in5_v2_prepare_part,
+        .refresh = epd_7in5_v2_refresh,
+    },
+    {
+        // 2bpp input, 0 = black .. 3 = white
+        .name = "4gray", .bpp = 2, .plane_count = 2,
+        .planes = { { 0x10, EPD_PLANE_GRAY4_OLD }, { 0x13, EPD_PLANE_GRAY4_NEW } },
+        .init = epd_7in5_v2_init_4gray, .refresh = epd_7in5_v2_refresh,
+    },
+};
+
+static const epd_panel_t epd_7in5_v2_panel = {
+    .name = "7in5_v2",
+    .width = 800, .height = 480,
+    .busy_level = 0, .busy_poll_cmd = 0x71,
+    .busy_poll_ms = 5, .busy_release_ms = 5,
+    .power_settle_ms = 20,
+    .reset_high_ms = 20, .reset_low_ms = 2, .reset_release_ms = 20,
+    .modes = epd_7in5_v2_modes,
+    .mode_count = sizeof(epd_7in5_v2_modes) / sizeof(epd_7in5_v2_modes[0]),
+    .sleep = epd_7in5_v2_sleep,
+};
+
+// ---------------------------------------------------------------------------
+// 5.83" V2, 648x480, UC8179 family. Same conventions as the 7.5" V2.
+
+static const uint8_t epd_5in83_v2_init[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_CMD(4), 0x01, 0x07, 0x07, 0x3F, 0x3F,
+    EPD_SEQ_CMD(0), 0x04,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x00, 0x1F,
+    EPD_SEQ_CMD(4), 0x61, 0x02, 0x88, 0x01, 0xE0,  // resolution 648x480
+    EPD_SEQ_CMD(1), 0x15, 0x00,
+    EPD_SEQ_CMD(2), 0x50, 0x10, 0x07,
+    EPD_SEQ_CMD(1), 0x60, 0x22,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_5in83_v2_sleep[] = {
+    EPD_SEQ_CMD(0), 0x02,
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x07, 0xA5,
+    EPD_SEQ_END,
+};
+
+static const epd_panel_mode_t epd_5in83_v2_modes[] = {
+    {
+        .name = "full", .bpp = 1, .plane_count = 2,
+        .planes = { { 0x10, EPD_PLANE_FILL_00 }, { 0x13, EPD_PLANE_INVERT } },
+        .init = epd_5in83_v2_init, .refresh = epd_7in5_v2_refresh,
+    },
+};
+
+static const epd_panel_t epd_5in83_v2_panel = {
+    .name = "5in83_v2",
+    .width = 648, .height = 480,
+    .busy_level = 0, .busy_poll_cmd = 0x71,
+    .busy_poll_ms = 50, .busy_release_ms = 50,
+    .power_settle_ms = 20,
+    .reset_high_ms = 200, .reset_low_ms = 5, .reset_release_ms = 200,
+    .modes = epd_5in83_v2_modes,
+    .mode_count = sizeof(epd_5in83_v2_modes) / sizeof(epd_5in83_v2_modes[0]),
+    .sleep = epd_5in83_v2_sleep,
+};
+
+// ---------------------------------------------------------------------------
+// 7.3" F, 800x480, 7 colors. BUSY low = busy, no status polling.
+// 4bpp input, two pixels per byte, colors as in EPD_7in3f.h (0 = black .. 6 = orange).
+
+static const uint8_t epd_7in3f_init[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_BUSY,
+    EPD_SEQ_DELAY(30),
+    EPD_SEQ_CMD(6), 0xAA, 0x49, 0x55, 0x20, 0x08, 0x09, 0x18,  // CMDH
+    EPD_SEQ_CMD(6), 0x01, 0x3F, 0x00, 0x32, 0x2A, 0x0E, 0x2A,
+    EPD_SEQ_CMD(2), 0x00, 0x5F, 0x69,
+    EPD_SEQ_CMD(4), 0x03, 0x00, 0x54, 0x00, 0x44,
+    EPD_SEQ_CMD(4), 0x05, 0x40, 0x1F, 0x1F, 0x2C,
+    EPD_SEQ_CMD(4), 0x06, 0x6F, 0x1F, 0x1F, 0x22,
+    EPD_SEQ_CMD(4), 0x08, 0x6F, 0x1F, 0x1F, 0x22,
+    EPD_SEQ_CMD(2), 0x13, 0x00, 0x04,                          // IPC
+    EPD_SEQ_CMD(1), 0x30, 0x3C,
+    EPD_SEQ_CMD(1), 0x41, 0x00,                                // TSE
+    EPD_SEQ_CMD(1), 0x50, 0x3F,
+    EPD_SEQ_CMD(2), 0x60, 0x02, 0x00,
+    EPD_SEQ_CMD(4), 0x61, 0x03, 0x20, 0x01, 0xE0,
+    EPD_SEQ_CMD(1), 0x82, 0x1E,
+    EPD_SEQ_CMD(1), 0x84, 0x00,
+    EPD_SEQ_CMD(1), 0x86, 0x00,                                // AGID
+    EPD_SEQ_CMD(1), 0xE3, 0x2F,
+    EPD_SEQ_CMD(1), 0xE0, 0x00,                                // CCSET
+    EPD_SEQ_CMD(1), 0xE6, 0x00,                                // TSSET
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in3f_refresh[] = {
+    EPD_SEQ_CMD(0), 0x04,
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x12, 0x00,
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x02, 0x00,
+    EPD_SEQ_BUSY,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_7in3f_sleep[] = {
+    EPD_SEQ_CMD(1), 0x07, 0xA5,
+    EPD_SEQ_END,
+};
+
+static const epd_panel_mode_t epd_7in3f_modes[] = {
+    {
+        .name = "7color", .bpp = 4, .plane_count = 1,
+        .planes = { { 0x10, EPD_PLANE_COPY } },
+        .init = epd_7in3f_init, .refresh = epd_7in3f_refresh,
+    },
+};
+
+static const epd_panel_t epd_7in3f_panel = {
+    .name = "7in3f",
+    .width = 800, .height = 480,
+    .busy_level = 0, .busy_poll_cmd = 0,
+    .busy_poll_ms = 10, .busy_release_ms = 0,
+    .power_settle_ms = 20,
+    .reset_high_ms = 20, .reset_low_ms = 2, .reset_release_ms = 20,
+    .modes = epd_7in3f_modes,
+    .mode_count = sizeof(epd_7in3f_modes) / sizeof(epd_7in3f_modes[0]),
+    .sleep = epd_7in3f_sleep,
+};
+
+// ---------------------------------------------------------------------------
+// 2.9" V2, 128x296, SSD1680. BUSY high = busy, waveform loaded from the host.
+// 1bpp input: bit set = white.
+
+// WS_20_30 waveform (first 153 bytes; the voltage bytes are in the init sequence)
+static const uint8_t epd_2in9_v2_lut_full[153] = {
+    0x80, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x10, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x80, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x10, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,
+};
+
+static const epd_panel_lut_t epd_2in9_v2_luts[] = {
+    { epd_2in9_v2_lut_full, sizeof(epd_2in9_v2_lut_full) },
+};
+
+static const uint8_t epd_2in9_v2_init[] = {
+    EPD_SEQ_RESET,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(0), 0x12,                          // soft reset
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(3), 0x01, 0x27, 0x01, 0x00,        // driver output control, 296 gates
+    EPD_SEQ_CMD(1), 0x11, 0x03,                    // data entry: x+, y+
+    EPD_SEQ_CMD(2), 0x44, 0x00, 0x0F,              // RAM x window 0..127
+    EPD_SEQ_CMD(4), 0x45, 0x00, 0x00, 0x27, 0x01,  // RAM y window 0..295
+    EPD_SEQ_CMD(2), 0x21, 0x00, 0x80,
+    EPD_SEQ_CMD(1), 0x4E, 0x00,                    // RAM x counter
+    EPD_SEQ_CMD(2), 0x4F, 0x00, 0x00,              // RAM y counter
+    EPD_SEQ_BUSY,
+    EPD_SEQ_LUT(0x32, 0),
+    EPD_SEQ_BUSY,
+    EPD_SEQ_CMD(1), 0x3F, 0x22,
+    EPD_SEQ_CMD(1), 0x03, 0x17,                    // gate voltage
+    EPD_SEQ_CMD(3), 0x04, 0x41, 0x00, 0x32,        // source voltage
+    EPD_SEQ_CMD(1), 0x2C, 0x36,                    // VCOM
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_2in9_v2_refresh[] = {
+    EPD_SEQ_CMD(1), 0x22, 0xC7,                    // display update control
+    EPD_SEQ_CMD(0), 0x20,                          // activate
+    EPD_SEQ_BUSY,
+    EPD_SEQ_END,
+};
+
+static const uint8_t epd_2in9_v2_sleep[] = {
+    EPD_SEQ_CMD(1), 0x10, 0x01,
+    EPD_SEQ_DELAY(100),
+    EPD_SEQ_END,
+};
+
+static const epd_panel_mode_t epd_2in9_v2_modes[] = {
+    {
+        .name = "full", .bpp = 1, .plane_count = 1,
+        .planes = { { 0x24, EPD_PLANE_COPY } },
+        .init = epd_2in9_v2_init, .refresh = epd_2in9_v2_refresh,
+    },
+};
+
+static const epd_panel_t epd_2in9_v2_panel = {
+    .name = "2in9_v2",
+    .width = 128, .height = 296,
+    .busy_level = 1, .busy_poll_cmd = 0,
+    .busy_poll_ms = 10, .busy_release_ms = 10,
+    .power_settle_ms = 20,
+    .reset_high_ms = 10, .reset_low_ms = 2, .reset_release_ms = 10,
+    .modes = epd_2in9_v2_modes,
+    .mode_count = sizeof(epd_2in9_v2_modes) / sizeof(epd_2in9_v2_modes[0]),
+    .luts = epd_2in9_v2_luts,
+    .lut_count = sizeof(epd_2in9_v2_luts) / sizeof(epd_2in9_v2_luts[0]),
+    .sleep = epd_2in9_v2_sleep,
+};
+
+const epd_panel_t *const epd_panels[] = {
+    &epd_7in5_v2_panel,
+    &epd_5in83_v2_panel,
+    &epd_7in3f_panel,
+    &epd_2in9_v2_panel,
+};
+
+const size_t epd_panel_count = sizeof(epd_panels) / sizeof(epd_panels[0]);
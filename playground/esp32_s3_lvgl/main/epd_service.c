@@ -0,0 +1,321 @@
+#include "epd_service.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "epd_service";
+
+#define EPD_SERVICE_PRIORITY    5
+
+typedef enum {
+    EPD_JOB_INIT,
+    EPD_JOB_FRAME,
+    EPD_JOB_PARTIAL,
+    EPD_JOB_VIEW,
+    EPD_JOB_REFRESH,
+    EPD_JOB_SLEEP,
+} epd_job_type_t;
+
+struct epd_job {
+    epd_job_type_t type;
+    uint32_t seq;
+    epd_7in5_v2_mode_t mode;
+    uint8_t *image;
+    uint32_t x_start, y_start, x_end, y_end;
+    epd_7in5_v2_view_t view;
+    bool refresh;
+    epd_service_cb_t cb;
+    void *arg;
+    bool detached;
+    SemaphoreHandle_t done;
+    StaticSemaphore_t done_buf;
+};
+
+typedef enum {
+    TRACE_SUBMIT,
+    TRACE_START,
+    TRACE_DONE,
+    TRACE_MARK,
+} trace_kind_t;
+
+typedef struct {
+    int64_t time_us;
+    const char *label;
+    uint32_t seq;
+    trace_kind_t kind;
+} trace_entry_t;
+
+static const char *const job_names[] = { "init", "frame", "partial", "view", "refresh", "sleep" };
+static const char *const trace_kind_names[] = { "submit", "start", "done", "" };
+
+static epd_job_t s_jobs[EPD_SERVICE_MAX_JOBS];
+static QueueHandle_t s_free_queue = NULL;   // idle job slots
+static QueueHandle_t s_cmd_queue = NULL;    // jobs waiting for the panel
+static uint32_t s_next_seq = 1;
+static int s_pending = 0;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static trace_entry_t s_trace[EPD_SERVICE_TRACE_LEN];
+static uint32_t s_trace_count = 0;
+
+static void trace_add(trace_kind_t kind, const char *label, uint32_t seq)
+{
+    int64_t now = esp_timer_get_time();
+    taskENTER_CRITICAL(&s_lock);
+    trace_entry_t *e = &s_trace[s_trace_count % EPD_SERVICE_TRACE_LEN];
+    e->time_us = now;
+    e->label = label;
+    e->seq = seq;
+    e->kind = kind;
+    s_trace_count++;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+static void epd_service_task(void *pvParameter)
+{
+    epd_job_t *job;
+    while (1) {
+        xQueueReceive(s_cmd_queue, &job, portMAX_DELAY);
+        trace_add(TRACE_START, job_names[job->type], job->seq);
+
+        switch (job->type) {
+        case EPD_JOB_INIT:
+            epd_7in5_v2_init_mode(job->mode);
+            break;
+        case EPD_JOB_FRAME:
+            if (epd_7in5_v2_get_mode() == EPD_7IN5_V2_MODE_4GRAY) {
+                epd_7in5_v2_display_4gray(job->image);
+            } else {
+                epd_7in5_v2_display(job->image);
+            }
+            break;
+        case EPD_JOB_PARTIAL:
+            epd_7in5_v2_display_part(job->image, job->x_start, job->y_start, job->x_end, job->y_end);
+            break;
+        case EPD_JOB_VIEW:
+            epd_7in5_v2_write_view(&job->view);
+            if (job->refresh) {
+                epd_7in5_v2_refresh();
+            }
+            break;
+        case EPD_JOB_REFRESH:
+            epd_7in5_v2_refresh();
+            break;
+        case EPD_JOB_SLEEP:
+            epd_7in5_v2_sleep();
+            break;
+        }
+
+        trace_add(TRACE_DONE, job_names[job->type], job->seq);
+        if (job->cb) {
+            job->cb(ESP_OK, job->arg);
+        }
+
+        taskENTER_CRITICAL(&s_lock);
+        s_pending--;
+        taskEXIT_CRITICAL(&s_lock);
+
+        if (job->detached) {
+            xQueueSend(s_free_queue, &job, 0);
+        } else {
+            xSemaphoreGive(job->done);
+        }
+    }
+}
+
+static esp_err_t job_acquire(epd_job_t **job, TickType_t timeout_ticks)
+{
+    if (s_cmd_queue == NULL) {
+        ESP_LOGE(TAG, "Display service not started");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xQueueReceive(s_free_queue, job, timeout_ticks) != pdTRUE) {
+        ESP_LOGW(TAG, "No free job slot");
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t job_submit(epd_job_t *job, epd_service_cb_t cb, void *arg, epd_job_t **out_job)
+{
+    job->cb = cb;
+    job->arg = arg;
+    job->detached = (out_job == NULL);
+
+    taskENTER_CRITICAL(&s_lock);
+    job->seq = s_next_seq++;
+    s_pending++;
+    taskEXIT_CRITICAL(&s_lock);
+
+    trace_add(TRACE_SUBMIT, job_names[job->type], job->seq);
+    if (out_job) {
+        *out_job = job;
+    }
+    // Never blocks: the command queue has room for every job slot
+    xQueueSend(s_cmd_queue, &job, 0);
+    return ESP_OK;
+}
+
+esp_err_t epd_service_start(void)
+{
+    if (s_cmd_queue != NULL) {
+        ESP_LOGW(TAG, "Display service already started");
+        return ESP_OK;
+    }
+
+    s_free_queue = xQueueCreate(EPD_SERVICE_MAX_JOBS, sizeof(epd_job_t *));
+    s_cmd_queue = xQueueCreate(EPD_SERVICE_MAX_JOBS, sizeof(epd_job_t *));
+    if (s_free_queue == NULL || s_cmd_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create display service queues");
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < EPD_SERVICE_MAX_JOBS; i++) {
+        epd_job_t *job = &s_jobs[i];
+        job->done = xSemaphoreCreateBinaryStatic(&job->done_buf);
+        xQueueSend(s_free_queue, &job, 0);
+    }
+
+    if (xTaskCreate(epd_service_task, "epd_service", EPD_SERVICE_STACK_SIZE, NULL,
+                    EPD_SERVICE_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create display service task");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Display service started");
+    return ESP_OK;
+}
+
+esp_err_t epd_service_submit_init(epd_7in5_v2_mode_t mode, epd_service_cb_t cb, void *arg,
+                                  epd_job_t **job, TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_INIT;
+    j->mode = mode;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_submit_frame(const uint8_t *image, epd_service_cb_t cb, void *arg,
+                                   epd_job_t **job, TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_FRAME;
+    j->image = (uint8_t *)image;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_submit_partial(uint8_t *image, uint32_t x_start, uint32_t y_start,
+                                     uint32_t x_end, uint32_t y_end, epd_service_cb_t cb, void *arg,
+                                     epd_job_t **job, TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_PARTIAL;
+    j->image = image;
+    j->x_start = x_start;
+    j->y_start = y_start;
+    j->x_end = x_end;
+    j->y_end = y_end;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_submit_view(const epd_7in5_v2_view_t *view, bool refresh, epd_service_cb_t cb,
+                                  void *arg, epd_job_t **job, TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_VIEW;
+    j->view = *view;
+    j->refresh = refresh;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_submit_refresh(epd_service_cb_t cb, void *arg, epd_job_t **job,
+                                     TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_REFRESH;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_sleep(epd_service_cb_t cb, void *arg, epd_job_t **job, TickType_t timeout_ticks)
+{
+    epd_job_t *j;
+    esp_err_t err = job_acquire(&j, timeout_ticks);
+    if (err != ESP_OK) {
+        return err;
+    }
+    j->type = EPD_JOB_SLEEP;
+    return job_submit(j, cb, arg, job);
+}
+
+esp_err_t epd_service_wait(epd_job_t *job, TickType_t timeout_ticks)
+{
+    if (job == NULL || job->detached) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xSemaphoreTake(job->done, timeout_ticks) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xQueueSend(s_free_queue, &job, 0);
+    return ESP_OK;
+}
+
+bool epd_service_busy(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    bool busy = s_pending > 0;
+    taskEXIT_CRITICAL(&s_lock);
+    return busy;
+}
+
+void epd_service_trace_mark(const char *label)
+{
+    trace_add(TRACE_MARK, label, 0);
+}
+
+void epd_service_trace_dump(void)
+{
+    static trace_entry_t snapshot[EPD_SERVICE_TRACE_LEN];
+    taskENTER_CRITICAL(&s_lock);
+    uint32_t count = s_trace_count;
+    uint32_t n = count < EPD_SERVICE_TRACE_LEN ? count : EPD_SERVICE_TRACE_LEN;
+    for (uint32_t i = 0; i < n; i++) {
+        snapshot[i] = s_trace[(count - n + i) % EPD_SERVICE_TRACE_LEN];
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (n == 0) {
+        ESP_LOGI(TAG, "Timeline: empty");
+        return;
+    }
+    ESP_LOGI(TAG, "Timeline (%" PRIu32 " entries, ms since first):", n);
+    int64_t t0 = snapshot[0].time_us;
+    for (uint32_t i = 0; i < n; i++) {
+        trace_entry_t *e = &snapshot[i];
+        long ms = (long)((e->time_us - t0) / 1000);
+        if (e->kind == TRACE_MARK) {
+            ESP_LOGI(TAG, "  %7ld  app    | %s", ms, e->label);
+        } else {
+            ESP_LOGI(TAG, "  %7ld  epd #%-2" PRIu32 "|   %s %s", ms, e->seq, e->label, trace_kind_names[e->kind]);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef _EPD_SERVICE_H_
+#define _EPD_SERVICE_H_
+
+#include <stdbool.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "epd_7in5_v2.h"
+
+// Jobs that can be in flight (queued or running) at the same time
+#define EPD_SERVICE_MAX_JOBS    4
+// Entries kept by the timeline trace, oldest are overwritten
+#define EPD_SERVICE_TRACE_LEN   32
+#define EPD_SERVICE_STACK_SIZE  4096
+
+typedef struct epd_job epd_job_t;
+
+// Called from the display service task once a job has finished
+typedef void (*epd_service_cb_t)(esp_err_t result, void *arg);
+
+/**
+ * Starts the display service task. All panel access must go through the
+ * service afterwards; the epd_7in5_v2_* calls are not thread safe.
+ */
+esp_err_t epd_service_start(void);
+
+/**
+ * Async operations. They return as soon as the job is queued.
+ *
+ * The image buffer must stay valid and unmodified until the job completes.
+ * If job is NULL the job is fire-and-forget and only cb reports completion,
+ * otherwise *job must be passed to epd_service_wait() exactly once.
+ * Returns ESP_ERR_TIMEOUT if no job slot became free within timeout_ticks.
+ */
+esp_err_t epd_service_submit_init(epd_7in5_v2_mode_t mode, epd_service_cb_t cb, void *arg,
+                                  epd_job_t **job, TickType_t timeout_ticks);
+esp_err_t epd_service_submit_frame(const uint8_t *image, epd_service_cb_t cb, void *arg,
+                                   epd_job_t **job, TickType_t timeout_ticks);
+esp_err_t epd_service_submit_partial(uint8_t *image, uint32_t x_start, uint32_t y_start,
+                                     uint32_t x_end, uint32_t y_end, epd_service_cb_t cb, void *arg,
+                                     epd_job_t **job, TickType_t timeout_ticks);
+// Writes the view into controller RAM; refresh triggers the panel refresh
+// afterwards (use on the last view of a frame). The view struct is copied,
+// the pixels it points to must stay valid until the job completes.
+esp_err_t epd_service_submit_view(const epd_7in5_v2_view_t *view, bool refresh, epd_service_cb_t cb,
+                                  void *arg, epd_job_t **job, TickType_t timeout_ticks);
+// Refreshes the panel from what is already in controller RAM
+esp_err_t epd_service_submit_refresh(epd_service_cb_t cb, void *arg, epd_job_t **job,
+                                     TickType_t timeout_ticks);
+esp_err_t epd_service_sleep(epd_service_cb_t cb, void *arg, epd_job_t **job, TickType_t timeout_ticks);
+
+/**
+ * Blocks until the job completes and releases its handle.
+ * On ESP_ERR_TIMEOUT the handle stays valid and must be waited on again.
+ */
+esp_err_t epd_service_wait(epd_job_t *job, TickType_t timeout_ticks);
+
+// True while a job is queued or running
+bool epd_service_busy(void);
+
+// Adds an application event (e.g. "wifi off") to the timeline trace
+void epd_service_trace_mark(const char *label);
+
+// Logs the timeline trace, times relative to the oldest entry
+void epd_service_trace_dump(void);
+
+#endif
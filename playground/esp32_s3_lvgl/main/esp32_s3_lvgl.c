@@ -2,81 +2,329 @@
 #include "lvgl.h"
 #include "device.h"
 #include "epd_7in5_v2.h"
+#include "epd_service.h"
+#include "epd_lvgl.h"
+#include "ttf_font.h"
+#include "glyph_fetch.h"
+#include "gui_ui.h"
 #include "esp_timer.h"
+#include "mem_policy.h"
+#include "mem_telemetry.h"
+#include "esp_log.h"
+#include "esp_pm.h"
 
-static void lv_tick_cb(void *arg)
+static const char *TAG = "gui";
+
+// 0: 1bpp I1 frames on the full refresh profile
+// 1: 4-level gray. LVGL 9.2 cannot render into I2, so frames are rendered as L8
+//    (in PSRAM) and quantized to the panel's 2bpp format in the flush callback.
+#define GUI_RENDER_GRAY4 0
+
+// 1bpp path: LVGL renders the invalidated areas in bands of up to this many
+// lines into two small buffers; each band is written to its place in
+// controller RAM while the next one renders, and the last band triggers the refresh
+#define GUI_BAND_LINES 40
+
+// 0: glyphs are rasterized on the device from the embedded TTF (ttf_font,
+//    one glyph cache for all sizes in PSRAM)
+// 1: 1bpp bitmap fonts prerasterized on the host (font_related/prerender_font),
+//    same glyphs and metrics as tiny_ttf but nothing to rasterize at runtime.
+//    The font set that is not selected is dropped by the linker.
+#define GUI_FONT_PRERENDERED 1
+#define GUI_GLYPH_CACHE_BUDGET (256 * 1024)
+
+// 1: characters missing from the fonts are fetched from font_related/glyph_server.py
+//    into the "glyphs" partition (partitions.csv). Needs the network up; this
+//    demo does not connect to Wi-Fi by itself (see esp32_s3_wifi).
+#define GUI_GLYPH_FETCH 0
+#define GUI_GLYPH_SERVER_URL "http://192.168.1.10:8000/glyphs"
+
+#define GUI_TASK_STACK_SIZE (24 * 1024)
+
+// Heaps, tags and stack high-water marks are sampled and logged this often
+// (mem_telemetry). With GUI_TELEMETRY_HTTP the last sample is also served at
+// GET /telemetry; like GUI_GLYPH_FETCH that needs the network up.
+#define GUI_TELEMETRY_PERIOD_MS (60 * 1000)
+#define GUI_TELEMETRY_HTTP 0
+
+#if GUI_FONT_PRERENDERED
+LV_FONT_DECLARE(jf_openhuninn_2_1_30);
+LV_FONT_DECLARE(jf_openhuninn_2_1_40);
+LV_FONT_DECLARE(jf_openhuninn_2_1_50);
+#endif
+
+static TaskHandle_t gui_task_handle;
+static volatile bool flush_pending;
+static int64_t refr_start_us;
+static int64_t flush_wait_start_us;
+static int64_t flush_wait_us;
+static volatile bool frame_done;       // Set by the service task, reported by the GUI task
+static int64_t frame_done_us;
+static bool first_frame_done;
+
+// LVGL reads the time when it needs it instead of being ticked every millisecond
+static uint32_t gui_tick_get_cb(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Wakes the GUI task: LVGL has something to do (an object was invalidated or a
+// timer was started) or a glyph fetch finished. Safe from any task.
+static void gui_wake(void *arg)
 {
     (void)arg;
-    lv_tick_inc(1);
+    if (gui_task_handle) {
+        xTaskNotifyGive(gui_task_handle);
+    }
 }
 
-static void my_flush_cb(lv_display_t * display, const lv_area_t * area, uint8_t * px_map)
+// Render time of every refresh. Time spent waiting for a band buffer to be
+// written to the panel is reported separately, the rest is LVGL drawing.
+static void render_timing_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        refr_start_us = now;
+        flush_wait_us = 0;
+        break;
+    case LV_EVENT_FLUSH_WAIT_START:
+        flush_wait_start_us = now;
+        break;
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        flush_wait_us += now - flush_wait_start_us;
+        break;
+    case LV_EVENT_RENDER_READY:
+        ESP_LOGI(TAG, "render %lld ms (%lld ms waiting for band writes), %s fonts",
+                 (now - refr_start_us) / 1000, flush_wait_us / 1000,
+                 GUI_FONT_PRERENDERED ? "prerendered" : "ttf");
+#if !GUI_FONT_PRERENDERED
+        ttf_cache_log_stats();
+#endif
+        break;
+    default:
+        break;
+    }
+}
+
+static void flush_done_cb(esp_err_t result, void *arg)
 {
-    printf("flushing...\n");
-    epd_7in5_v2_display(px_map);
     /* IMPORTANT!!!
-     * Inform LVGL that flushing is complete so buffer can be modified again. */
-    lv_display_flush_ready(display);
+     * Inform LVGL that flushing is complete so buffer can be modified again.
+     * Runs in the display service task once the panel refresh has finished;
+     * its stack is small, so the reports are left to the GUI task. */
+    lv_display_flush_ready((lv_display_t *)arg);
+    frame_done_us = esp_timer_get_time();
+    frame_done = true;
+    flush_pending = false;
+    gui_wake(NULL);
+}
+
+// Called from the GUI task after flush_done_cb()
+static void frame_report(void)
+{
+    if (!first_frame_done) {
+        first_frame_done = true;
+        ESP_LOGI(TAG, "first frame on the panel %lld ms after boot", frame_done_us / 1000);
+        mem_policy_report();    // Placement with the fonts and buffers of a rendered frame
+    }
+    epd_service_trace_dump();
+    epd_7in5_v2_latency_report();
 }
 
+static void band_done_cb(esp_err_t result, void *arg)
+{
+    lv_display_flush_ready((lv_display_t *)arg);
+    flush_pending = false;
+    gui_wake(NULL);
+}
+
+// Replaces LVGL's busy loop on the flushing flag: the GUI task blocks until
+// the service task reports the band (or, after the last one, the panel
+// refresh, which takes seconds) done
+static void flush_wait_cb(lv_display_t * display)
+{
+    (void)display;
+    while (flush_pending) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+static void my_flush_cb(lv_display_t * display, const lv_area_t * area, uint8_t * px_map)
+{
+    bool last = lv_display_flush_is_last(display);
+    epd_7in5_v2_view_t view;
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_I1);
+    esp_err_t err = epd_lvgl_i1_view(px_map, stride, area->x1, area->y1, area->x2, area->y2, &view);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "band %d,%d..%d,%d not written: %s", (int)area->x1, (int)area->y1,
+                 (int)area->x2, (int)area->y2, esp_err_to_name(err));
+        if (!last) {
+            lv_display_flush_ready(display);
+            return;
+        }
+    }
+    if (last) {
+        epd_service_trace_mark("lvgl last band");
+    }
+    flush_pending = true;
+    // Returns right away, LVGL renders the next band into the other buffer.
+    // The frame is refreshed even if its last band was rejected, so the
+    // bands already in controller RAM still reach the panel.
+    if (err != ESP_OK) {
+        epd_service_submit_refresh(flush_done_cb, display, NULL, portMAX_DELAY);
+    } else {
+        epd_service_submit_view(&view, last, last ? flush_done_cb : band_done_cb, display, NULL, portMAX_DELAY);
+    }
+}
+
+#if GUI_RENDER_GRAY4
+static uint8_t *gray4_frame;
+
+static void my_flush_gray4_cb(lv_display_t * display, const lv_area_t * area, uint8_t * px_map)
+{
+    // Keep the top two bits of each L8 pixel: 0 = black .. 3 = white
+    uint8_t *dst = gray4_frame;
+    for (int i = 0; i < EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT; i += 4) {
+        *dst++ = (px_map[i] & 0xC0) | ((px_map[i + 1] & 0xC0) >> 2) |
+                 ((px_map[i + 2] & 0xC0) >> 4) | (px_map[i + 3] >> 6);
+    }
+    epd_service_trace_mark("lvgl flush");
+    flush_pending = true;
+    epd_service_submit_frame(gray4_frame, flush_done_cb, display, NULL, portMAX_DELAY);
+}
+#endif
+
 static void gui_task(void *pvParameter)
 {
+    gui_task_handle = xTaskGetCurrentTaskHandle();
+    lv_timer_handler_set_resume_cb(gui_wake, NULL);
     lv_display_t * display1 = lv_display_create(EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+#if GUI_RENDER_GRAY4
+    lv_display_set_color_format(display1, LV_COLOR_FORMAT_L8);
+    size_t l8_size = EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT;
+    uint8_t *framebuf = mem_alloc(MEM_TAG_FRAME, l8_size);
+    gray4_frame = mem_alloc(MEM_TAG_FRAME, EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT / 4);
+    assert(framebuf && gray4_frame);
+    lv_display_set_buffers(display1, framebuf, NULL, l8_size, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display1, my_flush_gray4_cb);
+#else
     lv_display_set_color_format(display1, LV_COLOR_FORMAT_I1);
-    static uint8_t framebuf[EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT / 8 + 8];
-    lv_display_set_buffers(display1, framebuf, NULL, sizeof(framebuf), LV_DISPLAY_RENDER_MODE_FULL);
+    // Internal RAM the SPI DMA can read, aligned for LVGL (MEM_TAG_DISPLAY_BAND)
+    size_t band_size = EPD_7IN5_V2_WIDTH / 8 * GUI_BAND_LINES + EPD_LVGL_I1_PALETTE_SIZE;
+    uint8_t *band_buf[2] = { mem_alloc(MEM_TAG_DISPLAY_BAND, band_size), mem_alloc(MEM_TAG_DISPLAY_BAND, band_size) };
+    assert(band_buf[0] && band_buf[1]);
+    lv_display_set_buffers(display1, band_buf[0], band_buf[1], band_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
     lv_display_set_flush_cb(display1, my_flush_cb);
-    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_white(), 0);
-    
+#endif
+    lv_display_set_flush_wait_cb(display1, flush_wait_cb);
+    lv_display_add_event_cb(display1, render_timing_cb, LV_EVENT_ALL, NULL);
+
+#if GUI_FONT_PRERENDERED
+    const lv_font_t * font_30 = &jf_openhuninn_2_1_30;
+    const lv_font_t * font_40 = &jf_openhuninn_2_1_40;
+    const lv_font_t * font_50 = &jf_openhuninn_2_1_50;
+    // Glyph bitmaps stay in flash and are read through the cache
+    mem_policy_register_static("font 30 bitmaps", ((const lv_font_fmt_txt_dsc_t *)font_30->dsc)->glyph_bitmap, 0);
+    mem_policy_register_static("font 40 bitmaps", ((const lv_font_fmt_txt_dsc_t *)font_40->dsc)->glyph_bitmap, 0);
+    mem_policy_register_static("font 50 bitmaps", ((const lv_font_fmt_txt_dsc_t *)font_50->dsc)->glyph_bitmap, 0);
+#else
     extern const uint8_t subset_font_subset_jf_openhuninn_2_1_ttf[];
     extern const int subset_font_subset_jf_openhuninn_2_1_ttf_len;
 
-    lv_font_t * font_30 = lv_tiny_ttf_create_data(subset_font_subset_jf_openhuninn_2_1_ttf, subset_font_subset_jf_openhuninn_2_1_ttf_len, 30);
-    lv_font_t * font_40 = lv_tiny_ttf_create_data(subset_font_subset_jf_openhuninn_2_1_ttf, subset_font_subset_jf_openhuninn_2_1_ttf_len, 40);
-    lv_font_t * font_50 = lv_tiny_ttf_create_data(subset_font_subset_jf_openhuninn_2_1_ttf, subset_font_subset_jf_openhuninn_2_1_ttf_len, 50);
+    // The TTF stays in flash; stb_truetype reads the outlines through the cache
+    mem_policy_register_static("font ttf", subset_font_subset_jf_openhuninn_2_1_ttf,
+                               subset_font_subset_jf_openhuninn_2_1_ttf_len);
+    ttf_cache_init(GUI_GLYPH_CACHE_BUDGET);
+    ttf_face_t * face = ttf_face_create(subset_font_subset_jf_openhuninn_2_1_ttf, subset_font_subset_jf_openhuninn_2_1_ttf_len);
+    lv_font_t * font_30 = ttf_font_create(face, 30);
+    lv_font_t * font_40 = ttf_font_create(face, 40);
+    lv_font_t * font_50 = ttf_font_create(face, 50);
+#endif
 
-    lv_obj_t *lab30 = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(lab30, font_30, 0);
-    lv_label_set_text(lab30, "星期一猴子穿新衣");
-    lv_obj_align(lab30, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+#if GUI_GLYPH_FETCH
+    const glyph_fetch_config_t fetch_conf = { .url = GUI_GLYPH_SERVER_URL, .on_done = gui_wake };
+    if (glyph_fetch_init(&fetch_conf) == ESP_OK) {
+        font_30 = glyph_fetch_font_create(font_30, 30);
+        font_40 = glyph_fetch_font_create(font_40, 40);
+        font_50 = glyph_fetch_font_create(font_50, 50);
+    }
+#endif
 
-    lv_obj_t *lab40 = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(lab40, font_40, 0);
-    lv_label_set_text(lab40, "星期一猴子穿新衣");
-    lv_obj_align(lab40, LV_ALIGN_OUT_BOTTOM_MID, 0, 30);
+    epd_service_trace_mark("fonts ready");
 
-    lv_obj_t *lab50 = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(lab50, font_50, 0);
-    lv_label_set_text(lab50, "星期一猴子穿新衣");
-    lv_obj_align(lab50, LV_ALIGN_OUT_BOTTOM_MID, 0, 100);
+    const gui_fonts_t fonts = { .large = font_50, .medium = font_40, .small = font_30 };
+    gui_ui_create(lv_screen_active(), &fonts);
+    // Sample day until the calendar is synced
+    static const gui_event_t events[] = {
+        { "", "星期一猴子穿新衣" },
+        { "09:00", "星期一猴子穿新衣" },
+    };
+    const gui_day_t day = { .year = 2025, .month = 1, .day = 6, .weekday = 1,
+                            .events = events, .event_count = 2 };
+    gui_ui_show_day(&day);
 
     while (1) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // Before rendering, so no later frame is on its way to the panel yet
+        if (frame_done) {
+            frame_done = false;
+            frame_report();
+        }
+        uint32_t wait_ms = lv_timer_handler();
+#if GUI_GLYPH_FETCH
+        glyph_fetch_poll();
+#endif
+        // Sleep until the next LVGL timer is due or gui_wake(). The display
+        // refresh timer pauses itself when nothing is invalid, so between
+        // updates this blocks indefinitely and the chip can light sleep.
+        ulTaskNotifyTake(pdTRUE, wait_ms == LV_NO_TIMER_READY ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms) + 1);
     }
 }
 
 void app_main(void)
 {
+#if CONFIG_PM_ENABLE
+    // Automatic light sleep whenever every task is blocked (needs
+    // CONFIG_FREERTOS_USE_TICKLESS_IDLE, see sdkconfig.defaults)
+    const esp_pm_config_t pm_conf = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = 40,
+        .light_sleep_enable = true,
+    };
+    ESP_ERROR_CHECK(esp_pm_configure(&pm_conf));
+#endif
     lv_init();
-    esp_timer_handle_t tick_timer;
-    const esp_timer_create_args_t tick_conf = {
-        .callback = lv_tick_cb, .name = "lv_tick"};
-    esp_timer_create(&tick_conf, &tick_timer);
-    esp_timer_start_periodic(tick_timer, 1000);
+    lv_tick_set_cb(gui_tick_get_cb);
     device_init();
-    epd_7in5_v2_init();
+    ESP_ERROR_CHECK(epd_service_start());
+    // Panel reset and power-on run in the service task while LVGL builds the UI
+#if GUI_RENDER_GRAY4
+    epd_service_submit_init(EPD_7IN5_V2_MODE_4GRAY, NULL, NULL, NULL, portMAX_DELAY);
+#else
+    epd_service_submit_init(EPD_7IN5_V2_MODE_FULL, NULL, NULL, NULL, portMAX_DELAY);
+#endif
 
     xTaskCreatePinnedToCore(gui_task,       // 任務函式
         "gui",          // 名稱
-        24*1024,          // stack 大小 (byte)
+        GUI_TASK_STACK_SIZE,    // stack 大小 (byte)
         NULL,           // 參數
         4,              // priority
         NULL,           // handle
         APP_CPU_NUM);   // 建議跑 APP core
 
-    while (1) {
-        printf("hello main task\n");
-        vTaskDelay(pdMS_TO_TICKS(1000));  // 10 ms
+    mem_telemetry_watch_task("gui", GUI_TASK_STACK_SIZE);
+    mem_telemetry_watch_task("epd_service", EPD_SERVICE_STACK_SIZE);
+#if GUI_GLYPH_FETCH
+    mem_telemetry_watch_task("glyph_fetch", GLYPH_FETCH_STACK_SIZE);
+#endif
+    ESP_ERROR_CHECK(mem_telemetry_start(GUI_TELEMETRY_PERIOD_MS));
+#if GUI_TELEMETRY_HTTP
+    httpd_handle_t server = NULL;
+    httpd_config_t httpd_conf = HTTPD_DEFAULT_CONFIG();
+    if (httpd_start(&server, &httpd_conf) == ESP_OK) {
+        mem_telemetry_register_http(server);
+    } else {
+        ESP_LOGW(TAG, "HTTP server not started, telemetry is only logged");
     }
+#endif
 }
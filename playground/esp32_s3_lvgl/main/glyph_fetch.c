@@ -0,0 +1,520 @@
+#include "glyph_fetch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_partition.h"
+#include "esp_http_client.h"
+#include "mem_policy.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "glyph_fetch";
+
+#define STORE_MAGIC         0x46594C47  // "GLYF"
+#define STORE_VERSION       1
+#define STORE_HEADER_SIZE   8
+#define RECORD_END          0xFFFFFFFF  // erased flash
+#define MAX_RESPONSE        (64 * 1024)
+#define MAX_REQUEST         (GLYPH_FETCH_MAX_BATCH * 8 + 64)
+#define MAX_UNAVAILABLE     128
+#define HTTP_TIMEOUT_MS     10000
+#define MAX_CODEPOINT       0xFFFF      // prerender_font rasterizes the BMP only
+
+typedef struct __attribute__((packed)) {
+    uint32_t codepoint;
+    uint8_t px;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t check;
+    uint16_t adv_w;
+} glyph_record_t;
+
+_Static_assert(sizeof(glyph_record_t) == 12, "glyph_record_t must match the wire format");
+
+// Sorted by key: size in the top byte, codepoint below
+typedef struct {
+    uint32_t key;
+    uint32_t offset;
+} index_entry_t;
+
+typedef enum {
+    FETCH_IDLE,
+    FETCH_BUSY,     // the fetch task owns the batch and the unused part of the partition
+    FETCH_DONE,
+} fetch_state_t;
+
+static const esp_partition_t *s_part;
+static const uint8_t *s_map;
+static esp_partition_mmap_handle_t s_map_handle;
+static uint32_t s_write_ofs;
+static bool s_reset_store;
+static const char *s_url;
+static void (*s_on_done)(void *arg);
+static void *s_on_done_arg;
+static TaskHandle_t s_task;
+static mem_arena_t s_scratch;   // request and response of one batch, owned by the fetch task
+
+static index_entry_t *s_index;
+static uint32_t s_index_count;
+static uint32_t s_index_cap;
+
+static uint32_t s_pending[GLYPH_FETCH_MAX_BATCH];
+static int s_pending_count;
+static uint32_t s_unavailable[MAX_UNAVAILABLE];
+static int s_unavailable_count;
+
+static volatile fetch_state_t s_state = FETCH_IDLE;
+static uint32_t s_batch[GLYPH_FETCH_MAX_BATCH];
+static uint32_t s_batch_offset[GLYPH_FETCH_MAX_BATCH];    // 0: not returned
+static int s_batch_count;
+static bool s_batch_ok;
+
+static inline uint32_t key_of(uint8_t px, uint32_t codepoint)
+{
+    return ((uint32_t)px << 24) | (codepoint & 0xFFFFFF);
+}
+
+static inline size_t record_size(const glyph_record_t *r)
+{
+    size_t bits = ((size_t)r->box_w * r->box_h + 7) / 8;
+    return (sizeof(glyph_record_t) + bits + 3) & ~(size_t)3;
+}
+
+static bool record_valid(const glyph_record_t *r, const uint8_t *bitmap)
+{
+    if (r->codepoint == RECORD_END || r->codepoint > 0x10FFFF || r->px == 0) {
+        return false;
+    }
+    uint8_t check = 0;
+    for (size_t i = 0; i < ((size_t)r->box_w * r->box_h + 7) / 8; i++) {
+        check ^= bitmap[i];
+    }
+    return check == r->check;
+}
+
+static bool contains(const uint32_t *keys, int count, uint32_t key)
+{
+    for (int i = 0; i < count; i++) {
+        if (keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t index_find(uint32_t key)
+{
+    uint32_t lo = 0, hi = s_index_count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (s_index[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void index_insert(uint32_t key, uint32_t offset)
+{
+    uint32_t i = index_find(key);
+    if (i < s_index_count && s_index[i].key == key) {
+        s_index[i].offset = offset;     // a later record replaces an earlier one
+        return;
+    }
+    if (s_index_count == s_index_cap) {
+        uint32_t cap = s_index_cap ? s_index_cap * 2 : 256;
+        index_entry_t *grown = mem_realloc(MEM_TAG_DEFAULT, s_index, cap * sizeof(index_entry_t));
+        if (grown == NULL) {
+            ESP_LOGE(TAG, "Out of memory for the glyph index");
+            return;
+        }
+        s_index = grown;
+        s_index_cap = cap;
+    }
+    memmove(&s_index[i + 1], &s_index[i], (s_index_count - i) * sizeof(index_entry_t));
+    s_index[i].key = key;
+    s_index[i].offset = offset;
+    s_index_count++;
+}
+
+static const glyph_record_t *lookup(uint8_t px, uint32_t codepoint)
+{
+    uint32_t key = key_of(px, codepoint);
+    uint32_t i = index_find(key);
+    if (i < s_index_count && s_index[i].key == key) {
+        return (const glyph_record_t *)(s_map + s_index[i].offset);
+    }
+    return NULL;
+}
+
+// Indexes the records written by earlier boots. A record torn by a reset
+// ends the log; the partition is erased before the next glyphs are stored.
+static void load_index(void)
+{
+    const uint32_t header[2] = { STORE_MAGIC, STORE_VERSION };
+    if (memcmp(s_map, header, sizeof(header)) != 0) {
+        s_reset_store = true;
+        return;
+    }
+    uint32_t ofs = STORE_HEADER_SIZE;
+    while (ofs + sizeof(glyph_record_t) <= s_part->size) {
+        const glyph_record_t *r = (const glyph_record_t *)(s_map + ofs);
+        if (r->codepoint == RECORD_END) {
+            break;
+        }
+        size_t size = record_size(r);
+        if (ofs + size > s_part->size || !record_valid(r, (const uint8_t *)(r + 1))) {
+            ESP_LOGW(TAG, "Damaged glyph record at 0x%lx, the store will be rebuilt", (unsigned long)ofs);
+            s_reset_store = true;
+            ofs = s_part->size;
+            break;
+        }
+        index_insert(key_of(r->px, r->codepoint), ofs);
+        ofs += size;
+    }
+    s_write_ofs = ofs;
+}
+
+// ---------------------------------------------------------------------------
+// Fetch task
+
+static esp_err_t reset_store(void)
+{
+    // Unknown content: erase everything, otherwise only what was written
+    uint32_t len = s_write_ofs > STORE_HEADER_SIZE ? s_write_ofs : s_part->size;
+    len = (len + s_part->erase_size - 1) / s_part->erase_size * s_part->erase_size;
+    if (len > s_part->size) {
+        len = s_part->size;
+    }
+    esp_err_t err = esp_partition_erase_range(s_part, 0, len);
+    if (err == ESP_OK) {
+        const uint32_t header[2] = { STORE_MAGIC, STORE_VERSION };
+        err = esp_partition_write(s_part, 0, header, sizeof(header));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Resetting the glyph store failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    s_write_ofs = STORE_HEADER_SIZE;
+    s_reset_store = false;
+    ESP_LOGI(TAG, "Glyph store reset (%lu KB erased)", (unsigned long)(len / 1024));
+    return ESP_OK;
+}
+
+static int compare_keys(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// "<px> <hex cp> ..." per size; the batch is sorted so sizes are grouped
+static int build_request(char *body, size_t cap)
+{
+    int len = 0;
+    for (int i = 0; i < s_batch_count && len < (int)cap; i++) {
+        uint32_t px = s_batch[i] >> 24;
+        if (i == 0 || px != s_batch[i - 1] >> 24) {
+            len += snprintf(body + len, cap - len, "%s%lu", i ? "\n" : "", (unsigned long)px);
+        }
+        if (len < (int)cap) {
+            len += snprintf(body + len, cap - len, " %lx", (unsigned long)(s_batch[i] & 0xFFFFFF));
+        }
+    }
+    if (len < (int)cap) {
+        len += snprintf(body + len, cap - len, "\n");
+    }
+    return len < (int)cap ? len : -1;
+}
+
+static int http_post(const char *body, int body_len, uint8_t *resp, int cap)
+{
+    esp_http_client_config_t config = {
+        .url = s_url,
+        .method = HTTP_METHOD_POST,
+        .timeout_ms = HTTP_TIMEOUT_MS,
+    };
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == NULL) {
+        return -1;
+    }
+    int len = -1;
+    esp_http_client_set_header(client, "Content-Type", "text/plain");
+    esp_err_t err = esp_http_client_open(client, body_len);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Cannot reach %s: %s", s_url, esp_err_to_name(err));
+        goto done;
+    }
+    if (esp_http_client_write(client, body, body_len) != body_len) {
+        ESP_LOGW(TAG, "Sending the request failed");
+        goto done;
+    }
+    esp_http_client_fetch_headers(client);
+    int status = esp_http_client_get_status_code(client);
+    if (status >= 400 && status < 500) {
+        // Asking again would be refused again; an empty answer marks the
+        // whole batch unavailable
+        ESP_LOGW(TAG, "Glyph server refused the request (%d)", status);
+        len = 0;
+        goto done;
+    }
+    if (status != 200) {
+        ESP_LOGW(TAG, "Glyph server answered %d", status);
+        goto done;
+    }
+    len = 0;
+    while (len < cap) {
+        int n = esp_http_client_read(client, (char *)resp + len, cap - len);
+        if (n < 0) {
+            ESP_LOGW(TAG, "Reading the response failed");
+            len = -1;
+            break;
+        }
+        if (n == 0) {
+            break;
+        }
+        len += n;
+    }
+done:
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+    return len;
+}
+
+// Appends the records of the batch to the partition and notes where they went
+static int store_records(const uint8_t *data, int len)
+{
+    int added = 0;
+    int pos = 0;
+    while (pos + (int)sizeof(glyph_record_t) <= len) {
+        glyph_record_t r;
+        memcpy(&r, data + pos, sizeof(r));
+        int size = (int)record_size(&r);
+        if (pos + size > len || !record_valid(&r, data + pos + sizeof(r))) {
+            ESP_LOGW(TAG, "Malformed glyph record in the response");
+            break;
+        }
+        uint32_t key = key_of(r.px, r.codepoint);
+        for (int i = 0; i < s_batch_count; i++) {
+            if (s_batch[i] != key || s_batch_offset[i]) {
+                continue;
+            }
+            if (s_write_ofs + size > s_part->size) {
+                ESP_LOGW(TAG, "Glyph store full");
+                return added;
+            }
+            esp_err_t err = esp_partition_write(s_part, s_write_ofs, data + pos, size);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Writing a glyph failed: %s", esp_err_to_name(err));
+                return added;
+            }
+            s_batch_offset[i] = s_write_ofs;
+            s_write_ofs += size;
+            added++;
+            break;
+        }
+        pos += size;
+    }
+    return added;
+}
+
+static void fetch_batch(void)
+{
+    memset(s_batch_offset, 0, sizeof(s_batch_offset));
+    s_batch_ok = false;
+
+    mem_arena_reset(&s_scratch);
+    char *body = mem_arena_alloc(&s_scratch, MAX_REQUEST, 1);
+    uint8_t *resp = mem_arena_alloc(&s_scratch, MAX_RESPONSE, 4);
+    int body_len = body ? build_request(body, MAX_REQUEST) : -1;
+    if (body_len < 0 || resp == NULL) {
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    int len = http_post(body, body_len, resp, MAX_RESPONSE);
+    if (len >= 0 && (!s_reset_store || reset_store() == ESP_OK)) {
+        int added = store_records(resp, len);
+        s_batch_ok = true;
+        ESP_LOGI(TAG, "%d of %d glyphs fetched (%d bytes) in %lld ms, store %lu/%lu KB",
+                 added, s_batch_count, len, (esp_timer_get_time() - start) / 1000,
+                 (unsigned long)(s_write_ofs / 1024), (unsigned long)(s_part->size / 1024));
+    }
+}
+
+static void fetch_task(void *arg)
+{
+    (void)arg;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        fetch_batch();
+        s_state = FETCH_DONE;
+        if (s_on_done) {
+            s_on_done(s_on_done_arg);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// LVGL font
+
+static void note_missing(uint32_t key)
+{
+    if (contains(s_pending, s_pending_count, key) || contains(s_unavailable, s_unavailable_count, key) ||
+        (s_state != FETCH_IDLE && contains(s_batch, s_batch_count, key))) {
+        return;
+    }
+    if (s_pending_count < GLYPH_FETCH_MAX_BATCH) {
+        s_pending[s_pending_count++] = key;
+    }
+}
+
+static bool get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                             uint32_t letter_next)
+{
+    LV_UNUSED(letter_next);
+    uint8_t px = (uint8_t)(uintptr_t)font->dsc;
+    if (s_task == NULL || letter < 0x20 || letter > MAX_CODEPOINT) {
+        return false;
+    }
+    const glyph_record_t *r = lookup(px, letter);
+    if (r == NULL) {
+        note_missing(key_of(px, letter));
+        return false;
+    }
+    dsc_out->adv_w = r->adv_w;
+    dsc_out->box_w = r->box_w;
+    dsc_out->box_h = r->box_h;
+    dsc_out->ofs_x = r->ofs_x;
+    dsc_out->ofs_y = r->ofs_y;
+    dsc_out->format = LV_FONT_GLYPH_FORMAT_A1;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = (uint32_t)((const uint8_t *)r - s_map);
+    return true;
+}
+
+// Expanded to A8 the same way lv_font_fmt_txt draws 1bpp fonts
+static const void *get_glyph_bitmap_cb(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf)
+{
+    const glyph_record_t *r = (const glyph_record_t *)(s_map + g_dsc->gid.index);
+    if (r->box_w == 0 || r->box_h == 0) {
+        return NULL;
+    }
+    const uint8_t *in = (const uint8_t *)(r + 1);
+    uint8_t *out = draw_buf->data;
+    uint32_t stride = lv_draw_buf_width_to_stride(r->box_w, LV_COLOR_FORMAT_A8);
+    uint32_t bit = 0;
+    for (int y = 0; y < r->box_h; y++) {
+        for (int x = 0; x < r->box_w; x++, bit++) {
+            out[x] = in[bit >> 3] & (0x80 >> (bit & 7)) ? 0xFF : 0x00;
+        }
+        out += stride;
+    }
+    return draw_buf;
+}
+
+lv_font_t *glyph_fetch_font_create(const lv_font_t *base, int32_t px)
+{
+    if (base == NULL || px <= 0 || px > 255) {
+        return NULL;
+    }
+    lv_font_t *font = calloc(2, sizeof(lv_font_t));
+    if (font == NULL) {
+        return NULL;
+    }
+    lv_font_t *fetched = font + 1;
+    *font = *base;
+    font->fallback = fetched;
+
+    fetched->get_glyph_dsc = get_glyph_dsc_cb;
+    fetched->get_glyph_bitmap = get_glyph_bitmap_cb;
+    fetched->line_height = base->line_height;
+    fetched->base_line = base->base_line;
+    fetched->subpx = LV_FONT_SUBPX_NONE;
+    fetched->underline_position = base->underline_position;
+    fetched->underline_thickness = base->underline_thickness;
+    fetched->dsc = (const void *)(uintptr_t)px;
+    fetched->fallback = base->fallback;
+    return font;
+}
+
+bool glyph_fetch_poll(void)
+{
+    if (s_task == NULL) {
+        return false;
+    }
+    bool refreshed = false;
+    if (s_state == FETCH_DONE) {
+        int added = 0;
+        for (int i = 0; i < s_batch_count; i++) {
+            if (s_batch_offset[i]) {
+                index_insert(s_batch[i], s_batch_offset[i]);
+                added++;
+            } else if (s_batch_ok && s_unavailable_count < MAX_UNAVAILABLE) {
+                // Not on the server; a failed request is retried instead
+                s_unavailable[s_unavailable_count++] = s_batch[i];
+            }
+        }
+        s_state = FETCH_IDLE;
+        if (added) {
+            // Labels measure their text again and the screen is redrawn once
+            lv_obj_report_style_change(NULL);
+            refreshed = true;
+        }
+    }
+    if (s_state == FETCH_IDLE && s_pending_count > 0) {
+        memcpy(s_batch, s_pending, s_pending_count * sizeof(uint32_t));
+        s_batch_count = s_pending_count;
+        s_pending_count = 0;
+        qsort(s_batch, s_batch_count, sizeof(uint32_t), compare_keys);
+        if (s_write_ofs + MAX_RESPONSE > s_part->size) {
+            // Full: nothing on screen refers to the store between renders,
+            // so it can be emptied before the fetch task erases it
+            s_index_count = 0;
+            s_reset_store = true;
+        }
+        s_state = FETCH_BUSY;
+        xTaskNotifyGive(s_task);
+    }
+    return refreshed;
+}
+
+esp_err_t glyph_fetch_init(const glyph_fetch_config_t *config)
+{
+    if (config == NULL || config->url == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const char *label = config->partition_label ? config->partition_label : GLYPH_FETCH_PARTITION;
+    s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (s_part == NULL) {
+        ESP_LOGE(TAG, "No \"%s\" partition", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    esp_err_t err = esp_partition_mmap(s_part, 0, s_part->size, ESP_PARTITION_MMAP_DATA,
+                                       (const void **)&s_map, &s_map_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Mapping the glyph partition failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    s_url = config->url;
+    s_on_done = config->on_done;
+    s_on_done_arg = config->arg;
+    // Kept for every batch instead of 64 KB from the heap each time
+    err = mem_arena_init(&s_scratch, "glyph_fetch http", MEM_TAG_HTTP, MAX_REQUEST + 4 + MAX_RESPONSE);
+    if (err != ESP_OK) {
+        esp_partition_munmap(s_map_handle);
+        return err;
+    }
+    load_index();
+    if (xTaskCreate(fetch_task, "glyph_fetch", GLYPH_FETCH_STACK_SIZE, NULL, 2, &s_task) != pdPASS) {
+        esp_partition_munmap(s_map_handle);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "%lu glyphs in flash, %lu/%lu KB used", (unsigned long)s_index_count,
+             (unsigned long)(s_write_ofs / 1024), (unsigned long)(s_part->size / 1024));
+    return ESP_OK;
+}
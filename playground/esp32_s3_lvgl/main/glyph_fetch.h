@@ -0,0 +1,63 @@
+#ifndef _GLYPH_FETCH_H_
+#define _GLYPH_FETCH_H_
+
+// Glyphs missing from the embedded fonts, fetched from a glyph server on the
+// local network (font_related/glyph_server.py) and kept in a flash partition,
+// so characters that were not in the subset at build time still render.
+//
+// A font made by glyph_fetch_font_create() falls back to the stored glyphs.
+// Characters found in neither are collected while LVGL lays out and draws.
+// glyph_fetch_poll() sends them to the server in one request from a
+// background task, and once the glyphs are stored it refreshes every object
+// so the screen is rendered once more with them. Characters the server does
+// not have are not asked for again until reboot.
+//
+// Wire format:
+//   request:  POST <url>, text body, one line per size: "<px> <hex cp> <hex cp> ..."
+//   response: glyph records exactly as stored in flash, in any order
+//
+// Record (little endian, 4 byte aligned):
+//   uint32 codepoint, uint8 px, uint8 box_w, uint8 box_h, int8 ofs_x, int8 ofs_y,
+//   uint8 check (XOR of the bitmap bytes), uint16 adv_w (px),
+//   then box_w * box_h bits, MSB first, rows not padded (as lv_font_fmt_txt 1bpp),
+//   then zeros up to a multiple of 4 bytes
+//
+// Not thread safe: create fonts and poll from the LVGL task only.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#define GLYPH_FETCH_PARTITION   "glyphs"
+// Characters per request; more are asked for after the next render
+#define GLYPH_FETCH_MAX_BATCH   64
+#define GLYPH_FETCH_STACK_SIZE  (6 * 1024)
+
+typedef struct {
+    const char *url;                // e.g. "http://192.168.1.10:8000/glyphs"
+    const char *partition_label;    // NULL: GLYPH_FETCH_PARTITION
+    // Called from the fetch task when a request has finished and
+    // glyph_fetch_poll() has a result to apply; may be NULL if the LVGL task polls anyway
+    void (*on_done)(void *arg);
+    void *arg;
+} glyph_fetch_config_t;
+
+/**
+ * Maps the partition, indexes the glyphs stored by earlier boots and starts
+ * the fetch task. The network has to be up before the first glyph_fetch_poll()
+ * that finds missing characters; a failed request is retried after the next render.
+ */
+esp_err_t glyph_fetch_init(const glyph_fetch_config_t *config);
+
+// A copy of base that falls back to the fetched glyphs of size px
+lv_font_t *glyph_fetch_font_create(const lv_font_t *base, int32_t px);
+
+/**
+ * Call from the LVGL task after lv_timer_handler(). Starts a request for the
+ * characters missing in the last render and applies the result of the previous
+ * one. Returns true if glyphs were added and the screen was refreshed.
+ */
+bool glyph_fetch_poll(void);
+
+#endif
@@ -0,0 +1,374 @@
+#include "gui_month.h"
+#include <string.h>
+#include "mem_policy.h"
+#include "src/misc/lv_area_private.h"
+
+#define COLS            7
+#define ROWS            6
+#define PAD             6
+#define MARKER_HEIGHT   4
+#define MARKER_GAP      3
+#define I1_PALETTE_SIZE 8
+
+// Cell content, compared to find the cells to redraw
+#define CELL_DAY(c)     ((c) & 0xFF)
+#define CELL_MARKERS(c) (((c) >> 8) & 0x7F)
+#define CELL_TODAY      0x8000
+
+typedef struct {
+    uint8_t *bits;              // box_w x box_h, rows padded to bytes, bit set = ink
+    uint8_t stride;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t adv_w;
+} digit_t;
+
+typedef struct {
+    lv_draw_buf_t image;        // the whole grid, I1 with palette, bit set = white
+    uint8_t *image_data;
+    int32_t cell_w;
+    int32_t cell_h;
+    uint16_t cells[COLS * ROWS];
+    digit_t digits[10];
+    uint8_t *digit_bits;
+    int32_t line_height;
+    int32_t base_line;
+} month_grid_t;
+
+static int day_of_week(int y, int m, int d)
+{
+    static const int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    if (m < 3) {
+        y--;
+    }
+    return (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
+}
+
+static int days_in_month(int y, int m)
+{
+    static const uint8_t days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return m == 2 && leap ? 29 : days[m - 1];
+}
+
+// ---------------------------------------------------------------------------
+// Bit spans, MSB first like the panel and lv_font_fmt_txt
+
+static inline void apply_mask(uint8_t *p, uint8_t mask, bool white)
+{
+    *p = white ? (*p | mask) : (*p & ~mask);
+}
+
+// Pixels x0..x1 of a row to white or black
+static void fill_span(uint8_t *row, int32_t x0, int32_t x1, bool white)
+{
+    int32_t b0 = x0 >> 3, b1 = x1 >> 3;
+    uint8_t m0 = 0xFF >> (x0 & 7);
+    uint8_t m1 = 0xFF << (7 - (x1 & 7));
+    if (b0 == b1) {
+        apply_mask(&row[b0], m0 & m1, white);
+        return;
+    }
+    apply_mask(&row[b0], m0, white);
+    memset(&row[b0 + 1], white ? 0xFF : 0x00, b1 - b0 - 1);
+    apply_mask(&row[b1], m1, white);
+}
+
+// Paints the set bits of n source pixels at x; bits past n must be zero
+static void blit_span(uint8_t *row, int32_t x, const uint8_t *bits, int32_t n, bool white)
+{
+    int shift = x & 7;
+    uint8_t *dst = &row[x >> 3];
+    for (int32_t i = 0; i < (n + 7) >> 3; i++) {
+        uint16_t v = (uint16_t)(bits[i] << (8 - shift));
+        // Only touch bytes with ink so the last one never runs past the row
+        if (v >> 8) {
+            apply_mask(&dst[i], v >> 8, white);
+        }
+        if (v & 0xFF) {
+            apply_mask(&dst[i + 1], v & 0xFF, white);
+        }
+    }
+}
+
+// Copies n pixels from src at bit sx to dst at bit dx
+static void copy_span(uint8_t *dst, int32_t dx, const uint8_t *src, int32_t sx, int32_t n)
+{
+    if (((dx ^ sx) & 7) == 0) {
+        int32_t head = (8 - (dx & 7)) & 7;
+        if (head > n) {
+            head = n;
+        }
+        for (int32_t i = 0; i < head; i++, dx++, sx++, n--) {
+            uint8_t bit = 0x80 >> (dx & 7);
+            apply_mask(&dst[dx >> 3], bit, src[sx >> 3] & (0x80 >> (sx & 7)));
+        }
+        memcpy(&dst[dx >> 3], &src[sx >> 3], n >> 3);
+        dx += n & ~7;
+        sx += n & ~7;
+        n &= 7;
+    }
+    for (int32_t i = 0; i < n; i++, dx++, sx++) {
+        uint8_t bit = 0x80 >> (dx & 7);
+        apply_mask(&dst[dx >> 3], bit, src[sx >> 3] & (0x80 >> (sx & 7)));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Digit atlas
+
+const lv_font_t *gui_month_digit_font(const lv_font_t *font)
+{
+    lv_font_glyph_dsc_t dsc;
+    for (uint32_t c = '0'; c <= '9'; c++) {
+        if (!lv_font_get_glyph_dsc(font, &dsc, c, 0)) {
+            return LV_FONT_DEFAULT;
+        }
+    }
+    return font;
+}
+
+// Rasterizes 0-9 once into 1bpp; anti-aliased fonts are thresholded at 50%
+static bool atlas_create(month_grid_t *grid, const lv_font_t *font)
+{
+    lv_font_glyph_dsc_t dsc[10];
+    size_t size = 0;
+    for (int d = 0; d < 10; d++) {
+        lv_font_get_glyph_dsc(font, &dsc[d], '0' + d, 0);
+        size += (dsc[d].box_w + 7) / 8 * dsc[d].box_h;
+    }
+    grid->digit_bits = mem_calloc(MEM_TAG_DEFAULT, 1, size ? size : 1);
+    if (grid->digit_bits == NULL) {
+        return false;
+    }
+    grid->line_height = font->line_height;
+    grid->base_line = font->base_line;
+
+    uint8_t *bits = grid->digit_bits;
+    for (int d = 0; d < 10; d++) {
+        digit_t *digit = &grid->digits[d];
+        *digit = (digit_t) {
+            .bits = bits, .stride = (dsc[d].box_w + 7) / 8,
+            .box_w = dsc[d].box_w, .box_h = dsc[d].box_h,
+            .ofs_x = dsc[d].ofs_x, .ofs_y = dsc[d].ofs_y, .adv_w = dsc[d].adv_w,
+        };
+        bits += digit->stride * digit->box_h;
+        if (digit->box_w == 0 || digit->box_h == 0) {
+            continue;
+        }
+        lv_draw_buf_t *a8 = lv_draw_buf_create(digit->box_w, digit->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+        if (a8 == NULL) {
+            return false;
+        }
+        const lv_draw_buf_t *glyph = lv_font_get_glyph_bitmap(&dsc[d], a8);
+        if (glyph) {
+            for (int32_t y = 0; y < digit->box_h; y++) {
+                const uint8_t *src = glyph->data + y * glyph->header.stride;
+                for (int32_t x = 0; x < digit->box_w; x++) {
+                    if (src[x] >= 0x80) {
+                        digit->bits[y * digit->stride + x / 8] |= 0x80 >> (x % 8);
+                    }
+                }
+            }
+        }
+        lv_font_glyph_release_draw_data(&dsc[d]);
+        lv_draw_buf_destroy(a8);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Cells
+
+static uint8_t *image_row(const month_grid_t *grid, int32_t y)
+{
+    return lv_draw_buf_goto_xy(&grid->image, 0, y);
+}
+
+static void cell_area(const month_grid_t *grid, int i, lv_area_t *area)
+{
+    // Inside the grid lines
+    area->x1 = (i % COLS) * grid->cell_w + 1;
+    area->y1 = (i / COLS) * grid->cell_h + 1;
+    area->x2 = area->x1 + grid->cell_w - 2;
+    area->y2 = area->y1 + grid->cell_h - 2;
+}
+
+static void draw_digit(month_grid_t *grid, const lv_area_t *cell, int32_t x, int d, bool white)
+{
+    const digit_t *digit = &grid->digits[d];
+    int32_t w = digit->box_w;
+    int32_t x0 = x + digit->ofs_x;
+    int32_t y0 = cell->y1 + PAD + grid->line_height - grid->base_line - digit->box_h - digit->ofs_y;
+    if (x0 < cell->x1 || x0 + w - 1 > cell->x2) {
+        return;
+    }
+    for (int32_t y = 0; y < digit->box_h; y++) {
+        if (y0 + y >= cell->y1 && y0 + y <= cell->y2) {
+            blit_span(image_row(grid, y0 + y), x0, &digit->bits[y * digit->stride], w, white);
+        }
+    }
+}
+
+static void draw_cell(month_grid_t *grid, int i, uint16_t cell)
+{
+    lv_area_t a;
+    cell_area(grid, i, &a);
+    bool today = cell & CELL_TODAY;
+    for (int32_t y = a.y1; y <= a.y2; y++) {
+        fill_span(image_row(grid, y), a.x1, a.x2, !today);
+    }
+
+    int day = CELL_DAY(cell);
+    if (day) {
+        int32_t x = a.x1 + PAD;
+        if (day >= 10) {
+            draw_digit(grid, &a, x, day / 10, today);
+            x += grid->digits[day / 10].adv_w;
+        }
+        draw_digit(grid, &a, x, day % 10, today);
+    }
+
+    // Bars stacked up from the bottom of the cell
+    int32_t y2 = a.y2 - PAD;
+    for (int m = 0; m < CELL_MARKERS(cell); m++) {
+        int32_t y1 = y2 - MARKER_HEIGHT + 1;
+        if (y1 < a.y1 + PAD + grid->line_height) {
+            break;
+        }
+        for (int32_t y = y1; y <= y2; y++) {
+            fill_span(image_row(grid, y), a.x1 + PAD, a.x2 - PAD, today);
+        }
+        y2 = y1 - MARKER_GAP - 1;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Widget
+
+static void draw_event_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    month_grid_t *grid = lv_obj_get_user_data(obj);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    if (layer->draw_buf == NULL || layer->draw_buf->header.cf != LV_COLOR_FORMAT_I1) {
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = &grid->image;
+        lv_draw_image(layer, &dsc, &coords);
+        return;
+    }
+
+    lv_area_t clip;
+    if (!lv_area_intersect(&clip, &layer->_clip_area, &coords)) {
+        return;
+    }
+    // Let what is already queued (e.g. the background) land first, as
+    // lv_refr does before flushing, so it cannot paint over the rows
+    while (layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+    int32_t n = lv_area_get_width(&clip);
+    for (int32_t y = clip.y1; y <= clip.y2; y++) {
+        uint8_t *dst = lv_draw_buf_goto_xy(layer->draw_buf, 0, y - layer->buf_area.y1);
+        copy_span(dst, clip.x1 - layer->buf_area.x1, image_row(grid, y - coords.y1), clip.x1 - coords.x1, n);
+    }
+}
+
+static void cover_check_cb(lv_event_t *e)
+{
+    // Every pixel of the grid is drawn, so LVGL can skip what is below it.
+    // The base class would say "not covered" as the object has no background:
+    // answer before it and stop there (the result starts as covered).
+    lv_area_t coords;
+    lv_obj_get_coords(lv_event_get_target(e), &coords);
+    if (lv_area_is_in(lv_event_get_cover_area(e), &coords, 0)) {
+        lv_event_stop_processing(e);
+    }
+}
+
+static void delete_event_cb(lv_event_t *e)
+{
+    month_grid_t *grid = lv_obj_get_user_data(lv_event_get_target(e));
+    mem_free(MEM_TAG_IMAGE, grid->image_data);
+    mem_free(MEM_TAG_DEFAULT, grid->digit_bits);
+    mem_free(MEM_TAG_DEFAULT, grid);
+}
+
+lv_obj_t *gui_month_create(lv_obj_t *parent, int32_t width, int32_t height, const lv_font_t *font)
+{
+    month_grid_t *grid = mem_calloc(MEM_TAG_DEFAULT, 1, sizeof(month_grid_t));
+    if (grid == NULL) {
+        return NULL;
+    }
+    grid->cell_w = (width - 1) / COLS;
+    grid->cell_h = (height - 1) / ROWS;
+    width = grid->cell_w * COLS + 1;
+    height = grid->cell_h * ROWS + 1;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_I1);
+    uint32_t size = I1_PALETTE_SIZE + stride * height;
+    grid->image_data = mem_alloc(MEM_TAG_IMAGE, size);
+    if (grid->image_data == NULL || !atlas_create(grid, gui_month_digit_font(font))) {
+        mem_free(MEM_TAG_IMAGE, grid->image_data);
+        mem_free(MEM_TAG_DEFAULT, grid->digit_bits);
+        mem_free(MEM_TAG_DEFAULT, grid);
+        return NULL;
+    }
+    lv_draw_buf_init(&grid->image, width, height, LV_COLOR_FORMAT_I1, stride, grid->image_data, size);
+    lv_draw_buf_set_palette(&grid->image, 0, lv_color32_make(0, 0, 0, 0xFF));
+    lv_draw_buf_set_palette(&grid->image, 1, lv_color32_make(0xFF, 0xFF, 0xFF, 0xFF));
+
+    // Grid lines everywhere, then every cell empty
+    memset(image_row(grid, 0), 0x00, stride * height);
+    for (int i = 0; i < COLS * ROWS; i++) {
+        draw_cell(grid, i, 0);
+    }
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(obj, width, height);
+    lv_obj_set_user_data(obj, grid);
+    lv_obj_add_event_cb(obj, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, cover_check_cb, LV_EVENT_COVER_CHECK | LV_EVENT_PREPROCESS, NULL);
+    lv_obj_add_event_cb(obj, delete_event_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+void gui_month_show(lv_obj_t *obj, const gui_month_t *month)
+{
+    month_grid_t *grid = lv_obj_get_user_data(obj);
+    int first = day_of_week(month->year, month->month, 1);
+    int days = days_in_month(month->year, month->month);
+
+    lv_obj_update_layout(obj);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    for (int i = 0; i < COLS * ROWS; i++) {
+        int day = i - first + 1;
+        uint16_t cell = 0;
+        if (day >= 1 && day <= days) {
+            int markers = month->events[day];
+            cell = day | (markers > GUI_MONTH_MAX_MARKERS ? GUI_MONTH_MAX_MARKERS : markers) << 8;
+            if (day == month->today) {
+                cell |= CELL_TODAY;
+            }
+        }
+        if (cell == grid->cells[i]) {
+            continue;
+        }
+        grid->cells[i] = cell;
+        draw_cell(grid, i, cell);
+        lv_area_t a;
+        cell_area(grid, i, &a);
+        lv_area_move(&a, coords.x1, coords.y1);
+        lv_obj_invalidate_area(obj, &a);
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef _GUI_MONTH_H_
+#define _GUI_MONTH_H_
+
+// Month grid widget: 7 columns (Sunday first) x 6 weeks of day cells with the
+// day number and one bar per event (up to GUI_MONTH_MAX_MARKERS).
+//
+// A single object instead of a label and bar objects per cell. The widget
+// keeps the whole grid as a 1bpp bitmap in panel format (bit set = white):
+// day numbers are copied from a digit atlas rasterized once from the font,
+// event bars are filled as bit spans, and gui_month_show() redraws and
+// invalidates only the cells that changed. On an I1 display the draw event
+// copies the bitmap rows straight into the render buffer; with the x position
+// a multiple of 8 that is a plain memcpy per row. On other color formats the
+// bitmap is drawn as an I1 image.
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#define GUI_MONTH_MAX_MARKERS   3
+
+typedef struct {
+    int year;
+    int month;                  // 1..12
+    int today;                  // day to highlight, 0 for none
+    uint8_t events[32];         // events per day, [1..31]
+} gui_month_t;
+
+// The grid is width x height; digits come from font, or LV_FONT_DEFAULT if it has no digits
+lv_obj_t *gui_month_create(lv_obj_t *parent, int32_t width, int32_t height, const lv_font_t *font);
+
+// Shows a month; only the cells whose content changed are redrawn and invalidated
+void gui_month_show(lv_obj_t *grid, const gui_month_t *month);
+
+// font if it has all of 0-9, otherwise LV_FONT_DEFAULT
+const lv_font_t *gui_month_digit_font(const lv_font_t *font);
+
+#endif
@@ -0,0 +1,204 @@
+#include "gui_ui.h"
+#include <stdio.h>
+#include <string.h>
+#include "text_layout.h"
+
+#define MARGIN          20
+#define HEADER_HEIGHT   90
+#define TIME_WIDTH      140
+#define ROW_GAP         8
+#define TITLE_LINES     1
+
+typedef struct {
+    lv_obj_t *time;
+    lv_obj_t *title;            // draws a cached text_layout, or an lv_label without the cache
+} event_row_t;
+
+static gui_fonts_t s_fonts;
+static lv_obj_t *s_date;
+static lv_obj_t *s_weekday;
+static lv_obj_t *s_empty;
+static event_row_t s_rows[GUI_MAX_EVENTS];
+static int s_row_count;
+static int32_t s_title_width;
+static bool s_layout_cache = true;
+
+static const char *const WEEKDAYS[7] = {
+    "星期日", "星期一", "星期二", "星期三", "星期四", "星期五", "星期六",
+};
+
+// lv_label_set_text() invalidates even when the text is the same
+static void set_text(lv_obj_t *label, const char *text)
+{
+    if (strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+    }
+}
+
+static void set_visible(lv_obj_t *obj, bool visible)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == visible) {
+        if (visible) {
+            lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+static lv_obj_t *label_create(lv_obj_t *parent, const lv_font_t *font)
+{
+    lv_obj_t *label = lv_label_create(parent);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "");
+    return label;
+}
+
+// Titles: the layout (line breaks and ellipsis) comes from the cache and is
+// drawn with LV_TEXT_FLAG_FIT, so LVGL does not measure the text again
+
+static void title_event_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    const text_layout_t *layout = lv_obj_get_user_data(obj);
+    if (layout == NULL) {
+        return;
+    }
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_DRAW_MAIN: {
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc);
+        dsc.text = layout->text;
+        dsc.flag = LV_TEXT_FLAG_FIT;
+        lv_area_t coords;
+        lv_obj_get_coords(obj, &coords);
+        lv_draw_label(lv_event_get_layer(e), &dsc, &coords);
+        break;
+    }
+    case LV_EVENT_STYLE_CHANGED: {
+        // Glyphs may have been added (glyph_fetch): lay out again unless cached
+        const text_layout_t *fresh = text_layout_get(layout->source, s_fonts.small, s_title_width, TITLE_LINES);
+        text_layout_release(layout);
+        lv_obj_set_user_data(obj, (void *)fresh);
+        break;
+    }
+    case LV_EVENT_DELETE:
+        text_layout_release(layout);
+        lv_obj_set_user_data(obj, NULL);
+        break;
+    default:
+        break;
+    }
+}
+
+static lv_obj_t *title_create(lv_obj_t *parent)
+{
+    if (!s_layout_cache) {
+        lv_obj_t *label = label_create(parent, s_fonts.small);
+        lv_obj_set_size(label, s_title_width, s_fonts.small->line_height * TITLE_LINES);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        return label;
+    }
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_text_font(obj, s_fonts.small, 0);
+    lv_obj_set_size(obj, s_title_width, s_fonts.small->line_height * TITLE_LINES);
+    lv_obj_add_event_cb(obj, title_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, title_event_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj, title_event_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+static void title_set(lv_obj_t *obj, const char *text)
+{
+    if (!s_layout_cache) {
+        set_text(obj, text);
+        return;
+    }
+    const text_layout_t *old = lv_obj_get_user_data(obj);
+    if (old && strcmp(old->source, text) == 0) {
+        return;
+    }
+    const text_layout_t *layout = text_layout_get(text, s_fonts.small, s_title_width, TITLE_LINES);
+    text_layout_release(old);
+    lv_obj_set_user_data(obj, (void *)layout);
+    lv_obj_invalidate(obj);
+}
+
+void gui_ui_use_layout_cache(bool enable)
+{
+    s_layout_cache = enable;
+}
+
+void gui_ui_create(lv_obj_t *screen, const gui_fonts_t *fonts)
+{
+    s_fonts = *fonts;
+    int32_t width = lv_obj_get_width(screen);
+    int32_t height = lv_obj_get_height(screen);
+
+    lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
+    lv_obj_set_style_text_color(screen, lv_color_black(), 0);
+
+    s_date = label_create(screen, fonts->large);
+    lv_obj_align(s_date, LV_ALIGN_TOP_LEFT, MARGIN, (HEADER_HEIGHT - fonts->large->line_height) / 2);
+    s_weekday = label_create(screen, fonts->medium);
+    lv_obj_align(s_weekday, LV_ALIGN_TOP_RIGHT, -MARGIN, (HEADER_HEIGHT - fonts->medium->line_height) / 2);
+
+    lv_obj_t *rule = lv_obj_create(screen);
+    lv_obj_remove_style_all(rule);
+    lv_obj_set_style_bg_color(rule, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(rule, LV_OPA_COVER, 0);
+    lv_obj_set_size(rule, width - 2 * MARGIN, 3);
+    lv_obj_set_pos(rule, MARGIN, HEADER_HEIGHT);
+
+    int32_t top = HEADER_HEIGHT + 3 + ROW_GAP * 2;
+    int32_t pitch = fonts->small->line_height + ROW_GAP;
+    s_row_count = (height - top) / pitch;
+    s_title_width = width - 2 * MARGIN - TIME_WIDTH;
+    if (s_row_count > GUI_MAX_EVENTS) {
+        s_row_count = GUI_MAX_EVENTS;
+    }
+    for (int i = 0; i < s_row_count; i++) {
+        event_row_t *row = &s_rows[i];
+        row->time = label_create(screen, fonts->small);
+        lv_obj_set_pos(row->time, MARGIN, top + i * pitch);
+        row->title = title_create(screen);
+        lv_obj_set_pos(row->title, MARGIN + TIME_WIDTH, top + i * pitch);
+    }
+    s_empty = label_create(screen, fonts->small);
+    lv_label_set_text(s_empty, "今天無活動");
+    lv_obj_set_pos(s_empty, MARGIN, top);
+    lv_obj_add_flag(s_empty, LV_OBJ_FLAG_HIDDEN);
+}
+
+void gui_ui_show_day(const gui_day_t *day)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%d月%d日", day->month, day->day);
+    set_text(s_date, text);
+    set_text(s_weekday, WEEKDAYS[day->weekday % 7]);
+
+    // The last row tells how many events did not fit
+    int shown = day->event_count;
+    bool overflow = shown > s_row_count;
+    if (overflow) {
+        shown = s_row_count - 1;
+    }
+    for (int i = 0; i < s_row_count; i++) {
+        event_row_t *row = &s_rows[i];
+        if (i < shown) {
+            const gui_event_t *ev = &day->events[i];
+            set_text(row->time, ev->time[0] ? ev->time : "全天");
+            title_set(row->title, ev->title);
+        } else if (i == shown && overflow) {
+            snprintf(text, sizeof(text), "其他 %d 項", day->event_count - shown);
+            set_text(row->time, "");
+            title_set(row->title, text);
+        }
+        set_visible(row->time, i < shown || (i == shown && overflow));
+        set_visible(row->title, i < shown || (i == shown && overflow));
+    }
+    set_visible(s_empty, day->event_count == 0);
+}
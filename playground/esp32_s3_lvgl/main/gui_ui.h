@@ -0,0 +1,43 @@
+#ifndef _GUI_UI_H_
+#define _GUI_UI_H_
+
+// The calendar screen: the date on top and the day's events below.
+// Plain LVGL without ESP-IDF dependencies, so playground/lvgl_host_sim builds
+// and renders exactly the same UI on the host.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+#define GUI_MAX_EVENTS      32
+
+typedef struct {
+    const lv_font_t *large;     // date
+    const lv_font_t *medium;    // weekday
+    const lv_font_t *small;     // events
+} gui_fonts_t;
+
+typedef struct {
+    char time[16];              // "09:00", or "" for all-day events
+    char title[96];
+} gui_event_t;
+
+typedef struct {
+    int year;
+    int month;                  // 1..12
+    int day;                    // 1..31
+    int weekday;                // 0 = Sunday
+    const gui_event_t *events;
+    int event_count;
+} gui_day_t;
+
+// Builds the screen's objects; call once with the fonts to use
+void gui_ui_create(lv_obj_t *screen, const gui_fonts_t *fonts);
+
+// Event titles from text_layout (the default) or plain lv_label; takes effect at gui_ui_create()
+void gui_ui_use_layout_cache(bool enable);
+
+// Shows a day. Only labels whose text changes are invalidated.
+void gui_ui_show_day(const gui_day_t *day);
+
+#endif
@@ -0,0 +1,372 @@
+#include "mem_policy.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lvgl.h"
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "esp_memory_utils.h"
+#include "esp_flash.h"
+#include "esp_ota_ops.h"
+#if CONFIG_SPIRAM
+#include "esp_psram.h"
+#endif
+#endif
+
+static const char *TAG = "mem_policy";
+
+#define MAX_LISTED      12
+#define CAPS_PSRAM      (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define CAPS_SRAM       (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+
+typedef struct {
+    const char *name;
+    uint32_t caps;
+    uint32_t fallback_caps;     // 0: none
+    size_t align;               // 0: whatever the heap gives
+} mem_policy_t;
+
+// Large buffers that are written once per refresh go to PSRAM; what the SPI
+// DMA reads and what every draw reads stays in internal RAM. Boards without
+// PSRAM use the fallback, except for whole frames, which do not fit anyway.
+static const mem_policy_t s_policy[MEM_TAG_COUNT] = {
+    [MEM_TAG_DEFAULT]      = { "default",      MALLOC_CAP_DEFAULT, 0, 0 },
+    [MEM_TAG_DISPLAY_BAND] = { "display_band", CAPS_SRAM | MALLOC_CAP_DMA, 0, LV_DRAW_BUF_ALIGN },
+    [MEM_TAG_FRAME]        = { "frame",        CAPS_PSRAM, 0, LV_DRAW_BUF_ALIGN },
+    [MEM_TAG_IMAGE]        = { "image",        CAPS_PSRAM, MALLOC_CAP_DEFAULT, LV_DRAW_BUF_ALIGN },
+    [MEM_TAG_FONT_CACHE]   = { "font_cache",   CAPS_PSRAM, MALLOC_CAP_DEFAULT, LV_DRAW_BUF_ALIGN },
+    [MEM_TAG_HTTP]         = { "http",         CAPS_PSRAM, MALLOC_CAP_DEFAULT, 0 },
+    [MEM_TAG_EVENT_STORE]  = { "event_store",  CAPS_SRAM, CAPS_PSRAM, 0 },
+};
+
+// Arenas, pools and static buffers for the report
+typedef struct {
+    const char *name;
+    const mem_arena_t *arena;
+    const mem_pool_t *pool;
+    const void *ptr;
+    size_t size;
+} listed_t;
+
+static mem_tag_stats_t s_stats[MEM_TAG_COUNT];
+static listed_t s_listed[MAX_LISTED];
+static int s_listed_count;
+
+#ifdef ESP_PLATFORM
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+#define STATS_LOCK()    portENTER_CRITICAL(&s_lock)
+#define STATS_UNLOCK()  portEXIT_CRITICAL(&s_lock)
+#else
+#define STATS_LOCK()
+#define STATS_UNLOCK()
+#endif
+
+static void *alloc_caps(size_t align, size_t size, uint32_t caps)
+{
+    return align ? heap_caps_aligned_alloc(align, size, caps) : heap_caps_malloc(size, caps);
+}
+
+static void list(const char *name, const mem_arena_t *arena, const mem_pool_t *pool, const void *ptr, size_t size)
+{
+    if (s_listed_count == MAX_LISTED) {
+        ESP_LOGW(TAG, "%s not listed, raise MAX_LISTED", name);
+        return;
+    }
+    s_listed[s_listed_count++] = (listed_t) { name, arena, pool, ptr, size };
+}
+
+// ---------------------------------------------------------------------------
+// Tagged allocations
+
+void *mem_alloc(mem_tag_t tag, size_t size)
+{
+    if (tag >= MEM_TAG_COUNT) {
+        tag = MEM_TAG_DEFAULT;
+    }
+    const mem_policy_t *policy = &s_policy[tag];
+    bool fallback = false;
+    void *ptr = alloc_caps(policy->align, size, policy->caps);
+    if (ptr == NULL && policy->fallback_caps) {
+        ptr = alloc_caps(policy->align, size, policy->fallback_caps);
+        fallback = ptr != NULL;
+    }
+    size_t got = ptr ? heap_caps_get_allocated_size(ptr) : 0;
+
+    STATS_LOCK();
+    mem_tag_stats_t *s = &s_stats[tag];
+    if (ptr == NULL) {
+        s->failures++;
+    } else {
+        s->bytes += got;
+        s->allocs++;
+        s->fallbacks += fallback;
+        if (s->bytes > s->peak_bytes) {
+            s->peak_bytes = s->bytes;
+        }
+    }
+    STATS_UNLOCK();
+
+    if (ptr == NULL) {
+        ESP_LOGE(TAG, "Out of memory for %u bytes of %s", (unsigned)size, policy->name);
+    }
+    return ptr;
+}
+
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size)
+{
+    if (size && n > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = mem_alloc(tag, n * size);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+// Through a new allocation, so the tag's alignment and fallback still apply
+void *mem_realloc(mem_tag_t tag, void *ptr, size_t size)
+{
+    if (ptr == NULL) {
+        return mem_alloc(tag, size);
+    }
+    void *grown = mem_alloc(tag, size);
+    if (grown == NULL) {
+        return NULL;
+    }
+    size_t old = heap_caps_get_allocated_size(ptr);
+    memcpy(grown, ptr, old < size ? old : size);
+    mem_free(tag, ptr);
+    return grown;
+}
+
+void mem_free(mem_tag_t tag, void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    if (tag >= MEM_TAG_COUNT) {
+        tag = MEM_TAG_DEFAULT;
+    }
+    size_t size = heap_caps_get_allocated_size(ptr);
+    STATS_LOCK();
+    s_stats[tag].bytes -= size < s_stats[tag].bytes ? size : s_stats[tag].bytes;
+    if (s_stats[tag].allocs) {
+        s_stats[tag].allocs--;
+    }
+    STATS_UNLOCK();
+    heap_caps_free(ptr);
+}
+
+const char *mem_tag_name(mem_tag_t tag)
+{
+    return tag < MEM_TAG_COUNT ? s_policy[tag].name : "?";
+}
+
+void mem_tag_get_stats(mem_tag_t tag, mem_tag_stats_t *stats)
+{
+    STATS_LOCK();
+    *stats = s_stats[tag < MEM_TAG_COUNT ? tag : MEM_TAG_DEFAULT];
+    STATS_UNLOCK();
+}
+
+// ---------------------------------------------------------------------------
+// Arena
+
+esp_err_t mem_arena_init(mem_arena_t *arena, const char *name, mem_tag_t tag, size_t size)
+{
+    *arena = (mem_arena_t) { .tag = tag, .size = size };
+    arena->base = mem_alloc(tag, size);
+    if (arena->base == NULL) {
+        arena->size = 0;
+        return ESP_ERR_NO_MEM;
+    }
+    list(name, arena, NULL, NULL, 0);
+    return ESP_OK;
+}
+
+void *mem_arena_alloc(mem_arena_t *arena, size_t size, size_t align)
+{
+    if (align == 0) {
+        align = 1;
+    }
+    uintptr_t base = (uintptr_t)arena->base;
+    uintptr_t start = (base + arena->used + align - 1) & ~(uintptr_t)(align - 1);
+    size_t end = start - base + size;
+    if (arena->base == NULL || end > arena->size) {
+        arena->overflows++;
+        return NULL;
+    }
+    arena->used = end;
+    if (end > arena->peak) {
+        arena->peak = end;
+    }
+    return (void *)start;
+}
+
+void mem_arena_reset(mem_arena_t *arena)
+{
+    arena->used = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Pool
+
+esp_err_t mem_pool_init(mem_pool_t *pool, const char *name, mem_tag_t tag, size_t block_size, uint32_t block_count)
+{
+    block_size = (block_size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    *pool = (mem_pool_t) { .tag = tag, .block_size = block_size };
+    pool->base = mem_alloc(tag, block_size * block_count);
+    if (pool->base == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    pool->block_count = block_count;
+    for (uint32_t i = block_count; i-- > 0;) {
+        void **block = (void **)(pool->base + i * block_size);
+        *block = pool->free_list;
+        pool->free_list = block;
+    }
+    list(name, NULL, pool, NULL, 0);
+    return ESP_OK;
+}
+
+void *mem_pool_alloc(mem_pool_t *pool)
+{
+    void **block = pool->free_list;
+    if (block == NULL) {
+        pool->overflows++;
+        return mem_alloc(pool->tag, pool->block_size);
+    }
+    pool->free_list = *block;
+    if (++pool->used > pool->peak) {
+        pool->peak = pool->used;
+    }
+    return block;
+}
+
+void mem_pool_free(mem_pool_t *pool, void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    uint8_t *p = ptr;
+    if (p < pool->base || p >= pool->base + pool->block_size * pool->block_count) {
+        mem_free(pool->tag, ptr);  // an overflow block from the heap
+        return;
+    }
+    *(void **)ptr = pool->free_list;
+    pool->free_list = ptr;
+    pool->used--;
+}
+
+// ---------------------------------------------------------------------------
+// Report
+
+void mem_policy_register_static(const char *name, const void *ptr, size_t size)
+{
+    list(name, NULL, NULL, ptr, size);
+}
+
+static const char *region_of(const void *ptr)
+{
+    if (ptr == NULL) {
+        return "-";
+    }
+#ifdef ESP_PLATFORM
+    if (esp_ptr_external_ram(ptr)) {
+        return "psram";
+    }
+    if (esp_ptr_in_drom(ptr)) {
+        return "flash";
+    }
+    if (esp_ptr_dma_capable(ptr)) {
+        return "sram dma";
+    }
+    if (esp_ptr_internal(ptr)) {
+        return "sram";
+    }
+    return "?";
+#else
+    return "host";
+#endif
+}
+
+static const char *caps_name(uint32_t caps)
+{
+    if (caps == 0) {
+        return "-";
+    }
+    if (caps & MALLOC_CAP_SPIRAM) {
+        return "psram";
+    }
+    if (caps & MALLOC_CAP_DMA) {
+        return "sram dma";
+    }
+    return caps & MALLOC_CAP_INTERNAL ? "sram" : "any";
+}
+
+#ifdef ESP_PLATFORM
+static void heap_row(const char *name, uint32_t caps)
+{
+    printf("%-14s %8u %8u %8u %8u\n", name,
+           (unsigned)(heap_caps_get_total_size(caps) / 1024), (unsigned)(heap_caps_get_free_size(caps) / 1024),
+           (unsigned)(heap_caps_get_largest_free_block(caps) / 1024),
+           (unsigned)(heap_caps_get_minimum_free_size(caps) / 1024));
+}
+#endif
+
+void mem_policy_report(void)
+{
+    printf("========== memory placement ==========\n");
+#ifdef ESP_PLATFORM
+    printf("%-14s %8s %8s %8s %8s\n", "heap (KB)", "total", "free", "largest", "min free");
+    heap_row("sram", MALLOC_CAP_INTERNAL);
+    heap_row("sram dma", MALLOC_CAP_DMA);
+#if CONFIG_SPIRAM
+    if (esp_psram_is_initialized()) {
+        heap_row("psram", MALLOC_CAP_SPIRAM);
+    } else
+#endif
+    {
+        printf("%-14s no PSRAM, tags fall back to internal RAM\n", "psram");
+    }
+    uint32_t flash_size = 0;
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (esp_flash_get_size(NULL, &flash_size) == ESP_OK && running) {
+        printf("%-14s %8lu KB, app partition %lu KB\n", "flash",
+               (unsigned long)(flash_size / 1024), (unsigned long)(running->size / 1024));
+    }
+#endif
+
+    printf("%-14s %-9s %-9s %5s %8s %8s %6s %6s %6s\n", "tag", "wants", "else", "align",
+           "now B", "peak B", "allocs", "fallbk", "failed");
+    for (int i = 0; i < MEM_TAG_COUNT; i++) {
+        mem_tag_stats_t s;
+        mem_tag_get_stats(i, &s);
+        printf("%-14s %-9s %-9s %5u %8u %8u %6lu %6lu %6lu\n", s_policy[i].name,
+               caps_name(s_policy[i].caps), caps_name(s_policy[i].fallback_caps), (unsigned)s_policy[i].align,
+               (unsigned)s.bytes, (unsigned)s.peak_bytes, (unsigned long)s.allocs,
+               (unsigned long)s.fallbacks, (unsigned long)s.failures);
+    }
+
+    for (int i = 0; i < s_listed_count; i++) {
+        const listed_t *l = &s_listed[i];
+        if (l->arena) {
+            printf("arena %-20s %-8s %-12s %7u B, peak %u, %lu overflows\n", l->name, region_of(l->arena->base),
+                   mem_tag_name(l->arena->tag), (unsigned)l->arena->size, (unsigned)l->arena->peak,
+                   (unsigned long)l->arena->overflows);
+        } else if (l->pool) {
+            printf("pool  %-20s %-8s %-12s %4lu x %u B, peak %lu, %lu overflows\n", l->name,
+                   region_of(l->pool->base), mem_tag_name(l->pool->tag), (unsigned long)l->pool->block_count,
+                   (unsigned)l->pool->block_size, (unsigned long)l->pool->peak, (unsigned long)l->pool->overflows);
+        } else {
+            char size[16] = "-";    // 0: size not known
+            if (l->size) {
+                snprintf(size, sizeof(size), "%u B", (unsigned)l->size);
+            }
+            printf("fixed %-20s %-8s %-12s %9s\n", l->name, region_of(l->ptr), "", size);
+        }
+    }
+    printf("======================================\n");
+}
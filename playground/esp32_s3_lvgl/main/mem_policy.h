@@ -0,0 +1,93 @@
+#ifndef _MEM_POLICY_H_
+#define _MEM_POLICY_H_
+
+// Where each kind of buffer lives. Allocations name a tag instead of heap
+// caps; the table in mem_policy.c maps each tag to the caps it wants, a
+// fallback when that memory is missing or full (a board without PSRAM) and
+// an alignment. Every tag counts its bytes, so mem_policy_report() can print
+// what ended up where.
+//
+// An arena hands out scratch from one tagged block and is emptied as a whole
+// (per refresh, per fetch); a pool recycles blocks of one size without going
+// through the heap. Neither is thread safe: each has one owning task.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef enum {
+    MEM_TAG_DEFAULT,            // small bookkeeping
+    MEM_TAG_DISPLAY_BAND,       // LVGL band buffers, sent to the panel by SPI DMA
+    MEM_TAG_FRAME,              // whole frames (4-gray path)
+    MEM_TAG_IMAGE,              // widget images (gui_month grid)
+    MEM_TAG_FONT_CACHE,         // rasterized glyphs (ttf_font)
+    MEM_TAG_HTTP,               // HTTP request and response buffers (glyph_fetch)
+    MEM_TAG_EVENT_STORE,        // event titles and their layouts (text_layout)
+    MEM_TAG_COUNT,
+} mem_tag_t;
+
+typedef struct {
+    size_t bytes;
+    size_t peak_bytes;
+    uint32_t allocs;            // live allocations
+    uint32_t fallbacks;         // served from the fallback caps
+    uint32_t failures;
+} mem_tag_stats_t;
+
+typedef struct {
+    mem_tag_t tag;
+    uint8_t *base;
+    size_t size;
+    size_t used;
+    size_t peak;
+    uint32_t overflows;         // requests that did not fit
+} mem_arena_t;
+
+typedef struct {
+    mem_tag_t tag;
+    uint8_t *base;
+    size_t block_size;
+    uint32_t block_count;
+    void *free_list;
+    uint32_t used;
+    uint32_t peak;
+    uint32_t overflows;         // served by the heap because the pool was empty
+} mem_pool_t;
+
+void *mem_alloc(mem_tag_t tag, size_t size);
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size);
+void *mem_realloc(mem_tag_t tag, void *ptr, size_t size);
+void mem_free(mem_tag_t tag, void *ptr);
+
+const char *mem_tag_name(mem_tag_t tag);
+void mem_tag_get_stats(mem_tag_t tag, mem_tag_stats_t *stats);
+
+/**
+ * Allocates the arena's block of size bytes. The arena is listed in
+ * mem_policy_report() under name.
+ */
+esp_err_t mem_arena_init(mem_arena_t *arena, const char *name, mem_tag_t tag, size_t size);
+
+// align must be a power of two. Returns NULL when the rest of the block is too small.
+void *mem_arena_alloc(mem_arena_t *arena, size_t size, size_t align);
+
+// Frees everything handed out since the last reset
+void mem_arena_reset(mem_arena_t *arena);
+
+/**
+ * Allocates block_count blocks of block_size bytes in one piece. When they are
+ * all in use, mem_pool_alloc() falls back to the heap of the pool's tag, so a
+ * pool with only tag and block_size set works before (or without) this call.
+ */
+esp_err_t mem_pool_init(mem_pool_t *pool, const char *name, mem_tag_t tag, size_t block_size, uint32_t block_count);
+void *mem_pool_alloc(mem_pool_t *pool);
+void mem_pool_free(mem_pool_t *pool, void *ptr);
+
+// Lists a buffer that is not allocated through the policy (fonts in flash, static buffers)
+void mem_policy_register_static(const char *name, const void *ptr, size_t size);
+
+// Prints the heaps, then every tag, arena, pool and registered buffer with where it is
+void mem_policy_report(void);
+
+#endif
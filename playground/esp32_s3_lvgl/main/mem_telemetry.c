@@ -0,0 +1,210 @@
+#include "mem_telemetry.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "mem_telemetry";
+
+#define TASK_NAME_LEN       12
+#define STACK_NOT_RUNNING   0xffff
+// A watched task is warned about once its free stack falls below this share of the stack
+#define STACK_WARN_PERCENT  10
+
+typedef struct {
+    char name[TASK_NAME_LEN];
+    uint32_t stack_size;
+    uint32_t warned_free;       // free stack at the last warning, 0: none yet
+} watched_task_t;
+
+static const uint32_t s_heap_caps[MEM_TELEMETRY_HEAPS] = {
+    MALLOC_CAP_INTERNAL, MALLOC_CAP_DMA, MALLOC_CAP_SPIRAM,
+};
+
+static watched_task_t s_tasks[MEM_TELEMETRY_MAX_TASKS];
+static int s_task_count;
+static uint32_t s_period_ms;
+static uint32_t s_seq;
+
+static uint8_t s_snapshot[MEM_TELEMETRY_MAX_SIZE];
+static size_t s_snapshot_len;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t *put_u8(uint8_t *p, uint32_t v)
+{
+    *p = v > UINT8_MAX ? UINT8_MAX : (uint8_t)v;
+    return p + 1;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint32_t v)
+{
+    if (v > UINT16_MAX) {
+        v = UINT16_MAX;
+    }
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+    return p + 4;
+}
+
+esp_err_t mem_telemetry_watch_task(const char *name, uint32_t stack_size)
+{
+    if (s_task_count == MEM_TELEMETRY_MAX_TASKS) {
+        ESP_LOGW(TAG, "%s not watched, raise MEM_TELEMETRY_MAX_TASKS", name);
+        return ESP_ERR_NO_MEM;
+    }
+    watched_task_t *t = &s_tasks[s_task_count];
+    strncpy(t->name, name, TASK_NAME_LEN);
+    t->stack_size = stack_size;
+    t->warned_free = 0;
+    s_task_count++;
+    return ESP_OK;
+}
+
+// Free stack of the task in bytes, STACK_NOT_RUNNING if there is no task of that name
+static uint32_t stack_min_free(watched_task_t *t)
+{
+    char name[TASK_NAME_LEN + 1];
+    memcpy(name, t->name, TASK_NAME_LEN);
+    name[TASK_NAME_LEN] = '\0';
+
+    TaskHandle_t handle = xTaskGetHandle(name);
+    if (handle == NULL) {
+        return STACK_NOT_RUNNING;
+    }
+    uint32_t free_bytes = uxTaskGetStackHighWaterMark(handle) * sizeof(StackType_t);
+    if (free_bytes * 100 < t->stack_size * STACK_WARN_PERCENT &&
+        (t->warned_free == 0 || free_bytes < t->warned_free)) {
+        ESP_LOGW(TAG, "%s: %u of %u bytes of stack never used", name, (unsigned)free_bytes,
+                 (unsigned)t->stack_size);
+        t->warned_free = free_bytes;
+    }
+    return free_bytes;
+}
+
+static size_t sample(uint8_t *buf)
+{
+    uint8_t *p = buf;
+    p = put_u32(p, MEM_TELEMETRY_MAGIC);
+    p = put_u8(p, MEM_TELEMETRY_VERSION);
+    p = put_u8(p, MEM_TELEMETRY_HEAPS);
+    p = put_u8(p, MEM_TAG_COUNT);
+    p = put_u8(p, s_task_count);
+    p = put_u32(p, s_seq++);
+    p = put_u32(p, (uint32_t)(esp_timer_get_time() / 1000000));
+
+    // All zero for a heap the board does not have (no PSRAM)
+    for (int i = 0; i < MEM_TELEMETRY_HEAPS; i++) {
+        p = put_u32(p, heap_caps_get_total_size(s_heap_caps[i]));
+        p = put_u32(p, heap_caps_get_free_size(s_heap_caps[i]));
+        p = put_u32(p, heap_caps_get_minimum_free_size(s_heap_caps[i]));
+        p = put_u32(p, heap_caps_get_largest_free_block(s_heap_caps[i]));
+    }
+
+    for (int i = 0; i < MEM_TAG_COUNT; i++) {
+        mem_tag_stats_t s;
+        mem_tag_get_stats(i, &s);
+        p = put_u32(p, s.bytes);
+        p = put_u32(p, s.peak_bytes);
+        p = put_u16(p, s.allocs);
+        p = put_u8(p, s.fallbacks);
+        p = put_u8(p, s.failures);
+    }
+
+    for (int i = 0; i < s_task_count; i++) {
+        memcpy(p, s_tasks[i].name, TASK_NAME_LEN);
+        p += TASK_NAME_LEN;
+        p = put_u16(p, s_tasks[i].stack_size);
+        p = put_u16(p, stack_min_free(&s_tasks[i]));
+    }
+    return p - buf;
+}
+
+static void log_hex(const uint8_t *buf, size_t len)
+{
+    static const char digits[] = "0123456789abcdef";
+    static char hex[MEM_TELEMETRY_MAX_SIZE * 2 + 1];
+
+    for (size_t i = 0; i < len; i++) {
+        hex[i * 2] = digits[buf[i] >> 4];
+        hex[i * 2 + 1] = digits[buf[i] & 0x0f];
+    }
+    hex[len * 2] = '\0';
+    ESP_LOGI(TAG, "%s", hex);
+}
+
+static void telemetry_task(void *arg)
+{
+    (void)arg;
+    uint8_t buf[MEM_TELEMETRY_MAX_SIZE];
+    TickType_t last_wake = xTaskGetTickCount();
+
+    while (1) {
+        size_t len = sample(buf);
+        portENTER_CRITICAL(&s_lock);
+        memcpy(s_snapshot, buf, len);
+        s_snapshot_len = len;
+        portEXIT_CRITICAL(&s_lock);
+        log_hex(buf, len);
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(s_period_ms));
+    }
+}
+
+esp_err_t mem_telemetry_start(uint32_t period_ms)
+{
+    s_period_ms = period_ms;
+    mem_telemetry_watch_task("telemetry", MEM_TELEMETRY_STACK_SIZE);
+    if (xTaskCreate(telemetry_task, "telemetry", MEM_TELEMETRY_STACK_SIZE, NULL,
+                    tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+size_t mem_telemetry_get(uint8_t *buf, size_t size)
+{
+    size_t len = 0;
+    portENTER_CRITICAL(&s_lock);
+    if (s_snapshot_len <= size) {
+        len = s_snapshot_len;
+        memcpy(buf, s_snapshot, len);
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return len;
+}
+
+// ---------------------------------------------------------------------------
+// HTTP
+
+static esp_err_t telemetry_get_handler(httpd_req_t *req)
+{
+    uint8_t buf[MEM_TELEMETRY_MAX_SIZE];
+    size_t len = mem_telemetry_get(buf, sizeof(buf));
+    if (len == 0) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "No sample yet");
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/octet-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, (const char *)buf, len);
+}
+
+esp_err_t mem_telemetry_register_http(httpd_handle_t server)
+{
+    static const httpd_uri_t uri = {
+        .uri = "/telemetry",
+        .method = HTTP_GET,
+        .handler = telemetry_get_handler,
+    };
+    return httpd_register_uri_handler(server, &uri);
+}
@@ -0,0 +1,54 @@
+#ifndef _MEM_TELEMETRY_H_
+#define _MEM_TELEMETRY_H_
+
+// Heap and stack numbers sampled while the app runs, as opposed to the one
+// time mem_policy_report(). A low priority task wakes every period and packs
+// the heaps, the mem_policy tags and the stack high-water marks of the
+// watched tasks into one small snapshot. The snapshot is logged as a hex line
+// and the last one can be read over HTTP (GET /telemetry), so it costs a few
+// heap walks per period and nothing in between.
+//
+// Snapshot (little endian, packed):
+//   header, 16 bytes:
+//     uint32 magic "MTEL", uint8 version, uint8 heap_count, uint8 tag_count,
+//     uint8 task_count, uint32 seq, uint32 uptime (s)
+//   heap_count x 16 bytes, in the order sram, sram dma, psram:
+//     uint32 total, uint32 free, uint32 min_free (ever), uint32 largest free block
+//   tag_count x 12 bytes, in mem_tag_t order:
+//     uint32 bytes, uint32 peak_bytes, uint16 allocs (live), uint8 fallbacks,
+//     uint8 failures (counts saturate)
+//   task_count x 16 bytes, in the order the tasks were watched:
+//     char name[12] (NUL padded), uint16 stack_size, uint16 min_free stack
+//     (bytes, 0xffff when the task is not running)
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "mem_policy.h"
+
+#define MEM_TELEMETRY_MAGIC         0x4c45544d      // "MTEL"
+#define MEM_TELEMETRY_VERSION       1
+#define MEM_TELEMETRY_MAX_TASKS     8
+#define MEM_TELEMETRY_HEAPS         3
+#define MEM_TELEMETRY_MAX_SIZE      (16 + MEM_TELEMETRY_HEAPS * 16 + MEM_TAG_COUNT * 12 + MEM_TELEMETRY_MAX_TASKS * 16)
+#define MEM_TELEMETRY_STACK_SIZE    3072
+
+/**
+ * Adds a task, by the name it was created with, to the stack high-water
+ * marks. stack_size is what it was created with. Call before
+ * mem_telemetry_start(); the task itself may be created later, the name is
+ * looked up at every sample.
+ */
+esp_err_t mem_telemetry_watch_task(const char *name, uint32_t stack_size);
+
+// Starts the sampling task; the first snapshot is taken right away
+esp_err_t mem_telemetry_start(uint32_t period_ms);
+
+// Copies the last snapshot into buf. Returns its length, 0 before the first sample.
+size_t mem_telemetry_get(uint8_t *buf, size_t size);
+
+// Serves the last snapshot as application/octet-stream at GET /telemetry
+esp_err_t mem_telemetry_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,15695 @@
+/*******************************************************************************
+ * Size: 30 px
+ * Bpp: 1
+ * Opts: --size 30 --bpp 1
+ * Generated by font_related/prerender_font, do not edit
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 */
+
+    /* U+0025 */
+    0x0, 0x0, 0x0, 0xf, 0x80, 0x78, 0xf, 0xe0, 0x38, 0xf, 0x78, 0x3c,
+    0x7, 0x1c, 0x1c, 0x3, 0xe, 0x1e, 0x3, 0x83, 0xe, 0x0, 0xe3, 0x8e,
+    0x0, 0x71, 0xcf, 0x0, 0x3f, 0xe7, 0x0, 0xf, 0xe7, 0x80, 0x3, 0xe3,
+    0x87, 0x0, 0x3, 0xcf, 0xe0, 0x1, 0xcf, 0xf8, 0x1, 0xe7, 0x1c, 0x0,
+    0xe3, 0x8e, 0x0, 0xe3, 0x83, 0x0, 0xf0, 0xc3, 0x80, 0x70, 0x71, 0xc0,
+    0x78, 0x39, 0xe0, 0x38, 0xf, 0xe0, 0x3c, 0x7, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+002C */
+    0x79, 0xe7, 0x9e, 0x79, 0xcf, 0x38, 0x20,
+
+    /* U+002D */
+    0x0, 0x3f, 0xdf, 0xef, 0xf0, 0x0,
+
+    /* U+002E */
+    0x1, 0xe7, 0x9e, 0x78, 0x0,
+
+    /* U+002F */
+    0x0, 0x0, 0x0, 0xf0, 0x3, 0x80, 0x1e, 0x0, 0x78, 0x1, 0xc0, 0xf,
+    0x0, 0x3c, 0x0, 0xe0, 0x7, 0x80, 0x1e, 0x0, 0xf0, 0x3, 0xc0, 0xe,
+    0x0, 0x78, 0x1, 0xe0, 0x7, 0x0, 0x3c, 0x0, 0xf0, 0x3, 0x80, 0x1e,
+    0x0, 0x78, 0x1, 0xc0, 0xf, 0x0, 0x3c, 0x0, 0xe0, 0x7, 0x80, 0x1e,
+    0x0, 0x70, 0x1, 0xc0, 0x0,
+
+    /* U+0030 */
+    0x0, 0x0, 0xf, 0xc0, 0x7f, 0xc1, 0xff, 0xc3, 0xc7, 0x8f, 0x7, 0x9e,
+    0xf, 0x38, 0xe, 0x70, 0x1c, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x1,
+    0xfe, 0x3, 0xdc, 0x7, 0x38, 0xe, 0x78, 0x3c, 0xf0, 0x78, 0xf1, 0xe1,
+    0xff, 0xc1, 0xff, 0x1, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+0031 */
+    0x1, 0xc0, 0xf0, 0x7c, 0x7f, 0x7f, 0xdf, 0xf7, 0x3c, 0xf, 0x3, 0xc0,
+    0xf0, 0x3c, 0xf, 0x3, 0xc0, 0xf0, 0x3c, 0xf, 0x3, 0xc0, 0xf0, 0x3c,
+    0xf, 0x3, 0xc0,
+
+    /* U+0032 */
+    0x0, 0x0, 0x3f, 0x80, 0xff, 0xc3, 0xff, 0xc7, 0xf, 0x84, 0xf, 0x0,
+    0xe, 0x0, 0x1c, 0x0, 0x78, 0x0, 0xf0, 0x3, 0xc0, 0xf, 0x0, 0x3c,
+    0x0, 0xf0, 0x3, 0xc0, 0xf, 0x0, 0x3c, 0x0, 0x78, 0x1, 0xe0, 0x3,
+    0xff, 0xe7, 0xff, 0xcf, 0xff, 0x80,
+
+    /* U+0033 */
+    0x0, 0x0, 0x3f, 0x81, 0xff, 0xc3, 0xff, 0x83, 0x7, 0x80, 0xf, 0x0,
+    0xe, 0x0, 0x3c, 0x0, 0x78, 0x7, 0xe0, 0x3f, 0x80, 0x7f, 0x0, 0x3f,
+    0x80, 0xf, 0x0, 0xf, 0x0, 0x1e, 0x0, 0x3c, 0x0, 0x79, 0x1, 0xf3,
+    0xff, 0xc7, 0xff, 0xf, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+0034 */
+    0x0, 0x3c, 0x0, 0x7c, 0x0, 0xfc, 0x1, 0xfc, 0x1, 0xfc, 0x3, 0xbc,
+    0x7, 0xbc, 0xf, 0x3c, 0xe, 0x3c, 0x1e, 0x3c, 0x1c, 0x3c, 0x38, 0x3c,
+    0x78, 0x3c, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x0, 0x3c, 0x0, 0x3c,
+    0x0, 0x3c, 0x0, 0x3c, 0x0, 0x3c,
+
+    /* U+0035 */
+    0x1f, 0xf8, 0x3f, 0xf0, 0x7f, 0xe0, 0xe0, 0x1, 0xc0, 0x3, 0x80, 0xf,
+    0x0, 0x1e, 0x0, 0x3f, 0x0, 0x7f, 0xc0, 0xff, 0xc0, 0xf, 0xc0, 0x7,
+    0xc0, 0x7, 0x80, 0xf, 0x0, 0x1e, 0x0, 0x3c, 0x0, 0xf9, 0xff, 0xe3,
+    0xff, 0x87, 0xfe, 0x0, 0x0, 0x0,
+
+    /* U+0036 */
+    0x0, 0x18, 0x3, 0xf0, 0x1f, 0xe0, 0x7e, 0x1, 0xf0, 0x3, 0xc0, 0xf,
+    0x0, 0x3c, 0x0, 0x7b, 0xe0, 0xff, 0xe1, 0xff, 0xe3, 0xc3, 0xe7, 0x3,
+    0xce, 0x3, 0xdc, 0x7, 0xbc, 0xf, 0x78, 0x1c, 0x78, 0x78, 0xff, 0xe0,
+    0xff, 0xc0, 0xfe, 0x0, 0x0, 0x0,
+
+    /* U+0037 */
+    0x7f, 0xfc, 0xff, 0xf9, 0xff, 0xf0, 0x1, 0xe0, 0x7, 0x80, 0xf, 0x0,
+    0x3c, 0x0, 0x78, 0x1, 0xe0, 0x3, 0xc0, 0xf, 0x0, 0x1e, 0x0, 0x38,
+    0x0, 0xf0, 0x1, 0xe0, 0x3, 0x80, 0xf, 0x0, 0x1e, 0x0, 0x3c, 0x0,
+    0x78, 0x0, 0xe0, 0x0,
+
+    /* U+0038 */
+    0x0, 0x0, 0x1f, 0xc0, 0x7f, 0xc1, 0xff, 0xc7, 0x83, 0xcf, 0x7, 0x9e,
+    0xf, 0x3c, 0x1e, 0x78, 0x38, 0x7c, 0xf0, 0x7f, 0xc0, 0xff, 0x83, 0xff,
+    0x87, 0xf, 0x9e, 0xf, 0x38, 0xe, 0xf0, 0x1e, 0xe0, 0x39, 0xe0, 0xf3,
+    0xff, 0xe3, 0xff, 0x81, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+0039 */
+    0x0, 0x0, 0x1f, 0x80, 0x7f, 0xc1, 0xff, 0xc7, 0x87, 0x8e, 0x7, 0xbc,
+    0xf, 0x78, 0xe, 0xf0, 0x1c, 0xf0, 0x39, 0xe0, 0x73, 0xff, 0xe3, 0xff,
+    0xc1, 0xff, 0x80, 0xf, 0x0, 0x1c, 0x0, 0x78, 0x1, 0xe0, 0xf, 0xc1,
+    0xfe, 0x3, 0xf8, 0x7, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+003A */
+    0x1, 0xe7, 0x9e, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xe7, 0x9e,
+    0x0,
+
+    /* U+00B0 */
+    0xc, 0x1f, 0x18, 0xc8, 0x24, 0x13, 0x19, 0xdc, 0x7c, 0x0, 0x0,
+
+    /* U+00B7 */
+    0x31, 0xe7, 0x9e, 0x0,
+
+    /* U+3001 */
+    0x0, 0x60, 0x70, 0x38, 0x1c, 0x1e, 0xf, 0x7, 0x0,
+
+    /* U+3002 */
+    0x0, 0x7, 0x83, 0xf1, 0xc6, 0x61, 0xb0, 0x36, 0x19, 0x8e, 0x3f, 0x7,
+    0x80, 0x0,
+
+    /* U+300A */
+    0x2, 0x10, 0x19, 0x81, 0x8c, 0xc, 0xc0, 0xc6, 0x6, 0x60, 0x63, 0x3,
+    0x30, 0x31, 0x81, 0x98, 0x1c, 0xc0, 0xcc, 0xe, 0x60, 0x63, 0x3, 0x98,
+    0xc, 0xc0, 0x73, 0x1, 0x98, 0xc, 0x60, 0x33, 0x1, 0x8c, 0x6, 0x60,
+    0x31, 0x80, 0xcc, 0x6, 0x30, 0x19, 0x80, 0x84,
+
+    /* U+300B */
+    0x42, 0x3, 0x30, 0x18, 0xc0, 0x66, 0x3, 0x18, 0xc, 0xc0, 0x63, 0x1,
+    0x98, 0xc, 0x60, 0x33, 0x1, 0x9c, 0xe, 0x60, 0x33, 0x81, 0x8c, 0xc,
+    0xc0, 0xe6, 0x6, 0x70, 0x33, 0x3, 0x18, 0x19, 0x81, 0x8c, 0xc, 0xc0,
+    0xc6, 0x6, 0x60, 0x63, 0x3, 0x30, 0x10, 0x80,
+
+    /* U+300C */
+    0x0, 0x7, 0xfe, 0x7f, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0,
+    0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0,
+    0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0,
+    0x0, 0x0,
+
+    /* U+300D */
+    0x0, 0x0, 0xc, 0x1, 0x80, 0x30, 0x6, 0x0, 0xc0, 0x18, 0x3, 0x0,
+    0x60, 0xc, 0x1, 0x80, 0x30, 0x6, 0x0, 0xc0, 0x18, 0x3, 0x0, 0x60,
+    0xc, 0x1, 0x80, 0x30, 0x6, 0x0, 0xdf, 0xfb, 0xfe, 0x0, 0x0,
+
+    /* U+4E00 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xf8,
+
+    /* U+4E01 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70,
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0xf, 0xe0, 0x0,
+    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E03 */
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0,
+    0x0, 0x7, 0x0, 0xc, 0x0, 0x71, 0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x3f,
+    0xff, 0xe0, 0x7, 0xff, 0x0, 0x0, 0x20, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x80, 0x7, 0x0, 0x1c, 0x0, 0x70,
+    0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x70, 0x3, 0xc0, 0x7, 0xff, 0xf8,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x7e, 0x0,
+
+    /* U+4E08 */
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0,
+    0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x3c, 0x0, 0x7f, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xfe, 0x0, 0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x3,
+    0x3, 0x80, 0x0, 0x38, 0x38, 0x0, 0x1, 0x83, 0x80, 0x0, 0x1c, 0x30,
+    0x0, 0x0, 0xc3, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x77, 0x0, 0x0,
+    0x3, 0xe0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x7, 0xbe, 0x0, 0x1, 0xf0, 0xfc, 0x0, 0xfc, 0x3, 0xf8,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E09 */
+    0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+4E0A */
+    0x0, 0x8, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0xff, 0xf0, 0x0,
+    0xf, 0xff, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+4E0B */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1,
+    0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
+    0xd, 0xe0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0xc, 0x3c, 0x0, 0x0, 0xc1,
+    0xe0, 0x0, 0xc, 0xe, 0x0, 0x0, 0xc0, 0x60, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+
+    /* U+4E0D */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x78, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x1, 0xe0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
+    0x76, 0x70, 0x0, 0xe, 0x63, 0x80, 0x1, 0xc6, 0x1c, 0x0, 0x78, 0x60,
+    0xf0, 0xf, 0x6, 0x7, 0x81, 0xe0, 0x60, 0x3c, 0x7c, 0x6, 0x1, 0xe7,
+    0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+4E16 */
+    0x0, 0x0, 0x0, 0x0, 0x60, 0x60, 0x60, 0x6, 0x6, 0x6, 0x0, 0x60,
+    0x60, 0x60, 0x6, 0x6, 0x6, 0x0, 0x60, 0x60, 0x60, 0x6, 0x6, 0x6,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x6,
+    0x6, 0x6, 0x0, 0x60, 0x60, 0x60, 0x6, 0x6, 0x6, 0x0, 0x60, 0x60,
+    0x60, 0x6, 0x6, 0x6, 0x0, 0x60, 0x60, 0x60, 0x6, 0x7, 0xe, 0x0,
+    0x60, 0x7f, 0xe0, 0x6, 0x3, 0xfc, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
+    0x7, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfc,
+
+    /* U+4E1F */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfc, 0x0, 0x30, 0x0, 0x0, 0x7, 0x1, 0x0, 0x0, 0x60, 0x38, 0x0,
+    0xe, 0x1, 0xc0, 0x0, 0xc0, 0xe, 0x0, 0x1c, 0x0, 0xf0, 0x1, 0x80,
+    0x3f, 0x81, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xf1, 0xc3, 0xfe, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E2D */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0xc, 0x0, 0x3, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf9, 0xff,
+    0xff, 0xfe, 0x70, 0xc, 0x3, 0x9c, 0x3, 0x0, 0x67, 0x0, 0xc0, 0x19,
+    0xc0, 0x30, 0x6, 0x70, 0xc, 0x1, 0x9c, 0x3, 0x0, 0x67, 0x0, 0xc0,
+    0x19, 0xc0, 0x30, 0xe, 0x7f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xc0, 0x1,
+    0xe0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0xc0, 0x0,
+
+    /* U+4E32 */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x3f, 0xff,
+    0xf0, 0x1f, 0xff, 0xff, 0xf, 0x7, 0x81, 0xc3, 0x80, 0xc0, 0x70, 0xe0,
+    0x30, 0x1c, 0x38, 0xc, 0x7, 0x7, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xe0,
+    0x0, 0x38, 0x0, 0x0, 0xc, 0x0, 0x0, 0x7, 0x80, 0x3, 0xff, 0xff,
+    0xf9, 0xff, 0xff, 0xfe, 0x70, 0xc, 0x1, 0x98, 0x3, 0x0, 0x66, 0x0,
+    0xc0, 0x19, 0xc0, 0x30, 0xe, 0x7f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xe0,
+    0x0, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0xc0, 0x0,
+
+    /* U+4E39 */
+    0x0, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xe0, 0x7, 0x80, 0xf, 0x0, 0x70,
+    0x0, 0x70, 0x6, 0x8, 0x7, 0x0, 0x60, 0xc0, 0x70, 0x6, 0xe, 0x7,
+    0x0, 0x60, 0x70, 0x70, 0x6, 0x3, 0x87, 0x0, 0x60, 0x18, 0x70, 0x6,
+    0x0, 0x7, 0x0, 0x60, 0x0, 0x70, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x7, 0x0, 0x7, 0x0, 0x60, 0x0, 0x70, 0x6, 0x0, 0x7, 0x0,
+    0x60, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0x1c, 0x0,
+    0x7, 0x1, 0xc0, 0x0, 0x70, 0x38, 0x0, 0x7, 0x7, 0x0, 0x7, 0xf0,
+    0x70, 0x0, 0x7e, 0x0, 0x0, 0x3, 0x80,
+
+    /* U+4E3B */
+    0x0, 0x18, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
+    0x78, 0x0, 0x0, 0x1, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
+    0xc1, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+4E43 */
+    0x3f, 0xff, 0xf0, 0xf, 0xff, 0xfc, 0x0, 0xc, 0x7, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0xc0, 0x30, 0x0, 0x30, 0x1c, 0x0, 0xc, 0x7, 0x0, 0x3,
+    0x1, 0xc0, 0x1, 0xc0, 0x7f, 0x80, 0x70, 0x1f, 0xf0, 0x1c, 0x0, 0x1c,
+    0x6, 0x0, 0x7, 0x1, 0x80, 0x0, 0xc0, 0x60, 0x0, 0x70, 0x38, 0x0,
+    0x1c, 0xc, 0x0, 0x7, 0x7, 0x0, 0x1, 0xc1, 0xc0, 0x0, 0x60, 0xe0,
+    0x0, 0x18, 0x70, 0x0, 0xe, 0x3c, 0x0, 0x3, 0x8e, 0x0, 0x3, 0xc7,
+    0x0, 0xf, 0xf1, 0x80, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E45 */
+    0x0, 0x20, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xf,
+    0xfc, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0x80, 0x3, 0x80, 0x70,
+    0x0, 0x70, 0x7, 0x0, 0xe, 0x0, 0x70, 0x1, 0xe0, 0xe, 0x0, 0x3c,
+    0x0, 0xe0, 0x7, 0x80, 0x1c, 0x0, 0x70, 0x1, 0x80, 0x6, 0x0, 0x38,
+    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x1e, 0xe0, 0x0,
+    0x3, 0xc6, 0x0, 0x0, 0x78, 0x70, 0x0, 0xf, 0x3, 0x80, 0x1, 0xe0,
+    0x1c, 0x0, 0x7c, 0x0, 0xf0, 0xf, 0x0, 0x7, 0x83, 0xe0, 0x0, 0x3c,
+    0x7c, 0x0, 0x1, 0xe7, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E4B */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x1c, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x1e,
+    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xf0, 0x0, 0x4, 0x1e, 0x0, 0x0,
+    0xe7, 0x80, 0x0, 0x1f, 0xf0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x3b, 0x80,
+    0x0, 0x3, 0x9c, 0x0, 0x0, 0x70, 0xf8, 0x0, 0x7, 0x7, 0xff, 0xfe,
+    0x60, 0xf, 0xff, 0xe0, 0x0, 0x3, 0xfc,
+
+    /* U+4E5D */
+    0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x3f, 0xff, 0xe0,
+    0x7, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x6, 0x3, 0x0, 0x0,
+    0x60, 0x30, 0x0, 0x6, 0x3, 0x0, 0x0, 0x60, 0x30, 0x0, 0xe, 0x3,
+    0x0, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x7, 0x0, 0x1, 0xc0, 0x70, 0x0,
+    0x1c, 0x7, 0x0, 0x3, 0x80, 0x70, 0x0, 0x38, 0x7, 0x6, 0x7, 0x0,
+    0x70, 0x60, 0xf0, 0x7, 0x6, 0x1e, 0x0, 0x70, 0xe3, 0xc0, 0x7, 0xfe,
+    0x78, 0x0, 0x7f, 0xc7, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E5F */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x30, 0x0, 0x3, 0x3, 0x0, 0x0, 0x30,
+    0x30, 0x0, 0x3, 0x3, 0x0, 0x0, 0x30, 0x31, 0xf0, 0x3, 0x3, 0xff,
+    0x80, 0x30, 0xff, 0x38, 0x3, 0x7f, 0x83, 0x80, 0x7f, 0xf0, 0x38, 0x3f,
+    0xc3, 0x3, 0x87, 0xf0, 0x30, 0x38, 0x63, 0x3, 0x3, 0x80, 0x30, 0x30,
+    0x38, 0x3, 0x3, 0x3, 0x80, 0x30, 0x30, 0x70, 0x3, 0x3, 0x1f, 0x0,
+    0x30, 0x33, 0xe0, 0x3, 0x3, 0x18, 0x0, 0x30, 0x30, 0x6, 0x3, 0x3,
+    0x0, 0x60, 0x30, 0x0, 0xe, 0x3, 0x80, 0x0, 0xe0, 0x3f, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xe0,
+
+    /* U+4E8B */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0xc, 0x6, 0x3, 0x0, 0xe0, 0xf0, 0x70, 0xf,
+    0xff, 0xff, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x1, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x60, 0x30, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0x7, 0x3, 0x80, 0x0, 0x60, 0x30, 0xf, 0xff,
+    0xff, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x1e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x7c, 0x0, 0x0,
+
+    /* U+4E8C */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x7f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E94 */
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x1,
+    0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0,
+    0x0, 0x3, 0x80, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7f, 0xff, 0x0, 0xf,
+    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x70, 0x1c, 0x0, 0x7, 0x0,
+    0xc0, 0x0, 0x60, 0xc, 0x0, 0x6, 0x0, 0xc0, 0x0, 0xe0, 0xc, 0x0,
+    0xe, 0x0, 0xc0, 0x0, 0xe0, 0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0xc0,
+    0xc, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+4E95 */
+    0x0, 0x40, 0x10, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x0, 0xc,
+    0x3, 0x0, 0x0, 0xc0, 0x30, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xf0, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0,
+    0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x3,
+    0x0, 0x0, 0xc0, 0x30, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x1c, 0x3, 0x0, 0x1, 0x80, 0x30, 0x0, 0x38, 0x3, 0x0, 0x3, 0x80,
+    0x30, 0x0, 0x70, 0x3, 0x0, 0xf, 0x0, 0x30, 0x1, 0xe0, 0x3, 0x0,
+    0x78, 0x0, 0x30, 0x7, 0x0, 0x3, 0x0, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+4E9E */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x3,
+    0xc, 0x0, 0x0, 0x30, 0xc0, 0x0, 0x3, 0xc, 0x0, 0x0, 0x70, 0xc0,
+    0x0, 0x7, 0xe, 0x0, 0x1f, 0xf0, 0xff, 0x81, 0xfc, 0x7, 0xf8, 0x38,
+    0x0, 0x1, 0xc3, 0x80, 0x0, 0x1c, 0x38, 0x0, 0x1, 0xc3, 0x80, 0x0,
+    0x1c, 0x38, 0x0, 0x1, 0xc1, 0xfc, 0x3, 0xf8, 0x1f, 0xf0, 0xff, 0x80,
+    0x7, 0xe, 0x0, 0x0, 0x70, 0xc0, 0x0, 0x3, 0xc, 0x0, 0x0, 0x30,
+    0xc0, 0x0, 0x3, 0xc, 0x0, 0x0, 0x70, 0xe0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+4EA4 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x6, 0x0, 0x0, 0xe0, 0x78, 0x0, 0x3c, 0x3, 0xe0, 0x7,
+    0x80, 0xf, 0x1, 0xf0, 0x0, 0x7c, 0x3c, 0x0, 0x1, 0xc3, 0x8c, 0x3,
+    0x0, 0x0, 0xe0, 0x70, 0x0, 0xe, 0xf, 0x0, 0x0, 0x70, 0xe0, 0x0,
+    0x3, 0x9c, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x1, 0xf8, 0x0, 0x0, 0xf,
+    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xf9, 0xf0, 0x0, 0xff, 0x7, 0xf0,
+    0x7f, 0x80, 0x1f, 0xe7, 0xe0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4EAB */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0xf,
+    0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xe0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x1, 0xfc, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x7, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+4EAC */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe,
+    0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0,
+    0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x60, 0x0, 0x1, 0x6, 0x8, 0x0, 0x38, 0x61, 0xc0, 0xf, 0x6,
+    0xf, 0x1, 0xe0, 0x60, 0x78, 0x3c, 0x6, 0x3, 0xc7, 0x80, 0x60, 0x1e,
+    0x60, 0x3e, 0x0, 0x60, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+4EAD */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0xf,
+    0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe7,
+    0x3f, 0xff, 0xc6, 0x67, 0xff, 0xfe, 0x66, 0x3f, 0xff, 0xc6, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x7c, 0x0, 0x0,
+
+    /* U+4EBA */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
+    0xf, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x1d, 0x80, 0x0, 0x1, 0xd8,
+    0x0, 0x0, 0x19, 0xc0, 0x0, 0x3, 0x8c, 0x0, 0x0, 0x38, 0xe0, 0x0,
+    0x7, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x0, 0x1e, 0x3, 0x80, 0x3, 0xc0,
+    0x1c, 0x0, 0x78, 0x1, 0xf0, 0xf, 0x0, 0xf, 0x81, 0xe0, 0x0, 0x7c,
+    0x7c, 0x0, 0x1, 0xe7, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+4EC1 */
+    0x0, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x38,
+    0x0, 0x0, 0x3, 0x3f, 0xff, 0xc0, 0x73, 0xff, 0xfc, 0x6, 0x1f, 0xff,
+    0x80, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1e,
+    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x7, 0x60, 0x0,
+    0x0, 0x66, 0x0, 0x0, 0x4, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x7f, 0xff, 0xe0, 0x67, 0xff, 0xfe,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+4ECA */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x0, 0x1,
+    0xf8, 0x0, 0x0, 0x3b, 0xc0, 0x0, 0x7, 0xe, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0x3c, 0x3, 0xc0, 0x7, 0x80, 0x1f, 0x1, 0xf0, 0x0, 0xfc, 0x7d,
+    0xff, 0xfb, 0xe7, 0x9f, 0xff, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+4ECB */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0x79, 0xc0, 0x0, 0xf, 0xe, 0x0, 0x1, 0xe0, 0xf0,
+    0x0, 0x3c, 0x3, 0xc0, 0x7, 0x80, 0x1f, 0x1, 0xf0, 0x0, 0xf8, 0x3e,
+    0x0, 0x3, 0xe7, 0x8c, 0x1, 0x1e, 0x70, 0xc0, 0x38, 0x60, 0xc, 0x3,
+    0x80, 0x0, 0xc0, 0x38, 0x0, 0x1c, 0x3, 0x80, 0x1, 0xc0, 0x38, 0x0,
+    0x1c, 0x3, 0x80, 0x1, 0x80, 0x38, 0x0, 0x18, 0x3, 0x80, 0x3, 0x80,
+    0x38, 0x0, 0x30, 0x3, 0x80, 0x7, 0x0, 0x38, 0x1, 0xe0, 0x3, 0x80,
+    0x3c, 0x0, 0x38, 0x3, 0x80, 0x3, 0x80, 0x20, 0x0, 0x10, 0x0,
+
+    /* U+4ED4 */
+    0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xc0, 0x33,
+    0xff, 0xfc, 0x7, 0x0, 0x3, 0xc0, 0x70, 0x0, 0x78, 0x6, 0x0, 0xe,
+    0x0, 0xe0, 0x3, 0xc0, 0xe, 0x0, 0x70, 0x1, 0xe0, 0x7, 0x0, 0x3e,
+    0x0, 0x60, 0x3, 0xe0, 0x6, 0x0, 0x7e, 0x3f, 0xff, 0xc6, 0x6f, 0xff,
+    0xfe, 0x66, 0x7f, 0xff, 0xe0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0,
+    0x6, 0x7, 0xe0, 0x0, 0x60, 0x7e, 0x0, 0x4, 0x3, 0x80, 0x0,
+
+    /* U+4ED5 */
+    0x0, 0x80, 0x40, 0x0, 0x18, 0x6, 0x0, 0x3, 0x80, 0x60, 0x0, 0x38,
+    0x6, 0x0, 0x3, 0x0, 0x60, 0x0, 0x70, 0x6, 0x0, 0x6, 0x0, 0x60,
+    0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0xe0, 0x1, 0xe7, 0xff, 0xfe, 0x1e,
+    0x7f, 0xff, 0xe3, 0xe0, 0xe, 0x0, 0x7e, 0x0, 0x60, 0x6, 0x60, 0x6,
+    0x0, 0x66, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x63, 0xff, 0xfc,
+    0x6, 0x7f, 0xff, 0xc0, 0x61, 0xff, 0xf8, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+4ED6 */
+    0x1, 0x80, 0x60, 0x0, 0x38, 0x6, 0x0, 0x3, 0x80, 0x60, 0x0, 0x31,
+    0x86, 0x0, 0x7, 0x18, 0x60, 0x0, 0x61, 0x86, 0x0, 0xe, 0x18, 0x67,
+    0x80, 0xe1, 0x87, 0xfc, 0x1e, 0x19, 0xff, 0xc1, 0xe1, 0xfe, 0x1c, 0x3e,
+    0x7f, 0x61, 0xc3, 0xef, 0x86, 0x1c, 0x76, 0x98, 0x61, 0xc6, 0x61, 0x86,
+    0x1c, 0x46, 0x18, 0x61, 0xc0, 0x61, 0x86, 0x1c, 0x6, 0x18, 0x67, 0xc0,
+    0x61, 0x86, 0xf8, 0x6, 0x18, 0x67, 0x0, 0x61, 0x86, 0x0, 0x6, 0x18,
+    0x60, 0x60, 0x61, 0x80, 0x6, 0x6, 0x18, 0x0, 0x60, 0x61, 0xc0, 0xe,
+    0x6, 0x1f, 0xff, 0xc0, 0x60, 0x7f, 0xf8, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4ED8 */
+    0x0, 0x80, 0x6, 0x0, 0x1c, 0x0, 0x60, 0x1, 0x80, 0x6, 0x0, 0x38,
+    0x0, 0x60, 0x3, 0x80, 0x6, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0, 0x6,
+    0x0, 0xe7, 0xff, 0xfe, 0xe, 0x7f, 0xff, 0xe1, 0xe0, 0x0, 0x60, 0x1e,
+    0x0, 0x6, 0x3, 0xe0, 0x0, 0x60, 0x76, 0x0, 0x6, 0x7, 0x61, 0xc0,
+    0x60, 0x66, 0xe, 0x6, 0x0, 0x60, 0xe0, 0x60, 0x6, 0x7, 0x6, 0x0,
+    0x60, 0x30, 0x60, 0x6, 0x1, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0,
+    0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0xe0,
+    0x6, 0x0, 0xfe, 0x0, 0x60, 0xf, 0xc0, 0x6, 0x0, 0x70, 0x0,
+
+    /* U+4ED9 */
+    0x1, 0x80, 0x60, 0x0, 0x70, 0xc, 0x0, 0xe, 0x1, 0x80, 0x1, 0x80,
+    0x30, 0x0, 0x70, 0x6, 0x0, 0xe, 0x0, 0xc0, 0x1, 0x8c, 0x18, 0x30,
+    0x71, 0x83, 0x6, 0xe, 0x30, 0x60, 0xc3, 0xc6, 0xc, 0x18, 0xf8, 0xc1,
+    0x83, 0x1f, 0x18, 0x30, 0x67, 0xe3, 0x6, 0xc, 0xcc, 0x60, 0xc1, 0x99,
+    0x8c, 0x18, 0x30, 0x31, 0x83, 0x6, 0x6, 0x30, 0x60, 0xc0, 0xc6, 0xc,
+    0x18, 0x18, 0xc1, 0x83, 0x3, 0x18, 0x30, 0x60, 0x63, 0x6, 0xc, 0xc,
+    0x60, 0xc1, 0x81, 0x8c, 0x18, 0x30, 0x31, 0xff, 0xfe, 0x6, 0x3f, 0xff,
+    0xc0, 0xc1, 0xff, 0xe0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+4EE3 */
+    0x1, 0x81, 0x0, 0x0, 0x18, 0x38, 0x0, 0x3, 0x83, 0x8e, 0x0, 0x30,
+    0x38, 0x70, 0x7, 0x3, 0x87, 0x0, 0x60, 0x18, 0x30, 0x6, 0x1, 0x80,
+    0x0, 0xe0, 0x18, 0x1c, 0xe, 0x7, 0xff, 0xe1, 0xef, 0xff, 0xf8, 0x3e,
+    0xfd, 0x80, 0x3, 0xe0, 0x18, 0x0, 0x76, 0x1, 0xc0, 0x6, 0x60, 0xc,
+    0x0, 0x66, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x0, 0x6, 0x0, 0xe0, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x3, 0x6, 0x6, 0x0,
+    0x38, 0x60, 0x60, 0x1, 0x86, 0x6, 0x0, 0x1c, 0x60, 0x60, 0x0, 0xfe,
+    0x6, 0x0, 0x7, 0xe0, 0x60, 0x0, 0x3c, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4EE5 */
+    0x0, 0x0, 0x0, 0x0, 0xc1, 0x80, 0x30, 0x1c, 0x1e, 0x3, 0x1, 0xc0,
+    0xf0, 0x38, 0x1c, 0x7, 0x83, 0x0, 0xc0, 0x3c, 0x30, 0xc, 0x0, 0x83,
+    0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc,
+    0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x87, 0x0, 0xc0, 0x38,
+    0x70, 0xc, 0x7, 0x6, 0x0, 0xc1, 0xe0, 0x60, 0xc, 0x3c, 0xe, 0x0,
+    0xcf, 0x80, 0xc0, 0xf, 0xe0, 0x1e, 0x0, 0xfc, 0x3, 0xf0, 0x1f, 0x0,
+    0x77, 0x87, 0xc0, 0x1e, 0x3c, 0x70, 0xf, 0xc1, 0xe0, 0x3, 0xf0, 0xe,
+    0x0, 0x7c, 0x0, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+4EF2 */
+    0x1, 0x80, 0x40, 0x0, 0x70, 0x1c, 0x0, 0xe, 0x3, 0x80, 0x1, 0x80,
+    0x70, 0x0, 0x70, 0xe, 0x0, 0xc, 0x1, 0xc0, 0x3, 0x8f, 0xff, 0xf0,
+    0x71, 0xff, 0xfe, 0x1e, 0x70, 0xe0, 0xc3, 0xce, 0x1c, 0x18, 0xf9, 0x83,
+    0x83, 0x1f, 0x30, 0x70, 0x67, 0xe6, 0xe, 0xc, 0xdc, 0xc1, 0xc1, 0x9b,
+    0x98, 0x38, 0x30, 0x73, 0x87, 0x6, 0xe, 0x7f, 0xff, 0xc1, 0xc7, 0xff,
+    0xf8, 0x38, 0x3, 0x80, 0x7, 0x0, 0x70, 0x0, 0xe0, 0xe, 0x0, 0x1c,
+    0x1, 0xc0, 0x3, 0x80, 0x38, 0x0, 0x70, 0x7, 0x0, 0xe, 0x0, 0xe0,
+    0x1, 0xc0, 0x1c, 0x0, 0x10, 0x1, 0x0, 0x0,
+
+    /* U+4EF6 */
+    0x1, 0x0, 0x20, 0x0, 0x38, 0x6, 0x0, 0x3, 0x8, 0x60, 0x0, 0x71,
+    0xc6, 0x0, 0x7, 0x18, 0x60, 0x0, 0x63, 0x86, 0x0, 0xe, 0x3f, 0xff,
+    0xc0, 0xe3, 0xff, 0xfe, 0x1e, 0x7f, 0xff, 0x81, 0xe7, 0x6, 0x0, 0x3e,
+    0x60, 0x60, 0x3, 0xee, 0x6, 0x0, 0x7e, 0xc0, 0x60, 0x6, 0xe0, 0x6,
+    0x0, 0x4e, 0x0, 0x60, 0x0, 0xef, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xe0,
+    0xe0, 0x7, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0,
+    0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0,
+    0xe, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0x4, 0x0, 0x20, 0x0,
+
+    /* U+4EFB */
+    0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x7c, 0x3, 0x83, 0xff, 0x80, 0x33,
+    0xff, 0xe0, 0x7, 0x7f, 0xe0, 0x0, 0x60, 0x6, 0x0, 0xe, 0x0, 0x60,
+    0x0, 0xe0, 0x6, 0x0, 0x1e, 0x0, 0x60, 0x1, 0xe0, 0x6, 0x0, 0x3e,
+    0x0, 0x60, 0x3, 0xe0, 0xf, 0x0, 0x7e, 0xff, 0xff, 0xe6, 0x67, 0xff,
+    0xfe, 0x66, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x63, 0xff, 0xfc,
+    0x6, 0x7f, 0xff, 0xc0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F01 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1,
+    0xf0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x7, 0x9c, 0x0, 0x0, 0xf0, 0xe0,
+    0x0, 0x1e, 0x7, 0x80, 0x3, 0xc0, 0x3e, 0x0, 0xf8, 0x20, 0xf8, 0x3e,
+    0x6, 0x7, 0xc7, 0xc0, 0x60, 0x3e, 0x70, 0x6, 0x0, 0xe0, 0x0, 0x60,
+    0x0, 0x3, 0x6, 0x0, 0x0, 0x70, 0x7f, 0xe0, 0x7, 0x7, 0xff, 0x0,
+    0x70, 0x7f, 0xe0, 0x7, 0x6, 0x0, 0x0, 0x70, 0x60, 0x0, 0x7, 0x6,
+    0x0, 0x0, 0x70, 0x60, 0x0, 0x7, 0x6, 0x0, 0x0, 0x70, 0x70, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4F11 */
+    0x1, 0x80, 0x40, 0x0, 0x38, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x30,
+    0xc, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x70, 0xc, 0x0, 0xe, 0x0, 0xe0,
+    0x0, 0xef, 0xff, 0xfe, 0x1e, 0x7f, 0xff, 0xe1, 0xe0, 0x1e, 0x0, 0x3e,
+    0x1, 0xf0, 0x3, 0xe0, 0x3f, 0x0, 0x76, 0x3, 0xf8, 0x6, 0x60, 0x7f,
+    0x80, 0x66, 0x6, 0xdc, 0x0, 0x60, 0xcc, 0xe0, 0x6, 0x1c, 0xce, 0x0,
+    0x61, 0x8c, 0x70, 0x6, 0x38, 0xc3, 0x80, 0x67, 0xc, 0x1c, 0x6, 0xe0,
+    0xc1, 0xe0, 0x6e, 0xc, 0xe, 0x6, 0xc0, 0xc0, 0x20, 0x60, 0xc, 0x0,
+    0x6, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x0, 0x4, 0x0, 0x40, 0x0,
+
+    /* U+4F30 */
+    0x0, 0x80, 0x40, 0x0, 0x18, 0xe, 0x0, 0x3, 0x80, 0xe0, 0x0, 0x38,
+    0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x6, 0x7f, 0xff,
+    0xe0, 0xe7, 0xff, 0xfe, 0xe, 0x0, 0xe0, 0x1, 0xe0, 0xe, 0x0, 0x1e,
+    0x0, 0xe0, 0x3, 0xe0, 0xe, 0x0, 0x7e, 0x0, 0xe0, 0x7, 0x60, 0xe,
+    0x0, 0x66, 0x1f, 0xff, 0x80, 0x61, 0xff, 0xf8, 0x6, 0x38, 0x1, 0xc0,
+    0x63, 0x80, 0x1c, 0x6, 0x38, 0x1, 0xc0, 0x63, 0x80, 0x1c, 0x6, 0x38,
+    0x1, 0xc0, 0x63, 0x80, 0x1c, 0x6, 0x38, 0x1, 0xc0, 0x63, 0xc0, 0x38,
+    0x6, 0x1f, 0xff, 0x80, 0x60, 0xff, 0xf0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+4F34 */
+    0x1, 0x0, 0x40, 0x0, 0x38, 0xe, 0x0, 0x3, 0x20, 0xe0, 0x80, 0x73,
+    0xe, 0x18, 0x7, 0x38, 0xe3, 0x80, 0x63, 0x8e, 0x38, 0xe, 0x18, 0xe3,
+    0x0, 0xe1, 0xce, 0x70, 0x1e, 0x0, 0xe0, 0x1, 0xe0, 0xe, 0x0, 0x3e,
+    0x7f, 0xff, 0xc3, 0xe7, 0xff, 0xfc, 0x7e, 0x0, 0xe0, 0x6, 0xe0, 0xe,
+    0x0, 0x6e, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0,
+    0xef, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xe0, 0xe0, 0xe, 0x0, 0xe, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0,
+    0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0x4, 0x0, 0x40, 0x0,
+
+    /* U+4F36 */
+    0x1, 0x0, 0x40, 0x0, 0x38, 0xe, 0x0, 0x3, 0x81, 0xe0, 0x0, 0x30,
+    0x3f, 0x0, 0x7, 0x7, 0x38, 0x0, 0x70, 0x71, 0xc0, 0x6, 0x1e, 0xe,
+    0x0, 0xe3, 0xc0, 0x78, 0xe, 0x78, 0x3, 0xc1, 0xef, 0xff, 0xde, 0x3f,
+    0xcf, 0xfe, 0xe3, 0xe8, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x6, 0xe0, 0x0,
+    0x0, 0x4e, 0x7f, 0xff, 0x0, 0xe7, 0xff, 0xf8, 0xe, 0x3, 0x83, 0x80,
+    0xe0, 0x38, 0x18, 0xe, 0x3, 0x81, 0x80, 0xe0, 0x38, 0x18, 0xe, 0x3,
+    0x81, 0x80, 0xe0, 0x38, 0x18, 0xe, 0x3, 0x8f, 0x80, 0xe0, 0x39, 0xf0,
+    0xe, 0x3, 0x9e, 0x0, 0xc0, 0x18, 0x0, 0x4, 0x1, 0x0, 0x0,
+
+    /* U+4F38 */
+    0x3, 0x0, 0x60, 0x0, 0x60, 0xc, 0x0, 0x1c, 0x1, 0x80, 0x3, 0x80,
+    0x30, 0x0, 0x60, 0xe, 0x0, 0x1c, 0x7f, 0xff, 0x83, 0x8f, 0xff, 0xf0,
+    0x73, 0x83, 0x6, 0x1e, 0x70, 0x60, 0xc3, 0xce, 0xc, 0x18, 0xf9, 0xc1,
+    0x83, 0x1f, 0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0xdc, 0xff, 0xff, 0x9b,
+    0x9c, 0x18, 0x30, 0x73, 0x83, 0x6, 0xe, 0x70, 0x60, 0xc1, 0xce, 0xc,
+    0x18, 0x38, 0xff, 0xff, 0x7, 0x1f, 0xff, 0xe0, 0xe0, 0xff, 0xf0, 0x1c,
+    0x0, 0xc0, 0x3, 0x80, 0x18, 0x0, 0x70, 0x3, 0x0, 0xe, 0x0, 0x60,
+    0x1, 0x80, 0xc, 0x0, 0x10, 0x1, 0x0, 0x0,
+
+    /* U+4F48 */
+    0x1, 0x80, 0xc0, 0x0, 0x18, 0xc, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x30,
+    0x1c, 0x0, 0x7, 0x3f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0xe, 0x7, 0x0,
+    0x0, 0xe0, 0x60, 0x0, 0x1e, 0xe, 0x70, 0x1, 0xe0, 0xc7, 0x0, 0x3e,
+    0x1c, 0x70, 0x3, 0xe3, 0xff, 0xf0, 0x76, 0x7f, 0xff, 0xc6, 0x6f, 0xff,
+    0xfc, 0x66, 0xdc, 0x70, 0xc0, 0x69, 0xc7, 0xc, 0x6, 0x1c, 0x70, 0xc0,
+    0x61, 0xc7, 0xc, 0x6, 0x1c, 0x70, 0xc0, 0x61, 0xc7, 0xc, 0x6, 0x1c,
+    0x70, 0xc0, 0x61, 0xc7, 0xc, 0x6, 0x1c, 0x77, 0xc0, 0x61, 0xc7, 0x7c,
+    0x6, 0x8, 0x72, 0x0, 0x60, 0x7, 0x0, 0x4, 0x0, 0x20, 0x0,
+
+    /* U+4F4D */
+    0x1, 0x80, 0x40, 0x0, 0x38, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x30,
+    0xc, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x60, 0xe, 0x0, 0xe, 0x7f, 0xff,
+    0xe0, 0xe7, 0xff, 0xfc, 0x1e, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x3e,
+    0x10, 0x3, 0x3, 0xe1, 0x80, 0x70, 0x7e, 0x18, 0x7, 0x6, 0xe1, 0xc0,
+    0x60, 0x6e, 0x1c, 0x6, 0x0, 0xe1, 0xc0, 0x60, 0xe, 0xc, 0xe, 0x0,
+    0xe0, 0xc0, 0xc0, 0xe, 0xe, 0xc, 0x0, 0xe0, 0xe0, 0xc0, 0xe, 0x6,
+    0x1c, 0x0, 0xe0, 0x1, 0x80, 0xe, 0x0, 0x18, 0x0, 0xef, 0xff, 0xfe,
+    0xe, 0xff, 0xff, 0xe0, 0xe0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F4E */
+    0x1, 0x0, 0x0, 0x80, 0x30, 0x3, 0xfc, 0x3, 0xf, 0xff, 0x80, 0x73,
+    0xff, 0x80, 0x6, 0x38, 0x30, 0x0, 0x63, 0x83, 0x0, 0xe, 0x30, 0x30,
+    0x0, 0xe3, 0x3, 0x0, 0x1e, 0x30, 0x30, 0x1, 0xe3, 0x83, 0x80, 0x3e,
+    0x3f, 0xff, 0xe3, 0xe3, 0xff, 0xfe, 0x7e, 0x30, 0x38, 0x6, 0xe3, 0x3,
+    0x80, 0x6e, 0x30, 0x18, 0x0, 0xe3, 0x1, 0x80, 0xe, 0x30, 0x18, 0x0,
+    0xe3, 0x1, 0xc0, 0xe, 0x30, 0x5c, 0x0, 0xe3, 0x3c, 0xc6, 0xe, 0x3f,
+    0x8e, 0x60, 0xe7, 0xe0, 0x66, 0xe, 0xf8, 0x7, 0x60, 0xec, 0x0, 0x3e,
+    0xe, 0x3f, 0xfb, 0xe0, 0xe1, 0xff, 0x1c, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F4F */
+    0x1, 0x80, 0x0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81, 0xe0, 0x0, 0x30,
+    0xf, 0x0, 0x7, 0x0, 0x30, 0x0, 0x70, 0x0, 0x0, 0xe, 0x3f, 0xff,
+    0xc0, 0xe7, 0xff, 0xfe, 0x1e, 0x3f, 0xff, 0xc1, 0xe0, 0x6, 0x0, 0x3e,
+    0x0, 0x60, 0x3, 0xe0, 0x6, 0x0, 0x7e, 0x0, 0x60, 0x6, 0x60, 0x6,
+    0x0, 0x66, 0xf, 0xff, 0x0, 0x63, 0xff, 0xfc, 0x6, 0x1f, 0xff, 0x80,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x63, 0xff, 0xfc,
+    0x6, 0xff, 0xff, 0xe0, 0x67, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F51 */
+    0x1, 0x0, 0x80, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x1, 0x80, 0x0, 0x70,
+    0x18, 0x0, 0x6, 0x3, 0x80, 0x0, 0x67, 0xff, 0xfe, 0xe, 0xff, 0xff,
+    0xe0, 0xe7, 0xff, 0xfc, 0x1e, 0x7, 0x0, 0x1, 0xe0, 0x60, 0x0, 0x3e,
+    0xe, 0x0, 0x3, 0xe0, 0xc0, 0x0, 0x7e, 0x1c, 0x0, 0x6, 0xe1, 0xff,
+    0xf0, 0x6e, 0x3f, 0xff, 0x84, 0xe7, 0xff, 0xfc, 0xe, 0x7c, 0x1, 0xc0,
+    0xee, 0xc0, 0x1c, 0xf, 0xcc, 0x1, 0xc0, 0xe8, 0xc0, 0x1c, 0xe, 0xc,
+    0x1, 0xc0, 0xe0, 0xc0, 0x1c, 0xe, 0xc, 0x1, 0xc0, 0xe0, 0xc0, 0x1c,
+    0xe, 0xf, 0xff, 0x80, 0xc0, 0xff, 0xf8, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F54 */
+    0x0, 0x80, 0xc0, 0x0, 0x1c, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x38,
+    0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x70, 0xc, 0x0, 0x6, 0x0, 0xff,
+    0xe0, 0xe0, 0xf, 0xfe, 0xe, 0x0, 0xe0, 0x1, 0xe0, 0xc, 0x0, 0x1e,
+    0x0, 0xc0, 0x3, 0xe0, 0xc, 0x0, 0x7e, 0x0, 0xc0, 0x7, 0x60, 0x1e,
+    0x0, 0x66, 0x1f, 0xff, 0x80, 0x63, 0xff, 0xfc, 0x6, 0x38, 0x1, 0xc0,
+    0x63, 0x0, 0x1c, 0x6, 0x30, 0x1, 0xc0, 0x63, 0x0, 0x1c, 0x6, 0x30,
+    0x1, 0xc0, 0x63, 0x0, 0x1c, 0x6, 0x30, 0x1, 0xc0, 0x63, 0x80, 0x1c,
+    0x6, 0x3f, 0xff, 0xc0, 0x61, 0xff, 0xf8, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+4F55 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xe0, 0x37,
+    0xff, 0xfe, 0x7, 0x0, 0x3, 0x80, 0x60, 0x0, 0x18, 0xe, 0x0, 0x1,
+    0x80, 0xe0, 0x0, 0x18, 0x1e, 0x1f, 0xe1, 0x81, 0xe1, 0xfe, 0x18, 0x3e,
+    0x38, 0x71, 0x83, 0xe3, 0x87, 0x18, 0x7e, 0x38, 0x71, 0x86, 0x63, 0x87,
+    0x18, 0x66, 0x38, 0x71, 0x80, 0x63, 0x87, 0x18, 0x6, 0x38, 0x71, 0x80,
+    0x61, 0xfe, 0x18, 0x6, 0x1f, 0xe1, 0x80, 0x60, 0x0, 0x18, 0x6, 0x0,
+    0x1, 0x80, 0x60, 0x0, 0x18, 0x6, 0x0, 0x1, 0x80, 0x60, 0x0, 0x38,
+    0x6, 0x0, 0x3f, 0x80, 0x60, 0x3, 0xf0, 0x4, 0x0, 0x1c, 0x0,
+
+    /* U+4F59 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xbc, 0x0, 0x0, 0x71, 0xe0, 0x0, 0xe, 0x7, 0x0, 0x3, 0xc0, 0x3c,
+    0x0, 0xf8, 0x1, 0xf0, 0x3e, 0x0, 0x7, 0xc7, 0xdf, 0xff, 0xbe, 0x71,
+    0xff, 0xf8, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0xf, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x80,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x38, 0x61, 0xc0, 0x7, 0x86,
+    0x1e, 0x0, 0xf0, 0x60, 0xf0, 0x1e, 0x6, 0x7, 0x83, 0xc0, 0x60, 0x3c,
+    0x70, 0x3e, 0x0, 0xe2, 0x7, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F5B */
+    0x3, 0x2, 0x10, 0x0, 0x60, 0xc7, 0x0, 0x1c, 0x18, 0xe0, 0x3, 0x83,
+    0x9c, 0x0, 0x6f, 0xff, 0xfc, 0x1d, 0xff, 0xff, 0x83, 0x81, 0x8e, 0x30,
+    0x60, 0x31, 0xc6, 0x1c, 0x6, 0x38, 0xc3, 0x87, 0xff, 0xf8, 0xf3, 0xff,
+    0xff, 0x1e, 0x73, 0x9c, 0x7, 0xcc, 0x63, 0x80, 0xd9, 0x8c, 0x70, 0x1b,
+    0x31, 0x8e, 0x0, 0x67, 0xff, 0xfe, 0xc, 0xff, 0xff, 0xe1, 0x81, 0xc7,
+    0x1c, 0x30, 0x38, 0xe1, 0x86, 0x6, 0x1c, 0x70, 0xc0, 0xc3, 0x8e, 0x18,
+    0x38, 0x71, 0xc3, 0xe, 0xe, 0xf0, 0x63, 0x81, 0xde, 0xc, 0xf0, 0x38,
+    0x1, 0xb8, 0x7, 0x0, 0x10, 0x0, 0x40, 0x0,
+
+    /* U+4F5C */
+    0x1, 0x82, 0x0, 0x0, 0x38, 0x70, 0x0, 0x3, 0x86, 0x0, 0x0, 0x30,
+    0xe0, 0x0, 0x7, 0xf, 0xff, 0xc0, 0x71, 0xff, 0xfe, 0x6, 0x1f, 0xff,
+    0xc0, 0xe3, 0x8e, 0x0, 0xe, 0x38, 0xe0, 0x1, 0xe7, 0xe, 0x0, 0x3e,
+    0xe0, 0xe0, 0x3, 0xec, 0xf, 0xf8, 0x7e, 0x0, 0xff, 0xc6, 0x60, 0xe,
+    0x0, 0x66, 0x0, 0xe0, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0xe0, 0x0,
+    0x60, 0xe, 0x0, 0x6, 0x0, 0xff, 0xe0, 0x60, 0xf, 0xfc, 0x6, 0x0,
+    0xe0, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0xe0, 0x0, 0x60, 0xe, 0x0,
+    0x6, 0x0, 0xe0, 0x0, 0x60, 0xc, 0x0, 0x4, 0x0, 0x40, 0x0,
+
+    /* U+4F60 */
+    0x1, 0x82, 0x0, 0x0, 0x38, 0x70, 0x0, 0x3, 0x86, 0x0, 0x0, 0x30,
+    0xe0, 0x0, 0x7, 0xe, 0x0, 0x0, 0x61, 0xff, 0xfe, 0xe, 0x1f, 0xff,
+    0xe0, 0xe1, 0x87, 0x6, 0x1e, 0x38, 0x70, 0xe1, 0xe3, 0x7, 0xc, 0x3e,
+    0x70, 0x71, 0xc3, 0xe6, 0x7, 0x18, 0x7e, 0x0, 0x70, 0x6, 0xe0, 0x47,
+    0x30, 0x4e, 0xe, 0x73, 0x0, 0xe0, 0xc7, 0x38, 0xe, 0xc, 0x73, 0x80,
+    0xe1, 0xc7, 0x18, 0xe, 0x18, 0x71, 0xc0, 0xe3, 0x87, 0x1c, 0xe, 0x30,
+    0x70, 0xc0, 0xe7, 0x7, 0xe, 0xe, 0x60, 0x70, 0xe0, 0xe0, 0x7, 0x0,
+    0xe, 0x0, 0xe0, 0x0, 0xe0, 0x7e, 0x0, 0x4, 0x3, 0xc0, 0x0,
+
+    /* U+4F73 */
+    0x3, 0x0, 0x40, 0x0, 0x30, 0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xe, 0x0, 0x6, 0x3f, 0xff, 0xc0, 0xe3, 0xff, 0xf8, 0xe, 0x0, 0xe0,
+    0x0, 0xe0, 0xe, 0x0, 0x1e, 0x0, 0xe0, 0x1, 0xe0, 0xe, 0x0, 0x3e,
+    0xff, 0xff, 0xe3, 0xef, 0xff, 0xfe, 0x7e, 0x0, 0x0, 0x6, 0xe0, 0x4,
+    0x0, 0x6e, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0,
+    0xe7, 0xff, 0xfc, 0xe, 0x3f, 0xff, 0xc0, 0xe0, 0xe, 0x0, 0xe, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0,
+    0xe, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4F7F */
+    0x3, 0x0, 0x40, 0x0, 0x30, 0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x77,
+    0xff, 0xfc, 0x6, 0xff, 0xff, 0xe0, 0x67, 0xff, 0xfc, 0xe, 0x0, 0xe0,
+    0x0, 0xc0, 0xe, 0x0, 0x1c, 0x3f, 0xff, 0x81, 0xc7, 0xff, 0xfc, 0x3c,
+    0x60, 0xe0, 0xc3, 0xc6, 0xc, 0xc, 0x7c, 0x60, 0xc0, 0xc6, 0xc6, 0xc,
+    0xc, 0x6c, 0x7f, 0xff, 0xc0, 0xc7, 0xff, 0xfc, 0xc, 0x0, 0xc0, 0x0,
+    0xc3, 0xc, 0x0, 0xc, 0x39, 0xc0, 0x0, 0xc1, 0xdc, 0x0, 0xc, 0xf,
+    0x80, 0x0, 0xc0, 0x78, 0x0, 0xc, 0x7, 0xf0, 0x0, 0xc1, 0xef, 0xf0,
+    0xc, 0x7c, 0x3f, 0xe0, 0xcf, 0x0, 0x7e, 0x4, 0xc0, 0x0, 0x0,
+
+    /* U+4F86 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0,
+    0x0, 0x30, 0x60, 0x40, 0x7, 0x6, 0xe, 0x0, 0x70, 0x60, 0xc0, 0xf,
+    0x6, 0x1c, 0x1, 0xf8, 0x63, 0xf0, 0x1d, 0xc6, 0x33, 0x83, 0x8e, 0x67,
+    0x1c, 0x38, 0x6e, 0x60, 0xc7, 0x1, 0xf0, 0x0, 0x0, 0x3f, 0x80, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0xe6, 0xf0, 0x0, 0x1c, 0x63, 0xc0, 0x7, 0x86,
+    0x1e, 0x1, 0xf0, 0x60, 0xf8, 0x7c, 0x6, 0x3, 0xe7, 0x80, 0x60, 0x1e,
+    0x60, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+4F8B */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x18, 0x1b, 0xff, 0x3, 0x3, 0x3f,
+    0xe0, 0x60, 0xe1, 0x81, 0x8c, 0x18, 0x30, 0x31, 0x83, 0xe, 0x6, 0x30,
+    0xe1, 0xf8, 0xc6, 0x1c, 0x3f, 0xd8, 0xc3, 0x87, 0xfb, 0x18, 0xf1, 0xc7,
+    0x63, 0x1e, 0x30, 0xec, 0x67, 0xce, 0x19, 0x8c, 0xd9, 0x83, 0x31, 0x9b,
+    0x76, 0x66, 0x30, 0x6c, 0xfc, 0xc6, 0xd, 0xf, 0x18, 0xc1, 0x80, 0xe3,
+    0x18, 0x30, 0x18, 0x63, 0x6, 0x7, 0xc, 0x60, 0xc1, 0xc0, 0x8c, 0x18,
+    0x38, 0x1, 0x83, 0xe, 0x0, 0x30, 0x63, 0x80, 0x6, 0xd, 0xe0, 0x7,
+    0xc1, 0xb8, 0x1, 0xf8, 0x30, 0x0, 0x1c, 0x0,
+
+    /* U+4F9D */
+    0x1, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x70,
+    0xc, 0x0, 0x6, 0x1, 0xe0, 0x0, 0xef, 0xff, 0xfe, 0xe, 0xff, 0xff,
+    0xe0, 0xe0, 0x1e, 0x0, 0x1e, 0x3, 0xe0, 0x1, 0xe0, 0x36, 0x0, 0x3e,
+    0x7, 0x70, 0xc3, 0xe0, 0x63, 0x1c, 0x7e, 0xe, 0x33, 0x86, 0xe0, 0xe3,
+    0x38, 0x6e, 0x1e, 0x3f, 0x0, 0xe3, 0xe1, 0xe0, 0xe, 0x7e, 0x1c, 0x0,
+    0xee, 0xe0, 0xc0, 0xe, 0xee, 0xe, 0x0, 0xfc, 0xe0, 0x60, 0xe, 0xe,
+    0x7, 0x0, 0xe0, 0xe1, 0x38, 0xe, 0xe, 0xf9, 0xc0, 0xe0, 0xff, 0x1e,
+    0xe, 0x3f, 0xc0, 0xe0, 0xc7, 0xc0, 0x2, 0x4, 0x20, 0x0, 0x0,
+
+    /* U+4FAF */
+    0x1, 0x0, 0x0, 0x0, 0x39, 0xff, 0x80, 0x3, 0x1f, 0xfe, 0x0, 0x70,
+    0x0, 0xf0, 0x7, 0x0, 0x7, 0x0, 0x60, 0x0, 0x70, 0xe, 0x0, 0x7,
+    0x0, 0xef, 0xff, 0xfe, 0x1e, 0x7f, 0xff, 0xe1, 0xe0, 0x40, 0x0, 0x3e,
+    0xc, 0x0, 0x3, 0xe1, 0xff, 0xf8, 0x7e, 0x3f, 0xff, 0x86, 0xe3, 0xe,
+    0x0, 0x6e, 0x60, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0,
+    0xef, 0xff, 0xfe, 0xe, 0x7f, 0xff, 0xc0, 0xe0, 0x1f, 0x0, 0xe, 0x1,
+    0xf0, 0x0, 0xe0, 0x39, 0x80, 0xe, 0x7, 0xe, 0x0, 0xe1, 0xe0, 0x78,
+    0xe, 0x7c, 0x3, 0xe0, 0xef, 0x0, 0x1e, 0x4, 0x40, 0x0, 0x0,
+
+    /* U+4FB5 */
+    0x3, 0x0, 0x0, 0x0, 0x33, 0xff, 0xe0, 0x7, 0x7f, 0xff, 0x80, 0x70,
+    0x0, 0x38, 0x6, 0x0, 0x3, 0x80, 0xef, 0xff, 0xfe, 0xe, 0xff, 0xff,
+    0xe0, 0xc0, 0x0, 0x38, 0x1c, 0x3f, 0xff, 0x81, 0xc7, 0xff, 0xf0, 0x3c,
+    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x7c, 0xff, 0xff, 0xc6, 0xcf, 0xff,
+    0xfe, 0x6c, 0xc0, 0x0, 0xe0, 0xcc, 0x0, 0x6, 0xc, 0xff, 0xff, 0x60,
+    0xc1, 0xff, 0xf0, 0xc, 0x18, 0x7, 0x0, 0xc1, 0xc0, 0xe0, 0xc, 0xf,
+    0x1c, 0x0, 0xc0, 0x3f, 0x80, 0xc, 0x1, 0xf0, 0x0, 0xc0, 0xff, 0xe0,
+    0xc, 0x7f, 0x1f, 0xe0, 0xdf, 0x80, 0x7e, 0xc, 0x0, 0x0, 0x0,
+
+    /* U+4FBF */
+    0x1, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xfc, 0x3, 0x7f, 0xff, 0xe0, 0x73,
+    0xff, 0xfc, 0x7, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0xe, 0x3f, 0xff,
+    0x80, 0xe3, 0xff, 0xfc, 0x1e, 0x30, 0x61, 0xc1, 0xe3, 0x6, 0xc, 0x3e,
+    0x3f, 0xff, 0xc3, 0xe3, 0xff, 0xfc, 0x7e, 0x30, 0xe1, 0xc6, 0xe3, 0x6,
+    0xc, 0x6e, 0x38, 0xe1, 0xc0, 0xe3, 0xff, 0xfc, 0xe, 0x1f, 0xff, 0x80,
+    0xe0, 0xc, 0x0, 0xe, 0x18, 0xc0, 0x0, 0xe1, 0xcc, 0x0, 0xe, 0xf,
+    0x80, 0x0, 0xe0, 0x78, 0x0, 0xe, 0xf, 0xf0, 0x0, 0xe3, 0xe7, 0xf0,
+    0xe, 0xfc, 0x1f, 0xe0, 0xff, 0x0, 0x7e, 0x4, 0x80, 0x0, 0x40,
+
+    /* U+4FC2 */
+    0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x38, 0x3, 0x83, 0xff, 0x80, 0x3f,
+    0xff, 0xf0, 0x3, 0x7f, 0xe0, 0x0, 0x70, 0x1c, 0x0, 0x6, 0x3, 0x82,
+    0x0, 0x60, 0x30, 0xe0, 0xe, 0x77, 0xe, 0x0, 0xe3, 0xe1, 0xc0, 0x1e,
+    0x1e, 0x38, 0x3, 0xe0, 0x77, 0x0, 0x3e, 0x3, 0xe1, 0x7, 0xe0, 0x1c,
+    0x38, 0x6e, 0x1, 0x81, 0xc6, 0xe0, 0x39, 0xfc, 0xe, 0xff, 0xff, 0xe0,
+    0xef, 0xfe, 0x6, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x20, 0xe, 0x18,
+    0xe7, 0x0, 0xe3, 0x8e, 0x38, 0xe, 0x38, 0xe3, 0x80, 0xe7, 0xe, 0x1c,
+    0xe, 0xe0, 0xe0, 0xe0, 0xec, 0xe, 0x6, 0xe, 0x0, 0xe0, 0x0, 0x40,
+    0x4, 0x0,
+
+    /* U+4FC3 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x9f, 0xff, 0x80, 0x73,
+    0xff, 0xfc, 0x7, 0x38, 0x0, 0xc0, 0x63, 0x80, 0xc, 0xe, 0x38, 0x0,
+    0xc0, 0xe3, 0x80, 0xc, 0x1e, 0x38, 0x0, 0xc1, 0xe3, 0x80, 0x1c, 0x3e,
+    0x1f, 0xff, 0xc3, 0xe1, 0xff, 0xf8, 0x7e, 0x0, 0x70, 0x6, 0xe0, 0x7,
+    0x0, 0x6e, 0x18, 0x70, 0x0, 0xe1, 0x87, 0x0, 0xe, 0x18, 0x7f, 0xc0,
+    0xe1, 0x87, 0xfc, 0xe, 0x18, 0x70, 0x0, 0xe3, 0x87, 0x0, 0xe, 0x3c,
+    0x70, 0x0, 0xe3, 0xe7, 0x0, 0xe, 0x77, 0x70, 0x0, 0xee, 0x3f, 0x0,
+    0xe, 0xe0, 0xff, 0xe0, 0xfc, 0x3, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4FC4 */
+    0x1, 0x0, 0x10, 0x0, 0x38, 0x1b, 0x80, 0x3, 0xbf, 0xb9, 0x0, 0x3f,
+    0xf3, 0x98, 0x7, 0x1c, 0x39, 0xc0, 0x60, 0xc3, 0x8c, 0xe, 0xc, 0x38,
+    0x0, 0xe0, 0xc3, 0x80, 0x1c, 0xff, 0xff, 0xc1, 0xdf, 0xff, 0xfe, 0x3c,
+    0xff, 0xff, 0xc3, 0xc0, 0xc1, 0x80, 0x6c, 0xc, 0x18, 0x6, 0xc0, 0xc1,
+    0x8c, 0xc, 0xd, 0x99, 0xc0, 0xc1, 0xf9, 0x98, 0xc, 0xff, 0x1b, 0x80,
+    0xdf, 0xc1, 0xf0, 0xc, 0xc, 0x1e, 0x0, 0xc0, 0xc0, 0xe0, 0xc, 0xc,
+    0x1c, 0x20, 0xc0, 0xc3, 0xe6, 0xc, 0xc, 0x76, 0x60, 0xc1, 0xce, 0x76,
+    0xc, 0x7d, 0xc3, 0xe0, 0xcf, 0x80, 0x3e, 0xc, 0x70, 0x0, 0xc0,
+
+    /* U+4FCA */
+    0x1, 0x1, 0x80, 0x0, 0x38, 0x38, 0x0, 0x3, 0x3, 0xe, 0x0, 0x70,
+    0x70, 0x70, 0x7, 0x6, 0x3, 0x80, 0x67, 0xff, 0xfc, 0xe, 0x7f, 0xf8,
+    0xe0, 0xe0, 0x63, 0x0, 0x1e, 0x6, 0x30, 0x1, 0xe0, 0xe3, 0x6, 0x3e,
+    0xc, 0x38, 0xe3, 0xe3, 0xc1, 0xfe, 0x7e, 0x79, 0xf, 0xc6, 0xe6, 0x30,
+    0x0, 0x6e, 0x7, 0x0, 0x0, 0xe0, 0xff, 0xf0, 0xe, 0xf, 0xff, 0x80,
+    0xe3, 0xf0, 0x70, 0xe, 0x7b, 0x7, 0x0, 0xef, 0x38, 0xe0, 0xe, 0x41,
+    0x9c, 0x0, 0xe0, 0xf, 0x80, 0xe, 0x0, 0xf8, 0x0, 0xe0, 0x7f, 0xf0,
+    0xe, 0x7f, 0xf, 0xe0, 0xef, 0xc0, 0x3e, 0x4, 0x40, 0x0, 0x0,
+
+    /* U+4FDD */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0xff, 0xe0, 0x3, 0x3f, 0xff, 0x80, 0x73,
+    0x80, 0x38, 0x7, 0x30, 0x1, 0x80, 0x63, 0x0, 0x18, 0xe, 0x30, 0x1,
+    0x80, 0xe3, 0x0, 0x18, 0x1e, 0x3f, 0xff, 0x81, 0xe3, 0xff, 0xf8, 0x3e,
+    0x0, 0xe0, 0x3, 0xe0, 0xe, 0x0, 0x7e, 0x0, 0xe0, 0x6, 0xe7, 0xff,
+    0xfe, 0x6e, 0xff, 0xff, 0xe0, 0xe0, 0x1f, 0x0, 0xe, 0x1, 0xf0, 0x0,
+    0xe0, 0x3f, 0x80, 0xe, 0x6, 0xfc, 0x0, 0xe0, 0xee, 0xe0, 0xe, 0x1c,
+    0xe7, 0x0, 0xe7, 0x8e, 0x3c, 0xe, 0xf0, 0xe1, 0xe0, 0xee, 0xe, 0xe,
+    0xe, 0x80, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0x4, 0x0, 0x40, 0x0,
+
+    /* U+4FE1 */
+    0x1, 0x80, 0x0, 0x0, 0x39, 0xff, 0xf8, 0x3, 0xbf, 0xff, 0x80, 0x30,
+    0xff, 0xf0, 0x7, 0x0, 0x0, 0x0, 0x67, 0xff, 0xfc, 0xe, 0xff, 0xff,
+    0xe0, 0xef, 0xff, 0xfe, 0x1e, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x3e,
+    0x3f, 0xff, 0x83, 0xe1, 0xff, 0xf8, 0x7e, 0x0, 0x0, 0x6, 0xe0, 0x0,
+    0x0, 0x6e, 0x1f, 0xff, 0x80, 0xe1, 0xff, 0xf8, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x1f, 0xff, 0x80, 0xe3, 0xff, 0xfc, 0xe, 0x38,
+    0x1, 0xc0, 0xe3, 0x0, 0xc, 0xe, 0x30, 0x0, 0xc0, 0xe3, 0x80, 0x1c,
+    0xe, 0x3f, 0xff, 0xc0, 0xe1, 0xff, 0xf8, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+4FEE */
+    0x2, 0x1, 0x0, 0x0, 0x70, 0x30, 0x0, 0x7, 0x3, 0x0, 0x0, 0x60,
+    0x7f, 0xfe, 0xe, 0xc7, 0xff, 0xc0, 0xcc, 0xf0, 0x70, 0xc, 0xdd, 0x8e,
+    0x0, 0xcd, 0x9d, 0xc0, 0x1c, 0xc0, 0xf8, 0x1, 0xcc, 0x7, 0x80, 0x3c,
+    0xc1, 0xfc, 0x3, 0xcc, 0x7d, 0xfc, 0x7c, 0xdf, 0x3, 0xe6, 0xcd, 0xc1,
+    0x8e, 0x4c, 0xc0, 0xf8, 0x0, 0xcc, 0x3e, 0x0, 0xc, 0xcf, 0x83, 0x0,
+    0xcc, 0xe1, 0xf0, 0xc, 0xc0, 0x7c, 0x0, 0xcc, 0x3f, 0xe, 0xc, 0xcf,
+    0xc3, 0xe0, 0xcc, 0xc0, 0xfc, 0xc, 0xc0, 0x3f, 0x0, 0xc0, 0x3f, 0xc0,
+    0xc, 0x1f, 0xe0, 0x0, 0xc3, 0xf0, 0x0, 0xc, 0x0, 0x0, 0x0,
+
+    /* U+5009 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x7,
+    0x9c, 0x0, 0x0, 0xe0, 0xf0, 0x0, 0x3c, 0x3, 0xe0, 0xf, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0x7e, 0x78, 0x0, 0x1, 0xe4, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x6, 0x0, 0x7, 0x0, 0x7f, 0xff,
+    0xf0, 0x7, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xe0, 0xc, 0x0, 0x0, 0x0, 0xc7, 0xff, 0xc0, 0x1d, 0xff,
+    0xff, 0x3, 0x9c, 0x0, 0x70, 0x39, 0x80, 0x3, 0x7, 0x18, 0x0, 0x70,
+    0x61, 0xff, 0xff, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+500B */
+    0x3, 0x0, 0x0, 0x0, 0x63, 0xff, 0xe0, 0x1d, 0xff, 0xff, 0x3, 0xbf,
+    0xff, 0xe0, 0x66, 0x4, 0xc, 0x1c, 0xc1, 0x81, 0x83, 0x98, 0x30, 0x30,
+    0x73, 0x6, 0x6, 0x1c, 0x6f, 0xfe, 0xc3, 0x8d, 0xff, 0xd8, 0xf1, 0x83,
+    0x3, 0x1e, 0x30, 0x60, 0x67, 0xc6, 0xc, 0xc, 0xd8, 0xc7, 0xf1, 0x9b,
+    0x19, 0xff, 0x30, 0x63, 0x38, 0xe6, 0xc, 0x66, 0xc, 0xc1, 0x8c, 0xc1,
+    0x98, 0x31, 0x98, 0x33, 0x6, 0x33, 0x8e, 0x60, 0xc6, 0x3f, 0x8c, 0x18,
+    0xc3, 0xe1, 0x83, 0x18, 0x0, 0x30, 0x63, 0x80, 0xe, 0xc, 0x7f, 0xff,
+    0xc1, 0x87, 0xff, 0xf0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+5011 */
+    0x3, 0x0, 0x0, 0x0, 0x67, 0xc1, 0xf0, 0x1d, 0xfc, 0x7f, 0x3, 0xb9,
+    0xdc, 0x60, 0x66, 0x1b, 0xc, 0x1c, 0xc3, 0x61, 0x83, 0x18, 0xee, 0x30,
+    0x63, 0xfd, 0xfe, 0x1c, 0x7f, 0xbf, 0xc3, 0x8c, 0x36, 0x18, 0xf1, 0x86,
+    0xc3, 0x1e, 0x31, 0xdc, 0x67, 0xc7, 0xfb, 0xfc, 0xd8, 0xfe, 0x3f, 0x93,
+    0x18, 0x0, 0x30, 0x63, 0x0, 0x6, 0xc, 0x60, 0x0, 0xc1, 0x8c, 0x0,
+    0x18, 0x31, 0x80, 0x3, 0x6, 0x30, 0x0, 0x60, 0xc6, 0x0, 0xc, 0x18,
+    0xc0, 0x1, 0x83, 0x18, 0x0, 0x30, 0x63, 0x0, 0x6, 0xc, 0x60, 0x7,
+    0xc1, 0x8c, 0x1, 0xf8, 0x31, 0x0, 0x1e, 0x0,
+
+    /* U+5012 */
+    0x1, 0x0, 0x0, 0x0, 0x60, 0x0, 0x18, 0x1f, 0xff, 0x83, 0x3, 0xbf,
+    0xee, 0x60, 0x61, 0x81, 0xcc, 0x1c, 0x30, 0x39, 0x83, 0xe, 0x47, 0x30,
+    0x61, 0x8c, 0xe6, 0x1c, 0x31, 0x9c, 0xc3, 0x86, 0x7b, 0x98, 0xf3, 0xff,
+    0x73, 0x1e, 0xfe, 0x3e, 0x67, 0xc0, 0xc1, 0xcc, 0xd8, 0x18, 0x39, 0x9b,
+    0x3, 0x7, 0x30, 0x67, 0xfc, 0xe6, 0xc, 0xff, 0xdc, 0xc1, 0x83, 0x83,
+    0x98, 0x30, 0x30, 0x73, 0x6, 0x6, 0xe, 0x60, 0xc0, 0xc0, 0x8c, 0x18,
+    0x19, 0x81, 0x83, 0x1f, 0xf0, 0x30, 0x6f, 0xf8, 0x6, 0xd, 0xc0, 0x7,
+    0xc1, 0x80, 0x1, 0xf8, 0x30, 0x0, 0x1c, 0x0,
+
+    /* U+5019 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x7f, 0xc0, 0x7, 0xf, 0xff, 0x0, 0x60,
+    0x0, 0x70, 0x6, 0x0, 0x3, 0x0, 0xec, 0x0, 0x30, 0xc, 0xc0, 0x7,
+    0x80, 0xcd, 0xff, 0xfe, 0x1c, 0xcf, 0xff, 0xc1, 0xcc, 0x30, 0x0, 0x3c,
+    0xc7, 0x0, 0x3, 0xcc, 0x7f, 0xf8, 0x7c, 0xcf, 0xff, 0x86, 0xcc, 0xc7,
+    0x0, 0x6c, 0xd8, 0x70, 0x0, 0xcc, 0x7, 0x0, 0xc, 0xc0, 0x70, 0x0,
+    0xcd, 0xff, 0xfe, 0xc, 0xdf, 0xff, 0xe0, 0xcc, 0xf, 0x0, 0xc, 0xc0,
+    0xf8, 0x0, 0xcc, 0x1c, 0xc0, 0xc, 0xc3, 0x8f, 0x0, 0xc0, 0x78, 0x78,
+    0xc, 0x1e, 0x3, 0xe0, 0xc3, 0xc0, 0xe, 0xc, 0x30, 0x0, 0x0,
+
+    /* U+502B */
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0x0, 0x1, 0x81, 0xc0, 0x0, 0x38,
+    0x1e, 0x0, 0x3, 0x83, 0xf0, 0x0, 0x70, 0x73, 0x80, 0x7, 0xe, 0x1c,
+    0x0, 0x61, 0xc0, 0xe0, 0xe, 0x38, 0x7, 0x0, 0xc7, 0xff, 0xfc, 0x1c,
+    0xff, 0xff, 0xe3, 0xdc, 0x0, 0xe, 0x3c, 0x80, 0x0, 0x7, 0xc3, 0xff,
+    0xf0, 0x6c, 0x7f, 0xff, 0x84, 0xc7, 0x73, 0xbc, 0xc, 0xe3, 0x31, 0xc0,
+    0xce, 0x33, 0x1c, 0xc, 0xe7, 0x31, 0xc0, 0xcf, 0xff, 0xfc, 0xc, 0xff,
+    0xff, 0xc0, 0xce, 0x33, 0x1c, 0xc, 0xe3, 0x31, 0xc0, 0xce, 0x33, 0x1c,
+    0xc, 0xe3, 0x31, 0xc0, 0xce, 0x33, 0x38, 0xc, 0xe3, 0x37, 0x80, 0xc4,
+    0x0, 0x30,
+
+    /* U+503C */
+    0x1, 0x0, 0x30, 0x0, 0x38, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x73,
+    0xff, 0xfe, 0x7, 0x7f, 0xff, 0xe0, 0x60, 0x7, 0x0, 0xe, 0x0, 0x30,
+    0x0, 0xe0, 0x7, 0x0, 0x1e, 0x63, 0xff, 0x81, 0xe6, 0x3f, 0xf8, 0x3e,
+    0x67, 0x1, 0x83, 0xe6, 0x70, 0x18, 0x7e, 0x67, 0xff, 0x86, 0xe6, 0x7f,
+    0xf8, 0x6e, 0x67, 0x1, 0x80, 0xe6, 0x70, 0x18, 0xe, 0x67, 0xff, 0x80,
+    0xe6, 0x7f, 0xf8, 0xe, 0x67, 0x1, 0x80, 0xe6, 0x70, 0x18, 0xe, 0x63,
+    0xff, 0x80, 0xe6, 0x3f, 0xf8, 0xe, 0x60, 0x0, 0x0, 0xe7, 0x0, 0x0,
+    0xe, 0x7f, 0xff, 0xe0, 0xe3, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5047 */
+    0x2, 0x0, 0x0, 0x0, 0x73, 0xe3, 0xf0, 0x7, 0x7f, 0x3f, 0x80, 0x67,
+    0xf9, 0xfc, 0xe, 0xe1, 0x81, 0xc0, 0xee, 0x18, 0x1c, 0xc, 0xe1, 0x81,
+    0xc0, 0xce, 0x38, 0x1c, 0x1c, 0xff, 0xbf, 0xc1, 0xcf, 0xf3, 0xf8, 0x3c,
+    0xe0, 0x0, 0x3, 0xce, 0x0, 0x0, 0x7c, 0xe0, 0x7f, 0x86, 0xce, 0x7,
+    0xfc, 0x4c, 0xff, 0x1, 0xc0, 0xcf, 0xe2, 0x1c, 0xc, 0xe0, 0x31, 0x80,
+    0xce, 0x3, 0x38, 0xc, 0xe0, 0x3b, 0x0, 0xce, 0x1, 0xf0, 0xc, 0xff,
+    0x1e, 0x0, 0xcf, 0xf1, 0xe0, 0xc, 0xe0, 0x3f, 0x0, 0xce, 0xf, 0xbc,
+    0xc, 0xe1, 0xe1, 0xe0, 0xc6, 0x3c, 0xe, 0xc, 0x40, 0x0, 0x0,
+
+    /* U+5049 */
+    0x1, 0x1, 0x0, 0x0, 0x38, 0x38, 0x0, 0x3, 0x3f, 0xfe, 0x0, 0x73,
+    0xff, 0xf0, 0x7, 0x3, 0x7, 0x0, 0x60, 0x70, 0x30, 0xe, 0x7f, 0xff,
+    0xe0, 0xef, 0xff, 0xfe, 0x1e, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x3e,
+    0x1f, 0xff, 0x83, 0xe3, 0x80, 0x38, 0x7e, 0x30, 0x1, 0x86, 0xe3, 0xff,
+    0xf8, 0x4e, 0x1f, 0xff, 0x0, 0xe0, 0x1, 0x80, 0xe, 0x0, 0x38, 0x0,
+    0xe7, 0xff, 0xfc, 0xe, 0x7f, 0xff, 0xc0, 0xe1, 0x1, 0x80, 0xe, 0x38,
+    0x18, 0x0, 0xe3, 0xff, 0xfe, 0xe, 0x7f, 0xff, 0xe0, 0xe7, 0x1, 0x80,
+    0xe, 0x60, 0x18, 0x0, 0xe0, 0x1, 0x80, 0x4, 0x0, 0x10, 0x0,
+
+    /* U+5055 */
+    0x1, 0x10, 0x10, 0x0, 0x3b, 0x83, 0x0, 0x3, 0x38, 0x30, 0x0, 0x73,
+    0x83, 0xe, 0x7, 0x3f, 0xb7, 0xc0, 0x63, 0xfb, 0xf0, 0xe, 0x38, 0x3c,
+    0x0, 0xe3, 0x83, 0x0, 0x1e, 0x38, 0x30, 0x21, 0xe3, 0x83, 0x6, 0x3e,
+    0x3f, 0xb8, 0x63, 0xe7, 0xf3, 0xfe, 0x7e, 0xf8, 0x1f, 0xc6, 0xe0, 0x18,
+    0x0, 0x6e, 0x1, 0x80, 0x0, 0xe1, 0xff, 0xf0, 0xe, 0x3f, 0xff, 0x80,
+    0xe3, 0x0, 0x18, 0xe, 0x70, 0x1, 0x80, 0xe7, 0x0, 0x18, 0xe, 0x7f,
+    0xff, 0x80, 0xe7, 0xff, 0xf8, 0xe, 0x70, 0x1, 0x80, 0xe3, 0x0, 0x18,
+    0xe, 0x3f, 0xff, 0x80, 0xe3, 0xff, 0xf8, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+505A */
+    0x3, 0x18, 0x18, 0x0, 0x31, 0x81, 0x80, 0x7, 0x18, 0x18, 0x0, 0x71,
+    0x83, 0x80, 0x6, 0x18, 0x30, 0x0, 0xe1, 0x83, 0x0, 0xd, 0xff, 0x7f,
+    0xe0, 0xcf, 0xf7, 0xfe, 0x1c, 0x18, 0x71, 0xc1, 0xc1, 0x8f, 0x18, 0x3c,
+    0x18, 0xf1, 0x83, 0xc1, 0x9b, 0x18, 0x7c, 0x19, 0xb1, 0x86, 0xc7, 0xe3,
+    0x18, 0x4c, 0xff, 0x31, 0x80, 0xce, 0x31, 0xb8, 0xc, 0xc3, 0x1b, 0x0,
+    0xcc, 0x31, 0xb0, 0xc, 0xc3, 0x1f, 0x0, 0xcc, 0x30, 0xe0, 0xc, 0xc3,
+    0xe, 0x0, 0xce, 0x71, 0xf0, 0xc, 0xff, 0x3f, 0x80, 0xc3, 0xe7, 0x3c,
+    0xc, 0x1, 0xe1, 0xe0, 0xc0, 0x3c, 0xe, 0xc, 0x1, 0x0, 0x0,
+
+    /* U+505C */
+    0x1, 0x0, 0x40, 0x0, 0x38, 0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x77,
+    0xff, 0xfe, 0x7, 0x7f, 0xff, 0xe0, 0x60, 0x0, 0x0, 0xe, 0x1f, 0xff,
+    0x0, 0xe3, 0xff, 0xf0, 0x1e, 0x30, 0x3, 0x81, 0xe3, 0x0, 0x38, 0x3e,
+    0x3f, 0xff, 0x3, 0xe1, 0xff, 0xe0, 0x7e, 0x0, 0x0, 0x6, 0xe7, 0xff,
+    0xfc, 0x6e, 0xff, 0xff, 0xe0, 0xee, 0x0, 0xe, 0xe, 0xc0, 0x0, 0x60,
+    0xed, 0xff, 0xf6, 0xe, 0x1f, 0xff, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0,
+    0xe, 0x1, 0xe0, 0x0, 0xe0, 0x7c, 0x0, 0x4, 0x7, 0x80, 0x0,
+
+    /* U+5065 */
+    0x2, 0x0, 0x10, 0x0, 0x30, 0x1, 0x80, 0x7, 0xf8, 0x18, 0x0, 0x6f,
+    0x9f, 0xf0, 0x6, 0x19, 0xff, 0x80, 0xe3, 0x81, 0x98, 0xc, 0x30, 0x39,
+    0x80, 0xc3, 0x7f, 0xfe, 0x1c, 0x67, 0xff, 0xe1, 0xc6, 0x1, 0x98, 0x3c,
+    0xe0, 0x39, 0x83, 0xcf, 0xbf, 0xf8, 0x6c, 0xfd, 0xfe, 0x6, 0xc0, 0xc1,
+    0x80, 0xc, 0xd, 0xff, 0x80, 0xc9, 0xbf, 0xfc, 0xc, 0xd8, 0x38, 0x0,
+    0xcd, 0x83, 0x80, 0xc, 0xfb, 0xff, 0xc0, 0xc7, 0xbf, 0xfc, 0xc, 0x70,
+    0x18, 0x0, 0xc7, 0x81, 0x80, 0xc, 0x7c, 0x18, 0x0, 0xce, 0xf8, 0x0,
+    0xd, 0xc3, 0xff, 0xe0, 0xf8, 0xf, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5075 */
+    0x1, 0x80, 0x80, 0x0, 0x38, 0xc, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x30,
+    0x1f, 0xfc, 0x7, 0x1, 0xff, 0xc0, 0x60, 0x1c, 0x0, 0x6, 0x1, 0xc0,
+    0x0, 0xe1, 0xff, 0xf8, 0xe, 0x3f, 0xff, 0x81, 0xe3, 0x80, 0x18, 0x3e,
+    0x30, 0x1, 0x83, 0xe3, 0xff, 0xf8, 0x7e, 0x3f, 0xff, 0x86, 0x63, 0x0,
+    0x18, 0x66, 0x30, 0x1, 0x80, 0x63, 0xff, 0xf8, 0x6, 0x3f, 0xff, 0x80,
+    0x63, 0x80, 0x18, 0x6, 0x30, 0x1, 0x80, 0x63, 0x80, 0x38, 0x6, 0x3f,
+    0xff, 0x80, 0x60, 0xff, 0xe0, 0x6, 0x6, 0xc, 0x0, 0x61, 0xe0, 0xf8,
+    0x6, 0x7c, 0x7, 0xe0, 0x6f, 0x0, 0x1e, 0x4, 0xc0, 0x0, 0x20,
+
+    /* U+5091 */
+    0x3, 0x18, 0x3, 0x0, 0x31, 0x80, 0x30, 0x7, 0x38, 0x3, 0x0, 0x73,
+    0xf3, 0xfc, 0x6, 0x3f, 0x7f, 0xe0, 0xe6, 0x30, 0x38, 0xe, 0xe3, 0x33,
+    0x0, 0xcc, 0x37, 0x30, 0x1d, 0xdf, 0x73, 0x1, 0xc9, 0xe7, 0x38, 0x3c,
+    0xe, 0x7f, 0xe3, 0xc0, 0xc6, 0x38, 0x7c, 0x38, 0x43, 0x6, 0xc7, 0xc,
+    0x30, 0x6c, 0xe0, 0xc3, 0x0, 0xc0, 0xc, 0x0, 0xc, 0xff, 0xff, 0xe0,
+    0xcf, 0xff, 0xfe, 0xc, 0x3, 0xe0, 0x0, 0xc0, 0x3f, 0x0, 0xc, 0x6,
+    0xd8, 0x0, 0xc1, 0xcc, 0xe0, 0xc, 0x38, 0xc7, 0x80, 0xcf, 0xc, 0x3e,
+    0xd, 0xe0, 0xc0, 0xe0, 0xc8, 0xc, 0x0, 0xc, 0x0, 0xc0, 0x0,
+
+    /* U+5099 */
+    0x1, 0x6, 0xc, 0x0, 0x30, 0x60, 0xc0, 0x3, 0x6, 0xc, 0x0, 0x77,
+    0xff, 0xfc, 0x6, 0x7f, 0xff, 0xc0, 0xe0, 0x60, 0xc0, 0xe, 0x6, 0xc,
+    0x0, 0xc0, 0xe0, 0xc0, 0x1c, 0xff, 0xff, 0xe1, 0xcf, 0xff, 0xfe, 0x3c,
+    0x1c, 0x0, 0x3, 0xc1, 0xc0, 0x0, 0x7c, 0x3f, 0xff, 0x86, 0xc7, 0xff,
+    0xfc, 0x6c, 0xf8, 0x61, 0xc0, 0xdf, 0x86, 0x1c, 0xc, 0x9f, 0xff, 0xc0,
+    0xc1, 0xff, 0xfc, 0xc, 0x18, 0x61, 0xc0, 0xc1, 0x86, 0x1c, 0xc, 0x1f,
+    0xff, 0xc0, 0xc1, 0xff, 0xfc, 0xc, 0x18, 0x61, 0xc0, 0xc1, 0x86, 0x1c,
+    0xc, 0x18, 0x63, 0xc0, 0xc1, 0x86, 0x78, 0x4, 0x10, 0x3, 0x0,
+
+    /* U+50B3 */
+    0x1, 0x0, 0x40, 0x0, 0x38, 0xe, 0x0, 0x3, 0xbf, 0xff, 0xc0, 0x37,
+    0xff, 0xfe, 0x7, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x6, 0x3f, 0xff,
+    0xc0, 0xe7, 0xe, 0x1c, 0xe, 0x60, 0xe0, 0xc1, 0xe7, 0xff, 0xfc, 0x3e,
+    0x7f, 0xff, 0xc3, 0xe6, 0xe, 0xc, 0x76, 0x7f, 0xff, 0xc6, 0x63, 0xff,
+    0xf8, 0x46, 0x0, 0xe3, 0x80, 0x67, 0xff, 0xfc, 0x6, 0x7f, 0xff, 0xe0,
+    0x60, 0x0, 0x60, 0x6, 0x0, 0x7, 0x0, 0x6f, 0xff, 0xfe, 0x6, 0x7f,
+    0xff, 0xc0, 0x60, 0x80, 0x60, 0x6, 0xc, 0x6, 0x0, 0x60, 0xe0, 0x60,
+    0x6, 0x6, 0xe, 0x0, 0x60, 0x7, 0xe0, 0x4, 0x0, 0x3c, 0x0,
+
+    /* U+50F9 */
+    0x2, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xc0, 0x60,
+    0x63, 0x0, 0xe, 0x6, 0x30, 0x0, 0xcf, 0xff, 0xf8, 0xc, 0xe6, 0x39,
+    0xc1, 0xcc, 0x63, 0x1c, 0x1c, 0xe6, 0x31, 0xc3, 0xcf, 0xff, 0xf8, 0x3c,
+    0x3f, 0xff, 0x3, 0xc0, 0x0, 0x0, 0x7c, 0x3f, 0xff, 0x7, 0xc7, 0xff,
+    0xf8, 0xdc, 0x70, 0x1, 0x81, 0xc7, 0xff, 0xf8, 0x1c, 0x7f, 0xff, 0x81,
+    0xc7, 0x0, 0x18, 0x1c, 0x7f, 0xff, 0x81, 0xc7, 0xff, 0xf8, 0x1c, 0x70,
+    0x1, 0x81, 0xc7, 0xff, 0xf8, 0x1c, 0x3f, 0xff, 0x1, 0xc0, 0x40, 0x80,
+    0x1c, 0x7c, 0x1f, 0x81, 0xdf, 0x80, 0x7e, 0x9, 0xc0, 0x0, 0xe0,
+
+    /* U+5100 */
+    0x3, 0x8, 0x4, 0x0, 0x30, 0xc0, 0xc0, 0x7, 0x6, 0xc, 0x0, 0x77,
+    0xff, 0xfc, 0x6, 0x7f, 0xff, 0xc0, 0xe0, 0xc, 0x0, 0xc, 0x0, 0xc0,
+    0x0, 0xc3, 0xff, 0xf8, 0x1c, 0x0, 0xc0, 0x1, 0xc0, 0xc, 0x0, 0x3c,
+    0xff, 0xff, 0xe3, 0xcf, 0xff, 0xfe, 0x7c, 0x3, 0x32, 0x6, 0xcf, 0xf3,
+    0x30, 0x6c, 0xfc, 0x31, 0x80, 0xc0, 0xc3, 0x0, 0xd, 0xff, 0xff, 0xe0,
+    0xcf, 0xff, 0xfc, 0xc, 0xc, 0x18, 0x0, 0xc0, 0xf9, 0x98, 0xd, 0xff,
+    0x9f, 0x0, 0xdf, 0xc1, 0xe0, 0xc, 0xc, 0x3c, 0x20, 0xc0, 0xcf, 0xe6,
+    0xc, 0x1d, 0xe7, 0xe0, 0xc7, 0xd8, 0x3e, 0xc, 0x30, 0x0, 0xc0,
+
+    /* U+5104 */
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x7, 0x3f, 0xff, 0x80, 0x77,
+    0xff, 0xfc, 0x6, 0x1c, 0xc, 0x0, 0xe0, 0xc0, 0xc0, 0xe, 0xc, 0x1c,
+    0x0, 0xcf, 0xff, 0xfe, 0x1c, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x3c,
+    0x1f, 0xfe, 0x3, 0xc3, 0xff, 0xf8, 0x7c, 0x70, 0x3, 0x86, 0xc7, 0xff,
+    0xf8, 0x4c, 0x7f, 0xff, 0x80, 0xc7, 0x0, 0x18, 0xc, 0x38, 0x3, 0x80,
+    0xc3, 0xff, 0xf0, 0xc, 0x0, 0xc0, 0x0, 0xc0, 0x4c, 0x0, 0xc, 0x4c,
+    0x61, 0x80, 0xcc, 0xc0, 0x1c, 0xc, 0xcc, 0x6, 0xc0, 0xcc, 0xe0, 0xee,
+    0xd, 0x8f, 0xfc, 0x60, 0xc0, 0x7f, 0xc0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+511F */
+    0x3, 0x0, 0x41, 0x0, 0x73, 0x8c, 0x38, 0x7, 0x18, 0xc3, 0x0, 0x63,
+    0xff, 0xf0, 0xe, 0xff, 0xff, 0xc0, 0xec, 0x0, 0xe, 0xc, 0xc0, 0x0,
+    0x61, 0xcd, 0xff, 0xf6, 0x1c, 0xd8, 0x3, 0x61, 0xc1, 0x80, 0x70, 0x3c,
+    0x1f, 0xfe, 0x3, 0xc0, 0x0, 0x0, 0x7c, 0x1f, 0xff, 0x6, 0xc3, 0xff,
+    0xf8, 0x4c, 0x70, 0x1, 0x80, 0xc7, 0xff, 0xf8, 0xc, 0x7f, 0xff, 0x80,
+    0xc7, 0x0, 0x18, 0xc, 0x7f, 0xff, 0x80, 0xc7, 0xff, 0xf8, 0xc, 0x70,
+    0x1, 0x80, 0xc3, 0xff, 0xf8, 0xc, 0x3f, 0xff, 0x0, 0xc0, 0x0, 0x80,
+    0xc, 0x3e, 0x1f, 0x80, 0xdf, 0xc0, 0x7e, 0xc, 0xe0, 0x0, 0xe0,
+
+    /* U+512A */
+    0x2, 0x0, 0x0, 0x0, 0x77, 0xff, 0xfc, 0x6, 0x7f, 0xff, 0xc0, 0x60,
+    0x18, 0x0, 0xe, 0x1f, 0xfe, 0x0, 0xc3, 0xff, 0xf0, 0xc, 0x30, 0x3,
+    0x0, 0xc3, 0xff, 0xf0, 0x1c, 0x30, 0x3, 0x1, 0xc3, 0xff, 0xf0, 0x3c,
+    0x3f, 0xff, 0x3, 0xc3, 0x0, 0x30, 0x3c, 0xff, 0xff, 0xc6, 0xdc, 0xc,
+    0x2e, 0x6d, 0xb4, 0xc3, 0x60, 0xdb, 0x60, 0xb6, 0xc, 0x67, 0xf9, 0x80,
+    0xc6, 0x7f, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc1, 0xff, 0xf0, 0xc, 0x3e,
+    0xf, 0x0, 0xc7, 0x70, 0xe0, 0xc, 0xc3, 0xf8, 0x0, 0xc0, 0x1f, 0x0,
+    0xc, 0x3f, 0xff, 0xc0, 0xdf, 0xe0, 0xfe, 0x8, 0xc0, 0x0, 0x60,
+
+    /* U+5132 */
+    0x2, 0x0, 0x10, 0x0, 0x77, 0xc1, 0x80, 0x6, 0xfe, 0x18, 0x40, 0x67,
+    0xc3, 0x8e, 0xe, 0x0, 0xfe, 0xc0, 0xcf, 0xcf, 0xfc, 0xd, 0xfe, 0x19,
+    0x80, 0xcf, 0xc1, 0xb0, 0x1c, 0x0, 0x1f, 0x1, 0xc7, 0xdf, 0xfe, 0x3c,
+    0xff, 0xff, 0xe3, 0xc7, 0x81, 0x80, 0x7c, 0x0, 0x30, 0x6, 0xcf, 0xc7,
+    0x0, 0x6c, 0xfe, 0xff, 0x84, 0xc0, 0x1f, 0x1c, 0xc, 0x3, 0x60, 0xc0,
+    0xc7, 0xc6, 0xc, 0xc, 0xfc, 0x60, 0xc0, 0xcc, 0xe7, 0xfc, 0xc, 0xc6,
+    0x7f, 0xc0, 0xcc, 0x66, 0xc, 0xc, 0xc6, 0x60, 0xc0, 0xcc, 0xe6, 0xc,
+    0xc, 0xfc, 0x7f, 0xc0, 0xc7, 0x83, 0xf8, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+5143 */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x6, 0xc, 0x0, 0x0, 0x60, 0xc0, 0x0, 0x6, 0xc,
+    0x0, 0x0, 0x60, 0xc0, 0x0, 0xe, 0xc, 0x0, 0x0, 0xe0, 0xc0, 0x0,
+    0xc, 0xc, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x1c, 0xc, 0x6, 0x3, 0x80,
+    0xc0, 0xe0, 0x78, 0xc, 0xe, 0x1f, 0x0, 0xf1, 0xe7, 0xe0, 0xf, 0xfc,
+    0x78, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+5146 */
+    0x0, 0x20, 0x80, 0x0, 0x6, 0x18, 0x0, 0x0, 0x61, 0xc0, 0x0, 0x6,
+    0x1c, 0x0, 0x0, 0x61, 0xc1, 0x83, 0x86, 0x1c, 0x38, 0x1c, 0x61, 0xc7,
+    0x0, 0xe6, 0x1c, 0xe0, 0x7, 0x61, 0xdc, 0x0, 0x36, 0x1d, 0x80, 0x0,
+    0x61, 0xc0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x61, 0xc0, 0x0, 0xe, 0x1d,
+    0x80, 0x3, 0xe1, 0xde, 0x0, 0xfe, 0x1c, 0xf8, 0x3e, 0x61, 0xc7, 0xc3,
+    0x8e, 0x1c, 0x1c, 0x0, 0xc1, 0xc0, 0x0, 0xc, 0x1c, 0x0, 0x1, 0xc1,
+    0xc0, 0x60, 0x38, 0x1c, 0x6, 0x7, 0x1, 0xc0, 0xe1, 0xe0, 0x1c, 0x1e,
+    0x7c, 0x0, 0xff, 0xc7, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5148 */
+    0x0, 0x2, 0x0, 0x0, 0x10, 0x60, 0x0, 0x3, 0x86, 0x0, 0x0, 0x30,
+    0x60, 0x0, 0x7, 0x7, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0xc0, 0x60, 0x0, 0x1c, 0x6, 0x0, 0x1, 0x80, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x6, 0xc, 0x0, 0x0, 0x60, 0xc0, 0x0,
+    0x6, 0xc, 0x0, 0x0, 0xe0, 0xc0, 0x0, 0xc, 0xc, 0x0, 0x1, 0xc0,
+    0xc0, 0x60, 0x1c, 0xc, 0x6, 0x7, 0x80, 0xc0, 0xe1, 0xf0, 0xe, 0xe,
+    0x7e, 0x0, 0xff, 0xc7, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5149 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x6, 0x0, 0xe0,
+    0x60, 0xe0, 0xe, 0x6, 0xe, 0x0, 0x70, 0x61, 0xc0, 0x3, 0x86, 0x1c,
+    0x0, 0x38, 0x61, 0x80, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0xf, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x6, 0x1c,
+    0x0, 0x0, 0x61, 0xc0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x61, 0xc0, 0x0,
+    0x6, 0x1c, 0x0, 0x0, 0xe1, 0xc0, 0x0, 0xc, 0x1c, 0x0, 0x1, 0xc1,
+    0xc0, 0x60, 0x38, 0x1c, 0x6, 0x7, 0x81, 0xc0, 0xe1, 0xf0, 0x1c, 0x1e,
+    0x7e, 0x0, 0xff, 0xc7, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+514B */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xc,
+    0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0,
+    0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0x3f, 0xff, 0xc0, 0x0, 0x61, 0xc0, 0x0, 0xe, 0x1c, 0x0, 0x0, 0xc1,
+    0xc0, 0x60, 0x1c, 0x1c, 0xe, 0x3, 0x81, 0xc0, 0xe0, 0xf0, 0x1e, 0x1e,
+    0x7e, 0x0, 0xff, 0xc7, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+514C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x87, 0xf0, 0x0, 0x1c,
+    0x3, 0x80, 0x3, 0x80, 0x1c, 0x0, 0x70, 0x0, 0xc0, 0xf, 0x0, 0xf,
+    0x1, 0xe0, 0x0, 0x78, 0x3f, 0xff, 0xff, 0xc7, 0x7f, 0xff, 0xfe, 0x67,
+    0x0, 0xe, 0x60, 0x60, 0x0, 0xe0, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0xe, 0x0, 0x70, 0x0, 0xe0, 0x7, 0xff, 0xfe, 0x0,
+    0x3f, 0xff, 0xc0, 0x0, 0x61, 0xc0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0xe1,
+    0xc0, 0x60, 0x1c, 0x1c, 0x6, 0x3, 0xc1, 0xc0, 0xe0, 0xf0, 0xe, 0x1e,
+    0x7e, 0x0, 0xff, 0xc7, 0xc0, 0xf, 0xf8, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+514D */
+    0x0, 0x40, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x7f, 0xfe, 0x0, 0x1c, 0x1, 0xc0, 0x7, 0x0, 0x70, 0x1,
+    0xc0, 0x1c, 0x0, 0x77, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xe0, 0x30, 0x18,
+    0xe, 0x6, 0x3, 0x1, 0xc0, 0xc0, 0x60, 0x38, 0x18, 0xc, 0x7, 0x3,
+    0x3, 0x80, 0xe0, 0x7f, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x3, 0xb0,
+    0x0, 0x0, 0x66, 0x0, 0x0, 0x1c, 0xc0, 0x0, 0x3, 0x18, 0x6, 0x0,
+    0xc3, 0x0, 0xc0, 0x70, 0x60, 0x18, 0x7c, 0xc, 0x7, 0x3f, 0x1, 0xff,
+    0xcf, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5152 */
+    0x0, 0x10, 0x0, 0x0, 0x1f, 0x8f, 0xc0, 0xf, 0xf1, 0xff, 0x0, 0xf0,
+    0xf, 0xf8, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3,
+    0x81, 0xc0, 0x0, 0x38, 0x1f, 0xf9, 0xff, 0x81, 0xff, 0xf, 0xf8, 0x1c,
+    0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x80, 0xe0, 0x0,
+    0x78, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x70, 0xc0, 0x0,
+    0x6, 0xc, 0x0, 0x0, 0x60, 0xc0, 0x0, 0xe, 0xc, 0x0, 0x0, 0xc0,
+    0xc0, 0x60, 0x1c, 0xc, 0x6, 0x3, 0x80, 0xc0, 0x60, 0xf0, 0xe, 0xe,
+    0x3e, 0x0, 0xff, 0xe7, 0x80, 0x7, 0xfc, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+5165 */
+    0x1, 0xfc, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
+    0xf, 0x80, 0x0, 0x1, 0xd8, 0x0, 0x0, 0x19, 0xc0, 0x0, 0x3, 0x8c,
+    0x0, 0x0, 0x30, 0xe0, 0x0, 0x6, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x0,
+    0x1c, 0x3, 0x80, 0x3, 0x80, 0x1c, 0x0, 0x70, 0x1, 0xe0, 0xf, 0x0,
+    0xf, 0x1, 0xe0, 0x0, 0x78, 0x3c, 0x0, 0x3, 0xc7, 0x80, 0x0, 0x1e,
+    0x60, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+5167 */
+    0x3, 0xe0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xff, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0x1, 0xc0, 0x0, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xfe, 0xe0, 0x3c, 0x7, 0x70, 0x1f, 0x1, 0xb8, 0xf, 0x80, 0xdc, 0xe,
+    0xc0, 0x6e, 0x6, 0x70, 0x37, 0x7, 0x1c, 0x1b, 0x87, 0xe, 0xd, 0xc3,
+    0x83, 0x86, 0xe3, 0x81, 0xe3, 0x73, 0x80, 0x71, 0xb9, 0x80, 0x18, 0xdc,
+    0x0, 0x0, 0x6e, 0x0, 0x0, 0x37, 0x0, 0x0, 0x1b, 0x80, 0x0, 0x1d,
+    0xc0, 0x0, 0x1e, 0xe0, 0x0, 0xff, 0x30, 0x0, 0x7f, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+5168 */
+    0x3, 0xfc, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1,
+    0xdc, 0x0, 0x0, 0x38, 0xe0, 0x0, 0x7, 0x7, 0x0, 0x1, 0xe0, 0x3c,
+    0x0, 0x3c, 0x3, 0xf0, 0xf, 0x80, 0xf, 0xc3, 0xe0, 0x0, 0x3e, 0x7b,
+    0xff, 0xfc, 0xe6, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0,
+    0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0,
+    0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc,
+
+    /* U+5169 */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xfc, 0x38, 0xe, 0x1, 0xc3, 0x0, 0x60, 0xc, 0x33,
+    0x6, 0x60, 0xc3, 0x7c, 0x6f, 0x8c, 0x30, 0xc6, 0x18, 0xc3, 0xc, 0x61,
+    0x8c, 0x31, 0xc6, 0x38, 0xc3, 0x1c, 0x63, 0xcc, 0x31, 0x66, 0x2c, 0xc3,
+    0x36, 0x66, 0xcc, 0x33, 0x36, 0xe6, 0xc3, 0x63, 0x6c, 0x6c, 0x36, 0x16,
+    0xc2, 0xc3, 0x0, 0x60, 0xc, 0x30, 0x6, 0x0, 0xc3, 0x0, 0x60, 0x7c,
+    0x30, 0x6, 0xf, 0xc3, 0x0, 0x0, 0xf0,
+
+    /* U+516B */
+    0x0, 0x1f, 0x80, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x18, 0x7, 0x0, 0x1, 0x80, 0x70,
+    0x0, 0x18, 0x7, 0x0, 0x1, 0x80, 0x70, 0x0, 0x38, 0x3, 0x0, 0x3,
+    0x80, 0x30, 0x0, 0x38, 0x3, 0x0, 0x3, 0x80, 0x38, 0x0, 0x30, 0x3,
+    0x80, 0x7, 0x0, 0x18, 0x0, 0x70, 0x1, 0xc0, 0x6, 0x0, 0x1c, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x1, 0xc0, 0x0, 0x70, 0x1c, 0x0,
+    0x7, 0x83, 0x80, 0x0, 0x3c, 0x78, 0x0, 0x1, 0xe7, 0x0, 0x0, 0xe,
+    0x60, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+516C */
+    0x0, 0x7, 0xc0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x80, 0xf0, 0x0, 0x18,
+    0x3, 0x0, 0x1, 0x80, 0x38, 0x0, 0x38, 0x3, 0x80, 0x3, 0x0, 0x18,
+    0x0, 0x70, 0x1, 0xc0, 0x6, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xf0, 0x1c,
+    0x10, 0x7, 0x83, 0x83, 0x80, 0x3c, 0x78, 0x38, 0x1, 0xe7, 0x3, 0x0,
+    0xe, 0x60, 0x70, 0x0, 0x60, 0x7, 0x6, 0x0, 0x0, 0x60, 0x70, 0x0,
+    0xe, 0x3, 0x80, 0x0, 0xc0, 0x1c, 0x0, 0x1c, 0x0, 0xe0, 0x1, 0x80,
+    0xe, 0x0, 0x38, 0x3f, 0xf0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xf0, 0x38,
+    0x1c, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+516D */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff,
+    0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x3,
+    0x0, 0x1, 0xc0, 0x38, 0x0, 0x1c, 0x3, 0x80, 0x3, 0x80, 0x1c, 0x0,
+    0x38, 0x1, 0xc0, 0x7, 0x0, 0xe, 0x0, 0x70, 0x0, 0xf0, 0xe, 0x0,
+    0x7, 0x1, 0xc0, 0x0, 0x38, 0x3c, 0x0, 0x3, 0xc7, 0x80, 0x0, 0x1e,
+    0x70, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5171 */
+    0x0, 0x80, 0x10, 0x0, 0xc, 0x3, 0x0, 0x1, 0xc0, 0x30, 0x0, 0x1c,
+    0x3, 0x0, 0x1, 0xc0, 0x30, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0xc0, 0x1c, 0x3, 0x80, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x1,
+    0xc0, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x3,
+    0x0, 0x1, 0xc0, 0x30, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x3, 0x0, 0x1, 0xc0,
+    0x38, 0x0, 0x78, 0x1, 0xc0, 0xf, 0x0, 0xf, 0x1, 0xe0, 0x0, 0x78,
+    0x7c, 0x0, 0x3, 0xe7, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5175 */
+    0x0, 0x0, 0x1e, 0x0, 0x0, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x0, 0x3f,
+    0xe0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfc, 0x7,
+    0x0, 0x38, 0x0, 0x70, 0x3, 0x80, 0x7, 0x0, 0x38, 0x0, 0x30, 0x3,
+    0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0x80, 0x7, 0x0, 0x38, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x30, 0x0, 0x1c, 0x3, 0x80, 0x7, 0x80, 0x1e, 0x0, 0xf0, 0x0, 0xf8,
+    0x3e, 0x0, 0x7, 0xc7, 0x80, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x40,
+
+    /* U+5176 */
+    0x1, 0x0, 0x8, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80, 0x1c, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3, 0x80, 0x1c,
+    0x0, 0x38, 0x1, 0xc0, 0x3, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x3,
+    0x80, 0x1c, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80, 0x1c, 0x0, 0x3f, 0xff,
+    0xc0, 0x3, 0xff, 0xfc, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80, 0x1c, 0x0,
+    0x38, 0x1, 0xc0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x3, 0x0, 0x3, 0xc0, 0x3c, 0x0, 0xf8, 0x1, 0xf0,
+    0x3e, 0x0, 0x7, 0xc7, 0x80, 0x0, 0x1e, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+5177 */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0,
+    0x0, 0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7,
+    0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0x3, 0xc0, 0xf, 0xc0, 0x3f, 0x3, 0xf0, 0x0, 0xfe,
+    0x7c, 0x0, 0x3, 0xe6, 0x0, 0x0, 0xe,
+
+    /* U+518A */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc7,
+    0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x18, 0x70, 0xc1,
+    0x81, 0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x18,
+    0x70, 0xc1, 0x87, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe1, 0xc7, 0x1e,
+    0x3c, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81,
+    0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x18, 0x70,
+    0xc1, 0x81, 0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0xf8,
+    0x18, 0x30, 0xdf, 0x80, 0x80, 0x0, 0xe0,
+
+    /* U+51A0 */
+    0x1f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x0,
+    0x0, 0xe, 0x70, 0x0, 0x6, 0xe7, 0x0, 0x0, 0x6e, 0x7f, 0xfc, 0x6,
+    0x62, 0xff, 0xc0, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0xff, 0x83, 0xff, 0xc0, 0x60, 0x7f, 0xfe, 0x6, 0x3, 0xff, 0xd8,
+    0x60, 0x6, 0x30, 0xc6, 0x0, 0x63, 0xe, 0x60, 0x6, 0x30, 0x66, 0x0,
+    0x63, 0x0, 0x60, 0xe, 0x30, 0x6, 0x0, 0xe3, 0x0, 0xe6, 0xc, 0x30,
+    0x7e, 0x61, 0xc3, 0x3, 0xc6, 0x38, 0x38, 0x0, 0xe7, 0x83, 0xff, 0xfe,
+    0x70, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+51AC */
+    0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f,
+    0xff, 0xe0, 0x3, 0xff, 0xfe, 0x0, 0x7c, 0x1, 0xc0, 0xf, 0xe0, 0x3c,
+    0x1, 0xe7, 0x7, 0x80, 0x3c, 0x38, 0xf0, 0x7, 0x1, 0xdc, 0x0, 0x60,
+    0x1f, 0x80, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0xf, 0x9f,
+    0x80, 0xf, 0xe0, 0x7f, 0x87, 0xf8, 0x1, 0xfe, 0x7e, 0x38, 0x7, 0xe7,
+    0x7, 0xf0, 0x4, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x70, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x6, 0x0,
+
+    /* U+51B7 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x30, 0x1, 0xc0, 0x3, 0xc0,
+    0x3c, 0x0, 0x1e, 0x7, 0xe0, 0x0, 0xe0, 0xe7, 0x0, 0x6, 0x1e, 0x38,
+    0x0, 0x3, 0xc1, 0xe0, 0x0, 0x78, 0xf, 0x0, 0xf, 0x0, 0x7c, 0x1,
+    0xff, 0xff, 0xe0, 0x1d, 0xff, 0xee, 0x1, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x0, 0xc7, 0xff, 0xf0, 0x1c, 0xff, 0xff, 0x81,
+    0xc0, 0x70, 0x78, 0x38, 0x7, 0x1, 0x83, 0x80, 0x70, 0x18, 0x30, 0x7,
+    0x1, 0x87, 0x0, 0x70, 0x18, 0x70, 0x7, 0x1, 0x86, 0x0, 0x71, 0xf8,
+    0x0, 0x7, 0x3f, 0x0, 0x0, 0x71, 0xc0, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+51C6 */
+    0x0, 0xc, 0xc, 0x0, 0x1, 0xc1, 0xc0, 0x38, 0x1c, 0x1c, 0x3, 0xc3,
+    0x81, 0x80, 0x1e, 0x38, 0x38, 0x0, 0x67, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xe0, 0xf, 0x87, 0x0, 0x1, 0xf0, 0x30, 0x0, 0x3f, 0x3, 0x0, 0x3,
+    0xb0, 0x30, 0x0, 0x33, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x63, 0x3,
+    0x0, 0xe, 0x30, 0x30, 0x0, 0xe3, 0x3, 0x0, 0x1c, 0x30, 0x30, 0x1,
+    0xc3, 0xff, 0xfc, 0x38, 0x3f, 0xff, 0xc3, 0x83, 0x3, 0x0, 0x38, 0x30,
+    0x30, 0x7, 0x3, 0x3, 0x0, 0x70, 0x30, 0x30, 0x6, 0x3, 0x83, 0x0,
+    0x0, 0x3f, 0xff, 0xe0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+51E1 */
+    0x0, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x38,
+    0x3, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0x80, 0x3, 0x0, 0x38,
+    0x0, 0x30, 0x3, 0x80, 0x3, 0x0, 0x38, 0x0, 0x33, 0x3, 0x80, 0x3,
+    0x38, 0x38, 0x0, 0x31, 0xc3, 0x80, 0x3, 0xe, 0x38, 0x0, 0x30, 0xf3,
+    0x80, 0x7, 0x7, 0x38, 0x0, 0x70, 0x3b, 0x80, 0x7, 0x1, 0x38, 0x0,
+    0x60, 0x3, 0x86, 0xe, 0x0, 0x38, 0x60, 0xe0, 0x3, 0x86, 0x1c, 0x0,
+    0x38, 0x63, 0xc0, 0x3, 0x8e, 0x78, 0x0, 0x3f, 0xe7, 0x0, 0x3, 0xfc,
+    0x60, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+51F1 */
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x3, 0xc0, 0x31, 0x8c, 0xfe, 0x3, 0x18,
+    0xcf, 0xf0, 0x31, 0x8c, 0xc7, 0x3, 0xb9, 0xcc, 0x70, 0x3f, 0xfc, 0xc7,
+    0x0, 0xff, 0xc, 0x70, 0x0, 0x0, 0xc7, 0x7, 0xff, 0xcc, 0x70, 0x7f,
+    0xfe, 0xc7, 0x0, 0x0, 0xc, 0x70, 0xf, 0xe0, 0xc7, 0x3, 0xff, 0x8c,
+    0x70, 0x3f, 0xfc, 0xc7, 0x3, 0x1, 0xcc, 0x70, 0x30, 0x1d, 0xc7, 0x3,
+    0xff, 0xdc, 0x70, 0x1f, 0xf9, 0xc7, 0x0, 0xc7, 0x1c, 0x72, 0xc, 0x61,
+    0x87, 0x60, 0xc6, 0x18, 0x76, 0xf, 0xff, 0x87, 0x67, 0xff, 0xf0, 0x7e,
+    0x7f, 0x7, 0x7, 0xe0, 0x0, 0x60, 0x3c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+51FA */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc0, 0x30,
+    0xc, 0x38, 0xc, 0x3, 0xe, 0x3, 0x0, 0xc3, 0x80, 0xc0, 0x30, 0xe0,
+    0x30, 0xc, 0x38, 0xc, 0x3, 0xe, 0x3, 0x1, 0xc3, 0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xf8, 0x7, 0xff, 0xf8, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0,
+    0x1, 0x80, 0x30, 0x6, 0x60, 0xc, 0x1, 0x98, 0x3, 0x0, 0x66, 0x0,
+    0xc0, 0x19, 0x80, 0x30, 0x6, 0x60, 0xc, 0x1, 0x98, 0x3, 0x0, 0x67,
+    0x0, 0xc0, 0x39, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+51FD */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x7, 0x0, 0x0, 0x30, 0x7f, 0x0,
+    0xc3, 0x7, 0xf0, 0xcc, 0x33, 0x3, 0x1c, 0xc3, 0x3c, 0x33, 0x8c, 0x31,
+    0xe3, 0x70, 0xc3, 0x6, 0x36, 0xc, 0x30, 0x3, 0x0, 0xc3, 0x0, 0x30,
+    0xc, 0x30, 0x33, 0x60, 0xc3, 0xf, 0x37, 0x8c, 0x31, 0xe7, 0x3c, 0xc3,
+    0x78, 0x71, 0xec, 0x37, 0x7, 0xe, 0xc3, 0x3, 0xe0, 0xc, 0x30, 0x3e,
+    0x0, 0xc3, 0x1, 0x0, 0xc, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc,
+    0xf, 0xff, 0xff, 0x0,
+
+    /* U+5206 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x18,
+    0x7, 0x0, 0x1, 0x80, 0x38, 0x0, 0x38, 0x3, 0x80, 0x3, 0x80, 0x18,
+    0x0, 0x70, 0x1, 0xc0, 0x7, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xf0, 0x1c,
+    0x0, 0x7, 0x83, 0xc0, 0x0, 0x3c, 0x7b, 0xff, 0xf9, 0xe7, 0x7f, 0xff,
+    0xce, 0x43, 0xff, 0xfe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0,
+    0x7, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x0, 0xe, 0x0, 0xc0, 0x0, 0xe0,
+    0xc, 0x0, 0x1c, 0x0, 0xc0, 0x3, 0x80, 0x1c, 0x0, 0xf8, 0x1, 0xc0,
+    0x3e, 0x1, 0xf8, 0x3, 0xc0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+520A */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xe0, 0x1c, 0xff, 0xf1,
+    0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x18, 0x70, 0x18, 0x6, 0x1c, 0x6,
+    0x1, 0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x18, 0x70, 0x1c, 0x6, 0x1d,
+    0xff, 0xf9, 0x87, 0x7f, 0xfe, 0x61, 0xc0, 0x60, 0x18, 0x70, 0x18, 0x6,
+    0x1c, 0x6, 0x1, 0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x18, 0x70, 0x18,
+    0x6, 0x1c, 0x6, 0x1, 0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x0, 0x70,
+    0x18, 0x0, 0x1c, 0x6, 0x0, 0x7, 0x1, 0x80, 0x1f, 0x80, 0x60, 0x7,
+    0xe0, 0x18, 0x0, 0xe0,
+
+    /* U+5211 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfc, 0x3, 0x1f, 0xff,
+    0x38, 0x60, 0xe3, 0x87, 0xc, 0x1c, 0x70, 0xe1, 0x83, 0x8e, 0x1c, 0x30,
+    0x71, 0xc3, 0x86, 0xe, 0x38, 0x70, 0xc1, 0xc7, 0xe, 0x18, 0x38, 0xe1,
+    0xc3, 0x3f, 0xff, 0xb8, 0x67, 0xff, 0xf7, 0xc, 0x1c, 0x70, 0xe1, 0x83,
+    0x8e, 0x1c, 0x30, 0x61, 0xc3, 0x86, 0xc, 0x38, 0x70, 0xc1, 0x87, 0xe,
+    0x18, 0x30, 0xe1, 0xc3, 0xe, 0x1c, 0x38, 0x61, 0xc3, 0x82, 0xc, 0x30,
+    0x70, 0x1, 0x8e, 0xe, 0x0, 0x33, 0xc1, 0xc0, 0xe, 0x70, 0x38, 0xf,
+    0xcc, 0x3, 0x3, 0xf0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+521D */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x3f, 0xfc, 0x3, 0x87,
+    0xff, 0xe0, 0x70, 0x7f, 0xfc, 0xff, 0xe1, 0x81, 0x9f, 0xfc, 0x30, 0x30,
+    0x3, 0x86, 0x6, 0x0, 0xe0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0x6, 0x3,
+    0x3, 0x1, 0xc8, 0x60, 0x60, 0x73, 0x8c, 0xc, 0x1e, 0xe1, 0x81, 0x8f,
+    0xf8, 0x30, 0x73, 0xf8, 0xe, 0xe, 0x77, 0x41, 0x81, 0xcc, 0xfc, 0x30,
+    0x38, 0x1d, 0xc6, 0x7, 0x3, 0x89, 0xc0, 0xe0, 0x70, 0x30, 0x1c, 0xe,
+    0xe, 0x3, 0x1, 0xc3, 0x80, 0x60, 0x38, 0xe0, 0x1c, 0x7, 0x1c, 0x1f,
+    0x80, 0xe7, 0x3, 0xe0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+5224 */
+    0x0, 0x80, 0x0, 0x0, 0x30, 0x0, 0x18, 0x7, 0x0, 0x7, 0x30, 0xe3,
+    0x10, 0xe7, 0x1c, 0x67, 0x1c, 0x73, 0x9c, 0xe3, 0x8e, 0x73, 0x1c, 0x70,
+    0xce, 0x63, 0x8e, 0x1, 0xc0, 0x71, 0xc0, 0x38, 0xe, 0x38, 0xff, 0xf9,
+    0xc7, 0x1f, 0xff, 0x38, 0xe0, 0x1c, 0x7, 0x1c, 0x3, 0x80, 0xe3, 0x80,
+    0x70, 0x1c, 0x70, 0xe, 0x3, 0x8e, 0x7f, 0xfe, 0x71, 0xcf, 0xff, 0xee,
+    0x38, 0x7, 0x1, 0xc7, 0x0, 0xe0, 0x38, 0xe0, 0x1c, 0x2, 0x1c, 0x3,
+    0x80, 0x3, 0x80, 0x70, 0x0, 0x70, 0xe, 0x0, 0xe, 0x1, 0xc0, 0xf,
+    0xc0, 0x30, 0x3, 0xf0, 0x2, 0x0, 0x38, 0x0,
+
+    /* U+5225 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x18, 0xff, 0xf0, 0x7, 0x1f, 0xff,
+    0x38, 0xe3, 0x80, 0xe7, 0x1c, 0x60, 0x1c, 0xe3, 0x8c, 0x3, 0x9c, 0x71,
+    0x80, 0x73, 0x8e, 0x38, 0xe, 0x71, 0xc7, 0xff, 0x8e, 0x38, 0x7f, 0xf1,
+    0xc7, 0x3, 0x80, 0x38, 0xe0, 0x70, 0x7, 0x1c, 0xe, 0x0, 0xe3, 0x81,
+    0xff, 0x1c, 0x70, 0x3f, 0xe3, 0x8e, 0x6, 0xe, 0x71, 0xc0, 0xc1, 0xce,
+    0x38, 0x38, 0x31, 0xc7, 0x6, 0x6, 0x38, 0xe0, 0xc0, 0xc2, 0x1c, 0x38,
+    0x18, 0x3, 0x8e, 0x3, 0x0, 0x73, 0x81, 0xe0, 0xe, 0x71, 0xfc, 0xf,
+    0xcc, 0x3f, 0x3, 0xf0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+5229 */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x33, 0xff, 0x80, 0x1d, 0xff, 0x1,
+    0x7, 0x1, 0x80, 0xe1, 0xc0, 0x60, 0x38, 0x70, 0x18, 0xe, 0x1c, 0x6,
+    0x3, 0x87, 0x7f, 0xfc, 0xe1, 0xdf, 0xff, 0x38, 0x70, 0x3c, 0xe, 0x1c,
+    0xe, 0x3, 0x87, 0x3, 0x80, 0xe1, 0xc1, 0xf0, 0x38, 0x70, 0x7f, 0xe,
+    0x1c, 0x37, 0xe3, 0x87, 0xd, 0x98, 0xe1, 0xc6, 0x67, 0x38, 0x73, 0x98,
+    0xce, 0x1d, 0xc6, 0x3, 0x87, 0x71, 0x80, 0x1, 0xd8, 0x60, 0x0, 0x70,
+    0x18, 0x0, 0x1c, 0x6, 0x0, 0x7, 0x1, 0x80, 0xf, 0x80, 0x60, 0x7,
+    0xe0, 0x8, 0x0, 0xe0,
+
+    /* U+5230 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfc, 0x3, 0x3f, 0xff,
+    0x98, 0x60, 0x38, 0x3, 0x8c, 0x6, 0x0, 0x71, 0x81, 0xc2, 0xe, 0x30,
+    0x30, 0x61, 0xc6, 0x6, 0xe, 0x38, 0xc1, 0xc1, 0xe7, 0x18, 0xff, 0xfc,
+    0xe3, 0x3f, 0xf9, 0xdc, 0x63, 0x1c, 0x1b, 0x8c, 0x1, 0x80, 0x71, 0x80,
+    0x30, 0xe, 0x30, 0x6, 0x1, 0xc6, 0x3f, 0xfe, 0x38, 0xc7, 0xff, 0xe7,
+    0x18, 0x3, 0x0, 0xe3, 0x0, 0x60, 0x1c, 0x60, 0xc, 0x3, 0xc, 0x1,
+    0x80, 0x1, 0x80, 0x31, 0xc0, 0x30, 0x7f, 0xfc, 0xe, 0x7f, 0xfc, 0xf,
+    0xcf, 0x80, 0x3, 0xf0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+5236 */
+    0x0, 0x80, 0x0, 0x1, 0x38, 0x0, 0x18, 0x67, 0x0, 0xc3, 0x1c, 0xe0,
+    0x18, 0x63, 0xff, 0xe3, 0xc, 0x7f, 0xfc, 0x61, 0x9c, 0x70, 0xc, 0x33,
+    0xe, 0x1, 0x86, 0x1, 0xc0, 0x30, 0xcf, 0xff, 0xe6, 0x19, 0xff, 0xfc,
+    0xc3, 0x0, 0xe0, 0x18, 0x60, 0x1c, 0x3, 0xc, 0x3, 0x80, 0x61, 0x87,
+    0xff, 0x8c, 0x31, 0xff, 0xf1, 0x86, 0x39, 0xc7, 0x30, 0xc6, 0x38, 0xe6,
+    0x18, 0xc7, 0x1c, 0xc3, 0x18, 0xe3, 0x98, 0x63, 0x1c, 0x73, 0xc, 0x63,
+    0x8e, 0x1, 0x8c, 0x77, 0x80, 0x31, 0x8e, 0xf0, 0xe, 0x1, 0xc0, 0xf,
+    0xc0, 0x38, 0x1, 0xf0, 0x2, 0x0, 0x1c, 0x0,
+
+    /* U+523A */
+    0x0, 0x80, 0x0, 0x0, 0x38, 0x0, 0x18, 0x7, 0x0, 0x3, 0x3f, 0xff,
+    0x98, 0x67, 0xff, 0xf3, 0xc, 0x3, 0x80, 0x61, 0x80, 0x70, 0xc, 0x30,
+    0xe, 0x1, 0x86, 0x3f, 0xfe, 0x30, 0xc7, 0xff, 0xc6, 0x18, 0xc7, 0x1c,
+    0xc3, 0x18, 0xe3, 0x98, 0x63, 0x1c, 0x73, 0xc, 0x63, 0x8e, 0x61, 0x8c,
+    0x73, 0xcc, 0x31, 0x8e, 0xf1, 0x86, 0x23, 0xcc, 0x30, 0xc0, 0xfc, 0x6,
+    0x18, 0x3f, 0xe0, 0xc3, 0xe, 0xee, 0x18, 0x63, 0x9c, 0xe3, 0xc, 0xe3,
+    0x8e, 0x1, 0x9c, 0x70, 0x80, 0x32, 0xe, 0x0, 0xe, 0x1, 0xc0, 0xf,
+    0xc0, 0x38, 0x1, 0xf0, 0x2, 0x0, 0x38, 0x0,
+
+    /* U+523B */
+    0x0, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x18, 0x3, 0x0, 0x3, 0x0, 0x60,
+    0x18, 0x67, 0xff, 0xf3, 0xc, 0xff, 0xfe, 0x61, 0x80, 0xf0, 0xc, 0x30,
+    0x1c, 0x1, 0x86, 0x3, 0xc, 0x30, 0xc4, 0xc3, 0x86, 0x18, 0xf8, 0xe0,
+    0xc3, 0x1e, 0x38, 0x18, 0x61, 0xe7, 0x3, 0xc, 0xf, 0xc6, 0x61, 0x80,
+    0xf1, 0xcc, 0x30, 0x1c, 0x71, 0x86, 0x7, 0x1e, 0x30, 0xc3, 0xc7, 0x86,
+    0x18, 0xf0, 0xe0, 0xc3, 0x38, 0x38, 0x18, 0x66, 0x1f, 0x83, 0xc, 0x7,
+    0xb8, 0x1, 0x83, 0xc3, 0x80, 0x31, 0xf0, 0x38, 0xe, 0x7c, 0x3, 0xf,
+    0xce, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+524D */
+    0x1, 0x0, 0x10, 0x0, 0x38, 0x3, 0x80, 0x1, 0xc0, 0x30, 0x0, 0x1c,
+    0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0xff, 0x84, 0x18, 0x1f,
+    0xf8, 0xe1, 0x83, 0x81, 0x8e, 0x18, 0x38, 0x18, 0xe1, 0x83, 0xff, 0x8e,
+    0x18, 0x3f, 0xf8, 0xe1, 0x83, 0xff, 0x8e, 0x18, 0x38, 0x18, 0xe1, 0x83,
+    0x81, 0x8e, 0x18, 0x3f, 0xf8, 0xe1, 0x83, 0xff, 0x8e, 0x18, 0x38, 0x18,
+    0xe1, 0x83, 0x81, 0x84, 0x18, 0x38, 0x18, 0x1, 0x83, 0x81, 0x80, 0x18,
+    0x38, 0xf8, 0x1f, 0x83, 0x8f, 0x81, 0xf8, 0x10, 0x60, 0xe, 0x0,
+
+    /* U+526A */
+    0x0, 0x80, 0x18, 0x0, 0x1c, 0x3, 0x80, 0x0, 0xe0, 0x38, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x1,
+    0x81, 0xff, 0xc6, 0x18, 0x18, 0xc, 0x61, 0x81, 0xff, 0xc6, 0x18, 0x1f,
+    0xfc, 0x61, 0x81, 0x80, 0xc6, 0x18, 0x1f, 0xfc, 0x61, 0x81, 0xff, 0xc6,
+    0x18, 0x18, 0xc, 0x41, 0x81, 0x87, 0xc0, 0xf8, 0x18, 0x78, 0xf, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x0, 0x38,
+    0x3, 0x80, 0x3, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x1e, 0x0, 0x38,
+    0x3f, 0xc0, 0x3f, 0x87, 0xf0, 0x7, 0xf0, 0x38, 0x0, 0x3c, 0x0,
+
+    /* U+526F */
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x19, 0xff, 0xfe, 0x3, 0x3f, 0xff,
+    0x80, 0x60, 0x0, 0x1, 0xc, 0xf, 0xf0, 0x61, 0x87, 0xff, 0x8e, 0x30,
+    0xff, 0xf1, 0xc6, 0x18, 0x6, 0x38, 0xc3, 0x0, 0xc7, 0x18, 0x7f, 0xf8,
+    0xe3, 0xf, 0xff, 0x1c, 0x60, 0x0, 0x3, 0x8c, 0x0, 0x0, 0x71, 0x8f,
+    0xff, 0x8e, 0x31, 0xff, 0xf9, 0xc6, 0x30, 0xc7, 0x38, 0xc6, 0x18, 0x67,
+    0x18, 0xc3, 0xc, 0xe3, 0x1f, 0xff, 0x9c, 0x63, 0xff, 0xf1, 0xc, 0x61,
+    0x86, 0x1, 0x8c, 0x30, 0xc0, 0x31, 0xc6, 0x38, 0xe, 0x3f, 0xff, 0xf,
+    0xc3, 0xff, 0xc1, 0xf8, 0x0, 0x0, 0x1c, 0x0,
+
+    /* U+5275 */
+    0x0, 0x60, 0x0, 0x0, 0x1c, 0x0, 0x18, 0x7, 0xc0, 0x3, 0x1, 0xde,
+    0xc, 0x60, 0x70, 0xf1, 0x8c, 0x1c, 0xf, 0x31, 0x8f, 0xff, 0xf6, 0x33,
+    0xff, 0xf0, 0xc6, 0x60, 0x0, 0x18, 0xc0, 0x7f, 0x83, 0x18, 0x3f, 0xfc,
+    0x63, 0xe, 0x1, 0x8c, 0x61, 0xc0, 0x31, 0x8c, 0x3f, 0xfe, 0x31, 0x87,
+    0x0, 0xc6, 0x30, 0xe0, 0x18, 0xc6, 0x1f, 0xff, 0x18, 0xc3, 0xff, 0xc3,
+    0x18, 0x60, 0x0, 0x63, 0xd, 0xff, 0xc, 0x61, 0xbf, 0xf1, 0xc, 0x66,
+    0x6, 0x1, 0x8c, 0xc0, 0xe0, 0x33, 0x98, 0x1c, 0x6, 0x63, 0x87, 0xf,
+    0xc0, 0x7f, 0xe1, 0xf8, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+5283 */
+    0x0, 0x80, 0x0, 0x0, 0x18, 0x0, 0x18, 0xff, 0xf8, 0x3, 0x1f, 0xff,
+    0x8c, 0x60, 0xc, 0x71, 0x8c, 0xff, 0xff, 0x31, 0x80, 0x71, 0xc6, 0x30,
+    0xff, 0xf8, 0xc6, 0x3f, 0xfe, 0x18, 0xc0, 0x18, 0x3, 0x18, 0xff, 0xfc,
+    0x63, 0x1f, 0xff, 0xc, 0x60, 0x1c, 0x1, 0x8c, 0xff, 0xff, 0x31, 0x80,
+    0x0, 0x6, 0x30, 0xff, 0xe0, 0xc6, 0x3f, 0xff, 0x18, 0xc6, 0x18, 0x63,
+    0x18, 0xff, 0xfc, 0x63, 0x1f, 0xff, 0x8c, 0x63, 0xc, 0x71, 0xc, 0x7f,
+    0xfe, 0x1, 0x83, 0xff, 0x0, 0x30, 0x0, 0x8, 0x6, 0x7f, 0xff, 0x87,
+    0xcf, 0xfe, 0x1, 0xf8, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+5287 */
+    0x0, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x18, 0x3, 0xfe, 0x3, 0x0, 0x7f,
+    0x8c, 0x60, 0xc, 0x1, 0x8c, 0x3f, 0xff, 0x31, 0x8f, 0xff, 0xf6, 0x31,
+    0x86, 0x6, 0xc6, 0x37, 0xfe, 0xd8, 0xc6, 0xfc, 0x23, 0x18, 0xc3, 0xe,
+    0x63, 0x18, 0x7f, 0x8c, 0x63, 0x1, 0x1, 0x8c, 0x67, 0xff, 0x31, 0x8d,
+    0xff, 0xf6, 0x31, 0x83, 0x80, 0xc6, 0x31, 0xf1, 0x98, 0xc6, 0xf7, 0x63,
+    0x18, 0xc1, 0xe8, 0x63, 0x18, 0xec, 0xc, 0x67, 0x7b, 0xe1, 0x8c, 0xec,
+    0xff, 0x1, 0x98, 0x73, 0x70, 0x33, 0x3c, 0x66, 0x6, 0x6e, 0x1c, 0x7,
+    0xc8, 0xf, 0x1, 0xf8, 0x1, 0x80, 0x1c, 0x0,
+
+    /* U+5289 */
+    0x3, 0x80, 0x0, 0x3, 0xf7, 0xf0, 0x18, 0xf9, 0xff, 0x3, 0x1c, 0xc,
+    0x60, 0x63, 0x31, 0x8d, 0x8c, 0x66, 0x31, 0xb1, 0x8c, 0xe6, 0x36, 0x31,
+    0xff, 0x8e, 0xc6, 0x3c, 0x71, 0x98, 0xcf, 0xc, 0xf3, 0x19, 0x3, 0x18,
+    0x63, 0x0, 0xf8, 0xc, 0x60, 0x7f, 0xc1, 0x8c, 0x3c, 0x3e, 0x31, 0x9f,
+    0x1, 0xe6, 0x33, 0xbf, 0xe8, 0xc6, 0x47, 0xfc, 0x18, 0xc0, 0x18, 0x3,
+    0x18, 0x7f, 0xfc, 0x63, 0x1f, 0xff, 0x8c, 0x60, 0x8c, 0x1, 0x8c, 0x39,
+    0x8c, 0x1, 0x83, 0x31, 0x80, 0x30, 0x7, 0x3c, 0x6, 0x7f, 0xff, 0x87,
+    0xcf, 0xff, 0x1, 0xf8, 0x0, 0x0, 0x1c, 0x0,
+
+    /* U+5291 */
+    0x0, 0x40, 0x0, 0x40, 0x1c, 0x0, 0x18, 0x3, 0x80, 0x23, 0x3f, 0xff,
+    0xec, 0x67, 0xff, 0xfd, 0xcc, 0x2, 0x20, 0x39, 0x8e, 0x6d, 0xf7, 0x33,
+    0xf3, 0x7c, 0xe6, 0x36, 0x6d, 0x1c, 0xc6, 0x49, 0x33, 0x98, 0xc9, 0x26,
+    0x73, 0x1b, 0x24, 0xee, 0x66, 0x64, 0xfd, 0xcc, 0xd8, 0xb8, 0xf9, 0x80,
+    0x0, 0xc7, 0x30, 0xc0, 0x18, 0xe6, 0x1f, 0xff, 0x1c, 0xc3, 0xff, 0xe3,
+    0x98, 0x70, 0xc, 0x73, 0xc, 0x1, 0x8e, 0x61, 0xff, 0xf1, 0x8c, 0x3f,
+    0xfe, 0x1, 0x86, 0x0, 0xc0, 0x31, 0xc0, 0x18, 0x6, 0x70, 0x3, 0x7,
+    0xcc, 0x0, 0x61, 0xf9, 0x80, 0xc, 0x1c, 0x0,
+
+    /* U+529B */
+    0x0, 0x10, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0x38, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff, 0xf8, 0xff,
+    0xff, 0xfe, 0x0, 0x38, 0x1, 0x80, 0xe, 0x0, 0x70, 0x3, 0x80, 0x18,
+    0x0, 0xc0, 0x6, 0x0, 0x30, 0x1, 0x80, 0xc, 0x0, 0x60, 0x7, 0x0,
+    0x18, 0x1, 0xc0, 0x6, 0x0, 0x60, 0x1, 0x80, 0x38, 0x0, 0x60, 0x1c,
+    0x0, 0x38, 0x7, 0x0, 0xe, 0x3, 0x80, 0x3, 0x83, 0xc0, 0x0, 0xe1,
+    0xf0, 0x0, 0x30, 0xf0, 0x0, 0x7c, 0x78, 0x0, 0xfe, 0x1c, 0x0, 0x1f,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+529F */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0, 0x3f, 0xf0,
+    0x60, 0x7, 0xfe, 0xc, 0x0, 0xff, 0xc1, 0x80, 0x1, 0x80, 0x38, 0x0,
+    0x30, 0xff, 0xfe, 0x6, 0x1f, 0xff, 0xc0, 0xc0, 0x18, 0x38, 0x18, 0x3,
+    0x3, 0x3, 0x0, 0x60, 0x60, 0x60, 0xc, 0xc, 0xc, 0x3, 0x81, 0x81,
+    0x80, 0x70, 0x30, 0x30, 0xc, 0x6, 0x6, 0x1, 0x80, 0xc0, 0xce, 0x70,
+    0x18, 0x1f, 0xce, 0x7, 0x1f, 0xf3, 0x80, 0xe7, 0xf0, 0xe0, 0x1c, 0xf0,
+    0x3c, 0x3, 0x80, 0xf, 0x0, 0x60, 0x3, 0xc0, 0x1c, 0x1, 0xf0, 0x3f,
+    0x0, 0x38, 0x7, 0xe0, 0x0, 0x0, 0x40, 0x0,
+
+    /* U+52A0 */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0x0, 0x70, 0xf, 0xf8, 0xff, 0xf1, 0xff, 0x9f, 0xff, 0x38, 0x70,
+    0x38, 0xe6, 0x6, 0x7, 0x1c, 0xc0, 0xc0, 0xe3, 0x98, 0x18, 0x18, 0x73,
+    0x3, 0x3, 0xe, 0x60, 0x60, 0x61, 0xcc, 0xc, 0xc, 0x39, 0x81, 0x81,
+    0x87, 0x30, 0x30, 0x70, 0xe6, 0x6, 0xe, 0x18, 0xc0, 0xc1, 0x83, 0x18,
+    0x18, 0x30, 0x63, 0x3, 0xe, 0xc, 0x60, 0x61, 0xc1, 0x8c, 0xc, 0x70,
+    0x31, 0x81, 0x8e, 0xe, 0x38, 0x73, 0x83, 0xc7, 0xfe, 0x73, 0xf0, 0xff,
+    0x8c, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+52A9 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0xc, 0x0, 0x7f, 0x81, 0x80, 0xf, 0xf8,
+    0x30, 0x1, 0x87, 0x6, 0x0, 0x30, 0x60, 0xc0, 0x6, 0xc, 0x18, 0x0,
+    0xc1, 0xbf, 0xfc, 0x1f, 0xf7, 0xff, 0xc3, 0xfe, 0xc, 0x38, 0x60, 0xc1,
+    0x83, 0xc, 0x18, 0x30, 0x61, 0x83, 0x6, 0xc, 0x30, 0x61, 0xc1, 0x87,
+    0xfc, 0x38, 0x30, 0xff, 0x87, 0x6, 0x18, 0x30, 0xc0, 0xc3, 0x6, 0x18,
+    0x38, 0x60, 0xc7, 0x7, 0xc, 0x1c, 0xe0, 0xe1, 0x9f, 0xf8, 0x1c, 0x7f,
+    0xff, 0x3, 0x9f, 0xe3, 0xc0, 0x63, 0xc0, 0xf0, 0x1c, 0x0, 0x3c, 0x1f,
+    0x80, 0x7, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+52AD */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x6, 0x1, 0xff, 0xe0, 0xc0, 0x1f, 0xfe,
+    0x18, 0x0, 0x61, 0xc3, 0x0, 0xc, 0x38, 0x60, 0x3, 0x87, 0xc, 0x0,
+    0x70, 0xff, 0xfc, 0xc, 0x1d, 0xff, 0xc3, 0x83, 0x6, 0x18, 0xe0, 0xe0,
+    0xc3, 0x3c, 0xfc, 0x18, 0x67, 0x1f, 0x3, 0xc, 0x0, 0x0, 0x61, 0x83,
+    0xf8, 0x1c, 0x31, 0xff, 0xc3, 0x86, 0x3f, 0xf8, 0x60, 0xc6, 0x3, 0xc,
+    0x38, 0xc0, 0x61, 0x87, 0x18, 0xc, 0x70, 0xe3, 0x1, 0x8c, 0x1c, 0x60,
+    0x33, 0x83, 0xe, 0xe, 0x70, 0x61, 0xff, 0xdc, 0x1c, 0x1f, 0xf7, 0xf,
+    0x80, 0x0, 0xe3, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+52C7 */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfc, 0x0, 0x0,
+    0xe, 0x0, 0xf, 0xcf, 0x0, 0x0, 0x7f, 0x80, 0x1, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xfc, 0x1e, 0x7, 0x3, 0x83, 0x80, 0xc0, 0x30, 0x7f, 0xff,
+    0xfe, 0xf, 0xff, 0xff, 0xc1, 0xc0, 0x60, 0x18, 0x3f, 0xff, 0xff, 0x7,
+    0xff, 0xff, 0xe0, 0xe0, 0x30, 0xc, 0x1c, 0x6, 0x1, 0x81, 0x1, 0x80,
+    0x30, 0x0, 0x30, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0,
+    0x70, 0x1, 0x80, 0x1e, 0x0, 0x70, 0xf, 0x80, 0xe, 0x3f, 0xc0, 0x7f,
+    0x8f, 0xe0, 0xf, 0xf1, 0xc0, 0x0, 0xf0, 0x0,
+
+    /* U+52D5 */
+    0x0, 0xc, 0x10, 0x0, 0xff, 0x87, 0x1, 0xff, 0xe0, 0xe0, 0x3e, 0xc0,
+    0x1c, 0x0, 0x18, 0x3, 0x80, 0xff, 0xfc, 0x70, 0x3f, 0xff, 0x8e, 0x0,
+    0xc, 0xf, 0xfc, 0x1, 0x81, 0xff, 0xc7, 0xff, 0x86, 0x18, 0xc6, 0x38,
+    0xc3, 0x38, 0xc3, 0x18, 0x67, 0xff, 0xe3, 0xc, 0xff, 0xfc, 0x61, 0x9c,
+    0x61, 0x8c, 0x31, 0xcc, 0x71, 0x86, 0x3f, 0xfc, 0x70, 0xc0, 0x30, 0xe,
+    0x38, 0x6, 0x1, 0x87, 0x3f, 0xff, 0x30, 0xc7, 0xff, 0xee, 0x18, 0x3,
+    0x1, 0x83, 0x0, 0x60, 0x70, 0x63, 0xff, 0xfc, 0x1c, 0xff, 0xfb, 0x8f,
+    0xe, 0x0, 0x63, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+52D9 */
+    0x0, 0x0, 0x80, 0x3, 0xfe, 0x1c, 0x0, 0x7f, 0xf1, 0x80, 0x0, 0x7,
+    0x3f, 0xfe, 0x0, 0xe3, 0xff, 0xe1, 0x8c, 0x78, 0x30, 0x1f, 0x8f, 0x87,
+    0x0, 0xf0, 0xcc, 0x60, 0x7, 0x18, 0xee, 0x0, 0x30, 0x7, 0xc0, 0x7f,
+    0xf0, 0x38, 0x7, 0xff, 0x87, 0xe0, 0x7, 0x39, 0xff, 0x80, 0x73, 0x7c,
+    0x3e, 0xf, 0x7f, 0x61, 0xe0, 0xf6, 0x6, 0x0, 0x1b, 0x40, 0x70, 0x1,
+    0xb0, 0xff, 0xfc, 0x33, 0xf, 0xff, 0xc7, 0x30, 0xe, 0xc, 0x63, 0x0,
+    0xc0, 0xc4, 0x30, 0x1c, 0x1c, 0x3, 0x3, 0x81, 0xc0, 0x30, 0xf0, 0x18,
+    0x1f, 0x1e, 0x1f, 0x81, 0xf3, 0xc1, 0xf0, 0x1c, 0x0, 0x8, 0x0,
+
+    /* U+52DD */
+    0x0, 0x0, 0x40, 0x0, 0xf1, 0xe, 0x18, 0x1f, 0x98, 0xc3, 0x3, 0x99,
+    0xcc, 0x70, 0x31, 0x8c, 0xc6, 0x3, 0x19, 0xff, 0xf8, 0x31, 0xbf, 0xff,
+    0xc3, 0x18, 0x1d, 0xc0, 0x3f, 0x81, 0x8c, 0x3, 0xf8, 0x30, 0xc0, 0x31,
+    0x9f, 0xff, 0xc3, 0x1f, 0xff, 0xfe, 0x31, 0x9f, 0xff, 0xc3, 0x18, 0xc0,
+    0x38, 0x39, 0x9c, 0x61, 0xc3, 0xfb, 0x86, 0x1e, 0x3f, 0xff, 0xfe, 0xe3,
+    0x1e, 0xff, 0xf6, 0x31, 0x80, 0xe3, 0x83, 0x18, 0xc, 0x38, 0x31, 0x81,
+    0xc3, 0x7, 0x18, 0x38, 0x30, 0x71, 0x87, 0x3, 0x6, 0x18, 0xf0, 0x30,
+    0x63, 0x9e, 0x3f, 0x6, 0x7b, 0x83, 0xe0, 0x2, 0x0, 0x10, 0x0,
+
+    /* U+52DE */
+    0x2, 0x0, 0x10, 0x0, 0x60, 0x6, 0x0, 0xcc, 0xcc, 0xc6, 0x39, 0xb9,
+    0x99, 0xc6, 0x76, 0x73, 0x30, 0xcc, 0x8c, 0x66, 0x1, 0x80, 0x1c, 0x0,
+    0x7c, 0x7, 0xe0, 0x3c, 0xe1, 0xcf, 0xf, 0xe, 0xf0, 0x73, 0x80, 0xd8,
+    0x6, 0xf, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xb8,
+    0x6, 0x0, 0x77, 0x0, 0xc0, 0x6, 0xe0, 0x18, 0x0, 0xcb, 0xff, 0xff,
+    0x98, 0x7f, 0xff, 0xf8, 0x0, 0x1c, 0x7, 0x0, 0x3, 0x0, 0x60, 0x0,
+    0xe0, 0x1c, 0x0, 0x38, 0x3, 0x80, 0x3e, 0x0, 0x70, 0x3f, 0x81, 0xfc,
+    0xf, 0xc0, 0x3f, 0x1, 0x80, 0x3, 0x0, 0x0,
+
+    /* U+5305 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe0, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x1,
+    0x83, 0x80, 0x0, 0x18, 0x38, 0x0, 0x1, 0x87, 0x7f, 0xf8, 0x18, 0x6f,
+    0xff, 0xc1, 0x80, 0xe0, 0x1c, 0x18, 0xe, 0x0, 0xc1, 0x80, 0xe0, 0xc,
+    0x18, 0xe, 0x0, 0xc1, 0x80, 0xff, 0xfc, 0x18, 0xf, 0xff, 0x81, 0x80,
+    0xe0, 0x0, 0x38, 0xe, 0x0, 0x1f, 0x80, 0xe0, 0x1, 0xf0, 0xe, 0x0,
+    0x0, 0x60, 0xe0, 0x0, 0x6, 0xe, 0x0, 0x0, 0xe0, 0xe0, 0x0, 0x1e,
+    0xf, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf8,
+
+    /* U+5316 */
+    0x0, 0x40, 0x0, 0x0, 0xe, 0x30, 0x0, 0x1, 0xc3, 0x0, 0x0, 0x1c,
+    0x30, 0x0, 0x3, 0x83, 0x0, 0x0, 0x38, 0x30, 0x0, 0x7, 0x3, 0x1,
+    0xc0, 0x70, 0x30, 0x3c, 0xf, 0x3, 0xf, 0x81, 0xf0, 0x31, 0xf0, 0x1f,
+    0x3, 0x7c, 0x3, 0xf0, 0x3f, 0x80, 0x77, 0x3, 0xe0, 0x7, 0x70, 0x38,
+    0x0, 0x67, 0x3, 0x0, 0x0, 0x70, 0x30, 0x0, 0x7, 0x3, 0x0, 0x0,
+    0x70, 0x30, 0x0, 0x7, 0x3, 0x0, 0x0, 0x70, 0x30, 0x6, 0x7, 0x3,
+    0x0, 0x60, 0x70, 0x30, 0x6, 0x7, 0x3, 0x0, 0x60, 0x70, 0x38, 0xe,
+    0x7, 0x3, 0xff, 0xe0, 0x60, 0x1f, 0xfc, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+5317 */
+    0x0, 0x40, 0x80, 0x0, 0xe, 0x1c, 0x0, 0x0, 0xe1, 0xc0, 0x0, 0xe,
+    0x1c, 0x0, 0x0, 0xe1, 0xc0, 0x0, 0xe, 0x1c, 0x0, 0x0, 0xe1, 0xc1,
+    0xc0, 0xe, 0x1c, 0x7c, 0x7f, 0xe1, 0xdf, 0x87, 0xfe, 0x1f, 0xe0, 0x0,
+    0xe1, 0xf8, 0x0, 0xe, 0x1e, 0x0, 0x0, 0xe1, 0xc0, 0x0, 0xe, 0x1c,
+    0x0, 0x0, 0xe1, 0xc0, 0x0, 0xe, 0x1c, 0x0, 0x0, 0xe1, 0xc0, 0x0,
+    0xe, 0x1c, 0x0, 0x0, 0xe1, 0xc0, 0x0, 0x3e, 0x1c, 0x6, 0xf, 0xe1,
+    0xc0, 0x63, 0xee, 0x1c, 0x6, 0x78, 0xe1, 0xc0, 0xe6, 0xe, 0x1e, 0x3e,
+    0x0, 0xe0, 0xff, 0xc0, 0xe, 0x7, 0xf8, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+532F */
+    0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x38, 0x2,
+    0x4, 0x7, 0x38, 0xc1, 0x80, 0xe3, 0xb8, 0x70, 0x1c, 0x7, 0xff, 0xf3,
+    0x81, 0xff, 0xfc, 0x74, 0x7c, 0x30, 0xf, 0xcf, 0x86, 0x1, 0xdd, 0x3f,
+    0xfe, 0x38, 0x7, 0xff, 0xc7, 0x0, 0xc3, 0x0, 0xe0, 0x18, 0x60, 0x1c,
+    0x33, 0xff, 0xc3, 0x8e, 0x7f, 0xfc, 0x71, 0x8c, 0x30, 0xe, 0x71, 0x86,
+    0x1, 0xcc, 0x30, 0xc0, 0x3b, 0x87, 0xff, 0xe7, 0x60, 0x7f, 0xfc, 0xe0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
+    0xc0,
+
+    /* U+5340 */
+    0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x38, 0x0,
+    0x0, 0x7, 0xf, 0xff, 0x80, 0xe1, 0xff, 0xf8, 0x1c, 0x70, 0x7, 0x3,
+    0x8c, 0x0, 0x60, 0x71, 0x80, 0xc, 0xe, 0x38, 0x3, 0x81, 0xc3, 0xff,
+    0xf0, 0x38, 0x3f, 0xf8, 0x7, 0x0, 0x0, 0x0, 0xe7, 0xf0, 0xfe, 0x1d,
+    0xff, 0x3f, 0xc3, 0xb8, 0x6e, 0x1c, 0x76, 0xd, 0xc1, 0x8e, 0xc1, 0xb8,
+    0x31, 0xdc, 0x37, 0xe, 0x3b, 0xfe, 0x7f, 0x87, 0x3f, 0x8f, 0xf0, 0xe0,
+    0x0, 0x0, 0x1e, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
+    0xc0,
+
+    /* U+5341 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5343 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0x80, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+5348 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x1c, 0x6, 0x0,
+    0x3, 0x80, 0x60, 0x0, 0x38, 0x6, 0x0, 0x7, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+534A */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0xc, 0x6, 0x3, 0x0, 0xc0,
+    0x60, 0x70, 0xe, 0x6, 0x7, 0x0, 0x60, 0x60, 0xe0, 0x7, 0x6, 0xe,
+    0x0, 0x30, 0x60, 0xc0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5354 */
+    0xc, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0xc3,
+    0xff, 0xf0, 0xc, 0x7f, 0xff, 0xc0, 0xc1, 0xff, 0xfc, 0xc, 0x1, 0x81,
+    0xc7, 0xf8, 0x38, 0x1c, 0x7f, 0x87, 0x1, 0xc3, 0xf0, 0xe0, 0x18, 0xc,
+    0x3c, 0x7, 0x80, 0xc7, 0x83, 0xf8, 0xc, 0x60, 0x1e, 0x0, 0xc0, 0x0,
+    0x40, 0xc, 0x30, 0xc, 0x0, 0xc3, 0x0, 0xe0, 0xd, 0xff, 0x7f, 0xe0,
+    0xdf, 0xf3, 0xfe, 0xc, 0x33, 0xc, 0x60, 0xc3, 0x30, 0xc6, 0xc, 0x73,
+    0xc, 0x60, 0xc6, 0x31, 0xc6, 0xc, 0xe3, 0x18, 0x60, 0xce, 0x33, 0x8e,
+    0xd, 0xcf, 0x73, 0xc0, 0xf9, 0xe6, 0x7c, 0x4, 0x8, 0x3, 0x0,
+
+    /* U+5357 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38,
+    0xe0, 0x61, 0xc3, 0x6, 0x6, 0xc, 0x30, 0x60, 0x60, 0xc3, 0x7, 0xe,
+    0xc, 0x33, 0xff, 0xfc, 0xc3, 0x1f, 0xff, 0x8c, 0x30, 0x6, 0x0, 0xc3,
+    0x0, 0x60, 0xc, 0x33, 0xff, 0xfc, 0xc3, 0x3f, 0xff, 0xcc, 0x30, 0xe,
+    0x0, 0xc3, 0x0, 0x60, 0xc, 0x30, 0x6, 0x0, 0xc3, 0x0, 0x60, 0x1c,
+    0x30, 0x6, 0xf, 0xc3, 0x0, 0x61, 0xf8, 0x10, 0x0, 0xe, 0x0,
+
+    /* U+535A */
+    0x4, 0x0, 0x62, 0x0, 0xe0, 0x6, 0x30, 0xe, 0x0, 0x63, 0x0, 0xe7,
+    0xff, 0xfe, 0xe, 0x7f, 0xff, 0xe0, 0xe0, 0x6, 0x0, 0xe, 0xf, 0xff,
+    0x0, 0xe3, 0xff, 0xfc, 0x7f, 0xb0, 0x61, 0xc7, 0xfb, 0x6, 0xc, 0xe,
+    0x3f, 0xff, 0xc0, 0xe3, 0xe, 0x1c, 0xe, 0x30, 0x60, 0xc0, 0xe3, 0xff,
+    0xfc, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0x6, 0xc, 0xe, 0x30, 0x60, 0xc0,
+    0xe0, 0x0, 0x60, 0xe, 0xff, 0xff, 0xe0, 0xef, 0xff, 0xfe, 0xe, 0x0,
+    0x7, 0x0, 0xe0, 0x80, 0x60, 0xe, 0xe, 0x6, 0x0, 0xe0, 0x60, 0x60,
+    0xe, 0x2, 0xe, 0x0, 0xe0, 0x7, 0xe0, 0x4, 0x0, 0x3c, 0x0,
+
+    /* U+5361 */
+    0x0, 0x8, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1,
+    0xc0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x1c, 0x0,
+    0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0,
+    0x1c, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xc0,
+    0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1d, 0x80, 0x0,
+    0x1, 0xde, 0x0, 0x0, 0x1c, 0xf0, 0x0, 0x1, 0xc7, 0xc0, 0x0, 0x1c,
+    0x1e, 0x0, 0x1, 0xc0, 0xf0, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x0,
+    0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5370 */
+    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x7, 0xf1, 0xff, 0x8f, 0xe0, 0xff,
+    0xef, 0x0, 0x60, 0x77, 0x0, 0x30, 0x1b, 0x80, 0x18, 0xd, 0xc0, 0xc,
+    0x6, 0xe0, 0x6, 0x3, 0x70, 0x3, 0x1, 0xb8, 0x1, 0x80, 0xdf, 0xf8,
+    0xc0, 0x6f, 0xfc, 0x60, 0x37, 0x0, 0x30, 0x1b, 0x80, 0x18, 0xd, 0xc0,
+    0xc, 0x6, 0xe0, 0x6, 0x3, 0x70, 0x3, 0x1, 0xb8, 0x1, 0x80, 0xdc,
+    0x0, 0xc0, 0x6e, 0x0, 0x60, 0x73, 0xff, 0x31, 0xf9, 0xff, 0x99, 0xf8,
+    0x0, 0xc, 0x0, 0x0, 0x6, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x80,
+    0x0,
+
+    /* U+5378 */
+    0x4, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x70, 0x1, 0xfe, 0xf, 0xfe,
+    0x7f, 0xe3, 0xff, 0xce, 0x1c, 0x63, 0x81, 0x81, 0x9c, 0x70, 0x30, 0x33,
+    0xe, 0x6, 0x6, 0x1, 0xc0, 0xc0, 0xcf, 0xff, 0xd8, 0x19, 0xff, 0xfb,
+    0x3, 0x0, 0xe0, 0x60, 0x60, 0x1c, 0xc, 0xc, 0x33, 0x81, 0x81, 0x86,
+    0x70, 0x30, 0x30, 0xcf, 0xe6, 0x6, 0x19, 0xfc, 0xc0, 0xc3, 0x38, 0x18,
+    0x18, 0x67, 0x3, 0x3, 0xc, 0xe0, 0x60, 0x61, 0x9c, 0xc, 0x1c, 0x33,
+    0xfd, 0x9f, 0x8f, 0xff, 0x33, 0xf3, 0xfe, 0x6, 0x78, 0x78, 0x0, 0xc0,
+    0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0, 0x0,
+
+    /* U+539D */
+    0x7, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc3, 0x81,
+    0x0, 0x80, 0x38, 0x18, 0x18, 0x1, 0x81, 0x81, 0x80, 0x19, 0xff, 0xff,
+    0xc1, 0x9f, 0xff, 0xfc, 0x18, 0x18, 0x18, 0x1, 0x81, 0x81, 0x80, 0x18,
+    0x18, 0x18, 0x1, 0xbf, 0xff, 0xfc, 0x3b, 0xff, 0xff, 0xe3, 0x80, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0x3, 0x8f, 0xff, 0xf0, 0x38, 0xff, 0xff, 0x3,
+    0x8c, 0x0, 0x30, 0x30, 0xc0, 0x3, 0x3, 0xf, 0xff, 0xf0, 0x70, 0xff,
+    0xff, 0x7, 0xc, 0x0, 0x30, 0x70, 0xe0, 0x3, 0x6, 0xf, 0xff, 0xf0,
+    0x60, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+539F */
+    0x7, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x80,
+    0x18, 0x0, 0x18, 0x3, 0x80, 0x1, 0x80, 0x38, 0x0, 0x18, 0xff, 0xff,
+    0x81, 0x8f, 0xff, 0xf8, 0x18, 0xc0, 0x1, 0x81, 0x8c, 0x0, 0x18, 0x18,
+    0xff, 0xff, 0x81, 0x8f, 0xff, 0xf8, 0x18, 0xc0, 0x1, 0x81, 0x8c, 0x0,
+    0x18, 0x18, 0xe0, 0x3, 0x81, 0x8f, 0xff, 0xf8, 0x18, 0x7f, 0xff, 0x3,
+    0x80, 0x1c, 0x0, 0x38, 0x31, 0xc4, 0x3, 0x87, 0x1c, 0x70, 0x30, 0xe1,
+    0xc7, 0x87, 0x1e, 0x1c, 0x3c, 0x73, 0xc1, 0xc1, 0xe6, 0x70, 0x7c, 0xe,
+    0x62, 0xf, 0x80, 0x0, 0x0, 0x70, 0x0,
+
+    /* U+53BB */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x7, 0x0, 0x3, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xfc, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff,
+    0xfd, 0xff, 0xff, 0xfe, 0x0, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0, 0xc,
+    0x6, 0x0, 0x7, 0x1, 0xc0, 0x1, 0x80, 0x38, 0x0, 0xe0, 0x7, 0x0,
+    0x30, 0x0, 0xe0, 0x1c, 0x7, 0xfc, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xe0,
+    0xe7, 0xc0, 0x0, 0x18, 0x0, 0x0, 0x0,
+
+    /* U+53C3 */
+    0x0, 0x10, 0x0, 0x0, 0x3, 0x7, 0x0, 0x0, 0x70, 0x3c, 0x0, 0x7f,
+    0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0xf8, 0x1, 0x18, 0x6, 0x0, 0x38,
+    0x0, 0xe4, 0x3, 0x18, 0xc, 0x60, 0x71, 0xc3, 0xff, 0x6f, 0xfe, 0x7f,
+    0xbf, 0xfc, 0x67, 0x3, 0xf8, 0x0, 0x0, 0x71, 0xc0, 0x0, 0x1e, 0xf,
+    0x0, 0x7, 0xc3, 0x7c, 0x3, 0xf0, 0xf1, 0xf8, 0x7c, 0x3e, 0x7, 0xe6,
+    0x1f, 0x82, 0x1e, 0xf, 0xc1, 0xf0, 0x1, 0xe0, 0x7e, 0x0, 0x0, 0x3f,
+    0x3, 0x80, 0x3f, 0x81, 0xf0, 0x7, 0xc0, 0x7e, 0x0, 0x0, 0x3f, 0x80,
+    0x1, 0xff, 0x80, 0x1, 0xff, 0xc0, 0x0, 0x1f, 0x0, 0x0, 0x0,
+
+    /* U+53CA */
+    0x1f, 0xff, 0x80, 0x3, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x1c,
+    0x6, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x1c, 0xe, 0x0, 0x1, 0xc0, 0xe0,
+    0x0, 0x1c, 0xc, 0x0, 0x1, 0xe0, 0xff, 0x0, 0x1e, 0xf, 0xf8, 0x1,
+    0xf0, 0x3f, 0x80, 0x1b, 0x0, 0x30, 0x3, 0xb8, 0x3, 0x0, 0x31, 0x80,
+    0x70, 0x3, 0x1c, 0x6, 0x0, 0x70, 0xe0, 0xe0, 0x7, 0x7, 0x1c, 0x0,
+    0x60, 0x3b, 0x80, 0xe, 0x3, 0xf8, 0x1, 0xc0, 0x1f, 0x0, 0x3c, 0x1,
+    0xf8, 0x3, 0x80, 0x7f, 0xe0, 0x70, 0x1f, 0x1f, 0xc6, 0x7, 0xc0, 0x7e,
+    0x0, 0xf8, 0x1, 0xe0, 0x4, 0x0, 0x0,
+
+    /* U+53CB */
+    0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xf0, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xff, 0xfe, 0x0, 0xf, 0xff, 0xf0, 0x0, 0xe0, 0x7, 0x0, 0x1c, 0x80,
+    0x70, 0x1, 0x9c, 0x6, 0x0, 0x38, 0xc0, 0xe0, 0x3, 0x8e, 0x1c, 0x0,
+    0x70, 0x61, 0x80, 0x7, 0x7, 0x38, 0x0, 0xe0, 0x3f, 0x0, 0x1c, 0x1,
+    0xe0, 0x1, 0xc0, 0x3f, 0x80, 0x38, 0x7, 0xfc, 0x7, 0x3, 0xe1, 0xf8,
+    0x60, 0xfc, 0x7, 0xe0, 0x1f, 0x0, 0x1e, 0x0, 0x80, 0x0, 0x0,
+
+    /* U+53CD */
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xc0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf8, 0xc,
+    0x0, 0x3, 0x0, 0xc0, 0x0, 0x70, 0xc, 0x30, 0x6, 0x0, 0xc3, 0x80,
+    0xe0, 0xc, 0x38, 0xc, 0x1, 0xc1, 0xc1, 0xc0, 0x1c, 0xe, 0x38, 0x1,
+    0xc0, 0x77, 0x0, 0x1c, 0x7, 0xe0, 0x3, 0x80, 0x3e, 0x0, 0x38, 0x7,
+    0xf0, 0x3, 0x81, 0xf7, 0xc0, 0x70, 0xfc, 0x3f, 0x7, 0x3f, 0x80, 0xfe,
+    0x67, 0xc0, 0x3, 0xe0, 0x20, 0x0, 0x4,
+
+    /* U+53D4 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x83, 0xff, 0x80, 0x38,
+    0x3f, 0xfc, 0x3, 0xf9, 0xff, 0xc0, 0x3f, 0x80, 0x1c, 0x3, 0x80, 0x81,
+    0xc0, 0x38, 0x1c, 0x18, 0x3, 0x81, 0xc1, 0x80, 0x38, 0xc, 0x18, 0x7f,
+    0xfc, 0xc3, 0x87, 0xff, 0xcc, 0x38, 0x3, 0x80, 0xc3, 0x0, 0x18, 0xe,
+    0x70, 0x19, 0x90, 0x67, 0x1, 0x99, 0x86, 0x60, 0x39, 0x9c, 0x7e, 0x3,
+    0x98, 0xc3, 0xc0, 0x31, 0x8c, 0x3c, 0x7, 0x18, 0xe3, 0xc0, 0x71, 0x86,
+    0x7e, 0x6, 0x18, 0xf, 0xf0, 0x41, 0x81, 0xe7, 0x80, 0x38, 0x7c, 0x3c,
+    0x1f, 0x8f, 0x81, 0xe1, 0xf0, 0xe0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+53D6 */
+    0x7f, 0xff, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1c, 0x38, 0x0, 0x1, 0xc1,
+    0x80, 0x0, 0x1c, 0x1b, 0xff, 0xc1, 0xc1, 0x9f, 0xfc, 0x1f, 0xf8, 0x1,
+    0xc1, 0xff, 0x88, 0xc, 0x1c, 0x38, 0xc0, 0xc1, 0xc1, 0x8c, 0x1c, 0x1c,
+    0x18, 0xc1, 0x81, 0xc1, 0x8c, 0x18, 0x1f, 0xf8, 0xe3, 0x81, 0xff, 0x8e,
+    0x38, 0x1f, 0xf8, 0x63, 0x1, 0xc1, 0x87, 0x70, 0x1c, 0x18, 0x36, 0x1,
+    0xc1, 0x83, 0xe0, 0x1c, 0xf8, 0x1c, 0x1, 0xff, 0x83, 0xc0, 0x7f, 0x98,
+    0x7f, 0x7, 0xc1, 0x8f, 0x78, 0x0, 0x19, 0xe3, 0xc0, 0x1, 0xbc, 0x1e,
+    0x0, 0x1b, 0x0, 0x60, 0x1, 0x0, 0x0,
+
+    /* U+53D7 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc7, 0xff, 0xff, 0xe1, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x8, 0x3, 0x6, 0x7, 0x0, 0xc1, 0xc1, 0x80, 0x38,
+    0x30, 0xe0, 0x6, 0x4, 0x30, 0xf, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf9,
+    0x80, 0x0, 0x6, 0xe0, 0x0, 0x1, 0xb8, 0x0, 0x0, 0x6e, 0xff, 0xff,
+    0x99, 0x3f, 0xff, 0xe2, 0x0, 0x0, 0x38, 0x0, 0x60, 0x1c, 0x0, 0x1c,
+    0xe, 0x0, 0x3, 0xc7, 0x0, 0x0, 0x7f, 0x80, 0x0, 0xf, 0xc0, 0x0,
+    0x7, 0xf8, 0x0, 0x1f, 0xef, 0xf8, 0x7f, 0xc0, 0xff, 0xff, 0x80, 0x7,
+    0xf0, 0x0, 0x0, 0x0,
+
+    /* U+53E1 */
+    0x1, 0x80, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xfe, 0x7f, 0xc0, 0x1f,
+    0xcf, 0xfe, 0x1, 0xc0, 0x3f, 0xe3, 0xff, 0xf0, 0xe, 0x7f, 0xff, 0x20,
+    0xc6, 0x0, 0x36, 0xc, 0x6f, 0xfb, 0x70, 0xc6, 0x61, 0xb7, 0xc, 0x6,
+    0x1c, 0x31, 0xc1, 0xcc, 0xf3, 0x18, 0x39, 0xe3, 0x31, 0x86, 0x3f, 0x83,
+    0x18, 0xe, 0x1e, 0x1b, 0x83, 0xe0, 0xf1, 0xb0, 0x7f, 0xff, 0x9f, 0x7,
+    0xc0, 0xc0, 0xf0, 0x1c, 0xc, 0xe, 0x1, 0xff, 0xc0, 0xe0, 0x1c, 0xc,
+    0x1f, 0x1, 0xc0, 0xc1, 0xf8, 0x1f, 0xfc, 0x3b, 0xc1, 0xc0, 0xc7, 0x1c,
+    0xf, 0xfc, 0xe0, 0xe0, 0xff, 0xdc, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+53E3 */
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x78, 0x0, 0x1e,
+    0x70, 0x0, 0xe, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x70, 0x0, 0xe, 0x78, 0x0, 0x1e,
+    0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
+
+    /* U+53E4 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0,
+    0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x70,
+    0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53EC */
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf8, 0x0, 0xc0,
+    0x6, 0x0, 0x30, 0x1, 0x80, 0x1c, 0x0, 0xe0, 0x7, 0x0, 0x38, 0x3,
+    0x80, 0xe, 0x1, 0xc0, 0x3, 0x80, 0xf0, 0x3, 0xc1, 0xf8, 0xf, 0xf1,
+    0xf8, 0x3, 0xf8, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xfc, 0xe, 0x0, 0x3, 0x83, 0x0, 0x0, 0xe0, 0xc0,
+    0x0, 0x38, 0x30, 0x0, 0xe, 0xc, 0x0, 0x3, 0x83, 0x0, 0x0, 0xe0,
+    0xf0, 0x0, 0x78, 0x3f, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+53EF */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe,
+    0x0, 0x7f, 0xc0, 0xe0, 0xf, 0xfe, 0xe, 0x0, 0xe0, 0x70, 0xe0, 0xc,
+    0x7, 0xe, 0x0, 0xc0, 0x70, 0xe0, 0xc, 0x7, 0xe, 0x0, 0xc0, 0x70,
+    0xe0, 0xc, 0x7, 0xe, 0x0, 0xc0, 0x70, 0xe0, 0xf, 0xff, 0xe, 0x0,
+    0xff, 0xe0, 0xe0, 0x3, 0xf8, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1f, 0xe0,
+    0x0, 0x1, 0xfc, 0x0, 0x0, 0xf, 0x0,
+
+    /* U+53F0 */
+    0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0xe,
+    0x3, 0x0, 0x0, 0xe0, 0x38, 0x0, 0x1c, 0x1, 0xc0, 0x1, 0xc0, 0xe,
+    0x0, 0x38, 0x0, 0x70, 0x3, 0x0, 0xf, 0x87, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xf0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0,
+    0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+53F2 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x7, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf8, 0x1c, 0x6, 0x3,
+    0x81, 0xc0, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x18,
+    0x6, 0x1, 0x81, 0xc0, 0x60, 0x18, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xf0, 0x0, 0xe, 0x0, 0x0, 0x30, 0xe0, 0x0, 0x3, 0x8c, 0x0, 0x0,
+    0x1c, 0xc0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x78,
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x1, 0xef, 0xc0, 0x0, 0xf8, 0x3f, 0xe0,
+    0x7f, 0x0, 0x7f, 0xe7, 0xc0, 0x0, 0xfe, 0x20, 0x0, 0x0, 0x40,
+
+    /* U+53F8 */
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x73, 0xff, 0xfe, 0x1c, 0xff,
+    0xff, 0xc7, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x1c,
+    0x1f, 0xfc, 0x7, 0xf, 0xff, 0x81, 0xc3, 0x80, 0xf0, 0x70, 0xc0, 0x1c,
+    0x1c, 0x30, 0x7, 0x7, 0xc, 0x1, 0xc1, 0xc3, 0x0, 0x70, 0x70, 0xe0,
+    0x1c, 0x1c, 0x3f, 0xff, 0x7, 0xf, 0xff, 0x81, 0xc0, 0x0, 0x0, 0x70,
+    0x0, 0x0, 0x1c, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x7,
+    0x80,
+
+    /* U+5403 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x18, 0x0, 0x1f, 0x87,
+    0x0, 0x7, 0xf8, 0xe0, 0x0, 0xc7, 0x1f, 0xff, 0x98, 0x67, 0xff, 0xf3,
+    0xc, 0xc0, 0x0, 0x61, 0xb8, 0x0, 0xc, 0x3e, 0x0, 0x1, 0x87, 0x80,
+    0x0, 0x30, 0xc7, 0xff, 0x6, 0x18, 0xff, 0xc0, 0xc3, 0x0, 0x70, 0x18,
+    0x60, 0x1c, 0x3, 0xc, 0xf, 0x0, 0x61, 0x83, 0x80, 0xc, 0x30, 0xe0,
+    0x1, 0xce, 0x38, 0x0, 0x3f, 0x8e, 0x0, 0x23, 0xf1, 0x80, 0xc, 0x0,
+    0x70, 0x1, 0x80, 0xe, 0x0, 0x30, 0x0, 0xf0, 0x1e, 0x0, 0x1f, 0xff,
+    0x80, 0x0, 0x7f, 0xc0,
+
+    /* U+5408 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0x71, 0xe0, 0x0, 0xe, 0xf, 0x0, 0x3, 0xc0, 0x3c,
+    0x0, 0x78, 0x1, 0xf0, 0x1f, 0x0, 0xf, 0xc7, 0xc0, 0x0, 0x3e, 0x7b,
+    0xff, 0xfc, 0xe6, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0xf, 0xff, 0xff, 0x0,
+    0xe0, 0x0, 0x70, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xf0, 0x0, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+
+    /* U+5409 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+
+    /* U+540C */
+    0xf, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf9, 0xc0, 0x0,
+    0xe, 0x70, 0x0, 0x1, 0x9c, 0x0, 0x0, 0x67, 0x3f, 0xff, 0x99, 0xcf,
+    0xff, 0xc6, 0x70, 0x0, 0x1, 0x9c, 0x0, 0x0, 0x67, 0x0, 0x0, 0x19,
+    0xc3, 0xff, 0x6, 0x71, 0xff, 0xe1, 0x9c, 0x70, 0x18, 0x67, 0x18, 0x6,
+    0x19, 0xc6, 0x1, 0x86, 0x71, 0x80, 0x61, 0x9c, 0x60, 0x18, 0x67, 0x1c,
+    0xe, 0x19, 0xc7, 0xff, 0x86, 0x70, 0x7f, 0xc1, 0x9c, 0x0, 0x0, 0x67,
+    0x0, 0x0, 0x19, 0xc0, 0x0, 0x7e, 0x70, 0x0, 0x3f, 0x88, 0x0, 0x7,
+    0x0,
+
+    /* U+540D */
+    0x0, 0x10, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0, 0x0, 0x3, 0xff,
+    0xf8, 0x1, 0xff, 0xff, 0x1, 0xe0, 0x3, 0x80, 0xf0, 0x1, 0xc0, 0x78,
+    0x0, 0xe0, 0x39, 0x80, 0xf0, 0x1c, 0x78, 0x78, 0x0, 0xf, 0x38, 0x0,
+    0x0, 0xfc, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x3f, 0x0,
+    0x0, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x9e, 0xe0, 0x0, 0x66, 0x18,
+    0x0, 0x18, 0x6, 0x0, 0x6, 0x1, 0x80, 0x1, 0x80, 0x60, 0x0, 0x60,
+    0x18, 0x0, 0x18, 0x7, 0x0, 0xe, 0x1, 0xff, 0xff, 0x80, 0x1f, 0xff,
+    0x80,
+
+    /* U+541B */
+    0x1f, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x1c, 0x7, 0x0, 0x1,
+    0x80, 0x30, 0x0, 0x18, 0x3, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x3, 0x80, 0x70, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0,
+    0x70, 0x7, 0x1, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfc, 0x0, 0x1c, 0x0,
+    0x0, 0x3, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x7, 0xff, 0xff, 0x81,
+    0xf8, 0x0, 0x38, 0x3f, 0x80, 0x1, 0x87, 0xb8, 0x0, 0x18, 0x63, 0x80,
+    0x1, 0x80, 0x38, 0x0, 0x18, 0x3, 0x80, 0x3, 0x80, 0x1f, 0xff, 0xf8,
+    0x0, 0xff, 0xff, 0x0,
+
+    /* U+5433 */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x7f, 0xfc, 0x0, 0xce,
+    0x1, 0xc0, 0x1c, 0xe0, 0xc, 0x1, 0xce, 0x0, 0xc0, 0x1c, 0xe0, 0x1c,
+    0x1, 0xc7, 0xff, 0xc0, 0x1c, 0x7f, 0xfc, 0x1, 0xc1, 0xff, 0x0, 0x1c,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70, 0x0, 0xc, 0x7, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf0, 0x0, 0x0, 0x3b,
+    0x0, 0x0, 0x7, 0x1c, 0x0, 0x0, 0xf0, 0xf8, 0x0, 0x3e, 0x7, 0xf0,
+    0x3f, 0x80, 0x1f, 0xc7, 0xe0, 0x0, 0x7e, 0x60, 0x0, 0x0, 0x40,
+
+    /* U+544A */
+    0x0, 0x6, 0x0, 0x0, 0x30, 0x60, 0x0, 0x7, 0x6, 0x0, 0x0, 0x60,
+    0x60, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf8, 0x1c, 0x7, 0x0,
+    0x1, 0x80, 0x60, 0x0, 0x38, 0x6, 0x0, 0x1, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xc0, 0x0, 0x30, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5468 */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xe, 0x3,
+    0x0, 0xe1, 0xc0, 0x60, 0x1c, 0x38, 0xc, 0x3, 0x87, 0x3f, 0xfe, 0x70,
+    0xe7, 0xff, 0xce, 0x1c, 0x6, 0x1, 0xc3, 0x80, 0xc0, 0x38, 0x77, 0xff,
+    0xe7, 0xe, 0xff, 0xfe, 0xe1, 0x80, 0x0, 0x1c, 0x30, 0x0, 0x3, 0x86,
+    0xf, 0xf0, 0x70, 0xc7, 0xff, 0x8e, 0x18, 0xe0, 0x71, 0xc3, 0x18, 0x6,
+    0x38, 0xe3, 0x0, 0xc7, 0x1c, 0x60, 0x18, 0xe3, 0x8f, 0xff, 0x1c, 0x61,
+    0xff, 0xe3, 0x9c, 0xf, 0xf0, 0x73, 0x80, 0x0, 0x7e, 0x60, 0x0, 0x1f,
+    0x80, 0x0, 0x1, 0xc0,
+
+    /* U+5471 */
+    0x0, 0x0, 0x1, 0x80, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xfe, 0x3f, 0x9f,
+    0xfb, 0x7, 0xf3, 0x9c, 0x60, 0xc6, 0x63, 0x8c, 0x18, 0xcc, 0x71, 0x83,
+    0x19, 0x8e, 0x30, 0x63, 0x31, 0xc6, 0xc, 0x66, 0x38, 0xc1, 0x8c, 0xc7,
+    0x18, 0x31, 0x98, 0xe3, 0x6, 0x33, 0x1c, 0x60, 0xc6, 0x63, 0x8e, 0x18,
+    0xcc, 0x70, 0xc3, 0x19, 0x8e, 0x18, 0x63, 0x31, 0xc3, 0xc, 0x6e, 0x38,
+    0x61, 0xfd, 0x87, 0xc, 0x3f, 0xb0, 0xed, 0xc0, 0xe, 0x1d, 0xb8, 0x1,
+    0xc3, 0xfb, 0x0, 0x73, 0xff, 0x70, 0x1e, 0xfc, 0x3e, 0x7, 0x98, 0x4,
+    0xc0, 0xe0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+547C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x7f, 0xfe, 0x3f, 0xbf,
+    0xff, 0x7, 0xf3, 0xce, 0x0, 0xc6, 0x1, 0xc0, 0x18, 0xc0, 0x38, 0x63,
+    0x19, 0xc7, 0xc, 0x63, 0x18, 0xe3, 0x8c, 0x63, 0x1c, 0x61, 0x8c, 0x73,
+    0x8c, 0x31, 0x86, 0x73, 0x86, 0x30, 0xe, 0x0, 0xc6, 0x1, 0xc0, 0x18,
+    0xcf, 0xff, 0xf3, 0x1b, 0xff, 0xfe, 0x63, 0x1f, 0xff, 0x8c, 0x60, 0x1c,
+    0x1, 0xfc, 0x3, 0x80, 0x3f, 0x80, 0x70, 0x1, 0xe0, 0xe, 0x0, 0x0,
+    0x1, 0xc0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x0, 0x7, 0xe0,
+    0x0, 0x1, 0xf8, 0x0, 0x0, 0x1c, 0x0, 0x0,
+
+    /* U+547D */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xbc, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0x1e, 0x7, 0x80, 0x7, 0x80, 0x3e,
+    0x1, 0xf0, 0x0, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x9f, 0xff, 0x8e, 0x40,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xf,
+    0xf0, 0x1f, 0xf1, 0xff, 0x81, 0xc7, 0x1c, 0x18, 0x18, 0x31, 0x81, 0x81,
+    0x83, 0x18, 0x18, 0x18, 0x31, 0x81, 0x81, 0x83, 0x18, 0x18, 0x18, 0x31,
+    0x81, 0x81, 0x83, 0x18, 0x18, 0x1f, 0xf1, 0x83, 0x81, 0xff, 0x19, 0xf8,
+    0x0, 0x1, 0x8f, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0,
+
+    /* U+548C */
+    0x0, 0x8, 0x0, 0x0, 0x3f, 0x80, 0x1, 0xff, 0xe0, 0x0, 0x3f, 0xe0,
+    0x3f, 0x80, 0x18, 0x1f, 0xfc, 0x3, 0x3, 0xff, 0x80, 0x60, 0x60, 0x30,
+    0xc, 0xc, 0x6, 0x7f, 0xfd, 0x80, 0xcf, 0xff, 0xb0, 0x18, 0xf, 0x6,
+    0x3, 0x1, 0xc0, 0xc0, 0x60, 0x38, 0x18, 0xc, 0xf, 0xc3, 0x1, 0x81,
+    0xfc, 0x60, 0x30, 0x6d, 0xcc, 0x6, 0xd, 0x99, 0x80, 0xc3, 0x31, 0xb0,
+    0x18, 0xe6, 0x16, 0x3, 0x18, 0xc0, 0xc0, 0x67, 0x18, 0x18, 0xc, 0xc3,
+    0x3, 0x1, 0x80, 0x60, 0x70, 0x70, 0xc, 0xf, 0xfe, 0x1, 0x80, 0xff,
+    0x80, 0x30, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+5496 */
+    0x0, 0x10, 0x0, 0x0, 0x6, 0x0, 0x0, 0x3, 0x80, 0x1, 0xf8, 0xe0,
+    0x0, 0x7e, 0x38, 0x1f, 0x99, 0xbf, 0xcf, 0xe6, 0x6f, 0xfb, 0xb9, 0x98,
+    0xe6, 0xc6, 0x66, 0x31, 0xb1, 0x99, 0x8c, 0x6c, 0x66, 0x63, 0x1b, 0x19,
+    0x98, 0xc6, 0xc6, 0x66, 0x31, 0xb1, 0x99, 0x8c, 0x6c, 0x66, 0x63, 0x1b,
+    0x19, 0x98, 0xce, 0xc6, 0x66, 0x33, 0xb1, 0x99, 0x9c, 0xec, 0x67, 0xe6,
+    0x33, 0x19, 0xf9, 0x8c, 0xc6, 0x18, 0x63, 0x31, 0x80, 0x38, 0xcc, 0x60,
+    0xc, 0x33, 0xb8, 0x7, 0x3c, 0xfe, 0x3, 0x9e, 0x1f, 0x80, 0xc7, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+54AA */
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0, 0x3f, 0x98,
+    0x60, 0x87, 0xf3, 0xc, 0x30, 0xc6, 0x71, 0x86, 0x18, 0xc7, 0x31, 0xc3,
+    0x18, 0xe6, 0x70, 0x63, 0xc, 0xcc, 0xc, 0x60, 0x18, 0x1, 0x8d, 0xff,
+    0xfe, 0x31, 0xff, 0xff, 0xe6, 0x37, 0xff, 0xfc, 0xc6, 0x3, 0xe0, 0x18,
+    0xc0, 0xfc, 0x3, 0x18, 0x1f, 0xc0, 0x63, 0x6, 0xd8, 0xc, 0x61, 0xd9,
+    0x81, 0xfc, 0x73, 0x38, 0x3f, 0x9e, 0x63, 0x83, 0xe7, 0x8c, 0x78, 0x1,
+    0xe1, 0x87, 0x80, 0x38, 0x30, 0x70, 0x6, 0x6, 0x6, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0, 0x0,
+
+    /* U+54C1 */
+    0x1, 0xff, 0xe0, 0x1, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xc0, 0x38, 0x0,
+    0x70, 0xe, 0x0, 0xc, 0x3, 0x80, 0x3, 0x0, 0xe0, 0x0, 0xc0, 0x38,
+    0x0, 0x70, 0x7, 0x0, 0x3c, 0x1, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xc7, 0xfe, 0x1f,
+    0xf9, 0xc1, 0xc6, 0xe, 0x60, 0x33, 0x81, 0x98, 0xc, 0xe0, 0x66, 0x3,
+    0x38, 0x19, 0x80, 0xce, 0x6, 0x60, 0x33, 0x81, 0x98, 0xc, 0xe0, 0x67,
+    0x7, 0x38, 0x19, 0xff, 0xc7, 0xfe, 0x3f, 0xe1, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+54E1 */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xff, 0x0, 0xe0,
+    0x0, 0x70, 0xe, 0x0, 0x3, 0x0, 0xf0, 0x0, 0x70, 0x7, 0xff, 0xff,
+    0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf,
+    0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x1, 0x81, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x18, 0x1c, 0x0, 0x3, 0x81,
+    0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1f, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x20, 0x20, 0x0, 0x1e, 0x7, 0xc0,
+    0x3f, 0xe0, 0x3f, 0xc7, 0xf0, 0x0, 0x7e, 0x70, 0x0, 0x0, 0x60,
+
+    /* U+54E5 */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0xf, 0xff, 0x6, 0x0, 0xff, 0xf0, 0x60, 0xc, 0x3, 0x6,
+    0x0, 0xc0, 0x30, 0x60, 0xe, 0x7, 0x6, 0x0, 0xff, 0xf3, 0xe0, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x3, 0x80, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x60, 0xf, 0xfe, 0x6, 0x0,
+    0xff, 0xf0, 0x60, 0x1c, 0x3, 0x6, 0x1, 0xc0, 0x30, 0x60, 0x1c, 0x3,
+    0x6, 0x0, 0xff, 0xf0, 0x60, 0xf, 0xff, 0x6, 0x0, 0x0, 0x7, 0xe0,
+    0x0, 0x0, 0xfe, 0x0, 0x0, 0x7, 0x80,
+
+    /* U+54E9 */
+    0x0, 0xf, 0xfe, 0x3, 0x87, 0xff, 0xe1, 0xfc, 0xe3, 0x8e, 0x3f, 0x98,
+    0x60, 0xc6, 0x33, 0xc, 0x18, 0xc6, 0x61, 0x83, 0x18, 0xcf, 0xff, 0xe3,
+    0x19, 0xff, 0xfc, 0x63, 0x30, 0xc1, 0x8c, 0x66, 0x18, 0x31, 0x8c, 0xc3,
+    0x6, 0x31, 0x9f, 0xff, 0xc6, 0x33, 0xff, 0xf0, 0xc6, 0x1f, 0xf8, 0x18,
+    0xc0, 0x30, 0x3, 0x18, 0x6, 0x0, 0x63, 0x0, 0xe0, 0xf, 0xef, 0xff,
+    0xf1, 0xfc, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0xf, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0xc0,
+
+    /* U+54F2 */
+    0x3, 0x0, 0x1, 0x80, 0x30, 0x3, 0xf8, 0x3, 0x1, 0xff, 0x0, 0x70,
+    0x3f, 0x0, 0x7f, 0xf3, 0x0, 0x3, 0xfe, 0x30, 0x0, 0x3, 0x3, 0x0,
+    0x0, 0x30, 0x3f, 0xfe, 0x3, 0x77, 0xff, 0xe3, 0xff, 0x70, 0x60, 0x7f,
+    0xc7, 0x6, 0x6, 0x30, 0x70, 0x60, 0x3, 0xe, 0x6, 0x0, 0x70, 0xe0,
+    0x60, 0x1f, 0x1c, 0x6, 0x1, 0xe1, 0xc0, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x80, 0xc0, 0x0, 0x38, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x30,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0,
+
+    /* U+552E */
+    0x3, 0x0, 0x80, 0x0, 0x70, 0x18, 0x0, 0x6, 0x3, 0x80, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc3, 0xc0, 0x30, 0x0, 0x7e, 0x7, 0x0,
+    0x6, 0xff, 0xff, 0xf8, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x0, 0xf,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0xc, 0x3, 0x0, 0x0, 0xe0, 0x30,
+    0x0, 0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0xc, 0x0,
+    0x1, 0x80, 0xc0, 0x0, 0x18, 0xc, 0x0, 0x1, 0x80, 0xc0, 0x0, 0x18,
+    0xf, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf0,
+
+    /* U+5531 */
+    0x0, 0x7, 0xfe, 0x0, 0x7, 0xff, 0xc7, 0xf1, 0xc0, 0x39, 0xfc, 0x60,
+    0xe, 0x63, 0x18, 0x3, 0x98, 0xc7, 0xff, 0xe6, 0x31, 0xff, 0xf9, 0x8c,
+    0x60, 0xe, 0x63, 0x18, 0x3, 0x98, 0xc7, 0xff, 0xc6, 0x31, 0xff, 0xf1,
+    0x8c, 0x0, 0x0, 0x63, 0x0, 0x0, 0x18, 0xc7, 0xff, 0xc6, 0x33, 0xff,
+    0xf9, 0x8c, 0xc0, 0x7, 0x63, 0x30, 0x1, 0xdf, 0xcc, 0x0, 0x77, 0xf3,
+    0xff, 0xfc, 0xf8, 0xff, 0xff, 0x0, 0x30, 0x1, 0xc0, 0xc, 0x0, 0x70,
+    0x3, 0x0, 0x1c, 0x0, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+5546 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x18, 0x3, 0x80, 0x1, 0xc0, 0x30,
+    0x0, 0x1c, 0x3, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38,
+    0x31, 0x81, 0xc3, 0x7, 0x18, 0xc, 0x30, 0x61, 0x84, 0xc3, 0xe, 0x1c,
+    0xcc, 0x33, 0xc1, 0xfc, 0xc3, 0x38, 0x7, 0xc, 0x30, 0x0, 0x0, 0xc3,
+    0xf, 0xff, 0xc, 0x30, 0xff, 0xf0, 0xc3, 0x1c, 0x3, 0xc, 0x31, 0xc0,
+    0x30, 0xc3, 0x1c, 0x3, 0xc, 0x30, 0xff, 0xf0, 0xc3, 0xf, 0xff, 0xc,
+    0x30, 0x0, 0xf, 0xc3, 0x0, 0x0, 0xfc, 0x10, 0x0, 0x7, 0x0,
+
+    /* U+554A */
+    0x0, 0x38, 0x0, 0x0, 0x1f, 0xbf, 0xf9, 0xf3, 0xff, 0xff, 0x7e, 0x66,
+    0x1, 0xce, 0xcc, 0xc0, 0x19, 0x99, 0x98, 0x3, 0x33, 0x36, 0x18, 0x66,
+    0x66, 0xc7, 0xcc, 0xcc, 0xd9, 0xf9, 0x99, 0x9b, 0x33, 0x33, 0x33, 0x66,
+    0x66, 0x66, 0x64, 0xcc, 0xcc, 0xcc, 0xd9, 0x99, 0x99, 0x9b, 0x33, 0x33,
+    0x33, 0x66, 0x66, 0x66, 0x6c, 0xcc, 0xfc, 0xcd, 0xf9, 0x8f, 0x9b, 0x9f,
+    0x31, 0xe3, 0xf1, 0xc6, 0x0, 0x68, 0x0, 0xc0, 0xc, 0x0, 0x18, 0x1,
+    0x80, 0x3, 0x0, 0x30, 0x0, 0xe0, 0x6, 0x0, 0xfc, 0x0, 0xc0, 0x3f,
+    0x0, 0x10, 0x3, 0x80,
+
+    /* U+554F */
+    0x3f, 0xc0, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x19, 0x81, 0xcc,
+    0x6, 0x60, 0x73, 0x81, 0x9f, 0xfc, 0xff, 0xe7, 0x7, 0x38, 0x19, 0x80,
+    0xcc, 0x6, 0x60, 0x73, 0x81, 0x9f, 0xf8, 0x7f, 0xe7, 0xfe, 0x1f, 0xf9,
+    0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x3f, 0xe0, 0x66, 0x1f, 0xfe,
+    0x19, 0x87, 0xff, 0x86, 0x63, 0x80, 0x61, 0x98, 0xe0, 0x18, 0x66, 0x38,
+    0x6, 0x19, 0x8e, 0x1, 0x86, 0x61, 0xff, 0xe1, 0x98, 0x7f, 0xf8, 0x66,
+    0x0, 0x0, 0x19, 0x80, 0x0, 0x3e, 0x60, 0x0, 0x1f, 0x98, 0x0, 0x3,
+    0x80,
+
+    /* U+555F */
+    0x0, 0x0, 0x10, 0x3, 0xff, 0xe3, 0x0, 0x3f, 0xff, 0x30, 0x3, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7f, 0x6, 0x0, 0x1f, 0xfc, 0x7f,
+    0xe1, 0xff, 0xcf, 0xfe, 0x18, 0xc, 0xe1, 0x81, 0x80, 0xde, 0x18, 0x18,
+    0xf, 0xe1, 0x81, 0x81, 0xfe, 0x18, 0x1f, 0xff, 0x31, 0x81, 0xff, 0x83,
+    0x38, 0x18, 0x0, 0x33, 0x81, 0x80, 0x3, 0x30, 0x19, 0xf8, 0x3b, 0x3,
+    0xbf, 0xc1, 0xe0, 0x3f, 0xc, 0x1e, 0x3, 0xf0, 0xc0, 0xe0, 0x37, 0xc,
+    0xe, 0x3, 0x70, 0xc1, 0xf0, 0x77, 0xc, 0x33, 0x87, 0x7f, 0xce, 0x1c,
+    0x63, 0xfd, 0xc0, 0xe6, 0x0, 0x38, 0x7, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5561 */
+    0x0, 0x2, 0x10, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x1c, 0xe0, 0x3f, 0x3,
+    0x9c, 0x7, 0xf0, 0x73, 0x80, 0xcf, 0xfe, 0x7f, 0x99, 0xff, 0xcf, 0xf3,
+    0x38, 0x39, 0xc0, 0x67, 0x7, 0x38, 0xc, 0xe0, 0xe7, 0x1, 0x9c, 0x1c,
+    0xe0, 0x33, 0xbf, 0x9f, 0xc6, 0x7f, 0xf3, 0xfc, 0xce, 0xe, 0x70, 0x19,
+    0xc1, 0x8e, 0x3, 0x38, 0x31, 0xc0, 0x67, 0x6, 0x38, 0xe, 0xe3, 0xc7,
+    0x1, 0xfb, 0xf8, 0xff, 0x1f, 0x7f, 0x1f, 0xe0, 0x0, 0xe3, 0x80, 0x0,
+    0x18, 0x70, 0x0, 0x7, 0xe, 0x0, 0x1, 0xc1, 0xc0, 0x0, 0xf0, 0x38,
+    0x0, 0x3c, 0x7, 0x0, 0x2, 0x0, 0x40, 0x0,
+
+    /* U+5564 */
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x0, 0x0, 0xe, 0x0, 0x3f, 0x1f,
+    0xff, 0x87, 0xf3, 0xff, 0xf8, 0xce, 0xe1, 0x83, 0x18, 0xdc, 0x30, 0x63,
+    0x1b, 0x87, 0x1c, 0x63, 0x7f, 0xff, 0x8c, 0x6f, 0xff, 0xf1, 0x8d, 0xc3,
+    0x6, 0x31, 0xb8, 0xe0, 0xc6, 0x33, 0xff, 0xf8, 0xc6, 0x7f, 0xfe, 0x18,
+    0xc1, 0xe0, 0x3, 0x18, 0x71, 0x80, 0x63, 0x1c, 0x30, 0xc, 0x67, 0x6,
+    0x1, 0xfd, 0xff, 0xfe, 0x3f, 0x7f, 0xff, 0xe1, 0xc7, 0xff, 0xf8, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+5566 */
+    0x0, 0x10, 0x8, 0x0, 0x6, 0x3, 0x0, 0x0, 0xc0, 0x60, 0x3e, 0x18,
+    0xc, 0x7, 0xe3, 0x1, 0x80, 0xcc, 0x73, 0xff, 0x19, 0xff, 0xff, 0xf3,
+    0x37, 0xef, 0xfc, 0x66, 0x30, 0x0, 0xc, 0xc6, 0x10, 0x21, 0x98, 0xc3,
+    0xe, 0x33, 0x18, 0x61, 0xc6, 0x63, 0xc, 0x30, 0xcc, 0x7d, 0x86, 0x19,
+    0x9f, 0xb0, 0xc3, 0x3f, 0xc7, 0x18, 0x66, 0xf0, 0xe7, 0xc, 0xc6, 0xc,
+    0xe1, 0xf8, 0xc1, 0x98, 0x3f, 0x18, 0x33, 0x1, 0x83, 0x6, 0x60, 0x0,
+    0x60, 0xc, 0x0, 0xc, 0x3, 0x0, 0x1, 0x9f, 0xfc, 0x1, 0xf7, 0xff,
+    0xc0, 0x3e, 0x7f, 0xf8, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+557E */
+    0x0, 0x0, 0x8, 0x0, 0x3, 0xe1, 0x80, 0x3, 0xf8, 0x30, 0x3f, 0x3c,
+    0x6, 0x7, 0xe1, 0x80, 0xc0, 0xcc, 0x30, 0x18, 0x19, 0x86, 0x17, 0x33,
+    0x33, 0xf6, 0xe6, 0x66, 0xff, 0xdc, 0xcc, 0xcf, 0xdb, 0x19, 0x98, 0x63,
+    0x66, 0x33, 0x1c, 0x6c, 0xc6, 0x63, 0x8d, 0x98, 0xcc, 0x71, 0x3b, 0x19,
+    0x8f, 0x7, 0x3, 0x33, 0xf0, 0xe0, 0x66, 0x7b, 0x1c, 0xc, 0xdb, 0x67,
+    0xc1, 0xfb, 0x64, 0xd8, 0x3f, 0xec, 0x1b, 0x0, 0x19, 0x87, 0x30, 0x7,
+    0x30, 0xc6, 0x0, 0xc6, 0x38, 0xe0, 0x0, 0xc6, 0xe, 0x0, 0x19, 0xc1,
+    0xc0, 0x3, 0x30, 0x18, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+5589 */
+    0x0, 0x18, 0x0, 0x0, 0x3, 0x3f, 0x80, 0x0, 0xef, 0xf8, 0x3f, 0x1c,
+    0x3, 0x7, 0xe3, 0x0, 0x70, 0xcc, 0x60, 0xe, 0x19, 0x9c, 0x1, 0xc3,
+    0x33, 0xbf, 0xfe, 0x66, 0x73, 0xff, 0x8c, 0xde, 0x30, 0x1, 0x9b, 0xc6,
+    0x0, 0x33, 0xf9, 0xff, 0xc6, 0x7b, 0x3f, 0xf8, 0xce, 0x6c, 0x60, 0x19,
+    0x8d, 0x8c, 0x3, 0x31, 0x81, 0x80, 0x66, 0x33, 0xff, 0x8c, 0xc6, 0xff,
+    0xf9, 0xf8, 0xcf, 0xfe, 0x3f, 0x18, 0x3c, 0x3, 0xc3, 0x7, 0x80, 0x0,
+    0x61, 0xd8, 0x0, 0xc, 0x71, 0x80, 0x1, 0x9e, 0x3c, 0x0, 0x37, 0x83,
+    0xc0, 0x6, 0xe0, 0x38, 0x0, 0xd0, 0x0, 0x0,
+
+    /* U+559C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff,
+    0xf0, 0x1, 0xc0, 0x38, 0x0, 0xc, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x0, 0xe0, 0x0, 0x70, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38,
+    0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0,
+
+    /* U+559D */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0xff, 0xfc, 0x3f, 0x9c,
+    0x3, 0x87, 0xf3, 0x0, 0x30, 0xc6, 0x7f, 0xfe, 0x18, 0xcf, 0xff, 0xc3,
+    0x19, 0x80, 0x18, 0x63, 0x30, 0x3, 0xc, 0x67, 0xff, 0xe1, 0x8c, 0xff,
+    0xfc, 0x31, 0x87, 0x0, 0x6, 0x31, 0xc0, 0x0, 0xc6, 0x3f, 0xff, 0x18,
+    0xcf, 0xff, 0xf3, 0x1b, 0x80, 0xe, 0x63, 0xe0, 0xc0, 0xcc, 0x7c, 0x38,
+    0x19, 0xfc, 0xc7, 0x83, 0x3f, 0x99, 0xf8, 0x61, 0xc3, 0x73, 0x9c, 0x0,
+    0x6c, 0x13, 0x80, 0xe, 0x0, 0x70, 0x1, 0xff, 0x8c, 0x0, 0xf, 0xf7,
+    0x80, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x1c, 0x0,
+
+    /* U+55AE */
+    0x1f, 0xf0, 0xff, 0x83, 0xff, 0x9f, 0xfc, 0x38, 0x39, 0x81, 0xc3, 0x3,
+    0x98, 0xc, 0x3f, 0xf9, 0xff, 0xc1, 0xff, 0x1f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c,
+    0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0xe0,
+    0x38, 0x18, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0xf0, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+55B1 */
+    0x0, 0x7, 0xff, 0x0, 0x7, 0xff, 0xf9, 0xfc, 0xff, 0xfe, 0x3f, 0xb8,
+    0x0, 0x6, 0x36, 0x3f, 0xe0, 0xc6, 0xc7, 0xfe, 0x18, 0xdd, 0xcc, 0xc3,
+    0x1b, 0xb1, 0x98, 0x63, 0x77, 0x33, 0xc, 0x6e, 0xff, 0xe1, 0x8d, 0xdc,
+    0xcc, 0x31, 0xb3, 0x19, 0x86, 0x36, 0x63, 0x30, 0xc6, 0xcf, 0xfe, 0x18,
+    0xd8, 0xff, 0xc3, 0x1b, 0x1, 0x80, 0x63, 0x60, 0x30, 0xf, 0xec, 0x6,
+    0x1, 0xfd, 0x9f, 0xfe, 0xe, 0x77, 0xff, 0xc0, 0xe, 0x3, 0x0, 0x1,
+    0x80, 0x60, 0x0, 0x70, 0xc, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x9f, 0xff,
+    0xc0,
+
+    /* U+55D1 */
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x3f, 0x3f,
+    0xff, 0x87, 0xe3, 0xff, 0xf1, 0xce, 0x3, 0x80, 0x31, 0xc0, 0x70, 0x6,
+    0x38, 0xe, 0x0, 0xc7, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xf3, 0x1c, 0x1c,
+    0x20, 0x63, 0x83, 0xe, 0xc, 0x70, 0xe0, 0xe1, 0x8e, 0xff, 0xfe, 0x31,
+    0xff, 0xff, 0xe6, 0x3b, 0x80, 0xc, 0xc7, 0x0, 0x0, 0x1c, 0xe7, 0xff,
+    0xe3, 0xf9, 0xff, 0xfc, 0x3f, 0x39, 0x99, 0x83, 0xc6, 0x33, 0x30, 0x0,
+    0xc6, 0x66, 0x0, 0x18, 0xcc, 0xc0, 0x3, 0x39, 0x9c, 0x1, 0xff, 0xff,
+    0xc0, 0x3f, 0xff, 0xf8,
+
+    /* U+5609 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0x1, 0xe0, 0x0, 0x78, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x70, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x18, 0x0, 0x0, 0x3, 0x80,
+    0xff, 0x83, 0xff, 0xcf, 0xfc, 0x1f, 0xfd, 0xc1, 0xc0, 0x70, 0xdc, 0xc,
+    0xe, 0xd, 0xc0, 0xc3, 0xc7, 0xdf, 0xfc, 0x78, 0xf8, 0xff, 0x86, 0x6,
+    0x0, 0x0,
+
+    /* U+5668 */
+    0xf, 0xe0, 0x7f, 0x1, 0xff, 0xf, 0xf8, 0x18, 0x39, 0xc1, 0x83, 0x83,
+    0x98, 0x18, 0x38, 0x39, 0x81, 0x83, 0x83, 0x9c, 0x18, 0x1f, 0xf1, 0xff,
+    0x81, 0xff, 0x4f, 0xf8, 0x0, 0xe, 0x8, 0x0, 0x0, 0xc0, 0xc0, 0x3f,
+    0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x1e, 0x7,
+    0x80, 0x7, 0xc0, 0x3f, 0x3, 0xf0, 0x0, 0xfc, 0x7e, 0x0, 0x7, 0xe3,
+    0xff, 0xf, 0xf8, 0x1f, 0xf9, 0xff, 0x81, 0x81, 0x9c, 0x18, 0x18, 0x19,
+    0x81, 0x81, 0x81, 0x98, 0x18, 0x18, 0x39, 0xc1, 0x81, 0xff, 0x9f, 0xf8,
+    0xf, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+56C9 */
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x1, 0xff, 0xfe, 0x3f, 0x73,
+    0x1c, 0xef, 0xec, 0x63, 0x9d, 0xcd, 0xcc, 0x73, 0xb1, 0x9f, 0xff, 0xe6,
+    0x33, 0xff, 0xfc, 0xc6, 0x0, 0x21, 0x18, 0xc7, 0xe, 0x63, 0x18, 0xc9,
+    0x9c, 0x63, 0x73, 0xff, 0xcc, 0x6e, 0x6f, 0xfd, 0x8c, 0xfb, 0xcc, 0x31,
+    0x8e, 0x59, 0x86, 0x31, 0x93, 0x30, 0xc6, 0x33, 0x7f, 0xdc, 0xdf, 0xef,
+    0xf3, 0xfb, 0xe5, 0x98, 0x3f, 0xd, 0x33, 0x3, 0xcd, 0xa7, 0xf8, 0x1,
+    0xb6, 0xff, 0x0, 0x36, 0xd9, 0x80, 0xc, 0xdb, 0x30, 0x1, 0x99, 0x7f,
+    0xc0, 0x3, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+56DB */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf9, 0xc3, 0x8c,
+    0xe, 0x60, 0xe3, 0x1, 0x98, 0x38, 0xc0, 0x66, 0xe, 0x30, 0x19, 0x83,
+    0xc, 0x6, 0x60, 0xc3, 0x1, 0x98, 0x30, 0xc0, 0x66, 0xc, 0x30, 0x19,
+    0x83, 0xc, 0x26, 0x61, 0xc3, 0x1d, 0x98, 0xe0, 0xe6, 0x66, 0x38, 0x3f,
+    0x99, 0x9c, 0xf, 0xe6, 0x66, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0x19, 0x80, 0x0, 0xe, 0x70, 0x0, 0x3, 0x9f, 0xff, 0xff, 0xe3,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+
+    /* U+56DE */
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf9, 0xc0, 0x0,
+    0xe, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0, 0x0, 0x19, 0x87,
+    0xff, 0x86, 0x61, 0xff, 0xe1, 0x98, 0x60, 0x18, 0x66, 0x18, 0x6, 0x19,
+    0x86, 0x1, 0x86, 0x61, 0x80, 0x61, 0x98, 0x60, 0x18, 0x66, 0x18, 0x6,
+    0x19, 0x86, 0x1, 0x86, 0x61, 0xc0, 0xe1, 0x98, 0x7f, 0xf8, 0x66, 0xf,
+    0xfc, 0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x67,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+56E0 */
+    0xf, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf9, 0x80, 0x0,
+    0x6, 0x60, 0xc, 0x1, 0x98, 0x7, 0x0, 0x66, 0x1, 0xc0, 0x19, 0x80,
+    0x70, 0x6, 0x63, 0xff, 0xf1, 0x9b, 0xff, 0xfe, 0x66, 0x7f, 0xff, 0x99,
+    0x80, 0x78, 0x6, 0x60, 0x3e, 0x1, 0x98, 0xf, 0xc0, 0x66, 0x3, 0x30,
+    0x19, 0x81, 0xce, 0x6, 0x60, 0xe1, 0xc1, 0x98, 0x70, 0x38, 0x66, 0x3c,
+    0x7, 0x19, 0x9e, 0x0, 0xe6, 0x6f, 0x0, 0x1d, 0x99, 0x0, 0x0, 0x67,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+56FA */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x39, 0x80, 0x0,
+    0x6, 0x60, 0xc, 0x1, 0x98, 0x3, 0x0, 0x66, 0x0, 0xc0, 0x19, 0x9f,
+    0xff, 0xe6, 0x6f, 0xff, 0xfd, 0x98, 0x3, 0x0, 0x66, 0x0, 0xc0, 0x19,
+    0x80, 0x30, 0x6, 0x60, 0xff, 0xc1, 0x98, 0xff, 0xf8, 0x66, 0x38, 0x7,
+    0x19, 0x8c, 0x1, 0xc6, 0x63, 0x0, 0x31, 0x98, 0xc0, 0xc, 0x66, 0x38,
+    0x7, 0x19, 0x8f, 0xff, 0x86, 0x61, 0xff, 0xe1, 0x98, 0x0, 0x0, 0x67,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+570B */
+    0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x39, 0x80, 0x8,
+    0xc6, 0x60, 0x7, 0x31, 0x98, 0x1, 0xc0, 0x66, 0xff, 0xff, 0xd9, 0xbf,
+    0xff, 0xf6, 0x60, 0x3, 0x1, 0x98, 0x0, 0xc0, 0x66, 0x7f, 0x31, 0x99,
+    0x98, 0xcc, 0x66, 0x66, 0x33, 0x31, 0x99, 0x8c, 0xcc, 0x66, 0x7f, 0x1e,
+    0x19, 0x9f, 0xc7, 0x86, 0x60, 0x1, 0xc1, 0x98, 0xe, 0x71, 0x66, 0x7f,
+    0xbe, 0xd9, 0xbf, 0x1f, 0xf6, 0x68, 0x1e, 0x7d, 0x98, 0x7, 0xe, 0x66,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+5712 */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x39, 0x80, 0x30,
+    0x6, 0x60, 0xc, 0x1, 0x98, 0xff, 0xfc, 0x66, 0x1, 0xe0, 0x19, 0x80,
+    0x30, 0x6, 0x67, 0xff, 0xfd, 0x99, 0xff, 0xfe, 0x66, 0x0, 0x0, 0x19,
+    0x87, 0xff, 0x86, 0x63, 0xff, 0xf1, 0x98, 0xc0, 0xc, 0x66, 0x3f, 0xff,
+    0x19, 0x87, 0xff, 0x86, 0x60, 0x70, 0x11, 0x98, 0xf9, 0x8e, 0x66, 0xf6,
+    0x3e, 0x19, 0xb1, 0x87, 0x86, 0x60, 0x7e, 0x79, 0x98, 0xff, 0x6, 0x66,
+    0x38, 0x0, 0x19, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x83, 0xff, 0xff,
+    0x0,
+
+    /* U+5713 */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x39, 0x80, 0x0,
+    0x6, 0x61, 0xff, 0xf1, 0x98, 0xe0, 0x1c, 0x66, 0x38, 0x3, 0x19, 0x87,
+    0xff, 0xc6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x3f, 0xff, 0x19,
+    0x8c, 0x0, 0xe6, 0x67, 0xff, 0xf9, 0x99, 0xff, 0xfe, 0x66, 0x70, 0x1,
+    0x99, 0x9f, 0xff, 0xe6, 0x67, 0x0, 0x39, 0x98, 0xc0, 0xe, 0x66, 0x3f,
+    0xff, 0x19, 0x80, 0x0, 0x6, 0x61, 0xe1, 0xf1, 0x99, 0xf0, 0x3e, 0x66,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+5716 */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x39, 0x80, 0x0,
+    0x6, 0x63, 0xff, 0xf1, 0x98, 0xc0, 0xe, 0x66, 0x30, 0x3, 0x99, 0x8f,
+    0xff, 0xc6, 0x60, 0xc, 0x1, 0x98, 0x3, 0x80, 0x66, 0xff, 0xff, 0xd9,
+    0x80, 0x0, 0x6, 0x61, 0xff, 0xe1, 0x99, 0xff, 0xfe, 0x66, 0x60, 0x1,
+    0x99, 0x99, 0xfe, 0x66, 0x66, 0x7f, 0xd9, 0x99, 0x98, 0x36, 0x66, 0x67,
+    0xf9, 0x99, 0x98, 0x0, 0x66, 0x67, 0xff, 0xf9, 0x98, 0xff, 0xfc, 0x66,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+5718 */
+    0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x0, 0x80, 0x39, 0x80, 0x30,
+    0x6, 0x6f, 0xff, 0xfd, 0x9b, 0xff, 0xff, 0x66, 0x0, 0xc0, 0x19, 0x9f,
+    0xff, 0xe6, 0x66, 0xc, 0x19, 0x99, 0xff, 0xfe, 0x66, 0x7f, 0xff, 0x99,
+    0x98, 0x30, 0x66, 0x67, 0xff, 0xf9, 0x98, 0x7, 0xc, 0x66, 0x0, 0xc3,
+    0x99, 0xbf, 0xff, 0xf6, 0x60, 0x0, 0xc5, 0x99, 0xff, 0xfe, 0x66, 0xff,
+    0xff, 0xd9, 0x83, 0x3, 0x6, 0x60, 0xe0, 0xc1, 0x98, 0x18, 0xf0, 0x66,
+    0x0, 0x30, 0x19, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+571F */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f,
+    0xff, 0xff, 0xc0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+5728 */
+    0x0, 0x10, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x18, 0x7, 0x0, 0x3,
+    0x80, 0x70, 0x0, 0x30, 0x7, 0x0, 0x7, 0x0, 0x70, 0x0, 0xf0, 0x7,
+    0x0, 0x1f, 0x1f, 0xff, 0xc3, 0xf1, 0xff, 0xfc, 0x3f, 0x0, 0x70, 0x7,
+    0x70, 0x7, 0x0, 0x67, 0x0, 0x70, 0x0, 0x70, 0x7, 0x0, 0x7, 0x0,
+    0x70, 0x0, 0x70, 0x7, 0x0, 0x7, 0x0, 0x70, 0x0, 0x70, 0x7, 0x0,
+    0x7, 0x7f, 0xff, 0xe0, 0x73, 0xff, 0xfe, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+5730 */
+    0x4, 0x0, 0x20, 0x0, 0xe0, 0x7, 0x0, 0xe, 0x0, 0x70, 0x0, 0xe0,
+    0xc7, 0x0, 0xe, 0x1c, 0x70, 0x0, 0xe1, 0xc7, 0x0, 0xe, 0x1c, 0x77,
+    0xc7, 0xf9, 0xc7, 0xfc, 0x7f, 0xdc, 0xfd, 0xc0, 0xe1, 0xff, 0xc, 0xe,
+    0x1f, 0xf0, 0xc0, 0xe7, 0xe7, 0xc, 0xe, 0xfc, 0x70, 0xc0, 0xe1, 0xc7,
+    0xc, 0xe, 0x1c, 0x70, 0xc0, 0xe1, 0xc7, 0xc, 0xe, 0x1c, 0x73, 0xc0,
+    0xe1, 0xc7, 0x78, 0xe, 0x1c, 0x77, 0x0, 0xfd, 0xc7, 0x0, 0x3f, 0xdc,
+    0x60, 0x67, 0xe1, 0xc0, 0x6, 0x70, 0x1c, 0x0, 0xe0, 0x0, 0xe0, 0x1e,
+    0x0, 0xf, 0xff, 0xc0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+573E */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0xff, 0x0, 0x6, 0x3f, 0xfe, 0x0, 0x63,
+    0xff, 0xe0, 0x6, 0x6, 0xe, 0x0, 0x60, 0x60, 0xe0, 0x6, 0x6, 0xc,
+    0x7, 0xfc, 0x60, 0xc0, 0x7f, 0xc7, 0xc, 0x0, 0xe0, 0x71, 0xc0, 0x6,
+    0x7, 0x1f, 0xc0, 0x60, 0x78, 0xfc, 0x6, 0x7, 0x81, 0xc0, 0x60, 0xf8,
+    0x1c, 0x6, 0xc, 0xc1, 0x80, 0x60, 0xcc, 0x18, 0x6, 0xc, 0xe3, 0x80,
+    0x7d, 0xc6, 0x30, 0xf, 0xd8, 0x77, 0x7, 0xf3, 0x83, 0xe0, 0x7c, 0x30,
+    0x1c, 0x6, 0x7, 0x3, 0xe0, 0x0, 0xe0, 0x7f, 0x0, 0x1c, 0x1f, 0x7c,
+    0x1, 0xc7, 0xc1, 0xe0, 0x10, 0x78, 0xe, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5740 */
+    0x4, 0x0, 0x10, 0x0, 0x60, 0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x60,
+    0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x60, 0x1, 0x80, 0x6, 0x0, 0x18,
+    0x7, 0xfc, 0xe1, 0x80, 0x7f, 0xce, 0x18, 0x3, 0xf8, 0xe1, 0x80, 0x6,
+    0xe, 0x1f, 0xe0, 0x60, 0xe1, 0xfc, 0x6, 0xe, 0x18, 0x0, 0x60, 0xe1,
+    0x80, 0x6, 0xe, 0x18, 0x0, 0x60, 0xe1, 0x80, 0x6, 0xe, 0x18, 0x0,
+    0x60, 0xe1, 0x80, 0x6, 0x4e, 0x18, 0x0, 0xfe, 0xe1, 0x80, 0x7f, 0xce,
+    0x18, 0x7, 0xe0, 0xe1, 0x80, 0x70, 0xe, 0x18, 0x0, 0x7, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xfc,
+
+    /* U+5747 */
+    0x4, 0x1, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x38, 0x1c, 0x0, 0x7, 0x3,
+    0x80, 0x0, 0xe0, 0x7f, 0xf0, 0x1c, 0x1f, 0xff, 0x83, 0x83, 0xff, 0xfb,
+    0xfe, 0xe0, 0x7, 0x7f, 0xdc, 0x0, 0xe1, 0xc7, 0x0, 0x1c, 0x38, 0xc0,
+    0x3, 0x87, 0x1b, 0xfc, 0x70, 0xe0, 0x7f, 0xce, 0x1c, 0x7, 0xe1, 0xc3,
+    0x80, 0x0, 0x38, 0x70, 0x0, 0x7, 0xe, 0x0, 0x0, 0xe1, 0xc0, 0x7,
+    0x98, 0x3b, 0x1f, 0xf3, 0xf, 0xe7, 0xf0, 0x67, 0xf8, 0xe0, 0xc, 0xf0,
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x70, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3f,
+    0x80, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+574A */
+    0x4, 0x0, 0x40, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x0, 0xe0, 0x0, 0x63, 0xff, 0xfe, 0x6, 0x3f, 0xff,
+    0xe7, 0xfc, 0x18, 0x0, 0x7f, 0xc1, 0x80, 0x0, 0xe0, 0x18, 0x0, 0x6,
+    0x1, 0x80, 0x0, 0x60, 0x1f, 0xf0, 0x6, 0x1, 0xff, 0x80, 0x60, 0x3f,
+    0xf8, 0x6, 0x3, 0x81, 0x80, 0x60, 0x38, 0x18, 0x6, 0x3, 0x1, 0x80,
+    0x60, 0x30, 0x18, 0x7, 0xe7, 0x1, 0x81, 0xfe, 0x70, 0x18, 0x7f, 0xe,
+    0x3, 0x87, 0x81, 0xe0, 0x38, 0x0, 0x3c, 0x3, 0x80, 0x7, 0x80, 0x70,
+    0x1, 0xf0, 0x7f, 0x0, 0x1c, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5751 */
+    0x4, 0x0, 0x40, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0xe0, 0x0, 0x60,
+    0xe, 0x0, 0x6, 0x3f, 0xff, 0xc0, 0x63, 0xff, 0xfe, 0x6, 0x3f, 0xff,
+    0xc7, 0xfc, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x6,
+    0x7, 0xfc, 0x0, 0x60, 0x7f, 0xc0, 0x6, 0x6, 0x1e, 0x0, 0x60, 0x60,
+    0xe0, 0x6, 0x6, 0xe, 0x0, 0x60, 0x60, 0xe0, 0x6, 0xe, 0xe, 0x0,
+    0x60, 0xe0, 0xe0, 0xf, 0xce, 0xe, 0x3, 0xfc, 0xc0, 0xe0, 0x7e, 0xc,
+    0xe, 0x67, 0x1, 0xc0, 0xe6, 0x0, 0x38, 0xe, 0x60, 0x7, 0x80, 0xe6,
+    0x0, 0xf0, 0xf, 0xe0, 0x1c, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+576A */
+    0x4, 0x0, 0x0, 0x0, 0xe1, 0xff, 0xfc, 0xe, 0x3f, 0xff, 0xe0, 0xe1,
+    0xff, 0xfc, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x6, 0x66,
+    0x7, 0xf8, 0xe6, 0x70, 0x7f, 0xce, 0x63, 0x80, 0xe1, 0xc6, 0x1c, 0xe,
+    0x38, 0x61, 0xc0, 0xe3, 0x86, 0xe, 0xe, 0x20, 0x60, 0x0, 0xe0, 0x6,
+    0x0, 0xe, 0x0, 0xf0, 0x0, 0xe7, 0xff, 0xfe, 0xe, 0x3f, 0xff, 0xe0,
+    0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xfc, 0x6, 0x0, 0x3f, 0xc0,
+    0x60, 0x7, 0xf0, 0x6, 0x0, 0x70, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+5783 */
+    0x0, 0x0, 0x20, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x7, 0x0, 0x6, 0x1f, 0xff,
+    0xe0, 0xe1, 0xff, 0xfc, 0x7f, 0xc0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x6,
+    0x4, 0x3, 0x80, 0x60, 0xe0, 0x38, 0x6, 0xe, 0x3, 0x0, 0x60, 0x60,
+    0x30, 0x6, 0x6, 0x7, 0x0, 0x60, 0x70, 0x70, 0x6, 0x7, 0x7, 0x0,
+    0x6c, 0x30, 0x60, 0xf, 0xc3, 0x6, 0x7, 0xf8, 0x30, 0xe0, 0x7c, 0x3,
+    0xe, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x3, 0xff, 0xfc,
+    0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfc,
+
+    /* U+578B */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0xc, 0x3f, 0xff, 0x31, 0xc1, 0xff,
+    0xe3, 0x1c, 0x6, 0x18, 0x31, 0xc0, 0x61, 0x83, 0x1c, 0x6, 0x18, 0x31,
+    0xc3, 0xff, 0xf3, 0x1c, 0x7f, 0xff, 0xb1, 0xc3, 0xff, 0xf3, 0x1c, 0x6,
+    0x18, 0x31, 0xc0, 0xe1, 0x83, 0x1c, 0xc, 0x18, 0x21, 0xc1, 0xc1, 0x80,
+    0x1c, 0x38, 0x18, 0x7, 0xc7, 0x1, 0x80, 0xf8, 0x60, 0x6, 0x7, 0x0,
+    0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0xe,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+57CE */
+    0x4, 0x0, 0x10, 0x0, 0xe0, 0x3, 0x30, 0xe, 0x0, 0x33, 0x80, 0xe0,
+    0x3, 0x18, 0xe, 0x0, 0x30, 0x0, 0xe1, 0xff, 0xfe, 0xe, 0x3f, 0xff,
+    0xe7, 0xfb, 0x83, 0x80, 0x7f, 0xb0, 0x38, 0x0, 0xe3, 0x3, 0x80, 0xe,
+    0x30, 0x38, 0x40, 0xe3, 0xf3, 0x8c, 0xe, 0x3f, 0x98, 0xc0, 0xe3, 0x39,
+    0x9c, 0xe, 0x31, 0x99, 0x80, 0xe3, 0x19, 0xb8, 0xe, 0x71, 0x9b, 0x0,
+    0xe7, 0x19, 0xf0, 0xf, 0xf1, 0x9e, 0x3, 0xfe, 0x38, 0xe2, 0x7e, 0x67,
+    0x1c, 0x67, 0xe, 0xf3, 0xe6, 0x1, 0xcc, 0x7e, 0x60, 0x1c, 0xe, 0x3e,
+    0x3, 0x81, 0xc3, 0xe0, 0x30, 0x38, 0x1e, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+57D4 */
+    0x4, 0x0, 0x62, 0x0, 0xe0, 0x6, 0x30, 0xe, 0x0, 0x61, 0x80, 0xe0,
+    0x6, 0x8, 0xe, 0x3f, 0xff, 0xe0, 0xe3, 0xff, 0xfe, 0xe, 0x0, 0x60,
+    0x7, 0xf8, 0x6, 0x0, 0x7f, 0xc0, 0x70, 0x3, 0xf9, 0xff, 0xfc, 0xe,
+    0x1f, 0xff, 0xc0, 0xe1, 0x86, 0xc, 0xe, 0x18, 0x60, 0xc0, 0xe1, 0xff,
+    0xfc, 0xe, 0x1f, 0xff, 0xc0, 0xe1, 0x87, 0xc, 0xe, 0x18, 0x60, 0xc0,
+    0xe1, 0x86, 0xc, 0xf, 0x9f, 0xff, 0xc0, 0xf9, 0xff, 0xfc, 0x7f, 0x98,
+    0x60, 0xc7, 0xc1, 0x86, 0xc, 0x0, 0x18, 0x60, 0xc0, 0x1, 0x86, 0x1c,
+    0x0, 0x18, 0x67, 0xc0, 0x1, 0x86, 0x78, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+57DF */
+    0xc, 0x0, 0x10, 0x0, 0xc0, 0x3, 0xb0, 0xc, 0x0, 0x3b, 0x80, 0xc0,
+    0x3, 0x9c, 0xc, 0x0, 0x38, 0x0, 0xc7, 0xff, 0xfe, 0xc, 0x7f, 0xff,
+    0xe7, 0xf8, 0x3, 0x80, 0x7f, 0x80, 0x38, 0x0, 0xc1, 0xe3, 0x80, 0xc,
+    0x3f, 0x98, 0xc0, 0xc7, 0x39, 0x8c, 0xc, 0x61, 0x99, 0xc0, 0xc6, 0x19,
+    0x98, 0xc, 0x61, 0x9b, 0x80, 0xc7, 0x19, 0xb0, 0xc, 0x7f, 0x9f, 0x0,
+    0xc3, 0xf1, 0xe0, 0xf, 0x80, 0x1e, 0x3, 0xf8, 0x1d, 0xc2, 0x7e, 0xf,
+    0xdc, 0x67, 0x7, 0xf7, 0xe6, 0x1, 0xf8, 0xf6, 0x60, 0x1e, 0x1e, 0x7e,
+    0x0, 0x3, 0xc3, 0xe0, 0x0, 0x78, 0x1c, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+57E0 */
+    0x4, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0xe, 0x7, 0xfe, 0x0, 0xe1,
+    0xff, 0xf8, 0xe, 0x1c, 0x3, 0x80, 0xe1, 0x80, 0x18, 0xe, 0x18, 0x1,
+    0x87, 0xf9, 0xff, 0xf8, 0x7f, 0xdf, 0xff, 0x83, 0xf9, 0x80, 0x0, 0xe,
+    0x18, 0x0, 0x0, 0xe1, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0xc0, 0xe1, 0x80,
+    0x1c, 0xe, 0x18, 0x0, 0xc0, 0xe1, 0x80, 0x1c, 0xe, 0x1f, 0xff, 0xc0,
+    0xfc, 0xff, 0xf8, 0x1f, 0xc0, 0x60, 0x7, 0xf0, 0x6, 0x0, 0x78, 0xff,
+    0xff, 0xe0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x40, 0x0,
+
+    /* U+57E4 */
+    0x4, 0x0, 0x40, 0x0, 0xc0, 0xe, 0x0, 0xe, 0x0, 0xc0, 0x0, 0xe0,
+    0xff, 0xf8, 0xe, 0x1f, 0xff, 0xc0, 0xe1, 0x86, 0xc, 0xe, 0x18, 0x60,
+    0xc7, 0xf9, 0x87, 0xc, 0x7f, 0xdf, 0xff, 0xc0, 0xe1, 0xc7, 0x1c, 0xe,
+    0x18, 0x60, 0xc0, 0xe1, 0x86, 0xc, 0xe, 0x1f, 0xff, 0xc0, 0xe0, 0xff,
+    0xf8, 0xe, 0x1, 0xc0, 0x0, 0xe0, 0x39, 0x80, 0xe, 0xf, 0x18, 0x0,
+    0xfc, 0xc1, 0x80, 0xf, 0xdf, 0xff, 0xc7, 0xf3, 0xff, 0xfe, 0x7c, 0x1f,
+    0xff, 0xe6, 0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80,
+    0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+57F7 */
+    0x1, 0x0, 0x20, 0x0, 0x30, 0x7, 0x0, 0x3, 0x0, 0x70, 0x3, 0xff,
+    0x87, 0x0, 0x3f, 0xf8, 0x70, 0x0, 0x38, 0x7, 0x0, 0x3, 0x3, 0xfe,
+    0x0, 0x30, 0x3f, 0xf0, 0x7f, 0xfc, 0x77, 0x7, 0xff, 0xc7, 0x30, 0x18,
+    0x70, 0x63, 0x1, 0x87, 0x6, 0x30, 0x18, 0x63, 0x63, 0x0, 0xc6, 0x3e,
+    0x30, 0x7f, 0xfd, 0xe3, 0x7, 0xff, 0xce, 0x30, 0x3, 0x80, 0x63, 0x0,
+    0x30, 0xf, 0x30, 0x3, 0x0, 0xfb, 0x3, 0xff, 0x9d, 0xb0, 0x3f, 0xf9,
+    0x8f, 0x20, 0x38, 0x38, 0x3a, 0x3, 0x7, 0x1, 0xa0, 0x30, 0x70, 0x1e,
+    0x3, 0xe, 0x1, 0xe0, 0x31, 0xc0, 0x1e, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+57FA */
+    0x1, 0x0, 0x8, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80, 0x1c, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x38, 0x1, 0xc0, 0x3, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0xc0, 0x3, 0x80, 0x1c, 0x0, 0x38, 0x1, 0xc0, 0x3,
+    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x3, 0x80, 0x1c, 0x3, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x38, 0x1, 0xc0, 0x3, 0x6, 0xc, 0x0,
+    0x60, 0x60, 0x60, 0xc, 0x6, 0x3, 0x83, 0xdf, 0xff, 0xbc, 0x79, 0xff,
+    0xf9, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8,
+
+    /* U+5802 */
+    0x0, 0x6, 0x0, 0x0, 0x60, 0x60, 0xe0, 0x7, 0x6, 0xe, 0x0, 0x30,
+    0x61, 0xc0, 0x1, 0xe, 0x8, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
+    0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe7, 0x3f, 0xff, 0xce, 0x77,
+    0xff, 0xfe, 0xe2, 0x70, 0x0, 0xe4, 0x6, 0x0, 0x6, 0x0, 0x70, 0x0,
+    0xe0, 0x7, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0xe, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+5821 */
+    0x1, 0x0, 0x0, 0x0, 0x39, 0xff, 0xf0, 0x3, 0x3f, 0xff, 0x80, 0x73,
+    0x80, 0x38, 0x6, 0x30, 0x1, 0x80, 0xe3, 0x80, 0x38, 0x1e, 0x1f, 0xff,
+    0x83, 0xe1, 0xff, 0xf0, 0x3e, 0x0, 0xe0, 0x7, 0xe7, 0xff, 0xfc, 0x6e,
+    0xff, 0xff, 0xe0, 0xe0, 0x3f, 0x80, 0xe, 0x7, 0xf8, 0x0, 0xe1, 0xee,
+    0xe0, 0xe, 0x3c, 0xe7, 0xc0, 0xef, 0xe, 0x1e, 0xe, 0xe6, 0xe0, 0xe0,
+    0x40, 0x64, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x80, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+5831 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0xf, 0xf0, 0x3, 0x1, 0xff, 0xc3, 0xff,
+    0x1f, 0xfc, 0x3f, 0xfb, 0x80, 0xc0, 0x30, 0x38, 0xc, 0x3, 0x3, 0x80,
+    0xc0, 0x30, 0x38, 0x7c, 0x7f, 0xff, 0x9f, 0xc7, 0xff, 0xf8, 0xf0, 0x18,
+    0x63, 0x80, 0x1, 0x86, 0x3f, 0xfc, 0x18, 0x63, 0xff, 0xe1, 0x86, 0x38,
+    0xe, 0x7f, 0xfb, 0xa0, 0xc7, 0xff, 0xbb, 0xc, 0x3, 0x3, 0xb1, 0xc0,
+    0x30, 0x3b, 0x98, 0x3, 0x3, 0x9b, 0x83, 0xff, 0xb9, 0xf0, 0x7f, 0xfb,
+    0x8f, 0x0, 0x30, 0x38, 0xe0, 0x3, 0x3, 0x9f, 0x80, 0x30, 0x3b, 0xbc,
+    0x3, 0x3, 0xf1, 0xe0, 0x30, 0x3e, 0xe, 0x3, 0x1, 0x0, 0x0,
+
+    /* U+5834 */
+    0x4, 0x0, 0x0, 0x0, 0xe0, 0x7f, 0xf0, 0xe, 0xf, 0xff, 0x80, 0xe0,
+    0xc0, 0x18, 0xe, 0x1c, 0x1, 0x80, 0xe1, 0xff, 0xf8, 0xe, 0x1f, 0xff,
+    0x87, 0xfd, 0xc0, 0x18, 0x7f, 0xce, 0x3, 0x80, 0xe0, 0xff, 0xf8, 0xe,
+    0x3, 0xfe, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x7f, 0xff, 0xe0, 0xe7, 0xff,
+    0xfe, 0xe, 0xe, 0x0, 0x0, 0xe0, 0xff, 0xf0, 0xf, 0xdf, 0xff, 0xc0,
+    0xfb, 0xdd, 0xfc, 0x1f, 0x71, 0x9c, 0xc7, 0xce, 0x31, 0x8c, 0x70, 0xcf,
+    0x38, 0xc0, 0x1, 0xe7, 0xc, 0x0, 0x78, 0xe0, 0xc0, 0x6, 0x1e, 0x1c,
+    0x0, 0xf, 0x87, 0xc0, 0x1, 0xf0, 0xf8, 0x0, 0x18, 0xf, 0x0,
+
+    /* U+584A */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0xc, 0x0, 0xe, 0x0, 0xc0, 0x0, 0xe0,
+    0x1c, 0x0, 0xe, 0xf, 0xff, 0x0, 0xe1, 0xff, 0xf8, 0xe, 0x38, 0x61,
+    0xc0, 0xe3, 0x6, 0xc, 0x7f, 0xb0, 0x60, 0xc7, 0xfb, 0xff, 0xfc, 0xe,
+    0x3f, 0xff, 0xc0, 0xe3, 0x6, 0xc, 0xe, 0x30, 0x60, 0xc0, 0xe3, 0x6,
+    0x1c, 0xe, 0x3f, 0xff, 0xc0, 0xe1, 0xff, 0xf8, 0xe, 0x6, 0x70, 0x0,
+    0xe0, 0x67, 0x20, 0xe, 0x6, 0x76, 0x40, 0xfc, 0x67, 0x64, 0x1f, 0xce,
+    0x7f, 0xe7, 0xf0, 0xc7, 0xf2, 0x78, 0x1c, 0x70, 0x0, 0x3, 0x87, 0x6,
+    0x0, 0x78, 0x70, 0x60, 0x1f, 0x3, 0xfe, 0x3, 0xc0, 0x3f, 0xc0, 0x30,
+    0x0, 0x0,
+
+    /* U+5854 */
+    0x4, 0x4, 0x4, 0x0, 0xe0, 0x60, 0xc0, 0xe, 0x6, 0xc, 0x0, 0xe7,
+    0xff, 0xfe, 0xe, 0xff, 0xff, 0xe0, 0xe0, 0x60, 0xe0, 0xe, 0x6, 0xc,
+    0x7, 0xf8, 0x6e, 0xc0, 0x7f, 0xc1, 0xe0, 0x0, 0xe0, 0x3f, 0x0, 0xe,
+    0x7, 0x38, 0x0, 0xe0, 0xe1, 0xe0, 0xe, 0x1c, 0xf, 0x80, 0xe7, 0x80,
+    0x3c, 0xe, 0xff, 0xff, 0xe0, 0xee, 0x7f, 0xc6, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x1f, 0xff, 0x0, 0xfd, 0xff, 0xf8, 0x3f, 0xd8,
+    0x3, 0x87, 0xf1, 0x80, 0x38, 0x70, 0x18, 0x3, 0x80, 0x1, 0x80, 0x38,
+    0x0, 0x1f, 0xff, 0x80, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+586B */
+    0x4, 0xc, 0x1, 0x80, 0xe0, 0xc3, 0xf8, 0xe, 0xf, 0xff, 0x0, 0xe0,
+    0xfc, 0x4, 0xe, 0xc, 0x0, 0xe0, 0xe0, 0xff, 0xfc, 0xe, 0xf, 0xff,
+    0xc7, 0xf8, 0x0, 0x0, 0x7f, 0xc1, 0xff, 0x3, 0xf8, 0x3f, 0xf8, 0xe,
+    0x33, 0x1, 0xc0, 0xe3, 0x3f, 0xfc, 0xe, 0x33, 0xff, 0xc0, 0xe3, 0x30,
+    0x1c, 0xe, 0x33, 0xff, 0xc0, 0xe3, 0x3f, 0xfc, 0xe, 0x33, 0x1, 0xc0,
+    0xe3, 0x3f, 0xf8, 0xf, 0xb1, 0xff, 0x83, 0xfb, 0x80, 0x0, 0x7c, 0x3f,
+    0xff, 0xe7, 0x1, 0xff, 0xfe, 0x0, 0x1, 0x0, 0x0, 0x0, 0xf0, 0xf0,
+    0x0, 0x7e, 0x7, 0xc0, 0xf, 0x80, 0x1e, 0x0, 0xc0, 0x0, 0x20,
+
+    /* U+5883 */
+    0x4, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0xc, 0x1f, 0xff, 0xc0, 0xc3,
+    0xff, 0xfc, 0xc, 0x6, 0x7, 0x0, 0xc0, 0x60, 0x60, 0xc, 0x7, 0x6,
+    0x7, 0xfb, 0xff, 0xfe, 0x7f, 0xbf, 0xff, 0xe0, 0xe0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc1, 0xff, 0xf8, 0xc, 0x1c, 0x3, 0xc0, 0xc3, 0x80,
+    0xc, 0xc, 0x3f, 0xff, 0xc0, 0xc3, 0xff, 0xfc, 0xc, 0x38, 0x0, 0xc0,
+    0xc1, 0x80, 0x1c, 0xf, 0x9f, 0xff, 0xc0, 0xfc, 0xff, 0xf0, 0x7f, 0x87,
+    0x18, 0x7, 0x80, 0x71, 0x82, 0x0, 0xe, 0x18, 0x60, 0x1, 0xc1, 0x86,
+    0x0, 0xf8, 0x1f, 0xe0, 0x1f, 0x0, 0xfc, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+588A */
+    0x1, 0x0, 0x20, 0x0, 0x30, 0x3, 0x0, 0x3f, 0xf8, 0x30, 0x3, 0xff,
+    0x1f, 0xc0, 0x3, 0x3, 0xff, 0x3, 0xff, 0x9f, 0xf0, 0x7f, 0xfc, 0x33,
+    0x1, 0x87, 0x7, 0x30, 0x18, 0x61, 0x63, 0x3, 0xff, 0x1e, 0x30, 0x7f,
+    0xfc, 0xe3, 0x0, 0x38, 0xf, 0xb2, 0x3, 0x81, 0xdd, 0xa3, 0xff, 0xb8,
+    0xda, 0x3f, 0xf7, 0x1, 0xe0, 0x30, 0x20, 0xe, 0x3, 0x6, 0x0, 0x40,
+    0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+5893 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x7, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xe0, 0x0, 0x70, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff,
+    0xe0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x3c, 0x1, 0xc0, 0x7, 0x6, 0xe, 0x1, 0xe0, 0x60, 0x78, 0x7d, 0xff,
+    0xfb, 0xe7, 0x1f, 0xff, 0x8e, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8,
+
+    /* U+589E */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x7, 0xe0, 0xc, 0x6, 0x3e, 0x0, 0xc0,
+    0xe0, 0x30, 0xc, 0x1c, 0x3, 0x80, 0xc1, 0xc0, 0x1c, 0xc, 0x38, 0x1,
+    0xe7, 0xf7, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe3, 0xf1, 0xa6, 0x58, 0xc,
+    0x1b, 0x6d, 0x80, 0xc1, 0xb6, 0xd8, 0xc, 0x19, 0x69, 0x80, 0xc1, 0xc6,
+    0x18, 0xc, 0x1f, 0xff, 0x80, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc0, 0xff, 0xf0, 0xf, 0xcf, 0xff, 0x81, 0xf8, 0xc0, 0x38, 0x7f, 0xc,
+    0x3, 0x87, 0x80, 0xff, 0xf8, 0x0, 0xc, 0x3, 0x80, 0x0, 0xc0, 0x38,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+58A8 */
+    0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x18, 0x86, 0x11, 0x81, 0x9c,
+    0x63, 0x18, 0x18, 0xc6, 0x71, 0x81, 0xc4, 0xe6, 0x38, 0x1f, 0xff, 0xff,
+    0x80, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0x80, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xfe, 0x8, 0x40, 0x81, 0x1, 0x86, 0xc, 0x1c, 0x38, 0x60, 0xe1, 0xc7,
+    0x2, 0x66, 0xe, 0x60, 0x6, 0x0, 0x21, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x80, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+58C7 */
+    0x4, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x7f, 0xff, 0xe0, 0xe7,
+    0xff, 0xfe, 0xe, 0x0, 0x0, 0x0, 0xe1, 0xff, 0xf8, 0xe, 0x3f, 0xff,
+    0xc7, 0xfb, 0x80, 0xc, 0x7f, 0xb3, 0xfc, 0xc3, 0xf3, 0x30, 0xec, 0xe,
+    0x33, 0xe, 0xc0, 0xe3, 0x3f, 0xcc, 0xe, 0x38, 0x0, 0xc0, 0xe3, 0xff,
+    0xfc, 0xe, 0xf, 0xff, 0x80, 0xe0, 0x0, 0x0, 0xe, 0x1f, 0xff, 0x80,
+    0xe1, 0xc0, 0x18, 0xe, 0x1f, 0xff, 0x80, 0xfd, 0xff, 0xf8, 0x3f, 0x98,
+    0x1, 0x87, 0xe1, 0xff, 0xf8, 0x60, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+58E2 */
+    0x4, 0x0, 0x0, 0x0, 0xc1, 0xff, 0xfe, 0xc, 0x3f, 0xff, 0xe0, 0xc7,
+    0x0, 0x0, 0xc, 0x73, 0xe3, 0xc0, 0xc7, 0xfd, 0xf8, 0xc, 0x75, 0x9f,
+    0x7, 0xf7, 0x18, 0x30, 0x7f, 0xff, 0xef, 0xe3, 0xf7, 0xfe, 0xfe, 0xc,
+    0x73, 0x87, 0x80, 0xc6, 0x7c, 0xf8, 0xc, 0x67, 0xff, 0xc0, 0xc6, 0xdb,
+    0xb6, 0xc, 0x6d, 0xb3, 0x60, 0xc6, 0x18, 0x30, 0xc, 0x61, 0x1a, 0x0,
+    0xc6, 0x1, 0x80, 0xf, 0xe3, 0x18, 0x3, 0xf6, 0x31, 0xfc, 0x7c, 0xe3,
+    0x1f, 0xc6, 0xc, 0x31, 0x80, 0x0, 0xc3, 0x18, 0x0, 0x1c, 0x31, 0x80,
+    0x1, 0x9f, 0xff, 0xe0, 0x19, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+58EB */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff, 0xff, 0xf8,
+    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+58FD */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1e, 0x0,
+    0x0, 0x0, 0xe0, 0x7f, 0xff, 0xce, 0x0, 0xe, 0x0, 0x40, 0x0, 0xe0,
+    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7, 0x0, 0xfc, 0x0, 0x70, 0x1f, 0xe7,
+    0xff, 0xe3, 0x87, 0x0, 0x70, 0x30, 0x73, 0x3, 0x3, 0x87, 0x38, 0x30,
+    0x3f, 0xe1, 0x87, 0x1, 0xfe, 0x3, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+590F */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x1,
+    0xc0, 0x0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xc, 0x0, 0x3,
+    0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf,
+    0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff,
+    0xf0, 0x7, 0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0,
+    0x7f, 0xff, 0xe0, 0x1f, 0xe0, 0x1c, 0x3, 0xc7, 0x7, 0x80, 0x30, 0x3c,
+    0xe0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x3, 0xff, 0x9f, 0xfe,
+    0x7f, 0xc0, 0x1f, 0xe7, 0x80, 0x0, 0x4,
+
+    /* U+5915 */
+    0x0, 0x20, 0x0, 0x0, 0x1c, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0x1, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xe0, 0x38, 0x0, 0x38, 0x1c,
+    0x0, 0xe, 0xf, 0x0, 0x3, 0x3, 0x80, 0x1, 0xc1, 0xc0, 0x0, 0x70,
+    0xe7, 0x0, 0x38, 0x71, 0xe0, 0xe, 0x18, 0x3e, 0x7, 0x0, 0x3, 0xc3,
+    0x80, 0x0, 0x7d, 0xe0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0xe, 0x0, 0x0, 0xf, 0x0, 0x0, 0xf, 0x80, 0x0,
+    0x1f, 0x80, 0x0, 0x3f, 0xc0, 0x0, 0x7f, 0x80, 0x0, 0x1f, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+5916 */
+    0x1, 0x0, 0x10, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x38, 0x0, 0x70,
+    0x3, 0x80, 0x7, 0x0, 0x38, 0x0, 0x7f, 0xc3, 0x80, 0xf, 0xfe, 0x38,
+    0x0, 0xe0, 0xe3, 0x80, 0x1c, 0xe, 0x38, 0x1, 0xc0, 0xc3, 0x80, 0x38,
+    0xc, 0x3c, 0x3, 0x1, 0xc3, 0xe0, 0x76, 0x1c, 0x3f, 0x6, 0x79, 0xc3,
+    0xbc, 0x41, 0xf8, 0x39, 0xe0, 0xf, 0x83, 0x86, 0x0, 0x70, 0x38, 0x0,
+    0x7, 0x3, 0x80, 0x0, 0xe0, 0x38, 0x0, 0x1e, 0x3, 0x80, 0x1, 0xc0,
+    0x38, 0x0, 0x38, 0x3, 0x80, 0xf, 0x0, 0x38, 0x1, 0xe0, 0x3, 0x80,
+    0x3c, 0x0, 0x38, 0x7, 0x0, 0x3, 0x0, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+591A */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c,
+    0x0, 0x0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x7, 0xc0, 0x3, 0xc1,
+    0xe2, 0x0, 0xe0, 0x10, 0x70, 0x78, 0x0, 0x7, 0x3e, 0x0, 0x0, 0x7f,
+    0x0, 0x0, 0x3f, 0x80, 0x0, 0x7f, 0xd8, 0x0, 0x7f, 0xc7, 0x0, 0x1f,
+    0x83, 0xc0, 0x1, 0x0, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x7c, 0x0,
+    0x38, 0x3e, 0x0, 0xe, 0xf, 0x1c, 0x3, 0x80, 0x1, 0xc1, 0xe0, 0x0,
+    0x1e, 0xf8, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x7f, 0x80,
+    0x7, 0xff, 0xc0, 0x1, 0xff, 0x80, 0x0, 0x1c, 0x0, 0x0, 0x0,
+
+    /* U+591C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x8, 0x0, 0x0, 0x1, 0x87, 0x0,
+    0x0, 0x38, 0x60, 0x0, 0x3, 0xf, 0xfe, 0x0, 0x70, 0xff, 0xf8, 0x6,
+    0xf, 0xff, 0x80, 0xe1, 0xc0, 0x38, 0xe, 0x18, 0xc3, 0x81, 0xe3, 0xce,
+    0x70, 0x3e, 0x7c, 0x67, 0x3, 0xe6, 0xe2, 0xe0, 0x76, 0xe6, 0xc, 0x6,
+    0x6c, 0x71, 0xc0, 0x6, 0x3, 0xb8, 0x0, 0x60, 0x1f, 0x0, 0x6, 0x1,
+    0xf0, 0x0, 0x60, 0x1f, 0x0, 0x6, 0x7, 0xfc, 0x0, 0x61, 0xf1, 0xf8,
+    0x6, 0x7e, 0x7, 0xe0, 0x6f, 0x80, 0x1e, 0x6, 0x40, 0x0, 0x0,
+
+    /* U+5922 */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x1, 0xff, 0xff, 0xf8, 0x18, 0x30, 0xc1, 0x81, 0x83, 0xc, 0x18, 0x1f,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xff, 0xc7, 0x7, 0x80, 0xe, 0x60, 0xf0, 0x0, 0x66,
+    0x1f, 0xff, 0xe6, 0x63, 0xff, 0xfe, 0x60, 0xf0, 0x1, 0xc0, 0x1e, 0x60,
+    0x38, 0x1, 0x87, 0x8f, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x1, 0xf8, 0x0,
+    0x7, 0xfe, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
+
+    /* U+5927 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x1, 0xf0,
+    0x0, 0x0, 0x1d, 0x80, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x38, 0xc0, 0x0,
+    0x7, 0xe, 0x0, 0x0, 0x70, 0x70, 0x0, 0xe, 0x7, 0x80, 0x1, 0xc0,
+    0x3c, 0x0, 0x38, 0x1, 0xe0, 0xf, 0x80, 0xf, 0x81, 0xe0, 0x0, 0x7c,
+    0x7c, 0x0, 0x1, 0xe7, 0x80, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5929 */
+    0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xc0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x1, 0xb0,
+    0x0, 0x0, 0x39, 0x80, 0x0, 0x3, 0x1c, 0x0, 0x0, 0x70, 0xe0, 0x0,
+    0xe, 0xf, 0x0, 0x1, 0xc0, 0x78, 0x0, 0x3c, 0x3, 0xc0, 0x7, 0x80,
+    0x1f, 0x1, 0xf0, 0x0, 0xf8, 0x7c, 0x0, 0x3, 0xe7, 0x80, 0x0, 0x1e,
+    0x60, 0x0, 0x0, 0x0,
+
+    /* U+592A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0,
+    0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xd8,
+    0x0, 0x0, 0x19, 0xc0, 0x0, 0x3, 0x8c, 0x0, 0x0, 0x30, 0xe0, 0x0,
+    0x7, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x3, 0x80, 0x1, 0xcc,
+    0x1c, 0x0, 0x78, 0xe0, 0xf0, 0xf, 0x7, 0x7, 0x83, 0xe0, 0x78, 0x3c,
+    0x7c, 0x3, 0x81, 0xe7, 0x0, 0x18, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+592E */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff,
+    0x0, 0xe0, 0xe0, 0x70, 0xc, 0xe, 0x3, 0x0, 0xc0, 0xe0, 0x30, 0xc,
+    0xe, 0x3, 0x0, 0xc0, 0xe0, 0x30, 0xc, 0xe, 0x3, 0x0, 0xc0, 0xe0,
+    0x30, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x0, 0x0,
+    0x1, 0xf0, 0x0, 0x0, 0x19, 0x80, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x70,
+    0xe0, 0x0, 0xe, 0x7, 0x80, 0x3, 0xc0, 0x3e, 0x1, 0xf8, 0x1, 0xf8,
+    0x7e, 0x0, 0x7, 0xe7, 0xc0, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+5947 */
+    0x0, 0x4, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x38, 0x0, 0x1f, 0xff,
+    0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x38, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0x1, 0xdf, 0x0, 0x1, 0xf9, 0xfe, 0x3, 0xfc, 0x3, 0xf0, 0x7c, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x1, 0xc0, 0x0, 0x0, 0x38, 0x7, 0xfe, 0x7, 0x1, 0xff, 0xe0,
+    0xe0, 0x38, 0x1c, 0x1c, 0x6, 0x1, 0x83, 0x80, 0xc0, 0x30, 0x70, 0x18,
+    0x6, 0xe, 0x3, 0xff, 0xc1, 0xc0, 0x7f, 0xf8, 0x38, 0x0, 0x0, 0x7e,
+    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xc0, 0x0,
+
+    /* U+5948 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x7, 0xe, 0x0, 0x0, 0xe0, 0x60,
+    0x0, 0x1c, 0x7, 0x0, 0x3, 0x80, 0x38, 0x0, 0x70, 0x1, 0xe0, 0x1f,
+    0xff, 0xff, 0x83, 0xdf, 0xff, 0xfc, 0x78, 0xff, 0xf1, 0xe6, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x10, 0x61, 0x80, 0x3, 0x86,
+    0x1c, 0x0, 0xf0, 0x61, 0xe0, 0x1e, 0x6, 0xf, 0x83, 0xc0, 0x60, 0x3c,
+    0x38, 0x3e, 0x1, 0xc2, 0x7, 0xe0, 0x4, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+5951 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x83, 0xff, 0x83, 0xff,
+    0xbf, 0xfc, 0x3f, 0xf8, 0x71, 0xc0, 0x30, 0x7, 0xc, 0x3, 0x80, 0x70,
+    0xc3, 0xff, 0x6, 0xc, 0x1f, 0xf0, 0x60, 0xc0, 0x30, 0xe, 0xc, 0x3,
+    0xf8, 0xc0, 0xc3, 0xff, 0x9c, 0x1c, 0x7f, 0xc3, 0x81, 0xc2, 0x30, 0x30,
+    0xf8, 0x3, 0x0, 0xf, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf0, 0x0, 0x0, 0x1f,
+    0x80, 0x0, 0x3, 0x9c, 0x0, 0x0, 0xf0, 0xf0, 0x0, 0x3e, 0x7, 0xf0,
+    0x7f, 0x80, 0x1f, 0xe7, 0xe0, 0x0, 0x7e, 0x60, 0x0, 0x0, 0xe0,
+
+    /* U+5957 */
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0xf, 0xe, 0x0, 0x1, 0xe0, 0x70,
+    0x0, 0x3c, 0x3, 0x80, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xfc, 0x7b,
+    0x80, 0x3, 0xe6, 0x38, 0x0, 0x6, 0x3, 0xff, 0xfc, 0x0, 0x3f, 0xff,
+    0xc0, 0x3, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x3, 0xff, 0xfe, 0x0,
+    0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0xe, 0x3, 0x80, 0x0, 0xc0, 0x1c, 0x0, 0x1c, 0xf, 0xf0,
+    0x3f, 0xff, 0xff, 0x83, 0xff, 0xf0, 0x3c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+596E */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x1e, 0x7, 0x0, 0x7, 0xe1, 0x3c,
+    0x1, 0xee, 0x30, 0xf8, 0x79, 0xe7, 0x87, 0xe6, 0x7f, 0xff, 0xf6, 0xf,
+    0x7, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x37, 0xff, 0xfe, 0x0, 0x60, 0x30,
+    0x0, 0x7, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x6, 0x7, 0x0, 0x0,
+    0x7f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0x81, 0x80, 0x60, 0x38, 0x1c, 0xf, 0x3, 0x81, 0xff, 0xff, 0xf8,
+    0x18, 0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0,
+
+    /* U+5973 */
+    0x0, 0x10, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x1, 0x80, 0x1,
+    0xc0, 0x18, 0x0, 0x1c, 0x3, 0x80, 0x3, 0x80, 0x38, 0x0, 0x38, 0x3,
+    0x80, 0x3, 0x0, 0x30, 0x0, 0x70, 0x7, 0x0, 0x7, 0xc0, 0x60, 0x0,
+    0x3f, 0xe, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x7,
+    0xe0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x3e, 0x3c, 0x0, 0x1f, 0xc1, 0xf0,
+    0x3f, 0xf0, 0x7, 0x83, 0xf8, 0x0, 0x3c, 0x30, 0x0, 0x0, 0x80,
+
+    /* U+5976 */
+    0x4, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x7f, 0xf0, 0x6, 0x1f,
+    0xff, 0x0, 0xc0, 0x38, 0xe0, 0x18, 0x7, 0x1c, 0x1f, 0xf0, 0xe3, 0x83,
+    0xff, 0x1c, 0x70, 0x3c, 0xe3, 0x8c, 0x3, 0xc, 0x71, 0x80, 0x61, 0x8c,
+    0x30, 0xc, 0x71, 0x87, 0x3, 0x8e, 0x30, 0xfc, 0x61, 0x86, 0x1f, 0xcc,
+    0x30, 0xc0, 0x39, 0x86, 0x18, 0x7, 0x39, 0xc7, 0x0, 0xe3, 0xf0, 0xe0,
+    0x1c, 0x1e, 0x18, 0x3, 0x81, 0xc7, 0x0, 0x60, 0x7c, 0xe0, 0xc, 0x1d,
+    0xb8, 0x1, 0x8f, 0xf, 0x0, 0x73, 0xc1, 0xc0, 0x3c, 0x70, 0x70, 0x1f,
+    0x80, 0xe, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+597D */
+    0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xc, 0xf, 0xff, 0xc0, 0xc0,
+    0xff, 0xfc, 0xc, 0x0, 0x1, 0xc0, 0xc0, 0x0, 0x38, 0x7f, 0xc0, 0xe,
+    0x7, 0xfe, 0x1, 0xc0, 0x1c, 0xe0, 0x38, 0x1, 0x86, 0x3, 0x80, 0x18,
+    0x60, 0x30, 0x1, 0x8e, 0x3, 0x0, 0x18, 0xe7, 0xff, 0xc3, 0x8d, 0xff,
+    0xfe, 0x38, 0xcf, 0xff, 0xe3, 0xc, 0x3, 0x0, 0x39, 0xc0, 0x30, 0x1,
+    0xd8, 0x3, 0x0, 0xf, 0x80, 0x30, 0x0, 0x78, 0x3, 0x0, 0x7, 0xc0,
+    0x30, 0x0, 0xfe, 0x3, 0x0, 0x1e, 0xe0, 0x30, 0x3, 0xc6, 0x3, 0x0,
+    0x78, 0x3, 0xf0, 0x6, 0x0, 0x3f, 0x0, 0x0, 0x3, 0xc0, 0x0,
+
+    /* U+5982 */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x0,
+    0x3f, 0x80, 0x60, 0x1f, 0xfc, 0xc, 0x3, 0xff, 0x9f, 0xfc, 0x70, 0x73,
+    0xff, 0xcc, 0x6, 0xe, 0x39, 0x80, 0xc1, 0x83, 0x30, 0x18, 0x30, 0xe6,
+    0x3, 0xe, 0x1c, 0xc0, 0x61, 0xc3, 0x98, 0xc, 0x30, 0x73, 0x1, 0x86,
+    0xc, 0x60, 0x31, 0xc1, 0x8c, 0x6, 0x38, 0x71, 0x80, 0xc3, 0xce, 0x30,
+    0x18, 0x3f, 0x86, 0x3, 0x1, 0xf0, 0xc0, 0x60, 0x1e, 0x18, 0xc, 0x7,
+    0xf3, 0x1, 0x81, 0xee, 0x70, 0x70, 0xf8, 0xef, 0xfe, 0x3e, 0x0, 0xff,
+    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+599D */
+    0x0, 0x80, 0x80, 0x0, 0xc, 0xc, 0x0, 0x30, 0xc1, 0xc0, 0x3, 0xc,
+    0x1c, 0x0, 0x30, 0xc1, 0x80, 0x3, 0xc, 0x18, 0x0, 0x30, 0xc1, 0x80,
+    0x3, 0xd, 0xff, 0xfe, 0x3f, 0xdf, 0xff, 0xe3, 0xfc, 0x30, 0x30, 0x1,
+    0xc3, 0x3, 0x0, 0xc, 0x30, 0x30, 0x0, 0xc7, 0x7, 0x0, 0xc, 0x60,
+    0x70, 0x7f, 0xc6, 0x6, 0x7, 0xfc, 0x60, 0x60, 0x1d, 0xc6, 0x6, 0x1,
+    0x8c, 0x78, 0xe0, 0x18, 0xc3, 0xec, 0x1, 0x8c, 0xf, 0xc0, 0x18, 0xc0,
+    0x7c, 0x1, 0x8c, 0x7, 0xe0, 0x38, 0xc0, 0xff, 0x3, 0xc, 0x3c, 0x78,
+    0x70, 0xdf, 0x81, 0xc6, 0xd, 0xe0, 0xc, 0x0, 0x80, 0x0, 0x0,
+
+    /* U+59A4 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x1f, 0xff, 0xc0, 0xc0,
+    0xff, 0xfc, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x20, 0x70, 0x7f, 0x83, 0x9e,
+    0x7, 0xfc, 0x1f, 0x80, 0x3f, 0xe0, 0xf0, 0x1, 0x8c, 0x7, 0x0, 0x18,
+    0xc0, 0x30, 0x1, 0x8d, 0xff, 0xfc, 0x18, 0xdf, 0xff, 0xe3, 0x8c, 0x7,
+    0xe, 0x30, 0xc0, 0x61, 0xc3, 0x1c, 0x6, 0x18, 0x39, 0x80, 0x63, 0x81,
+    0xd8, 0x6, 0x70, 0xf, 0x80, 0x66, 0x0, 0x78, 0x6, 0x0, 0x7, 0xc0,
+    0x60, 0x0, 0xfe, 0x6, 0x0, 0x1c, 0x60, 0x60, 0x3, 0xc2, 0x6, 0x0,
+    0x78, 0x3, 0xe0, 0x6, 0x0, 0x7e, 0x0, 0x0, 0x3, 0x80, 0x0,
+
+    /* U+59B9 */
+    0x8, 0x0, 0x20, 0x0, 0xc0, 0x7, 0x0, 0xc, 0x0, 0x70, 0x1, 0xc0,
+    0x7, 0x0, 0x1c, 0x0, 0x70, 0x1, 0xc1, 0xff, 0xfc, 0x7f, 0x8f, 0xff,
+    0xc7, 0xfc, 0x7, 0x0, 0x39, 0xc0, 0x70, 0x1, 0x8c, 0x7, 0x0, 0x18,
+    0xc0, 0x70, 0x3, 0x8d, 0xff, 0xfe, 0x30, 0xff, 0xff, 0xe3, 0x1c, 0xff,
+    0xfc, 0x31, 0xc0, 0xf8, 0x3, 0x18, 0xf, 0x80, 0x31, 0x81, 0xfc, 0x3,
+    0xd8, 0x3f, 0x60, 0x1f, 0x83, 0x76, 0x0, 0x70, 0x67, 0x30, 0x7, 0x8e,
+    0x73, 0xc0, 0xfd, 0xc7, 0x1c, 0x1c, 0xf8, 0x70, 0xe3, 0x87, 0x7, 0x6,
+    0x70, 0x20, 0x70, 0x6, 0x0, 0x7, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+59CB */
+    0x4, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x1, 0xc0, 0x0, 0xc0,
+    0x1c, 0x0, 0xc, 0x1, 0x86, 0x0, 0xc0, 0x18, 0x70, 0x7f, 0x83, 0x83,
+    0x87, 0xfc, 0x30, 0x38, 0x3d, 0xc3, 0x1, 0xc1, 0x8c, 0x7f, 0xfe, 0x18,
+    0xdf, 0xff, 0xe1, 0x8d, 0xf8, 0x6, 0x38, 0xc0, 0x0, 0x3, 0x8c, 0x0,
+    0x0, 0x31, 0xc3, 0xff, 0x3, 0x1c, 0x7f, 0xf8, 0x39, 0x8f, 0x3, 0xc1,
+    0xd8, 0xe0, 0x1c, 0xf, 0x8e, 0x1, 0xc0, 0x78, 0xe0, 0x1c, 0x7, 0x8e,
+    0x1, 0xc0, 0xfc, 0xe0, 0x1c, 0x1c, 0xee, 0x1, 0xc3, 0x86, 0xf0, 0x3c,
+    0x78, 0x7, 0xff, 0x86, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+59D0 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x3, 0xff, 0x0, 0xc0,
+    0x7f, 0xf8, 0xc, 0x7, 0x3, 0x80, 0xc0, 0x60, 0x18, 0x7f, 0xc6, 0x1,
+    0x87, 0xfe, 0x60, 0x18, 0x1c, 0xe7, 0x3, 0x81, 0x86, 0x7f, 0xf8, 0x18,
+    0x67, 0xff, 0x81, 0x86, 0x60, 0x18, 0x18, 0x66, 0x1, 0x83, 0x8e, 0x60,
+    0x18, 0x30, 0xe6, 0x1, 0x83, 0xc, 0x70, 0x18, 0x38, 0xc7, 0xff, 0x81,
+    0xfc, 0x7f, 0xf8, 0xf, 0x86, 0x1, 0x80, 0x38, 0x60, 0x18, 0x3, 0xc6,
+    0x1, 0x80, 0x7e, 0x60, 0x18, 0x1e, 0x66, 0x1, 0x83, 0xc0, 0x70, 0x38,
+    0x78, 0x3f, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+59D4 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xc0, 0x1f, 0x8e, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff,
+    0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x3, 0xf8, 0x0, 0x0,
+    0xe6, 0xe0, 0x0, 0x3c, 0x67, 0xc0, 0x1f, 0x6, 0x1f, 0x87, 0xe0, 0x60,
+    0x7e, 0x78, 0x1c, 0x1, 0xe0, 0x3, 0x80, 0x0, 0x0, 0x30, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x3, 0x80, 0x1, 0xc0,
+    0x70, 0x0, 0x3e, 0x6, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x1, 0xff, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x7f, 0xe3, 0xf8, 0x3f, 0xf8, 0x7, 0x83, 0xe0,
+    0x0, 0x18,
+
+    /* U+59E8 */
+    0xc, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0xc, 0x0, 0x60, 0x1, 0xc3,
+    0xff, 0xfe, 0x1c, 0x3f, 0xff, 0xe1, 0xc0, 0x6, 0x0, 0x7f, 0x80, 0x60,
+    0x7, 0xfd, 0xff, 0xf8, 0x39, 0xdf, 0xff, 0xc1, 0x8c, 0x6, 0x1c, 0x18,
+    0xc0, 0x60, 0xc3, 0x8c, 0xff, 0xfc, 0x31, 0xdf, 0xff, 0xc3, 0x1d, 0x8e,
+    0x0, 0x31, 0x98, 0x60, 0x3, 0x1b, 0x8e, 0x0, 0x39, 0x9f, 0xff, 0xe3,
+    0xf8, 0xff, 0xfe, 0xf, 0x0, 0xf0, 0x60, 0x78, 0x1f, 0xe, 0x7, 0xc1,
+    0x99, 0xc0, 0xfc, 0x39, 0xdc, 0x1c, 0x67, 0xe, 0x3, 0x80, 0xe0, 0x78,
+    0x70, 0x7c, 0x3, 0xe6, 0xf, 0x80, 0xe, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+59FF */
+    0x0, 0x4, 0x0, 0x1, 0xc0, 0xc0, 0x0, 0x1e, 0x1c, 0x0, 0x0, 0xf3,
+    0xff, 0xfc, 0x3, 0x3f, 0xff, 0xc0, 0x7, 0x1c, 0x1c, 0x0, 0xe1, 0xc3,
+    0x80, 0xc, 0x1e, 0x30, 0x6, 0x3, 0xf2, 0x0, 0xe0, 0x73, 0x0, 0xc,
+    0xe, 0x3c, 0x1, 0xc3, 0xc1, 0xf8, 0x38, 0xf8, 0x7, 0xe3, 0x1f, 0x0,
+    0x1e, 0x20, 0x38, 0x0, 0x0, 0x3, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x7, 0x0, 0x3, 0xc0,
+    0xe0, 0x0, 0x1f, 0xee, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xff, 0xc0,
+    0xf, 0xfe, 0x3f, 0x83, 0xff, 0x0, 0x78, 0x1c, 0x0, 0x1, 0x80,
+
+    /* U+5A01 */
+    0x0, 0x0, 0x44, 0x0, 0x0, 0x6, 0x70, 0x0, 0x0, 0x63, 0x0, 0x0,
+    0x6, 0x10, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x1c, 0x0, 0x60,
+    0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x60, 0x1, 0xbf, 0xf6, 0x18, 0x19,
+    0xff, 0x71, 0x81, 0x86, 0x7, 0x38, 0x18, 0x60, 0x73, 0x1, 0x8e, 0x3,
+    0x30, 0x1b, 0xfe, 0x37, 0x1, 0xbf, 0xe3, 0x60, 0x18, 0xc6, 0x3e, 0x1,
+    0x98, 0x61, 0xc0, 0x19, 0x86, 0x1c, 0x3, 0x9e, 0xe1, 0xc0, 0x39, 0xfc,
+    0x3c, 0x63, 0x3, 0xf7, 0xe6, 0x30, 0x3f, 0x76, 0x67, 0xf, 0x1e, 0x7e,
+    0x63, 0xe3, 0xc3, 0xe6, 0x38, 0x38, 0x1c, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+5A18 */
+    0x4, 0x0, 0x20, 0x0, 0xc0, 0x3, 0x0, 0xc, 0x0, 0x70, 0x0, 0xc0,
+    0x3f, 0xe0, 0xc, 0x7, 0xff, 0x80, 0xc0, 0xf0, 0x3c, 0x7f, 0x8e, 0x1,
+    0xc7, 0xfc, 0xc0, 0x1c, 0x3d, 0xcf, 0xff, 0xc1, 0x8c, 0xff, 0xfc, 0x18,
+    0xce, 0x1, 0xc1, 0x8c, 0xc0, 0x1c, 0x38, 0xcc, 0x1, 0xc3, 0xc, 0xff,
+    0xf8, 0x30, 0xcf, 0xff, 0x83, 0x1c, 0xe3, 0x0, 0x31, 0x8c, 0x30, 0xe3,
+    0xd8, 0xc1, 0x9c, 0xf, 0x8c, 0x1b, 0x80, 0x78, 0xc1, 0xf0, 0x7, 0x8c,
+    0xe, 0x0, 0xfc, 0xc2, 0xe0, 0x1c, 0xef, 0xe7, 0x3, 0x84, 0xfe, 0x3c,
+    0x78, 0x3f, 0x81, 0xe6, 0x3, 0xc0, 0xe, 0x0, 0x0, 0x0, 0x20,
+
+    /* U+5A1C */
+    0x8, 0x0, 0x0, 0x0, 0xc3, 0xf0, 0x38, 0x1c, 0x7f, 0xcf, 0xe1, 0xc3,
+    0xfd, 0xfe, 0x18, 0xc, 0xdc, 0x61, 0x80, 0xcd, 0xce, 0x7f, 0xc, 0xdc,
+    0xc7, 0xf8, 0xcd, 0xcc, 0x39, 0xbf, 0xdd, 0xc1, 0x9b, 0xfd, 0xd8, 0x39,
+    0x8c, 0xdd, 0x83, 0x18, 0xcd, 0xf8, 0x31, 0x9c, 0xdd, 0x83, 0x19, 0x8d,
+    0xdc, 0x31, 0xbf, 0xdc, 0xc3, 0x1f, 0xfd, 0xce, 0x33, 0x3f, 0xdc, 0x63,
+    0xf1, 0x8d, 0xc6, 0x1f, 0x18, 0xdc, 0x60, 0x73, 0xd, 0xc6, 0xf, 0xb0,
+    0xdc, 0xe0, 0xff, 0x1d, 0xfe, 0x1c, 0x71, 0x9f, 0xc3, 0x86, 0x39, 0xd0,
+    0x70, 0xef, 0x9c, 0x6, 0xc, 0xf1, 0xc0, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+5A46 */
+    0x0, 0x0, 0x40, 0x1, 0xc0, 0xe, 0x0, 0x1f, 0x0, 0xe0, 0x0, 0x77,
+    0xff, 0xfc, 0x0, 0x70, 0xe1, 0xc3, 0x86, 0xe, 0x18, 0x3c, 0x60, 0xe1,
+    0x0, 0xc7, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0x80, 0x6e, 0x0, 0x70, 0xe,
+    0xc7, 0xe, 0x1, 0xcc, 0x39, 0xc0, 0x1d, 0xc1, 0xf8, 0x3, 0xb8, 0xff,
+    0xf8, 0x33, 0x9f, 0x1f, 0xe0, 0x1, 0x80, 0x1e, 0x0, 0x30, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x7, 0x0, 0x1, 0xc0,
+    0x70, 0x0, 0x1f, 0xe, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xff, 0x80,
+    0x7, 0xff, 0x7f, 0x3, 0xff, 0x80, 0xf8, 0x3f, 0x0, 0x1, 0x80,
+
+    /* U+5A49 */
+    0x8, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0x1c, 0x0, 0x60, 0x1, 0x80,
+    0x7f, 0xf0, 0x18, 0x3f, 0xff, 0xc1, 0x83, 0xff, 0xfe, 0x7f, 0x30, 0x0,
+    0xe7, 0xfb, 0x40, 0xe, 0x3b, 0xbc, 0x0, 0x61, 0x98, 0xc0, 0x0, 0x19,
+    0x8f, 0x9f, 0x83, 0x19, 0xfd, 0xfc, 0x31, 0x98, 0xd8, 0xc3, 0x1b, 0x8d,
+    0x8c, 0x33, 0xb1, 0x98, 0xc3, 0x33, 0x19, 0x8c, 0x33, 0x7d, 0x98, 0xc3,
+    0xf6, 0xf9, 0x9c, 0xf, 0x7, 0x9b, 0xc0, 0x70, 0x31, 0xb8, 0xf, 0x87,
+    0x18, 0x1, 0xd8, 0x61, 0x82, 0x1c, 0x8e, 0x18, 0x63, 0x83, 0xc1, 0x86,
+    0x70, 0x78, 0x1f, 0xe6, 0xe, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5A5A */
+    0xc, 0x0, 0x1, 0x80, 0xc0, 0x3f, 0xfc, 0xc, 0xf, 0xff, 0x0, 0xc0,
+    0xe1, 0x80, 0xc, 0xc, 0x18, 0x1, 0xc0, 0xc1, 0x80, 0x7f, 0x8f, 0xff,
+    0xe7, 0xfc, 0xff, 0xfe, 0x3d, 0xcc, 0xc, 0x1, 0x8c, 0xc0, 0xc0, 0x18,
+    0xcc, 0x6, 0x21, 0x8c, 0xc6, 0x66, 0x38, 0xcf, 0xe7, 0x63, 0xf, 0xf8,
+    0x3e, 0x31, 0xf8, 0x1, 0xc3, 0x18, 0x7f, 0xf8, 0x31, 0x8f, 0xff, 0x83,
+    0xd8, 0xc0, 0x18, 0xf, 0xc, 0x1, 0x80, 0x70, 0xff, 0xf8, 0x7, 0x8f,
+    0xff, 0x80, 0xfc, 0xc0, 0x18, 0x1c, 0xec, 0x1, 0x83, 0x86, 0xe0, 0x18,
+    0x70, 0xf, 0xff, 0x86, 0x0, 0x7f, 0xf8,
+
+    /* U+5A66 */
+    0xc, 0x0, 0x0, 0x0, 0xc0, 0xff, 0xe0, 0xc, 0x1f, 0xff, 0x81, 0xc0,
+    0x0, 0x38, 0x1c, 0x0, 0x1, 0x81, 0xc3, 0xff, 0xfe, 0x7f, 0xbf, 0xff,
+    0xe7, 0xf8, 0x0, 0x18, 0x39, 0xcf, 0xff, 0x81, 0x8d, 0xff, 0xf8, 0x19,
+    0xc0, 0x0, 0x3, 0x98, 0x0, 0x0, 0x31, 0x9f, 0xff, 0xc3, 0x1b, 0xff,
+    0xfe, 0x31, 0xb0, 0x60, 0x63, 0x1b, 0x6, 0x6, 0x31, 0x97, 0xff, 0x43,
+    0xf0, 0xff, 0xf8, 0x1f, 0xc, 0x63, 0x80, 0x70, 0xc6, 0x18, 0x7, 0x8c,
+    0x61, 0x80, 0xfc, 0xc6, 0x18, 0x1c, 0xcc, 0x67, 0x83, 0x84, 0xc6, 0xf8,
+    0x70, 0x8, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+5A77 */
+    0x0, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0xc, 0x0, 0xe0, 0x0, 0xc7,
+    0xff, 0xfe, 0x1c, 0x3f, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x7f, 0x87, 0xff,
+    0x7, 0xfc, 0xff, 0xf0, 0x19, 0xcc, 0x3, 0x1, 0x8c, 0xc0, 0x30, 0x18,
+    0xcf, 0xff, 0x3, 0x8c, 0x3f, 0xe0, 0x38, 0xc0, 0x0, 0x3, 0x1d, 0xff,
+    0xfc, 0x31, 0xbf, 0xff, 0xe3, 0x1b, 0x0, 0xe, 0x39, 0xb0, 0x0, 0x63,
+    0xfb, 0x7f, 0xe6, 0x1f, 0x7, 0xff, 0x40, 0x70, 0x7, 0x0, 0x7, 0x80,
+    0x70, 0x0, 0xfc, 0x7, 0x0, 0x1c, 0xc0, 0x70, 0x3, 0xc4, 0x7, 0x0,
+    0x78, 0x1, 0xe0, 0x7, 0x0, 0x3e, 0x0, 0x0, 0x3, 0xc0, 0x0,
+
+    /* U+5A92 */
+    0xc, 0x6, 0x3, 0x0, 0xc0, 0x60, 0x30, 0xc, 0x6, 0x3, 0x1, 0xc3,
+    0xff, 0xfc, 0x1c, 0x3f, 0xff, 0xe1, 0xc0, 0xe0, 0x70, 0x7f, 0x86, 0x3,
+    0x7, 0xfc, 0x60, 0x70, 0x39, 0xc7, 0xff, 0x1, 0x8c, 0x60, 0x70, 0x18,
+    0xc6, 0x3, 0x3, 0x8c, 0x60, 0x70, 0x30, 0xc7, 0xff, 0x3, 0x1c, 0x3f,
+    0xe0, 0x31, 0xc0, 0x60, 0x3, 0x18, 0x6, 0x0, 0x31, 0xbf, 0xff, 0xe3,
+    0xdb, 0xff, 0xfe, 0xf, 0x0, 0xf8, 0x0, 0x70, 0x1f, 0x80, 0x7, 0x83,
+    0xfe, 0x0, 0xfc, 0x76, 0x70, 0x1c, 0xde, 0x63, 0xc3, 0x83, 0xc6, 0x1e,
+    0x70, 0x78, 0x60, 0xe6, 0x0, 0x6, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+5ABD */
+    0xc, 0x0, 0x0, 0x1, 0x80, 0xff, 0xf8, 0x30, 0x3f, 0xff, 0x8e, 0xe,
+    0x1c, 0x1, 0xc1, 0xc3, 0x0, 0x38, 0x38, 0x60, 0x1f, 0xe7, 0xff, 0xf3,
+    0xfe, 0xff, 0xfc, 0x39, 0xdc, 0x30, 0x3, 0x1b, 0x86, 0x0, 0x63, 0x7f,
+    0xfe, 0x1c, 0x6f, 0xff, 0xe3, 0xd, 0xc3, 0x80, 0x63, 0xb8, 0x60, 0xc,
+    0x77, 0xc, 0x1, 0x8c, 0xff, 0xfe, 0x31, 0x8f, 0xff, 0xe7, 0xb0, 0x0,
+    0x1c, 0x3c, 0x0, 0x11, 0x83, 0x99, 0x36, 0x70, 0x7b, 0x36, 0x6e, 0x1f,
+    0xe6, 0xed, 0xc7, 0x1c, 0xcc, 0xb1, 0xc3, 0x18, 0x6, 0x70, 0x60, 0x3,
+    0xcc, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+5B24 */
+    0x8, 0x0, 0x20, 0x1, 0x80, 0x7, 0x0, 0x18, 0xf, 0xff, 0xc1, 0x83,
+    0xff, 0xfe, 0x18, 0x39, 0x0, 0x1, 0x83, 0x10, 0x20, 0x7f, 0x31, 0x87,
+    0x7, 0xfb, 0x7d, 0xfc, 0x3b, 0xb3, 0x87, 0x3, 0x9b, 0x10, 0x20, 0x31,
+    0xb5, 0x4b, 0x83, 0x1b, 0x54, 0xb8, 0x31, 0xb5, 0x4b, 0x83, 0x1b, 0x55,
+    0xba, 0x31, 0xbd, 0x1b, 0xe3, 0x13, 0x1, 0x2c, 0x33, 0x30, 0x60, 0x3,
+    0xb3, 0xc, 0x60, 0x1f, 0x37, 0xce, 0x0, 0xf7, 0x38, 0xc0, 0x7, 0x61,
+    0xd9, 0x0, 0xfe, 0x7, 0x98, 0x1c, 0x60, 0x31, 0x83, 0x8e, 0x6, 0x3c,
+    0x70, 0xef, 0xff, 0xe6, 0xc, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5B30 */
+    0x1f, 0xf0, 0xff, 0x81, 0xff, 0x9f, 0xf8, 0x18, 0x19, 0x81, 0x81, 0xff,
+    0x9f, 0xf8, 0x1f, 0xf9, 0xff, 0x81, 0x81, 0x98, 0x18, 0x18, 0x39, 0xc1,
+    0x81, 0xff, 0x9f, 0xf8, 0x18, 0x19, 0x81, 0x81, 0x83, 0x9c, 0x18, 0x1f,
+    0xf9, 0xff, 0x80, 0xc6, 0x4, 0x30, 0x1c, 0x70, 0xe3, 0x83, 0x83, 0x9c,
+    0x1c, 0x70, 0x1b, 0x80, 0xe0, 0x3, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x1, 0xc0, 0x38, 0x0, 0x18, 0x7, 0x0, 0x1, 0xf0,
+    0xe0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0xf, 0xf8, 0x0, 0xf, 0xf7, 0xf0,
+    0x3f, 0xf8, 0xf, 0x83, 0xe0, 0x0, 0x18,
+
+    /* U+5B50 */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xe0,
+    0x0, 0x0, 0x78, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x7, 0xe0, 0x0,
+    0x0, 0xfc, 0x0, 0x0, 0x3, 0x0, 0x0,
+
+    /* U+5B55 */
+    0x3f, 0xff, 0xe0, 0x3, 0xff, 0xff, 0x0, 0x1, 0xc0, 0xf0, 0x0, 0x1c,
+    0x6, 0x0, 0x1, 0x80, 0x60, 0x0, 0x18, 0xf, 0xf8, 0x3, 0x80, 0x7f,
+    0xc0, 0x38, 0x0, 0x1c, 0x7, 0x0, 0x0, 0xc0, 0xef, 0xfe, 0xc, 0x3e,
+    0xff, 0xf1, 0xc7, 0x87, 0xff, 0x78, 0x60, 0x1, 0xef, 0x80, 0x0, 0x78,
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x7, 0xe0, 0x0,
+    0x0, 0x7c, 0x0, 0x0, 0x7, 0x80, 0x0,
+
+    /* U+5B57 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x73, 0xff, 0xfc, 0xe7, 0x7f, 0xff, 0xee, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x38,
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+5B58 */
+    0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x39, 0xff, 0xf8, 0x7,
+    0x9f, 0xff, 0x80, 0x70, 0x0, 0x70, 0x7, 0x0, 0xe, 0x0, 0xf0, 0x3,
+    0xc0, 0x1f, 0x0, 0x30, 0x1, 0xf0, 0x7, 0x0, 0x3f, 0x0, 0x70, 0x7,
+    0x77, 0xff, 0xfe, 0x67, 0x7f, 0xff, 0xe0, 0x70, 0x7, 0x0, 0x7, 0x0,
+    0x70, 0x0, 0x70, 0x7, 0x0, 0x7, 0x0, 0x70, 0x0, 0x70, 0x7, 0x0,
+    0x7, 0x3, 0xf0, 0x0, 0x70, 0x3e, 0x0, 0x2, 0x3, 0xc0, 0x0,
+
+    /* U+5B5D */
+    0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x18, 0x0, 0x18, 0x3, 0x81, 0xff,
+    0xfe, 0x70, 0x1f, 0xff, 0xfe, 0x0, 0x1, 0x83, 0xc0, 0x0, 0x18, 0x78,
+    0x0, 0x1, 0x8e, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0,
+    0xe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3f, 0xff,
+    0xf0, 0x7, 0xff, 0xfe, 0x3, 0xe0, 0x3, 0xc0, 0x78, 0x1, 0xe0, 0x6,
+    0x0, 0x38, 0x0, 0x0, 0x3, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xe0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x1f, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+5B63 */
+    0x0, 0x0, 0xe, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfc, 0x0, 0xe0,
+    0xe0, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x3, 0xf8, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0xe, 0x67, 0x0, 0x3,
+    0xc6, 0x3e, 0x1, 0xf0, 0x60, 0xfc, 0x7e, 0x0, 0x3, 0xe7, 0x3f, 0xff,
+    0xce, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xe0, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x1e, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+5B78 */
+    0x0, 0x80, 0x0, 0x0, 0xfd, 0xbb, 0xf0, 0x1e, 0xf, 0x3f, 0x81, 0x80,
+    0xf0, 0x18, 0x1f, 0x99, 0x9f, 0x81, 0xfd, 0x3, 0xf8, 0x1c, 0x19, 0x81,
+    0x81, 0xc0, 0xf0, 0x38, 0x1f, 0xcf, 0x3f, 0x81, 0xf9, 0xf9, 0xf8, 0xc,
+    0x18, 0x83, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0,
+    0xe, 0x70, 0x0, 0x0, 0xe7, 0xff, 0xff, 0xee, 0x67, 0xff, 0xfe, 0x60,
+    0x0, 0x1f, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+5B85 */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x1, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xb8, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x1f, 0x80,
+    0x0, 0x67, 0xe0, 0x1, 0xf9, 0xc0, 0xff, 0xfc, 0x3, 0xff, 0xf0, 0x0,
+    0xfe, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xe0, 0x7, 0x83,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x80, 0xc, 0x0, 0x70,
+    0x3, 0x80, 0x1c, 0x0, 0xe0, 0xf, 0x0, 0x1f, 0xff, 0x80, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0,
+
+    /* U+5B87 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x80, 0x0, 0x1e, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe6, 0x7f, 0xff, 0xe6, 0x7,
+    0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+5B89 */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xb8, 0x0, 0x0, 0x7e, 0x3, 0x0, 0x1f, 0x80,
+    0xc0, 0x7, 0xe0, 0x70, 0x1, 0xd0, 0x18, 0x0, 0x20, 0xe, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xc0, 0xf0, 0xe, 0x0, 0x38, 0x3,
+    0x0, 0xe, 0x0, 0xc0, 0x7, 0x0, 0x70, 0x1, 0xc0, 0x1c, 0x0, 0x7c,
+    0xe, 0x0, 0xf, 0xe7, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x3, 0xf8, 0x0,
+    0x1, 0xff, 0x80, 0x3, 0xf1, 0xf8, 0x7f, 0xf0, 0x1f, 0x1f, 0xf0, 0x1,
+    0xe0, 0x0, 0x0, 0x10,
+
+    /* U+5B8B */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x60, 0xe, 0x70, 0x6, 0x0, 0xe2, 0x0, 0x60, 0x4, 0x0,
+    0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfc, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x76, 0xe0, 0x0,
+    0xe, 0x67, 0x0, 0x1, 0xc6, 0x38, 0x0, 0x78, 0x61, 0xe0, 0xf, 0x6,
+    0xf, 0x3, 0xe0, 0x60, 0x7c, 0x7c, 0x6, 0x3, 0xe7, 0x0, 0x60, 0xe,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+5B8C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe2, 0x7f, 0xff, 0xe4, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
+    0x6, 0xc, 0x0, 0x0, 0xe0, 0xc0, 0x0, 0xe, 0xc, 0x0, 0x0, 0xc0,
+    0xc0, 0x60, 0x1c, 0xc, 0x6, 0x3, 0x80, 0xc0, 0xe0, 0xf0, 0xe, 0xe,
+    0x3e, 0x0, 0xff, 0xc7, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5B97 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x80, 0x0, 0x1e, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe6, 0x7f, 0xff, 0xe4, 0x7,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x1, 0x86, 0x18, 0x0, 0x38, 0x61, 0xc0, 0x7, 0x6,
+    0xf, 0x1, 0xe0, 0x60, 0x78, 0x3c, 0x6, 0x3, 0xc7, 0x80, 0xe0, 0x1e,
+    0x60, 0x7e, 0x0, 0x60, 0x7, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+5B98 */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0xc0, 0x1, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xb8, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x1f, 0x8f,
+    0xff, 0xc7, 0xe7, 0xff, 0xf8, 0xc3, 0xc0, 0xf, 0x0, 0xe0, 0x1, 0xc0,
+    0x38, 0x0, 0x70, 0xe, 0x0, 0x1c, 0x3, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0x80, 0x38, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xff,
+    0xff, 0xe0, 0x3f, 0xff, 0xf8, 0xe, 0x0, 0x6, 0x3, 0x80, 0x1, 0x80,
+    0xe0, 0x0, 0x60, 0x38, 0x0, 0x38, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0x0,
+
+    /* U+5B9A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x80, 0x0, 0x1e, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0xe2, 0x7f, 0xff, 0xe4, 0x7,
+    0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x3, 0x6, 0x0, 0x0, 0x30, 0x7f, 0xc0, 0x7, 0x7, 0xff, 0x0,
+    0x70, 0x7f, 0xe0, 0x7, 0x6, 0x0, 0x0, 0x70, 0x60, 0x0, 0xf, 0x86,
+    0x0, 0x1, 0xdc, 0x60, 0x0, 0x1c, 0xf6, 0x0, 0x3, 0x87, 0xfe, 0x0,
+    0x70, 0x1f, 0xff, 0xe6, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5B9C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x73, 0xff, 0xfc, 0xe2, 0x3f, 0xff, 0xc4, 0x3,
+    0x0, 0x1c, 0x0, 0x30, 0x0, 0xc0, 0x3, 0x0, 0xc, 0x0, 0x3f, 0xff,
+    0xc0, 0x3, 0xff, 0xfc, 0x0, 0x30, 0x0, 0xc0, 0x3, 0x0, 0xc, 0x0,
+    0x30, 0x0, 0xc0, 0x3, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x3, 0x0,
+    0xc, 0x0, 0x30, 0x0, 0xc0, 0x3, 0x0, 0xc, 0x0, 0x78, 0x1, 0xe0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+5BA2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc7, 0x6, 0x0, 0xe, 0x70, 0xe0, 0x0,
+    0xe7, 0x1f, 0xff, 0x8e, 0x63, 0xff, 0xfe, 0x60, 0x7e, 0x3, 0xc0, 0xe,
+    0xe0, 0x38, 0x3, 0xc7, 0x7, 0x0, 0x78, 0x3d, 0xe0, 0x6, 0x1, 0xf8,
+    0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf, 0x9f, 0x80, 0x1f, 0xe0, 0x7f, 0xc7,
+    0xf0, 0x0, 0xfe, 0x7b, 0xff, 0xf9, 0xe0, 0x7f, 0xff, 0xe0, 0xf, 0xff,
+    0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5BA4 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
+    0xe7, 0x0, 0x0, 0xe, 0x77, 0xff, 0xfe, 0xe6, 0x7f, 0xff, 0xe6, 0x0,
+    0x30, 0x0, 0x0, 0x7, 0x3, 0x80, 0x0, 0x60, 0x1c, 0x0, 0xe, 0xf,
+    0xf0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xf0, 0x18, 0x0, 0x6, 0x0, 0x80,
+    0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x7, 0xff,
+    0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+5BB4 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7, 0xff, 0xfe, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x73, 0xff, 0xfc,
+    0xe7, 0x7f, 0xff, 0xee, 0x26, 0x0, 0x6, 0x40, 0x70, 0x0, 0xe0, 0x7,
+    0xff, 0xfe, 0x0, 0x70, 0x0, 0xe0, 0x6, 0x0, 0x6, 0x0, 0x7f, 0xff,
+    0xe0, 0x3, 0xff, 0xfc, 0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x3, 0x0, 0x3, 0xc0,
+    0x70, 0x0, 0x1f, 0xce, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xff, 0xc0,
+    0x1, 0xfe, 0x3f, 0x3, 0xff, 0x80, 0xf8, 0x1c, 0x0, 0x1, 0x80,
+
+    /* U+5BB5 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xfd, 0xc0, 0x8, 0x3, 0xb9, 0x83, 0x6, 0x37,
+    0x38, 0x60, 0xc6, 0x63, 0xc, 0x38, 0xc0, 0x61, 0x86, 0x0, 0x0, 0x38,
+    0x80, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xe0, 0x38, 0x0, 0xe, 0x6,
+    0x0, 0x1, 0xc0, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x3, 0x0, 0x0,
+    0xe0, 0x60, 0x0, 0x1c, 0xf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf0, 0x30,
+    0x0, 0xe, 0x6, 0x0, 0x1, 0xc0, 0xc0, 0x0, 0x38, 0x18, 0x0, 0x7e,
+    0x3, 0x0, 0x1f, 0xc0, 0x60, 0x1, 0xf0, 0x0,
+
+    /* U+5BB6 */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x70, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xf9, 0xc0, 0x0, 0x3, 0xb8, 0x0, 0x0, 0x77,
+    0x7f, 0xff, 0xee, 0xcf, 0xff, 0xfd, 0xc0, 0x7, 0xc0, 0x0, 0x1, 0xe0,
+    0x0, 0x0, 0xfc, 0x3, 0x0, 0xf9, 0xc1, 0xe0, 0xfc, 0x38, 0x78, 0x1e,
+    0xf, 0x9c, 0x0, 0x7, 0xbf, 0x0, 0x3, 0xe3, 0xc0, 0x3, 0xf0, 0xfc,
+    0x1, 0xf8, 0x7f, 0x80, 0x38, 0x1d, 0xd8, 0x0, 0xf, 0x39, 0xc0, 0x7,
+    0xc7, 0x1e, 0x7, 0xe0, 0xe1, 0xe3, 0xf0, 0x1c, 0x1e, 0xf0, 0x7f, 0x0,
+    0xc0, 0xf, 0xe0, 0x0, 0x1, 0xf0, 0x0, 0x0,
+
+    /* U+5BB9 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x70, 0x60, 0x40,
+    0xe7, 0x1e, 0x7, 0xe, 0x63, 0xc6, 0x3c, 0x40, 0xf8, 0xe1, 0xf0, 0x1e,
+    0x1f, 0x7, 0x81, 0x83, 0xb8, 0x38, 0x0, 0x71, 0xe0, 0x0, 0x1e, 0x7,
+    0x0, 0x3, 0xc0, 0x3c, 0x0, 0xf0, 0x1, 0xf0, 0x3e, 0x0, 0x7, 0xe7,
+    0xbf, 0xff, 0xde, 0x67, 0xff, 0xfe, 0x20, 0x70, 0x0, 0xe0, 0x6, 0x0,
+    0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x70, 0x0, 0xe0,
+    0x7, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5BBF */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
+    0xe7, 0x30, 0x0, 0xe, 0x63, 0x7f, 0xff, 0xc0, 0x77, 0xff, 0xf8, 0x6,
+    0x0, 0xc0, 0x0, 0xe0, 0x1c, 0x0, 0xe, 0x1, 0x80, 0x1, 0xe1, 0xff,
+    0xf0, 0x1e, 0x3f, 0xff, 0x83, 0xe3, 0x0, 0x38, 0x7e, 0x30, 0x1, 0x86,
+    0x63, 0x0, 0x18, 0x46, 0x3f, 0xff, 0x80, 0x63, 0xff, 0xf8, 0x6, 0x30,
+    0x3, 0x80, 0x63, 0x0, 0x18, 0x6, 0x30, 0x1, 0x80, 0x63, 0x0, 0x38,
+    0x6, 0x3f, 0xff, 0x80, 0x61, 0xff, 0xf0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5BC4 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xe7, 0x0, 0x40, 0xe, 0x60, 0xe, 0x0,
+    0x66, 0x7f, 0xff, 0xe6, 0x6f, 0xff, 0xff, 0x60, 0x1, 0xc0, 0x0, 0x0,
+    0x38, 0x0, 0x0, 0xf, 0x3f, 0x80, 0x1f, 0xe0, 0xff, 0x1, 0xf0, 0x0,
+    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x70, 0x3, 0xfe, 0x7, 0x0, 0xff, 0xf0, 0x70, 0xe, 0x3,
+    0x87, 0x0, 0xc0, 0x38, 0x70, 0xc, 0x3, 0x87, 0x0, 0xff, 0xf0, 0x70,
+    0x7, 0xff, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+5BC7 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0xe, 0x70, 0x0, 0x60,
+    0xe7, 0xff, 0x86, 0xe, 0x2f, 0xf8, 0x7f, 0x40, 0x0, 0x7, 0xf0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0xfe, 0x7, 0xff, 0xff,
+    0xf8, 0x3f, 0xf8, 0x3, 0x80, 0x66, 0x0, 0x30, 0x6, 0x61, 0x86, 0x0,
+    0x66, 0x1e, 0xe0, 0xe, 0x60, 0x7c, 0x0, 0xe6, 0x7, 0xc0, 0xc, 0x61,
+    0xef, 0x20, 0xc6, 0x78, 0x36, 0x1c, 0x67, 0x0, 0x63, 0x87, 0x0, 0xe,
+    0x70, 0x7f, 0xff, 0xe7, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5BCC */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x7f, 0xff, 0xfc, 0x3f, 0xff,
+    0xff, 0xe7, 0x0, 0x0, 0x1d, 0xc0, 0x0, 0x1, 0xbb, 0xff, 0xff, 0xb7,
+    0x7f, 0xff, 0xe6, 0x40, 0x0, 0x0, 0xc0, 0xff, 0xff, 0x0, 0x3f, 0xff,
+    0xf0, 0x7, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xc0, 0x1f, 0xff, 0xf8, 0x1,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x7, 0xff, 0xff,
+    0xe0, 0xe0, 0x30, 0xc, 0x18, 0x6, 0x1, 0x83, 0xff, 0xff, 0xf0, 0x7f,
+    0xff, 0xfe, 0xc, 0x3, 0x0, 0xc1, 0xc0, 0x60, 0x18, 0x3f, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xc0,
+
+    /* U+5BD2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xe, 0x6, 0xe, 0x70, 0xe0, 0x60,
+    0xe7, 0xff, 0xff, 0xfe, 0x27, 0xff, 0xfe, 0x40, 0xe, 0x6, 0x0, 0x0,
+    0xe0, 0xe0, 0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x0, 0xe, 0x6,
+    0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+    0x1c, 0x3, 0x80, 0x3, 0x9c, 0x1c, 0x0, 0x70, 0xf1, 0xe0, 0xf, 0x7,
+    0x8f, 0x83, 0xe0, 0x18, 0x3c, 0x78, 0xc0, 0x1, 0xe7, 0xf, 0xf0, 0x4,
+    0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+5BD3 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x78, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xfd, 0xc0, 0x0, 0x3, 0xb8, 0xff, 0xfc, 0x37,
+    0x7f, 0xff, 0xe6, 0x6c, 0xc, 0xe, 0xc1, 0x81, 0x81, 0xc0, 0x3f, 0xff,
+    0xf8, 0x7, 0xff, 0xff, 0x0, 0xc0, 0xc0, 0xe0, 0x1c, 0x18, 0x38, 0x3,
+    0xff, 0xff, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0x7, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xfe, 0x38, 0x6, 0x1, 0xc7, 0x0, 0xc6, 0x18, 0xe1,
+    0xff, 0xe3, 0x1d, 0xff, 0xfe, 0x63, 0x9e, 0x0, 0xcc, 0x70, 0x0, 0xf,
+    0x8e, 0x0, 0x3, 0xf0, 0x80, 0x0, 0x38, 0x0,
+
+    /* U+5BDF */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0xc, 0x0, 0xe, 0x71, 0xfc, 0x7e,
+    0xe7, 0x3f, 0xef, 0xfe, 0x27, 0xf, 0xe, 0x41, 0xe0, 0xf8, 0xe0, 0x39,
+    0xd9, 0xf8, 0x7, 0xf, 0xf, 0x0, 0x6c, 0xe0, 0x78, 0x0, 0x7c, 0x1,
+    0xf0, 0x7, 0xff, 0xff, 0xc1, 0xef, 0xff, 0xbe, 0x7c, 0x0, 0x0, 0xe7,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6,
+    0x0, 0x0, 0x18, 0x61, 0x80, 0x7, 0x86, 0x1e, 0x1, 0xf0, 0x60, 0xfc,
+    0x7c, 0x1e, 0x3, 0xe7, 0x7, 0xe0, 0xe, 0x0, 0x3c, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5BE2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x78, 0x0, 0x1, 0xe7, 0x0, 0x0, 0xe, 0x61, 0x8f, 0xfe,
+    0xe2, 0x18, 0x7f, 0xf4, 0x11, 0x80, 0x7, 0x1, 0x9b, 0xff, 0xfc, 0x19,
+    0x9f, 0xff, 0xc1, 0xf8, 0x0, 0x70, 0x1f, 0x8f, 0xff, 0x0, 0x18, 0xff,
+    0xc0, 0x1, 0x80, 0x0, 0x0, 0x19, 0xff, 0xfc, 0x3f, 0xbf, 0xff, 0xc7,
+    0xfb, 0x0, 0xc, 0x1d, 0xb7, 0xfe, 0xc1, 0x99, 0x7f, 0xfc, 0x19, 0x80,
+    0x6, 0x1, 0x98, 0x39, 0xc0, 0x39, 0x81, 0xf8, 0x3, 0x18, 0x1f, 0x80,
+    0x71, 0x8f, 0xff, 0xc6, 0x1b, 0xf0, 0x7e, 0x0, 0x98, 0x0, 0xe0,
+
+    /* U+5BE6 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0x0, 0x0, 0xe7, 0x3f, 0xff, 0xce, 0x67, 0xff, 0xfe,
+    0x60, 0x60, 0x60, 0x60, 0x7f, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x70, 0xe,
+    0xe, 0x6, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xc0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0,
+    0x7, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+    0x3, 0xe0, 0x7c, 0x7, 0xfe, 0x3, 0xfe, 0x7c, 0x0, 0x1, 0xe0,
+
+    /* U+5BE9 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x70, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x6e, 0x77, 0xff, 0xfe,
+    0xe6, 0xff, 0xff, 0x6, 0x20, 0x6, 0xc, 0x40, 0x30, 0x61, 0xc0, 0x3,
+    0x86, 0x18, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x7, 0xfe,
+    0x0, 0x1, 0xe6, 0x78, 0x0, 0xf8, 0x61, 0xf8, 0x7e, 0x4, 0x7, 0xe7,
+    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x60, 0x30, 0xc, 0x6,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x6, 0x3, 0x0, 0xc0, 0x60, 0x30,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5BEB */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x1, 0x80, 0xe, 0x63, 0xf9, 0xfe,
+    0x66, 0x7e, 0x1f, 0xe6, 0x2e, 0x0, 0x7, 0x40, 0xe0, 0x0, 0x70, 0xf,
+    0xfb, 0xff, 0x0, 0xff, 0x1f, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0,
+    0x70, 0x7, 0xff, 0xfe, 0x0, 0x1e, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xc7, 0x80, 0x0, 0x1c, 0x70, 0x1,
+    0x18, 0xc0, 0x66, 0x31, 0x8c, 0xe, 0x61, 0x8c, 0xc1, 0xc3, 0x18, 0xdc,
+    0x1c, 0x30, 0x83, 0xc1, 0x80, 0x1, 0xf8, 0x0, 0x0, 0x1e, 0x0,
+
+    /* U+5BEE */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0xe, 0x0, 0xe7, 0x0, 0xc0, 0xe, 0x77, 0xff, 0xfe,
+    0xe6, 0xff, 0xff, 0xf6, 0x0, 0x70, 0xe0, 0x1, 0x8e, 0x6, 0x18, 0x1f,
+    0xc0, 0x3f, 0x0, 0x78, 0x1, 0xe0, 0x1f, 0xff, 0xff, 0x87, 0xf0, 0x0,
+    0xfe, 0x66, 0x0, 0x6, 0xe0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0,
+    0x60, 0x0, 0x60, 0x7, 0x0, 0xe, 0x0, 0x7f, 0xff, 0xc0, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0x60, 0x0, 0x3, 0x86, 0x3c, 0x0, 0xf0, 0x61, 0xf0,
+    0x3e, 0xe, 0x7, 0xc7, 0x83, 0xe0, 0x1c, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+5BF6 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0x1, 0x0, 0xe7, 0xff, 0x3f, 0xee, 0x7f, 0xf3, 0xfe,
+    0xe2, 0x30, 0x63, 0x4, 0xf, 0xe7, 0xff, 0x81, 0xfe, 0x7f, 0xfc, 0x3,
+    0x2, 0x31, 0x80, 0x7f, 0x63, 0x18, 0x3f, 0xf3, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0x0, 0x3, 0x81,
+    0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x81, 0xc0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0,
+    0x3, 0xe0, 0x7e, 0x7, 0xfe, 0x3, 0xfe, 0x7c, 0x0, 0x3, 0xe0,
+
+    /* U+5C01 */
+    0x1, 0x0, 0x3, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80, 0x3, 0x0, 0x38,
+    0x0, 0x30, 0x3f, 0xfc, 0x3, 0x3, 0xff, 0xc0, 0x30, 0x1, 0x80, 0x3,
+    0x0, 0x18, 0x3f, 0xfe, 0x1, 0x83, 0xff, 0xe0, 0x38, 0x1f, 0xfc, 0x7f,
+    0xfc, 0x3, 0x7, 0xff, 0xc0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x18, 0x18,
+    0x30, 0x1, 0x81, 0xc3, 0x0, 0x18, 0xe, 0x30, 0x3f, 0xf8, 0xe3, 0x7,
+    0xff, 0xc7, 0x30, 0x3, 0x80, 0x33, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80,
+    0x3, 0x0, 0x18, 0xc0, 0x30, 0x7, 0xfe, 0x3, 0x7, 0xff, 0x80, 0x30,
+    0x7f, 0x0, 0x3f, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+5C07 */
+    0x0, 0x80, 0x40, 0x0, 0x1c, 0x1c, 0x0, 0x31, 0xc3, 0xc0, 0x3, 0x1c,
+    0x7f, 0xfe, 0x31, 0xcf, 0xff, 0xe3, 0x1d, 0xc0, 0x1c, 0x31, 0xf8, 0xe3,
+    0x83, 0x1c, 0x47, 0xf0, 0x3f, 0xc6, 0x1e, 0x3, 0xfc, 0x39, 0xc0, 0xf,
+    0xc1, 0xf8, 0x0, 0x1c, 0x3e, 0x30, 0x1, 0xdf, 0x87, 0x0, 0x1d, 0xc0,
+    0x70, 0x7f, 0xc0, 0x7, 0x7, 0xfd, 0xff, 0xfe, 0x19, 0xdf, 0xff, 0xe1,
+    0x9c, 0x0, 0x70, 0x19, 0xc0, 0x7, 0x1, 0x9c, 0x60, 0x70, 0x19, 0xc7,
+    0x7, 0x3, 0x9c, 0x38, 0x70, 0x31, 0xc1, 0x87, 0x7, 0x1c, 0x0, 0x70,
+    0x61, 0xc0, 0x3f, 0x6, 0x1c, 0x3, 0xe0, 0x0, 0x80, 0x38, 0x0,
+
+    /* U+5C08 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0xe0, 0x0, 0x7, 0xff, 0xfc,
+    0x1, 0xff, 0xff, 0xf0, 0x1c, 0xe, 0x3, 0x1, 0x80, 0xe0, 0x38, 0x1f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x18, 0x6, 0x3, 0x81, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xe0, 0xe0, 0x0, 0xe, 0xf, 0x7,
+    0xff, 0xff, 0xfc, 0x7f, 0xfe, 0x38, 0xc0, 0x0, 0x1, 0x80, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x1, 0x0, 0x38, 0x0, 0x18, 0x1, 0x80,
+    0x1, 0xc0, 0x18, 0x0, 0xc, 0x3, 0x80, 0x0, 0x43, 0xf8, 0x0, 0x0,
+    0x1f, 0x0,
+
+    /* U+5C0B */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x70, 0x1f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x8f, 0xf8, 0x3f, 0xf9, 0xff, 0xc0, 0x38, 0x18,
+    0xc, 0x3, 0x81, 0x80, 0xc0, 0x3f, 0xdf, 0xfc, 0x7f, 0xf9, 0xff, 0xc3,
+    0xc0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0x10, 0x1, 0xc0, 0x3, 0xc0, 0x1c, 0x0, 0x1e, 0x1, 0xc0,
+    0x0, 0xe1, 0xfc, 0x0, 0x6, 0x1f, 0x80, 0x0, 0x1, 0xf0, 0x0,
+
+    /* U+5C0D */
+    0x6, 0x20, 0x1, 0x0, 0x66, 0x0, 0x30, 0x66, 0x66, 0x3, 0x7, 0x66,
+    0x60, 0x30, 0x36, 0x6e, 0x3, 0x3, 0x66, 0xc0, 0x30, 0x6, 0x60, 0x3,
+    0x7, 0xff, 0xe7, 0xfc, 0x7f, 0xfe, 0xff, 0xe0, 0xc3, 0x8f, 0xfe, 0xc,
+    0x30, 0x3, 0x0, 0xc3, 0x0, 0x30, 0xc, 0x30, 0x83, 0x3, 0xff, 0xcc,
+    0x30, 0x7f, 0xfe, 0xe3, 0x1, 0xff, 0x86, 0x30, 0x1, 0x80, 0x73, 0x0,
+    0x18, 0x3, 0x30, 0x3f, 0xfc, 0x33, 0x3, 0xff, 0xc0, 0x30, 0x1, 0xc0,
+    0x3, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80, 0x3, 0x3, 0xff, 0xf0, 0x30,
+    0x7f, 0xfe, 0x3f, 0x7, 0x80, 0x3, 0xf0, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+5C0E */
+    0x8, 0xc, 0x4, 0x1, 0xe0, 0xe0, 0xc0, 0xf, 0x3f, 0xff, 0xc0, 0x27,
+    0xff, 0xfe, 0x0, 0x0, 0xc0, 0x3, 0xc0, 0xff, 0xf0, 0x1e, 0x3f, 0xff,
+    0x80, 0x63, 0x80, 0x18, 0x0, 0x3f, 0xff, 0x87, 0xc3, 0xff, 0xf8, 0x7e,
+    0x30, 0x1, 0x80, 0xe3, 0xff, 0xf8, 0x6, 0x30, 0x1, 0x80, 0x63, 0xff,
+    0xf8, 0x7, 0x1f, 0xff, 0x83, 0xfc, 0x0, 0x0, 0x78, 0xff, 0xff, 0xe6,
+    0x3, 0xff, 0xfe, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x7f, 0xff,
+    0xff, 0xe3, 0xff, 0xff, 0xfc, 0x1, 0x80, 0xc, 0x0, 0x1c, 0x1, 0xc0,
+    0x0, 0xe0, 0x3c, 0x0, 0x6, 0xf, 0x80, 0x0, 0x0, 0xf8, 0x0,
+
+    /* U+5C0F */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x80, 0x7, 0x6, 0xc,
+    0x0, 0x60, 0x60, 0xc0, 0x6, 0x6, 0xe, 0x0, 0x60, 0x60, 0x60, 0xe,
+    0x6, 0x7, 0x0, 0xe0, 0x60, 0x70, 0xc, 0x6, 0x3, 0x81, 0xc0, 0x60,
+    0x38, 0x1c, 0x6, 0x3, 0x81, 0x80, 0x60, 0x1c, 0x38, 0x6, 0x1, 0xc3,
+    0x80, 0x60, 0x1c, 0x30, 0x6, 0x0, 0xe7, 0x0, 0x60, 0xe, 0x60, 0x6,
+    0x0, 0x60, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5C11 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x3, 0x6, 0x18, 0x0, 0x30, 0x61, 0xc0, 0x7, 0x6, 0xf,
+    0x0, 0x70, 0x60, 0x78, 0xe, 0x6, 0x3, 0x80, 0xe0, 0x60, 0x1c, 0x1c,
+    0x6, 0x0, 0xe3, 0xc0, 0x60, 0x6, 0x38, 0x6, 0x0, 0x7, 0x0, 0x60,
+    0x0, 0x70, 0x6, 0x3, 0x4, 0x0, 0x60, 0x70, 0x0, 0x6, 0xe, 0x0,
+    0x7, 0xe1, 0xe0, 0x0, 0x7e, 0x1c, 0x0, 0x3, 0x7, 0x80, 0x0, 0x0,
+    0xf0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0xf, 0x80, 0x0, 0xf, 0xf0, 0x0,
+    0x3f, 0xfc, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5C31 */
+    0x1, 0x0, 0x10, 0x0, 0x18, 0x3, 0x0, 0x3, 0x80, 0x33, 0x3, 0xff,
+    0xc3, 0x18, 0x7f, 0xfe, 0x31, 0xc7, 0xff, 0xc3, 0x0, 0x0, 0x1, 0xff,
+    0x80, 0x0, 0x3f, 0xfe, 0x3f, 0xfb, 0xff, 0xc3, 0xff, 0x83, 0x0, 0x30,
+    0x1c, 0x30, 0x3, 0x1, 0xc3, 0x0, 0x30, 0x1c, 0x7c, 0x3, 0x83, 0x87,
+    0xc0, 0x3f, 0xf8, 0x7c, 0x0, 0xff, 0x6, 0xc0, 0x1, 0x80, 0x6c, 0x1,
+    0x99, 0x8e, 0xc0, 0x19, 0x98, 0xcc, 0x3, 0x19, 0xcc, 0xc0, 0x31, 0x8d,
+    0xcc, 0x67, 0x18, 0x38, 0xc6, 0x61, 0x87, 0x8c, 0x64, 0x18, 0x70, 0xe6,
+    0xf, 0x8e, 0xf, 0xe0, 0xf1, 0xc0, 0xfc, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5C39 */
+    0xf, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0x1,
+    0x80, 0x70, 0x0, 0x18, 0x3, 0x0, 0x1, 0x80, 0x30, 0x0, 0x18, 0x3,
+    0x0, 0x1, 0xc0, 0x70, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0,
+    0x18, 0x3, 0x0, 0x1, 0x80, 0x30, 0x0, 0x18, 0x3, 0x0, 0x1, 0x80,
+    0x30, 0x0, 0x18, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xc0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0x1e, 0x0, 0x0, 0x7, 0x80, 0x0, 0x3, 0xf0, 0x0, 0x0,
+    0x7c, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
+
+    /* U+5C3C */
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc1, 0xc0,
+    0x0, 0x1c, 0x18, 0x0, 0x1, 0xc1, 0x80, 0x0, 0x1c, 0x18, 0x0, 0x1,
+    0xc1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0x80, 0x0, 0x0, 0x18,
+    0x30, 0x0, 0x1, 0x83, 0x0, 0x0, 0x18, 0x30, 0x7, 0x1, 0x83, 0x3,
+    0xf0, 0x18, 0x33, 0xfc, 0x1, 0x83, 0xfe, 0x0, 0x18, 0x3e, 0x0, 0x3,
+    0x83, 0x0, 0x0, 0x38, 0x30, 0x0, 0x3, 0x83, 0x0, 0x6, 0x30, 0x30,
+    0x0, 0xe7, 0x3, 0x0, 0xe, 0x70, 0x3c, 0x3, 0xe6, 0x3, 0xff, 0xfc,
+    0x60, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+5C3E */
+    0x7, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x1, 0xc1, 0x80,
+    0x0, 0x1c, 0x18, 0x0, 0x1, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0x81, 0x80, 0x0, 0x0, 0x18, 0x0, 0x3f, 0x1, 0x8f, 0xff, 0xf0, 0x19,
+    0xff, 0xe0, 0x1, 0x80, 0x60, 0x0, 0x18, 0x6, 0x7, 0x81, 0x83, 0xff,
+    0xf8, 0x19, 0xff, 0xfc, 0x1, 0x9c, 0x60, 0x0, 0x38, 0x6, 0x0, 0x3,
+    0x80, 0x7f, 0xfe, 0x3b, 0xff, 0xff, 0xc3, 0x3f, 0xf0, 0x0, 0x30, 0x6,
+    0x0, 0x67, 0x0, 0x60, 0x6, 0x70, 0x7, 0x0, 0xe6, 0x0, 0x7f, 0xfe,
+    0x40, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+5C40 */
+    0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x70, 0x0, 0xe, 0xc, 0x0,
+    0x0, 0xe1, 0x80, 0x0, 0x1c, 0x38, 0x0, 0x7, 0x7, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xf8, 0x18, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xfe, 0xf, 0xff, 0xff, 0xe1, 0x80, 0x0, 0x1c, 0x30, 0x0, 0x1, 0x86,
+    0x1f, 0xf8, 0x30, 0xc7, 0xff, 0x86, 0x38, 0xe0, 0x70, 0xc7, 0x18, 0x6,
+    0x18, 0xe3, 0x0, 0xc3, 0x1c, 0x60, 0x18, 0x63, 0xf, 0xff, 0xc, 0xe1,
+    0xff, 0xc3, 0x9c, 0x0, 0x0, 0x73, 0x0, 0x0, 0xfc, 0x60, 0x0, 0x1f,
+    0x80, 0x0, 0x3, 0xc0,
+
+    /* U+5C45 */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0x80,
+    0x0, 0x1c, 0x18, 0x0, 0x1, 0xc1, 0x80, 0x0, 0x1c, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x18, 0x1, 0x80, 0x1, 0x80, 0x18, 0x0, 0x18,
+    0x1, 0x80, 0x1, 0xbf, 0xff, 0xfe, 0x1b, 0xff, 0xff, 0xe1, 0x80, 0x18,
+    0x0, 0x18, 0x1, 0x80, 0x1, 0x80, 0x18, 0x0, 0x38, 0x7f, 0xfe, 0x3,
+    0x8f, 0xff, 0xf8, 0x39, 0xc0, 0x3, 0x83, 0x9c, 0x0, 0x18, 0x31, 0xc0,
+    0x1, 0x87, 0x1c, 0x0, 0x18, 0x71, 0xc0, 0x3, 0x86, 0xf, 0xff, 0xf8,
+    0x60, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5C46 */
+    0x7, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xfc, 0x60, 0x0,
+    0x7, 0x18, 0x0, 0x1, 0xc6, 0x0, 0x0, 0x71, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xfe, 0x18, 0x0, 0x0, 0x6, 0x0, 0x60, 0x1, 0x98, 0x18, 0xc,
+    0x66, 0x6, 0x3, 0x19, 0x81, 0x80, 0xc6, 0x67, 0xff, 0x31, 0x99, 0xff,
+    0xcc, 0x66, 0x6, 0x3, 0x19, 0x81, 0x80, 0xce, 0x60, 0x60, 0x33, 0x98,
+    0x18, 0xc, 0xc6, 0xff, 0xf3, 0x31, 0x9f, 0xfc, 0xdc, 0x60, 0x0, 0x37,
+    0x1c, 0x0, 0x1d, 0x87, 0xff, 0xff, 0x60, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+5C4B */
+    0x7, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x1, 0xc1, 0x80,
+    0x0, 0x1c, 0x18, 0x0, 0x1, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0x81, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfc, 0x19,
+    0xff, 0xff, 0xc1, 0x80, 0xc0, 0x80, 0x18, 0x1c, 0xe, 0x1, 0x81, 0x80,
+    0xf0, 0x19, 0xff, 0xff, 0xc1, 0x9f, 0xfc, 0xc, 0x18, 0x1, 0x80, 0x43,
+    0x80, 0x18, 0x0, 0x38, 0xff, 0xff, 0x83, 0x8f, 0xff, 0xf8, 0x30, 0x1,
+    0x80, 0x7, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x6, 0x7f, 0xff, 0xfe,
+    0x67, 0xff, 0xff, 0xe0,
+
+    /* U+5C55 */
+    0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xfc, 0x1c, 0x0, 0x1, 0xc1, 0x80,
+    0x0, 0xc, 0x18, 0x0, 0x1, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0x81, 0x83, 0x3, 0x0, 0x18, 0x30, 0x30, 0x1, 0x83, 0x83, 0x80, 0x1b,
+    0xff, 0xff, 0xc1, 0x83, 0x83, 0x80, 0x18, 0x30, 0x30, 0x1, 0x83, 0x3,
+    0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x38, 0xe3, 0x80, 0x3,
+    0x8e, 0x1c, 0x18, 0x38, 0xe0, 0xc7, 0x83, 0xe, 0xe, 0xf0, 0x30, 0xe0,
+    0x7c, 0x7, 0xe, 0x13, 0xc0, 0x70, 0xff, 0x9f, 0x6, 0x1f, 0xf0, 0x7c,
+    0x67, 0xf8, 0x3, 0xe0, 0x38, 0x0, 0xe,
+
+    /* U+5C64 */
+    0xf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x18, 0x0, 0x0, 0xc1, 0x80,
+    0x0, 0xc, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x18, 0x0, 0x0,
+    0x1, 0x83, 0x1f, 0xc0, 0x18, 0x70, 0xfe, 0x1, 0x9e, 0x0, 0x38, 0x1b,
+    0xff, 0xff, 0xe1, 0xbf, 0xff, 0xfe, 0x19, 0xc9, 0x93, 0x81, 0x8c, 0x99,
+    0x18, 0x18, 0xc9, 0x93, 0x81, 0x8f, 0xff, 0xf0, 0x38, 0x7f, 0xfe, 0x3,
+    0x80, 0x0, 0x0, 0x38, 0x7f, 0xfe, 0x3, 0x7, 0xff, 0xf0, 0x70, 0xe0,
+    0x3, 0x7, 0xf, 0xff, 0xf0, 0x70, 0xe0, 0x3, 0x6, 0x7, 0xff, 0xf0,
+    0x60, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5C6C */
+    0xf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x60, 0x0, 0x7, 0xf, 0xff,
+    0xff, 0xe1, 0xff, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x6, 0x7e, 0x4f, 0xe0,
+    0xc0, 0xc, 0x0, 0x19, 0xf9, 0x3f, 0x83, 0x0, 0x0, 0x0, 0x67, 0xff,
+    0xfe, 0xd, 0xc6, 0x38, 0xe1, 0xb0, 0xc3, 0xc, 0x33, 0xff, 0xff, 0x6,
+    0x38, 0x0, 0x0, 0xcf, 0xff, 0xfc, 0x1b, 0xff, 0xff, 0xc7, 0xe0, 0xe0,
+    0x18, 0xe3, 0xff, 0xe3, 0x18, 0x63, 0x6, 0x63, 0xf, 0xff, 0xcc, 0xe0,
+    0xff, 0xf1, 0x9c, 0x1, 0x8c, 0x33, 0xf, 0xff, 0xce, 0x43, 0xfe, 0xf,
+    0xc0, 0x0, 0x0, 0x70,
+
+    /* U+5C6F */
+    0x0, 0x8, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x70, 0x1c, 0x0, 0xe,
+    0xff, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xfe, 0x0, 0x1c, 0x7, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x10, 0x1c, 0x6, 0x6, 0x3, 0x80, 0xe0, 0xe0, 0x70,
+    0x1c, 0x1c, 0xe, 0x3, 0x83, 0x81, 0xc0, 0x70, 0x70, 0x38, 0xe, 0xe,
+    0x7, 0x1, 0xc1, 0xc0, 0xe0, 0x38, 0x3f, 0xff, 0xfe, 0x3, 0xff, 0xff,
+    0xc0, 0x0, 0x70, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1, 0xc0, 0xc, 0x0,
+    0x38, 0x1, 0x80, 0x7, 0x0, 0x70, 0x0, 0xf0, 0x1e, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5C71 */
+    0x0, 0x10, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x18, 0x0, 0x40, 0x18, 0x2, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0x7f, 0xff, 0xfe,
+    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+
+    /* U+5CA1 */
+    0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xdc, 0x0, 0x10,
+    0x6c, 0x38, 0x1c, 0x36, 0xc, 0xc, 0x1b, 0x7, 0xe, 0xd, 0x81, 0x6,
+    0x6, 0xcf, 0xff, 0xf3, 0x67, 0xff, 0xfd, 0xb0, 0x6, 0x0, 0xd8, 0x3,
+    0x0, 0x6c, 0x61, 0x86, 0x36, 0x30, 0xc3, 0x1b, 0x18, 0x61, 0x8d, 0x8c,
+    0x30, 0xc6, 0xc6, 0x18, 0x63, 0x63, 0xc, 0x31, 0xb1, 0x86, 0x18, 0xd8,
+    0xe3, 0x1c, 0x6c, 0x7f, 0xfe, 0x36, 0x1f, 0xfe, 0x1b, 0x0, 0x0, 0x1d,
+    0x80, 0x0, 0x7e, 0xc0, 0x0, 0x3f, 0x20, 0x0, 0x1e, 0x0,
+
+    /* U+5CA9 */
+    0x0, 0x6, 0x0, 0x1, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80,
+    0x60, 0x18, 0x1c, 0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xf8, 0x1f, 0x80, 0x3, 0x83, 0xd8, 0x0, 0x18, 0x79, 0x80,
+    0x1, 0x86, 0x18, 0x0, 0x18, 0x1, 0x80, 0x1, 0x80, 0x1c, 0x0, 0x38,
+    0x1, 0xff, 0xff, 0x80, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5CB3 */
+    0x0, 0x0, 0xe, 0x0, 0x0, 0x3f, 0xe0, 0x3, 0xff, 0xfc, 0x0, 0x7f,
+    0xf8, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xc0, 0x70, 0x3, 0x80, 0x6,
+    0x0, 0x38, 0x0, 0x60, 0x3, 0x80, 0x6, 0x0, 0x38, 0x0, 0x60, 0x3,
+    0x80, 0x7, 0x0, 0x38, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x60, 0x0, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x18, 0x6,
+    0x1, 0x81, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0xc0, 0xe0, 0x38,
+    0x1f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5CB8 */
+    0x0, 0x6, 0x0, 0x1, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80,
+    0x60, 0x18, 0x1c, 0xe, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x1f,
+    0xff, 0xff, 0xe1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x8f, 0xff,
+    0xf0, 0x39, 0xff, 0xff, 0x83, 0x8f, 0xff, 0xf0, 0x38, 0x1, 0x80, 0x3,
+    0x80, 0x18, 0x0, 0x38, 0x3, 0x80, 0x3, 0xff, 0xff, 0xfe, 0x33, 0xff,
+    0xff, 0xe3, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x0, 0x18, 0x0,
+    0x60, 0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0,
+
+    /* U+5CE8 */
+    0xc, 0x0, 0x10, 0x1, 0x80, 0x76, 0x0, 0x30, 0xfe, 0xc8, 0x6, 0x3f,
+    0x19, 0x80, 0xc0, 0x63, 0x38, 0x99, 0xc, 0x63, 0x33, 0x31, 0x8c, 0x26,
+    0x66, 0x31, 0x80, 0xcc, 0xdf, 0xff, 0x99, 0x9f, 0xff, 0xfb, 0x33, 0x7f,
+    0xfe, 0x66, 0x63, 0x18, 0xc, 0xcc, 0x63, 0x89, 0x99, 0x8c, 0x33, 0x33,
+    0x31, 0xa6, 0xe6, 0x66, 0x3e, 0xd8, 0xcc, 0xff, 0x9b, 0x19, 0x9f, 0xc3,
+    0xc3, 0x33, 0x18, 0x78, 0x66, 0x63, 0xe, 0x7, 0xf8, 0x61, 0xc0, 0xff,
+    0xc, 0x78, 0x8f, 0xc1, 0x9f, 0xb0, 0x0, 0x37, 0x3e, 0x0, 0x3e, 0xc3,
+    0xc0, 0x7, 0xc0, 0x78, 0x0, 0x60, 0x0, 0x0,
+
+    /* U+5CF0 */
+    0x4, 0x0, 0x80, 0x1, 0x80, 0x70, 0x0, 0x30, 0xe, 0x0, 0x6, 0x3,
+    0xff, 0x80, 0xc0, 0xf0, 0x70, 0xd9, 0xbf, 0xc, 0x1b, 0x36, 0x67, 0x3,
+    0x67, 0x87, 0xc0, 0x6c, 0xc0, 0xf0, 0xd, 0x98, 0x3f, 0x81, 0xb3, 0x1e,
+    0x7e, 0x36, 0x6f, 0x3, 0xe6, 0xcf, 0xc6, 0x1c, 0xd9, 0x80, 0xc0, 0x1b,
+    0x33, 0xff, 0xe3, 0x66, 0x7f, 0xf8, 0x6c, 0xc0, 0x60, 0xd, 0x98, 0xff,
+    0xc1, 0xb3, 0x3f, 0xfc, 0x36, 0x60, 0x30, 0x7, 0xfc, 0x6, 0x0, 0xff,
+    0xbf, 0xff, 0x8f, 0xe7, 0xff, 0xf0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0,
+
+    /* U+5CF6 */
+    0x0, 0x18, 0x0, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x7f, 0xff,
+    0xf8, 0x18, 0x0, 0xe, 0x6, 0x0, 0x1, 0x81, 0xff, 0xff, 0xe0, 0x7f,
+    0xff, 0xf8, 0x18, 0x0, 0x6, 0x6, 0x0, 0x3, 0x81, 0xff, 0xff, 0xe0,
+    0x60, 0x0, 0x0, 0x18, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe1, 0xff, 0xff,
+    0xf8, 0x60, 0x0, 0x0, 0x18, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xfc, 0x3, 0x80, 0x7, 0x60, 0xe0, 0xe1, 0xd8, 0x38, 0x38, 0x77,
+    0xe, 0xe, 0x1d, 0xff, 0xff, 0x7, 0x3f, 0xff, 0xcf, 0x80, 0x0, 0x7,
+    0xe0, 0x0, 0x1, 0xe0,
+
+    /* U+5CFD */
+    0xc, 0x0, 0x40, 0x1, 0x80, 0x1c, 0x0, 0x30, 0x3, 0x80, 0x6, 0x0,
+    0x70, 0x0, 0xc1, 0xff, 0xf8, 0xd9, 0xff, 0xff, 0xbb, 0x37, 0xff, 0xe7,
+    0x66, 0x7, 0x0, 0xec, 0xc4, 0xe3, 0x1d, 0x99, 0x9c, 0x63, 0xb3, 0x33,
+    0x98, 0x76, 0x66, 0x73, 0xe, 0xcd, 0xce, 0x71, 0xd9, 0xbd, 0x9f, 0x3b,
+    0x37, 0xf3, 0x67, 0x67, 0xdf, 0xee, 0xec, 0xf0, 0xf8, 0xdd, 0x9e, 0x3e,
+    0x3, 0xb3, 0x6, 0xc0, 0x76, 0x61, 0xcc, 0x7, 0xfc, 0x31, 0xc0, 0xff,
+    0xc, 0x1c, 0xf, 0xc7, 0x83, 0xc0, 0x3, 0xc0, 0x3c, 0x0, 0xf0, 0x3,
+    0xc0, 0x3c, 0x0, 0x38, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+5D19 */
+    0x0, 0x6, 0x0, 0x1, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80,
+    0x60, 0x18, 0x1c, 0xe, 0x3, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x0, 0x3, 0xf8, 0x0, 0x0, 0x79, 0xe0, 0x0, 0x1e, 0xf, 0x80, 0x7,
+    0xc0, 0x3e, 0x3, 0xff, 0xff, 0xfc, 0x7c, 0xff, 0xf3, 0xe7, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81,
+    0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x1f, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xf8, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18,
+    0x18, 0x70, 0xc7, 0x81, 0x83, 0xc, 0xf8, 0x18, 0x20, 0xe, 0x0,
+
+    /* U+5D22 */
+    0x4, 0x0, 0x1, 0x81, 0x80, 0x7f, 0xf0, 0x30, 0x7f, 0xfc, 0x6, 0x7,
+    0x80, 0x40, 0xc0, 0x46, 0x18, 0xd9, 0x8c, 0xc3, 0x1b, 0x31, 0x9c, 0xc3,
+    0x66, 0x31, 0x98, 0x6c, 0xc2, 0x12, 0xd, 0x99, 0xff, 0xc1, 0xb3, 0x3f,
+    0xfc, 0x36, 0x60, 0x71, 0xc6, 0xcc, 0x6, 0x38, 0xd9, 0x81, 0xc7, 0x1b,
+    0x37, 0xff, 0xf3, 0x66, 0xff, 0xfe, 0x6c, 0xc0, 0x63, 0x8d, 0x98, 0xc,
+    0x71, 0xb3, 0x3, 0x8e, 0x36, 0x67, 0xff, 0x87, 0xfc, 0xff, 0xe0, 0xff,
+    0x80, 0xc0, 0xf, 0xc0, 0x18, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0xf8, 0x0, 0x0, 0x1e, 0x0, 0x0,
+
+    /* U+5D34 */
+    0x0, 0x6, 0x0, 0x1, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80,
+    0x60, 0x18, 0x1c, 0xe, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xfe,
+    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0xe7, 0x0, 0xff, 0xff, 0xfc, 0x1f,
+    0xff, 0xff, 0xc1, 0x80, 0xe, 0x0, 0x18, 0x0, 0x60, 0x81, 0xbf, 0xf6,
+    0x18, 0x19, 0xff, 0x63, 0x81, 0x8e, 0x6, 0x38, 0x1b, 0xfe, 0x73, 0x1,
+    0xbf, 0xe3, 0x70, 0x19, 0xc6, 0x3e, 0x3, 0x98, 0x63, 0xc0, 0x39, 0xc6,
+    0x1c, 0x3, 0x1f, 0xc3, 0xc6, 0x30, 0x7f, 0x3c, 0x67, 0x7, 0xff, 0x66,
+    0x61, 0xe1, 0xe7, 0xe6, 0x3c, 0x38, 0x3c, 0x0, 0x3, 0x0, 0x80,
+
+    /* U+5DBC */
+    0x8, 0x0, 0x80, 0x1, 0x80, 0xd0, 0x0, 0x30, 0x7b, 0xfe, 0x6, 0x1c,
+    0x7b, 0xc0, 0xc3, 0xc, 0x19, 0x9b, 0x61, 0x3, 0x33, 0x6e, 0x30, 0x66,
+    0x6d, 0xf7, 0x3c, 0xcd, 0xbe, 0xf7, 0x99, 0xb7, 0x6, 0x33, 0x36, 0xe0,
+    0xc6, 0x66, 0xdc, 0x58, 0xcc, 0xdb, 0xdb, 0x79, 0x9b, 0x3f, 0x7f, 0x33,
+    0x66, 0x6c, 0x66, 0x6c, 0xcd, 0x8c, 0xcd, 0x98, 0xb1, 0x99, 0xb3, 0x6,
+    0x33, 0x37, 0xff, 0xff, 0x66, 0xff, 0xff, 0xef, 0xf8, 0x0, 0x0, 0xff,
+    0x4, 0x10, 0xf, 0xc3, 0x83, 0x80, 0x1, 0xf0, 0x78, 0x0, 0x78, 0x7,
+    0xc0, 0x1e, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5DDD */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x60, 0xe0, 0x30, 0x1c, 0x38, 0x1c,
+    0x7, 0xe, 0x7, 0x1, 0xc3, 0x81, 0xc0, 0x70, 0xe0, 0x70, 0x1c, 0x38,
+    0x1c, 0x7, 0xe, 0x7, 0x1, 0xc3, 0x81, 0xc0, 0x70, 0xe0, 0x70, 0x1c,
+    0x30, 0x1c, 0x7, 0xc, 0x7, 0x1, 0xc3, 0x1, 0xc0, 0x70, 0xc0, 0x70,
+    0x1c, 0x30, 0x1c, 0x7, 0xc, 0x7, 0x1, 0xc3, 0x1, 0xc0, 0x71, 0xc0,
+    0x70, 0x1c, 0x70, 0x1c, 0x7, 0x1c, 0x7, 0x1, 0xce, 0x1, 0xc0, 0x73,
+    0x80, 0x70, 0x1d, 0xc0, 0x0, 0x7, 0x70, 0x0, 0x1, 0xd8, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x8,
+
+    /* U+5DDE */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x30, 0x18, 0x6, 0x6, 0x3, 0x0, 0xc0,
+    0xc0, 0x60, 0x18, 0x18, 0xc, 0x7, 0x3, 0x1, 0x80, 0xe0, 0x60, 0x31,
+    0x9d, 0xc, 0x86, 0x33, 0xb1, 0x98, 0xc6, 0x76, 0x33, 0x18, 0xce, 0xc6,
+    0x63, 0x19, 0xcc, 0xcc, 0x63, 0x39, 0x98, 0xcc, 0x67, 0x33, 0x19, 0x98,
+    0xc6, 0x63, 0x33, 0x18, 0x6c, 0x66, 0x63, 0x9, 0x84, 0xc0, 0x60, 0x30,
+    0x18, 0x1c, 0x6, 0x3, 0x3, 0x80, 0xc0, 0x60, 0xe0, 0x18, 0xc, 0x1c,
+    0x3, 0x1, 0x87, 0x0, 0x60, 0x31, 0xe0, 0xc, 0x6, 0x78, 0x1, 0x80,
+    0xce, 0x0, 0x0, 0x18, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+5DE1 */
+    0x0, 0x0, 0x0, 0x7, 0x1, 0x84, 0x10, 0xf0, 0x71, 0x86, 0xf, 0xc,
+    0x71, 0xc0, 0x3, 0x8e, 0x38, 0x0, 0x63, 0x8e, 0x10, 0x1c, 0x71, 0xc7,
+    0x83, 0x8c, 0x30, 0x78, 0xe3, 0x8e, 0x3, 0x1c, 0x61, 0x80, 0x3, 0x1c,
+    0x70, 0x0, 0x63, 0x8e, 0x0, 0xe, 0x30, 0xc0, 0xe1, 0xc7, 0x1c, 0x3f,
+    0x1c, 0x61, 0x83, 0xe3, 0x8e, 0x38, 0xc, 0x39, 0xc3, 0x1, 0x87, 0x1c,
+    0x70, 0x30, 0x63, 0x8e, 0x6, 0xe, 0x30, 0xe0, 0xc0, 0xc6, 0x1c, 0x18,
+    0x0, 0x0, 0xf, 0xc0, 0x0, 0x3, 0xff, 0x0, 0x0, 0xf1, 0xff, 0xff,
+    0xc8, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5DE5 */
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+
+    /* U+5DE6 */
+    0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xc0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1,
+    0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x3b, 0xff,
+    0xf8, 0x3, 0xbf, 0xff, 0x80, 0x70, 0xc, 0x0, 0x7, 0x0, 0xc0, 0x0,
+    0xe0, 0xc, 0x0, 0x1e, 0x0, 0xc0, 0x1, 0xc0, 0xc, 0x0, 0x38, 0x0,
+    0xc0, 0x7, 0x80, 0xc, 0x0, 0x70, 0x0, 0xc0, 0x6, 0x1f, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+5DE7 */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x7f, 0xdf, 0xff, 0xe7, 0xfc,
+    0x18, 0x0, 0x6, 0x1, 0x80, 0x0, 0x60, 0x38, 0x0, 0x6, 0x3, 0x80,
+    0x0, 0x60, 0x30, 0x0, 0x6, 0x3, 0x0, 0x0, 0x60, 0x30, 0x0, 0x6,
+    0x7, 0xff, 0x0, 0x60, 0x3f, 0xfc, 0x6, 0x0, 0x3, 0xc0, 0x60, 0x0,
+    0xc, 0x6, 0x0, 0x0, 0xc0, 0x60, 0x0, 0xc, 0x6, 0x0, 0x0, 0xc0,
+    0x7e, 0x0, 0x1c, 0x1f, 0xe0, 0x1, 0xc7, 0xf8, 0x0, 0x1c, 0x7c, 0x0,
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x80, 0x0, 0x7, 0xf0,
+    0x0, 0x0, 0x7f, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+5DE8 */
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x30, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x3f,
+    0xff, 0xf0, 0xf, 0xff, 0xfe, 0x3, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x60,
+    0x30, 0x0, 0x18, 0xc, 0x0, 0x6, 0x3, 0x0, 0x1, 0x80, 0xc0, 0x0,
+    0x60, 0x3f, 0xff, 0xf8, 0xf, 0xff, 0xfe, 0x3, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x80,
+
+    /* U+5DEE */
+    0x0, 0x80, 0x10, 0x0, 0x1c, 0x3, 0x80, 0x0, 0xc0, 0x30, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
+    0x33, 0xff, 0xf0, 0x7, 0x7f, 0xff, 0x80, 0x60, 0x1c, 0x0, 0xe, 0x1,
+    0xc0, 0x1, 0xc0, 0x1c, 0x0, 0x3c, 0x1, 0xc0, 0x7, 0x80, 0x1c, 0x0,
+    0x73, 0xff, 0xff, 0xe6, 0x3f, 0xff, 0xfe,
+
+    /* U+5DF1 */
+    0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x30, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0xe, 0x0, 0x0, 0x7, 0x3, 0xff, 0xff, 0xc1,
+    0xff, 0xff, 0xf0, 0x70, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0x1, 0xc0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x19, 0xc0, 0x0, 0xe, 0x70, 0x0, 0x3, 0x9c, 0x0, 0x0, 0xe7,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xf8, 0x0,
+
+    /* U+5DF4 */
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe1, 0xc0, 0x60,
+    0x38, 0x60, 0x18, 0xe, 0x18, 0x6, 0x3, 0x86, 0x1, 0x80, 0xe1, 0x80,
+    0x60, 0x38, 0x60, 0x18, 0xe, 0x18, 0x6, 0x3, 0x87, 0x3, 0x80, 0xe1,
+    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xfc, 0x18, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x1, 0x80, 0x0, 0x0, 0x60, 0x0, 0x0, 0x18, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x3, 0x9c, 0x0, 0x0, 0xe7,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xfc, 0x0,
+
+    /* U+5DF7 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70, 0x1, 0xff,
+    0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x1c, 0x3, 0x0, 0x3, 0x80, 0x38, 0x0, 0x38, 0x1,
+    0xc0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0x0, 0x3b, 0xe7,
+    0x70, 0x3, 0x8e, 0x67, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x8, 0x7, 0x0, 0x1, 0xc0, 0x70, 0x0, 0x38,
+    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5DFE */
+    0x0, 0x10, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x18, 0x0, 0x3f, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x3f, 0xe0, 0x18, 0x7e, 0x60, 0x18, 0x7c, 0x0, 0x18, 0x0,
+    0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+5E02 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x1e, 0xe, 0x7, 0x81, 0xc0, 0x60,
+    0x38, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81,
+    0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6,
+    0x3, 0x81, 0xc0, 0x60, 0x78, 0x1c, 0x6, 0x3f, 0x1, 0x80, 0x63, 0xf0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5E03 */
+    0x0, 0x8, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3,
+    0x80, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x60, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x1, 0xc3, 0x0, 0x0, 0x18, 0x30, 0x0, 0x3,
+    0x83, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xf8, 0x3f, 0x3, 0x1, 0x87, 0x30, 0x30, 0x18, 0x63, 0x3, 0x1, 0x80,
+    0x30, 0x30, 0x18, 0x3, 0x3, 0x1, 0x80, 0x30, 0x30, 0x18, 0x3, 0x3,
+    0x1, 0x80, 0x30, 0x30, 0x18, 0x3, 0x3, 0xf, 0x80, 0x30, 0x31, 0xf8,
+    0x2, 0x3, 0xe, 0x0, 0x0, 0x30, 0x0, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+5E2B */
+    0x4, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x7f, 0xff, 0xf, 0xf,
+    0xff, 0xe7, 0xf8, 0x7, 0x0, 0xff, 0x80, 0xe0, 0x18, 0x30, 0x1c, 0x3,
+    0x6, 0x3, 0x80, 0x60, 0xcf, 0xff, 0xc, 0x39, 0xff, 0xf1, 0xff, 0x31,
+    0xc6, 0x3f, 0xc6, 0x38, 0xc7, 0xf0, 0xc7, 0x18, 0xc0, 0x18, 0xe3, 0x18,
+    0x3, 0x1c, 0x63, 0xf8, 0x63, 0x8c, 0x7f, 0xcc, 0x71, 0x8c, 0x39, 0x8e,
+    0x31, 0x83, 0x31, 0xc6, 0x30, 0x66, 0x38, 0xc6, 0xc, 0xc7, 0x18, 0xc1,
+    0x98, 0xff, 0x18, 0x33, 0x1f, 0xc3, 0xfe, 0x3, 0x80, 0x3f, 0x80, 0x70,
+    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+5E2D */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x30, 0xc,
+    0x1, 0x83, 0x0, 0xc0, 0x1b, 0xff, 0xff, 0xc1, 0xbf, 0xff, 0xfc, 0x18,
+    0x30, 0xc, 0x1, 0x83, 0x0, 0xc0, 0x18, 0x38, 0x1c, 0x1, 0x83, 0xff,
+    0xc0, 0x18, 0xf, 0xf0, 0x1, 0x80, 0x18, 0x0, 0x18, 0x3, 0x80, 0x1,
+    0x9f, 0xff, 0xf8, 0x19, 0xff, 0xff, 0xc3, 0x98, 0x18, 0x1c, 0x39, 0x81,
+    0x81, 0xc3, 0x18, 0x18, 0x1c, 0x71, 0x81, 0x81, 0xc7, 0x18, 0x18, 0xf8,
+    0x61, 0x81, 0x8f, 0x86, 0x10, 0x18, 0x60, 0x0, 0x1, 0x80, 0x0,
+
+    /* U+5E33 */
+    0x4, 0x0, 0x0, 0x1, 0xc0, 0x7f, 0xf0, 0x38, 0x1f, 0xfe, 0x7, 0x7,
+    0x0, 0x1, 0xf0, 0xe0, 0x0, 0xff, 0x9f, 0xfe, 0x1f, 0xf3, 0xff, 0xc3,
+    0x66, 0x70, 0x0, 0x6c, 0xce, 0x0, 0xd, 0x99, 0xff, 0xe1, 0xb3, 0x3f,
+    0xfc, 0x36, 0x67, 0x0, 0x6, 0xcc, 0xe0, 0x0, 0xd9, 0xbf, 0xff, 0x9b,
+    0x3f, 0xff, 0xf3, 0x66, 0x7f, 0xfc, 0x6c, 0xce, 0x70, 0x8d, 0x99, 0xc6,
+    0x31, 0xbb, 0x38, 0xce, 0x37, 0xe7, 0x1f, 0x84, 0xf8, 0xe1, 0xc0, 0x18,
+    0x1c, 0x38, 0x3, 0x3, 0xfb, 0xc0, 0x60, 0x7f, 0x3c, 0xc, 0x3f, 0x83,
+    0xc1, 0x8f, 0x80, 0x38, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+5E36 */
+    0x2, 0x30, 0x88, 0x0, 0x33, 0x18, 0xc0, 0x3, 0x31, 0x8c, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x73, 0x1d, 0xc0, 0x6, 0x31, 0x8c,
+    0x0, 0xe3, 0x18, 0xc6, 0x1c, 0x31, 0x8c, 0xe3, 0xc3, 0xf8, 0xfc, 0x78,
+    0x1f, 0x7, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff,
+    0xfc, 0x70, 0xe, 0x0, 0xe7, 0x0, 0x60, 0x6, 0x60, 0x6, 0x0, 0x66,
+    0x7f, 0xff, 0xe6, 0x2f, 0xff, 0xff, 0x40, 0xe0, 0x60, 0x70, 0xc, 0x6,
+    0x3, 0x0, 0xc0, 0x60, 0x30, 0xc, 0x6, 0x7, 0x0, 0xc0, 0x61, 0xf0,
+    0xc, 0x6, 0x3e, 0x0, 0x40, 0x61, 0x80, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5E38 */
+    0x0, 0xc, 0x0, 0x1, 0xc1, 0x83, 0x80, 0x18, 0x30, 0x60, 0x3, 0x86,
+    0x1c, 0x0, 0x0, 0xc0, 0x0, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0xdc, 0x7f, 0xff, 0x1b, 0x9c, 0x0,
+    0xe3, 0x3, 0x80, 0xc, 0x0, 0x70, 0x1, 0x80, 0xf, 0xff, 0xf0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0x1, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xfc, 0x1c, 0x6, 0x3, 0x83, 0x80, 0xc0, 0x30, 0x70,
+    0x18, 0x6, 0xe, 0x3, 0x0, 0xc1, 0xc0, 0x60, 0xf8, 0x38, 0xc, 0x3f,
+    0x2, 0x1, 0x87, 0x80, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+5E45 */
+    0x4, 0x0, 0x0, 0x1, 0x83, 0xff, 0xf8, 0x30, 0x7f, 0xff, 0x6, 0x0,
+    0x0, 0x1, 0xf0, 0x0, 0x0, 0xff, 0x87, 0xfc, 0x1f, 0xf1, 0xff, 0xc7,
+    0x66, 0x70, 0x1c, 0xcc, 0xcc, 0x3, 0x99, 0x99, 0x80, 0x73, 0x33, 0x3f,
+    0xfc, 0x66, 0x63, 0xff, 0x8c, 0xcc, 0x0, 0x1, 0x99, 0x80, 0x0, 0x33,
+    0x33, 0xff, 0xe6, 0x66, 0xff, 0xfe, 0xcc, 0xdc, 0x61, 0xd9, 0x9b, 0xc,
+    0x1b, 0x37, 0x61, 0x83, 0x67, 0xef, 0xff, 0xe4, 0xd9, 0xff, 0xfc, 0x18,
+    0x30, 0xc1, 0x83, 0x6, 0x18, 0x30, 0x60, 0xe3, 0xe, 0xc, 0x1f, 0xff,
+    0xc1, 0x81, 0xff, 0xf0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+5E63 */
+    0x1, 0x0, 0x20, 0xc, 0x63, 0xe, 0x0, 0xcc, 0x61, 0x80, 0x19, 0x9c,
+    0x70, 0x1, 0x39, 0xf, 0xfc, 0xff, 0xf3, 0xff, 0x9f, 0xff, 0x70, 0xc3,
+    0x18, 0x7f, 0x18, 0x6b, 0x4d, 0x67, 0xd, 0xed, 0x86, 0xc1, 0xad, 0xb0,
+    0xf8, 0x3d, 0x96, 0xe, 0x7, 0xb0, 0xc3, 0xe0, 0xc6, 0x79, 0xff, 0x18,
+    0xcf, 0x78, 0xf2, 0x8, 0xc, 0xe, 0x0, 0xc, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x7f, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x83, 0x0, 0xc0, 0x30, 0x60,
+    0x18, 0x6, 0xc, 0x3, 0x0, 0xc1, 0x80, 0x60, 0x78, 0x30, 0xc, 0x3e,
+    0x2, 0x1, 0x87, 0x80, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+5E6B */
+    0x1, 0x0, 0x3, 0x0, 0x18, 0x0, 0x30, 0x3f, 0xf8, 0x3, 0x3, 0xff,
+    0x9f, 0xfe, 0x3, 0x81, 0xff, 0xe7, 0xff, 0xc0, 0x30, 0x3, 0x80, 0xc3,
+    0x1, 0xff, 0x8e, 0x30, 0x3f, 0xf8, 0x73, 0x0, 0x18, 0x1, 0x30, 0x7f,
+    0xfc, 0x3, 0x7, 0xff, 0x43, 0xf0, 0x0, 0x6, 0x3e, 0x0, 0x3f, 0xff,
+    0xe0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0xf,
+    0x0, 0x0, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc1, 0x80, 0x60, 0x1c,
+    0x18, 0x6, 0x1, 0xc1, 0x80, 0x60, 0xf8, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+5E73 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x18, 0x61, 0x80, 0x3, 0x86, 0x1c,
+    0x0, 0x78, 0x61, 0xe0, 0x7, 0x6, 0xf, 0x0, 0xe0, 0x60, 0x78, 0x1c,
+    0x6, 0x3, 0x81, 0x80, 0x60, 0x18, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+5E74 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x1c, 0x3, 0x80,
+    0x3, 0x80, 0x38, 0x0, 0x78, 0x3, 0x80, 0x7, 0x0, 0x38, 0x0, 0x63,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x7, 0x3, 0x80, 0x0, 0x60, 0x38,
+    0x0, 0x6, 0x3, 0x80, 0x0, 0x60, 0x38, 0x0, 0x6, 0x3, 0x80, 0x0,
+    0x60, 0x38, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x3,
+    0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0,
+    0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+5E78 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3,
+    0x80, 0x3c, 0x0, 0x18, 0x3, 0x80, 0x1, 0x80, 0x38, 0x0, 0x1c, 0x3,
+    0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f, 0xff,
+    0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+5E79 */
+    0x3, 0x0, 0x18, 0x0, 0x30, 0x3, 0x80, 0x3, 0x0, 0x38, 0x7, 0xff,
+    0x87, 0xc0, 0x7f, 0xf8, 0xee, 0x0, 0x30, 0xe, 0x70, 0x3, 0x1, 0xc3,
+    0x81, 0xfe, 0x38, 0x1c, 0x3f, 0xf7, 0x1, 0xe3, 0x3, 0x70, 0x6, 0x30,
+    0x36, 0x0, 0x3, 0xff, 0x1f, 0xfc, 0x3f, 0xf1, 0xff, 0x83, 0x3, 0x1,
+    0x80, 0x30, 0x30, 0x18, 0x3, 0xff, 0x1, 0x80, 0x1f, 0xe0, 0x18, 0x0,
+    0x30, 0x7f, 0xfe, 0x3, 0x7, 0xff, 0xe7, 0xff, 0x81, 0x80, 0x7f, 0xf8,
+    0x18, 0x3, 0xff, 0x1, 0x80, 0x3, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80,
+    0x3, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80, 0x3, 0x0, 0x10, 0x0,
+
+    /* U+5E7C */
+    0x0, 0x0, 0x20, 0x0, 0x60, 0xc, 0x0, 0x1c, 0x1, 0x80, 0x3, 0x80,
+    0x30, 0x0, 0x60, 0x6, 0x0, 0x1c, 0x0, 0xc0, 0x3, 0x0, 0x18, 0x0,
+    0x61, 0xbf, 0xfc, 0x78, 0x77, 0xff, 0xcf, 0xc, 0xc, 0x38, 0xe3, 0x81,
+    0x83, 0xe, 0x60, 0x30, 0x60, 0xfc, 0x6, 0xc, 0xf, 0x0, 0xc1, 0x80,
+    0xe0, 0x18, 0x30, 0x18, 0x7, 0x6, 0x7, 0x30, 0xc1, 0xc0, 0xc6, 0x18,
+    0x38, 0x30, 0xe3, 0x7, 0x6, 0x1c, 0xe0, 0xe1, 0xff, 0xd8, 0x18, 0xff,
+    0x9f, 0x3, 0x1f, 0x1, 0xc0, 0x60, 0x0, 0x70, 0x1c, 0x0, 0x1e, 0x1f,
+    0x80, 0x3, 0x83, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5E8A */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x7f,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xfc, 0x1c, 0x0, 0x0,
+    0x1, 0xc0, 0x18, 0x0, 0x1c, 0x1, 0x80, 0x1, 0xc0, 0x18, 0x0, 0x1c,
+    0x1, 0x80, 0x1, 0xdf, 0xff, 0xfe, 0x1d, 0xff, 0xff, 0xc1, 0x80, 0x3c,
+    0x0, 0x18, 0x7, 0xe0, 0x1, 0x80, 0xff, 0x0, 0x18, 0x1d, 0x98, 0x1,
+    0x81, 0x99, 0x80, 0x18, 0x31, 0x8e, 0x3, 0x8e, 0x18, 0x70, 0x39, 0xe1,
+    0x83, 0x83, 0x3c, 0x18, 0x3c, 0x77, 0x81, 0x80, 0xe7, 0x60, 0x18, 0x6,
+    0x60, 0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+5E95 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x7,
+    0x81, 0x80, 0xff, 0xf8, 0x18, 0x7f, 0xfe, 0x1, 0x8f, 0xee, 0x0, 0x18,
+    0xc0, 0x60, 0x1, 0x8c, 0x6, 0x0, 0x18, 0xc0, 0x60, 0x1, 0x8e, 0x7,
+    0x0, 0x18, 0xff, 0xff, 0xe1, 0x8f, 0xff, 0xfc, 0x18, 0xc0, 0x30, 0x1,
+    0x8c, 0x3, 0x0, 0x18, 0xc0, 0x38, 0x3, 0x8c, 0x3, 0x80, 0x38, 0xcf,
+    0x98, 0x3, 0x1f, 0xf1, 0xc6, 0x77, 0xf0, 0xe, 0x67, 0x70, 0x0, 0xfe,
+    0x60, 0xff, 0xf7, 0xe6, 0xf, 0xff, 0x3c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5E97 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x7f,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe1, 0xe0, 0x0, 0x0, 0x1c, 0x0, 0x0,
+    0x1, 0xc0, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x30, 0x0, 0x1c,
+    0x3, 0xff, 0xc1, 0xc0, 0x3f, 0xfc, 0x18, 0x3, 0x0, 0x1, 0x80, 0x30,
+    0x0, 0x18, 0x3, 0x0, 0x1, 0x80, 0x30, 0x0, 0x18, 0xff, 0xff, 0x1,
+    0x8f, 0xff, 0xf8, 0x19, 0xc0, 0x1, 0x83, 0x9c, 0x0, 0x18, 0x39, 0x80,
+    0x1, 0x83, 0x18, 0x0, 0x18, 0x31, 0xc0, 0x1, 0x87, 0x1c, 0x0, 0x38,
+    0x60, 0xff, 0xff, 0x86, 0x7, 0xff, 0xe0,
+
+    /* U+5E9C */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x18, 0x3,
+    0x1, 0x83, 0x80, 0x70, 0x18, 0x30, 0x7, 0x1, 0x87, 0x0, 0x70, 0x18,
+    0x70, 0x7, 0x1, 0x86, 0x7f, 0xfe, 0x18, 0xe7, 0xff, 0xe1, 0x8e, 0x0,
+    0x70, 0x19, 0xe0, 0x7, 0x1, 0xbe, 0x30, 0x70, 0x1b, 0x63, 0x87, 0x1,
+    0xb6, 0x18, 0x70, 0x38, 0x61, 0xc7, 0x3, 0x86, 0xc, 0x70, 0x38, 0x60,
+    0x7, 0x3, 0x86, 0x0, 0x70, 0x70, 0x60, 0x7, 0x7, 0x6, 0x0, 0x70,
+    0x70, 0x60, 0x3e, 0x6, 0x6, 0x3, 0xe0, 0x0, 0x20, 0x38, 0x0,
+
+    /* U+5EA6 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x1, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0x80, 0x0, 0x0, 0x18, 0x30, 0xc,
+    0x1, 0x83, 0x80, 0xc0, 0x1b, 0xff, 0xff, 0xc1, 0xbf, 0xff, 0xfc, 0x18,
+    0x38, 0xc, 0x1, 0x83, 0x80, 0xc0, 0x18, 0x38, 0x1c, 0x1, 0x81, 0xff,
+    0xc0, 0x18, 0xf, 0xf8, 0x1, 0x80, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x3,
+    0x9f, 0xff, 0xf0, 0x38, 0x0, 0xe, 0x3, 0x83, 0x1, 0xe0, 0x38, 0x3c,
+    0x38, 0x3, 0x0, 0xff, 0x0, 0x30, 0x7, 0xe0, 0x7, 0x1, 0xff, 0xc0,
+    0x73, 0xfe, 0x7f, 0xc6, 0x7f, 0x0, 0xfe, 0x47, 0x0, 0x0, 0xe0,
+
+    /* U+5EA7 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x1, 0x80,
+    0x1, 0x86, 0x18, 0x70, 0x18, 0x61, 0x86, 0x1, 0x86, 0x18, 0x60, 0x18,
+    0xe1, 0x8e, 0x1, 0x8f, 0x18, 0xf0, 0x19, 0xf9, 0x9f, 0x81, 0x99, 0x99,
+    0x9c, 0x1b, 0x9d, 0xb8, 0xe1, 0xb0, 0xdb, 0x6, 0x18, 0x1, 0x80, 0x1,
+    0x80, 0x1c, 0x0, 0x19, 0xff, 0xff, 0x83, 0x8f, 0xff, 0xf8, 0x38, 0x1,
+    0x80, 0x3, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x3f, 0xff, 0xfe,
+    0x67, 0xff, 0xff, 0xe6, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5EAB */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x8, 0x0, 0x18, 0x1, 0x80,
+    0x1, 0x9f, 0xff, 0xfc, 0x19, 0xff, 0xff, 0xe1, 0x80, 0x18, 0x0, 0x18,
+    0x1, 0xc0, 0x1, 0x8f, 0xff, 0xf8, 0x18, 0xe1, 0xc3, 0x81, 0x9c, 0x18,
+    0x18, 0x19, 0xff, 0xff, 0x81, 0x9f, 0xff, 0xf8, 0x19, 0xc1, 0x81, 0x81,
+    0x9c, 0x18, 0x18, 0x18, 0xff, 0xff, 0x83, 0x87, 0xff, 0xf0, 0x38, 0x1,
+    0x80, 0x3, 0x0, 0x1c, 0x0, 0x77, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0xfc,
+    0x60, 0x1, 0x80, 0x6, 0x0, 0x18, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+5EAD */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0,
+    0x81, 0xbf, 0x83, 0xfc, 0x19, 0xf9, 0xff, 0x81, 0x83, 0x1f, 0xc0, 0x18,
+    0x70, 0x1c, 0x1, 0x86, 0x1, 0xc0, 0x18, 0xc0, 0x1c, 0x1, 0x8f, 0xdf,
+    0xfe, 0x19, 0xfd, 0xff, 0xe1, 0x81, 0xc1, 0xc0, 0x18, 0xc, 0x1c, 0x1,
+    0x98, 0xc1, 0xc0, 0x19, 0x9c, 0x1c, 0x3, 0x9d, 0x81, 0xc0, 0x38, 0xf9,
+    0xff, 0xc3, 0x7, 0x1f, 0xfc, 0x30, 0x78, 0x0, 0x7, 0x1f, 0xf0, 0x0,
+    0x63, 0xcf, 0xff, 0xe6, 0x70, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5EB7 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x3, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x80, 0x18, 0x0, 0x18, 0x1, 0x80,
+    0x1, 0x8f, 0xff, 0xf0, 0x18, 0xff, 0xff, 0x1, 0x80, 0x18, 0x38, 0x18,
+    0x3, 0x83, 0x81, 0xbf, 0xff, 0xfe, 0x19, 0xff, 0xff, 0xe1, 0x80, 0x18,
+    0x38, 0x18, 0x3, 0x87, 0x1, 0x9f, 0xff, 0xf0, 0x18, 0x3, 0x80, 0x1,
+    0x98, 0x1c, 0x1c, 0x19, 0xe1, 0xc7, 0x83, 0x87, 0x1f, 0xe0, 0x38, 0x1,
+    0xbc, 0x3, 0x3, 0xd9, 0xc0, 0x30, 0xf9, 0x8f, 0x7, 0x7e, 0x18, 0x7c,
+    0x77, 0x83, 0x81, 0xe6, 0x1, 0xf0, 0x6, 0x0, 0x1e, 0x0, 0x0,
+
+    /* U+5EC1 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0xc0, 0x0, 0x0, 0x18, 0x7c, 0x0,
+    0xc1, 0x8f, 0xf0, 0xc, 0x19, 0xc7, 0x18, 0xc1, 0x98, 0x31, 0x8c, 0x19,
+    0xc3, 0x18, 0xc1, 0x9f, 0xf1, 0x8c, 0x19, 0xff, 0x18, 0xc1, 0x98, 0x31,
+    0x8c, 0x19, 0x83, 0x18, 0xc1, 0x9f, 0xf1, 0x8c, 0x19, 0xff, 0x18, 0xc1,
+    0x98, 0x31, 0x8c, 0x39, 0x83, 0x18, 0xc3, 0x9c, 0x31, 0x8c, 0x30, 0xff,
+    0x18, 0xc3, 0x7, 0xe1, 0xc, 0x70, 0x46, 0x0, 0xc7, 0x1c, 0x70, 0xc,
+    0x63, 0x83, 0x8f, 0xc6, 0x70, 0x18, 0xfc, 0x0, 0x0, 0x7, 0x0,
+
+    /* U+5ED6 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x7, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xfe, 0x1c, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x1b, 0xfe, 0xff,
+    0x81, 0x9f, 0xef, 0xfc, 0x19, 0x86, 0x60, 0xc1, 0x9f, 0x67, 0xcc, 0x18,
+    0x66, 0x1c, 0xc1, 0x80, 0x60, 0x2c, 0x18, 0xf6, 0x1e, 0xc1, 0xbe, 0x1b,
+    0x8c, 0x19, 0x7, 0xe0, 0x1, 0x81, 0xe7, 0x80, 0x18, 0x78, 0x3e, 0x1,
+    0x9e, 0x1c, 0xfc, 0x3f, 0xc7, 0x83, 0xe3, 0xa3, 0xe3, 0x86, 0x38, 0xf0,
+    0xf0, 0x3, 0x8, 0x7c, 0x38, 0x30, 0x7f, 0x1f, 0x87, 0xf, 0xf, 0xe0,
+    0x60, 0x1f, 0xf8, 0x6, 0x3f, 0xf8, 0x0, 0x41, 0xf0, 0x0, 0x0,
+
+    /* U+5EDA */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x7, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x81, 0x0, 0x10, 0x18, 0x38, 0x1,
+    0x81, 0x83, 0x80, 0x18, 0x1b, 0xff, 0x81, 0x81, 0x9f, 0xf0, 0x18, 0x18,
+    0x38, 0x3, 0x81, 0x9f, 0xf7, 0xfe, 0x19, 0xff, 0x3f, 0xe1, 0x80, 0x0,
+    0x18, 0x18, 0x0, 0x1, 0x81, 0x9f, 0xf2, 0x18, 0x19, 0x83, 0x31, 0x81,
+    0x98, 0x33, 0x98, 0x19, 0x83, 0x19, 0x83, 0x9f, 0xf1, 0x98, 0x38, 0xfc,
+    0x1, 0x83, 0xc, 0x60, 0x18, 0x70, 0xc6, 0x1, 0x87, 0x4, 0xf8, 0x18,
+    0x63, 0xff, 0x9f, 0x86, 0x7f, 0x81, 0xf0, 0x0, 0x0, 0x1e, 0x0,
+
+    /* U+5EDF */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x3, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x81, 0x0, 0x0, 0x18, 0x30, 0x0,
+    0x1, 0x9f, 0xf3, 0xfc, 0x1b, 0xff, 0xbf, 0xc1, 0x83, 0x83, 0xc, 0x18,
+    0x30, 0x30, 0xc1, 0x9f, 0xf3, 0xc, 0x19, 0xff, 0x3f, 0xc1, 0x98, 0x33,
+    0xfc, 0x19, 0xff, 0x30, 0xc1, 0x9f, 0xf3, 0xc, 0x19, 0x83, 0x30, 0xc1,
+    0x98, 0x33, 0xfc, 0x39, 0xff, 0x3f, 0xc3, 0x83, 0x83, 0xc, 0x38, 0x30,
+    0x60, 0xc3, 0x3f, 0xf6, 0xc, 0x73, 0xff, 0x60, 0xc7, 0x3, 0xc, 0xc,
+    0x60, 0x31, 0xc7, 0xc6, 0x3, 0x18, 0x7c, 0x0, 0x10, 0x7, 0x0,
+
+    /* U+5EE2 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x1c, 0x0, 0x0, 0x1, 0x8f, 0xf8, 0x0, 0x19, 0xff, 0xcc,
+    0x1, 0x80, 0x3f, 0xc8, 0x18, 0xe7, 0x79, 0x81, 0x87, 0xe3, 0xb8, 0x18,
+    0x78, 0x1f, 0x1, 0x9f, 0x0, 0x7e, 0x1b, 0xfc, 0x7f, 0xe1, 0xb7, 0xe7,
+    0xe0, 0x18, 0x6, 0xe6, 0x41, 0x80, 0x6c, 0x66, 0x18, 0xff, 0xc7, 0xc1,
+    0x9f, 0xd8, 0x3c, 0x39, 0x80, 0x80, 0x3, 0x98, 0xf, 0xf8, 0x31, 0xfc,
+    0x3, 0x83, 0x1f, 0xee, 0x30, 0x70, 0x6, 0xfe, 0x7, 0x0, 0x63, 0xe0,
+    0x70, 0xe, 0xff, 0x86, 0x1f, 0xde, 0x1c, 0x0, 0xf1, 0x80, 0x40,
+
+    /* U+5EE3 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x7, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x83, 0x1, 0x80, 0x1b, 0xff, 0xff,
+    0x81, 0xbf, 0xff, 0xf8, 0x18, 0x30, 0x18, 0x1, 0x83, 0x83, 0x80, 0x18,
+    0x1f, 0xf0, 0x1, 0x80, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xc1, 0xbf, 0xff,
+    0xfc, 0x18, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xf0, 0x19, 0xff, 0xff, 0x81,
+    0x98, 0x38, 0x38, 0x39, 0xff, 0xff, 0x83, 0x9f, 0xff, 0xf8, 0x39, 0x83,
+    0x81, 0x83, 0x1c, 0x38, 0x78, 0x71, 0xff, 0xff, 0x7, 0x0, 0x81, 0x80,
+    0x60, 0xf8, 0x1f, 0x86, 0x7f, 0x0, 0x7e, 0x6, 0x0, 0x0, 0x40,
+
+    /* U+5EF3 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x3, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xfe, 0x1e, 0x0, 0x8, 0x1, 0xc0, 0x1, 0x80, 0x1f, 0xfe, 0x1c,
+    0x1, 0xff, 0xff, 0xfe, 0x1b, 0x18, 0x1c, 0x1, 0xbf, 0x81, 0xc0, 0x1b,
+    0xfb, 0xff, 0xc1, 0xb1, 0xbf, 0x6c, 0x1b, 0xfb, 0x26, 0x41, 0xb9, 0xb2,
+    0x6c, 0x1b, 0x1b, 0xff, 0xc1, 0xbf, 0x9f, 0xf8, 0x1f, 0xf8, 0x0, 0x1,
+    0x81, 0xbf, 0xfc, 0x1b, 0xfb, 0xff, 0xc3, 0x99, 0x80, 0x0, 0x31, 0x99,
+    0x66, 0xc3, 0x7f, 0xb6, 0x6c, 0x31, 0x9b, 0x61, 0x67, 0x1f, 0xb6, 0x36,
+    0x67, 0xfb, 0x7f, 0x26, 0x61, 0x83, 0xf0, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+5EF6 */
+    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x3c, 0x7f, 0xc7, 0xff, 0xc3, 0xf9,
+    0xff, 0xf8, 0x3, 0x8f, 0xf8, 0x0, 0x30, 0x1, 0x80, 0x6, 0x0, 0x18,
+    0x0, 0xe0, 0x1, 0x80, 0xc, 0x6, 0x18, 0x1, 0xc0, 0x61, 0x80, 0x3f,
+    0x86, 0x1f, 0xc3, 0xfc, 0x61, 0xfc, 0x1, 0xc6, 0x18, 0x0, 0xc, 0x61,
+    0x80, 0x30, 0xc6, 0x18, 0x3, 0xc, 0x61, 0x80, 0x39, 0x86, 0x18, 0x1,
+    0x98, 0x61, 0x80, 0x1d, 0xbf, 0xff, 0xc0, 0xfb, 0xff, 0xfe, 0xf, 0x1f,
+    0xff, 0xc0, 0x78, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x3, 0xcf, 0xff, 0xfe,
+    0x78, 0x3f, 0xff, 0xe7, 0x0, 0x3f, 0xfe, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+5EFA */
+    0x0, 0x0, 0x40, 0x3, 0xf0, 0x6, 0x0, 0x7f, 0x9f, 0xff, 0x0, 0x79,
+    0xff, 0xf8, 0x3, 0x0, 0xe3, 0x80, 0x70, 0x6, 0x18, 0x6, 0x3f, 0xff,
+    0xe0, 0xc3, 0xff, 0xfe, 0x1c, 0x0, 0xe1, 0x81, 0x80, 0x6, 0x18, 0x3f,
+    0x8f, 0xff, 0x81, 0xf9, 0xff, 0xf8, 0x1, 0xc0, 0x60, 0x0, 0x18, 0x6,
+    0x0, 0x31, 0x9f, 0xff, 0xc3, 0x19, 0xff, 0xf8, 0x39, 0x80, 0x60, 0x1,
+    0x98, 0xe, 0x0, 0x1b, 0x7f, 0xff, 0xe0, 0xf3, 0xff, 0xfe, 0xf, 0x0,
+    0x60, 0x0, 0x70, 0x6, 0x0, 0xf, 0xc0, 0x60, 0x1, 0xdf, 0xc0, 0x0,
+    0x78, 0x7f, 0xff, 0xe6, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5F04 */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x3,
+    0x0, 0x0, 0xc0, 0x30, 0x1, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xe3,
+    0xff, 0xff, 0xfc, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x1, 0x80,
+    0x30, 0x0, 0x78, 0x3, 0x0, 0xf, 0x0, 0x30, 0x3, 0xe0, 0x3, 0x0,
+    0x3c, 0x0, 0x30, 0x2, 0x0, 0x3, 0x0,
+
+    /* U+5F0F */
+    0x0, 0x0, 0x80, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0xc3, 0x0, 0x0,
+    0xc, 0x10, 0x0, 0x0, 0xc0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xe, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x3f, 0xfc, 0x60, 0x3, 0xff, 0xc6,
+    0x0, 0x1, 0x80, 0x60, 0x0, 0x18, 0x7, 0x0, 0x1, 0x80, 0x70, 0x0,
+    0x18, 0x3, 0x0, 0x1, 0x80, 0x38, 0x0, 0x18, 0x1, 0x86, 0x1, 0x80,
+    0x1c, 0x60, 0x1f, 0xf0, 0xc6, 0x3f, 0xfe, 0xe, 0x67, 0xfe, 0x0, 0x7e,
+    0x78, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5F18 */
+    0x0, 0x0, 0x0, 0xf, 0xf0, 0xc, 0x3, 0xff, 0x3, 0x80, 0x0, 0xf0,
+    0x70, 0x0, 0xe, 0xe, 0x0, 0x1, 0xc1, 0xc0, 0x0, 0x38, 0x30, 0x0,
+    0xf, 0x6, 0x0, 0x7f, 0xc0, 0xc0, 0xf, 0xe0, 0x38, 0x1, 0x80, 0x7,
+    0x0, 0x30, 0x0, 0xc0, 0x6, 0x0, 0x18, 0x0, 0xc0, 0x3, 0x0, 0x1f,
+    0xf0, 0x63, 0x1, 0xfe, 0x1c, 0x70, 0x0, 0xc3, 0x86, 0x0, 0x18, 0x60,
+    0xe0, 0x3, 0xc, 0xc, 0x0, 0x61, 0x81, 0x80, 0xc, 0x70, 0x38, 0x1,
+    0x8c, 0x7, 0x0, 0x71, 0x9f, 0xf0, 0xe, 0xff, 0xfe, 0x1f, 0xbf, 0xc0,
+    0xc3, 0xe2, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5F35 */
+    0x7f, 0x3, 0xff, 0xc7, 0xfc, 0x7f, 0xfc, 0x3f, 0xc7, 0x0, 0x0, 0xc,
+    0x60, 0x0, 0x0, 0xc7, 0xff, 0x80, 0xc, 0x7f, 0xf8, 0x1, 0xc6, 0x0,
+    0x3, 0xfc, 0x60, 0x0, 0x3f, 0x7, 0xff, 0x83, 0x0, 0x7f, 0xf8, 0x30,
+    0x6, 0x0, 0x7, 0x0, 0x60, 0x0, 0x70, 0x1f, 0xff, 0xe7, 0xfb, 0xff,
+    0xfe, 0x3f, 0xce, 0x70, 0x0, 0x1c, 0x63, 0x4, 0x0, 0xc6, 0x18, 0xc0,
+    0x1c, 0x61, 0x9c, 0x1, 0xc6, 0x1f, 0x0, 0x1c, 0x61, 0xe0, 0x1, 0x86,
+    0xe, 0x0, 0x18, 0x67, 0x70, 0x3, 0x8f, 0xe3, 0xc1, 0xfb, 0xfc, 0x1e,
+    0x1f, 0x3e, 0x0, 0xe0, 0x80, 0x0, 0x0,
+
+    /* U+5F37 */
+    0x0, 0x0, 0xc0, 0x7, 0xf0, 0x1c, 0x0, 0x7f, 0x81, 0x80, 0x3, 0xf8,
+    0x38, 0xe0, 0x1, 0x83, 0x7, 0x0, 0x18, 0x30, 0x38, 0x1, 0x87, 0xff,
+    0xc0, 0x1b, 0xff, 0xfe, 0x3f, 0xbf, 0xe0, 0x63, 0xf0, 0x6, 0x0, 0x30,
+    0x0, 0x60, 0x7, 0x0, 0xff, 0xf0, 0x70, 0x1f, 0xff, 0x87, 0x1, 0xc6,
+    0x1c, 0x7f, 0x98, 0x61, 0xc3, 0xf9, 0x86, 0x1c, 0x1, 0x98, 0x61, 0xc0,
+    0x19, 0xff, 0xf8, 0x1, 0x9f, 0xff, 0x80, 0x18, 0x6, 0x0, 0x1, 0x80,
+    0x63, 0x0, 0x18, 0x6, 0x18, 0x1, 0x80, 0x61, 0xc0, 0x3b, 0xff, 0xfc,
+    0x1f, 0x3f, 0xff, 0xe3, 0xf3, 0xc0, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5F48 */
+    0x7e, 0x1f, 0x8f, 0x87, 0xfb, 0xfd, 0xfc, 0x3, 0xb1, 0xd8, 0xc0, 0x1b,
+    0xd, 0x8c, 0x1, 0xb9, 0xd8, 0xc0, 0x1b, 0xf9, 0xfc, 0x3, 0x8f, 0xf,
+    0x83, 0xf8, 0x0, 0x0, 0x3e, 0x1f, 0xff, 0x87, 0x1, 0xff, 0xfc, 0x60,
+    0x18, 0x60, 0xc6, 0x1, 0x87, 0x1c, 0x70, 0x1f, 0xff, 0xc7, 0xf9, 0x87,
+    0x1c, 0x3f, 0x98, 0x60, 0xc0, 0x19, 0xc7, 0x1c, 0x1, 0x9f, 0xff, 0x80,
+    0x18, 0x7, 0x0, 0x1, 0x80, 0x60, 0x0, 0x3b, 0xff, 0xfe, 0x3, 0xbf,
+    0xff, 0xe0, 0x30, 0x7, 0x0, 0x3, 0x0, 0x60, 0x3, 0xf0, 0x6, 0x0,
+    0x3e, 0x0, 0x60, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+5F4C */
+    0x7c, 0x3f, 0xff, 0xe7, 0xf7, 0xff, 0xfe, 0x7, 0x4, 0xe0, 0x0, 0x30,
+    0xc6, 0x60, 0x3, 0x1c, 0x63, 0x80, 0x33, 0x86, 0x1e, 0x7, 0x70, 0x60,
+    0xe3, 0xf7, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xc6, 0x3, 0x6, 0xc, 0x60,
+    0x3f, 0x6a, 0xc6, 0x3, 0x76, 0xec, 0x70, 0x36, 0x6e, 0xc7, 0xf3, 0x76,
+    0xec, 0x3f, 0x3d, 0xfb, 0xc0, 0x33, 0x6, 0xc, 0x3, 0x30, 0x60, 0xc0,
+    0x33, 0xf7, 0xec, 0x3, 0x37, 0x6e, 0xc0, 0x33, 0x76, 0xec, 0x3, 0x3f,
+    0x6f, 0xc0, 0x73, 0xdf, 0xbc, 0x6, 0x30, 0x60, 0xc3, 0xe3, 0x6, 0x1c,
+    0x3c, 0x30, 0x67, 0xc0, 0x2, 0x0, 0x38,
+
+    /* U+5F6D */
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x18, 0x1, 0xc0, 0x7, 0x87, 0xff,
+    0xf0, 0xf0, 0x7f, 0xfe, 0x3e, 0x0, 0x18, 0xf, 0x80, 0x1, 0x80, 0xf0,
+    0x3, 0xff, 0xcc, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x3, 0xc3, 0xff, 0xc0, 0x78, 0x3f, 0xfc, 0x1f, 0x3, 0x0, 0xc7,
+    0xc0, 0x30, 0xc, 0xf8, 0x3, 0x80, 0xce, 0x0, 0x3f, 0xfc, 0x0, 0x1,
+    0xff, 0x80, 0x6, 0x0, 0x10, 0x0, 0xe0, 0xc3, 0x0, 0x3c, 0xc, 0x30,
+    0x7, 0x80, 0xc3, 0x0, 0xf0, 0xc, 0x7e, 0x3e, 0x1, 0xff, 0xcf, 0x80,
+    0x7f, 0xe3, 0xf0, 0x7, 0x80, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5F71 */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x1c, 0x1f, 0xfe, 0x3, 0x81, 0x80,
+    0x70, 0xf0, 0x18, 0x7, 0x1e, 0x1, 0xff, 0xf7, 0xc0, 0x18, 0x7, 0xf0,
+    0x1, 0x80, 0x74, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0xff, 0xc0, 0xc, 0x0,
+    0xc0, 0x1, 0xc7, 0xff, 0xf8, 0x38, 0x7f, 0xff, 0x8f, 0x0, 0x0, 0x1,
+    0xe0, 0xf, 0xfc, 0x78, 0x1, 0xff, 0xf7, 0x0, 0x18, 0x7, 0x0, 0x1,
+    0x80, 0x30, 0x0, 0x1f, 0xff, 0x0, 0x61, 0xff, 0xe0, 0xe, 0x0, 0xe0,
+    0x1, 0xe0, 0xcc, 0xc0, 0x78, 0x1c, 0xce, 0xf, 0x3, 0x8c, 0x63, 0xe0,
+    0x71, 0xc0, 0xf8, 0x4, 0x7c, 0x1e, 0x0, 0x3, 0x80, 0x80, 0x0,
+
+    /* U+5F79 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x7f, 0x0, 0xf, 0xf, 0xf8, 0x1, 0xe0,
+    0xc1, 0x80, 0x3c, 0x1c, 0x1c, 0x7, 0x1, 0xc1, 0xc0, 0x60, 0x1c, 0x1c,
+    0x60, 0x19, 0xc1, 0xc6, 0x3, 0x98, 0x1c, 0xe0, 0x73, 0x81, 0xfe, 0xe,
+    0x70, 0xf, 0xc1, 0xe6, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3, 0xe3, 0xff,
+    0xf0, 0x7e, 0x3f, 0xff, 0x86, 0xe0, 0x0, 0x30, 0xe, 0xc, 0x7, 0x0,
+    0xe0, 0xe0, 0xe0, 0xe, 0xe, 0x1c, 0x0, 0xe0, 0x73, 0x80, 0xe, 0x3,
+    0xf0, 0x0, 0xe0, 0x1e, 0x0, 0xe, 0x3, 0xf8, 0x0, 0xe1, 0xf3, 0xf8,
+    0xe, 0xfc, 0xf, 0xe0, 0xef, 0x0, 0x3e, 0x4, 0x80, 0x0, 0x0,
+
+    /* U+5F7C */
+    0x1, 0x0, 0x60, 0x0, 0x30, 0x6, 0x0, 0xf, 0x0, 0x60, 0x1, 0xe0,
+    0x6, 0x0, 0x3c, 0xf, 0xff, 0x87, 0x1, 0xff, 0xfc, 0x60, 0x38, 0x60,
+    0xc0, 0x1b, 0x86, 0xc, 0x3, 0xb8, 0x61, 0xc0, 0x73, 0x86, 0x18, 0xe,
+    0x38, 0x60, 0x1, 0xe3, 0x86, 0x0, 0x1e, 0x3f, 0xff, 0x83, 0xe3, 0xff,
+    0xf8, 0x7e, 0x30, 0x3, 0x86, 0xe3, 0x18, 0x38, 0xe, 0x31, 0x83, 0x0,
+    0xe3, 0x1c, 0x60, 0xe, 0x30, 0xce, 0x0, 0xe7, 0xf, 0xc0, 0xe, 0x60,
+    0x78, 0x0, 0xee, 0x7, 0x80, 0xe, 0xe0, 0xfe, 0x0, 0xec, 0x3c, 0xf8,
+    0xf, 0xcf, 0x83, 0xe0, 0xe1, 0xf0, 0x1e, 0x4, 0x8, 0x0, 0x0,
+
+    /* U+5F80 */
+    0x1, 0x1, 0x0, 0x0, 0x70, 0x1c, 0x0, 0xf, 0x1, 0xe0, 0x1, 0xe0,
+    0x7, 0x0, 0x3c, 0x0, 0x30, 0x7, 0x80, 0x0, 0x0, 0x60, 0x3f, 0xff,
+    0xc0, 0x13, 0xff, 0xfc, 0x3, 0x80, 0x60, 0x0, 0x70, 0x6, 0x0, 0x6,
+    0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0x1e, 0x0, 0x60, 0x3, 0xe0, 0x6,
+    0x0, 0x7e, 0x1f, 0xff, 0x86, 0xe3, 0xff, 0xfc, 0xe, 0x0, 0x70, 0x0,
+    0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0,
+    0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0, 0xf, 0x0,
+    0xe, 0x7f, 0xff, 0xe0, 0xe7, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5F8B */
+    0x1, 0x0, 0xc0, 0x0, 0x70, 0xc, 0x0, 0xf, 0x3f, 0xfe, 0x1, 0xe3,
+    0xff, 0xf8, 0x3c, 0x1, 0xe3, 0x87, 0x0, 0xc, 0x18, 0x60, 0x0, 0xc1,
+    0x80, 0x37, 0xff, 0xfe, 0x3, 0x7f, 0xff, 0xe0, 0x70, 0xc, 0x18, 0xe,
+    0x0, 0xc1, 0x81, 0xe1, 0xff, 0xf8, 0x1e, 0x3f, 0xff, 0x83, 0xe0, 0x1e,
+    0x0, 0x7e, 0x0, 0xc0, 0x6, 0xe0, 0xc, 0x0, 0xe, 0x7f, 0xff, 0x80,
+    0xe7, 0xff, 0xf8, 0xe, 0x0, 0xc0, 0x0, 0xe0, 0xc, 0x0, 0xe, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xfe, 0xe, 0x1, 0xe0, 0x0, 0xe0, 0xc, 0x0,
+    0xe, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0, 0x4, 0x0, 0xc0, 0x0,
+
+    /* U+5F8C */
+    0x1, 0x0, 0x80, 0x0, 0x70, 0x18, 0x0, 0xf, 0x3, 0x84, 0x1, 0xe0,
+    0x30, 0xc0, 0x38, 0x36, 0x1c, 0x7, 0x3, 0xe3, 0x80, 0x60, 0x1e, 0x30,
+    0x0, 0x30, 0xf7, 0x0, 0x3, 0x3, 0xe3, 0x0, 0x70, 0x1c, 0x38, 0xe,
+    0x3, 0x81, 0xc0, 0xcf, 0xff, 0xfc, 0x1c, 0xff, 0xfe, 0xe3, 0xc0, 0x70,
+    0x6, 0x7c, 0x6, 0x0, 0x6, 0xc0, 0xff, 0xf0, 0xc, 0xf, 0xff, 0x0,
+    0xc1, 0xf0, 0x70, 0xc, 0x3b, 0x6, 0x0, 0xc7, 0x18, 0xe0, 0xc, 0xe1,
+    0xdc, 0x0, 0xcc, 0xf, 0x80, 0xc, 0x0, 0xf8, 0x0, 0xc0, 0x7f, 0xf0,
+    0xc, 0x3f, 0xf, 0xe0, 0xc7, 0xc0, 0x3e, 0xc, 0x20, 0x0, 0x60,
+
+    /* U+5F90 */
+    0x1, 0x0, 0x60, 0x0, 0x38, 0xe, 0x0, 0xf, 0x0, 0xe0, 0x1, 0xe0,
+    0x1f, 0x0, 0x3c, 0x3, 0x98, 0x7, 0x0, 0x70, 0xc0, 0x60, 0xe, 0xf,
+    0x0, 0x19, 0xc0, 0x78, 0x3, 0xb8, 0x3, 0xe0, 0x77, 0xff, 0xfe, 0xe,
+    0x6f, 0xfe, 0x61, 0xe0, 0xe, 0x0, 0x1e, 0x0, 0x60, 0x3, 0xe0, 0x6,
+    0x0, 0x7e, 0x3f, 0xff, 0xc6, 0xe3, 0xff, 0xfc, 0xe, 0x1f, 0xff, 0x80,
+    0xe0, 0x6, 0x0, 0xe, 0x4, 0x66, 0x0, 0xe0, 0xc6, 0x70, 0xe, 0x1c,
+    0x63, 0x80, 0xe3, 0x86, 0x1c, 0xe, 0x70, 0x61, 0xe0, 0xee, 0x6, 0xe,
+    0xe, 0xc3, 0xe0, 0x0, 0xe0, 0x7e, 0x0, 0x4, 0x3, 0x80, 0x0,
+
+    /* U+5F97 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0xff, 0xf8, 0xf, 0x1f, 0xff, 0x81, 0xe1,
+    0x80, 0x18, 0x3c, 0x18, 0x1, 0x87, 0x1, 0xff, 0xf8, 0x60, 0x1f, 0xff,
+    0x80, 0x19, 0x80, 0x18, 0x3, 0x98, 0x1, 0x80, 0x71, 0xff, 0xf8, 0xe,
+    0x1f, 0xff, 0x81, 0xe0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3, 0xe7, 0xff,
+    0xfc, 0x7e, 0x7f, 0xff, 0xc6, 0xe0, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0,
+    0xef, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xe0, 0xe0, 0x0, 0xe0, 0xe, 0x8,
+    0x6, 0x0, 0xe0, 0xc0, 0x60, 0xe, 0xe, 0x6, 0x0, 0xe0, 0x70, 0x60,
+    0xe, 0x2, 0x3e, 0x0, 0xc0, 0x7, 0xe0, 0x4, 0x0, 0x38, 0x0,
+
+    /* U+5F9E */
+    0x1, 0x2, 0x2, 0x0, 0x38, 0x60, 0x60, 0xf, 0x6, 0xe, 0x1, 0xe0,
+    0xe0, 0xe0, 0x3c, 0xc, 0xc, 0x7, 0x0, 0xe1, 0xc0, 0x60, 0x1f, 0x1e,
+    0x0, 0x19, 0xb9, 0xf8, 0x3, 0xb9, 0xfb, 0xc0, 0x73, 0x7, 0x1c, 0xe,
+    0x70, 0x70, 0xe1, 0xe6, 0x6, 0x0, 0x1e, 0x0, 0x20, 0x3, 0xe0, 0x7,
+    0x0, 0x7e, 0x18, 0x70, 0x6, 0xe1, 0xc7, 0x0, 0xe, 0x18, 0x7f, 0xc0,
+    0xe1, 0x87, 0xfc, 0xe, 0x1c, 0x70, 0x0, 0xe1, 0xc7, 0x0, 0xe, 0x3c,
+    0x70, 0x0, 0xe3, 0xe7, 0x0, 0xe, 0x77, 0xf0, 0x0, 0xee, 0x3f, 0x0,
+    0xe, 0xe1, 0xff, 0xe0, 0xec, 0x3, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5FA9 */
+    0x3, 0x4, 0x0, 0x0, 0x70, 0xc0, 0x0, 0xf, 0x1e, 0x0, 0x1, 0xe1,
+    0xff, 0xfe, 0x3c, 0x3f, 0xff, 0xc7, 0x7, 0x0, 0x0, 0x60, 0x6f, 0xff,
+    0x0, 0x31, 0xff, 0xf8, 0x3, 0x18, 0x1, 0x80, 0x71, 0xff, 0xf8, 0xe,
+    0x1f, 0xff, 0x81, 0xe1, 0x80, 0x18, 0x3e, 0x18, 0x3, 0x83, 0xe1, 0xff,
+    0xf8, 0x7e, 0xf, 0xff, 0x6, 0xe0, 0x70, 0x0, 0xe, 0x7, 0xff, 0x0,
+    0xe0, 0xff, 0xf8, 0xe, 0x3e, 0x7, 0x80, 0xe7, 0x70, 0x70, 0xe, 0x63,
+    0x8e, 0x0, 0xe0, 0x1f, 0xc0, 0xe, 0x0, 0xf8, 0x0, 0xe0, 0x7f, 0xe0,
+    0xe, 0x3f, 0x9f, 0xe0, 0xef, 0xc0, 0x7e, 0x4, 0xc0, 0x0, 0x40,
+
+    /* U+5FAE */
+    0x2, 0x8, 0x4, 0x0, 0x61, 0xc0, 0xc0, 0xe, 0x9c, 0x8c, 0x1, 0xcd,
+    0xd9, 0xc0, 0x78, 0xdd, 0x98, 0x7, 0xd, 0xd9, 0x80, 0x40, 0xdd, 0x9f,
+    0xe0, 0x3d, 0xdb, 0xfe, 0x7, 0xff, 0xb9, 0xc0, 0xef, 0xff, 0x8c, 0xc,
+    0x0, 0x79, 0xc1, 0xc0, 0x5, 0x98, 0x3c, 0xff, 0x99, 0x87, 0xdf, 0xfd,
+    0x98, 0x7c, 0x0, 0x9, 0x86, 0xc2, 0x20, 0xd8, 0xc, 0x63, 0xd, 0x80,
+    0xc6, 0x30, 0xf0, 0xc, 0x63, 0xf, 0x0, 0xc6, 0x30, 0x60, 0xc, 0x63,
+    0x66, 0x0, 0xce, 0x3e, 0xf0, 0xc, 0xc3, 0xdf, 0x80, 0xdc, 0x33, 0x9c,
+    0xd, 0x80, 0x70, 0xe0, 0xd0, 0xe, 0x6, 0x8, 0x0, 0x80, 0x20,
+
+    /* U+5FB7 */
+    0x1, 0x0, 0x60, 0x0, 0x78, 0xe, 0x0, 0xf, 0x0, 0xe0, 0x1, 0xe7,
+    0xff, 0xfe, 0x3c, 0x7f, 0xff, 0xe7, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0,
+    0x0, 0x1b, 0xff, 0xfc, 0x3, 0xbf, 0xff, 0xc0, 0x73, 0x11, 0x8c, 0xe,
+    0x31, 0x18, 0xc0, 0xe3, 0x11, 0x8c, 0x1e, 0x3f, 0xff, 0xc3, 0xe3, 0xff,
+    0xfc, 0x7e, 0x0, 0x0, 0x6, 0xe0, 0x0, 0x0, 0xe, 0x7f, 0xff, 0xe0,
+    0xe3, 0xff, 0xfc, 0xe, 0x0, 0x20, 0x0, 0xe2, 0x67, 0x18, 0xe, 0x66,
+    0x31, 0xc0, 0xe6, 0x61, 0xc, 0xe, 0x66, 0x6, 0xe0, 0xee, 0x70, 0x66,
+    0xe, 0xc7, 0xfe, 0x60, 0xcc, 0x3f, 0xc0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5FC3 */
+    0x0, 0x8, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
+    0x7c, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x40, 0x18,
+    0xc0, 0x6, 0x1, 0x8c, 0x0, 0x70, 0x18, 0xc0, 0x3, 0x83, 0x8c, 0x0,
+    0x38, 0x38, 0xc0, 0x1, 0xc3, 0x8c, 0x0, 0x1c, 0x38, 0xc0, 0x1, 0xe3,
+    0xc, 0x0, 0xe, 0x70, 0xc0, 0x0, 0xe7, 0xc, 0x0, 0xc6, 0x70, 0xc0,
+    0xc, 0x6, 0xc, 0x1, 0xc0, 0x0, 0xe0, 0x1c, 0x0, 0xf, 0x3, 0xc0,
+    0x0, 0xff, 0xf8, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5FD7 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x7f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0xf, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x1,
+    0x8c, 0x70, 0x60, 0x18, 0xc3, 0x7, 0x3, 0x8c, 0x10, 0x38, 0x38, 0xc0,
+    0x11, 0xc3, 0xc, 0x1, 0x9c, 0x70, 0xc0, 0x38, 0xe7, 0xe, 0x7, 0x8e,
+    0x20, 0xff, 0xf0, 0x40, 0x7, 0xfe, 0x0,
+
+    /* U+5FD8 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
+    0x8c, 0x70, 0x30, 0x18, 0xc3, 0x83, 0x83, 0x8c, 0x38, 0x38, 0x38, 0xc0,
+    0x9, 0xc3, 0xc, 0x1, 0xce, 0x70, 0xc0, 0x1c, 0xe7, 0xe, 0x3, 0x86,
+    0x60, 0xff, 0xf8, 0x0, 0x7, 0xff, 0x0,
+
+    /* U+5FD9 */
+    0x4, 0x0, 0x10, 0x0, 0x60, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0x60,
+    0x3, 0x0, 0x6, 0x0, 0x30, 0x6, 0x6c, 0x3, 0x80, 0x66, 0xdf, 0xff,
+    0xe6, 0x6f, 0xff, 0xfe, 0x66, 0x67, 0x0, 0x6, 0x60, 0x70, 0x0, 0x66,
+    0x7, 0x0, 0x6, 0x60, 0x70, 0x0, 0x66, 0x7, 0x0, 0x6, 0x60, 0x70,
+    0x0, 0x6, 0x7, 0x0, 0x0, 0x60, 0x70, 0x0, 0x6, 0x7, 0x0, 0x0,
+    0x60, 0x70, 0x0, 0x6, 0x7, 0x0, 0x0, 0x60, 0x70, 0x0, 0x6, 0x7,
+    0x0, 0x0, 0x60, 0x70, 0x0, 0x6, 0x7, 0x0, 0x0, 0x60, 0x38, 0xc,
+    0x6, 0x3, 0xff, 0xe0, 0x60, 0x1f, 0xfc, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+5FE0 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x18, 0x6, 0x1,
+    0x81, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x18,
+    0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xe0,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x60, 0x20, 0x18, 0xc7, 0x3, 0x1, 0x8c, 0x30, 0x38, 0x38, 0xc1,
+    0x11, 0xc3, 0x8c, 0x1, 0x9c, 0x30, 0xc0, 0x38, 0xe7, 0xe, 0x3, 0x86,
+    0x60, 0xff, 0xf0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5FEB */
+    0x6, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x0, 0x6, 0x0, 0xc0, 0x0, 0x60,
+    0xc, 0x0, 0x26, 0x1, 0xc0, 0x6, 0x7d, 0xff, 0xf0, 0x66, 0xdf, 0xff,
+    0x6, 0x66, 0x1c, 0x38, 0x66, 0x41, 0xc3, 0x86, 0x60, 0x1c, 0x38, 0x66,
+    0x1, 0xc3, 0x86, 0x60, 0x1c, 0x38, 0x66, 0x1, 0xc3, 0x86, 0x67, 0xff,
+    0xfe, 0x6, 0x7f, 0xff, 0xe0, 0x60, 0x1c, 0x0, 0x6, 0x3, 0xe0, 0x0,
+    0x60, 0x3f, 0x0, 0x6, 0x3, 0x30, 0x0, 0x60, 0x73, 0x80, 0x6, 0x6,
+    0x1c, 0x0, 0x60, 0xe0, 0xe0, 0x6, 0x3c, 0x7, 0x0, 0x67, 0x80, 0x7c,
+    0x6, 0xf0, 0x3, 0xe0, 0x6e, 0x0, 0xe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+5FF5 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3,
+    0xf0, 0x0, 0x0, 0x7b, 0xc0, 0x0, 0x1e, 0x1e, 0x0, 0x7, 0xc0, 0xfc,
+    0x1, 0xf0, 0x3, 0xf0, 0x3e, 0xff, 0xef, 0xe7, 0x8f, 0xfe, 0x3e, 0x60,
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0xff, 0xff,
+    0xe0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x3, 0x80, 0x0, 0xc6, 0x30, 0x0, 0x8c, 0x70, 0x30, 0x18, 0xc3,
+    0x3, 0x83, 0x8c, 0x11, 0x38, 0x38, 0xc0, 0x39, 0xc3, 0xc, 0x3, 0x9c,
+    0x70, 0xe0, 0x78, 0xe6, 0xf, 0xff, 0x6, 0x0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+600E */
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x7f,
+    0xff, 0xfc, 0x7, 0xff, 0xff, 0xc0, 0xe1, 0x80, 0x0, 0x1c, 0x18, 0x0,
+    0x3, 0xc1, 0xff, 0xc0, 0x78, 0x1f, 0xfe, 0x7, 0x1, 0xff, 0xc0, 0x60,
+    0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x1, 0xff,
+    0xf8, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0,
+    0x0, 0x40, 0x0, 0x8, 0xc7, 0x3, 0x1, 0x8c, 0x70, 0x38, 0x38, 0xc3,
+    0x83, 0x83, 0x8c, 0x1, 0x9c, 0x70, 0xc0, 0x38, 0xe7, 0xe, 0x3, 0x8e,
+    0x60, 0xff, 0xf8, 0x40, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+601D */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0xe, 0x3, 0x81, 0xc0,
+    0x60, 0x38, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1c,
+    0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0xc6, 0x0, 0x1,
+    0x8c, 0x70, 0x30, 0x38, 0xc3, 0x83, 0x83, 0x8c, 0x10, 0x1c, 0x30, 0xc0,
+    0x19, 0xc7, 0xc, 0x3, 0x8e, 0x70, 0xe0, 0x38, 0x66, 0xf, 0xff, 0x6,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6021 */
+    0x6, 0x0, 0xc0, 0x0, 0x60, 0x1c, 0x0, 0x6, 0x1, 0xc0, 0x0, 0x60,
+    0x18, 0x0, 0x26, 0x83, 0x80, 0x6, 0x6c, 0x38, 0x60, 0x66, 0xe3, 0x7,
+    0x6, 0x66, 0x70, 0x38, 0x66, 0x6, 0x1, 0xc6, 0x60, 0x63, 0xfc, 0x66,
+    0x3f, 0xff, 0xe6, 0x67, 0xff, 0x6, 0x66, 0x0, 0x0, 0x26, 0x60, 0x0,
+    0x0, 0x6, 0x7, 0xfe, 0x0, 0x60, 0xff, 0xf8, 0x6, 0x1f, 0xff, 0x80,
+    0x61, 0xc0, 0x18, 0x6, 0x18, 0x1, 0x80, 0x61, 0x80, 0x18, 0x6, 0x18,
+    0x1, 0x80, 0x61, 0x80, 0x18, 0x6, 0x1c, 0x1, 0x80, 0x61, 0xe0, 0x38,
+    0x6, 0x1f, 0xff, 0x80, 0x60, 0x7f, 0xf0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6025 */
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x3f,
+    0xfc, 0x0, 0x7, 0xff, 0xe0, 0x0, 0xf0, 0x1e, 0x0, 0x1c, 0x1, 0xc0,
+    0x7, 0xc0, 0x38, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x7, 0x0, 0x0, 0x0, 0x30, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x8e,
+    0x1, 0x83, 0x98, 0x70, 0x1c, 0x39, 0x83, 0x1c, 0xc3, 0x18, 0x11, 0xce,
+    0x71, 0x80, 0x1c, 0x66, 0x1f, 0xff, 0x80, 0x1, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6027 */
+    0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0xc, 0x30, 0x0, 0x60,
+    0xc3, 0x0, 0x26, 0xcc, 0x30, 0x6, 0x6c, 0xc3, 0x0, 0x66, 0xdf, 0xff,
+    0xc6, 0x67, 0xff, 0xfe, 0x66, 0x1f, 0xff, 0xc6, 0x61, 0x83, 0x0, 0x66,
+    0x38, 0x30, 0x6, 0x63, 0x3, 0x0, 0x66, 0x30, 0x30, 0x6, 0x67, 0x3,
+    0x0, 0x6, 0x0, 0x38, 0x0, 0x60, 0xff, 0xfc, 0x6, 0x7, 0xff, 0x80,
+    0x60, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0x0,
+    0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0,
+    0x6, 0x7f, 0xff, 0xe0, 0x67, 0xff, 0xfe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6050 */
+    0x0, 0x3, 0xf8, 0x7, 0xfe, 0x7f, 0xc0, 0x7f, 0xef, 0xfe, 0x0, 0x70,
+    0xe0, 0xe0, 0x7, 0xe, 0xe, 0x0, 0x70, 0xe0, 0xe0, 0x7, 0xe, 0xce,
+    0x0, 0x70, 0xce, 0xe0, 0x7, 0xc, 0x6e, 0x0, 0x76, 0xc7, 0xe6, 0x7,
+    0xec, 0x2e, 0x63, 0xfd, 0xc0, 0xe6, 0x7e, 0x38, 0xf, 0xe2, 0x7, 0x80,
+    0x7e, 0x0, 0x70, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x1,
+    0x8c, 0x70, 0x30, 0x18, 0xc3, 0x83, 0x83, 0x8c, 0x10, 0x1c, 0x38, 0xc0,
+    0x19, 0xc7, 0xc, 0x3, 0x8e, 0x70, 0xc0, 0x38, 0x66, 0xf, 0xff, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6069 */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x40, 0x30, 0x1c, 0x6, 0x3, 0x1, 0xc0, 0x60, 0x30, 0x1d, 0xff, 0xfb,
+    0x1, 0xdf, 0xff, 0xb0, 0x1c, 0xe, 0x3, 0x1, 0xc1, 0xf0, 0x30, 0x1c,
+    0x39, 0xc3, 0x1, 0xcf, 0xf, 0x30, 0x1d, 0xe0, 0x3b, 0x1, 0xd0, 0x0,
+    0xb0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0xc7, 0x3, 0x1, 0x9c, 0x70, 0x38, 0x39, 0xc3,
+    0x81, 0x83, 0x9c, 0x1, 0x9c, 0x71, 0xc0, 0x18, 0xe7, 0x1c, 0x3, 0x8e,
+    0x60, 0xff, 0xf8, 0x60, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+606F */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc,
+    0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x86, 0x0, 0x1, 0x98, 0x70, 0x38, 0x39, 0x83,
+    0x83, 0x83, 0x98, 0x18, 0xdc, 0x71, 0x80, 0x1c, 0xe7, 0x1c, 0x1, 0xce,
+    0x61, 0xff, 0xf8, 0x60, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+60A8 */
+    0x0, 0x0, 0x0, 0x0, 0x18, 0x20, 0x0, 0x3, 0x86, 0x0, 0x0, 0x70,
+    0xe0, 0x0, 0x7, 0xf, 0xff, 0xc0, 0xe1, 0xff, 0xfe, 0x1e, 0x38, 0x70,
+    0xc1, 0xe7, 0x7, 0x1c, 0x3e, 0x60, 0x71, 0x87, 0xe0, 0x27, 0x40, 0x66,
+    0x6, 0x76, 0x0, 0x60, 0xe7, 0x70, 0x6, 0xc, 0x73, 0x80, 0x61, 0xc7,
+    0x38, 0x6, 0x38, 0x71, 0xc0, 0x63, 0x7, 0x1c, 0x6, 0x20, 0xf0, 0x80,
+    0x60, 0x1e, 0x0, 0x4, 0x0, 0xc0, 0x0, 0xc, 0x60, 0x0, 0x18, 0xc7,
+    0x3, 0x1, 0x8c, 0x30, 0x38, 0x38, 0xc0, 0x19, 0xc3, 0xc, 0x3, 0x9c,
+    0x70, 0xc0, 0x38, 0xe7, 0xf, 0xff, 0x6, 0x0, 0x7f, 0xf0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+60B2 */
+    0x0, 0x20, 0xc0, 0x0, 0x3, 0xc, 0x0, 0x0, 0x30, 0xc0, 0x3, 0xff,
+    0xf, 0xfc, 0x3f, 0xf0, 0xff, 0xc0, 0x3, 0xc, 0x0, 0x0, 0x30, 0xc0,
+    0x1, 0xff, 0xf, 0xf0, 0x1f, 0xf0, 0xff, 0x80, 0x3, 0xf, 0xf0, 0x0,
+    0x70, 0xc0, 0x3, 0xfe, 0xc, 0x0, 0x7f, 0xe0, 0xff, 0xc0, 0x1e, 0xf,
+    0xfe, 0x3, 0xc0, 0xc0, 0x1, 0xf8, 0xc, 0x0, 0x3e, 0x0, 0xc0, 0x3,
+    0x8c, 0x60, 0x0, 0x0, 0xc7, 0x2, 0x1, 0x8c, 0x30, 0x30, 0x18, 0xc1,
+    0x3, 0x83, 0x8c, 0x1, 0x9c, 0x38, 0xc0, 0x39, 0xc7, 0xe, 0x3, 0x8e,
+    0x70, 0xff, 0xf0, 0x60, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+60B6 */
+    0x3f, 0xe1, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x19, 0x80, 0xcc,
+    0x6, 0x7f, 0xf3, 0xff, 0x9f, 0xfc, 0xff, 0xe6, 0x3, 0x30, 0x19, 0x81,
+    0xce, 0x6, 0x7f, 0xe3, 0xff, 0x9f, 0xf8, 0x7f, 0xe6, 0x0, 0x80, 0x19,
+    0x80, 0x30, 0x6, 0x60, 0xe, 0x1, 0x98, 0x9, 0xc0, 0x66, 0x3, 0x2,
+    0x19, 0x88, 0xc0, 0xc6, 0x67, 0x30, 0x31, 0x99, 0x8c, 0x6, 0x66, 0x63,
+    0x1, 0xd9, 0x98, 0xc3, 0x36, 0x66, 0x30, 0xcd, 0x9b, 0xc, 0x70, 0x66,
+    0x3, 0xfc, 0x19, 0x80, 0x7c, 0x3e, 0x60, 0x0, 0xf, 0x98, 0x0, 0x3,
+    0x80,
+
+    /* U+60C5 */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x1f, 0xff, 0xc0, 0x63,
+    0xff, 0xfc, 0x6, 0x80, 0x70, 0x6, 0x6c, 0x6, 0x0, 0x66, 0xdf, 0xff,
+    0x86, 0x67, 0xff, 0xf8, 0x66, 0x0, 0x60, 0x6, 0x60, 0x7, 0x0, 0x66,
+    0x7f, 0xff, 0xe6, 0x63, 0xff, 0xfe, 0x66, 0x0, 0x0, 0x6, 0x60, 0xff,
+    0xf8, 0x66, 0x1f, 0xff, 0x80, 0x61, 0xc0, 0x18, 0x6, 0x1c, 0x1, 0x80,
+    0x61, 0xff, 0xf8, 0x6, 0x1c, 0x1, 0x80, 0x61, 0x80, 0x18, 0x6, 0x1f,
+    0xff, 0x80, 0x61, 0xff, 0xf8, 0x6, 0x18, 0x1, 0x80, 0x61, 0x80, 0x18,
+    0x6, 0x18, 0x7, 0x80, 0x61, 0x81, 0xf8, 0x6, 0x18, 0xe, 0x0,
+
+    /* U+60E0 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff,
+    0x1, 0xc0, 0xe0, 0x38, 0x18, 0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xf0, 0x0, 0xe, 0x4, 0x0, 0x0, 0x60, 0xe0, 0x3f, 0xff, 0xff, 0x87,
+    0xff, 0xff, 0xfc, 0x0, 0x4, 0x0, 0xe0, 0x8c, 0x60, 0x20, 0x18, 0xc7,
+    0x3, 0x1, 0x8c, 0x31, 0xb8, 0x38, 0xc0, 0x39, 0xc3, 0xe, 0x3, 0x8e,
+    0x70, 0xff, 0xf0, 0xe6, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+60F3 */
+    0x1, 0x0, 0x0, 0x0, 0x60, 0x3f, 0xc0, 0xc, 0x1f, 0xfe, 0x1, 0x83,
+    0xff, 0xc7, 0xff, 0x60, 0x18, 0xff, 0xec, 0x3, 0x1, 0xe1, 0xff, 0xe0,
+    0x38, 0x3f, 0xfc, 0x7, 0xc6, 0x1, 0x81, 0xfc, 0xc0, 0x30, 0x3d, 0xdf,
+    0xfe, 0xd, 0x9b, 0xff, 0xc3, 0xb1, 0x70, 0x18, 0xe6, 0xc, 0x3, 0x18,
+    0xc1, 0xc0, 0x60, 0x18, 0x3f, 0xfc, 0x3, 0x3, 0xff, 0x80, 0x0, 0x80,
+    0x0, 0x3, 0x18, 0x0, 0xc, 0x63, 0x81, 0x83, 0x8c, 0x30, 0x38, 0x71,
+    0x82, 0x33, 0x8c, 0x30, 0xe, 0x73, 0x86, 0x1, 0xc7, 0x60, 0xff, 0xf8,
+    0x60, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+60F9 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x1, 0xc0, 0x70, 0x0, 0xc, 0xc3, 0x0, 0x0, 0x1c, 0x0,
+    0x3, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc0, 0xf, 0x0, 0x0, 0x1,
+    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x3, 0xf8, 0x0,
+    0x38, 0x79, 0x80, 0x3, 0x86, 0x18, 0x0, 0x38, 0x1, 0xff, 0xff, 0x0,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x18, 0xc7,
+    0x3, 0x3, 0x8c, 0x31, 0xb8, 0x38, 0xc0, 0x39, 0xc3, 0xe, 0x3, 0x8e,
+    0x70, 0xff, 0xf8, 0x62, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+610F */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x1, 0xc0, 0x70, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x7, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xe, 0x0, 0x7, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0x4, 0x0, 0x0, 0xc, 0x60, 0x0, 0x18, 0xc7,
+    0x3, 0x83, 0x8c, 0x31, 0x98, 0x30, 0xc0, 0x39, 0xc7, 0xe, 0x3, 0x8e,
+    0x60, 0xff, 0xf0, 0x60, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+611B */
+    0x0, 0x0, 0x7, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x80, 0x60, 0x6, 0xc, 0xe, 0x0, 0x70, 0xe0, 0xc0, 0x3, 0x87, 0x1c,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x4, 0x40, 0xe, 0x62,
+    0xc6, 0xc, 0x66, 0x6c, 0x70, 0xe6, 0x6e, 0xc0, 0x37, 0x60, 0xce, 0x7,
+    0x30, 0xc, 0x7f, 0xe1, 0x80, 0x7, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
+    0x1f, 0xff, 0xc0, 0x7, 0xff, 0xfc, 0x0, 0xfe, 0x3, 0xc0, 0x3c, 0x70,
+    0x78, 0x3, 0x83, 0xde, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1f, 0xff, 0x0,
+    0x3f, 0xf9, 0xff, 0xc7, 0xf8, 0x3, 0xfe, 0x70, 0x0, 0x1, 0xe0,
+
+    /* U+611F */
+    0x0, 0x0, 0xc6, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0xc3, 0x1, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0x80, 0xc, 0x0, 0x18, 0x0, 0xe1,
+    0x1, 0xbf, 0xe6, 0x30, 0x1b, 0xfe, 0x63, 0x3, 0x80, 0x6, 0x70, 0x39,
+    0xfc, 0x76, 0x3, 0xbf, 0xe3, 0xe0, 0x33, 0x6, 0x3c, 0x63, 0x30, 0x61,
+    0xc6, 0x73, 0x6, 0x3c, 0x67, 0x3f, 0xe7, 0xfe, 0x61, 0xfc, 0xe7, 0xe6,
+    0x0, 0xc, 0x1c, 0x0, 0xc6, 0x0, 0x1, 0x8c, 0x70, 0x70, 0x18, 0xc7,
+    0x3, 0x83, 0x8c, 0x31, 0xb8, 0x30, 0xc0, 0x19, 0xc7, 0xc, 0x3, 0x8c,
+    0x60, 0xff, 0xf8, 0x40, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+614B */
+    0x2, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x18, 0x6, 0x38, 0xcf, 0x80, 0xc1,
+    0xcf, 0xe0, 0x7f, 0xfe, 0xf0, 0x7, 0xf8, 0x6c, 0x6, 0x0, 0x2, 0xc0,
+    0xe1, 0xff, 0x8f, 0xfe, 0x1f, 0xf8, 0x7f, 0xc1, 0x81, 0x80, 0x0, 0x1f,
+    0xfc, 0xc0, 0x81, 0xff, 0xcc, 0x78, 0x18, 0x1c, 0xff, 0x81, 0xff, 0xcf,
+    0x80, 0x1f, 0xfc, 0xc0, 0x61, 0x81, 0x8c, 0x6, 0x18, 0x78, 0xff, 0xe1,
+    0x8f, 0x8f, 0xfc, 0x0, 0x60, 0x0, 0x0, 0x8c, 0x60, 0x0, 0x18, 0xc7,
+    0x3, 0x83, 0x8c, 0x31, 0x98, 0x30, 0xc0, 0x39, 0xc7, 0xc, 0x3, 0x8e,
+    0x60, 0xff, 0xf8, 0x60, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6155 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x7, 0x0, 0x7, 0xff, 0xfe,
+    0x0, 0xe0, 0x0, 0x70, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xe,
+    0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff,
+    0xc0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x38, 0x1, 0xc0, 0xf, 0x18, 0xf, 0x3, 0xc1, 0x80, 0x7c, 0x79, 0x19,
+    0x9, 0xe6, 0x31, 0xb8, 0xc6, 0x7, 0x19, 0x8e, 0x0, 0xe1, 0x8c, 0x70,
+    0x1c, 0x78, 0xe3, 0x81, 0x9f, 0x4, 0x18, 0x0, 0xe0, 0x0, 0x0,
+
+    /* U+6167 */
+    0x3, 0x0, 0x18, 0x0, 0x38, 0x1, 0x80, 0x7f, 0xfb, 0xff, 0xc0, 0x38,
+    0x3, 0xc0, 0x3, 0x80, 0x18, 0x3, 0xff, 0x3f, 0xf8, 0x3, 0x80, 0x38,
+    0x0, 0x3f, 0x1, 0x80, 0x7f, 0xf3, 0xff, 0xc7, 0xf8, 0x3, 0x80, 0x1,
+    0x0, 0x18, 0x0, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x30, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x19, 0x8e,
+    0x3, 0x3, 0x98, 0x70, 0xb8, 0x39, 0x83, 0x19, 0xc7, 0x18, 0x1, 0x8e,
+    0x71, 0xff, 0xf8, 0xe0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6176 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0xf, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x18, 0x30, 0x60, 0x1, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
+    0xc1, 0x83, 0x6, 0xc, 0x18, 0x30, 0x60, 0xc1, 0xff, 0xff, 0xfc, 0x18,
+    0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0x80, 0x30,
+    0xe, 0x39, 0x23, 0x86, 0x63, 0xb3, 0x1, 0x76, 0x3b, 0x3f, 0xf3, 0x3,
+    0xa1, 0xfe, 0x10, 0x38, 0x38, 0x0, 0x3, 0x7, 0xff, 0xe0, 0x31, 0xff,
+    0xfe, 0x7, 0x79, 0x81, 0xc0, 0x76, 0xc, 0xf0, 0x7, 0x0, 0xfc, 0x0,
+    0x60, 0xff, 0xff, 0xc6, 0xff, 0x7, 0xfe, 0xf, 0x0, 0x0, 0xe0,
+
+    /* U+61B2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0x6, 0x0, 0xe6, 0x7f, 0xff, 0xe6, 0x67, 0xff, 0xff,
+    0x62, 0x0, 0x60, 0x4, 0x7, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xc0, 0x0,
+    0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x1, 0xc7, 0xc, 0x38, 0x18, 0x30, 0xc1, 0x81,
+    0xc3, 0xc, 0x38, 0x1f, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x0, 0x86,
+    0x0, 0x1, 0xc, 0x70, 0x18, 0x30, 0xc3, 0x19, 0xc7, 0xc, 0x3, 0x8e,
+    0x70, 0xff, 0xf0, 0x66, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+61B6 */
+    0x4, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xf3,
+    0xff, 0xfc, 0x2f, 0xbf, 0xff, 0xc6, 0xec, 0x60, 0x60, 0x6e, 0xc6, 0xe,
+    0x6, 0xe0, 0x70, 0xe0, 0x6e, 0x7f, 0xff, 0xe6, 0xe0, 0x0, 0x0, 0x6e,
+    0xf, 0xfe, 0x6, 0xe3, 0xff, 0xf8, 0x6e, 0x38, 0x1, 0x86, 0xe3, 0x80,
+    0x18, 0xe, 0x3f, 0xff, 0x80, 0xe3, 0x80, 0x18, 0xe, 0x38, 0x1, 0x80,
+    0xe3, 0xff, 0xf8, 0xe, 0xf, 0xfe, 0x0, 0xe0, 0x44, 0x0, 0xe, 0x26,
+    0x61, 0x80, 0xe6, 0x67, 0xc, 0xe, 0x66, 0x36, 0xe0, 0xee, 0x60, 0x66,
+    0xe, 0xc7, 0xe, 0x60, 0xe0, 0x7f, 0xe0, 0x4, 0x1, 0xf8, 0x0,
+
+    /* U+61C9 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x3, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x86, 0x30, 0x80, 0x18, 0xe7, 0x18,
+    0x1, 0x8c, 0x7f, 0xfc, 0x19, 0xcf, 0xff, 0xc1, 0x9d, 0xe1, 0x80, 0x1b,
+    0xff, 0xff, 0x81, 0xfd, 0x7f, 0xf8, 0x18, 0xc6, 0x18, 0x1, 0x8c, 0x63,
+    0x80, 0x18, 0xc7, 0xff, 0x81, 0x8c, 0x61, 0x80, 0x18, 0xc6, 0x18, 0x1,
+    0x8c, 0x7f, 0xfc, 0x38, 0xc1, 0xff, 0xc3, 0x80, 0x0, 0x0, 0x31, 0x31,
+    0x81, 0x83, 0x33, 0x9c, 0x1c, 0x73, 0x38, 0xcc, 0xc7, 0x73, 0x80, 0xce,
+    0x66, 0x3f, 0xfc, 0x66, 0x61, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6210 */
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0xe0, 0x0, 0x1, 0x87, 0x0, 0x0,
+    0x18, 0x30, 0x0, 0x1, 0x80, 0x0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
+    0xe1, 0xc0, 0x1c, 0x0, 0x18, 0x1, 0xc0, 0x1, 0x80, 0x1c, 0x0, 0x18,
+    0x0, 0xc1, 0x1, 0xfe, 0xc, 0x38, 0x1f, 0xf8, 0xc3, 0x81, 0xff, 0x8c,
+    0x70, 0x18, 0x18, 0xe7, 0x1, 0x81, 0x86, 0xe0, 0x18, 0x18, 0x6e, 0x3,
+    0x81, 0x87, 0xc0, 0x38, 0x18, 0x38, 0x3, 0x83, 0x83, 0x80, 0x39, 0xf8,
+    0x78, 0x63, 0x1f, 0x1f, 0xc6, 0x30, 0x3, 0xce, 0x67, 0x0, 0xf0, 0x7e,
+    0x70, 0x3e, 0x7, 0xe6, 0x7, 0x80, 0x3c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6211 */
+    0x0, 0x0, 0xc0, 0x0, 0x7, 0xcc, 0x0, 0x1f, 0xf8, 0xc6, 0x3, 0xfe,
+    0xc, 0x70, 0x39, 0xc0, 0xc3, 0x80, 0x1c, 0xc, 0x38, 0x1, 0xc0, 0xc0,
+    0x0, 0x1c, 0xc, 0x0, 0x7f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xc0, 0x1c, 0xe, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x1c, 0x6,
+    0x38, 0x1, 0xdc, 0x63, 0x0, 0x1f, 0xc7, 0x70, 0x3f, 0xf0, 0x3e, 0x7,
+    0xfc, 0x3, 0xc0, 0x71, 0xc0, 0x38, 0x0, 0x1c, 0x7, 0x80, 0x1, 0xc0,
+    0xfc, 0x60, 0x1c, 0x3d, 0xc6, 0x1, 0xc7, 0x8e, 0x60, 0x1c, 0xf0, 0x7e,
+    0xf, 0x9c, 0x7, 0xc1, 0xf8, 0x0, 0x3c, 0xe, 0x0, 0x0, 0x0,
+
+    /* U+6212 */
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0xe0, 0x0, 0x1, 0x87, 0x0, 0x0,
+    0x18, 0x30, 0x0, 0x1, 0xc0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x1c, 0x0, 0x6, 0x31, 0xc0, 0x0, 0x63, 0x1c, 0x0, 0x6,
+    0x31, 0xc1, 0x80, 0x63, 0xc, 0x38, 0x6, 0x30, 0xc3, 0x0, 0xe3, 0xc,
+    0x70, 0x7f, 0xfe, 0xc6, 0x3, 0xff, 0xee, 0xe0, 0xe, 0x30, 0x6c, 0x0,
+    0xc3, 0x7, 0xc0, 0xc, 0x30, 0x78, 0x0, 0xc3, 0x7, 0x80, 0x1c, 0x30,
+    0x78, 0x63, 0x83, 0xf, 0xc6, 0x38, 0x33, 0xdc, 0x67, 0x3, 0x78, 0xfe,
+    0x60, 0xf, 0x7, 0xe0, 0x1, 0xc0, 0x3c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6216 */
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x1c, 0x60, 0x0, 0x1, 0xc7, 0x0, 0x0,
+    0x1c, 0x30, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xc0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xfe, 0xc, 0x0, 0x1f,
+    0xf8, 0xc1, 0x83, 0x83, 0x8c, 0x30, 0x38, 0x18, 0xc7, 0x3, 0x81, 0x8e,
+    0x70, 0x38, 0x18, 0x6e, 0x3, 0x83, 0x86, 0xe0, 0x1f, 0xf8, 0x7c, 0x0,
+    0xfe, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0, 0x3, 0xc7, 0x82, 0x7, 0xfc,
+    0xfc, 0x67, 0xfe, 0x1d, 0xc6, 0x7e, 0x7, 0x8e, 0x60, 0x1, 0xf0, 0x7e,
+    0x0, 0x7c, 0x3, 0xe0, 0x7, 0x80, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6221 */
+    0x8, 0x18, 0x30, 0x1, 0xc1, 0x83, 0x0, 0x1c, 0x18, 0x32, 0x7, 0xff,
+    0xe3, 0x38, 0x7f, 0xff, 0x31, 0x81, 0xc1, 0x83, 0x8, 0x1c, 0x18, 0x30,
+    0x1, 0xff, 0x83, 0xe, 0x1f, 0xf9, 0xff, 0xe1, 0xc1, 0xbf, 0xfc, 0x1f,
+    0xf9, 0xb0, 0x1, 0xff, 0x83, 0x0, 0x1c, 0x18, 0x38, 0xc1, 0xc1, 0x83,
+    0x9c, 0x7f, 0xff, 0x19, 0xc7, 0xff, 0xf1, 0x98, 0x33, 0x60, 0x1b, 0x3,
+    0x36, 0x21, 0xf0, 0x36, 0x66, 0x1e, 0x3, 0x67, 0xe0, 0xe0, 0x3e, 0x3e,
+    0x1c, 0x63, 0x40, 0x3, 0xe6, 0x38, 0x0, 0x7e, 0x63, 0xff, 0xce, 0x76,
+    0x1f, 0xfd, 0xc3, 0xe0, 0x0, 0x38, 0x1c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+622A */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x77, 0x1, 0xff,
+    0xf7, 0x38, 0x1f, 0xfe, 0x71, 0x80, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x40, 0x7, 0x0, 0xc,
+    0x30, 0x30, 0x0, 0xc3, 0x3, 0x8, 0x1f, 0xff, 0x31, 0xc3, 0xff, 0xf3,
+    0x18, 0x38, 0x60, 0x33, 0x87, 0xc7, 0x3, 0xb8, 0x7f, 0xff, 0x3b, 0x1,
+    0x86, 0x1, 0xf0, 0x18, 0x60, 0x1e, 0x1, 0xff, 0xe1, 0xe2, 0x1f, 0xfe,
+    0x1c, 0x61, 0x86, 0x3, 0xe6, 0x1c, 0x60, 0x7e, 0x60, 0xff, 0xef, 0x7e,
+    0x7, 0xff, 0xe3, 0xe0, 0x0, 0x38, 0x1c, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+6230 */
+    0x0, 0x0, 0x0, 0x3, 0xe3, 0xe3, 0x0, 0x3f, 0x7f, 0x3b, 0x7, 0x36,
+    0x33, 0xb8, 0x63, 0x63, 0x39, 0xc7, 0x36, 0x33, 0x8c, 0x3f, 0x7f, 0x38,
+    0x1, 0xe3, 0xc3, 0x80, 0x0, 0x0, 0xff, 0xe3, 0xff, 0xef, 0xfc, 0x3f,
+    0xfe, 0xb8, 0x3, 0xc, 0x63, 0x80, 0x3f, 0xfe, 0x18, 0x3, 0xff, 0xe1,
+    0x8c, 0x31, 0xc6, 0x19, 0xc3, 0xc, 0x61, 0x98, 0x3f, 0xfe, 0x1b, 0x81,
+    0xff, 0xe1, 0xf0, 0x1, 0xc0, 0x1e, 0x0, 0x1c, 0x0, 0xe0, 0x7f, 0xff,
+    0x1c, 0x67, 0xff, 0xf7, 0xe6, 0x0, 0xc0, 0xf6, 0x60, 0xc, 0x1e, 0x76,
+    0x0, 0xc3, 0xc3, 0xe0, 0xc, 0x30, 0x1c, 0x0, 0x80, 0x0, 0x80,
+
+    /* U+6232 */
+    0x1, 0x80, 0x18, 0x0, 0x18, 0x1, 0x80, 0x1, 0xfe, 0x18, 0x0, 0x1f,
+    0xc1, 0xb8, 0x1, 0x80, 0x19, 0x81, 0xff, 0xe1, 0x8c, 0x3f, 0xff, 0x18,
+    0x3, 0x98, 0x31, 0x80, 0x31, 0xfb, 0x7f, 0xe3, 0xff, 0x8f, 0xfe, 0x31,
+    0x83, 0x78, 0x3, 0x1f, 0xe1, 0x80, 0x30, 0xfe, 0x18, 0x43, 0x0, 0x1,
+    0x8c, 0x3f, 0xff, 0x19, 0xc3, 0xff, 0xe1, 0xd8, 0x31, 0xf8, 0xf, 0x83,
+    0x7f, 0xe0, 0xf0, 0x36, 0x6, 0xf, 0x3, 0x60, 0x60, 0xe0, 0x37, 0xfe,
+    0x1e, 0x27, 0x10, 0x83, 0xe6, 0x61, 0x18, 0x7b, 0x66, 0x1b, 0xef, 0x3e,
+    0x6f, 0xff, 0xc1, 0xe6, 0xf8, 0x38, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6234 */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x7, 0x0, 0x1f, 0xfe, 0x77, 0x3, 0xff,
+    0xf7, 0x38, 0x0, 0xc0, 0x71, 0x80, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x70, 0x1, 0xff, 0xe3, 0x0, 0x3f,
+    0xff, 0x30, 0x3, 0xc, 0x33, 0xc, 0x3f, 0xff, 0x31, 0xc3, 0x1c, 0x73,
+    0x1c, 0x31, 0xc7, 0x31, 0x83, 0xff, 0xe3, 0xb8, 0x6, 0x18, 0x3b, 0x3,
+    0xff, 0xf1, 0xf0, 0x3f, 0xff, 0x1e, 0x0, 0x61, 0x81, 0xe0, 0x3f, 0xff,
+    0x1c, 0x67, 0xff, 0xf9, 0xe6, 0x0, 0x0, 0x3e, 0x60, 0xe1, 0x8f, 0x76,
+    0x3c, 0xc, 0xe3, 0xe7, 0x80, 0x5c, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6236 */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x3f, 0xe0, 0x3f, 0xff, 0xf0, 0x3f, 0xff,
+    0xe0, 0xf, 0xc0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xe0, 0xc0, 0x0, 0x38,
+    0x30, 0x0, 0x6, 0xc, 0x0, 0x1, 0x83, 0x0, 0x0, 0x60, 0xc0, 0x0,
+    0x18, 0x70, 0x0, 0x6, 0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xe0, 0x70, 0x0, 0x0, 0x18, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3,
+    0x80, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x1c, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+623F */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3,
+    0x81, 0x80, 0x0, 0x1c, 0x18, 0x0, 0x1, 0xc1, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0x81, 0x80, 0x38, 0x0, 0x18, 0x3, 0x80, 0x1, 0xbf, 0xff,
+    0xfc, 0x1b, 0xff, 0xff, 0xe3, 0x80, 0xc0, 0x0, 0x38, 0xc, 0x0, 0x3,
+    0x80, 0xff, 0xc0, 0x30, 0x1f, 0xff, 0x3, 0x1, 0xc0, 0x78, 0x30, 0x38,
+    0x3, 0x87, 0x7, 0x0, 0x30, 0x71, 0xe0, 0x3, 0x6, 0x3c, 0x7, 0xf0,
+    0x67, 0x80, 0xfe, 0x0, 0x40, 0x6, 0x0,
+
+    /* U+6240 */
+    0x0, 0x0, 0x0, 0x83, 0xff, 0x80, 0xfc, 0x7f, 0xfc, 0xff, 0xc3, 0xff,
+    0x9f, 0xc0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80,
+    0x0, 0xff, 0x18, 0x0, 0x1f, 0xf9, 0x80, 0x3, 0x83, 0x98, 0x0, 0x38,
+    0x19, 0xff, 0xe3, 0x81, 0x9f, 0xfe, 0x38, 0x19, 0x83, 0x3, 0x81, 0x98,
+    0x30, 0x3f, 0xf9, 0x83, 0x3, 0xff, 0x98, 0x30, 0x3f, 0xe3, 0x83, 0x3,
+    0x80, 0x38, 0x30, 0x30, 0x3, 0x3, 0x3, 0x0, 0x70, 0x30, 0x30, 0x7,
+    0x3, 0x3, 0x0, 0xe0, 0x30, 0x70, 0x1e, 0x3, 0x7, 0x1, 0xc0, 0x30,
+    0x60, 0x38, 0x3, 0x6, 0x3, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+624B */
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x3f, 0xf8, 0x1f, 0xff, 0xff, 0x3, 0xff,
+    0xf8, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70,
+    0x0, 0x0, 0x7, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+6253 */
+    0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0xf, 0xff, 0xc0, 0x71,
+    0xff, 0xfe, 0x7, 0xf, 0xff, 0xc0, 0x70, 0x1, 0xc0, 0x7f, 0xf0, 0x1c,
+    0x7, 0xfe, 0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x70, 0x1, 0xc0, 0x7,
+    0x0, 0x1c, 0x0, 0x70, 0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x7f, 0x1,
+    0xc0, 0xf, 0xf0, 0x1c, 0x3, 0xf8, 0x1, 0xc0, 0x7f, 0x0, 0x1c, 0x2,
+    0x70, 0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x70, 0x1, 0xc0, 0x7, 0x0,
+    0x1c, 0x0, 0x70, 0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x70, 0x1, 0xc0,
+    0x3f, 0x1, 0xf8, 0x3, 0xf0, 0x1f, 0x80, 0x3c, 0x1, 0xe0, 0x0,
+
+    /* U+6258 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x78, 0x6, 0x0, 0x7f, 0x80, 0x60,
+    0xff, 0xe0, 0x6, 0x1f, 0xe0, 0x0, 0x71, 0xce, 0x0, 0x7f, 0xe0, 0xe0,
+    0x7, 0xfe, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x60, 0xe, 0x0, 0x6,
+    0x0, 0xe0, 0x0, 0x60, 0xe, 0xe, 0x6, 0x0, 0xff, 0xe0, 0x7d, 0xff,
+    0xfc, 0xf, 0xdf, 0xe0, 0x7, 0xf8, 0xe, 0x0, 0x7f, 0x0, 0xe0, 0x0,
+    0x60, 0xe, 0x0, 0x6, 0x0, 0xe0, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0,
+    0xe0, 0x60, 0x60, 0xe, 0x6, 0x6, 0x0, 0xe0, 0x60, 0x60, 0xf, 0xfe,
+    0x3e, 0x0, 0x7f, 0xe3, 0xe0, 0x3, 0xf8, 0x3c, 0x0, 0x0, 0x0,
+
+    /* U+6263 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x1, 0xf8, 0x1, 0x81,
+    0xff, 0xe0, 0x30, 0x3f, 0xfc, 0xe, 0x6, 0x3, 0x9f, 0xfc, 0xc0, 0x33,
+    0xff, 0x98, 0x6, 0x3, 0x3, 0x0, 0xc0, 0x60, 0x60, 0x18, 0xc, 0xc,
+    0x3, 0x1, 0x81, 0x80, 0x60, 0x30, 0x30, 0xc, 0x6, 0xe6, 0x1, 0x81,
+    0xfc, 0xc0, 0x30, 0xff, 0x18, 0x6, 0x7f, 0x3, 0x0, 0xce, 0xe0, 0x60,
+    0x18, 0xc, 0xc, 0x3, 0x1, 0x81, 0x80, 0x60, 0x30, 0x30, 0xc, 0x6,
+    0x6, 0x1, 0x80, 0xc0, 0xc0, 0x70, 0x38, 0x1f, 0xfe, 0x3f, 0x3, 0xff,
+    0xc7, 0xc0, 0x1f, 0xc0, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+627F */
+    0xf, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0,
+    0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x7, 0x18,
+    0x7, 0xf0, 0x61, 0x80, 0x7f, 0x6, 0x18, 0xc0, 0x77, 0xfd, 0x9c, 0x3,
+    0x7f, 0xdb, 0x80, 0x30, 0xe1, 0xf0, 0x3, 0x6, 0x1e, 0x0, 0x77, 0xfc,
+    0xc0, 0x7, 0x7f, 0xcc, 0x0, 0x60, 0xe0, 0xe0, 0xe, 0x6, 0x6, 0x0,
+    0xc0, 0xe0, 0x70, 0x1d, 0xff, 0xf3, 0x3, 0x8f, 0xfe, 0x38, 0x38, 0x6,
+    0x1, 0xc7, 0x0, 0x60, 0xe, 0x60, 0xe, 0x0, 0xe4, 0x3, 0xe0, 0x0,
+    0x0, 0x7c, 0x0, 0x0, 0x7, 0x80, 0x0,
+
+    /* U+6280 */
+    0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x3f, 0xff, 0xc0, 0xe3, 0xff, 0xfe, 0x7f, 0xdf, 0xff,
+    0x87, 0xf8, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6,
+    0xf, 0xfe, 0x0, 0x61, 0xff, 0xf8, 0x6, 0xf, 0xff, 0x80, 0x6c, 0x0,
+    0x38, 0xf, 0xc4, 0x3, 0x7, 0xf8, 0x60, 0x70, 0x7e, 0x7, 0xe, 0x4,
+    0x60, 0x30, 0xe0, 0x6, 0x3, 0x9c, 0x0, 0x60, 0x1f, 0x80, 0x6, 0x0,
+    0xf0, 0x0, 0x60, 0x1f, 0x80, 0x6, 0x7, 0xfe, 0x0, 0xe1, 0xf9, 0xf8,
+    0x3e, 0x7e, 0x7, 0xe7, 0xcf, 0x80, 0x1e, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+6293 */
+    0x6, 0x0, 0x0, 0xc0, 0x60, 0x1, 0xfc, 0x6, 0xf, 0xff, 0xc0, 0x61,
+    0xff, 0xf0, 0x6, 0x1c, 0xe3, 0x0, 0xe1, 0x8e, 0x30, 0x7f, 0xd8, 0xe3,
+    0x7, 0xfd, 0x8e, 0x30, 0x6, 0x18, 0xe3, 0x0, 0x61, 0x8e, 0x30, 0x6,
+    0x18, 0xe3, 0x0, 0x61, 0x8e, 0x30, 0x6, 0x18, 0xe3, 0x0, 0x69, 0x8e,
+    0x30, 0xf, 0xd8, 0xe3, 0x87, 0xfb, 0x8e, 0x38, 0x7e, 0x38, 0xe3, 0x86,
+    0x63, 0x8e, 0x18, 0x6, 0x38, 0xe1, 0x80, 0x63, 0xe, 0x18, 0x6, 0x30,
+    0xe1, 0xc0, 0x63, 0xe, 0x1c, 0x6, 0x70, 0xe0, 0xc0, 0xe6, 0xe, 0xe,
+    0x3e, 0xe0, 0xe0, 0xe7, 0xcc, 0xc, 0x6, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+6295 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x3f, 0x0, 0x6, 0x7, 0xf8, 0x0, 0x60,
+    0xe1, 0xc0, 0x6, 0xe, 0x1c, 0x0, 0x60, 0xe1, 0xc0, 0x7f, 0xce, 0x1c,
+    0x67, 0xfc, 0xc1, 0xc6, 0x6, 0xc, 0x1c, 0x60, 0x61, 0xc0, 0xfe, 0x6,
+    0x38, 0xf, 0xc0, 0x63, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x6d, 0xff,
+    0xf0, 0xf, 0xdf, 0xff, 0x87, 0xf8, 0x0, 0x78, 0x7e, 0x6, 0x7, 0x0,
+    0x60, 0x70, 0xe0, 0x6, 0x7, 0x1c, 0x0, 0x60, 0x3b, 0x80, 0x6, 0x1,
+    0xf8, 0x0, 0x60, 0xf, 0x0, 0x6, 0x1, 0xfc, 0x0, 0x60, 0xfb, 0xf8,
+    0x3e, 0x7e, 0xf, 0xe3, 0xe7, 0x80, 0x3e, 0x10, 0x40, 0x0, 0x0,
+
+    /* U+6297 */
+    0x6, 0x0, 0x20, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x61, 0xff, 0xfc, 0x7f, 0xdf, 0xff,
+    0xe7, 0xfc, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x1, 0xf8, 0x0, 0x60, 0x7f, 0xc0, 0x6, 0x7, 0xfe, 0x0, 0x6c, 0x70,
+    0xe0, 0xf, 0xc6, 0xe, 0x7, 0xf8, 0x60, 0xe0, 0x7e, 0x6, 0xe, 0x0,
+    0x60, 0x60, 0xe0, 0x6, 0x6, 0xe, 0x0, 0x60, 0x60, 0xe0, 0x6, 0xe,
+    0xe, 0x60, 0x60, 0xc0, 0xe6, 0x6, 0x1c, 0xe, 0x60, 0x63, 0x80, 0xee,
+    0x3e, 0x78, 0x7, 0xe3, 0xc7, 0x0, 0x3c, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+62BD */
+    0x6, 0x0, 0x20, 0x0, 0xc0, 0x6, 0x0, 0x18, 0x0, 0xc0, 0x3, 0x0,
+    0x18, 0x0, 0x60, 0x3, 0x0, 0xc, 0x0, 0x60, 0x1f, 0xf1, 0xff, 0xe3,
+    0xfe, 0x7f, 0xfe, 0x6, 0x1c, 0x71, 0xc0, 0xc3, 0x86, 0x18, 0x18, 0x70,
+    0xc3, 0x3, 0xe, 0x18, 0x60, 0x61, 0xc3, 0xc, 0xd, 0xb8, 0x61, 0x83,
+    0xf7, 0x1c, 0x33, 0xfc, 0xff, 0xfe, 0x7e, 0x1f, 0xff, 0xc8, 0xc3, 0x86,
+    0x18, 0x18, 0x70, 0xc3, 0x3, 0xe, 0x18, 0x60, 0x61, 0xc3, 0xc, 0xc,
+    0x38, 0x61, 0x81, 0x87, 0xc, 0x30, 0x30, 0xe3, 0x86, 0x3e, 0xf, 0xff,
+    0xc7, 0x81, 0xff, 0xf0, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+62C6 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x3, 0xfc, 0x6, 0x7, 0xff, 0x80, 0x60,
+    0xff, 0x80, 0x6, 0xe, 0x0, 0x0, 0xe0, 0xc0, 0x0, 0x7f, 0xcc, 0x0,
+    0x7, 0xfc, 0xc0, 0x0, 0x6, 0xc, 0x0, 0x0, 0x60, 0xff, 0xfe, 0x6,
+    0xf, 0xff, 0xe0, 0x60, 0xc0, 0xe0, 0x6, 0xc, 0xc, 0x0, 0x6d, 0xc0,
+    0xc0, 0xf, 0xdc, 0xc, 0x7, 0xf9, 0xcc, 0xc0, 0x7e, 0x18, 0xfc, 0x6,
+    0x61, 0x87, 0xe0, 0x6, 0x18, 0xf, 0x80, 0x61, 0x80, 0xfc, 0x6, 0x38,
+    0xc, 0xe0, 0x63, 0x0, 0xc6, 0x6, 0x70, 0xc, 0x0, 0x67, 0x0, 0xc0,
+    0x3e, 0xe0, 0xc, 0x7, 0xcc, 0x0, 0xc0, 0x38, 0x0, 0x4, 0x0,
+
+    /* U+62C9 */
+    0x6, 0x0, 0x20, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x7, 0x0, 0x7f, 0xdf, 0xff,
+    0xe7, 0xfd, 0xff, 0xfc, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x3, 0x80, 0x60, 0xc0, 0x38, 0x6, 0xe, 0x3, 0x0, 0x7c, 0xe0,
+    0x30, 0xf, 0xc6, 0x7, 0x7, 0xf8, 0x60, 0x70, 0x7e, 0x7, 0x6, 0x0,
+    0x60, 0x70, 0x60, 0x6, 0x7, 0x6, 0x0, 0x60, 0x30, 0xe0, 0x6, 0x3,
+    0xc, 0x0, 0x60, 0x0, 0xc0, 0x6, 0x0, 0xc, 0x0, 0x67, 0xff, 0xfe,
+    0x3e, 0x7f, 0xff, 0xe3, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+62CD */
+    0x6, 0x0, 0x60, 0x0, 0xc0, 0xc, 0x0, 0x18, 0x3, 0x80, 0x3, 0x0,
+    0x70, 0x0, 0x60, 0xe, 0x0, 0xc, 0x1f, 0xff, 0x1f, 0xf3, 0xff, 0xf3,
+    0xfe, 0xe0, 0xe, 0x6, 0x1c, 0x0, 0xc0, 0xc3, 0x80, 0x18, 0x18, 0x70,
+    0x3, 0x3, 0xe, 0x0, 0x60, 0x61, 0xc0, 0xc, 0xd, 0xb8, 0x1, 0x83,
+    0xf7, 0xff, 0xf3, 0xfc, 0xff, 0xfe, 0x7e, 0x1c, 0x1, 0xc0, 0xc3, 0x80,
+    0x18, 0x18, 0x70, 0x3, 0x3, 0xe, 0x0, 0x60, 0x61, 0xc0, 0xc, 0xc,
+    0x38, 0x1, 0x81, 0x87, 0x0, 0x30, 0x30, 0xff, 0xfe, 0x3e, 0xf, 0xff,
+    0xc7, 0xc0, 0xff, 0xe0, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+62D2 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x3f, 0xff, 0xe0, 0x63,
+    0xff, 0xfe, 0x6, 0xc, 0x0, 0x0, 0xe0, 0xc0, 0x0, 0x7f, 0xcc, 0x0,
+    0x7, 0xfc, 0xc0, 0x0, 0x6, 0xc, 0x0, 0x0, 0x60, 0xff, 0xfc, 0x6,
+    0xf, 0xff, 0xc0, 0x60, 0xc0, 0x1c, 0x6, 0xc, 0x0, 0xc0, 0x64, 0xc0,
+    0xc, 0xf, 0xcc, 0x0, 0xc7, 0xf8, 0xc0, 0xc, 0x7e, 0xf, 0xff, 0xc6,
+    0x60, 0xff, 0xfc, 0x6, 0xe, 0x0, 0x0, 0x60, 0xc0, 0x0, 0x6, 0xc,
+    0x0, 0x0, 0x60, 0xc0, 0x0, 0x6, 0xc, 0x0, 0x0, 0xe1, 0xe0, 0x0,
+    0x3e, 0x7f, 0xff, 0xe7, 0xc7, 0xff, 0xfe, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+62D3 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x3f, 0xff, 0xe0, 0x63,
+    0xff, 0xfe, 0x6, 0x1, 0xc0, 0x0, 0x60, 0x18, 0x0, 0x7f, 0xc1, 0x80,
+    0x7, 0xfc, 0x38, 0x0, 0x6, 0x3, 0x0, 0x0, 0x60, 0x30, 0x0, 0x6,
+    0x7, 0x0, 0x0, 0x60, 0x60, 0x0, 0x6, 0xe, 0x0, 0x0, 0x7c, 0xff,
+    0xf8, 0x1f, 0xdf, 0xff, 0xc7, 0xe3, 0xf0, 0x1c, 0x7e, 0x3e, 0x0, 0xc0,
+    0x67, 0x60, 0xc, 0x6, 0xe6, 0x0, 0xc0, 0x64, 0x60, 0xc, 0x6, 0x6,
+    0x0, 0xc0, 0x60, 0x60, 0xc, 0x6, 0x6, 0x0, 0xc0, 0xe0, 0x78, 0x3c,
+    0x3e, 0x7, 0xff, 0xc7, 0xc0, 0x1f, 0xf8, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+62D4 */
+    0x0, 0x0, 0x0, 0x0, 0x60, 0x8, 0x0, 0x6, 0x1, 0xc6, 0x0, 0x60,
+    0x1c, 0x70, 0x6, 0x1, 0xc3, 0x0, 0x60, 0x18, 0x10, 0xe, 0x1, 0xc0,
+    0x7, 0xfd, 0xff, 0xfe, 0x7f, 0x9f, 0xff, 0xe0, 0x60, 0x18, 0x0, 0x6,
+    0x3, 0x80, 0x0, 0x60, 0x38, 0x0, 0x6, 0x3, 0xc1, 0x80, 0x60, 0x3c,
+    0x38, 0x6, 0x87, 0xc3, 0x0, 0xfc, 0x74, 0x30, 0x7f, 0x86, 0x67, 0x7,
+    0xe0, 0x66, 0x60, 0x66, 0xe, 0x36, 0x0, 0x60, 0xc3, 0xc0, 0x6, 0x1c,
+    0x1c, 0x0, 0x63, 0x81, 0xc0, 0x6, 0x70, 0x3e, 0x0, 0x67, 0x7, 0x78,
+    0x6, 0xe1, 0xe3, 0xc3, 0xe4, 0x3c, 0x1e, 0x7c, 0x7, 0x80, 0xe3, 0x80,
+    0x20, 0x0,
+
+    /* U+62DB */
+    0x6, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x18, 0x7f, 0xff, 0x3, 0xf,
+    0xff, 0xe0, 0x60, 0x1c, 0xc, 0x7f, 0x3, 0x81, 0x9f, 0xf0, 0x60, 0x33,
+    0xfe, 0xc, 0x6, 0x6, 0x1, 0x80, 0xc0, 0xc0, 0x70, 0x38, 0x18, 0x1c,
+    0x7, 0x3, 0x7, 0x7, 0xc0, 0x61, 0xe1, 0xf8, 0xf, 0xb0, 0x1c, 0x3,
+    0xe0, 0x0, 0x3, 0xf8, 0x3f, 0xf8, 0x7e, 0xf, 0xff, 0x80, 0xc1, 0xc0,
+    0x38, 0x18, 0x30, 0x7, 0x3, 0x6, 0x0, 0xe0, 0x60, 0xc0, 0x1c, 0xc,
+    0x18, 0x3, 0x81, 0x83, 0x0, 0x70, 0x70, 0x60, 0xe, 0x3e, 0xf, 0xff,
+    0xc7, 0x81, 0xff, 0xf0, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+62DC */
+    0x0, 0x20, 0x0, 0x0, 0xff, 0x0, 0x0, 0x7f, 0xef, 0xff, 0xe7, 0xf0,
+    0xff, 0xfc, 0x3, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x38,
+    0x0, 0x30, 0x7f, 0xfc, 0x7f, 0xf7, 0xff, 0xc7, 0xff, 0x3, 0x0, 0x7,
+    0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x7, 0xff, 0x80, 0x30, 0x7f,
+    0xfc, 0x3, 0x20, 0x38, 0x0, 0x7f, 0x3, 0x0, 0x7f, 0xe0, 0x30, 0x7,
+    0xf1, 0xff, 0xfe, 0x6, 0x3f, 0xff, 0xe0, 0x61, 0xff, 0xfe, 0xe, 0x0,
+    0x30, 0x0, 0xc0, 0x3, 0x0, 0x1c, 0x0, 0x30, 0x3, 0x80, 0x3, 0x0,
+    0x78, 0x0, 0x30, 0x7, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+62FF */
+    0x0, 0x6, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0xf,
+    0x1e, 0x0, 0x3, 0xe0, 0x78, 0x0, 0xfc, 0x7, 0xf0, 0x7f, 0xff, 0xf7,
+    0xe7, 0x80, 0x0, 0x1e, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0, 0xe,
+    0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff,
+    0xe0, 0x0, 0x0, 0x7, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xe0, 0x0,
+    0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+6307 */
+    0x6, 0x8, 0x0, 0x0, 0x61, 0xc0, 0x18, 0x6, 0x1c, 0xf, 0x80, 0x61,
+    0xcf, 0xf8, 0x6, 0x1f, 0xfc, 0x0, 0x61, 0xf8, 0x0, 0x7f, 0xdc, 0x0,
+    0x7, 0xfd, 0xc0, 0x6, 0x6, 0x1c, 0x0, 0xe0, 0x61, 0xff, 0xfe, 0x6,
+    0xf, 0xff, 0xe0, 0x60, 0x7f, 0xf8, 0x6, 0x0, 0x0, 0x0, 0x6c, 0x0,
+    0x0, 0xf, 0xcf, 0xff, 0x87, 0xf8, 0xff, 0xfc, 0x7e, 0x1c, 0x1, 0xc6,
+    0x61, 0xc0, 0x1c, 0x6, 0x1c, 0x1, 0xc0, 0x61, 0xff, 0xfc, 0x6, 0x1f,
+    0xff, 0xc0, 0x61, 0xc0, 0x1c, 0x6, 0x1c, 0x1, 0xc0, 0xe1, 0xc0, 0x1c,
+    0x3e, 0xf, 0xff, 0xc3, 0xe0, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+6311 */
+    0x4, 0x1, 0x10, 0x0, 0xe0, 0x31, 0x80, 0xe, 0x3, 0x98, 0x0, 0xe0,
+    0x39, 0x80, 0xe, 0x3, 0x98, 0x0, 0xe2, 0x39, 0x8c, 0x7f, 0xb3, 0x98,
+    0xc7, 0xfb, 0xb9, 0x9c, 0xe, 0x1b, 0x1b, 0x80, 0xe1, 0xb1, 0xb0, 0xe,
+    0xb, 0x18, 0x0, 0xe0, 0x31, 0x80, 0xe, 0x3, 0x18, 0x0, 0xec, 0x31,
+    0xa0, 0xf, 0xc7, 0x1b, 0x7, 0xf0, 0xf1, 0xb8, 0x7e, 0x3f, 0x19, 0xc0,
+    0xe7, 0xb1, 0x8e, 0xe, 0x63, 0x18, 0x40, 0xe0, 0x61, 0x80, 0xe, 0x6,
+    0x18, 0x0, 0xe0, 0xe1, 0x86, 0xe, 0x1c, 0x18, 0x60, 0xe3, 0x81, 0xce,
+    0x3e, 0x78, 0x1f, 0xe7, 0xcf, 0x1, 0xfc, 0x30, 0x40, 0x0, 0x0,
+
+    /* U+632A */
+    0x4, 0x0, 0x0, 0x0, 0xe3, 0xf0, 0x38, 0xe, 0x7f, 0xdf, 0xe0, 0xe7,
+    0xfd, 0xfe, 0xe, 0x1c, 0xd8, 0x60, 0xe1, 0xcd, 0x8e, 0x7f, 0x98, 0xd8,
+    0xc7, 0xf1, 0xcd, 0x8c, 0xe, 0x7f, 0xd9, 0xc0, 0xe7, 0xfd, 0x98, 0xe,
+    0x18, 0xd9, 0x80, 0xe1, 0x8d, 0xb0, 0xe, 0x18, 0xd9, 0x80, 0xf1, 0x8d,
+    0x9c, 0xf, 0xbf, 0xd8, 0xc7, 0xf7, 0xfd, 0x8e, 0x7e, 0x3f, 0xd8, 0x60,
+    0xe1, 0x8d, 0x86, 0xe, 0x30, 0xd8, 0x60, 0xe3, 0xd, 0x86, 0xe, 0x31,
+    0x98, 0xe0, 0xe7, 0x19, 0xbe, 0xe, 0x61, 0x9b, 0xc0, 0xee, 0x39, 0x90,
+    0x3c, 0xcf, 0x98, 0x7, 0xc8, 0xf1, 0x80, 0x38, 0x0, 0x18, 0x0,
+
+    /* U+633A */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x4, 0xc, 0x7e, 0xf, 0xc0, 0xc7,
+    0xef, 0xfc, 0xc, 0xe, 0xfe, 0x0, 0xe0, 0xc0, 0xe0, 0x7f, 0x8c, 0xe,
+    0x7, 0xf9, 0x80, 0xe0, 0xc, 0x18, 0xe, 0x0, 0xc3, 0x80, 0xe0, 0xc,
+    0x38, 0x7f, 0xe0, 0xc3, 0xff, 0xfe, 0xc, 0x3f, 0xe, 0x0, 0xf0, 0x30,
+    0xe0, 0xf, 0xe3, 0xe, 0x7, 0xf6, 0x30, 0xe0, 0x7c, 0x76, 0xe, 0x0,
+    0xc3, 0x60, 0xe0, 0xc, 0x36, 0xe, 0x0, 0xc1, 0xe7, 0xfc, 0xc, 0x1c,
+    0x7f, 0xc0, 0xc1, 0xe0, 0x0, 0xc, 0x3f, 0x80, 0x0, 0xc7, 0x3f, 0x0,
+    0x3c, 0xe1, 0xff, 0xe7, 0xce, 0x3, 0xfe, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+6377 */
+    0x4, 0x0, 0x40, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x3f, 0xff, 0xc0, 0xe7,
+    0xff, 0xfe, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0x6, 0x0, 0x7f, 0x9f, 0xff,
+    0x7, 0xf9, 0xff, 0xf8, 0xe, 0x0, 0xe3, 0x80, 0xe0, 0x6, 0x18, 0xe,
+    0x3f, 0xff, 0xe0, 0xe7, 0xff, 0xfe, 0xe, 0x0, 0xe1, 0x80, 0xf8, 0x6,
+    0x18, 0xf, 0x80, 0xe3, 0x87, 0xf1, 0xff, 0xf8, 0x7e, 0xf, 0xfc, 0x0,
+    0xe0, 0x86, 0x0, 0xe, 0x18, 0x60, 0x0, 0xe1, 0x87, 0xf8, 0xe, 0x18,
+    0x7f, 0x80, 0xe3, 0xc6, 0x0, 0xe, 0x3e, 0x60, 0x0, 0xe7, 0x7e, 0x0,
+    0x3c, 0xe3, 0xff, 0xe7, 0xdc, 0xf, 0xfe, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+6383 */
+    0x4, 0x0, 0x0, 0x0, 0xc1, 0xff, 0xe0, 0xe, 0x1f, 0xff, 0x0, 0xe0,
+    0x0, 0x38, 0xe, 0x0, 0x3, 0x80, 0xe3, 0xff, 0xfe, 0x7f, 0xbf, 0xff,
+    0xe7, 0xf8, 0x0, 0x38, 0xe, 0xf, 0xff, 0x80, 0xe1, 0xff, 0xf0, 0xe,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x3f, 0xff, 0xc0, 0xf7, 0xff,
+    0xfe, 0xf, 0xe0, 0x60, 0x67, 0xf6, 0x6, 0x6, 0x7e, 0x2f, 0xff, 0x40,
+    0xe1, 0xff, 0xf8, 0xe, 0x18, 0x63, 0x80, 0xe1, 0x86, 0x18, 0xe, 0x18,
+    0x61, 0x80, 0xe1, 0x86, 0x18, 0xe, 0x18, 0x67, 0x80, 0xe1, 0x86, 0xf8,
+    0x3c, 0x18, 0x66, 0x7, 0xc0, 0x6, 0x0, 0x30, 0x0, 0x60, 0x0,
+
+    /* U+638C */
+    0x6, 0x6, 0x4, 0x0, 0x70, 0x60, 0xe0, 0x3, 0x6, 0x1c, 0x0, 0x10,
+    0xe0, 0x80, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0xe7, 0x3f, 0xff, 0xc6, 0x67, 0xff, 0xfe, 0x62, 0x60, 0x0, 0x64, 0x7,
+    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x3, 0x1, 0xff, 0xff,
+    0xf8, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x0, 0x7, 0x0, 0x1,
+    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x7c, 0x0, 0x0,
+
+    /* U+6392 */
+    0x4, 0x1, 0x8, 0x0, 0x60, 0x38, 0xc0, 0x6, 0x3, 0x8c, 0x0, 0x60,
+    0x38, 0xc0, 0x6, 0x3, 0x8c, 0x0, 0xe3, 0xf8, 0xfe, 0x7f, 0xff, 0x8f,
+    0xe7, 0xf8, 0x38, 0xc0, 0x6, 0x3, 0x8c, 0x0, 0x60, 0x38, 0xc0, 0x6,
+    0x3, 0x8c, 0x0, 0x61, 0xf8, 0xfc, 0x6, 0x3f, 0x8f, 0xc0, 0x68, 0x38,
+    0xf8, 0xf, 0xc3, 0x8c, 0x7, 0xf8, 0x30, 0xc0, 0x7e, 0x3, 0xc, 0x6,
+    0xe0, 0xf0, 0xc0, 0x6, 0x7f, 0xf, 0xe0, 0x67, 0x30, 0xfe, 0x6, 0x7,
+    0xc, 0x0, 0x60, 0x70, 0xc0, 0x6, 0xe, 0xc, 0x0, 0xe1, 0xc0, 0xc0,
+    0x3e, 0x38, 0xc, 0x7, 0xc7, 0x80, 0xc0, 0x30, 0x60, 0x8, 0x0,
+
+    /* U+63A1 */
+    0x4, 0x0, 0x0, 0x80, 0x60, 0x1f, 0xfc, 0xe, 0x3f, 0xff, 0x80, 0xe3,
+    0xfc, 0x0, 0xe, 0x0, 0x0, 0x80, 0xe0, 0xc, 0x1c, 0xe, 0x18, 0xe1,
+    0xc7, 0xfd, 0x86, 0x18, 0x7f, 0x9c, 0x73, 0x80, 0xe0, 0xc3, 0x30, 0xe,
+    0xc, 0x3, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe8, 0x6,
+    0x0, 0xf, 0xff, 0xff, 0xe7, 0xfb, 0xff, 0xfe, 0x7e, 0x0, 0xf0, 0x0,
+    0xe0, 0x1f, 0x80, 0xe, 0x3, 0xfc, 0x0, 0xe0, 0x76, 0x60, 0xe, 0xe,
+    0x67, 0x80, 0xe3, 0xc6, 0x3c, 0xe, 0x78, 0x61, 0xe0, 0xe6, 0x6, 0xe,
+    0x3e, 0x0, 0x60, 0x7, 0xc0, 0x6, 0x0, 0x30, 0x0, 0x20, 0x0,
+
+    /* U+63A2 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0xff, 0xf0, 0xe, 0x3f, 0xff, 0xc0, 0xe3,
+    0xff, 0xfc, 0xe, 0x31, 0x98, 0xe0, 0xe3, 0x39, 0x8e, 0x7f, 0xb3, 0x98,
+    0x67, 0xfb, 0x31, 0x80, 0xe, 0x7, 0x18, 0xc0, 0xe0, 0xe1, 0xdc, 0xe,
+    0x1e, 0x1f, 0x80, 0xe1, 0xc0, 0xf8, 0xe, 0x10, 0x60, 0x0, 0xf8, 0x6,
+    0x0, 0x1f, 0x80, 0xe0, 0x7, 0xe3, 0xff, 0xfe, 0x7e, 0x3f, 0xff, 0xe0,
+    0xe0, 0xf, 0x0, 0xe, 0x1, 0xf8, 0x0, 0xe0, 0x3f, 0xc0, 0xe, 0x6,
+    0x6e, 0x0, 0xe1, 0xc6, 0x78, 0xe, 0x78, 0x63, 0xc0, 0xcf, 0x6, 0x1e,
+    0x3c, 0xe0, 0x60, 0x67, 0xc0, 0x6, 0x0, 0x30, 0x0, 0x40, 0x0,
+
+    /* U+63A5 */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x63,
+    0xff, 0xfc, 0x6, 0x3f, 0xff, 0xc0, 0xe0, 0xe0, 0x60, 0x7f, 0xc6, 0x6,
+    0x7, 0xfc, 0x60, 0xe0, 0x6, 0x6, 0xe, 0x0, 0x60, 0x70, 0xe0, 0x6,
+    0x7f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x6, 0x1, 0x80, 0x0, 0x7c, 0x18,
+    0x0, 0x3f, 0x83, 0x80, 0x7, 0xe7, 0xff, 0xfe, 0x6e, 0x3f, 0xff, 0xe0,
+    0x60, 0x60, 0x60, 0x6, 0xe, 0xe, 0x0, 0x60, 0xc0, 0xe0, 0x6, 0xf,
+    0x8c, 0x0, 0x60, 0x7f, 0xc0, 0x6, 0x0, 0xfc, 0x0, 0xe0, 0x1f, 0xf0,
+    0x3e, 0x7f, 0xc7, 0xc7, 0xc7, 0xf0, 0x1c, 0x30, 0x0, 0x0, 0xc0,
+
+    /* U+63A7 */
+    0x4, 0x0, 0x40, 0x0, 0xc0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0,
+    0xe, 0x0, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0xff, 0xfc, 0x7f, 0xf3, 0x18,
+    0xe7, 0xff, 0x31, 0x8e, 0xe, 0x73, 0x18, 0xe0, 0xe2, 0x31, 0x84, 0xe,
+    0x7, 0x18, 0x80, 0xe0, 0xe1, 0x9c, 0xe, 0x1e, 0x1f, 0x80, 0xf1, 0xc1,
+    0xf8, 0xf, 0x90, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7e, 0x3f, 0xff, 0x80,
+    0xe3, 0xff, 0xfc, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xe, 0x0,
+    0x3c, 0xff, 0xff, 0xe7, 0xcf, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+63D0 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x7f, 0xf0, 0x6, 0xf, 0xff, 0x80, 0x60,
+    0xc0, 0x38, 0x6, 0xc, 0x1, 0x80, 0xe0, 0xff, 0xf8, 0x7f, 0xcf, 0xff,
+    0x87, 0xfc, 0xc0, 0x18, 0x6, 0xc, 0x1, 0x80, 0x60, 0xe0, 0x38, 0x6,
+    0xf, 0xff, 0x80, 0x60, 0x3f, 0xe0, 0x6, 0x0, 0x0, 0x0, 0x7d, 0xff,
+    0xfe, 0x1f, 0xbf, 0xff, 0xe7, 0xe0, 0x7, 0x0, 0x7e, 0x0, 0x70, 0x0,
+    0x60, 0xc7, 0x0, 0x6, 0xc, 0x7f, 0x80, 0x60, 0xc7, 0xf8, 0x6, 0x1c,
+    0x70, 0x0, 0x61, 0xe7, 0x0, 0x6, 0x3f, 0x70, 0x0, 0xe7, 0x3f, 0x0,
+    0x3e, 0xf1, 0xff, 0xe7, 0xce, 0x3, 0xfe, 0x38, 0x0, 0x0, 0x0,
+
+    /* U+63DB */
+    0x4, 0x2, 0x0, 0x0, 0xc0, 0x60, 0x0, 0xe, 0xf, 0xf0, 0x0, 0xe1,
+    0xff, 0xc0, 0xe, 0x1c, 0x38, 0x0, 0xe3, 0x3, 0x80, 0x7f, 0xf0, 0x70,
+    0x7, 0xff, 0xff, 0xf8, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0x19, 0x8c, 0xe,
+    0x31, 0x98, 0xc0, 0xe3, 0x19, 0x8c, 0xe, 0x33, 0x18, 0xc0, 0xf3, 0x71,
+    0xfc, 0xf, 0xb6, 0x1f, 0xc7, 0xf3, 0x4, 0xc, 0x7e, 0x30, 0xe0, 0xc0,
+    0xe0, 0xe, 0x0, 0xe, 0x7f, 0xff, 0xe0, 0xef, 0xff, 0xfe, 0xe, 0x1,
+    0xe0, 0x0, 0xe0, 0x1f, 0x0, 0xe, 0x3, 0xbc, 0x0, 0xc0, 0xf1, 0xf0,
+    0x3c, 0x7e, 0x7, 0xe7, 0xcf, 0x80, 0x3e, 0x30, 0xc0, 0x0, 0x60,
+
+    /* U+63EA */
+    0xc, 0x0, 0x4, 0x0, 0xc0, 0xf8, 0xe0, 0xc, 0x7f, 0x8e, 0x0, 0xcf,
+    0xc0, 0xe0, 0xc, 0x1c, 0xe, 0x0, 0xc1, 0xc0, 0xe0, 0x7f, 0x9c, 0x2c,
+    0x47, 0xf1, 0xc6, 0xc6, 0xc, 0x1c, 0x6c, 0x60, 0xcf, 0xf6, 0xce, 0xc,
+    0xff, 0x6c, 0xc0, 0xc1, 0xc6, 0xcc, 0xc, 0x1c, 0x6e, 0xc0, 0xd3, 0xc4,
+    0xec, 0xf, 0xbe, 0xe, 0x7, 0xf3, 0xf0, 0xe0, 0x7c, 0x7f, 0x1e, 0x0,
+    0xc6, 0xd9, 0xb0, 0xc, 0xcd, 0x9b, 0x0, 0xcc, 0xc1, 0xb0, 0xd, 0x8c,
+    0x39, 0x80, 0xd8, 0xc3, 0x18, 0xc, 0xc, 0x71, 0xc0, 0xc0, 0xc6, 0xe,
+    0x7c, 0xc, 0xe0, 0xe7, 0xc0, 0xdc, 0x6, 0x30, 0x8, 0x80, 0x0,
+
+    /* U+63F4 */
+    0x6, 0x0, 0x0, 0x80, 0x60, 0x1f, 0xfc, 0x6, 0x3f, 0xff, 0x80, 0x63,
+    0xf0, 0x0, 0x6, 0x8, 0x41, 0x80, 0xe0, 0xce, 0x30, 0x7f, 0xcc, 0x63,
+    0x7, 0xf8, 0xc2, 0x60, 0x6, 0x4, 0xe, 0x0, 0x63, 0xff, 0xfc, 0x6,
+    0xf, 0xff, 0x80, 0x60, 0x18, 0x0, 0x6, 0x1f, 0xff, 0xc0, 0x63, 0xff,
+    0xfe, 0xf, 0x9f, 0xff, 0xc7, 0xf8, 0x70, 0x0, 0x7e, 0x7, 0xff, 0x6,
+    0x60, 0xff, 0xf8, 0x6, 0x1f, 0x7, 0x80, 0x63, 0xb8, 0x70, 0x6, 0x71,
+    0xce, 0x0, 0x6e, 0xf, 0xc0, 0x6, 0x0, 0xf8, 0x0, 0xe0, 0x3f, 0xf0,
+    0x3e, 0x3f, 0x8f, 0xe7, 0xc7, 0xe0, 0x3e, 0x38, 0x20, 0x0, 0x0,
+
+    /* U+6416 */
+    0x4, 0x0, 0x40, 0x0, 0xe0, 0x1c, 0x0, 0xe, 0x3, 0xc0, 0x0, 0xe0,
+    0xff, 0xfc, 0xe, 0x1f, 0xff, 0xc0, 0xe3, 0x90, 0x1c, 0x7f, 0xb1, 0xc7,
+    0x87, 0xf8, 0x87, 0xe0, 0xe, 0xe, 0x38, 0x0, 0xe0, 0x7e, 0x0, 0xe,
+    0x1f, 0x80, 0x0, 0xe7, 0xe0, 0x0, 0xe, 0xf, 0xff, 0xc0, 0xf8, 0xff,
+    0xfc, 0xf, 0x98, 0x60, 0x7, 0xf1, 0x86, 0x0, 0x7e, 0x0, 0x60, 0x0,
+    0xe7, 0xff, 0xfe, 0xe, 0x7f, 0xff, 0xe0, 0xe0, 0x6, 0x0, 0xe, 0x10,
+    0x60, 0xc0, 0xe3, 0x6, 0xc, 0xe, 0x38, 0x60, 0xc0, 0xe3, 0x86, 0x1c,
+    0x3c, 0x1f, 0xff, 0xc7, 0xc1, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+641C */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0xf, 0x6f, 0x80, 0x61,
+    0xe6, 0xfc, 0x6, 0x18, 0x61, 0xc0, 0xe3, 0x86, 0xc, 0x7f, 0xf8, 0x60,
+    0xc7, 0xfb, 0xf6, 0xfc, 0x6, 0x3f, 0x6f, 0xc0, 0x63, 0x86, 0xc, 0x6,
+    0x38, 0x60, 0xc0, 0x63, 0x8e, 0x1c, 0x6, 0x1f, 0xff, 0x80, 0x78, 0xff,
+    0xf0, 0xf, 0x80, 0x60, 0x7, 0xf0, 0x6, 0x0, 0x7e, 0x3f, 0xff, 0x80,
+    0x63, 0xff, 0xf8, 0x6, 0x4, 0x3, 0x80, 0x60, 0x60, 0x70, 0x6, 0x7,
+    0x8e, 0x0, 0x60, 0x3f, 0xc0, 0x6, 0x1, 0xf8, 0x0, 0xe0, 0x7f, 0xe0,
+    0x3e, 0x7f, 0x9f, 0xe7, 0xcf, 0xc0, 0x7e, 0x30, 0xe0, 0x0, 0x60,
+
+    /* U+642C */
+    0xc, 0x8, 0x0, 0x0, 0xc0, 0xc1, 0xe0, 0xc, 0x1c, 0x3f, 0x0, 0xc1,
+    0xc3, 0xf0, 0xc, 0x7f, 0x33, 0x0, 0xc7, 0xf3, 0x30, 0x7f, 0x61, 0xb3,
+    0x27, 0xf6, 0x9b, 0x32, 0xc, 0x69, 0xb3, 0x20, 0xc6, 0xdf, 0x3e, 0xc,
+    0x6d, 0xe1, 0xe0, 0xc6, 0x18, 0x0, 0xc, 0x67, 0xc0, 0x0, 0xff, 0xff,
+    0xfc, 0x3f, 0xff, 0x9f, 0xc7, 0xc6, 0x98, 0xc, 0x6c, 0x69, 0xb1, 0xc0,
+    0xc6, 0x99, 0x98, 0xc, 0x69, 0x99, 0x80, 0xcc, 0x99, 0xf0, 0xc, 0xc9,
+    0x8f, 0x0, 0xcc, 0x98, 0x60, 0xc, 0xc1, 0x8f, 0x0, 0xcc, 0x39, 0xfc,
+    0x3d, 0x87, 0x79, 0xe7, 0x98, 0xf7, 0xe, 0x30, 0x0, 0x40, 0x0,
+
+    /* U+6436 */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x6, 0x0, 0xe, 0x0, 0xe0, 0x0, 0xe0,
+    0x1f, 0x0, 0xe, 0x3, 0xf8, 0x0, 0xe0, 0x39, 0xc0, 0xe, 0x7, 0xf,
+    0x7, 0xf9, 0xe0, 0x7c, 0x7f, 0xbf, 0xff, 0xe0, 0xe7, 0x80, 0xe, 0xe,
+    0x60, 0x0, 0x0, 0xe0, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0x80, 0xe1, 0x80,
+    0x18, 0xe, 0x9f, 0xff, 0x80, 0xf9, 0xff, 0xf8, 0x7f, 0x18, 0x1, 0x87,
+    0xe1, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0x0, 0xe3, 0x80, 0x0, 0xe, 0x33,
+    0xff, 0x0, 0xe3, 0x7f, 0xf8, 0xe, 0x77, 0x1, 0xc0, 0xe6, 0x60, 0x1c,
+    0xe, 0xe6, 0x1, 0xc3, 0xcc, 0x7f, 0xf8, 0x7c, 0x83, 0xff, 0x83, 0x80,
+    0x0, 0x0,
+
+    /* U+6469 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x1c, 0x20, 0x8, 0x1, 0x83, 0x0, 0xc0, 0x18, 0x70, 0x1c,
+    0x1, 0xbf, 0xff, 0xfe, 0x18, 0x70, 0x1c, 0x1, 0x93, 0x42, 0xd0, 0x19,
+    0x34, 0x6f, 0x21, 0xb3, 0x44, 0xf6, 0x1b, 0x34, 0xcf, 0xe1, 0xb2, 0x58,
+    0xdc, 0x18, 0x0, 0x3, 0x81, 0x9f, 0xff, 0xf8, 0x19, 0xff, 0xe0, 0x3,
+    0x80, 0x18, 0x0, 0x39, 0xff, 0xff, 0xc3, 0x9f, 0xff, 0xf8, 0x30, 0x1,
+    0x80, 0x3, 0x7f, 0xff, 0xfe, 0x77, 0xff, 0xff, 0xe7, 0x0, 0x18, 0x0,
+    0x60, 0x1, 0x80, 0x6, 0x1, 0xf8, 0x0, 0x0, 0xf, 0x0, 0x0,
+
+    /* U+6488 */
+    0x4, 0x4, 0x2, 0x0, 0xe0, 0x60, 0x60, 0xe, 0x34, 0xd6, 0x60, 0xe3,
+    0x4b, 0x6e, 0xe, 0x2d, 0xb6, 0xc0, 0xe2, 0xd3, 0x68, 0x7f, 0x8c, 0x6,
+    0x7, 0xf8, 0xf0, 0xf8, 0xe, 0x19, 0x9d, 0xc0, 0xe3, 0x9d, 0x8e, 0xe,
+    0x20, 0x30, 0x60, 0xe0, 0x3, 0x0, 0xe, 0x3f, 0xff, 0xc0, 0xfb, 0xff,
+    0xfe, 0xf, 0xb0, 0x80, 0x67, 0xf3, 0xc, 0x6, 0x7e, 0x20, 0xc0, 0x40,
+    0xe1, 0xff, 0xf0, 0xe, 0x1f, 0xff, 0x80, 0xe0, 0x18, 0x38, 0xe, 0x1,
+    0x81, 0x80, 0xe0, 0x38, 0x18, 0xe, 0x7, 0x3, 0x80, 0xe0, 0xe0, 0x30,
+    0x3c, 0x3c, 0x1f, 0x7, 0xc7, 0x83, 0xe0, 0x30, 0x60, 0x10, 0x0,
+
+    /* U+6490 */
+    0x4, 0x0, 0x60, 0x0, 0xc1, 0xc6, 0x18, 0xe, 0xc, 0x63, 0x80, 0xe0,
+    0xc6, 0x30, 0xe, 0x4, 0xf2, 0x0, 0xe3, 0xff, 0xfc, 0x7f, 0xb8, 0x1,
+    0xe7, 0xfb, 0x0, 0x6, 0xe, 0x37, 0xfe, 0x60, 0xe3, 0x70, 0x66, 0xe,
+    0x26, 0x6, 0x40, 0xe0, 0x7f, 0xe0, 0xe, 0x3, 0xfe, 0x0, 0xf8, 0x0,
+    0x0, 0x1f, 0x9f, 0xff, 0xc7, 0xe1, 0xff, 0xfc, 0x7e, 0x0, 0xc, 0x0,
+    0xe0, 0xc0, 0xc0, 0xc, 0x1c, 0xc, 0x0, 0xc1, 0xff, 0xfe, 0xc, 0x3f,
+    0xff, 0xc0, 0xc1, 0x7, 0xc0, 0xc, 0x1, 0xec, 0x0, 0xc0, 0xf8, 0xc0,
+    0x3c, 0x7e, 0x1c, 0x7, 0xcf, 0x87, 0xc0, 0x30, 0x0, 0x78, 0x0,
+
+    /* U+6492 */
+    0x8, 0x33, 0x4, 0x0, 0xc3, 0x30, 0xe0, 0xc, 0x33, 0xc, 0x0, 0xc3,
+    0x30, 0xc0, 0xc, 0xff, 0xdc, 0x0, 0xcf, 0xfd, 0x80, 0x7f, 0x33, 0x1f,
+    0xe7, 0xf3, 0x33, 0xfe, 0xc, 0x33, 0x39, 0xc0, 0xcf, 0xff, 0x8c, 0xc,
+    0xff, 0xf8, 0xc0, 0xc0, 0x7, 0x8c, 0xc, 0x1e, 0x19, 0xc0, 0xf7, 0xf8,
+    0x98, 0x1f, 0x73, 0x8d, 0x87, 0xe6, 0x18, 0xd8, 0x7c, 0x7f, 0x8d, 0x80,
+    0xc7, 0xf8, 0xf8, 0xc, 0x61, 0x8f, 0x0, 0xc6, 0x18, 0x70, 0xc, 0x7f,
+    0x87, 0x0, 0xc7, 0xf8, 0x70, 0xc, 0x61, 0x8f, 0x80, 0xc6, 0x19, 0xdc,
+    0x7c, 0x63, 0xb8, 0xe7, 0x86, 0x7f, 0xe, 0x30, 0x46, 0x20, 0x20,
+
+    /* U+64A4 */
+    0xc, 0x8, 0x4, 0x0, 0xc0, 0xc0, 0xc0, 0xc, 0xc, 0xc, 0x0, 0xcf,
+    0xf8, 0xc0, 0xc, 0xff, 0xdc, 0x0, 0xc3, 0x81, 0x80, 0x7f, 0x18, 0x1f,
+    0xe7, 0xf3, 0x33, 0xfe, 0xc, 0x33, 0xb9, 0xc0, 0xc7, 0xff, 0x8c, 0xc,
+    0xff, 0xf8, 0xc0, 0xcc, 0x7, 0x8c, 0xc, 0x3f, 0x19, 0x80, 0xc7, 0xf8,
+    0x98, 0x1f, 0x61, 0x89, 0x87, 0xe6, 0x18, 0xd8, 0x7c, 0x7f, 0x8d, 0x80,
+    0xc7, 0xf8, 0xf8, 0xc, 0x61, 0x8f, 0x0, 0xc6, 0x18, 0x70, 0xc, 0x7f,
+    0x87, 0x0, 0xc6, 0x18, 0x70, 0xc, 0x61, 0x8f, 0x80, 0xc6, 0x19, 0xdc,
+    0x3c, 0x61, 0xb8, 0xe7, 0x86, 0x7f, 0xe, 0x30, 0x46, 0x20, 0x0,
+
+    /* U+64A5 */
+    0x4, 0x0, 0x0, 0x0, 0xc7, 0xfe, 0x20, 0xe, 0x7f, 0xe6, 0x0, 0xe0,
+    0x1e, 0xe0, 0xe, 0x31, 0xfc, 0xc0, 0xe3, 0xf1, 0x9c, 0x7f, 0x9e, 0xf,
+    0x87, 0xfb, 0xc0, 0x78, 0xe, 0x78, 0x3, 0xe0, 0xef, 0xe3, 0xfe, 0xe,
+    0xfe, 0x7f, 0x20, 0xe0, 0x77, 0x70, 0xe, 0x3, 0x63, 0x20, 0xf0, 0x76,
+    0x36, 0xf, 0xfe, 0xc3, 0xe7, 0xf7, 0xcc, 0x3c, 0x7e, 0x60, 0x80, 0x0,
+    0xe6, 0xf, 0xf8, 0xe, 0x7e, 0x7f, 0xc0, 0xe7, 0xf0, 0x18, 0xe, 0x7,
+    0x73, 0x80, 0xe0, 0x77, 0xf0, 0xe, 0x6, 0x1f, 0x0, 0xe0, 0x63, 0xf8,
+    0x3c, 0x1e, 0xfb, 0xc7, 0xc7, 0xfe, 0xe, 0x30, 0x38, 0x80, 0x0,
+
+    /* U+64AD */
+    0x4, 0x0, 0x1, 0x80, 0x60, 0x1f, 0xf8, 0x6, 0x7f, 0xff, 0x0, 0x63,
+    0xce, 0x0, 0x6, 0x8, 0x63, 0x3, 0xf1, 0x86, 0x30, 0x7f, 0x8c, 0x66,
+    0x7, 0xf8, 0xe, 0x0, 0x6, 0x7f, 0xff, 0xe0, 0x67, 0xff, 0xfe, 0x6,
+    0x1, 0xf0, 0x0, 0x60, 0x3f, 0xc0, 0x6, 0x8e, 0x6e, 0x0, 0xf9, 0xc6,
+    0x78, 0x3f, 0x78, 0x63, 0xe7, 0xee, 0x0, 0xe, 0x6e, 0x1f, 0xff, 0x0,
+    0x63, 0xff, 0xf8, 0x6, 0x30, 0xe1, 0x80, 0x63, 0xe, 0x18, 0x6, 0x3f,
+    0xff, 0x80, 0x63, 0xff, 0xf8, 0x6, 0x30, 0xe1, 0x80, 0xe3, 0xe, 0x18,
+    0x3e, 0x3f, 0xff, 0x87, 0xc1, 0xff, 0xf0, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+64B2 */
+    0x4, 0x2, 0x10, 0x0, 0xc0, 0x33, 0x0, 0xc, 0x63, 0x31, 0x80, 0xc3,
+    0x33, 0x30, 0xc, 0x33, 0x33, 0x0, 0xc0, 0x33, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xf7, 0xff, 0xfe, 0xc, 0xc, 0xc, 0x0, 0xc0, 0x61, 0xc0, 0xc,
+    0xe, 0x1c, 0x0, 0xc7, 0xff, 0xfc, 0xc, 0x3f, 0xff, 0xc0, 0xc8, 0xc,
+    0x0, 0xf, 0x9f, 0xff, 0x7, 0xf3, 0xff, 0xf8, 0x7c, 0x0, 0xc0, 0x0,
+    0xc0, 0xc, 0x0, 0xc, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xfe, 0xc, 0x1,
+    0xe0, 0x0, 0xc0, 0x3b, 0x0, 0xc, 0x7, 0x3c, 0x0, 0xc1, 0xe0, 0xf8,
+    0x3c, 0xfc, 0x7, 0xe7, 0xdf, 0x0, 0x1e, 0x30, 0x80, 0x0, 0x0,
+
+    /* U+64CA */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7f, 0xf8, 0xfe, 0x7, 0xff,
+    0x9f, 0xe2, 0x1f, 0xe1, 0x86, 0x63, 0xff, 0x98, 0x7e, 0x73, 0x1b, 0x3,
+    0xe7, 0xff, 0xa0, 0x0, 0x73, 0x1b, 0xff, 0x83, 0xff, 0x1f, 0xfc, 0x3,
+    0x0, 0xc3, 0x87, 0xff, 0x86, 0xe0, 0x3, 0x0, 0x7c, 0x3, 0x31, 0xbf,
+    0xfc, 0x3f, 0xfb, 0x83, 0xe0, 0x0, 0x0, 0x70, 0x3f, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0x80, 0x0, 0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x80, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x3,
+    0xc0, 0x0,
+
+    /* U+64EC */
+    0xc, 0x0, 0x0, 0x0, 0xc6, 0x7, 0xf8, 0xc, 0x66, 0xff, 0xc0, 0xc7,
+    0xe0, 0x1c, 0xc, 0x78, 0x1, 0x80, 0xc6, 0x3, 0x30, 0x7f, 0x61, 0xbe,
+    0x7, 0xf6, 0x30, 0xe0, 0xc, 0x7f, 0x7, 0x0, 0xc3, 0xe0, 0x30, 0xc,
+    0x0, 0xff, 0xe0, 0xc6, 0x7, 0xfe, 0xc, 0x7f, 0x4, 0x60, 0xff, 0xf0,
+    0x4c, 0x3e, 0xd8, 0x64, 0xc7, 0xc9, 0x86, 0x40, 0x6c, 0x18, 0x64, 0x0,
+    0xcf, 0xfe, 0x7c, 0xc, 0xff, 0xe7, 0xc0, 0xc1, 0x84, 0x60, 0xc, 0x3c,
+    0xe4, 0x0, 0xc3, 0xef, 0x40, 0xc, 0x77, 0xfc, 0x0, 0xce, 0x19, 0xe0,
+    0x3d, 0xc1, 0x8f, 0xe7, 0xd8, 0x30, 0x3e, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+651D */
+    0x4, 0x0, 0x0, 0x0, 0xc7, 0xff, 0xfc, 0xc, 0x7f, 0xff, 0xc0, 0xc0,
+    0xc0, 0x70, 0xc, 0xf, 0xff, 0x0, 0xe0, 0xff, 0xf0, 0x7f, 0x8c, 0x7,
+    0x7, 0xf8, 0xff, 0xf0, 0xc, 0xc, 0x7, 0x0, 0xc0, 0xc0, 0x7c, 0xc,
+    0x7f, 0xff, 0xe0, 0xcf, 0xff, 0xf0, 0xc, 0x0, 0x6, 0x0, 0xf7, 0xf3,
+    0xfc, 0x1f, 0xff, 0xff, 0xe7, 0xe6, 0x33, 0xc, 0x7c, 0x7f, 0x3f, 0xc0,
+    0xc7, 0xf3, 0xfc, 0xc, 0x63, 0x30, 0xc0, 0xc7, 0xf3, 0xfc, 0xc, 0x7f,
+    0x3f, 0xc0, 0xc6, 0x33, 0xc, 0xc, 0x67, 0x3b, 0xe0, 0xcf, 0xf7, 0xfe,
+    0x3d, 0xf3, 0x70, 0xc7, 0xc0, 0x30, 0xc, 0x30, 0x3, 0x0, 0xc0,
+
+    /* U+6524 */
+    0xc, 0x0, 0x8, 0x80, 0xc6, 0x31, 0x98, 0xc, 0x63, 0x19, 0x80, 0xcf,
+    0xfb, 0x98, 0xc, 0xff, 0xf1, 0x80, 0xc6, 0x37, 0x30, 0x7f, 0x73, 0x7f,
+    0xe7, 0xf3, 0xef, 0xfe, 0xc, 0x1c, 0xf1, 0x0, 0xc0, 0xc3, 0x10, 0xc,
+    0xff, 0xb1, 0x0, 0xcf, 0xdb, 0xb8, 0xc, 0xcc, 0xbf, 0xe0, 0xcf, 0xfb,
+    0xfc, 0x1f, 0x7f, 0xb1, 0x7, 0xe0, 0xc3, 0x10, 0x7c, 0xff, 0xb1, 0x0,
+    0xcf, 0xfb, 0xfc, 0xc, 0x18, 0x3f, 0xe0, 0xdf, 0xff, 0xfc, 0xd, 0xff,
+    0xf1, 0x0, 0xc3, 0x83, 0x10, 0xc, 0x3e, 0x31, 0x0, 0xc7, 0x73, 0xb8,
+    0x3c, 0xe3, 0x9f, 0xe7, 0xdc, 0x1d, 0xfe, 0x31, 0x0, 0x0, 0x0,
+
+    /* U+652F */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
+    0x80, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0xe0, 0x3, 0x0, 0x1c, 0x0, 0x38, 0x3, 0xc0, 0x1, 0xc0, 0x38, 0x0,
+    0xe, 0xf, 0x0, 0x0, 0x79, 0xe0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x1f,
+    0x80, 0x0, 0x1, 0xfc, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x7f, 0xf, 0xf0,
+    0x7f, 0xc0, 0x3f, 0xe7, 0xf0, 0x0, 0x7e, 0x20, 0x0, 0x0, 0xc0,
+
+    /* U+6536 */
+    0x0, 0x80, 0x80, 0x0, 0xc, 0x1c, 0x0, 0x0, 0xc1, 0x80, 0x1, 0xc,
+    0x38, 0x0, 0x30, 0xc3, 0x80, 0x3, 0x8c, 0x30, 0x0, 0x38, 0xc7, 0xff,
+    0xe3, 0x8c, 0x7f, 0xfe, 0x38, 0xcf, 0x83, 0x83, 0x8c, 0xf8, 0x38, 0x38,
+    0xdf, 0x83, 0x83, 0x8d, 0x98, 0x30, 0x38, 0xd9, 0x83, 0x3, 0x8c, 0x18,
+    0x30, 0x38, 0xc1, 0x87, 0x3, 0x8c, 0x1c, 0x70, 0x38, 0xc0, 0xce, 0x3,
+    0xfc, 0xe, 0xe0, 0x3f, 0xc0, 0x7c, 0x7, 0xfc, 0x7, 0xc0, 0x70, 0xc0,
+    0x38, 0x0, 0xc, 0x7, 0xc0, 0x0, 0xc1, 0xff, 0x0, 0xc, 0x7c, 0x78,
+    0x0, 0xdf, 0x3, 0xe0, 0xd, 0xe0, 0xe, 0x0, 0x90, 0x0, 0x0,
+
+    /* U+6539 */
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x3, 0xff, 0xe, 0x0, 0x7f, 0xe1,
+    0x80, 0x0, 0xc, 0x30, 0x0, 0x1, 0x8e, 0x0, 0x0, 0x31, 0xff, 0xf0,
+    0x6, 0x3f, 0xfe, 0x0, 0xcf, 0x7, 0x0, 0x19, 0xe0, 0xe0, 0xff, 0x7c,
+    0x18, 0x3f, 0xed, 0x83, 0x7, 0x3, 0xb0, 0x60, 0xc0, 0x66, 0xc, 0x18,
+    0x0, 0x63, 0x83, 0x0, 0xc, 0x60, 0x60, 0x1, 0x9c, 0xc, 0x4, 0x1b,
+    0x1, 0x81, 0x83, 0xe0, 0x30, 0x30, 0x38, 0x6, 0xe, 0xf, 0x0, 0xff,
+    0xc3, 0xf0, 0xf, 0xf1, 0xf7, 0x80, 0x0, 0xf8, 0x7c, 0x0, 0x7e, 0x7,
+    0xc0, 0xf, 0x0, 0x38, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+653B */
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x80, 0x3, 0xfe,
+    0x38, 0x0, 0x7f, 0xe7, 0x0, 0x7, 0xfe, 0x70, 0x0, 0x6, 0xf, 0xff,
+    0xe0, 0x60, 0xff, 0xfe, 0x6, 0x1f, 0x3, 0x80, 0x63, 0xf0, 0x30, 0x6,
+    0x33, 0x3, 0x0, 0x67, 0x30, 0x70, 0x6, 0x3, 0x7, 0x0, 0x60, 0x38,
+    0x60, 0x6, 0x1, 0x8e, 0x0, 0x60, 0x1c, 0xe0, 0x6, 0x0, 0xdc, 0x0,
+    0x67, 0xf, 0x80, 0x7, 0xf0, 0xf8, 0x1, 0xfe, 0x7, 0x0, 0x7f, 0x1,
+    0xf8, 0x7, 0x80, 0x3d, 0xe0, 0x0, 0xf, 0x8f, 0x0, 0x3, 0xe0, 0x7c,
+    0x0, 0xfc, 0x3, 0xe0, 0xf, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+653E */
+    0x1, 0x0, 0x60, 0x0, 0x18, 0x6, 0x0, 0x3, 0x80, 0xe0, 0x0, 0x38,
+    0xe, 0x0, 0x3, 0x80, 0xc0, 0x7, 0xff, 0xdc, 0x0, 0x7f, 0xfd, 0xff,
+    0xe0, 0xe0, 0x3f, 0xfe, 0xe, 0x3, 0xc3, 0x80, 0xe0, 0x7c, 0x38, 0xe,
+    0x6, 0xc3, 0x80, 0xff, 0x6c, 0x30, 0xf, 0xf0, 0xc3, 0x0, 0xe3, 0x8c,
+    0x30, 0xc, 0x38, 0xe3, 0x0, 0xc3, 0x86, 0x70, 0xc, 0x38, 0x66, 0x0,
+    0xc3, 0x83, 0xe0, 0xc, 0x38, 0x3c, 0x1, 0xc3, 0x3, 0xc0, 0x18, 0x30,
+    0x3c, 0x1, 0x83, 0x7, 0xe0, 0x38, 0x30, 0xe7, 0x3, 0x7, 0x3c, 0x3c,
+    0x73, 0xe7, 0x81, 0xe6, 0x3e, 0xf0, 0xe, 0x0, 0x4, 0x0, 0x40,
+
+    /* U+653F */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xe, 0x0, 0x3f, 0xfc, 0xe0, 0x3, 0xff,
+    0xcc, 0x0, 0x1, 0x80, 0xc0, 0x0, 0x18, 0x1c, 0x0, 0x1, 0x81, 0xff,
+    0xe0, 0x18, 0x1f, 0xfe, 0x19, 0x83, 0xc3, 0x81, 0x98, 0x3c, 0x38, 0x19,
+    0xf3, 0xc3, 0x1, 0x9f, 0xec, 0x30, 0x19, 0xc6, 0xc3, 0x1, 0x98, 0x4c,
+    0x30, 0x19, 0x80, 0x67, 0x1, 0x98, 0x6, 0x60, 0x19, 0x80, 0x66, 0x1,
+    0x98, 0x3, 0xc0, 0x19, 0x80, 0x3c, 0x1, 0x98, 0x3, 0xc0, 0x19, 0xfc,
+    0x3c, 0x1, 0xbf, 0x8f, 0xe0, 0x3f, 0xc1, 0xe7, 0x7, 0xe0, 0x7c, 0x3c,
+    0x60, 0xf, 0x1, 0xe0, 0x1, 0xe0, 0xe, 0x0, 0x18, 0x0, 0x40,
+
+    /* U+6545 */
+    0x3, 0x0, 0x40, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30,
+    0x1c, 0x0, 0x3, 0x1, 0x80, 0x0, 0x30, 0x18, 0x0, 0x7f, 0xf9, 0xff,
+    0xe7, 0xff, 0xbf, 0xfe, 0x3, 0x3, 0x83, 0x80, 0x30, 0x78, 0x18, 0x3,
+    0x7, 0x83, 0x80, 0x30, 0xec, 0x30, 0x3, 0xc, 0xc3, 0x1, 0xfe, 0xc,
+    0x30, 0x3f, 0xf0, 0xc3, 0x3, 0x83, 0xc, 0x70, 0x30, 0x30, 0x66, 0x3,
+    0x3, 0x6, 0xe0, 0x30, 0x30, 0x7c, 0x3, 0x3, 0x3, 0xc0, 0x30, 0x30,
+    0x3c, 0x3, 0x3, 0x7, 0xe0, 0x3f, 0xf0, 0xff, 0x3, 0xff, 0x3c, 0x7c,
+    0x0, 0xf, 0x83, 0xe0, 0x1, 0xe0, 0xe, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+654F */
+    0x4, 0x0, 0x10, 0x0, 0xe0, 0x3, 0x80, 0xc, 0x0, 0x38, 0x1, 0xff,
+    0xf3, 0x0, 0x1f, 0xff, 0x70, 0x3, 0x80, 0x7, 0x0, 0x30, 0x0, 0x7f,
+    0xe7, 0xff, 0xc7, 0xfe, 0x6f, 0xfc, 0xe1, 0x81, 0xc0, 0xee, 0x18, 0x19,
+    0x8f, 0xf1, 0x81, 0x9c, 0xfb, 0x18, 0x18, 0xcf, 0x31, 0x81, 0x80, 0xe3,
+    0x18, 0x7f, 0xff, 0xb3, 0x87, 0xff, 0xf3, 0x30, 0x18, 0xc, 0x3b, 0x1,
+    0x98, 0xc1, 0xf0, 0x18, 0xcc, 0x1e, 0x3, 0x84, 0xc1, 0xe0, 0x3f, 0xff,
+    0xc, 0x1, 0xff, 0xf1, 0xe0, 0x0, 0xc, 0x7f, 0x0, 0x0, 0xcf, 0x38,
+    0x0, 0xfd, 0xe1, 0xe0, 0xf, 0xbc, 0xe, 0x0, 0x1, 0x0, 0x20,
+
+    /* U+6551 */
+    0x1, 0x0, 0x30, 0x0, 0x3b, 0x3, 0x0, 0x3, 0x98, 0x70, 0x0, 0x38,
+    0xc6, 0x0, 0x3, 0x80, 0x60, 0x7, 0xff, 0xce, 0x0, 0x7f, 0xfe, 0xff,
+    0xe3, 0xff, 0xcf, 0xfe, 0x3, 0x81, 0xe3, 0x80, 0x38, 0x1c, 0x18, 0x23,
+    0x9b, 0xe3, 0x83, 0x39, 0xbe, 0x30, 0x3b, 0xbf, 0x63, 0x1, 0xbb, 0x66,
+    0x30, 0xb, 0xa0, 0x63, 0x0, 0x38, 0x6, 0x30, 0x3, 0x80, 0x76, 0x0,
+    0xff, 0x3, 0x60, 0x3f, 0xb8, 0x3e, 0x7, 0xb9, 0xc1, 0xc0, 0x73, 0x8c,
+    0x1c, 0x4, 0x38, 0x3, 0xe0, 0x3, 0x80, 0x7f, 0x0, 0x38, 0x1e, 0x3c,
+    0xf, 0x87, 0xc1, 0xe1, 0xf0, 0xf0, 0xe, 0xc, 0x4, 0x0, 0x20,
+
+    /* U+6558 */
+    0x1, 0x80, 0x60, 0x0, 0x38, 0x6, 0x0, 0x3, 0xc0, 0xe0, 0x0, 0x7e,
+    0xe, 0x0, 0x6, 0x78, 0xc0, 0x0, 0xe3, 0xdc, 0x0, 0x1c, 0x1d, 0xff,
+    0xe3, 0x80, 0x1f, 0xfe, 0x7f, 0xf3, 0xc3, 0x87, 0xff, 0xbc, 0x38, 0x1,
+    0xc7, 0xc3, 0x80, 0x18, 0x6c, 0x30, 0x1, 0x84, 0xe3, 0x3, 0xff, 0xc6,
+    0x30, 0x7f, 0xfc, 0x67, 0x0, 0x1c, 0x6, 0x60, 0x1, 0x80, 0x76, 0x0,
+    0x99, 0x3, 0xc0, 0x19, 0x98, 0x3c, 0x3, 0x99, 0xc3, 0xc0, 0x31, 0x8c,
+    0x3c, 0x7, 0x18, 0xcf, 0xe0, 0x61, 0x81, 0xe7, 0x6, 0x18, 0x7c, 0x3c,
+    0xf, 0x8f, 0x81, 0xe0, 0xf9, 0xe0, 0xe, 0x6, 0x8, 0x0, 0x0,
+
+    /* U+6559 */
+    0x1, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x2, 0x70, 0x3, 0xfe,
+    0x66, 0x0, 0x3f, 0xfe, 0x60, 0x0, 0x39, 0xce, 0x0, 0x3, 0x18, 0xff,
+    0xe0, 0x33, 0x1f, 0xfe, 0x7f, 0xfd, 0xc3, 0x87, 0xff, 0xfc, 0x18, 0x1,
+    0xc3, 0xc3, 0x80, 0x38, 0x7e, 0x38, 0x1f, 0xfa, 0x63, 0x81, 0xff, 0x86,
+    0x30, 0x3c, 0x38, 0x63, 0x7, 0x7, 0x6, 0x70, 0x60, 0xc0, 0x77, 0x0,
+    0x1c, 0x3, 0x60, 0x1, 0xfe, 0x3e, 0x3, 0xff, 0xc1, 0xc0, 0x7f, 0xc0,
+    0x1c, 0x6, 0x18, 0x3, 0xe0, 0x1, 0x80, 0xff, 0x0, 0x18, 0x1e, 0x3c,
+    0x7, 0x87, 0x81, 0xe0, 0xf8, 0xf0, 0xe, 0xe, 0x4, 0x0, 0x0,
+
+    /* U+6566 */
+    0x0, 0x80, 0x10, 0x0, 0x18, 0x3, 0x80, 0x1, 0xc0, 0x30, 0x7, 0xff,
+    0xf3, 0x0, 0x7f, 0xfe, 0x70, 0x0, 0x0, 0x7, 0x0, 0x1f, 0xf8, 0xff,
+    0xe3, 0xff, 0xcf, 0xfe, 0x38, 0xd, 0xe1, 0x83, 0x80, 0xfe, 0x18, 0x3f,
+    0xff, 0x61, 0x81, 0xff, 0xb6, 0x38, 0x0, 0x0, 0x63, 0x81, 0xff, 0x87,
+    0x30, 0x3f, 0xfc, 0x33, 0x0, 0x3, 0xc3, 0x30, 0x0, 0x70, 0x33, 0x0,
+    0xe, 0x3, 0x60, 0x1, 0x80, 0x1e, 0x0, 0x3f, 0xe1, 0xe0, 0x7f, 0xfc,
+    0x1c, 0x7, 0xf8, 0x3, 0xe0, 0x1, 0x80, 0x7f, 0x80, 0x18, 0x1f, 0x3c,
+    0xf, 0x83, 0xc1, 0xe1, 0xf8, 0x78, 0xe, 0xe, 0x2, 0x0, 0x0,
+
+    /* U+6574 */
+    0x0, 0x80, 0x30, 0x0, 0x18, 0x3, 0x0, 0x7f, 0xfe, 0x60, 0x7, 0xff,
+    0xe6, 0x0, 0x1, 0x80, 0xff, 0xe1, 0xff, 0x8f, 0xfe, 0x3f, 0xfd, 0xe3,
+    0x3, 0x18, 0xfe, 0x30, 0x31, 0x8f, 0x36, 0x3, 0xff, 0xc3, 0xe0, 0x7,
+    0x80, 0x1c, 0x0, 0xfe, 0x1, 0xe0, 0x1d, 0xf8, 0x7f, 0x87, 0x99, 0xde,
+    0x3c, 0x61, 0x83, 0xc1, 0xe0, 0x8, 0x10, 0x6, 0x3f, 0xff, 0xff, 0xc3,
+    0xff, 0xff, 0xfc, 0x0, 0x7, 0x0, 0x0, 0x20, 0x70, 0x0, 0x7, 0x7,
+    0xff, 0x0, 0x70, 0x7f, 0xf0, 0x7, 0x7, 0x0, 0x0, 0x70, 0x70, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6578 */
+    0x0, 0x80, 0x18, 0x0, 0x1c, 0x1, 0x80, 0x1f, 0xfc, 0x18, 0x1, 0xff,
+    0xe3, 0x80, 0x38, 0xc6, 0x30, 0x7, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0x7f,
+    0xe3, 0x8c, 0x67, 0xfe, 0x1f, 0xfe, 0xf1, 0x81, 0xff, 0xce, 0x18, 0x0,
+    0xc1, 0xf1, 0x81, 0xff, 0xdb, 0x18, 0x3f, 0xfe, 0x31, 0x83, 0xc, 0x63,
+    0x18, 0x39, 0xc6, 0x33, 0x81, 0xff, 0xe3, 0x38, 0x7, 0x0, 0x1b, 0x0,
+    0x70, 0x1, 0xb0, 0x7f, 0xff, 0x9f, 0x3, 0xff, 0xf0, 0xe0, 0xc, 0x18,
+    0xe, 0x1, 0xe1, 0x81, 0xe0, 0xf, 0xf0, 0x3f, 0x80, 0x1f, 0x87, 0x3c,
+    0xf, 0xfc, 0xe1, 0xe3, 0xf0, 0x5c, 0xe, 0x30, 0x1, 0x80, 0x20,
+
+    /* U+6587 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x1, 0xc0, 0x1, 0x0, 0x18, 0x0, 0x38, 0x3, 0x80, 0x1,
+    0x80, 0x38, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x70, 0x0, 0xe, 0x7,
+    0x0, 0x0, 0xe0, 0xe0, 0x0, 0x7, 0xc, 0x0, 0x0, 0x39, 0xc0, 0x0,
+    0x3, 0xf8, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x1f,
+    0xc0, 0x0, 0x7, 0x9f, 0x0, 0x1, 0xf0, 0xfc, 0x1, 0xfc, 0x3, 0xf8,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6591 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f, 0xce, 0x7f, 0xe7, 0xfc,
+    0xe7, 0xfe, 0xe, 0xe, 0x6, 0x0, 0xe3, 0xf8, 0x60, 0xe, 0xff, 0xe6,
+    0x0, 0xe7, 0xfc, 0x60, 0xe, 0x3, 0x86, 0x0, 0xe0, 0x30, 0x60, 0xe,
+    0x3, 0x6, 0x7, 0xfb, 0x30, 0x70, 0x3f, 0xbb, 0x7f, 0xe0, 0xe1, 0xb3,
+    0xfe, 0xe, 0x1f, 0x6, 0x0, 0xe0, 0xe0, 0x60, 0xe, 0x6, 0x6, 0x0,
+    0xe0, 0xf0, 0x60, 0xe, 0xf, 0x6, 0x0, 0xe1, 0xf8, 0x60, 0xf, 0xd9,
+    0x86, 0x3, 0xfb, 0x9c, 0x60, 0x7e, 0x70, 0xc6, 0x6, 0xe, 0x7, 0xfe,
+    0x0, 0xc0, 0x7f, 0xe0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6597 */
+    0x0, 0x0, 0x30, 0x0, 0x18, 0x3, 0x0, 0x1, 0xe0, 0x30, 0x0, 0xf,
+    0x3, 0x0, 0x0, 0x78, 0x30, 0x0, 0x1, 0x3, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0x3, 0x0, 0x1e, 0x0, 0x30, 0x0, 0xf0, 0x3, 0x0, 0x7,
+    0xc0, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3,
+    0x0, 0x0, 0x0, 0x30, 0x60, 0x0, 0x1f, 0xfe, 0x3, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0x80, 0x7f, 0xe0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0,
+
+    /* U+6599 */
+    0x1, 0x0, 0x2, 0x0, 0x30, 0x0, 0x30, 0x3, 0x10, 0x3, 0x3, 0x31,
+    0x9c, 0x30, 0x33, 0x38, 0xe3, 0x3, 0x33, 0x7, 0x30, 0x3b, 0x30, 0x33,
+    0x1, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x7, 0xff, 0x90, 0x30, 0x7f,
+    0xfb, 0xc3, 0x0, 0x70, 0x1e, 0x30, 0x7, 0x0, 0xe3, 0x0, 0x70, 0x0,
+    0x30, 0xf, 0xc0, 0x3, 0x0, 0xfe, 0x0, 0x7e, 0x1b, 0x70, 0x1f, 0xe3,
+    0xb3, 0x1f, 0xf0, 0x33, 0x17, 0xf7, 0x7, 0x30, 0x78, 0x30, 0x63, 0x0,
+    0x3, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30,
+    0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30, 0x1, 0x0, 0x2, 0x0,
+
+    /* U+65AF */
+    0x8, 0x10, 0x0, 0x1, 0xc1, 0x80, 0x7e, 0x1c, 0x18, 0x7f, 0xc1, 0xc3,
+    0x8f, 0xe0, 0x7f, 0xfe, 0xe0, 0x7, 0xff, 0xec, 0x0, 0x1c, 0x18, 0xc0,
+    0x1, 0xc1, 0x8c, 0x0, 0x1f, 0xf8, 0xc0, 0x1, 0xff, 0x8e, 0x0, 0x1c,
+    0x38, 0xff, 0xe1, 0xc1, 0x8f, 0xfe, 0x1c, 0x38, 0xc3, 0x1, 0xff, 0x8c,
+    0x30, 0x1f, 0xf8, 0xc3, 0x1, 0xc1, 0x8c, 0x30, 0x1c, 0x18, 0xc3, 0x7,
+    0xff, 0xec, 0x30, 0x7f, 0xff, 0xc3, 0x7, 0xff, 0xdc, 0x30, 0x4, 0x21,
+    0xc3, 0x1, 0xc3, 0x98, 0x30, 0x3c, 0x3b, 0x83, 0x7, 0x81, 0xb8, 0x30,
+    0x70, 0x7, 0x3, 0x0, 0x0, 0x70, 0x30, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+65B0 */
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x0, 0x7c, 0x1, 0x80, 0x7f, 0xc3, 0xff,
+    0xcf, 0xe0, 0x7f, 0xfe, 0xe0, 0x1, 0xc3, 0x8c, 0x0, 0x18, 0x30, 0xc0,
+    0x1, 0x83, 0xc, 0x0, 0xc, 0x30, 0xc0, 0x1, 0xc7, 0xc, 0x0, 0x7f,
+    0xfe, 0xff, 0xe7, 0xff, 0xef, 0xfe, 0x1, 0x80, 0xc3, 0x0, 0x18, 0xc,
+    0x30, 0x3, 0x80, 0xc3, 0x7, 0xff, 0xec, 0x30, 0x3f, 0xfc, 0xc3, 0x0,
+    0x38, 0x1c, 0x30, 0x7, 0xa1, 0xc3, 0x0, 0xff, 0x18, 0x30, 0x1d, 0xb9,
+    0x83, 0x3, 0x99, 0xb8, 0x30, 0x71, 0x83, 0x83, 0x6, 0x18, 0x70, 0x30,
+    0x1, 0x87, 0x3, 0x0, 0x18, 0xe0, 0x30, 0x1, 0x80, 0x3, 0x0,
+
+    /* U+65B7 */
+    0x42, 0x0, 0x0, 0x8c, 0x61, 0x81, 0xf9, 0x98, 0x61, 0xfe, 0x33, 0x4d,
+    0xbe, 0x7, 0xdf, 0x36, 0x0, 0xdf, 0x6c, 0xc0, 0x19, 0xc7, 0x98, 0x3,
+    0x30, 0x63, 0x0, 0x64, 0x99, 0x60, 0xf, 0xff, 0xec, 0x1, 0xfb, 0xf7,
+    0xff, 0x30, 0x20, 0x3f, 0xe7, 0xff, 0xf6, 0x30, 0xff, 0xfc, 0xc6, 0x19,
+    0x82, 0x18, 0xc3, 0x30, 0xc3, 0x18, 0x7d, 0xba, 0x63, 0xf, 0xbe, 0xcc,
+    0x61, 0xbc, 0xf1, 0x8c, 0x33, 0xf, 0x61, 0x86, 0x69, 0xac, 0x30, 0xdf,
+    0x7f, 0x86, 0x1f, 0xff, 0xf0, 0xc3, 0x2, 0xe, 0x18, 0x7f, 0xfd, 0x83,
+    0x7, 0xff, 0xf0, 0x60, 0x0, 0x4, 0xc, 0x0,
+
+    /* U+65B9 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfe, 0x0, 0x7, 0xff,
+    0xf0, 0x0, 0x60, 0x7, 0x0, 0xe, 0x0, 0x70, 0x0, 0xc0, 0x7, 0x0,
+    0x1c, 0x0, 0x70, 0x1, 0xc0, 0x6, 0x0, 0x38, 0x0, 0x60, 0x7, 0x80,
+    0x6, 0x0, 0xf0, 0x0, 0xe0, 0x1e, 0x0, 0xe, 0x3, 0xc0, 0x1, 0xc0,
+    0x78, 0x1, 0xfc, 0x7, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+65BC */
+    0x3, 0x0, 0x10, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30,
+    0x7, 0x80, 0x3, 0x0, 0x7c, 0x7, 0xff, 0x86, 0xc0, 0x7f, 0xf8, 0xce,
+    0x0, 0xe0, 0xc, 0x60, 0xe, 0x1, 0x87, 0x0, 0xe0, 0x38, 0x38, 0xe,
+    0x3, 0x1, 0xc0, 0xff, 0x70, 0xe, 0xf, 0xf6, 0x0, 0x60, 0xe7, 0x7,
+    0x0, 0xc, 0x30, 0x78, 0x0, 0xc3, 0x3, 0xe0, 0xc, 0x30, 0xe, 0x0,
+    0xc3, 0x0, 0x60, 0x1c, 0x30, 0x0, 0x1, 0xc7, 0x0, 0x0, 0x18, 0x71,
+    0x0, 0x3, 0x87, 0x3f, 0x0, 0x38, 0x71, 0xfc, 0x7, 0x6, 0x3, 0xf8,
+    0x63, 0xe0, 0xf, 0xc4, 0x3c, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+65C5 */
+    0x6, 0x1, 0x80, 0x0, 0x60, 0x18, 0x0, 0x6, 0x1, 0x80, 0x0, 0x60,
+    0x3f, 0xfc, 0x7, 0x3, 0xff, 0xe7, 0xff, 0x7f, 0xfe, 0x7f, 0xfe, 0x0,
+    0x0, 0xc0, 0xc0, 0x10, 0xc, 0x1c, 0x7, 0x80, 0xc0, 0x1, 0xf0, 0xc,
+    0x0, 0xfc, 0x0, 0xfe, 0x1f, 0x80, 0xf, 0xe3, 0x8c, 0x0, 0xc6, 0x38,
+    0xc6, 0xc, 0x63, 0x8c, 0xe1, 0xc6, 0x38, 0xdc, 0x1c, 0x63, 0x8f, 0x81,
+    0x86, 0x38, 0xf0, 0x18, 0x63, 0x86, 0x1, 0x86, 0x38, 0x60, 0x38, 0x63,
+    0x87, 0x3, 0x86, 0x38, 0x30, 0x30, 0x63, 0xfb, 0x87, 0xe, 0x3f, 0x1c,
+    0x63, 0xef, 0xc1, 0xe4, 0x3c, 0xe0, 0xe, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+65CF */
+    0x6, 0x1, 0x80, 0x0, 0x60, 0x18, 0x0, 0x6, 0x3, 0x80, 0x0, 0x60,
+    0x30, 0x0, 0x7, 0x7, 0xff, 0xe7, 0xfe, 0xff, 0xfe, 0x7f, 0xee, 0x0,
+    0x0, 0xc1, 0xc8, 0x0, 0xc, 0x19, 0xc0, 0x0, 0xc1, 0x18, 0x0, 0xc,
+    0x3, 0xff, 0x80, 0xfc, 0x7f, 0xfc, 0xf, 0xe6, 0x30, 0x0, 0xce, 0xc3,
+    0x0, 0xc, 0x60, 0x30, 0x1, 0xc6, 0x3, 0x0, 0x1c, 0xef, 0xff, 0xe1,
+    0x8e, 0xff, 0xfe, 0x18, 0xe0, 0x78, 0x1, 0x8e, 0x7, 0x80, 0x38, 0xc0,
+    0x7c, 0x3, 0x8c, 0xc, 0xe0, 0x70, 0xc1, 0xc7, 0x7, 0xc, 0x78, 0x78,
+    0x67, 0xcf, 0x3, 0xe4, 0x79, 0xe0, 0xe, 0x2, 0x8, 0x0, 0x20,
+
+    /* U+65E5 */
+    0x0, 0x0, 0x1, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xe0, 0x1, 0xee, 0x0,
+    0x7, 0x70, 0x0, 0x3b, 0x80, 0x1, 0xdc, 0x0, 0xe, 0xe0, 0x0, 0x77,
+    0x0, 0x3, 0xb8, 0x0, 0x1d, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xff,
+    0xfb, 0x80, 0x1, 0xdc, 0x0, 0xe, 0xe0, 0x0, 0x77, 0x0, 0x3, 0xb8,
+    0x0, 0x1d, 0xc0, 0x0, 0xee, 0x0, 0x7, 0x70, 0x0, 0x39, 0xff, 0xff,
+    0xcf, 0xff, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+65E6 */
+    0x1, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x60,
+    0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6,
+    0x0, 0x60, 0x0, 0x60, 0x7, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x7,
+    0x0, 0xe, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x7, 0xff, 0xfe, 0x0,
+    0x7f, 0xff, 0xe0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xc0,
+
+    /* U+65E9 */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0,
+    0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xc,
+    0x0, 0x3, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff,
+    0xc0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+65EC */
+    0x1, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x87, 0x0, 0x0, 0x71,
+    0xc0, 0x0, 0x6, 0x70, 0x0, 0x0, 0xce, 0xff, 0xf8, 0x19, 0x9f, 0xff,
+    0x3, 0x3, 0x0, 0x60, 0x60, 0x60, 0xc, 0xc, 0xc, 0x1, 0x83, 0x81,
+    0x80, 0x70, 0x70, 0x3f, 0xfe, 0xe, 0x7, 0xff, 0xc1, 0xc0, 0xc0, 0x18,
+    0x38, 0x18, 0x3, 0x7, 0x3, 0x0, 0x60, 0xe0, 0x7f, 0xfc, 0x1c, 0xf,
+    0xff, 0x83, 0x0, 0x7f, 0xc0, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x7f,
+    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+65ED */
+    0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x1, 0xff, 0x0, 0xe0,
+    0x3f, 0xf8, 0xe, 0x3, 0x83, 0x80, 0xe0, 0x30, 0x18, 0x7f, 0xe3, 0x1,
+    0x87, 0xfe, 0x30, 0x18, 0xe, 0x73, 0x1, 0x80, 0xe7, 0x30, 0x18, 0xc,
+    0x73, 0xff, 0x80, 0xc7, 0x3f, 0xf8, 0xc, 0x73, 0x1, 0x80, 0xc7, 0x30,
+    0x18, 0xc, 0x73, 0x1, 0x80, 0xc7, 0x30, 0x18, 0xc, 0x73, 0x1, 0x80,
+    0xc7, 0x30, 0x18, 0x1c, 0x73, 0x83, 0x81, 0xc7, 0x3f, 0xf8, 0x18, 0x71,
+    0xff, 0x21, 0x87, 0x0, 0x6, 0x38, 0x70, 0x0, 0x63, 0x7, 0x80, 0x1e,
+    0x70, 0x3f, 0xff, 0xe6, 0x1, 0xff, 0xf8, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+660A */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x1f,
+    0x0, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x78, 0xe0, 0x0, 0x1f, 0x7, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xe7, 0xf0, 0x0, 0xfe, 0x70, 0x0, 0x0, 0xc0,
+
+    /* U+660E */
+    0x0, 0x1, 0xff, 0xf, 0xf0, 0xff, 0xe7, 0xfc, 0x78, 0x39, 0xc3, 0x1c,
+    0x6, 0x60, 0xe7, 0x1, 0x98, 0x39, 0xc0, 0x66, 0xe, 0x70, 0x19, 0x83,
+    0x9f, 0xfe, 0x60, 0xe7, 0xff, 0x9f, 0xf9, 0xc0, 0x67, 0xfe, 0x70, 0x19,
+    0xff, 0x9c, 0x6, 0x60, 0xe7, 0x1, 0x98, 0x39, 0xc0, 0x66, 0xe, 0x7f,
+    0xf9, 0x83, 0x9f, 0xfe, 0x60, 0xe6, 0x1, 0x98, 0x39, 0x80, 0x67, 0xc,
+    0x60, 0x19, 0xff, 0x30, 0x6, 0x3f, 0xcc, 0x1, 0x80, 0x7, 0x0, 0x60,
+    0x3, 0x80, 0x18, 0x3, 0xc0, 0x7e, 0x0, 0xe0, 0x1f, 0x80, 0x0, 0x3,
+    0x0,
+
+    /* U+6613 */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfc, 0x7, 0x0,
+    0x1, 0x80, 0xe0, 0x0, 0x38, 0x1f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xe0,
+    0x70, 0x0, 0x1c, 0xe, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x60, 0x3f, 0xff,
+    0xfc, 0x1, 0xff, 0xff, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xfe, 0x3c, 0x1c, 0x71, 0xce, 0x7, 0xc,
+    0x19, 0x1, 0xc3, 0x83, 0x1, 0xf0, 0x60, 0x60, 0xf8, 0x1c, 0xc, 0x3e,
+    0x7, 0x3, 0x80, 0x3, 0xc0, 0x70, 0x3, 0xf0, 0xe, 0x7, 0xf8, 0x1f,
+    0x81, 0xfc, 0x7, 0xf0, 0x18, 0x0, 0x78, 0x0,
+
+    /* U+6615 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0xfc, 0xf, 0xfe, 0x3f, 0xc7,
+    0xf8, 0x7, 0x38, 0xe0, 0x0, 0xc3, 0x18, 0x0, 0x18, 0x63, 0x0, 0x3,
+    0xc, 0x60, 0x0, 0x61, 0x8c, 0x0, 0xc, 0x33, 0x80, 0x1, 0x8e, 0x7f,
+    0xff, 0x3f, 0xcf, 0xff, 0xe7, 0xf9, 0xc0, 0xc0, 0xc3, 0x38, 0x18, 0x18,
+    0x67, 0x3, 0x3, 0xc, 0xe0, 0x60, 0x61, 0x9c, 0xc, 0xc, 0x33, 0x1,
+    0x81, 0x86, 0x60, 0x30, 0x31, 0xcc, 0x6, 0x7, 0xfb, 0x80, 0xc0, 0x7e,
+    0x60, 0x18, 0x0, 0x1c, 0x3, 0x0, 0x3, 0x80, 0x60, 0x0, 0xe0, 0xc,
+    0x0, 0x18, 0x1, 0x80, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+661F */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0x0, 0x3, 0x81, 0xc0,
+    0x0, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3,
+    0x81, 0xc0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x2,
+    0x7, 0x0, 0x0, 0x60, 0x60, 0x0, 0xe, 0x6, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x1f, 0xff, 0xff, 0xc3, 0x80, 0x60, 0x0, 0x70, 0x6, 0x0, 0x7,
+    0x0, 0x60, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+6620 */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x18, 0x0, 0xfc, 0x3, 0x0, 0x3f, 0x80,
+    0x60, 0x7, 0x30, 0xc, 0x0, 0xc6, 0x3f, 0xfc, 0x18, 0xc7, 0xff, 0xc3,
+    0x18, 0xc6, 0x18, 0x63, 0x18, 0xc3, 0xc, 0x63, 0x18, 0x61, 0x8c, 0x63,
+    0xc, 0x3f, 0x8c, 0x61, 0x87, 0xf1, 0x8c, 0x30, 0xc6, 0x31, 0x86, 0x18,
+    0xdf, 0xff, 0xf3, 0x1f, 0xff, 0xfe, 0x63, 0x1, 0xe0, 0xc, 0x60, 0x3c,
+    0x1, 0x8c, 0x7, 0xc0, 0x31, 0x81, 0xd8, 0x7, 0xf0, 0x31, 0x80, 0xfe,
+    0xc, 0x38, 0x0, 0x7, 0x83, 0xc0, 0x3, 0xc0, 0x3c, 0x0, 0xf0, 0x3,
+    0xc0, 0x3c, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6625 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x1c, 0x0, 0x0, 0x1, 0x80, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x30, 0xe0, 0x0, 0x6, 0x6, 0x0, 0x3f,
+    0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3, 0x80, 0x3c, 0x0, 0x70, 0x0,
+    0xe0, 0xe, 0x0, 0x7, 0x81, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xfd, 0xe7,
+    0x70, 0x0, 0xe6, 0x6, 0x0, 0x6, 0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff,
+    0xfe, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0xe0,
+    0x3, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+662F */
+    0x3, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xe0, 0xe, 0x0, 0x7, 0x0, 0xe0,
+    0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7,
+    0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0x7f, 0xff, 0xe0, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xfe, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3, 0x6, 0x0, 0x0,
+    0x30, 0x7f, 0xf0, 0x7, 0x7, 0xff, 0x0, 0x78, 0x60, 0x0, 0xf, 0xc6,
+    0x0, 0x1, 0xcf, 0x60, 0x0, 0x38, 0x7f, 0xc0, 0x7, 0x83, 0xff, 0xfe,
+    0x70, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+6642 */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0xf8, 0x1, 0x80, 0x3f, 0x80,
+    0x70, 0x7, 0x39, 0xff, 0xf8, 0xc3, 0x3f, 0xff, 0x18, 0x60, 0x18, 0x3,
+    0xc, 0x3, 0x0, 0x61, 0x80, 0x60, 0xc, 0x37, 0xff, 0xf9, 0x86, 0xff,
+    0xff, 0x3f, 0xcf, 0xff, 0xc7, 0xf8, 0x0, 0xe0, 0xc7, 0x0, 0x1c, 0x18,
+    0x60, 0x3, 0x83, 0xd, 0xff, 0xfe, 0x61, 0xbf, 0xff, 0xcc, 0x30, 0x1,
+    0xc1, 0x86, 0x60, 0x38, 0x30, 0xce, 0x7, 0x7, 0x38, 0xe0, 0xe0, 0xfe,
+    0xe, 0x1c, 0xf, 0xc0, 0xc3, 0x80, 0x0, 0x0, 0x60, 0x0, 0x0, 0x7c,
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xc0, 0x0,
+
+    /* U+664F */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x30, 0xc, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x7,
+    0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff,
+    0xfc, 0x70, 0x18, 0x0, 0xe7, 0x3, 0x80, 0xe, 0x20, 0x70, 0x0, 0x47,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x80, 0x1, 0xc0,
+    0x70, 0x0, 0x1f, 0xe, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0xff, 0x80,
+    0x1, 0xff, 0x7f, 0x3, 0xff, 0x80, 0xf8, 0x3e, 0x0, 0x1, 0x80,
+
+    /* U+665A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xc0, 0x1, 0xfc, 0x38, 0x0, 0x3f, 0x87,
+    0xfc, 0x6, 0x31, 0xff, 0xc0, 0xc6, 0x70, 0x30, 0x18, 0xdc, 0xe, 0x3,
+    0x1f, 0x3, 0x80, 0x63, 0x5f, 0xff, 0xc, 0x67, 0xff, 0xf1, 0x8c, 0xe3,
+    0x8e, 0x3f, 0x98, 0x70, 0xc7, 0xf3, 0xe, 0x18, 0xc6, 0x61, 0xc3, 0x18,
+    0xce, 0x38, 0xe3, 0x19, 0xff, 0xfc, 0x63, 0x1f, 0xff, 0xc, 0x60, 0xe6,
+    0x1, 0x8c, 0x18, 0xc0, 0x31, 0x83, 0x18, 0x7, 0xf0, 0xe3, 0x0, 0xfe,
+    0x18, 0x61, 0x80, 0xf, 0xc, 0x30, 0x3, 0xc1, 0xc6, 0x0, 0xf0, 0x3f,
+    0xc0, 0x3c, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6668 */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x38, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0xc, 0x0, 0x3,
+    0x80, 0xe0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc3, 0x80, 0x0,
+    0x0, 0x39, 0xff, 0xff, 0x3, 0xbf, 0xff, 0xf8, 0x38, 0x0, 0x0, 0x3,
+    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0x8e, 0x38, 0x10, 0x30, 0xe1,
+    0x83, 0x3, 0xe, 0xc, 0xf0, 0x30, 0xe0, 0xfc, 0x7, 0xe, 0xf7, 0x80,
+    0x73, 0xff, 0x1f, 0xc6, 0x7f, 0x80, 0xfe, 0x47, 0x0, 0x1, 0xe0,
+
+    /* U+666E */
+    0x1, 0x0, 0x8, 0x0, 0x18, 0x1, 0x80, 0x1, 0xc0, 0x38, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x18, 0x70, 0xe1,
+    0x1, 0x87, 0xe, 0x38, 0xc, 0x70, 0xe3, 0x0, 0xc7, 0xe, 0x70, 0x0,
+    0x70, 0xe0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+666F */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3,
+    0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0,
+    0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff,
+    0xfe, 0x0, 0x0, 0x60, 0x0, 0x3, 0x86, 0x1c, 0x1, 0xf0, 0x61, 0xf8,
+    0x7e, 0x1e, 0x7, 0xe7, 0x83, 0xe0, 0x1e, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+6676 */
+    0x7, 0xff, 0xf8, 0x3, 0xff, 0xff, 0x0, 0xe0, 0x0, 0xe0, 0x70, 0x0,
+    0x38, 0x1c, 0x0, 0xe, 0x7, 0xff, 0xff, 0x81, 0xff, 0xff, 0xe0, 0x70,
+    0x0, 0x38, 0x1c, 0x0, 0xe, 0x3, 0x80, 0x7, 0x80, 0xff, 0xff, 0xc0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xc7, 0xff, 0x3f,
+    0xf9, 0xc1, 0xce, 0x7, 0x60, 0x33, 0x1, 0xd8, 0xc, 0xc0, 0x77, 0xff,
+    0x3f, 0xfd, 0xff, 0xcf, 0xff, 0x60, 0x33, 0x1, 0xd8, 0xc, 0xc0, 0x76,
+    0x7, 0x38, 0x1d, 0xff, 0xcf, 0xfe, 0x3f, 0xe1, 0xff, 0x80, 0x0, 0x0,
+    0x0,
+
+    /* U+667A */
+    0x4, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x7f, 0xf9, 0xfe, 0x1f, 0xff,
+    0x7f, 0xe3, 0xc, 0xe, 0x1c, 0x61, 0x81, 0x81, 0x80, 0x30, 0x30, 0x33,
+    0xff, 0xf6, 0x6, 0x7f, 0xfe, 0xc0, 0xc0, 0x30, 0x18, 0x18, 0xf, 0x83,
+    0x3, 0x3, 0xbc, 0x7f, 0xe1, 0xe1, 0xef, 0xfc, 0xf8, 0xc, 0x0, 0x1c,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x1, 0xc0, 0x0,
+    0x60, 0x30, 0x0, 0xc, 0x7, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x18,
+    0x0, 0x6, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x0, 0x18, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6696 */
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x7f, 0xf8, 0xfd, 0xff, 0xfe, 0x3f, 0xbf,
+    0x0, 0x6, 0x38, 0x8, 0x30, 0xc7, 0x31, 0x86, 0x18, 0xe7, 0x39, 0x83,
+    0x1c, 0x62, 0x30, 0x63, 0x88, 0xe, 0xc, 0x77, 0xff, 0xf1, 0x8e, 0x7f,
+    0xfc, 0x3f, 0xc1, 0x80, 0x7, 0xf9, 0xff, 0xf8, 0xc7, 0xff, 0xff, 0x98,
+    0xef, 0xff, 0xe3, 0x1c, 0x30, 0x0, 0x63, 0x8f, 0xfe, 0xc, 0x71, 0xff,
+    0xe1, 0x8e, 0x78, 0x1c, 0x39, 0xdf, 0x87, 0x7, 0xf3, 0x39, 0xc0, 0x7e,
+    0xe3, 0xf0, 0x0, 0x38, 0x3c, 0x0, 0x6, 0x1f, 0xf0, 0x0, 0x1f, 0x9f,
+    0xc0, 0x7, 0xc0, 0xf8, 0x0, 0xc0, 0x0, 0x0,
+
+    /* U+6697 */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0, 0xfc, 0x1, 0x80, 0x3f, 0xdf,
+    0xff, 0xc6, 0x3b, 0xff, 0xf8, 0xc3, 0x1c, 0xc, 0x18, 0x61, 0x81, 0x83,
+    0xc, 0x30, 0x70, 0x61, 0x86, 0xc, 0xc, 0x30, 0xe1, 0xc1, 0x87, 0xff,
+    0xff, 0x3f, 0xdf, 0xff, 0xe7, 0xf8, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x18,
+    0x63, 0xff, 0xc3, 0xc, 0xff, 0xf8, 0x61, 0x98, 0x3, 0x8c, 0x33, 0x0,
+    0x71, 0x86, 0x60, 0xe, 0x30, 0xcf, 0xff, 0xc7, 0xf9, 0xff, 0xf8, 0xfe,
+    0x30, 0x7, 0x0, 0x6, 0x0, 0xe0, 0x0, 0xe0, 0x1c, 0x0, 0x1f, 0xff,
+    0x0, 0x1, 0xff, 0xe0,
+
+    /* U+66B4 */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0,
+    0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xe, 0x0, 0x7,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x7, 0x0, 0x3f,
+    0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0xe0, 0x60, 0x3, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x3, 0x84, 0x38, 0x0,
+    0x70, 0x61, 0xe0, 0x3e, 0x86, 0x37, 0xc7, 0x8c, 0x67, 0x1e, 0x60, 0x46,
+    0x60, 0x60, 0x0, 0x6c, 0x0, 0x1, 0xf6, 0xf8, 0x0, 0xfe, 0x67, 0xe0,
+    0x1f, 0xe, 0xf, 0x1, 0xc3, 0xe0, 0x30, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+66C6 */
+    0x7, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x1c, 0x0, 0x0, 0x81, 0x80,
+    0xe0, 0x7c, 0x1b, 0xfe, 0x7f, 0x81, 0xbf, 0x7, 0xc0, 0x18, 0x30, 0xc,
+    0x1, 0x9f, 0xef, 0xfe, 0x1b, 0xfe, 0xff, 0xe1, 0x87, 0x1, 0xe0, 0x18,
+    0xfc, 0x3f, 0x1, 0x9b, 0x66, 0xdc, 0x1b, 0xb0, 0xec, 0xe1, 0xf3, 0x1c,
+    0xc6, 0x38, 0x30, 0xc, 0x3, 0x87, 0xff, 0xe0, 0x39, 0xff, 0xff, 0x83,
+    0x98, 0x0, 0x38, 0x31, 0x80, 0x1, 0x83, 0x1f, 0xff, 0xf8, 0x31, 0xff,
+    0xff, 0x87, 0x18, 0x0, 0x18, 0x71, 0x80, 0x1, 0x86, 0x1f, 0xff, 0xf8,
+    0x41, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+66C9 */
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x18, 0x0, 0xf8, 0x7f, 0xfc, 0x3f, 0x1f,
+    0xff, 0xc6, 0x70, 0xc, 0x0, 0xc6, 0x1, 0x80, 0x18, 0xdf, 0xff, 0xe3,
+    0x1b, 0xff, 0xfe, 0x63, 0x0, 0x0, 0xc, 0x61, 0x0, 0x81, 0x8c, 0x70,
+    0x30, 0x3f, 0xbf, 0xbf, 0xe7, 0xf3, 0xe3, 0xf8, 0xc6, 0x30, 0x18, 0x18,
+    0xc7, 0x3, 0x83, 0x1b, 0xfb, 0xfe, 0x63, 0x7c, 0x0, 0xc, 0x60, 0x0,
+    0x1, 0x8d, 0xff, 0xff, 0x31, 0xbf, 0xff, 0xe7, 0xf0, 0xe3, 0x0, 0xfc,
+    0x18, 0x60, 0x80, 0x7, 0xc, 0x30, 0x1, 0xc1, 0x86, 0x0, 0xf0, 0x3f,
+    0xc0, 0x7c, 0x3, 0xf0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+66E6 */
+    0x0, 0x4, 0xc, 0x0, 0x1, 0xc1, 0x80, 0xf8, 0x18, 0x60, 0x3f, 0x3f,
+    0xff, 0xe6, 0x73, 0xff, 0xf8, 0xc6, 0x1, 0x80, 0x18, 0xcf, 0xff, 0xc3,
+    0x18, 0xff, 0xf0, 0x63, 0x0, 0xc0, 0xc, 0x7f, 0xff, 0xf9, 0x8d, 0xff,
+    0xfe, 0x3f, 0x8f, 0xcd, 0x87, 0xf7, 0xf1, 0xb8, 0xc6, 0xc, 0x32, 0x18,
+    0xff, 0xff, 0xf3, 0x1b, 0xff, 0xfc, 0x63, 0x3f, 0x18, 0xc, 0x6e, 0xfb,
+    0x31, 0x8f, 0x11, 0x66, 0x31, 0xbf, 0xcd, 0x87, 0xf7, 0xf8, 0xf0, 0xfc,
+    0x60, 0x1c, 0x86, 0xf, 0xe3, 0x90, 0x0, 0xfc, 0xf6, 0x0, 0x1, 0xbf,
+    0xc0, 0x1, 0xee, 0x78, 0x0, 0x38, 0x2, 0x0,
+
+    /* U+66F4 */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x80, 0xc0, 0x60,
+    0x38, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0xe, 0x0, 0x0,
+    0x18, 0xc0, 0x0, 0x1, 0xcc, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x78,
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3, 0xe7, 0xf8, 0x7, 0xf8, 0xf, 0xfe,
+    0x7e, 0x0, 0x1f, 0xe6, 0x0, 0x0, 0x4,
+
+    /* U+66F8 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
+    0xe0, 0xf0, 0x0, 0xe, 0x7, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0xe0, 0x70, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xe0, 0x0,
+    0xe, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xe0,
+    0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+66F9 */
+    0x0, 0x20, 0x40, 0x0, 0x6, 0xc, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0x70, 0xe0, 0x0, 0x7, 0xe, 0x0, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x38, 0x60, 0xc1, 0xc3, 0xff, 0xff, 0xfc, 0x3f,
+    0xff, 0xff, 0xc3, 0x87, 0xc, 0x1c, 0x38, 0x60, 0xc1, 0xc1, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+66FC */
+    0x7, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xe0, 0xe, 0x0, 0x7, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7,
+    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x30, 0x70, 0xe0, 0xc3, 0x7, 0xe,
+    0xc, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xe0, 0xf, 0xff, 0xfe, 0x0, 0x8, 0x1, 0xe0, 0x1, 0xe0,
+    0x78, 0x0, 0x7, 0xdf, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xff, 0xff, 0xf8,
+    0x7f, 0xe0, 0x7f, 0xe3, 0x80, 0x0, 0x3e,
+
+    /* U+66FE */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x3, 0x9f, 0xf8, 0x0, 0x70,
+    0x1, 0xc0, 0xf, 0x0, 0xf, 0x3, 0xc0, 0x0, 0x7e, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x18, 0x6, 0x1, 0x81, 0x98, 0x63, 0x18, 0x18,
+    0xc6, 0x31, 0x81, 0x8e, 0x66, 0x18, 0x18, 0x6, 0x1, 0x81, 0xff, 0xff,
+    0xf8, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
+    0x7f, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x30,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6700 */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3,
+    0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc1, 0x81, 0x80,
+    0x0, 0x1f, 0xf9, 0xff, 0x81, 0xff, 0x9f, 0xfc, 0x1c, 0x18, 0x1, 0x81,
+    0x81, 0x88, 0x18, 0x1f, 0xf8, 0xc3, 0x1, 0xff, 0x8e, 0x70, 0x18, 0x18,
+    0x7e, 0x1, 0x81, 0x83, 0xc0, 0x1d, 0xf8, 0x3c, 0x1, 0xff, 0x87, 0xf8,
+    0x7f, 0x19, 0xe7, 0xe7, 0x1, 0xbc, 0x1e, 0x0, 0x1b, 0x0, 0x60,
+
+    /* U+6703 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0x3e, 0x7, 0xc0, 0x1f, 0x80, 0x1f,
+    0x87, 0xff, 0xff, 0xfe, 0x79, 0xff, 0xf1, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x18, 0x86, 0x11, 0x81, 0x8c, 0x63,
+    0x18, 0x18, 0x46, 0x21, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0,
+    0x7, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70,
+    0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6708 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x3, 0xff, 0xfe, 0x3, 0xff, 0xfe,
+    0x7, 0x0, 0x6, 0x7, 0x0, 0x6, 0x7, 0x0, 0x6, 0x7, 0x0, 0x6,
+    0x7, 0xff, 0xfe, 0x7, 0xff, 0xfe, 0x7, 0x0, 0x6, 0x7, 0x0, 0x6,
+    0x7, 0x0, 0x6, 0x7, 0x0, 0x6, 0x7, 0x0, 0x6, 0x7, 0xff, 0xfe,
+    0x7, 0xff, 0xfe, 0x7, 0x0, 0x6, 0xe, 0x0, 0x6, 0xe, 0x0, 0x6,
+    0xe, 0x0, 0x6, 0x1c, 0x0, 0x6, 0x1c, 0x0, 0x6, 0x38, 0x0, 0x6,
+    0x78, 0x0, 0xfe, 0x70, 0x0, 0xfe, 0x20, 0x0, 0xf8,
+
+    /* U+6709 */
+    0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x3, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1e, 0x0, 0x0, 0x1, 0xc0, 0x0,
+    0x0, 0x18, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x7,
+    0xff, 0xff, 0x0, 0xf8, 0x0, 0x70, 0x1f, 0x80, 0x7, 0x3, 0xdf, 0xff,
+    0xf0, 0x79, 0xff, 0xff, 0x7, 0x1f, 0xff, 0xf0, 0x61, 0x80, 0x7, 0x0,
+    0x18, 0x0, 0x70, 0x1, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xf0, 0x1, 0xff,
+    0xff, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x0, 0x18, 0x0, 0x70,
+    0x1, 0x80, 0x7f, 0x0, 0x18, 0x7, 0xe0, 0x1, 0x0, 0x38, 0x0,
+
+    /* U+670D */
+    0xf, 0xc1, 0xff, 0x1, 0xfe, 0x3f, 0xfc, 0x1c, 0xe7, 0xff, 0xc1, 0x86,
+    0x70, 0xc, 0x18, 0x67, 0x0, 0xc1, 0x86, 0x70, 0xc, 0x18, 0x67, 0xf,
+    0xc1, 0xfe, 0x71, 0xf8, 0x1f, 0xe7, 0xf, 0x1, 0x86, 0x70, 0x0, 0x18,
+    0x67, 0xff, 0xc1, 0x86, 0x7f, 0xfc, 0x18, 0x67, 0x0, 0xc1, 0x86, 0x76,
+    0xc, 0x1f, 0xe7, 0x61, 0xc1, 0xfe, 0x77, 0x18, 0x38, 0x67, 0x33, 0x83,
+    0x86, 0x73, 0xb0, 0x38, 0x67, 0x1f, 0x3, 0x86, 0x71, 0xe0, 0x30, 0x67,
+    0x1e, 0x3, 0x6, 0x73, 0xf8, 0x70, 0x67, 0x7b, 0xc7, 0x3e, 0x7f, 0x1e,
+    0x63, 0xe7, 0xe0, 0xe0, 0x18, 0x20, 0x0,
+
+    /* U+671B */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0xf, 0xf8, 0x3, 0x81, 0xff, 0xc7, 0xff,
+    0xd8, 0xc, 0x7f, 0xfd, 0x80, 0xc1, 0x80, 0x1f, 0xfc, 0x18, 0x1, 0x81,
+    0xc1, 0x80, 0x18, 0xc, 0x18, 0x3, 0xff, 0xc1, 0x80, 0x3f, 0xfc, 0x1f,
+    0xf7, 0x1, 0xc1, 0xff, 0x60, 0x18, 0x3, 0x9e, 0xf, 0x80, 0x1, 0xc0,
+    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+671D */
+    0x1, 0x80, 0x0, 0x0, 0x30, 0xf, 0xf0, 0x6, 0x3, 0xff, 0x3f, 0xff,
+    0x70, 0xe7, 0xff, 0xec, 0xc, 0x3, 0x1, 0x81, 0x80, 0x60, 0x30, 0x30,
+    0x7f, 0x86, 0x6, 0x3f, 0xfc, 0xff, 0xc6, 0x3, 0x9f, 0xf8, 0xc0, 0x33,
+    0x3, 0x1f, 0xfe, 0x60, 0x63, 0xff, 0xcc, 0xc, 0x60, 0x19, 0x81, 0x8c,
+    0x3, 0x30, 0x31, 0xff, 0xe7, 0xfe, 0x1f, 0xf8, 0xff, 0xc0, 0x30, 0x18,
+    0x18, 0x6, 0x3, 0x3, 0x1f, 0xfc, 0xe0, 0x67, 0xff, 0xfc, 0xc, 0x7f,
+    0xf3, 0x1, 0x80, 0x60, 0xe0, 0x30, 0xc, 0x38, 0x6, 0x1, 0x8f, 0x7,
+    0xc0, 0x31, 0xc1, 0xf8, 0x6, 0x10, 0x18, 0x0,
+
+    /* U+671F */
+    0x8, 0x8, 0x0, 0x3, 0x83, 0x7, 0xf0, 0x70, 0x71, 0xff, 0xe, 0xe,
+    0x30, 0xe7, 0xff, 0xf6, 0xc, 0xff, 0xfc, 0xc1, 0x87, 0x7, 0x18, 0x30,
+    0xe0, 0xe3, 0x6, 0x1f, 0xfc, 0x7f, 0xc3, 0xff, 0x8f, 0xf8, 0x70, 0x71,
+    0x83, 0xe, 0xe, 0x30, 0x61, 0xc1, 0xc6, 0xc, 0x3f, 0xf8, 0xc1, 0x87,
+    0xff, 0x18, 0x30, 0xe0, 0xe3, 0xfe, 0x1c, 0x1c, 0xff, 0xc3, 0x83, 0x9c,
+    0x19, 0xff, 0xff, 0x83, 0x3f, 0xff, 0x60, 0x60, 0x42, 0xc, 0xc, 0x18,
+    0x73, 0x81, 0x8f, 0x6, 0x70, 0x33, 0xc0, 0x7c, 0x6, 0x70, 0x7, 0x7,
+    0xc8, 0x0, 0xe0, 0xf8, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+6728 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
+    0x3f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x76, 0xe0, 0x0, 0xe, 0x66,
+    0x0, 0x0, 0xc6, 0x70, 0x0, 0x1c, 0x63, 0x80, 0x3, 0x86, 0x1c, 0x0,
+    0x70, 0x60, 0xe0, 0x1e, 0x6, 0xf, 0x3, 0xc0, 0x60, 0x7c, 0x78, 0x6,
+    0x3, 0xe7, 0x0, 0x60, 0xe, 0x60, 0x6, 0x0, 0x60, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+672A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf0,
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x66, 0xe0, 0x0,
+    0xc, 0x67, 0x0, 0x1, 0x86, 0x38, 0x0, 0x70, 0x61, 0xe0, 0xe, 0x6,
+    0xf, 0x83, 0xc0, 0x60, 0x7c, 0x78, 0x6, 0x1, 0xe7, 0x0, 0x60, 0xe,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+672B */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x1, 0xf0,
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x66, 0xe0, 0x0,
+    0xc, 0x67, 0x0, 0x3, 0x86, 0x38, 0x0, 0x70, 0x61, 0xe0, 0x1f, 0x6,
+    0xf, 0x83, 0xc0, 0x60, 0x7c, 0x78, 0x6, 0x1, 0xe7, 0x0, 0x60, 0xe,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+672C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x7f, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
+    0x3f, 0x80, 0x0, 0x7, 0x6c, 0x0, 0x0, 0x66, 0x60, 0x0, 0xc, 0x67,
+    0x0, 0x1, 0xc6, 0x38, 0x0, 0x38, 0x61, 0xc0, 0x7, 0x6, 0xe, 0x0,
+    0xe0, 0x60, 0xf0, 0x1c, 0x6, 0x7, 0x83, 0x80, 0xe0, 0x3c, 0x71, 0xff,
+    0xf9, 0xe6, 0x1f, 0xff, 0x86, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+6731 */
+    0x0, 0x6, 0x0, 0x0, 0x10, 0x60, 0x0, 0x3, 0x6, 0x0, 0x0, 0x70,
+    0x60, 0x0, 0x7, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x1, 0xc0, 0x60, 0x0, 0x18, 0x6, 0x0, 0x1, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfc, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x76, 0xe0, 0x0,
+    0xe, 0x67, 0x0, 0x1, 0xc6, 0x38, 0x0, 0x38, 0x61, 0xc0, 0xf, 0x6,
+    0xf, 0x1, 0xe0, 0x60, 0x7c, 0x7c, 0x6, 0x3, 0xe7, 0x0, 0x60, 0xe,
+    0x40, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+674E */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf8, 0x0, 0x0, 0x3f, 0xc0,
+    0x0, 0xe, 0x67, 0x0, 0x3, 0xc6, 0x3e, 0x0, 0xf0, 0x60, 0xf8, 0x7e,
+    0x6, 0x7, 0xe7, 0x80, 0x0, 0x1e, 0x7, 0xff, 0xfc, 0x0, 0x7f, 0xff,
+    0xc0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x7, 0xc0, 0x0,
+    0x0, 0x70, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xc0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+6751 */
+    0x2, 0x0, 0x2, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x7, 0x0, 0x30,
+    0x0, 0x70, 0x3, 0x0, 0x7, 0x0, 0x30, 0x0, 0x70, 0x7f, 0xe7, 0xff,
+    0xe7, 0xff, 0x7f, 0xfe, 0x7, 0x3, 0xff, 0xc0, 0x70, 0x0, 0x70, 0x7,
+    0x0, 0x7, 0x0, 0xf0, 0x0, 0x70, 0xf, 0xc2, 0x7, 0x0, 0xfc, 0x30,
+    0x70, 0x1f, 0x63, 0x87, 0x1, 0xb7, 0x1c, 0x70, 0x33, 0x31, 0xc7, 0x7,
+    0x31, 0xc, 0x70, 0x63, 0x0, 0x7, 0x6, 0x30, 0x0, 0x70, 0x3, 0x0,
+    0x7, 0x0, 0x30, 0x0, 0x70, 0x3, 0x0, 0x7, 0x0, 0x30, 0x0, 0x70,
+    0x3, 0x0, 0x7e, 0x0, 0x30, 0x7, 0xe0, 0x2, 0x0, 0x78, 0x0,
+
+    /* U+675F */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c,
+    0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60,
+    0x38, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0x80, 0x0,
+    0x3, 0xf8, 0x0, 0x0, 0x76, 0xe0, 0x0, 0xe, 0x67, 0x0, 0x3, 0x86,
+    0x38, 0x0, 0xf0, 0x61, 0xf0, 0x3e, 0x6, 0x7, 0xc7, 0x80, 0x60, 0x3e,
+    0x70, 0x6, 0x0, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+676D */
+    0x2, 0x0, 0x20, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x61, 0xff, 0xfc, 0x7f, 0xdf, 0xff,
+    0xe7, 0xfc, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe,
+    0x0, 0xf0, 0x0, 0xe0, 0x3f, 0xc0, 0xf, 0x83, 0xfe, 0x1, 0xfc, 0x70,
+    0xe0, 0x1e, 0xe7, 0xe, 0x3, 0x66, 0x70, 0xe0, 0x36, 0x37, 0xe, 0x7,
+    0x60, 0x70, 0xe0, 0x66, 0x6, 0xe, 0x4, 0x60, 0x60, 0xe0, 0x6, 0x6,
+    0xe, 0x60, 0x60, 0xe0, 0xe6, 0x6, 0xc, 0xe, 0x60, 0x61, 0xc0, 0xee,
+    0x6, 0x38, 0xf, 0xe0, 0x63, 0x0, 0x7c, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+676F */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x1f, 0xff, 0xe0, 0x61,
+    0xff, 0xfe, 0x6, 0x0, 0x38, 0x0, 0x60, 0x3, 0x0, 0x7f, 0xe0, 0x70,
+    0x7, 0xfe, 0x7, 0x0, 0x7, 0x0, 0x60, 0x0, 0x60, 0xe, 0x0, 0xe,
+    0x0, 0xe0, 0x0, 0xf0, 0x1e, 0x0, 0xf, 0x83, 0xee, 0x1, 0xfc, 0x36,
+    0x60, 0x1e, 0x67, 0x67, 0x3, 0x66, 0xe6, 0x38, 0x36, 0x1c, 0x61, 0xc7,
+    0x61, 0xc6, 0x1c, 0x66, 0x38, 0x60, 0xe4, 0x67, 0x6, 0x6, 0x6, 0x20,
+    0x60, 0x20, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0,
+    0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x2, 0x0, 0x20, 0x0,
+
+    /* U+6771 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0x18,
+    0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0x80, 0x60,
+    0x18, 0x18, 0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x0,
+    0x3, 0xf8, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x7, 0xee, 0x0, 0x0, 0xe6,
+    0x70, 0x0, 0x3c, 0x63, 0xc0, 0xf, 0x6, 0x1f, 0x83, 0xe0, 0x60, 0x7e,
+    0x78, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+677E */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x3, 0xc0, 0x6, 0x0, 0x7e, 0x0, 0x60,
+    0x0, 0xe0, 0x6, 0x3, 0x6, 0x0, 0x60, 0x70, 0x70, 0x7f, 0xe7, 0x7,
+    0x7, 0xfe, 0x60, 0x30, 0x7, 0x6, 0x3, 0x0, 0x60, 0xe0, 0x38, 0xe,
+    0xc, 0x1, 0x80, 0xe1, 0xc0, 0x1c, 0xf, 0x18, 0x40, 0xe1, 0xf9, 0x8e,
+    0xe, 0x1f, 0xc0, 0xc0, 0x63, 0x6e, 0xc, 0x0, 0x36, 0x61, 0xc0, 0x7,
+    0x62, 0x18, 0x40, 0x66, 0x1, 0x86, 0x4, 0x60, 0x38, 0x70, 0x6, 0x3,
+    0x3, 0x80, 0x60, 0x30, 0x18, 0x6, 0x7, 0xf, 0xc0, 0x61, 0xff, 0xfc,
+    0x6, 0x3f, 0xf0, 0xe0, 0x61, 0x0, 0x4, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+677F */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0xf, 0xff, 0xe0, 0x60,
+    0xff, 0xfe, 0x6, 0xc, 0x0, 0x0, 0x60, 0xc0, 0x0, 0x7f, 0xcc, 0x0,
+    0x7, 0xfc, 0xc0, 0x0, 0xe, 0xc, 0x0, 0x0, 0xe0, 0xff, 0xf8, 0xe,
+    0xf, 0xff, 0xc0, 0xe0, 0xc0, 0x1c, 0x1f, 0x8d, 0x81, 0x81, 0xf8, 0xd8,
+    0x18, 0x1e, 0xdc, 0xc3, 0x83, 0x6d, 0xcc, 0x30, 0x36, 0x5c, 0xc7, 0x6,
+    0x61, 0x8e, 0x60, 0x66, 0x18, 0x7e, 0x4, 0x61, 0x87, 0xc0, 0x6, 0x30,
+    0x38, 0x0, 0x63, 0x7, 0xc0, 0x6, 0x70, 0xff, 0x0, 0x6e, 0x3c, 0x7c,
+    0x6, 0xe7, 0x83, 0xe0, 0x6c, 0xf0, 0xe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6790 */
+    0x2, 0x0, 0x0, 0x0, 0x30, 0x1, 0xfc, 0x3, 0x1, 0xff, 0x80, 0x30,
+    0x7f, 0xc0, 0x3, 0x7, 0x0, 0x0, 0x30, 0x60, 0x0, 0x7f, 0xe6, 0x0,
+    0x7, 0xff, 0x60, 0x0, 0x7, 0x6, 0x0, 0x0, 0x70, 0x60, 0x0, 0x7,
+    0x7, 0xff, 0xe0, 0xf0, 0x7f, 0xfe, 0xf, 0xc6, 0x6, 0x1, 0xfe, 0x60,
+    0x60, 0x1f, 0x66, 0x6, 0x3, 0xb3, 0x60, 0x60, 0x33, 0x36, 0x6, 0x7,
+    0x30, 0xe0, 0x60, 0x63, 0xe, 0x6, 0x4, 0x30, 0xc0, 0x60, 0x3, 0xc,
+    0x6, 0x0, 0x31, 0xc0, 0x60, 0x3, 0x18, 0x6, 0x0, 0x33, 0x80, 0x60,
+    0x3, 0x38, 0x6, 0x0, 0x33, 0x0, 0x60, 0x2, 0x0, 0x6, 0x0,
+
+    /* U+6797 */
+    0x3, 0x0, 0x10, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30,
+    0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x7f, 0xe7, 0xff,
+    0xc7, 0xff, 0x7f, 0xfe, 0x7, 0x0, 0x78, 0x0, 0x70, 0x7, 0x80, 0x7,
+    0x0, 0x7c, 0x0, 0xf0, 0x7, 0xc0, 0xf, 0xc0, 0xfc, 0x0, 0xfe, 0xf,
+    0xe0, 0x1b, 0x61, 0xb6, 0x3, 0xb3, 0x1b, 0x30, 0x33, 0x33, 0x33, 0x87,
+    0x30, 0x73, 0x18, 0x63, 0xe, 0x31, 0xc4, 0x30, 0xe3, 0xe, 0x3, 0x1c,
+    0x30, 0x60, 0x31, 0x83, 0x2, 0x3, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0,
+    0x3, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x10, 0x0,
+
+    /* U+679C */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf0, 0x1c, 0x6, 0x3, 0x81, 0x80,
+    0x60, 0x38, 0x18, 0x6, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
+    0x81, 0x80, 0x60, 0x38, 0x18, 0x6, 0x1, 0x81, 0xc0, 0x60, 0x38, 0x1f,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0,
+    0x3, 0xf8, 0x0, 0x0, 0x7e, 0xe0, 0x0, 0xe, 0x67, 0x0, 0x7, 0xc6,
+    0x3c, 0x1, 0xf0, 0x61, 0xf8, 0x7e, 0x6, 0x7, 0xe7, 0x80, 0x60, 0x1e,
+    0x40, 0x6, 0x0, 0x0, 0x0, 0x40, 0x0,
+
+    /* U+67B6 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x3f, 0x7, 0xff,
+    0x8f, 0xfc, 0x7f, 0xfc, 0xff, 0xc0, 0x31, 0xcc, 0xc, 0x7, 0xc, 0xc0,
+    0xc0, 0x70, 0xcc, 0xc, 0x6, 0xc, 0xc0, 0xc0, 0xe0, 0xcc, 0xc, 0x1c,
+    0x1c, 0xe1, 0xc3, 0x8f, 0x8f, 0xfc, 0x70, 0xf0, 0x7f, 0x86, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xe3,
+    0xff, 0xff, 0xfc, 0x0, 0x1f, 0x80, 0x0, 0x7, 0xfc, 0x0, 0x0, 0xe6,
+    0xf0, 0x0, 0x3c, 0x63, 0xc0, 0xf, 0x86, 0x1f, 0x7, 0xe0, 0x60, 0x7e,
+    0x78, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+67E5 */
+    0x0, 0x4, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x38, 0x0, 0x1f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0x0, 0x0, 0x1f, 0xf0, 0x0,
+    0x7, 0x77, 0x0, 0x1, 0xce, 0x78, 0x0, 0xf1, 0xc7, 0xc0, 0x7c, 0x38,
+    0x7e, 0x3e, 0x6, 0x3, 0xef, 0x80, 0x40, 0x1c, 0x87, 0xff, 0xf0, 0x1,
+    0xff, 0xff, 0x0, 0x30, 0x0, 0xe0, 0x7, 0x0, 0x1c, 0x0, 0xff, 0xff,
+    0x80, 0x1c, 0x0, 0x70, 0x3, 0x0, 0xe, 0x0, 0x7f, 0xff, 0xc0, 0x7,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+67EF */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x3f, 0xff, 0xe0, 0x63,
+    0xff, 0xfe, 0x6, 0x0, 0x1, 0x80, 0x60, 0x0, 0x18, 0x7f, 0xc0, 0x1,
+    0x87, 0xfe, 0x0, 0x18, 0xf, 0xf, 0xf1, 0x80, 0xe0, 0xff, 0x18, 0xe,
+    0xc, 0x31, 0x80, 0xe0, 0xc3, 0x18, 0x1f, 0x8c, 0x31, 0x81, 0xfc, 0xc3,
+    0x18, 0x1e, 0xcc, 0x31, 0x83, 0x6e, 0xc3, 0x18, 0x36, 0x4c, 0x31, 0x86,
+    0x60, 0xff, 0x18, 0x66, 0xf, 0xf1, 0x84, 0x60, 0x0, 0x18, 0x6, 0x0,
+    0x1, 0x80, 0x60, 0x0, 0x18, 0x6, 0x0, 0x1, 0x80, 0x60, 0x0, 0x18,
+    0x6, 0x0, 0x1f, 0x80, 0x60, 0x1, 0xf8, 0x6, 0x0, 0x1e, 0x0,
+
+    /* U+6817 */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x70, 0xe0, 0x0, 0x7,
+    0xc, 0x0, 0x0, 0x70, 0xe0, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0x83, 0x87, 0xc, 0x1c, 0x38, 0x70, 0xc1, 0xc3, 0x87, 0xc, 0x1c, 0x1f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x1, 0xf8, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x7, 0xee, 0x0, 0x1, 0xc6,
+    0x78, 0x0, 0xf8, 0x63, 0xf0, 0x3e, 0x6, 0xf, 0xe7, 0xc0, 0x60, 0x3e,
+    0x60, 0x6, 0x0, 0x60, 0x0, 0x60, 0x0,
+
+    /* U+6821 */
+    0x6, 0x0, 0x20, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0x60,
+    0x7, 0x0, 0x6, 0x1f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x7f, 0xc0, 0x0,
+    0x7, 0xfc, 0x0, 0x0, 0xe, 0x3, 0xe, 0x0, 0xe0, 0x70, 0x70, 0xe,
+    0xe, 0x3, 0xc0, 0xe1, 0xc0, 0x1e, 0x1f, 0x38, 0x0, 0xe1, 0xf9, 0x0,
+    0x0, 0x3e, 0xc3, 0x6, 0x3, 0x6c, 0x30, 0xe0, 0x76, 0x43, 0x8c, 0x6,
+    0x60, 0x19, 0xc0, 0x66, 0x1, 0xd8, 0x4, 0x60, 0xf, 0x80, 0x6, 0x0,
+    0x70, 0x0, 0x60, 0x1f, 0xc0, 0x6, 0x3, 0xde, 0x0, 0x60, 0xf0, 0xf8,
+    0x6, 0x3e, 0x3, 0xe0, 0x67, 0x80, 0x1e, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6838 */
+    0x2, 0x0, 0x20, 0x0, 0x60, 0x7, 0x0, 0x7, 0x0, 0x70, 0x0, 0x70,
+    0x7, 0x0, 0x7, 0x1f, 0xff, 0xe0, 0x71, 0xff, 0xfe, 0x7f, 0xef, 0xff,
+    0xc7, 0xfe, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0x1c, 0x70, 0xf,
+    0x1f, 0x86, 0x0, 0xf0, 0xf0, 0xe0, 0xf, 0x87, 0x1c, 0x1, 0xfc, 0x3b,
+    0x80, 0x1f, 0xe1, 0xf0, 0xc3, 0x76, 0xe, 0x1c, 0x37, 0x21, 0xc3, 0xc7,
+    0x70, 0x78, 0x78, 0x67, 0xf, 0xf, 0x4, 0x71, 0xe1, 0xe0, 0x7, 0x18,
+    0x1c, 0x0, 0x70, 0x7, 0xf0, 0x7, 0x1, 0xf7, 0x80, 0x70, 0x7c, 0x3c,
+    0x7, 0xf, 0x81, 0xe0, 0x61, 0xe0, 0xe, 0x2, 0x18, 0x0, 0x60,
+
+    /* U+683C */
+    0x6, 0x1, 0x80, 0x0, 0x60, 0x38, 0x0, 0x6, 0x3, 0x80, 0x0, 0x60,
+    0x7f, 0xf8, 0x6, 0x7, 0xff, 0x80, 0x60, 0xf0, 0x38, 0x7f, 0xcf, 0x3,
+    0x7, 0xfd, 0xd8, 0x70, 0xf, 0x39, 0x8e, 0x0, 0xe3, 0xd, 0xc0, 0xe,
+    0x0, 0x78, 0x0, 0xf0, 0xf, 0x80, 0x1f, 0x81, 0xfe, 0x1, 0xec, 0x78,
+    0xf8, 0x1e, 0xdf, 0x7, 0xe3, 0x67, 0xc0, 0x1e, 0x36, 0x3f, 0xff, 0x26,
+    0x60, 0xff, 0xf8, 0x66, 0xe, 0x3, 0x84, 0x60, 0xc0, 0x18, 0x6, 0xc,
+    0x1, 0x80, 0x60, 0xc0, 0x18, 0x6, 0xc, 0x1, 0x80, 0x60, 0xe0, 0x38,
+    0x6, 0xf, 0xff, 0x80, 0x60, 0x7f, 0xf0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6843 */
+    0x6, 0x1, 0x10, 0x0, 0x60, 0x19, 0x80, 0x6, 0x3, 0x98, 0x0, 0x60,
+    0x39, 0x80, 0x6, 0x3, 0x98, 0x0, 0x61, 0x39, 0x84, 0x7f, 0xdb, 0x98,
+    0xc7, 0xfd, 0xb9, 0x9c, 0xe, 0x1f, 0x9b, 0x80, 0xe0, 0xf9, 0xb0, 0xe,
+    0xf, 0x98, 0x0, 0xf0, 0x39, 0x80, 0xf, 0x83, 0x98, 0x1, 0xfc, 0x39,
+    0xa0, 0x1e, 0xc3, 0x9b, 0x3, 0x64, 0xf1, 0xb8, 0x36, 0x1f, 0x19, 0xc6,
+    0x63, 0xb1, 0x8e, 0x66, 0x33, 0x18, 0x44, 0x60, 0x71, 0x80, 0x6, 0x7,
+    0x18, 0x0, 0x60, 0xe1, 0x86, 0x6, 0x1e, 0x18, 0x60, 0x63, 0xc1, 0xce,
+    0x6, 0x78, 0x1f, 0xe0, 0x67, 0x0, 0xfc, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6848 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x70, 0x18, 0x0, 0xe7, 0x1, 0x80, 0xe, 0x60, 0x30, 0x0,
+    0x66, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff, 0x0, 0x1c, 0x7, 0x0, 0x1,
+    0xc0, 0x60, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x3, 0xff,
+    0xe0, 0x3f, 0xf8, 0x1f, 0x83, 0xe0, 0x60, 0x38, 0x0, 0x6, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x3, 0xf8, 0x0, 0x0, 0x7f,
+    0xc0, 0x0, 0xe, 0x6f, 0x0, 0x7, 0xc6, 0x3e, 0x1, 0xf0, 0x61, 0xfc,
+    0x7c, 0x6, 0x7, 0xe7, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+684C */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0xff, 0xf8, 0x0, 0xe, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x7, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff,
+    0xe0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x3f,
+    0xc0, 0x0, 0xf, 0x6f, 0x0, 0x3, 0xc6, 0x7e, 0x1, 0xf0, 0x61, 0xfc,
+    0x7c, 0x6, 0x7, 0xe7, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6850 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0xff, 0xe0, 0x18, 0x7f, 0xff, 0x3, 0x1f,
+    0xff, 0xe0, 0x63, 0x80, 0xc, 0xc, 0x70, 0x1, 0x9f, 0xee, 0xff, 0x33,
+    0xff, 0xff, 0xf6, 0xe, 0x3b, 0xfc, 0xc1, 0xc7, 0x0, 0x18, 0x38, 0xe0,
+    0x3, 0xf, 0x1c, 0x7c, 0x61, 0xf3, 0x9f, 0xcc, 0x3f, 0x73, 0x39, 0x8f,
+    0xee, 0xc3, 0x31, 0xf7, 0xd8, 0x66, 0x76, 0xfb, 0xc, 0xcc, 0xc7, 0x61,
+    0x99, 0x98, 0xee, 0x33, 0x23, 0x1c, 0xfe, 0x60, 0x63, 0x9f, 0xcc, 0xc,
+    0x70, 0xc1, 0x81, 0x8e, 0x0, 0x30, 0x31, 0xc0, 0x6, 0x6, 0x38, 0x7,
+    0xc0, 0xc7, 0x1, 0xf8, 0x10, 0x40, 0x1c, 0x0,
+
+    /* U+6854 */
+    0x6, 0x0, 0x20, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0x60,
+    0x7, 0x0, 0x6, 0x1f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x7f, 0xdf, 0xff,
+    0xc7, 0xfc, 0x7, 0x0, 0xf, 0x0, 0x70, 0x0, 0xe0, 0x7, 0x0, 0xe,
+    0x0, 0x70, 0x0, 0xe1, 0xff, 0xfc, 0xf, 0x8f, 0xff, 0xc1, 0xfc, 0x0,
+    0x0, 0x1e, 0xc0, 0x0, 0x3, 0x66, 0x0, 0x0, 0x36, 0x4f, 0xff, 0x86,
+    0x60, 0xff, 0xfc, 0x66, 0xc, 0x1, 0xc4, 0x60, 0xc0, 0x1c, 0x6, 0xc,
+    0x1, 0xc0, 0x60, 0xc0, 0x1c, 0x6, 0xc, 0x1, 0xc0, 0x60, 0xe0, 0x1c,
+    0x6, 0xf, 0xff, 0x80, 0x60, 0x7f, 0xf8, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6885 */
+    0x4, 0x6, 0x0, 0x0, 0x60, 0x60, 0x0, 0x6, 0xe, 0x0, 0x0, 0x60,
+    0xff, 0xfe, 0x6, 0x1f, 0xff, 0xe0, 0x61, 0x80, 0x0, 0x7f, 0xb8, 0x0,
+    0x7, 0xff, 0x3f, 0xf0, 0xe, 0x7f, 0xff, 0x80, 0xe0, 0xe0, 0x18, 0xe,
+    0xc, 0x61, 0x80, 0xe0, 0xc7, 0x18, 0x1f, 0xc, 0x11, 0x81, 0xf8, 0xc0,
+    0x18, 0x1e, 0xff, 0xff, 0xe3, 0x6f, 0xff, 0xfe, 0x36, 0x5c, 0x1, 0x86,
+    0x61, 0x86, 0x18, 0x66, 0x18, 0x71, 0x84, 0x61, 0x81, 0x18, 0x6, 0x18,
+    0x1, 0x80, 0x61, 0xff, 0xfe, 0x6, 0xf, 0xff, 0xe0, 0x60, 0x0, 0x38,
+    0x6, 0x0, 0x7, 0x80, 0x60, 0x1, 0xf0, 0x4, 0x0, 0x1e, 0x0,
+
+    /* U+6897 */
+    0x6, 0x0, 0x0, 0x0, 0x63, 0xff, 0xfc, 0x6, 0x3f, 0xff, 0xe0, 0x61,
+    0xff, 0xfc, 0x6, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x7f, 0xcf, 0xff,
+    0x87, 0xfd, 0xff, 0xfc, 0xe, 0x18, 0x60, 0xc0, 0xe1, 0x86, 0xc, 0xe,
+    0x1f, 0xff, 0xc0, 0xe1, 0xff, 0xfc, 0x1f, 0x98, 0x70, 0xc1, 0xf9, 0x86,
+    0xc, 0x1e, 0xd8, 0x61, 0xc3, 0x6d, 0xff, 0xfc, 0x36, 0x4f, 0xff, 0x86,
+    0x60, 0x6, 0x0, 0x66, 0xc, 0x60, 0x4, 0x60, 0x6e, 0x0, 0x6, 0x7,
+    0xc0, 0x0, 0x60, 0x3c, 0x0, 0x6, 0x3, 0xf0, 0x0, 0x60, 0xff, 0xf0,
+    0x6, 0x7e, 0x1f, 0xe0, 0x6f, 0x80, 0x3e, 0x6, 0x40, 0x0, 0x0,
+
+    /* U+689D */
+    0x1, 0x1, 0x0, 0x0, 0x30, 0x38, 0x0, 0x3, 0x3, 0x80, 0x0, 0x70,
+    0x7f, 0xfe, 0x6, 0xf, 0xff, 0xe0, 0x6d, 0xf0, 0x70, 0xe, 0xdf, 0x86,
+    0x0, 0xcd, 0x1c, 0xe0, 0x1c, 0xc0, 0xfc, 0x1, 0xcc, 0x7, 0x80, 0x3c,
+    0xc1, 0xfe, 0x3, 0xcc, 0xfc, 0xfc, 0x7c, 0xdf, 0x3, 0xe6, 0xcd, 0xc3,
+    0xe, 0xc, 0xc0, 0x30, 0x0, 0xcc, 0x7, 0x0, 0xc, 0xdf, 0xff, 0xe0,
+    0xcd, 0xff, 0xfc, 0xc, 0xc0, 0xf8, 0x0, 0xcc, 0x1f, 0xc0, 0xc, 0xc3,
+    0xb6, 0x0, 0xcc, 0x73, 0x78, 0xc, 0x1e, 0x33, 0xc0, 0xc3, 0xc3, 0xe,
+    0xc, 0x38, 0x30, 0x60, 0xc0, 0x3, 0x0, 0xc, 0x0, 0x20, 0x0,
+
+    /* U+68AF */
+    0x6, 0x2, 0x6, 0x0, 0xc0, 0xe0, 0xc0, 0x18, 0xc, 0x38, 0x3, 0x1,
+    0x86, 0x0, 0x61, 0xff, 0xf0, 0xc, 0x7f, 0xff, 0x9f, 0xf0, 0x1c, 0x73,
+    0xfe, 0x3, 0x6, 0xe, 0x0, 0x60, 0xc1, 0xc0, 0xc, 0x38, 0x38, 0x3f,
+    0xff, 0x7, 0xf, 0xff, 0xc1, 0xf9, 0x86, 0x0, 0x3f, 0x30, 0xc0, 0x7,
+    0xbe, 0x18, 0x1, 0xb7, 0xff, 0xfc, 0x36, 0x1f, 0xff, 0xec, 0xc0, 0x1e,
+    0x1d, 0x98, 0x7, 0x81, 0xa3, 0x1, 0xf0, 0x70, 0x60, 0x76, 0xe, 0xc,
+    0x3c, 0xc1, 0xc1, 0x8f, 0x18, 0xf0, 0x33, 0xc3, 0x3e, 0x6, 0x60, 0x63,
+    0x0, 0xc0, 0xc, 0x0, 0x18, 0x0, 0x80, 0x0,
+
+    /* U+68DF */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x63,
+    0xff, 0xfe, 0x6, 0x3f, 0xff, 0xe0, 0x60, 0x6, 0x0, 0x7f, 0xc0, 0x60,
+    0x7, 0xfd, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0x80, 0xe1, 0x86, 0x1c, 0xe,
+    0x18, 0x61, 0xc0, 0xe1, 0xff, 0xfc, 0x1f, 0x1f, 0xff, 0xc1, 0xf9, 0x86,
+    0xc, 0x1e, 0xd8, 0x61, 0xc3, 0x6d, 0xff, 0xf8, 0x76, 0x4f, 0xff, 0x86,
+    0x60, 0xf, 0x0, 0x66, 0x1, 0xf8, 0x4, 0x60, 0x37, 0xc0, 0x6, 0x7,
+    0x6e, 0x0, 0x61, 0xe6, 0x78, 0x6, 0x3c, 0x63, 0xc0, 0x6f, 0x6, 0xe,
+    0x6, 0xe0, 0x60, 0x60, 0x60, 0x6, 0x0, 0x4, 0x0, 0x60, 0x0,
+
+    /* U+68E3 */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x61,
+    0xff, 0xf8, 0x6, 0x1f, 0xff, 0x80, 0x60, 0x6, 0x1c, 0x7f, 0xc0, 0x61,
+    0xc7, 0xfd, 0xff, 0xfe, 0xe, 0x3f, 0xff, 0xe0, 0xe0, 0x7, 0x1c, 0xe,
+    0x0, 0x61, 0xc0, 0xe0, 0x6, 0x18, 0x1f, 0x9f, 0xff, 0x81, 0xf9, 0xff,
+    0xf8, 0x1e, 0xc0, 0x60, 0x3, 0x6d, 0x87, 0xe, 0x36, 0x1c, 0x71, 0xc6,
+    0x60, 0xe7, 0xbc, 0x66, 0x6, 0x7f, 0x4, 0x60, 0x6, 0xe0, 0x6, 0x3,
+    0x66, 0x0, 0x60, 0xf6, 0x30, 0x6, 0x3e, 0x63, 0xc0, 0x67, 0x86, 0x1e,
+    0x6, 0x61, 0xe0, 0xe0, 0x60, 0x3e, 0x6, 0x4, 0x3, 0xc0, 0x0,
+
+    /* U+68EE */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x1, 0xf8, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x1e, 0x6f, 0x0, 0x7, 0xc6, 0x3f, 0x3, 0xf0, 0x60, 0xfc, 0x7c,
+    0x6, 0x3, 0xe7, 0x10, 0x61, 0x84, 0x3, 0x86, 0x18, 0x0, 0x38, 0x1,
+    0x80, 0x3f, 0xf1, 0xff, 0xc7, 0xff, 0xbf, 0xfe, 0x3f, 0xf1, 0xff, 0xc0,
+    0x78, 0x3, 0xc0, 0x7, 0xc0, 0x7e, 0x0, 0xff, 0xf, 0xf0, 0x1f, 0xb9,
+    0xdb, 0x83, 0xb9, 0x39, 0x9c, 0x73, 0x87, 0x18, 0xe6, 0x38, 0xe1, 0x8e,
+    0x43, 0x8c, 0x18, 0x20, 0x38, 0x1, 0x80, 0x1, 0x0, 0x18, 0x0,
+
+    /* U+690D */
+    0x4, 0x0, 0x10, 0x0, 0x60, 0x3, 0x80, 0x6, 0x0, 0x38, 0x0, 0x63,
+    0xff, 0xfe, 0x6, 0x3f, 0xff, 0xe0, 0x60, 0x3, 0x80, 0x7f, 0x80, 0x38,
+    0x7, 0xfc, 0x3, 0x80, 0xe, 0x11, 0xff, 0x80, 0xe3, 0xbf, 0xfc, 0xe,
+    0x3b, 0x1, 0xc1, 0xe3, 0xb8, 0x1c, 0x1f, 0x3b, 0xff, 0xc1, 0xfb, 0xb8,
+    0x1c, 0x3f, 0xbb, 0x0, 0xc3, 0x6f, 0xb8, 0x1c, 0x76, 0xfb, 0xff, 0xc6,
+    0x63, 0xb8, 0x1c, 0x66, 0x3b, 0x0, 0xc4, 0x63, 0xb8, 0x1c, 0x6, 0x39,
+    0xff, 0x80, 0x63, 0x9f, 0xf8, 0x6, 0x38, 0x0, 0x0, 0x63, 0x80, 0x0,
+    0x6, 0x1f, 0xff, 0xe0, 0x60, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+694A */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0x7f, 0xf0, 0x6, 0xf, 0xff, 0x80, 0x60,
+    0xc0, 0x18, 0x6, 0xc, 0x1, 0x80, 0x60, 0xff, 0xf8, 0x7f, 0xcf, 0xff,
+    0x87, 0xfc, 0xc0, 0x18, 0xe, 0xc, 0x3, 0x80, 0xe0, 0xff, 0xf8, 0xe,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x3f, 0xff, 0xe1, 0xfb, 0xff,
+    0xfe, 0x3e, 0xc6, 0x0, 0x3, 0x6c, 0xe0, 0x0, 0x36, 0xf, 0xff, 0xc6,
+    0x63, 0xdd, 0xfc, 0x66, 0x71, 0x9c, 0xc4, 0x6e, 0x31, 0x8c, 0x6, 0x7,
+    0x38, 0xc0, 0x61, 0xe3, 0xc, 0x6, 0x38, 0x60, 0xc0, 0x62, 0x1e, 0x1c,
+    0x6, 0xf, 0x83, 0x80, 0x61, 0xf0, 0xf8, 0x4, 0x18, 0xf, 0x0,
+
+    /* U+696D */
+    0x0, 0x30, 0x80, 0x0, 0xc3, 0xc, 0x70, 0xe, 0x31, 0xc6, 0x0, 0x63,
+    0x1c, 0xc0, 0x2, 0x31, 0xc4, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x0, 0xe, 0x7, 0x0, 0x3f,
+    0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf8, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0xf, 0x6f, 0x0, 0x7, 0xc6, 0x7c, 0x1, 0xf0, 0x61, 0xfc,
+    0x7e, 0x6, 0x7, 0xe7, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6975 */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x7f, 0xff, 0xe0, 0x67,
+    0xff, 0xfc, 0x6, 0x3, 0x0, 0x0, 0x60, 0x30, 0x0, 0x7f, 0xc7, 0x0,
+    0x7, 0xfc, 0x7e, 0x0, 0xe, 0x3, 0xf7, 0xc0, 0xe0, 0x7, 0xfe, 0xe,
+    0x1f, 0x70, 0x60, 0xe3, 0xf7, 0x6, 0x1f, 0x33, 0x74, 0xc1, 0xfb, 0x37,
+    0x6c, 0x3f, 0xb3, 0x77, 0xc3, 0x6f, 0x37, 0x38, 0x36, 0xb3, 0x61, 0x86,
+    0x63, 0x36, 0x38, 0x66, 0x3f, 0x63, 0xc4, 0x61, 0xf6, 0x6e, 0x6, 0x0,
+    0x6e, 0x60, 0x60, 0x1e, 0xc2, 0x6, 0x3, 0xc0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xe0, 0x67, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+697D */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x38, 0xe, 0x1, 0xc3, 0xc7,
+    0xfe, 0x38, 0x1e, 0x70, 0xe7, 0x0, 0x66, 0x6, 0xe0, 0x0, 0x60, 0x64,
+    0x0, 0x6, 0x6, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x26, 0x6, 0xe0, 0xf,
+    0x60, 0x6f, 0x3, 0xe6, 0x6, 0x3c, 0x78, 0x7f, 0xe1, 0xc6, 0x7, 0xfe,
+    0x4, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x3, 0xfc, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x1e, 0x67, 0x80, 0xf, 0x86, 0x3f, 0x3, 0xf0, 0x60, 0xfe,
+    0x7c, 0x6, 0x3, 0xe7, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6995 */
+    0x4, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe1,
+    0xff, 0xf8, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0x80, 0x1e, 0x7f, 0xb8, 0x0,
+    0xe7, 0xff, 0x10, 0xcc, 0xe, 0x7, 0xe, 0x0, 0xe0, 0xe0, 0x78, 0xe,
+    0x1c, 0x63, 0xc1, 0xe3, 0x8e, 0xc, 0x1f, 0x81, 0xf8, 0x1, 0xf8, 0x39,
+    0xc0, 0x3e, 0xc7, 0xe, 0x3, 0xec, 0xe0, 0x78, 0x7e, 0x3c, 0x3, 0xc6,
+    0xe7, 0x9f, 0xde, 0x6e, 0x6f, 0xff, 0x64, 0xe0, 0xff, 0xf0, 0xe, 0xc,
+    0x3, 0x80, 0xe0, 0xc0, 0x38, 0xe, 0xc, 0x3, 0x80, 0xe0, 0xe0, 0x78,
+    0xe, 0xf, 0xff, 0x0, 0xe0, 0x7f, 0xf0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+699C */
+    0x4, 0x0, 0x60, 0x0, 0xc0, 0xc, 0x0, 0x18, 0x1, 0x80, 0x3, 0x1f,
+    0xff, 0xe0, 0x63, 0xff, 0xfc, 0xc, 0xe, 0xc, 0x1f, 0xe1, 0xc1, 0x83,
+    0xfe, 0x18, 0x70, 0xe, 0xf, 0xff, 0x81, 0xc7, 0xff, 0xfc, 0x38, 0xff,
+    0xff, 0x8f, 0x38, 0x20, 0x71, 0xf3, 0x6, 0x6, 0x3f, 0x0, 0xc0, 0xf,
+    0xe7, 0xff, 0xf1, 0xb7, 0xff, 0xff, 0x76, 0xc3, 0x80, 0xc, 0xc0, 0x70,
+    0x1, 0x98, 0xf, 0xfc, 0x23, 0x1, 0xff, 0xc0, 0x60, 0x30, 0x38, 0xc,
+    0xe, 0x7, 0x1, 0x81, 0x80, 0xe0, 0x30, 0xf0, 0x1c, 0x6, 0x7c, 0x3f,
+    0x0, 0xcf, 0x7, 0xc0, 0x10, 0x0, 0x60, 0x0,
+
+    /* U+69AE */
+    0x1, 0x0, 0x18, 0x0, 0x38, 0x1, 0x80, 0x1b, 0x99, 0x98, 0xc3, 0xbb,
+    0x99, 0x9c, 0x33, 0x33, 0x19, 0x83, 0x32, 0x33, 0x90, 0x7, 0x80, 0x3e,
+    0x0, 0xee, 0xe, 0x70, 0x3c, 0x7b, 0xc3, 0xc7, 0x81, 0xb8, 0xc, 0x0,
+    0x3, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xc7, 0x0, 0x0,
+    0xe, 0x70, 0x6, 0x0, 0xe7, 0x0, 0x60, 0xe, 0x67, 0xff, 0xfe, 0xe0,
+    0xff, 0xff, 0xf0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x76,
+    0xe0, 0x0, 0x1c, 0x67, 0x80, 0x7, 0x86, 0x1f, 0x3, 0xe0, 0x60, 0xfc,
+    0x7c, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+6A02 */
+    0x0, 0x4, 0x0, 0x0, 0x60, 0xe0, 0x60, 0xc, 0xf, 0x6, 0x0, 0xc3,
+    0xfc, 0xe0, 0x19, 0xff, 0xcc, 0xc7, 0x9b, 0xf, 0x8c, 0x7b, 0xb0, 0xf9,
+    0x83, 0xf3, 0xd, 0xf8, 0xe, 0x3f, 0xcf, 0x0, 0xe3, 0xc, 0x60, 0xd,
+    0xb0, 0xc6, 0xc1, 0x9f, 0xc, 0xce, 0x3f, 0xf1, 0xdf, 0xe7, 0xff, 0xff,
+    0xfe, 0x20, 0x1f, 0x90, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xf6,
+    0xe0, 0x0, 0x1c, 0x67, 0x80, 0xf, 0x86, 0x3f, 0x3, 0xe0, 0x60, 0xfe,
+    0x7c, 0x6, 0x3, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6A11 */
+    0x4, 0x0, 0x0, 0x0, 0x61, 0x8f, 0xe0, 0x6, 0x1d, 0xff, 0x80, 0x60,
+    0xcf, 0xf8, 0x6, 0x20, 0x19, 0x80, 0x63, 0x9, 0x9c, 0x7f, 0xb9, 0xb1,
+    0xe7, 0xf9, 0x1b, 0x1e, 0xe, 0x3, 0x33, 0xe0, 0xe0, 0xb3, 0x3a, 0xe,
+    0x8, 0x63, 0x1, 0xe1, 0x9e, 0x30, 0x1f, 0x3b, 0xcf, 0x1, 0xfb, 0x30,
+    0xe0, 0x3f, 0xa0, 0x60, 0x3, 0x68, 0x6, 0x0, 0x76, 0xbf, 0xff, 0xc6,
+    0x63, 0xff, 0xfe, 0x66, 0x0, 0xf0, 0x4, 0x60, 0x1f, 0x80, 0x6, 0x3,
+    0xfc, 0x0, 0x60, 0x76, 0xe0, 0x6, 0xe, 0x67, 0x80, 0x63, 0xc6, 0x3c,
+    0x6, 0x78, 0x60, 0xe0, 0x62, 0x6, 0x6, 0x4, 0x0, 0x60, 0x0,
+
+    /* U+6A13 */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x6, 0x0, 0x6, 0x0, 0x60, 0x0, 0x60,
+    0xff, 0xf8, 0x6, 0x1f, 0xff, 0x80, 0x61, 0x86, 0x1c, 0x6, 0x3f, 0xff,
+    0xe7, 0xfb, 0xff, 0xfe, 0x7f, 0x98, 0x61, 0xc0, 0xe1, 0xc7, 0x18, 0xe,
+    0xf, 0xff, 0x80, 0xe0, 0x7, 0x0, 0xe, 0x7, 0xfe, 0x1, 0xf0, 0xff,
+    0xf8, 0x1f, 0x9c, 0x61, 0xc1, 0xed, 0x86, 0x1c, 0x36, 0xdf, 0xff, 0x87,
+    0x64, 0xff, 0xf8, 0x66, 0x1, 0x80, 0x6, 0x67, 0xff, 0xfe, 0x46, 0x7f,
+    0xff, 0xe0, 0x60, 0x60, 0x60, 0x6, 0xe, 0xe, 0x0, 0x60, 0xff, 0xc0,
+    0x6, 0x1, 0xfc, 0x0, 0x60, 0x1f, 0xfc, 0x6, 0x7f, 0xc3, 0xe0, 0x43,
+    0x80, 0x6,
+
+    /* U+6A21 */
+    0x6, 0x3, 0x4, 0x0, 0x60, 0x30, 0xe0, 0x6, 0x3, 0xe, 0x0, 0x63,
+    0xff, 0xfe, 0x6, 0x3f, 0xff, 0xe0, 0x60, 0x30, 0xe0, 0x7f, 0xc3, 0x4,
+    0x7, 0xfe, 0x0, 0x0, 0xe, 0x1f, 0xff, 0x80, 0xe1, 0xc0, 0x18, 0xe,
+    0x18, 0x1, 0xc0, 0xe1, 0xff, 0xfc, 0x1f, 0x9f, 0xff, 0xc1, 0xf9, 0x80,
+    0x1c, 0x16, 0xdc, 0x1, 0x83, 0x6d, 0xff, 0xf8, 0x36, 0x40, 0xf0, 0x6,
+    0x60, 0x6, 0x0, 0x66, 0x3f, 0xff, 0xe4, 0x67, 0xff, 0xfe, 0x6, 0x0,
+    0xf0, 0x0, 0x60, 0x1f, 0x80, 0x6, 0x3, 0x9c, 0x0, 0x60, 0xf0, 0xf0,
+    0x6, 0x3e, 0x7, 0xe0, 0x67, 0x80, 0x1e, 0x6, 0x20, 0x0, 0x0,
+
+    /* U+6A23 */
+    0x4, 0x4, 0x2, 0x0, 0x60, 0x60, 0x60, 0x6, 0x7, 0xe, 0x0, 0x63,
+    0xff, 0xfc, 0x6, 0x3f, 0xff, 0xe0, 0x60, 0x6, 0x0, 0x7f, 0xc0, 0x60,
+    0x7, 0xfd, 0xff, 0xf8, 0xe, 0xf, 0xff, 0x0, 0xe0, 0x6, 0x0, 0xe,
+    0x3f, 0xff, 0xe1, 0xe3, 0xff, 0xfe, 0x1f, 0x1, 0x80, 0x1, 0xf8, 0x3f,
+    0x80, 0x3f, 0x80, 0x7c, 0x3, 0xec, 0xfc, 0x4, 0x76, 0xdf, 0xe0, 0xe6,
+    0x60, 0x7, 0x1c, 0x66, 0x3e, 0x33, 0x84, 0x67, 0xf3, 0xe0, 0x6, 0x3,
+    0x3c, 0x0, 0x60, 0x63, 0x70, 0x6, 0x1c, 0x33, 0x80, 0x63, 0x83, 0x1e,
+    0x6, 0xf0, 0xf0, 0xe0, 0x6c, 0x1e, 0x2, 0x4, 0x1, 0xc0, 0x0,
+
+    /* U+6A4B */
+    0x6, 0x0, 0x7, 0x0, 0x61, 0xff, 0xf8, 0x6, 0x3f, 0xfe, 0x0, 0x60,
+    0xc, 0x0, 0x6, 0x1, 0xc0, 0x0, 0x63, 0xff, 0xfe, 0x7f, 0xbf, 0xff,
+    0xe7, 0xf8, 0x70, 0xc0, 0xe, 0xe, 0xe, 0x0, 0xe1, 0xff, 0xf0, 0xe,
+    0x3f, 0xff, 0xc0, 0xe7, 0xe0, 0x7e, 0x1f, 0x66, 0x6, 0x61, 0xf8, 0x7f,
+    0xe0, 0x3e, 0xc3, 0xf8, 0x3, 0x6c, 0x0, 0x0, 0x36, 0x5f, 0xff, 0xc6,
+    0x63, 0xff, 0xfc, 0x66, 0x30, 0x0, 0xc4, 0x63, 0x3f, 0xcc, 0x6, 0x33,
+    0xfc, 0xc0, 0x63, 0x30, 0xcc, 0x6, 0x33, 0xc, 0xc0, 0x63, 0x3f, 0xcc,
+    0x6, 0x31, 0xfb, 0xc0, 0x63, 0x0, 0x7c, 0x6, 0x30, 0x3, 0x0,
+
+    /* U+6A59 */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0xfc, 0x0, 0x6, 0x1f, 0xe1, 0x0, 0x60,
+    0xe, 0x30, 0x6, 0x0, 0xf6, 0x0, 0x61, 0x9b, 0xcc, 0x7f, 0xdf, 0x99,
+    0xc7, 0xfc, 0xf0, 0xf8, 0xe, 0x6, 0x7, 0x0, 0xe0, 0xc0, 0x38, 0xe,
+    0x3f, 0xff, 0xc1, 0xe3, 0xff, 0xee, 0x1f, 0x60, 0x0, 0x61, 0xf8, 0x0,
+    0x0, 0x3f, 0x8f, 0xff, 0x3, 0xec, 0xff, 0xf8, 0x76, 0xdc, 0x3, 0x86,
+    0x61, 0xc0, 0x18, 0x66, 0x1c, 0x3, 0x84, 0x60, 0xff, 0xf8, 0x6, 0x7,
+    0xff, 0x0, 0x60, 0x30, 0xc0, 0x6, 0x3, 0xc, 0x0, 0x60, 0x30, 0xc0,
+    0x6, 0x7f, 0xff, 0xe0, 0x6f, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+6A5F */
+    0x4, 0x0, 0x40, 0x0, 0x60, 0xc6, 0x30, 0x6, 0x1c, 0x67, 0x0, 0x61,
+    0x86, 0x60, 0x6, 0x3b, 0x66, 0xc0, 0x67, 0x37, 0xdc, 0x7f, 0xfe, 0x6f,
+    0x87, 0xf9, 0xe6, 0x78, 0xe, 0xc, 0x63, 0x0, 0xe0, 0xf6, 0x6c, 0xe,
+    0x1b, 0x67, 0xe0, 0xe3, 0xff, 0xfe, 0x1f, 0x7d, 0xfe, 0x21, 0xf8, 0x6,
+    0x30, 0x3f, 0x80, 0x73, 0x83, 0x6f, 0xff, 0xfe, 0x36, 0x1f, 0xff, 0xc6,
+    0x61, 0x83, 0x8, 0x66, 0x1c, 0x31, 0x84, 0x61, 0xf1, 0xb8, 0x6, 0x1b,
+    0x9f, 0x0, 0x63, 0x11, 0xc0, 0x6, 0x30, 0x3e, 0x20, 0x67, 0x1f, 0x66,
+    0x6, 0xe3, 0xc3, 0xe0, 0x6c, 0x30, 0x1e, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+6A94 */
+    0x4, 0x0, 0x20, 0x1, 0xc1, 0x8c, 0x30, 0x38, 0x39, 0xce, 0x7, 0x3,
+    0x39, 0x80, 0xe0, 0x7, 0x0, 0x1c, 0x3f, 0xff, 0x9f, 0xef, 0xff, 0xf3,
+    0xff, 0x80, 0x7, 0xe, 0x31, 0xfc, 0xe1, 0xc6, 0x7f, 0xdc, 0x38, 0x5c,
+    0x19, 0xf, 0x3, 0x3, 0x1, 0xf0, 0x7f, 0xe0, 0x3f, 0x7, 0xfc, 0xf,
+    0xf0, 0x0, 0x1, 0xf6, 0x3f, 0xf8, 0x7e, 0x5f, 0xff, 0xcd, 0xc3, 0x8e,
+    0x39, 0xb8, 0x61, 0xc3, 0x27, 0xc, 0x38, 0x60, 0xe1, 0xff, 0xfc, 0x1c,
+    0x3f, 0xff, 0x83, 0x86, 0x1c, 0x30, 0x70, 0xc3, 0x86, 0xe, 0x1f, 0xff,
+    0xc1, 0xc3, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+6AA2 */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x4, 0x0, 0x6, 0x0, 0xe0, 0x0, 0x60,
+    0x1e, 0x0, 0x6, 0x1, 0xf0, 0x0, 0x60, 0x3b, 0x80, 0x6, 0x7, 0x1c,
+    0x7, 0xf8, 0xe0, 0xf0, 0x7f, 0xdc, 0x7, 0xc0, 0xe3, 0xff, 0xfe, 0xe,
+    0x73, 0xfc, 0xe0, 0xe6, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x1, 0xf1, 0xf9,
+    0xf8, 0x1f, 0x9f, 0x9f, 0xc3, 0xed, 0x9f, 0x8c, 0x36, 0xd9, 0xf8, 0xc7,
+    0x61, 0x9f, 0x9c, 0x66, 0x1f, 0x9f, 0xc6, 0x61, 0xf9, 0xf8, 0x46, 0xe,
+    0xe, 0x0, 0x60, 0xc0, 0xc0, 0x6, 0xe, 0xe, 0x0, 0x61, 0xf9, 0xf0,
+    0x6, 0x39, 0xbb, 0xc0, 0x67, 0x7, 0x1c, 0x6, 0xe0, 0xe0, 0xe0, 0x40,
+    0x0, 0x0,
+
+    /* U+6AC3 */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0xff, 0xfc, 0x6, 0x3f, 0xff, 0xe0, 0x63,
+    0x81, 0x0, 0x6, 0x30, 0x18, 0x0, 0x63, 0x3f, 0xfc, 0x7f, 0xb3, 0x18,
+    0xc7, 0xff, 0x33, 0x9c, 0xe, 0x33, 0xff, 0x80, 0xe3, 0x1, 0x80, 0xe,
+    0x37, 0xff, 0xe1, 0xe3, 0x7f, 0xfc, 0x1f, 0x31, 0xff, 0x81, 0xfb, 0x3f,
+    0xfc, 0x3f, 0xb3, 0x1, 0xc3, 0x6f, 0x3f, 0xfc, 0x76, 0xb3, 0x0, 0xc6,
+    0x63, 0x3f, 0xfc, 0x66, 0x33, 0x0, 0xc4, 0x63, 0x3f, 0xfc, 0x6, 0x31,
+    0xff, 0x80, 0x63, 0x4, 0x20, 0x6, 0x33, 0xc7, 0xc0, 0x63, 0x70, 0xc,
+    0x6, 0x3f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+6AE5 */
+    0x4, 0x0, 0x20, 0x0, 0xe0, 0x3, 0x0, 0xe, 0xf, 0xff, 0xc0, 0xe3,
+    0xff, 0xfe, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0x18, 0xc, 0x7f, 0xb1, 0x80,
+    0xc7, 0xfb, 0xff, 0xc, 0xe, 0x37, 0xf0, 0xc0, 0xe3, 0x18, 0x7c, 0xe,
+    0x33, 0xcf, 0xe1, 0xe3, 0x7e, 0x7c, 0x1f, 0x30, 0x0, 0xc1, 0xf3, 0x7e,
+    0x8c, 0x3f, 0xa7, 0xec, 0xc3, 0xee, 0x66, 0xcc, 0x6e, 0x66, 0x66, 0xc6,
+    0xe6, 0x66, 0x6c, 0x6e, 0x67, 0xe2, 0xc4, 0xe6, 0x20, 0xc, 0xe, 0x62,
+    0x20, 0xc0, 0xe6, 0x26, 0xc, 0xe, 0x62, 0x60, 0xc0, 0xee, 0x7f, 0x8c,
+    0xe, 0xdf, 0xf7, 0xc0, 0xec, 0xc0, 0x78, 0x4, 0x0, 0x3, 0x0,
+
+    /* U+6B0A */
+    0x4, 0x2, 0xc, 0x0, 0x60, 0x30, 0xc0, 0x6, 0x7f, 0xff, 0xe0, 0x67,
+    0xff, 0xfe, 0x6, 0x7, 0xc, 0x0, 0x60, 0x20, 0xc0, 0x7f, 0x8e, 0x7,
+    0x7, 0xfb, 0xf9, 0xfc, 0xe, 0x31, 0xb8, 0xc0, 0xe3, 0x1b, 0x8c, 0xe,
+    0x3f, 0x9f, 0xc0, 0xf1, 0xf9, 0xfc, 0x1f, 0x84, 0x10, 0x1, 0xf9, 0xc3,
+    0x0, 0x3e, 0xdf, 0xff, 0xe3, 0x63, 0xff, 0xfe, 0x76, 0x78, 0x30, 0x6,
+    0x6f, 0xc3, 0x80, 0x66, 0xdf, 0xff, 0xc4, 0x61, 0x83, 0x0, 0x6, 0x18,
+    0x30, 0x0, 0x61, 0xff, 0xfc, 0x6, 0x1c, 0x38, 0x0, 0x61, 0x83, 0x0,
+    0x6, 0x1f, 0xff, 0xe0, 0x60, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+6B21 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0xc1,
+    0x80, 0x0, 0x1e, 0x38, 0x0, 0x0, 0xe3, 0xff, 0xfc, 0x6, 0x3f, 0xff,
+    0xe0, 0x7, 0x0, 0x1c, 0x0, 0xe1, 0x80, 0xc0, 0xe, 0x18, 0x1c, 0x1,
+    0xc1, 0x81, 0x80, 0x8, 0x18, 0x38, 0x0, 0x1, 0x83, 0x0, 0x10, 0x18,
+    0x20, 0x3, 0x3, 0xc0, 0x0, 0x70, 0x3c, 0x0, 0xe, 0x3, 0xe0, 0x0,
+    0xe0, 0x76, 0x0, 0x1c, 0x7, 0x30, 0x3, 0x80, 0xe3, 0x80, 0x38, 0x1e,
+    0x1c, 0x7, 0x3, 0xc1, 0xe0, 0x60, 0x78, 0xf, 0x0, 0x1f, 0x0, 0x7c,
+    0x7, 0xe0, 0x3, 0xe0, 0x78, 0x0, 0xe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6B23 */
+    0x0, 0x10, 0x40, 0x0, 0x1f, 0x8c, 0x0, 0xf, 0xf0, 0xc0, 0x1, 0xf0,
+    0x1c, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80, 0x1f, 0xfc, 0x38, 0x1, 0xff,
+    0xe3, 0x80, 0x38, 0xe, 0x38, 0x3, 0x10, 0xe3, 0xff, 0xb3, 0xc, 0x3f,
+    0xf7, 0x31, 0xc3, 0x8c, 0x63, 0x18, 0x30, 0xc4, 0x31, 0x83, 0xc, 0x3,
+    0x0, 0x30, 0xc0, 0x38, 0x3, 0xc, 0x3, 0x80, 0x30, 0xc0, 0x78, 0x3,
+    0xc, 0x7, 0xc0, 0x30, 0xc0, 0x6c, 0x3, 0xc, 0x6, 0xe0, 0x30, 0xc0,
+    0xe6, 0x7, 0xc, 0x1c, 0x70, 0x70, 0xc1, 0xc3, 0x86, 0xc, 0x38, 0x1c,
+    0x60, 0xc7, 0x1, 0xe0, 0xc, 0xe0, 0xe, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+6B3D */
+    0x3, 0x0, 0x80, 0x0, 0x70, 0x1c, 0x0, 0x7, 0x81, 0xc0, 0x0, 0xfe,
+    0x18, 0x0, 0x1c, 0x71, 0x80, 0x3, 0x83, 0x3f, 0xfc, 0x38, 0x13, 0xff,
+    0xe7, 0x0, 0x30, 0xe, 0x7f, 0xe7, 0x30, 0xc1, 0xfe, 0x63, 0xc, 0x3,
+    0xe, 0x31, 0xc0, 0x30, 0xc3, 0x18, 0x3f, 0xe0, 0x33, 0x87, 0xff, 0x3,
+    0x0, 0x1f, 0xe0, 0x78, 0x0, 0x30, 0x7, 0x80, 0x33, 0x20, 0x78, 0x3,
+    0x33, 0x7, 0xc0, 0x33, 0x30, 0xec, 0x3, 0x33, 0xc, 0xe0, 0x33, 0x21,
+    0xc6, 0x0, 0x30, 0x1c, 0x70, 0x3, 0xf3, 0x83, 0x83, 0xff, 0x70, 0x3c,
+    0x7f, 0x8e, 0x1, 0xe2, 0x1, 0xc0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6B3E */
+    0x1, 0x80, 0x20, 0x0, 0x18, 0x6, 0x0, 0x1, 0x80, 0xe0, 0x7, 0xff,
+    0xce, 0x0, 0x7f, 0xfc, 0xc0, 0x0, 0x18, 0x1f, 0xfc, 0x1, 0x81, 0xff,
+    0xe0, 0x3c, 0x18, 0xe, 0x3f, 0xfb, 0x90, 0xe1, 0xff, 0x33, 0x8c, 0x0,
+    0x7, 0x39, 0xc1, 0xff, 0x23, 0x18, 0x3f, 0xf8, 0x31, 0x80, 0x0, 0x3,
+    0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x7f, 0xfe, 0x38, 0x7,
+    0xff, 0xc7, 0xc0, 0x1, 0x80, 0x6c, 0x1, 0x99, 0x86, 0x60, 0x39, 0x9c,
+    0xe6, 0x3, 0x18, 0xcc, 0x30, 0x71, 0x87, 0xc3, 0x86, 0x18, 0x38, 0x1c,
+    0x7, 0x87, 0x0, 0xe0, 0xf8, 0xe0, 0xe, 0x6, 0x8, 0x0, 0x0,
+
+    /* U+6B49 */
+    0x8, 0x10, 0x30, 0x0, 0xc3, 0x3, 0x0, 0xc, 0x30, 0x70, 0x0, 0xe7,
+    0x6, 0x0, 0x7f, 0xff, 0x60, 0x7, 0xff, 0xef, 0xfc, 0x6, 0x60, 0xff,
+    0xe0, 0x66, 0xc, 0xe, 0x3f, 0xfc, 0xd8, 0xe3, 0xff, 0xf9, 0x8c, 0x6,
+    0x67, 0x99, 0xc0, 0x66, 0x61, 0x98, 0x7f, 0xff, 0x99, 0x87, 0xff, 0xf9,
+    0x80, 0x6, 0x66, 0x18, 0x0, 0x66, 0x61, 0xc0, 0x3f, 0xfe, 0x3c, 0x3,
+    0xff, 0xc3, 0xc0, 0xe, 0x60, 0x36, 0x0, 0xe7, 0x3, 0x60, 0x1e, 0x7c,
+    0x63, 0x3, 0xe6, 0xe6, 0x38, 0x36, 0x66, 0xe1, 0x86, 0x66, 0x1c, 0x1c,
+    0x46, 0x63, 0x80, 0xe0, 0x66, 0x70, 0x6, 0x6, 0x60, 0x0, 0x0,
+
+    /* U+6B4C */
+    0x0, 0x0, 0x20, 0x7, 0xff, 0xe6, 0x0, 0x7f, 0xff, 0x60, 0x3, 0xff,
+    0xc6, 0x0, 0x0, 0x18, 0xe0, 0x3, 0xf9, 0x8f, 0xfc, 0x39, 0x98, 0xff,
+    0xe3, 0x9, 0x9c, 0xe, 0x31, 0x99, 0x98, 0xe3, 0xf9, 0xb9, 0x8c, 0x1f,
+    0xbb, 0x19, 0xc0, 0x7, 0xa1, 0x98, 0x0, 0x70, 0x19, 0x87, 0xff, 0xe1,
+    0x80, 0x7f, 0xff, 0x38, 0x0, 0x1, 0xc3, 0x80, 0x0, 0x18, 0x3c, 0x3,
+    0xf9, 0x83, 0xc0, 0x3f, 0x98, 0x3e, 0x3, 0x9, 0x87, 0x60, 0x30, 0x98,
+    0x67, 0x3, 0x19, 0x8e, 0x38, 0x3f, 0x98, 0xc3, 0x80, 0xe1, 0x9c, 0x1c,
+    0x0, 0x7b, 0x80, 0xe0, 0xf, 0xf0, 0xe, 0x0, 0x62, 0x0, 0x0,
+
+    /* U+6B50 */
+    0x0, 0x0, 0x40, 0x7, 0xff, 0x9c, 0x1, 0xff, 0xfb, 0x0, 0x3f, 0xfe,
+    0x60, 0x6, 0x0, 0xc, 0x0, 0xcf, 0xe3, 0xff, 0x1b, 0xfe, 0x7f, 0xf3,
+    0x60, 0xcc, 0xe, 0x6c, 0x1b, 0x31, 0xcd, 0xc7, 0x66, 0x31, 0xbf, 0xdc,
+    0xce, 0x31, 0xf3, 0x19, 0x86, 0x0, 0x3, 0x30, 0xde, 0x78, 0x60, 0x1b,
+    0xdf, 0xe, 0x3, 0x4b, 0x61, 0xc0, 0x69, 0x6c, 0x78, 0xd, 0x2d, 0x8f,
+    0x1, 0xa5, 0xb1, 0xb0, 0x37, 0xbe, 0x36, 0x6, 0xf3, 0xcc, 0x60, 0xc0,
+    0x1, 0x8e, 0x1c, 0x0, 0x70, 0xe3, 0xff, 0xfc, 0x1c, 0x3f, 0xff, 0x1,
+    0xc0, 0x1, 0xc0, 0x18, 0x0, 0x10, 0x0, 0x0,
+
+    /* U+6B61 */
+    0x0, 0x0, 0x0, 0x0, 0x42, 0x2, 0x0, 0x6, 0x30, 0x60, 0x7, 0xff,
+    0xe6, 0x0, 0x7f, 0xfe, 0x60, 0x0, 0xe7, 0xe, 0x0, 0x4, 0x20, 0xff,
+    0xc3, 0xe7, 0xcf, 0xfe, 0x7e, 0xfc, 0xc0, 0xe6, 0x3c, 0x79, 0x8e, 0x63,
+    0xcf, 0x98, 0xc3, 0xe7, 0xf9, 0x9c, 0x1c, 0x7b, 0x19, 0x81, 0x86, 0x1,
+    0x98, 0x1f, 0xfc, 0x38, 0x3, 0xff, 0xe3, 0x80, 0x78, 0xc0, 0x3c, 0x7,
+    0x8c, 0x3, 0xc0, 0x7f, 0xfe, 0x3c, 0x1, 0x8e, 0x3, 0xe0, 0x18, 0xc0,
+    0x76, 0x1, 0xff, 0xc6, 0x70, 0x1f, 0xfc, 0xe7, 0x81, 0x8c, 0xe, 0x38,
+    0x1c, 0xe1, 0xc1, 0xc1, 0xff, 0xf8, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0,
+    0x20, 0x2,
+
+    /* U+6B62 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
+    0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0, 0x7, 0x3, 0x80,
+    0x0, 0x70, 0x38, 0x0, 0x7, 0x3, 0x80, 0x0, 0x70, 0x38, 0x0, 0x7,
+    0x3, 0xff, 0xc0, 0x70, 0x3f, 0xfc, 0x7, 0x3, 0x80, 0x0, 0x70, 0x38,
+    0x0, 0x7, 0x3, 0x80, 0x0, 0x70, 0x38, 0x0, 0x7, 0x3, 0x80, 0x0,
+    0x70, 0x38, 0x0, 0x7, 0x3, 0x80, 0x0, 0x70, 0x38, 0x0, 0x7, 0x3,
+    0x80, 0x0, 0x70, 0x38, 0x0, 0x7, 0x3, 0x80, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+6B63 */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0x2, 0x3, 0x0, 0x0, 0x70, 0x30, 0x0, 0x7,
+    0x3, 0xff, 0x0, 0x70, 0x3f, 0xf8, 0x7, 0x3, 0xff, 0x0, 0x70, 0x30,
+    0x0, 0x7, 0x3, 0x0, 0x0, 0x70, 0x30, 0x0, 0x7, 0x3, 0x0, 0x0,
+    0x70, 0x30, 0x0, 0x7, 0x3, 0x0, 0x0, 0x70, 0x30, 0x0, 0x7, 0x3,
+    0x0, 0x0, 0x70, 0x30, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+6B66 */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xe, 0x0, 0x1f, 0xfc, 0xe7, 0x1, 0xff,
+    0xee, 0x38, 0x0, 0x0, 0xe1, 0x80, 0x0, 0xe, 0x8, 0x0, 0x0, 0xe0,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0,
+    0x60, 0x60, 0x0, 0x86, 0x6, 0x0, 0x1c, 0x60, 0x70, 0x1, 0xc6, 0x7,
+    0x0, 0x1c, 0x7f, 0x30, 0x1, 0xc7, 0xf3, 0x0, 0x1c, 0x60, 0x30, 0x1,
+    0xc6, 0x3, 0x80, 0x1c, 0x60, 0x38, 0x1, 0xc6, 0x1, 0xc6, 0x1c, 0x60,
+    0x1c, 0x61, 0xc6, 0xf8, 0xe6, 0x1d, 0xff, 0x8e, 0x63, 0xff, 0xc0, 0x7e,
+    0x7f, 0xc0, 0x3, 0xe7, 0x80, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+6B72 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3, 0x7, 0xff, 0x0, 0x30,
+    0x7f, 0xf8, 0x3, 0x7, 0x0, 0x0, 0x30, 0x60, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xe6, 0x0, 0x0, 0xe, 0x70, 0xf,
+    0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x38, 0x0, 0xe0, 0x3, 0x80, 0x6,
+    0x0, 0x3b, 0xff, 0x61, 0x83, 0x9f, 0xe6, 0x38, 0x38, 0x30, 0x67, 0x3,
+    0x9b, 0x7, 0x70, 0x33, 0x30, 0x3e, 0x3, 0x33, 0x33, 0xc0, 0x37, 0x3f,
+    0x3c, 0x23, 0x63, 0xe3, 0xc6, 0x74, 0x3c, 0xfc, 0x67, 0x7, 0x1e, 0xfe,
+    0x63, 0xe3, 0xc7, 0xe6, 0x78, 0x78, 0x3c, 0x2, 0x6, 0x0, 0x80,
+
+    /* U+6B77 */
+    0x7, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc1, 0x80,
+    0x80, 0x30, 0x19, 0xfc, 0x7f, 0x81, 0x9f, 0x7, 0xc0, 0x18, 0x30, 0xc,
+    0x1, 0x9f, 0xc7, 0xf8, 0x1b, 0xfe, 0xff, 0xe1, 0x8f, 0x3, 0xf0, 0x18,
+    0xf8, 0x3f, 0x1, 0x9f, 0xc7, 0xd8, 0x1b, 0xb6, 0xec, 0xc1, 0xb3, 0xc,
+    0xce, 0x38, 0x30, 0xc, 0x63, 0x82, 0x8, 0x0, 0x38, 0x1, 0xc0, 0x3,
+    0x86, 0x1c, 0x0, 0x30, 0x61, 0xff, 0x3, 0x6, 0x1f, 0xf8, 0x30, 0x61,
+    0xc0, 0x7, 0x6, 0x1c, 0x0, 0x70, 0x61, 0xc0, 0x6, 0xff, 0xff, 0xfe,
+    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+6B78 */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x7f, 0xe0, 0x1f, 0x87, 0xff, 0x83, 0xfc,
+    0x0, 0x38, 0x30, 0xe0, 0x1, 0x83, 0x7, 0xff, 0xfe, 0x30, 0xef, 0xff,
+    0xe3, 0xfc, 0x0, 0x18, 0x3f, 0x7, 0xff, 0x83, 0x0, 0x7f, 0xf8, 0x3f,
+    0xc0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x30, 0x6f, 0xff, 0xc3, 0x6, 0xff,
+    0xfe, 0x3f, 0xec, 0x30, 0x63, 0xfc, 0xc3, 0x6, 0x3, 0xf, 0xff, 0xc2,
+    0x30, 0x7f, 0xf8, 0x33, 0xc6, 0x31, 0x83, 0x3e, 0x63, 0x18, 0x33, 0x6,
+    0x31, 0x83, 0x30, 0x63, 0x18, 0x33, 0x6, 0x37, 0x83, 0x7f, 0x63, 0x78,
+    0x7f, 0xe2, 0x32, 0x7, 0x80, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0,
+
+    /* U+6B7B */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x38,
+    0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x30, 0xe, 0x0, 0x7, 0x0, 0xe0,
+    0x0, 0x70, 0xe, 0x0, 0x7, 0xf8, 0xe1, 0xc0, 0xff, 0xce, 0x7c, 0xc,
+    0x1c, 0xef, 0x1, 0xc1, 0xcf, 0xe0, 0x38, 0x18, 0xf0, 0x3, 0x81, 0x8e,
+    0x0, 0x77, 0x38, 0xe0, 0x6, 0x3f, 0xe, 0x0, 0x1, 0xf0, 0xe0, 0x0,
+    0xe, 0xe, 0x0, 0x0, 0xe0, 0xe0, 0x0, 0x1c, 0xe, 0x6, 0x3, 0x80,
+    0xe0, 0x60, 0xf0, 0xe, 0xe, 0x1e, 0x0, 0xff, 0xe7, 0xc0, 0x7, 0xfc,
+    0x70, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+6BB5 */
+    0x0, 0x60, 0x0, 0x0, 0x7f, 0x1f, 0x80, 0x1f, 0xe3, 0xfc, 0x1, 0xc0,
+    0x30, 0xe0, 0x18, 0x3, 0xe, 0x1, 0x80, 0x30, 0xe0, 0x18, 0x7, 0xe,
+    0x61, 0xfc, 0x70, 0xe6, 0x1f, 0xe6, 0xe, 0x61, 0x80, 0xe0, 0xfe, 0x18,
+    0x1c, 0x7, 0xc1, 0x81, 0x80, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0xff,
+    0xf8, 0x1f, 0xef, 0xff, 0xc1, 0xfc, 0x0, 0x38, 0x18, 0x3, 0x3, 0x81,
+    0x80, 0x38, 0x70, 0x18, 0x1, 0x8e, 0x1, 0x8e, 0x1d, 0xc0, 0x3f, 0xe0,
+    0xf8, 0x7, 0xfc, 0x7, 0x80, 0x78, 0x1, 0xfc, 0x1, 0x80, 0xfd, 0xf8,
+    0x18, 0x3f, 0x7, 0xe1, 0x87, 0xc0, 0x1e, 0x18, 0x20, 0x0, 0x0,
+
+    /* U+6BCD */
+    0x3, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0xe0,
+    0x0, 0x38, 0xc, 0x1c, 0x3, 0x80, 0xc1, 0xe0, 0x38, 0xc, 0x7, 0x83,
+    0x80, 0xc0, 0x3c, 0x38, 0xc, 0x0, 0x83, 0x81, 0xc0, 0x0, 0x38, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x1c, 0x0, 0x3, 0x1, 0xc1, 0x80,
+    0x30, 0x1c, 0x1e, 0x3, 0x1, 0xc0, 0xf8, 0x30, 0x1c, 0x3, 0xc3, 0x1,
+    0xc0, 0x1c, 0x30, 0x1c, 0x0, 0x3, 0x1, 0xff, 0xff, 0xfe, 0x1f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x7, 0xf0,
+    0x0, 0x0, 0xfe, 0x0, 0x0, 0x7, 0x80,
+
+    /* U+6BD2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x7f,
+    0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x60, 0x30, 0xc, 0x6, 0x3, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe1, 0xc0, 0xe0, 0x30, 0x1c, 0xc,
+    0x3, 0x1, 0xc0, 0xc0, 0x30, 0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x7c, 0x0,
+
+    /* U+6BD4 */
+    0x0, 0x0, 0x80, 0x0, 0xc0, 0x18, 0x0, 0xe, 0x1, 0x80, 0x0, 0xe0,
+    0x18, 0x0, 0xe, 0x1, 0x80, 0x0, 0xe0, 0x18, 0x0, 0xe, 0x1, 0x81,
+    0xc0, 0xe0, 0x18, 0x3c, 0xf, 0xf9, 0x8f, 0x80, 0xff, 0xd9, 0xe0, 0xf,
+    0xf9, 0xfc, 0x0, 0xe0, 0x1f, 0x0, 0xe, 0x1, 0xc0, 0x0, 0xe0, 0x18,
+    0x0, 0xe, 0x1, 0x80, 0x0, 0xe0, 0x18, 0x0, 0xe, 0x1, 0x80, 0x0,
+    0xe0, 0x18, 0x0, 0xe, 0x1, 0x80, 0x0, 0xe0, 0x18, 0x6, 0xe, 0x1d,
+    0x80, 0x60, 0xef, 0xd8, 0xe, 0xf, 0xf1, 0xc0, 0xe3, 0xf8, 0x1f, 0xfe,
+    0x7e, 0x1, 0xff, 0xc7, 0x0, 0x7, 0xf0,
+
+    /* U+6BDB */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x3f, 0xfe, 0x3, 0xff,
+    0xff, 0x0, 0x3f, 0xfc, 0x0, 0x1, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x1, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0x1, 0xff, 0xff, 0xf0, 0x3f,
+    0xfe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0x0, 0x1c, 0x1, 0xc0, 0x3, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xc7,
+    0xff, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c,
+    0x0, 0x60, 0x1, 0xc0, 0xe, 0x0, 0x1c, 0x0, 0xe0, 0x1, 0xf8, 0x7e,
+    0x0, 0xf, 0xff, 0xc0, 0x0, 0x7f, 0xf8,
+
+    /* U+6C11 */
+    0x3, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80, 0xc0,
+    0x0, 0x18, 0xc, 0x0, 0x1, 0x80, 0xc0, 0x0, 0x18, 0xc, 0x0, 0x3,
+    0x80, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x18, 0x0, 0xc,
+    0x1, 0x80, 0x0, 0xc0, 0x1c, 0x0, 0xc, 0x1, 0xc0, 0x0, 0xff, 0xff,
+    0xfe, 0xf, 0xff, 0xff, 0xc0, 0xc0, 0xc, 0x0, 0xc, 0x0, 0xe0, 0x0,
+    0xc0, 0x6, 0x0, 0xc, 0x0, 0x70, 0x0, 0xc0, 0x3, 0x6, 0xc, 0xf,
+    0x38, 0x60, 0xcf, 0xf1, 0xc6, 0x1f, 0xfc, 0xf, 0xe7, 0xfc, 0x0, 0x7e,
+    0x7c, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x8,
+
+    /* U+6C23 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xfc, 0x1e, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
+    0x7, 0x7f, 0xff, 0xe0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xfe, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x10, 0x7, 0x0, 0xe3, 0xc,
+    0x70, 0x6, 0x38, 0xc7, 0x0, 0x73, 0x98, 0x70, 0x2, 0x39, 0x87, 0x1,
+    0xff, 0xfe, 0x70, 0x3f, 0xff, 0xf7, 0x0, 0xf, 0x80, 0x70, 0x1, 0xfe,
+    0x7, 0x60, 0x3b, 0xf8, 0x36, 0xf, 0x39, 0xe3, 0x61, 0xe3, 0x8f, 0x3e,
+    0x38, 0x38, 0x33, 0xe0, 0x3, 0x0, 0x1e, 0x0, 0x10, 0x0, 0xc0,
+
+    /* U+6C27 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xfc, 0x1e, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x7, 0x7f, 0xff, 0xf0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0xe0, 0x3, 0x1, 0x87, 0x0, 0x38, 0x30,
+    0x70, 0x1, 0x87, 0x6, 0x1, 0xff, 0xff, 0x70, 0xf, 0xff, 0xe7, 0x0,
+    0x3, 0x80, 0x70, 0xf, 0xff, 0xc7, 0x0, 0x7f, 0xfc, 0x70, 0x0, 0x38,
+    0x7, 0x61, 0xff, 0xff, 0x36, 0x3f, 0xff, 0xfb, 0x60, 0x3, 0x80, 0x3e,
+    0x0, 0x38, 0x3, 0xe0, 0x3, 0x80, 0x1e, 0x0, 0x10, 0x0, 0xc0,
+
+    /* U+6C34 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x70, 0x1c, 0x7f, 0xc7, 0x3,
+    0xc7, 0xfc, 0x70, 0x78, 0x1, 0xc7, 0x8f, 0x0, 0xc, 0x79, 0xe0, 0x0,
+    0xc7, 0xf8, 0x0, 0xc, 0x6f, 0x0, 0x1, 0xc6, 0x60, 0x0, 0x1c, 0x66,
+    0x0, 0x1, 0x86, 0x70, 0x0, 0x38, 0x63, 0x80, 0x3, 0x6, 0x18, 0x0,
+    0x70, 0x61, 0xc0, 0xe, 0x6, 0xe, 0x1, 0xe0, 0x60, 0x70, 0x3c, 0x6,
+    0x7, 0x87, 0x80, 0x60, 0x3e, 0x70, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x6,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+6C38 */
+    0x0, 0x70, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
+    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0xf, 0xfe, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x6, 0x1, 0xc0, 0x0, 0x60, 0x38, 0x0,
+    0x7, 0x7, 0x7, 0xfc, 0x70, 0xe0, 0x7f, 0xc7, 0x9c, 0x0, 0x1c, 0x7f,
+    0x80, 0x0, 0xc6, 0xf0, 0x0, 0x1c, 0x66, 0x0, 0x1, 0x86, 0x70, 0x0,
+    0x38, 0x63, 0x80, 0x7, 0x6, 0x3c, 0x0, 0x60, 0x61, 0xe0, 0x1e, 0x6,
+    0xf, 0x3, 0xc0, 0x60, 0x7c, 0x78, 0x6, 0x1, 0xe7, 0x0, 0x60, 0xe,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C42 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x61, 0xc0, 0x0, 0x6, 0x1e, 0x0, 0x0,
+    0x60, 0x70, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1c,
+    0x6, 0x3, 0x80, 0xe0, 0x70, 0x70, 0x7, 0x7, 0x8f, 0x0, 0x30, 0x79,
+    0xe0, 0x1, 0x6, 0xf8, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x26, 0x60, 0x0,
+    0xf, 0x63, 0x0, 0x1, 0xe6, 0x38, 0x0, 0x7c, 0x61, 0xe0, 0x1f, 0x6,
+    0xf, 0x3, 0xe0, 0x60, 0x7c, 0x78, 0x6, 0x1, 0xe6, 0x0, 0x60, 0xe,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C5F */
+    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf1, 0xff, 0xfc, 0xf, 0x7f,
+    0xff, 0xc0, 0x67, 0xff, 0xf8, 0x0, 0x3, 0x80, 0x0, 0x0, 0x70, 0x0,
+    0x0, 0xe, 0x0, 0x40, 0x1, 0xc0, 0x1f, 0x0, 0x38, 0x1, 0xf0, 0x7,
+    0x0, 0xe, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x80, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0xe, 0x0, 0xc, 0x1, 0xc0, 0x3, 0x80, 0x38,
+    0x0, 0x70, 0x7, 0x0, 0xc, 0x0, 0xe0, 0x3, 0x80, 0x1c, 0x0, 0x70,
+    0x3, 0x80, 0x1c, 0x3f, 0xff, 0xe3, 0x9f, 0xff, 0xfe, 0x61, 0xff, 0xff,
+    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C76 */
+    0x0, 0x0, 0x80, 0x7, 0x0, 0x38, 0x0, 0xf0, 0x7, 0x0, 0xf, 0x0,
+    0xe0, 0x0, 0x40, 0x1c, 0x0, 0x1, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xf0,
+    0x0, 0x0, 0x70, 0x40, 0x0, 0xe, 0x1e, 0x3, 0x1, 0xc1, 0xe0, 0x60,
+    0x30, 0xc, 0xc, 0x6, 0x0, 0x1, 0xc0, 0xc0, 0x0, 0x38, 0x18, 0x0,
+    0x3, 0x7, 0x0, 0x0, 0x60, 0xc0, 0xc, 0xe, 0x38, 0x3, 0x80, 0xe6,
+    0x0, 0x60, 0x1f, 0xc0, 0x1c, 0x1, 0xf0, 0x3, 0x80, 0x1e, 0x0, 0x60,
+    0x7, 0xe0, 0x1c, 0x3, 0xdf, 0x3, 0x81, 0xf0, 0xf8, 0xe1, 0xf8, 0xf,
+    0xdc, 0x3c, 0x0, 0x78, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6C7A */
+    0x0, 0x1, 0x0, 0x7, 0x0, 0x60, 0x0, 0xf0, 0xc, 0x0, 0xf, 0x1,
+    0x80, 0x0, 0x40, 0x38, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0x80,
+    0x0, 0x18, 0x70, 0x40, 0x3, 0x6, 0x1e, 0x0, 0x60, 0xc1, 0xe0, 0xc,
+    0x18, 0xc, 0x1, 0x83, 0x0, 0x0, 0x30, 0x60, 0x7, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xf0, 0x0, 0x3c, 0x0, 0xc, 0x7, 0x80, 0x3, 0x80, 0xf8,
+    0x0, 0x70, 0x3b, 0x80, 0xc, 0x6, 0x30, 0x3, 0x81, 0xc7, 0x0, 0x70,
+    0x70, 0x78, 0x1c, 0x1c, 0x7, 0x83, 0x8f, 0x0, 0x7c, 0xe3, 0xc0, 0x7,
+    0xcc, 0xf0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C7D */
+    0x0, 0x8, 0x0, 0x1, 0xc1, 0xc0, 0x0, 0x1e, 0x38, 0x0, 0x0, 0xf3,
+    0xff, 0xfc, 0x2, 0x7f, 0xff, 0xc0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x1c, 0x0, 0x0, 0x21, 0xbf, 0xff, 0x7, 0x83, 0xff, 0xe0, 0x3c,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0xf, 0xff,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0xe0, 0x0, 0x60, 0xc, 0x0, 0x6, 0x1, 0xc0, 0x0, 0x60, 0x1c, 0x0,
+    0x6, 0x61, 0x80, 0x0, 0x66, 0x38, 0x0, 0x7, 0x63, 0x80, 0x0, 0x3e,
+    0x70, 0x0, 0x3, 0xe7, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+6C83 */
+    0x0, 0x0, 0x0, 0x7, 0x0, 0x3, 0xe0, 0xf0, 0x3f, 0xfc, 0xf, 0x7f,
+    0xfc, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0xc, 0x0, 0x40, 0x1, 0x80, 0x1e, 0x0, 0x70, 0x1, 0xe0, 0xe,
+    0x0, 0xc, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xf8, 0x0, 0x7, 0x0, 0x0,
+    0x0, 0xf0, 0x0, 0x0, 0x1e, 0x0, 0xc, 0x7, 0xe0, 0x3, 0x80, 0xcc,
+    0x0, 0x60, 0x39, 0xc0, 0x1c, 0x7, 0x18, 0x3, 0x81, 0xc3, 0xc0, 0x60,
+    0x70, 0x3c, 0x1c, 0x3c, 0x3, 0xc3, 0x8f, 0x0, 0x3c, 0xe3, 0xc0, 0x3,
+    0xdc, 0xe0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C88 */
+    0x0, 0x1, 0x0, 0x7, 0x0, 0x30, 0x0, 0xf0, 0xe, 0x0, 0xf, 0x1,
+    0xc0, 0x0, 0x40, 0x38, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xe0,
+    0x7, 0x1c, 0x1c, 0x40, 0xc3, 0x1, 0x9e, 0x18, 0x60, 0x31, 0xe3, 0xc,
+    0x6, 0xc, 0x61, 0xe0, 0xc0, 0x0, 0x3e, 0x0, 0x0, 0xf, 0xc0, 0x0,
+    0x1, 0xb8, 0x0, 0x0, 0x37, 0x0, 0xc, 0xe, 0xe0, 0x3, 0x81, 0xdc,
+    0x0, 0x70, 0x73, 0x80, 0xc, 0xe, 0x70, 0x3, 0x83, 0x8e, 0xc, 0x70,
+    0xe1, 0xc1, 0x9c, 0x3c, 0x38, 0x33, 0x8f, 0x7, 0x9e, 0xe3, 0xc0, 0x7f,
+    0xcc, 0x60, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C89 */
+    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf0, 0xff, 0xf8, 0xf, 0x3f,
+    0xff, 0x80, 0x6f, 0xff, 0xf8, 0x1, 0xc0, 0x7, 0x0, 0x38, 0x0, 0xe0,
+    0x7, 0x0, 0x1c, 0x40, 0xc0, 0x3, 0x9f, 0x0, 0xc6, 0x1, 0xe0, 0x38,
+    0xc0, 0xe, 0x7, 0x18, 0x0, 0x0, 0xe3, 0x0, 0x0, 0x1c, 0x60, 0x0,
+    0x3, 0x8c, 0x0, 0x0, 0x61, 0x80, 0xc, 0xc, 0x30, 0x3, 0x83, 0x86,
+    0x0, 0x70, 0x70, 0xc0, 0xc, 0xc, 0x18, 0x3, 0x83, 0x83, 0xc, 0x70,
+    0x70, 0x61, 0x9c, 0x1c, 0xc, 0x33, 0x87, 0x81, 0xce, 0x61, 0xe0, 0x3f,
+    0xcc, 0x38, 0x7, 0xf0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+6C96 */
+    0x0, 0x0, 0x80, 0xe, 0x0, 0x60, 0x3, 0xe0, 0x18, 0x0, 0x78, 0x6,
+    0x0, 0x6, 0x1, 0x80, 0x0, 0x0, 0x70, 0x0, 0xf, 0xff, 0xf8, 0x3,
+    0xff, 0xfe, 0x40, 0xc1, 0x81, 0xbc, 0x30, 0x60, 0x67, 0x8c, 0x18, 0x18,
+    0xf3, 0x6, 0x6, 0x0, 0xc1, 0x81, 0x80, 0x30, 0x60, 0x60, 0xc, 0x18,
+    0x18, 0x3, 0x6, 0x6, 0xc, 0xff, 0xff, 0x87, 0x3f, 0xff, 0xe1, 0xc1,
+    0xff, 0xc0, 0x60, 0x6, 0x0, 0x38, 0x1, 0x80, 0xe, 0x0, 0x60, 0x7,
+    0x0, 0x18, 0x1, 0xc0, 0x6, 0x0, 0xe0, 0x1, 0x80, 0x38, 0x0, 0x60,
+    0x0, 0x0, 0x8, 0x0,
+
+    /* U+6C99 */
+    0x0, 0x0, 0x80, 0x7, 0x0, 0x30, 0x0, 0xf0, 0x7, 0x0, 0xf, 0x0,
+    0xe0, 0x0, 0x40, 0x1c, 0x0, 0x0, 0x63, 0x8c, 0x0, 0x1c, 0x71, 0x80,
+    0x3, 0x8e, 0x38, 0x40, 0x61, 0xc3, 0x9e, 0x1c, 0x38, 0x31, 0xe3, 0x87,
+    0x7, 0xc, 0xe0, 0xe0, 0x60, 0x18, 0x1c, 0x0, 0x3, 0x3, 0x80, 0x0,
+    0x0, 0x70, 0xe0, 0x0, 0xe, 0x18, 0xc, 0x3, 0x87, 0x3, 0x83, 0xf1,
+    0xc0, 0x70, 0x7c, 0x70, 0x1c, 0x0, 0x1e, 0x3, 0x80, 0x7, 0x80, 0x60,
+    0x3, 0xc0, 0x1c, 0x1, 0xf0, 0x3, 0x83, 0xf8, 0x0, 0xe1, 0xfc, 0x0,
+    0xc, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C9B */
+    0x0, 0x0, 0x80, 0x7, 0x0, 0x38, 0x0, 0xf0, 0x7, 0x0, 0xf, 0x0,
+    0xe0, 0x0, 0x6f, 0xff, 0xfc, 0x3, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xe0,
+    0x0, 0xe, 0x0, 0x40, 0x1, 0xc0, 0x1f, 0x0, 0x38, 0x1, 0xe1, 0xff,
+    0xfc, 0xe, 0x3f, 0xff, 0xc0, 0xe, 0x1c, 0x38, 0x1, 0xc3, 0x83, 0x0,
+    0x38, 0x70, 0x60, 0x7, 0xe, 0xc, 0xc, 0xe1, 0xc1, 0x83, 0x9c, 0x38,
+    0x30, 0x73, 0x87, 0x6, 0xc, 0x70, 0xe0, 0xc3, 0x8e, 0x1c, 0x18, 0x71,
+    0xc3, 0x87, 0x1c, 0x38, 0x73, 0xe3, 0x83, 0xe, 0x78, 0x60, 0x1, 0xc0,
+    0xc, 0x0, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+6CB3 */
+    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf3, 0xff, 0xff, 0xf, 0x7f,
+    0xff, 0xe0, 0x40, 0x0, 0x70, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0x0, 0x38, 0x60, 0x7f, 0xc7, 0x1e, 0xf, 0xf8, 0xe1, 0xe1, 0x83,
+    0x1c, 0xc, 0x70, 0x63, 0x80, 0xe, 0xc, 0x70, 0x1, 0xc1, 0x8e, 0x0,
+    0x38, 0x31, 0xc0, 0x7, 0x6, 0x38, 0x1c, 0xe0, 0xc7, 0x3, 0x8f, 0xf8,
+    0xe0, 0x61, 0xff, 0x1c, 0x1c, 0x0, 0x3, 0x83, 0x80, 0x0, 0x70, 0xe0,
+    0x0, 0xe, 0x1c, 0x0, 0x1, 0xc3, 0x80, 0x0, 0x38, 0xe0, 0x0, 0x7f,
+    0x1c, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xe0, 0x0,
+
+    /* U+6CB9 */
+    0x0, 0x0, 0x80, 0xe, 0x0, 0x70, 0x3, 0xc0, 0x1c, 0x0, 0x78, 0x7,
+    0x0, 0x6, 0x1, 0xc0, 0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xf0, 0x3,
+    0xff, 0xfe, 0x40, 0xe1, 0xc1, 0xbe, 0x30, 0x70, 0x67, 0xcc, 0x1c, 0x18,
+    0x73, 0x7, 0x6, 0x0, 0xc1, 0xc1, 0x80, 0x30, 0x70, 0x60, 0xf, 0xff,
+    0xf8, 0x3, 0xff, 0xfe, 0xc, 0xff, 0xff, 0x87, 0x30, 0x70, 0x61, 0xcc,
+    0x1c, 0x18, 0x63, 0x7, 0x6, 0x38, 0xc1, 0xc1, 0x8e, 0x30, 0x70, 0x67,
+    0xc, 0x1c, 0x19, 0xc3, 0x87, 0xe, 0xe0, 0xff, 0xff, 0xb8, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0,
+
+    /* U+6CBB */
+    0x0, 0x3, 0x0, 0x7, 0x0, 0x60, 0x0, 0xf0, 0x1c, 0x0, 0xf, 0x3,
+    0x80, 0x0, 0x60, 0xe0, 0x80, 0x0, 0x1c, 0x18, 0x0, 0x3, 0x3, 0x80,
+    0x0, 0xe0, 0x38, 0x40, 0x18, 0x3, 0x1e, 0x7, 0x3f, 0xf1, 0xf7, 0xff,
+    0xff, 0xe, 0xff, 0xf0, 0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x3, 0xff, 0xf8, 0xc, 0x78, 0x7, 0x1, 0x8c, 0x0,
+    0x60, 0x71, 0x80, 0xc, 0xc, 0x30, 0x1, 0x83, 0x86, 0x0, 0x30, 0x70,
+    0xc0, 0x6, 0x1c, 0x18, 0x0, 0xc3, 0x83, 0x80, 0x18, 0xe0, 0x7f, 0xff,
+    0xc, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6CCC */
+    0x0, 0x4, 0x0, 0x7, 0x0, 0xe0, 0xc0, 0xf0, 0x1f, 0x38, 0xf, 0x1,
+    0xe7, 0x0, 0x40, 0xc, 0xe0, 0x0, 0x0, 0x18, 0x0, 0x3, 0x7, 0x0,
+    0x0, 0x70, 0xe0, 0x40, 0xe, 0x18, 0x1f, 0x19, 0xc3, 0x1, 0xe3, 0x38,
+    0xec, 0xc, 0x67, 0x19, 0x80, 0xc, 0xe7, 0x38, 0x1, 0x9c, 0xc7, 0x0,
+    0x33, 0xb8, 0x60, 0xe, 0x76, 0xe, 0x9, 0xcf, 0xc1, 0xc3, 0xb1, 0xf0,
+    0x18, 0x66, 0x3c, 0x3, 0x1c, 0xc7, 0x0, 0x3, 0x91, 0xe0, 0x60, 0x60,
+    0x7c, 0xc, 0x1c, 0x3f, 0x81, 0x83, 0x8f, 0x70, 0x70, 0xe3, 0xc7, 0xfe,
+    0x1c, 0x40, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6CD5 */
+    0x0, 0x1, 0x0, 0x7, 0x0, 0x30, 0x0, 0xf0, 0x6, 0x0, 0xf, 0x0,
+    0xc0, 0x0, 0x60, 0x18, 0x0, 0x1, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xe0,
+    0x0, 0x1c, 0x0, 0x40, 0x1, 0x80, 0x1f, 0x0, 0x30, 0x1, 0xf0, 0x6,
+    0x0, 0xe, 0x0, 0xc0, 0x0, 0x1f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xf0, 0x0, 0x70, 0x0, 0xc, 0xe, 0x0, 0x3, 0x81, 0x83,
+    0x0, 0x70, 0x70, 0x70, 0xc, 0xc, 0x7, 0x3, 0x83, 0x80, 0x70, 0x70,
+    0x60, 0xe, 0x1c, 0xc, 0x3f, 0xe3, 0x8f, 0xff, 0xfe, 0x63, 0xff, 0xc1,
+    0xcc, 0x38, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6CE2 */
+    0x0, 0x0, 0x40, 0x1, 0xc0, 0xe, 0x0, 0x1e, 0x0, 0xe0, 0x0, 0xf0,
+    0xe, 0x0, 0x2, 0x1f, 0xff, 0x80, 0x3, 0xff, 0xfc, 0x0, 0x70, 0xe1,
+    0xc0, 0x6, 0xe, 0xc, 0x20, 0x60, 0xe1, 0xc7, 0x86, 0xe, 0x18, 0x3c,
+    0x60, 0xe0, 0x0, 0xc7, 0xe, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x7, 0xff,
+    0xf8, 0x0, 0x60, 0x3, 0x80, 0x6, 0x20, 0x30, 0x4, 0x63, 0x7, 0x0,
+    0xc6, 0x38, 0x60, 0x1c, 0xe1, 0xce, 0x1, 0xce, 0xf, 0xc0, 0x18, 0xe0,
+    0xf8, 0x3, 0x8c, 0x7, 0x80, 0x39, 0xc1, 0xfe, 0x7, 0x18, 0x7c, 0xf8,
+    0x73, 0x9f, 0x7, 0xe6, 0x33, 0xe0, 0x1e, 0x0, 0x30, 0x0, 0x60,
+
+    /* U+6CE5 */
+    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf1, 0xff, 0xfe, 0xf, 0x3f,
+    0xff, 0xc0, 0x4e, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x0, 0x38, 0x0, 0x60,
+    0x7, 0x0, 0x1c, 0x40, 0xff, 0xff, 0x9e, 0x1f, 0xff, 0xe1, 0xe3, 0x80,
+    0x0, 0xc, 0x71, 0x80, 0x0, 0xe, 0x30, 0x0, 0x1, 0xc6, 0x2, 0x0,
+    0x30, 0xc3, 0xe0, 0x6, 0x1b, 0xf8, 0xc, 0xc3, 0xfc, 0x3, 0x98, 0x78,
+    0x0, 0x63, 0xc, 0x0, 0x1c, 0xe1, 0x80, 0x3, 0x9c, 0x30, 0xc, 0x63,
+    0x6, 0x1, 0x9c, 0xe0, 0xc0, 0x33, 0xb8, 0x1c, 0x1e, 0xe7, 0x3, 0xff,
+    0xdc, 0xc0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6CF0 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1e, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x1, 0x80, 0x0, 0x0, 0x38, 0x0,
+    0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x7, 0x6, 0x0, 0x0,
+    0xe0, 0x70, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x38, 0x1,
+    0xc0, 0x7, 0x6, 0xe, 0x0, 0xe0, 0x60, 0x78, 0x3d, 0x86, 0x1b, 0xc7,
+    0x9c, 0x67, 0x9e, 0x70, 0xe6, 0x70, 0xe0, 0x2, 0x64, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0xf, 0x6f, 0x0, 0x7, 0xe6, 0x7c, 0x1, 0xf8, 0x61, 0xf0,
+    0x3e, 0x1e, 0x7, 0x81, 0x3, 0xe0, 0x18, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+6D0B */
+    0x0, 0x0, 0x4, 0x7, 0x7, 0x1, 0xc0, 0xf0, 0x60, 0x30, 0xf, 0xe,
+    0xe, 0x0, 0x40, 0xc1, 0x80, 0x0, 0x0, 0x70, 0x0, 0x7f, 0xff, 0xf0,
+    0x7, 0xff, 0xfc, 0x40, 0x1, 0xc0, 0x1e, 0x0, 0x38, 0x1, 0xe0, 0x7,
+    0x0, 0xc, 0x0, 0xe0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0xff, 0xfe, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0xe, 0x0, 0xc, 0x1, 0xc0, 0x3, 0xbf, 0xff,
+    0xf8, 0x67, 0xff, 0xff, 0x1c, 0x7f, 0xff, 0xc3, 0x80, 0x1c, 0x0, 0x60,
+    0x3, 0x80, 0x1c, 0x0, 0x70, 0x3, 0x80, 0xe, 0x0, 0xe0, 0x1, 0xc0,
+    0x1c, 0x0, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+6D17 */
+    0x0, 0x0, 0x80, 0x7, 0x6, 0x38, 0x0, 0xf1, 0xc7, 0x0, 0xf, 0x30,
+    0xe0, 0x0, 0x46, 0x1c, 0x0, 0x1, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+    0x6, 0xe, 0x0, 0x41, 0xc1, 0xc0, 0x1e, 0x30, 0x38, 0x1, 0xe0, 0x7,
+    0x0, 0xc, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xfc, 0x7, 0xff, 0xff, 0x80,
+    0x7, 0x1c, 0x0, 0x0, 0x63, 0x80, 0xc, 0xc, 0x70, 0x3, 0x81, 0x8e,
+    0x0, 0x60, 0x71, 0xc0, 0xc, 0xc, 0x38, 0x3, 0x83, 0x87, 0x4, 0x60,
+    0x70, 0xe1, 0x9c, 0x3c, 0x1c, 0x33, 0x8f, 0x3, 0x8e, 0x67, 0xc0, 0x3f,
+    0xcc, 0xf0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D1B */
+    0x0, 0x8, 0x0, 0x7, 0x3, 0x80, 0x0, 0xf0, 0x60, 0x0, 0xf, 0x1f,
+    0xff, 0x0, 0x43, 0xff, 0xf0, 0x0, 0xf0, 0x1c, 0x0, 0x3f, 0x3, 0x80,
+    0xe, 0x60, 0xe0, 0x41, 0x86, 0x38, 0x1f, 0x60, 0xee, 0x1, 0xe0, 0xf,
+    0x80, 0xc, 0x1, 0xf0, 0x0, 0x1, 0xff, 0x80, 0x0, 0xfc, 0x7e, 0x0,
+    0x7e, 0x3, 0xf0, 0xf, 0x0, 0x1e, 0xd, 0x9f, 0xfc, 0x3, 0x8f, 0xff,
+    0xc0, 0x71, 0xc0, 0x18, 0x1c, 0x30, 0x3, 0x83, 0x86, 0x0, 0x70, 0x60,
+    0xc0, 0xe, 0x1c, 0x18, 0x1, 0xc3, 0x83, 0x80, 0x30, 0x60, 0x7f, 0xfe,
+    0xc, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D2A */
+    0x0, 0x8, 0x8, 0x7, 0x3, 0x3, 0x0, 0xf0, 0x60, 0x60, 0xf, 0xc,
+    0xc, 0x0, 0x41, 0x81, 0x80, 0x0, 0x30, 0x30, 0x0, 0x7f, 0xff, 0xe0,
+    0xf, 0xff, 0xfc, 0x40, 0x1c, 0x3c, 0x1e, 0x3, 0x3, 0x1, 0xe0, 0x60,
+    0x60, 0xc, 0xc, 0xc, 0x0, 0x1, 0x81, 0x80, 0x0, 0x30, 0x30, 0x0,
+    0x6, 0x6, 0x0, 0xf, 0xff, 0xfc, 0x19, 0xff, 0xff, 0xc3, 0x3f, 0xff,
+    0xf8, 0x60, 0x0, 0x0, 0x1c, 0x4, 0x8, 0x3, 0x81, 0x81, 0x80, 0xe0,
+    0x70, 0x38, 0x1c, 0x1c, 0x3, 0x83, 0x87, 0x0, 0x38, 0xe1, 0xc0, 0x3,
+    0x9c, 0x70, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D32 */
+    0x0, 0x0, 0x0, 0xc, 0xc, 0x30, 0x63, 0xc3, 0xe, 0x18, 0x70, 0xc3,
+    0x86, 0x0, 0x30, 0xe1, 0x80, 0xc, 0x38, 0x60, 0x3, 0xe, 0x18, 0x6,
+    0xd3, 0xa6, 0x41, 0xb6, 0xf9, 0xbc, 0x6d, 0xbb, 0x67, 0x9b, 0x6e, 0xd8,
+    0x46, 0xdb, 0xb6, 0x1, 0xb6, 0xed, 0x80, 0xcd, 0xbb, 0x60, 0x33, 0x3e,
+    0xd8, 0x2c, 0xcf, 0xb6, 0x1b, 0x32, 0xed, 0x86, 0x1c, 0x38, 0x63, 0x87,
+    0xe, 0x18, 0xe1, 0x83, 0x86, 0x30, 0xe0, 0xe1, 0x9c, 0x38, 0x38, 0x67,
+    0x1c, 0xe, 0x19, 0x8f, 0x3, 0x86, 0xe7, 0x80, 0xe1, 0xb1, 0xc0, 0x10,
+    0x60, 0x0, 0x0, 0x18,
+
+    /* U+6D3B */
+    0x0, 0x0, 0x2, 0x7, 0x0, 0x7, 0xe0, 0xf3, 0xff, 0xf8, 0xf, 0x7f,
+    0xf0, 0x0, 0x46, 0x18, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0xc, 0x0, 0x40, 0x3, 0xc0, 0x1f, 0x3f, 0xff, 0xf9, 0xe7, 0xff,
+    0xff, 0xc, 0x0, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x1, 0xff, 0xe0, 0xc, 0xff, 0xff, 0x3, 0x9c, 0x0,
+    0xe0, 0x73, 0x0, 0xc, 0xc, 0x60, 0x1, 0x83, 0x8c, 0x0, 0x30, 0x71,
+    0x80, 0x6, 0x1c, 0x30, 0x0, 0xc3, 0x87, 0x0, 0x38, 0x60, 0xff, 0xff,
+    0xc, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D3E */
+    0x0, 0x0, 0x2, 0x7, 0x0, 0xf, 0xe0, 0xf0, 0xff, 0xf8, 0xf, 0x7f,
+    0xf0, 0x0, 0x4f, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x3, 0xc0,
+    0x6, 0x3, 0xf0, 0x40, 0xc3, 0xf8, 0x1e, 0x18, 0xfe, 0x1, 0xe3, 0x1c,
+    0xc0, 0xc, 0x63, 0x18, 0x40, 0xc, 0x63, 0x1c, 0x1, 0x8c, 0x77, 0x0,
+    0x31, 0x86, 0xc0, 0x6, 0x30, 0xf8, 0xc, 0xc6, 0x1e, 0x3, 0xb8, 0xc3,
+    0x80, 0x77, 0x18, 0x70, 0xc, 0xe3, 0x6, 0x3, 0x98, 0x60, 0xe0, 0x67,
+    0xc, 0xce, 0x1c, 0xe1, 0xf9, 0xc3, 0xb8, 0x7e, 0x1c, 0x67, 0x3f, 0x3,
+    0xcc, 0xc7, 0x0, 0x38, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+6D41 */
+    0x0, 0x1, 0x80, 0x7, 0x0, 0x30, 0x0, 0xf0, 0x6, 0x0, 0xf, 0x7f,
+    0xff, 0xc0, 0x5f, 0xff, 0xfc, 0x1, 0xff, 0xff, 0x0, 0x3, 0x80, 0x0,
+    0x0, 0x70, 0xc0, 0x40, 0x1c, 0x1c, 0x1f, 0x3, 0x1, 0xc1, 0xe7, 0xff,
+    0xfe, 0xc, 0xff, 0xf9, 0xc0, 0x1c, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xc3, 0x0, 0x3, 0x18, 0x60, 0x8, 0x63, 0xc, 0x3, 0xc, 0x61,
+    0x80, 0x61, 0x8c, 0x30, 0x1c, 0x31, 0x86, 0x3, 0x8e, 0x30, 0xc4, 0x61,
+    0xc6, 0x19, 0x9c, 0x70, 0xc3, 0x33, 0x9e, 0x18, 0x76, 0x63, 0x83, 0xf,
+    0xdc, 0xe0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D69 */
+    0x0, 0x0, 0x80, 0x7, 0x2, 0x18, 0x0, 0xf0, 0xc3, 0x0, 0xf, 0x18,
+    0x60, 0x0, 0x47, 0x1c, 0x0, 0x0, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+    0x6, 0x6, 0x0, 0x41, 0xc0, 0xc0, 0x1f, 0x30, 0x18, 0x1, 0xe0, 0x3,
+    0x0, 0xc, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfc, 0x3, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x3f, 0xff, 0x3, 0x8f, 0xff,
+    0xe0, 0x61, 0xc0, 0xc, 0x1c, 0x30, 0x1, 0x83, 0x86, 0x0, 0x30, 0x60,
+    0xc0, 0x6, 0x1c, 0x18, 0x0, 0xc3, 0x83, 0x80, 0x18, 0xe0, 0x7f, 0xff,
+    0x1c, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D6A */
+    0x0, 0x1, 0x80, 0x7, 0x0, 0x30, 0x0, 0xf0, 0x6, 0x0, 0xf, 0x1,
+    0xe0, 0x0, 0x47, 0xff, 0xf0, 0x1, 0xff, 0xfe, 0x0, 0x30, 0x0, 0xc0,
+    0x6, 0x0, 0x18, 0x40, 0xff, 0xff, 0x1e, 0x1f, 0xff, 0xe1, 0xe3, 0x80,
+    0xc, 0xc, 0x60, 0x1, 0x80, 0xc, 0x0, 0x30, 0x1, 0xff, 0xfe, 0x0,
+    0x3f, 0xff, 0x80, 0x7, 0xc, 0x0, 0xc, 0xc1, 0x81, 0x83, 0x98, 0x38,
+    0xf0, 0x63, 0x3, 0x3c, 0x1c, 0x60, 0x7e, 0x3, 0x8c, 0x7, 0x0, 0x61,
+    0x86, 0x70, 0x1c, 0x33, 0xc7, 0x3, 0x87, 0xf0, 0x78, 0x63, 0xf8, 0x7,
+    0xcc, 0xf8, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D74 */
+    0x0, 0x0, 0x0, 0x7, 0x1, 0x86, 0x0, 0xf0, 0x70, 0x70, 0xf, 0x1c,
+    0xf, 0x0, 0x47, 0x0, 0xf0, 0x1, 0xc0, 0x7, 0x0, 0x70, 0x70, 0x70,
+    0x4, 0x1e, 0x0, 0x40, 0x3, 0xc0, 0x1e, 0x0, 0xfc, 0x1, 0xe0, 0x39,
+    0xc0, 0xc, 0xe, 0x1c, 0x0, 0x3, 0x81, 0xe0, 0x1, 0xe0, 0x1f, 0x0,
+    0x78, 0x1, 0xf0, 0xe, 0x0, 0xe, 0xd, 0xbf, 0xfe, 0x3, 0x87, 0xff,
+    0xc0, 0x61, 0xc0, 0x18, 0x1c, 0x38, 0x3, 0x3, 0x87, 0x0, 0x60, 0x60,
+    0xe0, 0xc, 0x1c, 0x1c, 0x1, 0x83, 0x83, 0x80, 0x70, 0xe0, 0x3f, 0xfe,
+    0x1c, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6D77 */
+    0x0, 0x18, 0x0, 0x1, 0x83, 0x80, 0x0, 0x1e, 0x38, 0x0, 0x0, 0xe7,
+    0xff, 0xfe, 0x2, 0x7f, 0xff, 0xc0, 0xe, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x1d, 0xff, 0xe0, 0x23, 0xbf, 0xff, 0x7, 0x93, 0x10, 0x38, 0x3c,
+    0x33, 0x83, 0x80, 0xc7, 0x1e, 0x38, 0x0, 0x70, 0xe3, 0x80, 0x7, 0x0,
+    0x38, 0x1, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xfe, 0xc, 0x60, 0x3, 0x0,
+    0xc6, 0x18, 0x30, 0xc, 0x61, 0xe3, 0x1, 0xc6, 0x6, 0x30, 0x1c, 0x60,
+    0x3, 0x3, 0x87, 0xff, 0xfe, 0x38, 0x3f, 0xff, 0xc3, 0x0, 0x0, 0x30,
+    0x70, 0x0, 0x1f, 0x6, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+6D88 */
+    0x0, 0x0, 0x80, 0xe, 0x0, 0x70, 0x3, 0xce, 0x1c, 0x18, 0x79, 0x87,
+    0xe, 0x6, 0x71, 0xc3, 0x0, 0xc, 0x71, 0xc0, 0x1, 0x1c, 0x20, 0x0,
+    0x7, 0x0, 0x40, 0x7f, 0xff, 0x3e, 0x1f, 0xff, 0xc7, 0xc7, 0x0, 0x38,
+    0x71, 0x80, 0xe, 0x0, 0x60, 0x3, 0x80, 0x1f, 0xff, 0xe0, 0x7, 0xff,
+    0xf8, 0x1, 0x80, 0xe, 0xc, 0x60, 0x3, 0x87, 0x18, 0x0, 0xe1, 0xc7,
+    0xff, 0xf8, 0x71, 0xff, 0xfe, 0x38, 0x60, 0x3, 0x8e, 0x18, 0x0, 0xe7,
+    0x6, 0x0, 0x39, 0xc1, 0x80, 0xe, 0x60, 0x60, 0x1f, 0x18, 0x18, 0xf,
+    0xc0, 0x6, 0x1, 0xc0,
+
+    /* U+6DAE */
+    0x0, 0x0, 0x0, 0x6, 0x1f, 0xf8, 0x18, 0xf7, 0xff, 0x83, 0x8e, 0xe0,
+    0x72, 0x70, 0x18, 0x6, 0xee, 0x3, 0x0, 0xdd, 0xc0, 0x70, 0x3b, 0xb8,
+    0xf, 0xff, 0x77, 0x61, 0xff, 0xce, 0xef, 0x30, 0x41, 0xdc, 0xe6, 0x18,
+    0x3b, 0x80, 0xc3, 0x7, 0x70, 0x19, 0xfc, 0xee, 0x3, 0x7f, 0xdd, 0xc0,
+    0x6d, 0xdb, 0xb8, 0x4d, 0xb3, 0x77, 0x19, 0xb6, 0x6e, 0xe3, 0x36, 0xcd,
+    0xdc, 0x6e, 0xd9, 0xbb, 0x8d, 0x9b, 0x37, 0x73, 0xb3, 0x66, 0x4e, 0x76,
+    0x6c, 0xc1, 0xcc, 0xcd, 0xb8, 0x3b, 0x99, 0xbf, 0x6, 0x77, 0x26, 0x3,
+    0xcc, 0x40, 0xc0, 0xf8, 0x0, 0x8, 0xc, 0x0,
+
+    /* U+6DB5 */
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xfc, 0x1e, 0xff, 0xff, 0xe0, 0xef,
+    0xff, 0xfe, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x1c, 0x7c, 0xc, 0x21, 0xc7, 0xe0, 0xe7, 0x9d, 0xe, 0x7e, 0x3d,
+    0xd8, 0x6e, 0xe0, 0x9d, 0xc7, 0xce, 0x1, 0xce, 0x68, 0xe0, 0x1c, 0xe,
+    0xe, 0x1, 0xc0, 0xe0, 0xe0, 0x1c, 0x3f, 0x8e, 0xd, 0xce, 0xfc, 0xe0,
+    0xdd, 0xee, 0xee, 0x1d, 0xfc, 0xc7, 0xe1, 0x9f, 0xc, 0x3e, 0x19, 0xc3,
+    0xc0, 0xe3, 0x9c, 0x7c, 0xe, 0x39, 0xc3, 0x80, 0xe7, 0x1e, 0x0, 0x1e,
+    0x70, 0xff, 0xff, 0xc6, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6DD1 */
+    0x0, 0x20, 0x0, 0x6, 0x6, 0x0, 0x0, 0xf0, 0xc1, 0xfc, 0xe, 0x18,
+    0x7f, 0xc0, 0x3, 0xf7, 0xfc, 0x0, 0x7c, 0x3, 0x80, 0xc, 0x18, 0x60,
+    0x1, 0x83, 0xc, 0x40, 0x30, 0x61, 0x9e, 0x6, 0xc, 0x31, 0xef, 0xfd,
+    0x86, 0x9, 0xff, 0xb9, 0x80, 0x3, 0x7, 0x30, 0x0, 0x60, 0x66, 0x0,
+    0x6d, 0x8c, 0xc0, 0xd, 0xb1, 0xb0, 0x19, 0xb3, 0x3e, 0x3, 0x26, 0x63,
+    0xc0, 0xec, 0xce, 0x70, 0x19, 0x98, 0xce, 0x3, 0x33, 0x19, 0xe0, 0xec,
+    0x60, 0x7e, 0x1c, 0x8c, 0x1d, 0xe3, 0x1, 0x8f, 0x1c, 0xe1, 0xf3, 0xc1,
+    0xd8, 0x3e, 0x70, 0x18, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6E05 */
+    0x0, 0x0, 0x80, 0x7, 0x0, 0x30, 0x0, 0xf3, 0xff, 0xfe, 0xf, 0x7f,
+    0xff, 0xc0, 0x40, 0x1c, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1f, 0xff, 0xc0,
+    0x3, 0xff, 0xf0, 0x40, 0x1, 0x80, 0x1e, 0x0, 0x38, 0x1, 0xe7, 0xff,
+    0xff, 0xc, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x1f, 0xff, 0x80, 0x3, 0x0, 0x38, 0xc, 0x7f, 0xff, 0x3, 0x8f, 0xff,
+    0xe0, 0x71, 0xc0, 0x1c, 0x1c, 0x30, 0x3, 0x83, 0x87, 0xff, 0xf0, 0x60,
+    0xff, 0xfe, 0x1c, 0x18, 0x1, 0xc3, 0x83, 0x0, 0x38, 0xe0, 0x60, 0x1f,
+    0xc, 0xc, 0x7, 0xc0, 0x1, 0x80, 0x70, 0x0,
+
+    /* U+6E1B */
+    0x0, 0x0, 0x20, 0x6, 0x0, 0xc, 0xe0, 0xf0, 0x1, 0xcc, 0xe, 0x0,
+    0x38, 0xc0, 0x3, 0xff, 0xf8, 0x1, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf0,
+    0xc, 0x3, 0x80, 0x41, 0x80, 0x30, 0x1e, 0x33, 0xe6, 0x1, 0xe6, 0xfe,
+    0xc6, 0x8, 0xc0, 0x18, 0xc0, 0x18, 0x3, 0x38, 0x3, 0x0, 0x67, 0x0,
+    0x67, 0xcc, 0xc0, 0x4d, 0xfd, 0xb8, 0x19, 0xb1, 0xbe, 0x3, 0x36, 0x33,
+    0xc0, 0xee, 0xc6, 0x70, 0x1d, 0xd8, 0xce, 0x3, 0x33, 0xf9, 0xcc, 0xe6,
+    0x3e, 0x79, 0x9d, 0xc0, 0x1f, 0xb3, 0x38, 0xf, 0x3e, 0xe6, 0x3, 0xc7,
+    0xd8, 0xc0, 0xe0, 0x78, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+6E21 */
+    0x0, 0x0, 0xc0, 0x7, 0x0, 0x18, 0x0, 0xf0, 0x7, 0x0, 0xf, 0x7f,
+    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x3, 0x80, 0x0, 0x0, 0x71, 0x83, 0x0,
+    0xe, 0x30, 0x60, 0x41, 0xff, 0xff, 0xdf, 0x3f, 0xff, 0xf1, 0xe7, 0x18,
+    0x30, 0xc, 0xe3, 0x6, 0x0, 0x1c, 0x71, 0xc0, 0x3, 0x8f, 0xf8, 0x0,
+    0x60, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x19, 0xbf, 0xff, 0x3, 0x37, 0xff,
+    0xe0, 0xe6, 0x0, 0x1c, 0x1d, 0xc3, 0x7, 0x3, 0x38, 0x71, 0xc0, 0xe6,
+    0x7, 0xf0, 0x1d, 0xc0, 0x7c, 0x7, 0x38, 0x7f, 0xe0, 0xee, 0x7f, 0x3f,
+    0xdd, 0xcf, 0x81, 0xf8, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+6E2C */
+    0x0, 0x0, 0x0, 0xc, 0x1f, 0x0, 0x63, 0xcf, 0xe0, 0x18, 0x77, 0x1c,
+    0xc6, 0x1, 0x83, 0x31, 0x80, 0x60, 0xcc, 0x60, 0x18, 0x73, 0x18, 0x7,
+    0xfc, 0xc6, 0x41, 0xff, 0x31, 0xbc, 0x60, 0xcc, 0x67, 0x98, 0x33, 0x18,
+    0x46, 0xc, 0xc6, 0x1, 0xff, 0x31, 0x80, 0x7f, 0xcc, 0x60, 0x18, 0x73,
+    0x18, 0x6, 0xc, 0xc6, 0x19, 0x83, 0x31, 0x86, 0x71, 0xcc, 0x63, 0x9f,
+    0xf3, 0x18, 0xe3, 0xf8, 0xc6, 0x30, 0x0, 0x31, 0x9c, 0x31, 0x80, 0x67,
+    0x1c, 0x70, 0x19, 0x8e, 0xe, 0x6, 0xe3, 0x3, 0x8f, 0xb8, 0xc0, 0x3,
+    0xe0, 0x0, 0x0, 0xe0,
+
+    /* U+6E2F */
+    0x0, 0x18, 0x30, 0x6, 0x3, 0x6, 0x0, 0xf0, 0x60, 0xc0, 0xe, 0xff,
+    0xff, 0x80, 0x1f, 0xff, 0xf8, 0x0, 0x70, 0x70, 0x0, 0x6, 0xc, 0x0,
+    0x0, 0xc1, 0x80, 0x40, 0x38, 0x38, 0x1e, 0xff, 0xff, 0xf9, 0xef, 0xff,
+    0xff, 0x8, 0x1c, 0x1c, 0x0, 0x7, 0x1, 0xc0, 0x1, 0xe0, 0x3c, 0x0,
+    0x7f, 0xff, 0xe0, 0x5f, 0xff, 0xfe, 0x1f, 0xe0, 0x19, 0xc3, 0xc, 0x3,
+    0x0, 0xe1, 0xff, 0xe0, 0x18, 0x3f, 0xfc, 0x3, 0x6, 0x0, 0x0, 0xe0,
+    0xc0, 0x3, 0x1c, 0x18, 0x0, 0xe7, 0x3, 0x0, 0x1c, 0xe0, 0x7f, 0xff,
+    0x98, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6E34 */
+    0x0, 0x0, 0x0, 0xe, 0xf, 0xff, 0x83, 0xc3, 0xff, 0xf0, 0x79, 0xc0,
+    0xc, 0x6, 0x70, 0x3, 0x0, 0x1f, 0xff, 0xc0, 0x7, 0xff, 0xf0, 0x1,
+    0xc0, 0xc, 0x60, 0x70, 0x3, 0x3e, 0x1f, 0xff, 0xc7, 0xc3, 0xff, 0xf0,
+    0x70, 0x7f, 0xf0, 0x0, 0x1c, 0x0, 0x0, 0x7, 0xff, 0x80, 0x3, 0xff,
+    0xf8, 0x3, 0xc3, 0xf, 0xd, 0xe0, 0xc1, 0xc3, 0xf8, 0x60, 0x71, 0xf6,
+    0x3c, 0x1c, 0x71, 0x8f, 0xc6, 0x38, 0x66, 0x39, 0x8e, 0x19, 0x6, 0x67,
+    0x7, 0x0, 0x19, 0xc0, 0xff, 0xc6, 0x60, 0x1f, 0xf3, 0x98, 0x0, 0x3,
+    0xe0, 0x0, 0x0, 0xe0,
+
+    /* U+6E38 */
+    0x0, 0x20, 0x20, 0x6, 0xe, 0xc, 0x0, 0xf1, 0xc1, 0x80, 0xe, 0x38,
+    0x70, 0x0, 0x7, 0xf, 0xfc, 0x7, 0xfd, 0xff, 0x80, 0xff, 0xf0, 0x0,
+    0x6, 0xc, 0x0, 0x40, 0xc3, 0x0, 0x1e, 0x18, 0x6f, 0xf1, 0xe3, 0x3,
+    0xfe, 0x8, 0x7e, 0x1, 0xc0, 0xf, 0xc0, 0x70, 0x1, 0x9c, 0x1c, 0x0,
+    0x33, 0x83, 0x0, 0x4e, 0x60, 0x60, 0x19, 0xcc, 0xc, 0x3, 0x31, 0xbf,
+    0xf8, 0xe6, 0x37, 0xff, 0x1c, 0xc6, 0xe, 0x3, 0x38, 0xc1, 0xc0, 0xe6,
+    0x18, 0x38, 0x1d, 0xc3, 0x7, 0x3, 0x30, 0xe0, 0xe0, 0xee, 0x7c, 0x78,
+    0x19, 0x9f, 0x1f, 0x0, 0x1, 0x81, 0x80, 0x0,
+
+    /* U+6E56 */
+    0x0, 0x20, 0x0, 0xc, 0x1c, 0xf, 0xc3, 0xc7, 0x7, 0xf8, 0x71, 0xc1,
+    0xce, 0x0, 0x70, 0x61, 0x80, 0x1c, 0x18, 0x60, 0x7f, 0xf6, 0x18, 0x1f,
+    0xfd, 0x86, 0x40, 0x70, 0x7f, 0xbc, 0x1c, 0x1f, 0xe7, 0x87, 0x6, 0x18,
+    0x41, 0xc1, 0x86, 0x0, 0xf8, 0x61, 0x80, 0x7f, 0x98, 0x60, 0x3f, 0xe6,
+    0x38, 0x2e, 0x19, 0xfe, 0x1b, 0x86, 0x7f, 0x86, 0xe1, 0xb8, 0x63, 0xb8,
+    0x6c, 0x18, 0xee, 0x1b, 0x6, 0x33, 0x8e, 0xc1, 0x9c, 0xff, 0xf0, 0x67,
+    0x1f, 0xfc, 0x1b, 0x80, 0xe, 0x6, 0xe0, 0x7, 0xf, 0xb8, 0x1, 0x83,
+    0xe0, 0x0, 0x40, 0xe0,
+
+    /* U+6E6F */
+    0x0, 0x0, 0x0, 0x7, 0x3, 0xff, 0x80, 0xf1, 0xff, 0xfc, 0xf, 0x30,
+    0x3, 0x80, 0x46, 0x0, 0x30, 0x0, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xc0,
+    0x3, 0x0, 0x18, 0x40, 0x60, 0x7, 0x1e, 0xf, 0xff, 0xe1, 0xe0, 0x7f,
+    0xf0, 0xc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x7, 0xff, 0xff, 0x80,
+    0xe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0xc, 0x7f, 0xff, 0x83, 0x9f, 0xff,
+    0xf0, 0x77, 0x18, 0xe6, 0xd, 0xc7, 0x18, 0xc3, 0xa1, 0xc7, 0x18, 0x70,
+    0xf1, 0xc7, 0x1c, 0x78, 0x70, 0xe3, 0x84, 0x3c, 0x1c, 0xe0, 0x3f, 0x7,
+    0xc, 0xf, 0x87, 0xe0, 0x1, 0x80, 0x78, 0x0,
+
+    /* U+6E90 */
+    0x0, 0x0, 0x0, 0xe, 0x3, 0xff, 0xf0, 0xf3, 0xff, 0xff, 0xe, 0x7f,
+    0xff, 0xe0, 0x1c, 0x6, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x70, 0xff, 0x0,
+    0xe, 0x7f, 0xfc, 0x41, 0xdc, 0x3, 0x9e, 0x33, 0x0, 0x31, 0xe6, 0x60,
+    0x6, 0x8, 0xcf, 0xff, 0xc0, 0x19, 0xff, 0xf8, 0x3, 0x30, 0x3, 0x0,
+    0x66, 0x0, 0x60, 0xc, 0xe0, 0x1c, 0x19, 0x8f, 0xff, 0x83, 0x30, 0xff,
+    0xc0, 0xe6, 0x1, 0x80, 0x1d, 0xc6, 0x33, 0x3, 0x31, 0xc6, 0x70, 0xe6,
+    0x30, 0xc7, 0x1d, 0xce, 0x18, 0xe3, 0x3b, 0x83, 0xe, 0xee, 0x60, 0xe0,
+    0xd8, 0x80, 0x78, 0x0, 0x0, 0xe, 0x0, 0x0,
+
+    /* U+6E96 */
+    0x0, 0x8, 0x8, 0x0, 0xe1, 0xc1, 0x80, 0x7, 0x38, 0x30, 0x0, 0x33,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe6, 0xf, 0x83, 0x0, 0x79, 0xf0, 0x30,
+    0x3, 0x9b, 0xff, 0xfc, 0x8, 0x3f, 0xff, 0xc0, 0x3, 0x3, 0x0, 0x3,
+    0x38, 0x30, 0x0, 0x73, 0xff, 0xfc, 0xe, 0x3f, 0xff, 0x81, 0xe3, 0x3,
+    0x0, 0x1c, 0x38, 0x30, 0x3, 0x83, 0xff, 0xfe, 0x30, 0x1f, 0xff, 0xe0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6EAA */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0xe3, 0xff, 0xfe, 0x1e, 0x7f,
+    0xff, 0x1, 0xe0, 0x0, 0x30, 0x9, 0x83, 0x6, 0x0, 0x38, 0x71, 0xc0,
+    0x3, 0x6, 0x30, 0x0, 0x26, 0x42, 0x8, 0x1, 0xc2, 0x3, 0xc1, 0xf0,
+    0xc0, 0x3c, 0x1e, 0x38, 0x1, 0x81, 0xee, 0x0, 0x0, 0xf, 0x8e, 0x0,
+    0x0, 0xe1, 0xc0, 0xf, 0xff, 0xfc, 0x1, 0xff, 0xe1, 0x81, 0x80, 0x30,
+    0x10, 0x70, 0x6, 0x0, 0xc, 0xff, 0xff, 0xc3, 0x9f, 0xff, 0xfc, 0x70,
+    0xf, 0x80, 0xc, 0x1, 0xf8, 0x3, 0x80, 0x73, 0x80, 0x70, 0x3c, 0x3e,
+    0x1c, 0x3f, 0x3, 0xf3, 0x9f, 0x80, 0x1f, 0x1, 0x80, 0x0, 0x60,
+
+    /* U+6EAB */
+    0x0, 0x0, 0x0, 0x7, 0x7, 0xff, 0x80, 0xf1, 0xff, 0xf8, 0xf, 0x38,
+    0x7, 0x0, 0x46, 0x18, 0x60, 0x0, 0xc7, 0xc, 0x0, 0x19, 0xe1, 0x80,
+    0x3, 0x3f, 0x30, 0x40, 0x6e, 0x76, 0x1e, 0xd, 0x86, 0xc1, 0xe1, 0xc0,
+    0x38, 0xc, 0x3f, 0xff, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0xc, 0xff, 0xff, 0x3, 0xb9, 0xcc,
+    0x70, 0x67, 0x39, 0x8e, 0x1c, 0xe7, 0x31, 0xc3, 0x9c, 0xe6, 0x38, 0x63,
+    0x9c, 0xc7, 0x1c, 0x73, 0x98, 0xe3, 0x8e, 0x73, 0x9c, 0xe7, 0xff, 0xff,
+    0xdc, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6ED4 */
+    0x0, 0x0, 0x3, 0xe, 0x0, 0xff, 0xe3, 0xc7, 0xff, 0xe0, 0x7b, 0xfe,
+    0x0, 0x4, 0x0, 0x1, 0x80, 0x10, 0x60, 0xe0, 0x6, 0x1c, 0x30, 0x1,
+    0xc3, 0xc, 0x40, 0x30, 0xe7, 0x3c, 0xc, 0x10, 0x7, 0x81, 0x20, 0x0,
+    0x60, 0x7d, 0xfc, 0x0, 0x7e, 0x7f, 0x80, 0x3c, 0x0, 0xe0, 0xc, 0x0,
+    0x18, 0x3, 0x0, 0x6, 0xc, 0xc0, 0x1, 0x87, 0x3f, 0x8f, 0xe1, 0x8f,
+    0xf7, 0xf8, 0xe3, 0xf8, 0xfe, 0x38, 0xc0, 0x1, 0x8c, 0x30, 0x0, 0x67,
+    0xc, 0x0, 0x19, 0xc3, 0x80, 0xe, 0xe0, 0xff, 0xff, 0xb8, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0,
+
+    /* U+6EFE */
+    0x0, 0x1, 0x80, 0x7, 0x0, 0x38, 0x0, 0xf0, 0x7, 0x0, 0xf, 0x7f,
+    0xff, 0xe0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x20, 0x0, 0xf, 0xf, 0x0,
+    0x7, 0xc0, 0xfc, 0x43, 0xe0, 0x7, 0xdf, 0x7f, 0xff, 0xd9, 0xe1, 0xff,
+    0xfc, 0xc, 0x30, 0x3, 0x80, 0x6, 0x0, 0x30, 0x0, 0xc0, 0x6, 0x0,
+    0x1c, 0x1, 0xc0, 0x3, 0xff, 0xf8, 0xc, 0x1f, 0xfc, 0x3, 0x80, 0xec,
+    0x30, 0x60, 0x79, 0x8e, 0x1c, 0x3e, 0x1b, 0x83, 0x9f, 0xc3, 0xc0, 0x67,
+    0xb8, 0x30, 0x1c, 0xc7, 0x3, 0x83, 0x80, 0xff, 0x38, 0xe0, 0x3f, 0xc3,
+    0xdc, 0xf, 0xc0, 0x38, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+6EFF */
+    0x0, 0x10, 0x8, 0xe, 0x3, 0x3, 0x81, 0xf0, 0x60, 0x70, 0x1e, 0xff,
+    0xff, 0xe0, 0xdf, 0xff, 0xfc, 0x0, 0x70, 0x38, 0x0, 0x6, 0x7, 0x0,
+    0x0, 0xc0, 0xe0, 0x40, 0x1f, 0xf8, 0x1e, 0x1, 0xff, 0x1, 0xe0, 0x6,
+    0x0, 0x1c, 0x0, 0xc0, 0x0, 0x1f, 0xff, 0xf8, 0x3, 0xff, 0xff, 0x0,
+    0x60, 0x60, 0x60, 0xc, 0x8d, 0x8c, 0x1d, 0xb9, 0xb9, 0x83, 0xb3, 0x33,
+    0x30, 0x66, 0x76, 0x76, 0x1c, 0xce, 0xde, 0xc3, 0x9b, 0xdb, 0xd8, 0xe3,
+    0xcf, 0xcf, 0x1c, 0x79, 0xf9, 0x63, 0xc, 0xc, 0xc, 0xe1, 0x81, 0x87,
+    0x9c, 0x30, 0x31, 0xf0, 0x6, 0x0, 0x3c, 0x0,
+
+    /* U+6F01 */
+    0x0, 0x8, 0x0, 0x7, 0x3, 0x0, 0x0, 0xf0, 0xff, 0xe0, 0xf, 0x3f,
+    0xfe, 0x0, 0x4e, 0x3, 0x80, 0x3, 0x80, 0x60, 0x0, 0xf0, 0x3c, 0x0,
+    0x3f, 0xff, 0xf8, 0x46, 0x7f, 0xff, 0x1e, 0x1c, 0x30, 0x71, 0xe3, 0x6,
+    0xe, 0xc, 0x60, 0xc1, 0xc0, 0xf, 0xff, 0xf8, 0x1, 0xff, 0xff, 0x0,
+    0x38, 0x70, 0xe0, 0x6, 0xc, 0x1c, 0xc, 0xc1, 0x83, 0x83, 0x9c, 0x30,
+    0x70, 0x63, 0xff, 0xfc, 0x1c, 0x3f, 0xff, 0x83, 0x80, 0x0, 0x0, 0x63,
+    0x10, 0xc6, 0x1c, 0x63, 0x18, 0xe3, 0x9c, 0x63, 0x8e, 0xe3, 0xe, 0x31,
+    0xdc, 0xe0, 0xc6, 0x18, 0x8, 0x0, 0x1, 0x0,
+
+    /* U+6F06 */
+    0x0, 0x1, 0x0, 0x7, 0x0, 0x30, 0x0, 0xf0, 0x6, 0x0, 0xf, 0xff,
+    0xff, 0xc0, 0x5f, 0xff, 0xf8, 0x0, 0xf, 0x80, 0x0, 0x3, 0xf8, 0x0,
+    0x0, 0xfd, 0xc0, 0x40, 0x79, 0x9e, 0x1e, 0x3e, 0x31, 0xf1, 0xef, 0x6,
+    0xf, 0xd, 0x81, 0xc0, 0x60, 0x0, 0xfe, 0x0, 0x0, 0x38, 0xf0, 0x0,
+    0x1e, 0x7, 0x80, 0xf, 0x9c, 0x7e, 0xf, 0xc3, 0x83, 0xc3, 0xac, 0x71,
+    0x98, 0x61, 0xce, 0x70, 0x1c, 0x19, 0xcc, 0x3, 0x80, 0x38, 0x0, 0x60,
+    0x37, 0x70, 0x1c, 0x3e, 0xef, 0x83, 0x9f, 0x9c, 0x7c, 0xe3, 0xc7, 0x83,
+    0x9c, 0x1, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+6F14 */
+    0x0, 0x1, 0x80, 0xe, 0x0, 0x30, 0x0, 0xf0, 0x6, 0x0, 0xe, 0xff,
+    0xff, 0xc0, 0x1f, 0xff, 0xf8, 0x3, 0x0, 0x3, 0x80, 0x60, 0x0, 0x70,
+    0xd, 0xff, 0xfe, 0x41, 0xbf, 0xfc, 0xdf, 0x0, 0x30, 0x1, 0xe0, 0x6,
+    0x0, 0xc, 0x3f, 0xff, 0x80, 0xf, 0xff, 0xf0, 0x1, 0x83, 0x6, 0x0,
+    0x30, 0x60, 0xc0, 0x7, 0xff, 0xf8, 0xc, 0xff, 0xff, 0x3, 0x98, 0x30,
+    0x60, 0x63, 0x6, 0xc, 0x1c, 0x70, 0xc3, 0x83, 0x8f, 0xff, 0xf0, 0x60,
+    0x7f, 0xf8, 0x1c, 0x6, 0x6, 0x3, 0x83, 0xc0, 0xf0, 0xe3, 0xf0, 0xf,
+    0xdc, 0xf8, 0x0, 0xf8, 0x1c, 0x0, 0x3, 0x0,
+
+    /* U+6F22 */
+    0x0, 0x8, 0x8, 0x3, 0x80, 0xc1, 0x80, 0x3c, 0x1c, 0x1c, 0x1, 0xef,
+    0xff, 0xfc, 0x4, 0xff, 0xff, 0x80, 0x0, 0xc1, 0x80, 0x0, 0xf, 0xf8,
+    0x0, 0x0, 0xff, 0x80, 0x20, 0x1, 0xc0, 0x7, 0x83, 0xff, 0xe0, 0x3c,
+    0xff, 0xff, 0x80, 0xce, 0x1c, 0x38, 0x0, 0xc1, 0xc1, 0x80, 0xf, 0xff,
+    0xf8, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x1c, 0x0, 0xc, 0xff, 0xff, 0x80,
+    0xcf, 0xff, 0xfc, 0x1c, 0x1, 0xc0, 0x1, 0xc0, 0x1c, 0x0, 0x19, 0xff,
+    0xff, 0xe3, 0x8f, 0xff, 0xfc, 0x38, 0x7, 0x70, 0x3, 0x0, 0xe3, 0xc0,
+    0x71, 0xfc, 0x1f, 0xc6, 0x3f, 0x0, 0x3e, 0x3, 0x80, 0x0, 0xe0,
+
+    /* U+6F3F */
+    0x0, 0x80, 0xc0, 0x3, 0x1c, 0x3c, 0x0, 0x31, 0xc7, 0xff, 0xc3, 0x1d,
+    0xff, 0xfc, 0x39, 0xf8, 0xc3, 0x83, 0xfc, 0xc7, 0xe0, 0x1f, 0xc7, 0xf8,
+    0x0, 0x1d, 0xfc, 0x20, 0x1, 0xfe, 0x7, 0x7, 0xfc, 0x0, 0x70, 0x7f,
+    0xdf, 0xff, 0xe1, 0x9c, 0x20, 0x70, 0x19, 0xc3, 0x7, 0x3, 0x1c, 0x38,
+    0x70, 0x71, 0xc0, 0x3e, 0x6, 0x8, 0x63, 0xe0, 0x0, 0x6, 0x1, 0x83,
+    0xfc, 0x70, 0x38, 0x7f, 0xe7, 0x8f, 0x0, 0xe, 0x7d, 0xe0, 0x1, 0xc6,
+    0xf8, 0x0, 0x38, 0x67, 0x80, 0xf, 0x6, 0x3f, 0x3, 0xe0, 0x60, 0xfc,
+    0x78, 0x1e, 0x3, 0xe7, 0x7, 0xe0, 0xe, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+6F51 */
+    0x0, 0x0, 0x0, 0x7, 0x1f, 0xf8, 0x80, 0xf3, 0xff, 0x30, 0xf, 0x1,
+    0xee, 0x0, 0x66, 0x3f, 0x98, 0x0, 0xfc, 0x67, 0x0, 0xf, 0x7, 0xc0,
+    0x1, 0xc0, 0x70, 0x40, 0xe0, 0x7, 0xde, 0x3f, 0xf, 0xf9, 0xf7, 0xf3,
+    0xf8, 0xe, 0x7, 0x77, 0x0, 0x0, 0xec, 0x64, 0x0, 0x1d, 0x8d, 0x80,
+    0x3f, 0x71, 0xf0, 0x7, 0x8c, 0x3c, 0xc, 0xc0, 0x0, 0x1, 0x98, 0x1f,
+    0xe0, 0x73, 0xf3, 0xfe, 0xe, 0x7f, 0x1, 0x83, 0x80, 0xec, 0x70, 0x70,
+    0x1d, 0xfc, 0x1c, 0x3, 0xf, 0x83, 0x80, 0x63, 0xf8, 0x60, 0x1d, 0xf3,
+    0x8c, 0x1f, 0xf8, 0x38, 0x3, 0xc4, 0x0, 0x0,
+
+    /* U+6F54 */
+    0x0, 0x18, 0x0, 0x7, 0x3, 0x0, 0x0, 0xf7, 0xfd, 0xfe, 0xe, 0x7f,
+    0xbf, 0xe0, 0x1, 0x81, 0x8c, 0x1, 0xfc, 0x31, 0x80, 0x3f, 0xc6, 0x30,
+    0x0, 0xc1, 0xc6, 0x40, 0x1b, 0x31, 0xde, 0x3f, 0xee, 0x31, 0xe7, 0xe1,
+    0x8e, 0xc, 0xc, 0x37, 0xc0, 0x1, 0xb0, 0x60, 0x0, 0xc, 0x20, 0x0,
+    0x1b, 0x8c, 0x0, 0x43, 0xe3, 0x80, 0x18, 0x1e, 0xe4, 0x3, 0x0, 0xf8,
+    0xe0, 0xe0, 0x1c, 0x1e, 0x1c, 0xff, 0xff, 0xe3, 0x3f, 0xfe, 0xc, 0xe0,
+    0x3, 0x0, 0x1c, 0xc, 0x67, 0x3, 0x7, 0x8c, 0x78, 0xe1, 0xe1, 0x87,
+    0xdc, 0x70, 0x30, 0x38, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6F62 */
+    0x0, 0xc, 0xc, 0x7, 0x1, 0x81, 0x80, 0xf8, 0x30, 0x30, 0xf, 0x7f,
+    0xff, 0xc0, 0x67, 0xff, 0xf8, 0x0, 0x18, 0x18, 0x0, 0x3, 0x7, 0x0,
+    0x0, 0x7f, 0xe0, 0x40, 0x7, 0xf8, 0x1f, 0x0, 0x0, 0x1, 0xf3, 0xff,
+    0xff, 0xe, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0xf, 0xff, 0xc0, 0x3, 0x86, 0x1c, 0xc, 0x71, 0xc3, 0x81, 0x8f, 0xff,
+    0xf0, 0x71, 0xc7, 0xe, 0xe, 0x38, 0x61, 0xc3, 0x83, 0xff, 0xf0, 0x70,
+    0x7f, 0xfe, 0x1c, 0x1, 0x4, 0x3, 0x80, 0xf0, 0xf0, 0x60, 0xfc, 0x1f,
+    0xcc, 0x3e, 0x0, 0xf8, 0x6, 0x0, 0x3, 0x0,
+
+    /* U+6F6D */
+    0x0, 0x0, 0x0, 0x7, 0x3f, 0xff, 0xf8, 0xf7, 0xff, 0xff, 0xe, 0x7,
+    0x18, 0x0, 0x0, 0xe3, 0x0, 0x1, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0,
+    0xc, 0x31, 0x8e, 0x61, 0xce, 0x31, 0x9f, 0x3f, 0xff, 0xf1, 0xe1, 0xff,
+    0xfc, 0xc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x1, 0xff, 0xfe, 0x0,
+    0x38, 0x0, 0xc0, 0x47, 0xff, 0xf8, 0x18, 0xe0, 0x3, 0x3, 0x1c, 0x0,
+    0x60, 0xe1, 0xff, 0xfc, 0x1c, 0x1f, 0xfe, 0x3, 0x80, 0x18, 0x0, 0xe7,
+    0xff, 0xff, 0x9c, 0xff, 0xff, 0xf3, 0x80, 0xc, 0x0, 0xe0, 0x1, 0x80,
+    0x1c, 0x0, 0x30, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+6F6E */
+    0x0, 0x30, 0x0, 0xc, 0xc, 0x7, 0xc3, 0xc3, 0x3, 0xf8, 0x7f, 0xfd,
+    0xfe, 0x3, 0xff, 0xf1, 0x80, 0xe, 0x18, 0x60, 0x3, 0x6, 0x18, 0x3,
+    0xf1, 0x86, 0x41, 0xff, 0x7f, 0xbc, 0xe0, 0xdf, 0xe7, 0xb0, 0x37, 0x18,
+    0x4f, 0xfd, 0x86, 0x3, 0xff, 0x61, 0x80, 0xc0, 0xd8, 0x60, 0x30, 0x37,
+    0x18, 0x2f, 0xfd, 0xfe, 0x19, 0xff, 0x7f, 0x86, 0xc, 0x18, 0x63, 0x83,
+    0x6, 0x18, 0xef, 0xfd, 0x86, 0x37, 0xff, 0xe1, 0x9c, 0x7f, 0xb8, 0x67,
+    0x3, 0xc, 0x19, 0x80, 0xc7, 0x6, 0xe0, 0x33, 0xc7, 0xb0, 0xc, 0xe3,
+    0xe0, 0x3, 0x20, 0x60,
+
+    /* U+6FA1 */
+    0x0, 0x0, 0x0, 0x7, 0x7, 0xff, 0x80, 0xf0, 0xff, 0xf8, 0xf, 0x38,
+    0x7, 0x0, 0x46, 0x0, 0x60, 0x0, 0xe0, 0x1c, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0xff, 0xc0, 0x40, 0x0, 0x0, 0x1e, 0x3f, 0xcf, 0xf1, 0xe7, 0xf9,
+    0xfe, 0xc, 0xc3, 0x30, 0xc0, 0x18, 0x66, 0x18, 0x3, 0xfc, 0xff, 0x0,
+    0x3f, 0xf, 0xc0, 0x0, 0xc, 0x0, 0xc, 0x1, 0x80, 0x3, 0xbf, 0xff,
+    0xf8, 0x67, 0xff, 0xff, 0x1c, 0x3, 0xf0, 0x3, 0x80, 0xff, 0x0, 0x60,
+    0x7b, 0x78, 0x1c, 0x3c, 0x63, 0xc3, 0x9f, 0xc, 0x3e, 0xe7, 0x81, 0x81,
+    0xdc, 0x0, 0x30, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+6FA4 */
+    0x0, 0x0, 0x0, 0x7, 0xf, 0xff, 0xe0, 0xf3, 0xff, 0xfe, 0xf, 0x63,
+    0x18, 0xc0, 0x4c, 0x63, 0x18, 0x1, 0x8c, 0x63, 0x0, 0x3f, 0xff, 0xe0,
+    0x3, 0xff, 0xf8, 0x40, 0x1, 0x80, 0x1f, 0x1f, 0xff, 0xe1, 0xe3, 0xff,
+    0xfc, 0xc, 0x0, 0xe0, 0x0, 0x0, 0x18, 0x0, 0x7, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xf0, 0x40, 0xc0, 0x60, 0x1c, 0x18, 0x1c, 0x3, 0x3f, 0xff,
+    0xf0, 0x67, 0xff, 0xff, 0x1c, 0x0, 0xc0, 0x3, 0x80, 0x18, 0x0, 0x61,
+    0xff, 0xff, 0x1c, 0x7f, 0xff, 0xe3, 0x80, 0xc, 0x0, 0x60, 0x1, 0x80,
+    0xc, 0x0, 0x30, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+6FDF */
+    0x0, 0x1, 0x80, 0x6, 0x0, 0x30, 0x0, 0xf0, 0xe, 0x0, 0xe, 0xff,
+    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x0, 0x8, 0x80, 0x0, 0x1, 0xb1, 0xe0,
+    0x1f, 0xcc, 0xf8, 0x41, 0xf9, 0xbe, 0x1f, 0x13, 0x26, 0xc1, 0xe2, 0x6c,
+    0xcc, 0xc, 0xcd, 0x99, 0xc0, 0x1b, 0xb3, 0xfc, 0x6, 0xe6, 0xfb, 0x80,
+    0x80, 0x48, 0x90, 0x46, 0x0, 0x18, 0x1c, 0xff, 0xff, 0x3, 0x1f, 0xff,
+    0xe0, 0x63, 0x0, 0x1c, 0x1c, 0x60, 0x3, 0x83, 0x8f, 0xff, 0xf0, 0x63,
+    0xff, 0xfe, 0x1c, 0x70, 0x1, 0xc3, 0x9c, 0x0, 0x38, 0xe3, 0x80, 0x7,
+    0xc, 0xe0, 0x0, 0x60, 0x8, 0x0, 0x8, 0x0,
+
+    /* U+7063 */
+    0x0, 0x0, 0x2, 0x3, 0xc, 0x3e, 0x30, 0x39, 0x90, 0x6, 0x41, 0xb3,
+    0x7e, 0xcc, 0x3, 0xe0, 0xf, 0x80, 0x1c, 0x3c, 0x70, 0x0, 0x93, 0xc3,
+    0x40, 0x3f, 0x80, 0xfe, 0x67, 0xfb, 0xff, 0xa7, 0x84, 0x0, 0x10, 0x3b,
+    0x53, 0xed, 0x60, 0x35, 0xe6, 0xd6, 0x2, 0x5e, 0x69, 0x20, 0x24, 0x3e,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0xc, 0xff, 0xff, 0xc1,
+    0xc0, 0x0, 0xc, 0x1c, 0xff, 0xff, 0xc1, 0x9f, 0xff, 0xf8, 0x39, 0x80,
+    0x0, 0x3, 0x9f, 0xff, 0xfc, 0x30, 0xff, 0xff, 0xe7, 0x0, 0x0, 0xe,
+    0x70, 0x0, 0x1, 0xe6, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xf, 0x0,
+
+    /* U+706B */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x6, 0xe, 0x1,
+    0x80, 0xe0, 0xe0, 0x1c, 0xe, 0xe, 0x3, 0x80, 0xe0, 0xe0, 0x38, 0x1c,
+    0xe, 0x7, 0x81, 0xc0, 0xf0, 0x70, 0x1c, 0xf, 0x7, 0x1, 0x81, 0xf0,
+    0x60, 0x0, 0x1d, 0x80, 0x0, 0x1, 0x98, 0x0, 0x0, 0x39, 0xc0, 0x0,
+    0x3, 0xe, 0x0, 0x0, 0x70, 0xe0, 0x0, 0xf, 0x7, 0x0, 0x0, 0xe0,
+    0x38, 0x0, 0x1c, 0x1, 0xe0, 0x7, 0x80, 0xf, 0x1, 0xf0, 0x0, 0x7c,
+    0x7e, 0x0, 0x3, 0xe7, 0x80, 0x0, 0x1e, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+707D */
+    0x3, 0x1, 0x1, 0x80, 0x70, 0x30, 0x38, 0xe, 0x7, 0x7, 0x1, 0xc0,
+    0xe0, 0x70, 0x18, 0x1c, 0xe, 0x3, 0x81, 0xc0, 0xc0, 0x1c, 0x1c, 0xe,
+    0x0, 0xe0, 0xf0, 0x70, 0x7, 0x7, 0x83, 0x80, 0x30, 0x38, 0x1c, 0x0,
+    0x0, 0x0, 0x80, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x70, 0xe0,
+    0x38, 0x7, 0xe, 0x3, 0x0, 0xe0, 0xe0, 0x70, 0x1c, 0xf, 0xe, 0x1,
+    0xc1, 0xf0, 0xe0, 0x0, 0x1d, 0x80, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x38,
+    0xe0, 0x0, 0xf, 0x7, 0x0, 0x1, 0xe0, 0x3c, 0x0, 0xfc, 0x1, 0xf8,
+    0x3f, 0x0, 0x7, 0xe7, 0xc0, 0x0, 0x3e, 0x20, 0x0, 0x0, 0x40,
+
+    /* U+708E */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3, 0xe, 0x3, 0x0, 0x70,
+    0xe0, 0x70, 0xe, 0xe, 0xf, 0x0, 0xe0, 0xf0, 0xe0, 0x1c, 0x1f, 0x8c,
+    0x0, 0x3, 0x9c, 0x0, 0x0, 0x70, 0xe0, 0x0, 0xf, 0x7, 0x80, 0x3,
+    0xe0, 0x3e, 0x1, 0xf8, 0x0, 0xfc, 0x7e, 0x6, 0x7, 0xe7, 0x80, 0xe0,
+    0xe, 0x0, 0xe, 0x3, 0x0, 0x70, 0xe0, 0x70, 0x7, 0xe, 0xf, 0x0,
+    0xe0, 0xf0, 0xe0, 0x1c, 0x1f, 0xc, 0x0, 0x83, 0x98, 0x0, 0x0, 0x39,
+    0xc0, 0x0, 0xf, 0xf, 0x0, 0x1, 0xe0, 0x7c, 0x0, 0xfc, 0x1, 0xf0,
+    0x3f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x3e, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+7092 */
+    0x2, 0x0, 0x20, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0x60,
+    0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0x60, 0x47, 0x30, 0x26, 0x6e, 0x73,
+    0x86, 0x7c, 0xc7, 0x18, 0x67, 0xcc, 0x71, 0xc6, 0x71, 0xc7, 0xe, 0x66,
+    0x18, 0x70, 0xe6, 0x63, 0x87, 0x6, 0x66, 0x38, 0x70, 0x6, 0x63, 0x7,
+    0x0, 0x66, 0x0, 0x70, 0xc0, 0x60, 0x7, 0x1c, 0xe, 0x0, 0x63, 0x80,
+    0xf0, 0x3e, 0x38, 0xf, 0x3, 0xe7, 0x0, 0xd8, 0x0, 0xe0, 0x19, 0xc0,
+    0x1c, 0x1, 0x8c, 0x7, 0x80, 0x38, 0x41, 0xf0, 0x3, 0x0, 0xfc, 0x0,
+    0x70, 0x7f, 0x0, 0x6, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+70AD */
+    0x0, 0x6, 0x0, 0x1, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80,
+    0x60, 0x18, 0x1c, 0x6, 0x3, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x1f,
+    0xff, 0xff, 0xc1, 0xc0, 0x0, 0x0, 0x18, 0x1, 0x80, 0x1, 0x80, 0x18,
+    0x0, 0x18, 0x21, 0x81, 0x1, 0x86, 0x18, 0x38, 0x18, 0xe3, 0x83, 0x1,
+    0x8c, 0x3c, 0x70, 0x19, 0xc3, 0xc6, 0x3, 0x88, 0x76, 0x0, 0x38, 0x6,
+    0x70, 0x3, 0x81, 0xc3, 0x80, 0x30, 0x3c, 0x1e, 0x7, 0xf, 0x80, 0xf8,
+    0x67, 0xe0, 0x3, 0xe6, 0x78, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+70B8 */
+    0x6, 0x0, 0x80, 0x0, 0x60, 0x18, 0x0, 0x6, 0x3, 0x80, 0x0, 0x60,
+    0x38, 0x0, 0x6, 0x3, 0xff, 0xe0, 0x66, 0x7f, 0xfe, 0x26, 0xef, 0xff,
+    0xc6, 0x7c, 0xe6, 0x0, 0x67, 0x9c, 0x60, 0x6, 0x73, 0x86, 0x0, 0x66,
+    0x38, 0x70, 0x6, 0x63, 0x7, 0xfc, 0x66, 0x0, 0x7f, 0xc6, 0x60, 0x7,
+    0x0, 0x66, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0,
+    0xe0, 0x7, 0x0, 0xf, 0x0, 0x7f, 0xe0, 0xf8, 0x7, 0xfc, 0x1d, 0xc0,
+    0x60, 0x1, 0x8e, 0x6, 0x0, 0x38, 0x70, 0x60, 0x3, 0x82, 0x6, 0x0,
+    0x70, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x40, 0x0, 0x20, 0x0,
+
+    /* U+70BA */
+    0x4, 0xc, 0x0, 0x0, 0xc1, 0x80, 0x0, 0x1c, 0x70, 0x0, 0x1, 0x8e,
+    0x0, 0x3, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x0, 0xc, 0x7, 0x0,
+    0x3, 0x80, 0x60, 0x0, 0x60, 0xc, 0x0, 0x1f, 0xff, 0xc0, 0x3, 0xff,
+    0xfc, 0x0, 0xe0, 0x3, 0x80, 0x38, 0x0, 0x30, 0x7, 0x0, 0x6, 0x1,
+    0xc0, 0x0, 0xc0, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe7, 0x80, 0x0,
+    0x1d, 0xe0, 0x0, 0x43, 0xbb, 0x31, 0x8c, 0x74, 0x66, 0x39, 0x8e, 0x1c,
+    0x63, 0x19, 0xc3, 0xc, 0x63, 0x30, 0xe1, 0x84, 0xe, 0x18, 0x0, 0xf,
+    0xc0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+70CF */
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x80, 0x0, 0xf, 0xff, 0xf0, 0x7, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xf0, 0x38, 0x0, 0x6, 0x7, 0x0, 0x0, 0xc0,
+    0xe0, 0x0, 0x38, 0x1f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xc0, 0x70, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x87,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x71, 0x8, 0x63, 0x8e, 0x61,
+    0x8c, 0x31, 0xcc, 0x31, 0xc6, 0x33, 0x86, 0x18, 0x46, 0x60, 0xc3, 0xf,
+    0xcc, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+70E4 */
+    0x6, 0x0, 0x80, 0x0, 0x60, 0x1c, 0x0, 0x6, 0x1, 0xc0, 0x80, 0x60,
+    0x1c, 0x1c, 0x6, 0x1f, 0xf9, 0x80, 0x60, 0xff, 0xb8, 0x26, 0x61, 0xc7,
+    0x6, 0x7c, 0x1c, 0xe0, 0x67, 0xdf, 0xff, 0xc6, 0x73, 0xff, 0xfe, 0x66,
+    0x0, 0xf8, 0x6, 0x60, 0xe, 0x0, 0x66, 0x1, 0xc0, 0x6, 0x60, 0x7f,
+    0xf8, 0x66, 0xf, 0xff, 0xc0, 0x63, 0xf0, 0x0, 0xe, 0x76, 0x0, 0x0,
+    0xf6, 0x70, 0x0, 0xf, 0x7, 0xff, 0x80, 0xd8, 0x3f, 0xfc, 0x19, 0xc0,
+    0x1, 0xc1, 0x8c, 0x0, 0x1c, 0x38, 0x40, 0x1, 0x83, 0x0, 0x0, 0x38,
+    0x70, 0x0, 0x3f, 0x6, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+7121 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xe3, 0xe3, 0x9c, 0x60, 0x7e, 0x30, 0xc6,
+    0x7, 0x63, 0xc, 0x60, 0x46, 0x30, 0xc6, 0x0, 0x63, 0xc, 0x60, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x63, 0xc,
+    0x60, 0x6, 0x30, 0xc6, 0x0, 0x63, 0xc, 0x60, 0x6, 0x30, 0xc6, 0x0,
+    0x63, 0x9c, 0x60, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x1, 0x80, 0x8, 0x30, 0x18, 0x60, 0xc1, 0x83, 0x87, 0xe, 0x1c,
+    0x30, 0x30, 0xe0, 0xe7, 0x3, 0x6, 0xe, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+7159 */
+    0x2, 0x0, 0x0, 0x0, 0x63, 0xff, 0xfc, 0x6, 0x7f, 0xff, 0xe0, 0x63,
+    0xff, 0xfc, 0x6, 0x1, 0x98, 0x0, 0x60, 0x19, 0x80, 0x26, 0xcf, 0xff,
+    0x6, 0x7f, 0xff, 0xfc, 0x67, 0xbb, 0x9d, 0xc6, 0x73, 0x19, 0x8c, 0x66,
+    0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0xff,
+    0xfc, 0x4e, 0x1f, 0xff, 0xc0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0,
+    0xe0, 0x6, 0x0, 0xf, 0x3f, 0xff, 0xc1, 0xfb, 0xff, 0xfc, 0x19, 0xc0,
+    0x60, 0x3, 0x8c, 0x6, 0x0, 0x38, 0x40, 0x60, 0x7, 0x0, 0xe, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0xf, 0xff, 0xfe,
+
+    /* U+7167 */
+    0xf, 0x8f, 0xff, 0x81, 0xfc, 0xff, 0xfc, 0x18, 0xe1, 0xc1, 0xc3, 0x8e,
+    0x1c, 0xc, 0x38, 0xe1, 0x80, 0xc3, 0x8e, 0x18, 0xc, 0x38, 0xe3, 0x83,
+    0xc3, 0x8e, 0xf0, 0xf8, 0x3f, 0xfe, 0xf, 0x3, 0xfe, 0x0, 0x0, 0x38,
+    0xe7, 0xff, 0x83, 0x8e, 0x7f, 0xfc, 0x38, 0xee, 0x1, 0xc3, 0x8e, 0xe0,
+    0x1c, 0x38, 0xee, 0x1, 0xc1, 0xfe, 0xe0, 0x1c, 0x1f, 0xcf, 0xff, 0xc0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x18, 0x60,
+    0xc3, 0x83, 0x87, 0xc, 0x1c, 0x38, 0x70, 0xe1, 0xc7, 0x3, 0xe, 0xe,
+    0x70, 0x30, 0x60, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+718A */
+    0x2, 0x0, 0xc0, 0x0, 0x70, 0xc, 0x18, 0x6, 0x30, 0xc7, 0x80, 0xe1,
+    0x8f, 0xf0, 0xe, 0x7c, 0xf8, 0x7, 0xff, 0xec, 0x2, 0x7c, 0x6, 0xc0,
+    0x60, 0x0, 0xf, 0x1e, 0x1f, 0xf8, 0xff, 0xc1, 0xff, 0x83, 0xf0, 0x18,
+    0x18, 0xc0, 0x1, 0xff, 0x8c, 0x18, 0x1f, 0xf8, 0xcf, 0x81, 0x81, 0x8f,
+    0xf0, 0x1f, 0xf8, 0xf0, 0x1, 0xff, 0x8c, 0x2, 0x18, 0x18, 0xc0, 0x61,
+    0x81, 0x8e, 0xe, 0x18, 0xf8, 0xff, 0xe1, 0x8f, 0x83, 0xf8, 0x0, 0x0,
+    0x1, 0x1, 0x86, 0xc, 0x38, 0x18, 0x70, 0xc3, 0x83, 0x87, 0xe, 0x1c,
+    0x30, 0x30, 0xe0, 0xe7, 0x3, 0x6, 0xe, 0x20, 0x0, 0x0, 0x40,
+
+    /* U+7199 */
+    0x3f, 0xfc, 0xff, 0xf, 0xff, 0xbf, 0xf1, 0xc7, 0x7, 0xe, 0x30, 0xe0,
+    0xc0, 0xc6, 0x1c, 0x18, 0x18, 0xcf, 0xe3, 0x3, 0x1b, 0xfe, 0x60, 0x63,
+    0x70, 0xcc, 0x1c, 0x6c, 0x19, 0xff, 0x8d, 0x83, 0x3f, 0xe1, 0xb8, 0x66,
+    0x0, 0x37, 0xfc, 0xc0, 0x6, 0x7f, 0x18, 0x0, 0xc3, 0x83, 0x1, 0x98,
+    0x70, 0x60, 0x33, 0xe, 0xc, 0xe, 0x7f, 0xfd, 0xff, 0xcf, 0xff, 0xbf,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc, 0x18, 0x70, 0x61,
+    0xc3, 0xe, 0x1c, 0x38, 0x70, 0xe3, 0x3, 0xe, 0xe, 0xe0, 0x60, 0xc1,
+    0xc8, 0x0, 0x0, 0x10,
+
+    /* U+71B1 */
+    0x1, 0x80, 0x30, 0x0, 0x18, 0x3, 0x0, 0x1f, 0xf8, 0x30, 0x3, 0xff,
+    0x83, 0x0, 0x1, 0x80, 0x30, 0x0, 0x18, 0x1f, 0xf0, 0x7f, 0xfd, 0xff,
+    0x3, 0xff, 0xc3, 0x30, 0xc, 0xc0, 0x33, 0x0, 0xce, 0xc3, 0x30, 0x3c,
+    0x7c, 0x33, 0x7, 0x1b, 0x1f, 0x30, 0x1, 0x80, 0xe3, 0x1, 0xff, 0x87,
+    0x30, 0x1f, 0xf8, 0x7b, 0x20, 0x18, 0xd, 0xd2, 0x1, 0x9d, 0xc1, 0xe3,
+    0xff, 0xd8, 0x1e, 0x7f, 0xe3, 0x80, 0xe2, 0x0, 0x30, 0xc, 0x8, 0x0,
+    0x1, 0x1, 0x86, 0x1c, 0x38, 0x18, 0x70, 0xc1, 0x83, 0x87, 0xe, 0x1c,
+    0x30, 0x30, 0xe0, 0xe7, 0x3, 0x6, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+71D2 */
+    0x4, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0xf, 0xff, 0x80, 0x61,
+    0xff, 0xfc, 0x6, 0x0, 0x60, 0x0, 0x64, 0x6, 0x0, 0x26, 0xdf, 0xff,
+    0xe6, 0x7f, 0xff, 0xfe, 0x67, 0x84, 0x2, 0x6, 0x70, 0xc0, 0x60, 0x66,
+    0xc, 0x6, 0x6, 0x67, 0xfb, 0xfe, 0x66, 0x3f, 0x1f, 0xc6, 0xe0, 0xc0,
+    0x60, 0x6c, 0xe, 0x7, 0x0, 0xc7, 0xff, 0xfe, 0xc, 0x7e, 0x3f, 0xc0,
+    0xe0, 0x0, 0x0, 0xf, 0x3f, 0xff, 0xe1, 0xfb, 0xff, 0xfe, 0x19, 0x87,
+    0x18, 0x3, 0x9c, 0x61, 0x82, 0x30, 0xc6, 0x18, 0x67, 0x0, 0xe1, 0x86,
+    0x60, 0x7c, 0x1f, 0xe6, 0xf, 0x1, 0xfc, 0x0, 0xc0, 0x0, 0x0,
+
+    /* U+71D5 */
+    0x0, 0x60, 0x60, 0x0, 0x6, 0x6, 0x0, 0x0, 0x60, 0x60, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xc0, 0x6, 0x6, 0x0, 0x0, 0x60, 0xe0,
+    0x0, 0x17, 0xfe, 0x80, 0x3, 0x3f, 0xcc, 0x0, 0x30, 0x0, 0xce, 0x7f,
+    0x1f, 0x8f, 0xc7, 0xf3, 0xfc, 0xf8, 0x3, 0x31, 0xce, 0x0, 0x33, 0xc,
+    0xc0, 0x3, 0x30, 0xcc, 0x0, 0x73, 0xc, 0xc6, 0x3f, 0x30, 0xcc, 0x67,
+    0xb3, 0xfc, 0xfe, 0x43, 0x3f, 0xcf, 0xe0, 0x30, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x86, 0xc, 0x38, 0x18, 0x60, 0xc1, 0x83, 0x87, 0xe, 0x1c,
+    0x30, 0x30, 0xe0, 0xe7, 0x3, 0x6, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+71D9 */
+    0x0, 0x0, 0x0, 0x1, 0xc3, 0xff, 0xf0, 0x1e, 0x30, 0x3, 0x80, 0x77,
+    0x0, 0x38, 0x0, 0x7f, 0xff, 0x80, 0x7, 0x0, 0x18, 0x70, 0x3f, 0xff,
+    0x83, 0xc1, 0xff, 0xe0, 0x1c, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0,
+    0x1c, 0x0, 0x0, 0x43, 0xff, 0xfc, 0xe, 0xff, 0xff, 0xc1, 0xdc, 0x71,
+    0x8c, 0x18, 0x1e, 0x30, 0xc3, 0x87, 0x8e, 0x1c, 0x70, 0x63, 0xcf, 0x87,
+    0x0, 0x70, 0xf0, 0x0, 0x7, 0x0, 0x0, 0x38, 0x70, 0x38, 0x7, 0xe,
+    0x7, 0x80, 0xe0, 0xf0, 0xf0, 0xc, 0x1f, 0xcc, 0x0, 0x7, 0x8f, 0x0,
+    0x1f, 0xe0, 0x7f, 0x87, 0xf8, 0x0, 0xfe, 0x70, 0x0, 0x0, 0x40,
+
+    /* U+71DF */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x6, 0x10, 0xcc, 0xcc, 0xc6, 0x3b, 0xb1,
+    0x99, 0xc6, 0x66, 0x63, 0x30, 0xc, 0x4, 0xe0, 0x7, 0xf0, 0x3f, 0x83,
+    0xc7, 0x9e, 0x38, 0x70, 0x37, 0x1, 0x83, 0xff, 0xff, 0xc1, 0xff, 0xff,
+    0xfe, 0x38, 0x0, 0x0, 0xee, 0x0, 0x0, 0xd, 0xcf, 0xff, 0xf9, 0xbb,
+    0xff, 0xff, 0x32, 0x70, 0x0, 0x64, 0xe, 0x0, 0x1c, 0x0, 0xff, 0xff,
+    0x80, 0x0, 0xf0, 0x0, 0x0, 0xc, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x3f,
+    0xff, 0xfe, 0xe, 0x0, 0x0, 0xc1, 0xc0, 0x0, 0x18, 0x3f, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+722C */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0xf, 0xfe, 0x7f, 0x81, 0xfd,
+    0x8f, 0xfc, 0x19, 0x98, 0xcc, 0xe1, 0x99, 0x8c, 0xc6, 0x19, 0x9c, 0xcc,
+    0x61, 0x99, 0xcc, 0xc6, 0x19, 0x9c, 0xcc, 0x61, 0x99, 0xcc, 0xce, 0x19,
+    0x8c, 0xff, 0xc1, 0x98, 0xcf, 0xfc, 0x19, 0x8c, 0xc0, 0x1, 0x98, 0xcc,
+    0x0, 0x19, 0x8c, 0xc0, 0x3, 0x98, 0xcc, 0x6, 0x39, 0x8c, 0xc0, 0x63,
+    0x98, 0xec, 0x6, 0x39, 0x86, 0xff, 0xe3, 0x18, 0x77, 0xfc, 0x31, 0x83,
+    0x0, 0x3, 0x18, 0x3c, 0x0, 0x71, 0x81, 0xe0, 0x7, 0x18, 0xf, 0xe0,
+    0x61, 0x80, 0x3f, 0xc6, 0x18, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xe0,
+
+    /* U+722D */
+    0x0, 0x0, 0x7, 0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x1, 0xff,
+    0x0, 0x10, 0x8, 0x8, 0x7, 0x1, 0xc0, 0xc0, 0x70, 0xc, 0xe, 0x6,
+    0x0, 0xe0, 0x60, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x3, 0x0, 0x0, 0xe0,
+    0x70, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x3, 0x0,
+    0x0, 0xe0, 0x30, 0x0, 0xe, 0x7, 0x1, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xfc, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+7236 */
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x0, 0x1, 0xe0, 0x78, 0x0, 0x3c,
+    0x3, 0xe0, 0x7, 0x80, 0xf, 0x1, 0xf0, 0x0, 0x7c, 0x3e, 0x0, 0x3,
+    0xc7, 0xc0, 0x0, 0x1e, 0x70, 0x0, 0x0, 0x40, 0x18, 0x1, 0x80, 0x1,
+    0xc0, 0x38, 0x0, 0x1c, 0x3, 0x80, 0x0, 0xe0, 0x38, 0x0, 0xe, 0x7,
+    0x0, 0x0, 0x70, 0x60, 0x0, 0x7, 0xe, 0x0, 0x0, 0x39, 0xc0, 0x0,
+    0x1, 0xf8, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x1f,
+    0xc0, 0x0, 0x7, 0x9f, 0x0, 0x1, 0xf0, 0xfc, 0x0, 0xfc, 0x3, 0xf8,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x3e, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+7238 */
+    0x0, 0x40, 0x60, 0x0, 0x1c, 0x7, 0xc0, 0x7, 0xc0, 0x3f, 0x1, 0xf0,
+    0x0, 0xfc, 0x7c, 0x70, 0xe1, 0xc7, 0x7, 0x9e, 0x4, 0x0, 0x1f, 0x80,
+    0x0, 0x1, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf, 0xf0, 0x7f,
+    0x80, 0x1f, 0xe7, 0x80, 0x0, 0x3e, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0xf0, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81,
+    0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf0, 0x1f, 0xff,
+    0xfc, 0x1, 0xc0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x61, 0xe0, 0x0, 0xe,
+    0xf, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+723A */
+    0x0, 0x20, 0x40, 0x0, 0x1e, 0x7, 0x80, 0x7, 0xc0, 0x3e, 0x1, 0xf8,
+    0x0, 0xfc, 0x3e, 0x60, 0x73, 0xe3, 0x87, 0x9e, 0xc, 0x0, 0x3f, 0x80,
+    0x0, 0x3, 0xfc, 0x0, 0x7, 0xfb, 0xfe, 0x7, 0xfc, 0x3, 0xfe, 0x7c,
+    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0xff, 0xc3, 0xff, 0xef,
+    0xfc, 0x1c, 0x18, 0xc1, 0xc1, 0xc1, 0x8c, 0x38, 0x1f, 0xf8, 0xc3, 0x1,
+    0xc1, 0x8c, 0x60, 0x1c, 0x18, 0xc7, 0x1, 0xff, 0x8c, 0x38, 0x1f, 0xf8,
+    0xc0, 0xc1, 0xc1, 0x8c, 0xc, 0x1c, 0x38, 0xc0, 0xc3, 0xff, 0x8c, 0x7c,
+    0x7f, 0x18, 0xcf, 0x80, 0x1, 0x8c, 0x0, 0x0, 0x8, 0x80, 0x0,
+
+    /* U+723E */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x8e, 0x10, 0x0, 0x78,
+    0x63, 0xc0, 0x3f, 0x6, 0x1f, 0xc7, 0xc0, 0x60, 0x3e, 0x7f, 0xff, 0xff,
+    0xe1, 0xff, 0xff, 0xf8, 0x18, 0x6, 0x1, 0x83, 0x82, 0x60, 0xdc, 0x3b,
+    0x66, 0xf9, 0xc3, 0x9e, 0x67, 0x9c, 0x39, 0xe6, 0x79, 0xc3, 0xbf, 0x6f,
+    0xdc, 0x3b, 0x36, 0xcd, 0xc3, 0x80, 0x60, 0x1c, 0x38, 0x26, 0x9, 0xc3,
+    0xb7, 0x6d, 0xdc, 0x39, 0xe6, 0x79, 0xc3, 0x9c, 0x63, 0x9c, 0x39, 0xe6,
+    0x79, 0xc3, 0xb3, 0x6c, 0xdc, 0x3a, 0x6, 0x81, 0xc3, 0x80, 0x60, 0x78,
+    0x38, 0x6, 0xf, 0x81, 0x0, 0x40, 0xf0,
+
+    /* U+7247 */
+    0x0, 0x0, 0x80, 0x1, 0x80, 0x30, 0x0, 0x30, 0x6, 0x0, 0x6, 0x0,
+    0xc0, 0x0, 0xc0, 0x18, 0x0, 0x18, 0x3, 0x0, 0x3, 0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x81, 0x80, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x1c, 0x0, 0x1c, 0x3, 0x80, 0x3,
+    0x80, 0x70, 0x0, 0x70, 0xe, 0x0, 0xe, 0x3, 0x80, 0x1, 0xc0, 0x70,
+    0x0, 0x38, 0x1e, 0x0, 0x7, 0x3, 0x80, 0x0, 0xe0, 0xe0, 0x0, 0x1c,
+    0xc, 0x0, 0x3, 0x80, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+7248 */
+    0x0, 0x80, 0x0, 0x1, 0x18, 0xf, 0xf8, 0x19, 0xc3, 0xff, 0xe1, 0x9c,
+    0x3f, 0xfe, 0x19, 0xc7, 0x0, 0x1, 0x9c, 0x60, 0x0, 0x19, 0xc6, 0x0,
+    0x1, 0xff, 0x60, 0x0, 0x1f, 0xf7, 0xff, 0x81, 0xfe, 0x7f, 0xfc, 0x18,
+    0x7, 0xff, 0xc1, 0x80, 0x60, 0xc, 0x18, 0x6, 0x61, 0xc1, 0x80, 0x66,
+    0x1c, 0x3f, 0xc6, 0x61, 0x83, 0xfc, 0x67, 0x18, 0x38, 0xc6, 0x33, 0x83,
+    0xc, 0x63, 0x30, 0x30, 0xc6, 0x3f, 0x3, 0xc, 0xe1, 0xe0, 0x30, 0xcc,
+    0x1e, 0x3, 0xc, 0xc1, 0xe0, 0x70, 0xdc, 0x3f, 0x86, 0xd, 0x8f, 0x3c,
+    0x60, 0xf9, 0xe1, 0xe4, 0xd, 0x1c, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+724C */
+    0x1, 0x80, 0x60, 0x1, 0x18, 0x6, 0x0, 0x31, 0x80, 0xc0, 0x3, 0x18,
+    0xff, 0xf8, 0x31, 0x8f, 0xff, 0xc3, 0x18, 0xc3, 0xc, 0x31, 0x8c, 0x30,
+    0xc3, 0xfc, 0xc7, 0xc, 0x3f, 0xef, 0xff, 0xc3, 0xfc, 0xc7, 0xc, 0x30,
+    0xc, 0x60, 0xc3, 0x0, 0xc6, 0xc, 0x30, 0xf, 0xff, 0xc3, 0xf0, 0xff,
+    0xfc, 0x3f, 0xc1, 0xc0, 0x3, 0xfc, 0x39, 0x80, 0x30, 0xc7, 0x1c, 0x3,
+    0xc, 0x41, 0xc0, 0x30, 0xdf, 0xff, 0xc3, 0xf, 0xff, 0xfe, 0x30, 0xdf,
+    0xff, 0xe7, 0xc, 0x1, 0xc0, 0x70, 0xc0, 0x1c, 0x6, 0xc, 0x1, 0xc0,
+    0x60, 0xc0, 0x1c, 0x4, 0xc, 0x1, 0xc0, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+7259 */
+    0x1f, 0xff, 0xff, 0xf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x70, 0x0, 0x70, 0xe, 0x0, 0xe, 0x1, 0xc0, 0x1, 0x80, 0x38, 0x0,
+    0x70, 0x7, 0x0, 0xe, 0x0, 0xe0, 0x1, 0xc0, 0x1c, 0x0, 0x7f, 0xff,
+    0xff, 0xf, 0xff, 0xff, 0xe1, 0x80, 0x3e, 0x0, 0x70, 0xf, 0xc0, 0x4,
+    0x3, 0xb8, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x38, 0xe0, 0x0, 0x1e, 0x1c,
+    0x0, 0xf, 0x83, 0x80, 0x7, 0xc0, 0x70, 0x3, 0xe0, 0xe, 0x0, 0xf8,
+    0x1, 0xc0, 0x1c, 0x0, 0x38, 0x0, 0x0, 0x7f, 0x0, 0x0, 0xf, 0xc0,
+    0x0, 0x0, 0xe0, 0x0,
+
+    /* U+7269 */
+    0x2, 0x3, 0x0, 0x0, 0x60, 0xe0, 0x0, 0xc, 0x1c, 0x0, 0x11, 0x83,
+    0x0, 0x3, 0x30, 0x60, 0x0, 0x66, 0x1f, 0xff, 0xd, 0xc3, 0xff, 0xf1,
+    0xff, 0x67, 0x7e, 0x7f, 0xdc, 0xcc, 0xcc, 0x63, 0x19, 0x99, 0x8c, 0xe7,
+    0x33, 0x31, 0x98, 0xc6, 0x66, 0x32, 0x19, 0xcc, 0xc6, 0x6, 0x31, 0x80,
+    0xd1, 0xc6, 0x30, 0x3f, 0x71, 0xc6, 0x3f, 0x9c, 0x30, 0xcf, 0xe7, 0xe,
+    0x19, 0xcc, 0xc3, 0x83, 0x1, 0x80, 0x60, 0xe0, 0x30, 0x1c, 0x1c, 0x6,
+    0xf, 0x3, 0x80, 0xc3, 0xc0, 0x60, 0x18, 0xf0, 0x1c, 0x3, 0x1c, 0x1f,
+    0x80, 0x60, 0x3, 0xe0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+7279 */
+    0x3, 0x0, 0x20, 0x0, 0x30, 0x6, 0x0, 0x3, 0x0, 0x70, 0x2, 0x30,
+    0x7, 0x0, 0x33, 0x1f, 0xff, 0xc3, 0x30, 0xff, 0xf8, 0x37, 0x0, 0x70,
+    0x3, 0xfe, 0x7, 0x0, 0x3f, 0xc0, 0x70, 0x7, 0x31, 0xff, 0xfc, 0x63,
+    0x3f, 0xff, 0xe6, 0x30, 0xff, 0xfc, 0x63, 0x0, 0x7, 0x6, 0x30, 0x0,
+    0x70, 0x3, 0x40, 0x7, 0x0, 0x7d, 0xff, 0xfe, 0x3f, 0x8f, 0xff, 0xc7,
+    0xf0, 0x0, 0x70, 0x73, 0x2, 0x7, 0x0, 0x30, 0x70, 0x70, 0x3, 0x3,
+    0x7, 0x0, 0x30, 0x38, 0x70, 0x3, 0x1, 0x87, 0x0, 0x30, 0x0, 0x60,
+    0x3, 0x0, 0x3e, 0x0, 0x30, 0x3, 0xe0, 0x2, 0x0, 0x38, 0x0,
+
+    /* U+72D7 */
+    0x0, 0x3, 0x0, 0xe, 0x38, 0xe0, 0x0, 0xee, 0x1c, 0x0, 0xf, 0xc7,
+    0x0, 0x1, 0xf0, 0xff, 0xf0, 0x1c, 0x3f, 0xff, 0x87, 0x8f, 0xff, 0xf1,
+    0xf1, 0xc0, 0x6, 0x73, 0x70, 0x0, 0xcc, 0x6c, 0x0, 0x18, 0xc, 0x1f,
+    0xc3, 0x1, 0x87, 0xf8, 0x60, 0x78, 0xe3, 0x8c, 0x1f, 0x18, 0x31, 0x87,
+    0xe3, 0x6, 0x30, 0xcc, 0x60, 0xc6, 0x39, 0x8c, 0x18, 0xce, 0x31, 0x87,
+    0x19, 0x86, 0x3f, 0xe3, 0x1, 0xc7, 0xf8, 0xe0, 0x38, 0x0, 0x1c, 0x7,
+    0x0, 0x3, 0x80, 0xc0, 0x0, 0x70, 0x38, 0x0, 0x1c, 0x1f, 0x0, 0x1f,
+    0x87, 0xc0, 0x7, 0xe0, 0x40, 0x0, 0x20, 0x0,
+
+    /* U+731C */
+    0x0, 0x0, 0x60, 0x7, 0x18, 0x6, 0x0, 0x33, 0xbf, 0xff, 0xc3, 0xf3,
+    0xff, 0xfe, 0x1f, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0x1e, 0x1f, 0xff,
+    0x83, 0xe1, 0xff, 0xf8, 0x77, 0x0, 0x60, 0x6, 0x30, 0x7, 0x0, 0x3,
+    0x7f, 0xff, 0xe0, 0x71, 0xff, 0xfc, 0x7, 0x0, 0x0, 0x0, 0xf0, 0xff,
+    0xf0, 0x1f, 0x1f, 0xff, 0x83, 0xb9, 0xc0, 0x38, 0x3b, 0x9f, 0xff, 0x87,
+    0x39, 0xff, 0xf8, 0x63, 0x9c, 0x3, 0x80, 0x39, 0x80, 0x18, 0x3, 0x1f,
+    0xff, 0x80, 0x31, 0xff, 0xf8, 0x3, 0x18, 0x1, 0x80, 0x71, 0x80, 0x18,
+    0x3f, 0x18, 0xf, 0x83, 0xe1, 0x81, 0xf0, 0x10, 0x8, 0x1e, 0x0,
+
+    /* U+7334 */
+    0x0, 0x4, 0x0, 0x6, 0x18, 0xcf, 0xe0, 0x73, 0x8c, 0xff, 0x3, 0xf0,
+    0xc0, 0x30, 0x1f, 0x1c, 0x3, 0x80, 0xe1, 0x80, 0x38, 0x1e, 0x18, 0x3,
+    0x83, 0xe3, 0xbf, 0xfe, 0x76, 0x39, 0xff, 0xc6, 0x73, 0x84, 0x0, 0x3,
+    0x78, 0xc0, 0x0, 0x77, 0x9f, 0xfc, 0x7, 0x79, 0xff, 0xc0, 0xf1, 0x99,
+    0x80, 0x1f, 0x1b, 0x18, 0x3, 0xb1, 0x81, 0x80, 0x3b, 0x19, 0xff, 0xc7,
+    0x31, 0xbf, 0xfe, 0x63, 0x19, 0xff, 0xc0, 0x31, 0x83, 0xc0, 0x3, 0x18,
+    0x3e, 0x0, 0x31, 0x83, 0x60, 0x3, 0x18, 0x73, 0x80, 0x71, 0x8e, 0x1c,
+    0x3e, 0x19, 0xc1, 0xe3, 0xe1, 0xb8, 0xe, 0x10, 0x1b, 0x0, 0x0,
+
+    /* U+7344 */
+    0x0, 0x0, 0x4, 0x6, 0x18, 0x0, 0xe0, 0x73, 0x7f, 0x8e, 0x3, 0x73,
+    0xf0, 0xf8, 0x3e, 0x0, 0xc, 0xc1, 0xc7, 0xf8, 0xcc, 0x1c, 0xff, 0xcc,
+    0x43, 0xc7, 0xf8, 0xc0, 0x76, 0x0, 0xe, 0x6, 0x63, 0xf7, 0xfe, 0x6,
+    0x7f, 0xbf, 0xe0, 0x70, 0x0, 0xe0, 0x7, 0x0, 0xe, 0x0, 0xf7, 0xf8,
+    0xe0, 0x1f, 0x7f, 0x8e, 0x1, 0xb0, 0x0, 0xe0, 0x33, 0x0, 0xf, 0x7,
+    0x33, 0xf1, 0xb0, 0x43, 0x7f, 0x1b, 0x0, 0x36, 0x19, 0x90, 0x3, 0x61,
+    0xb1, 0x80, 0x76, 0x1b, 0x18, 0x7, 0x63, 0xb0, 0xc0, 0xe7, 0xff, 0xe,
+    0x3e, 0x3f, 0xe0, 0xe3, 0xc0, 0xc, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+734E */
+    0x0, 0x80, 0xc0, 0x3, 0xc, 0x1c, 0x0, 0x31, 0xc7, 0xff, 0xe3, 0x1d,
+    0xe8, 0x1c, 0x31, 0xf8, 0xc3, 0x83, 0xfc, 0xc7, 0xe0, 0xf, 0xc7, 0xf8,
+    0x0, 0x1c, 0xfc, 0x20, 0x1, 0xfe, 0x7, 0x7, 0xfd, 0xff, 0xfc, 0x7f,
+    0xdf, 0xff, 0xe1, 0x9c, 0x0, 0x70, 0x19, 0xc6, 0x7, 0x3, 0x9c, 0x71,
+    0xe0, 0x71, 0xc1, 0xbe, 0x6, 0xc, 0x40, 0xc0, 0x0, 0x86, 0x6, 0x0,
+    0x0, 0xe0, 0x60, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f,
+    0x0, 0x0, 0x1, 0xbc, 0x0, 0x0, 0x71, 0xe0, 0x0, 0x1f, 0xf, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc7, 0xf0, 0x0, 0xfe, 0x78, 0x0, 0x0, 0xe0,
+
+    /* U+7368 */
+    0x0, 0x0, 0x0, 0xe, 0x33, 0xff, 0xe0, 0xce, 0xff, 0xfe, 0x1f, 0x98,
+    0xcc, 0xe1, 0xf3, 0x11, 0x8c, 0x1c, 0x62, 0x31, 0x87, 0x8e, 0xe6, 0x71,
+    0xf1, 0xff, 0xfc, 0x76, 0xf, 0xff, 0xc, 0x61, 0xc0, 0x0, 0xc, 0x7f,
+    0xfe, 0x3, 0x9f, 0xff, 0xe0, 0x77, 0x9c, 0xe, 0x1e, 0xc3, 0x1, 0xc7,
+    0xc3, 0xfe, 0x39, 0xdc, 0xff, 0xe7, 0x3b, 0xb9, 0x8c, 0xee, 0x76, 0x31,
+    0x9d, 0x8e, 0xe7, 0x73, 0x81, 0x8f, 0xfe, 0x60, 0x30, 0x18, 0x8c, 0x6,
+    0x3, 0x19, 0x80, 0xc0, 0x7f, 0xb0, 0x3b, 0xff, 0xf6, 0x3f, 0x7e, 0x3,
+    0xc7, 0xc0, 0x0, 0xf8, 0x40, 0x0, 0x1c, 0x0,
+
+    /* U+738B */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+73A9 */
+    0x0, 0x0, 0x0, 0x7, 0xfc, 0xff, 0xf8, 0x7f, 0xcf, 0xff, 0x80, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xfe, 0x7f,
+    0xdf, 0xff, 0xe0, 0xe0, 0x31, 0xc0, 0x6, 0x3, 0x1c, 0x0, 0x60, 0x31,
+    0xc0, 0x6, 0x3, 0x1c, 0x0, 0x60, 0x31, 0xc0, 0x6, 0x3, 0x1c, 0x0,
+    0x60, 0x71, 0xc0, 0x7, 0xe6, 0x1c, 0x1, 0xfc, 0xe1, 0xc6, 0x7f, 0xe,
+    0x1c, 0x67, 0x81, 0xc1, 0xc6, 0x0, 0x78, 0x1f, 0xe0, 0xf, 0x0, 0xfe,
+    0x0, 0xe0, 0xf, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+73AB */
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x18, 0x0, 0x7f, 0xe1, 0x80, 0x7, 0xfe,
+    0x38, 0x0, 0x6, 0x3, 0x0, 0x0, 0x60, 0x30, 0x0, 0x6, 0x7, 0xff,
+    0xe0, 0x60, 0x7f, 0xfe, 0x6, 0xf, 0x3, 0x0, 0xe1, 0xf0, 0x30, 0x7f,
+    0xdb, 0x3, 0x7, 0xff, 0xb0, 0x30, 0x6, 0x3, 0x7, 0x0, 0x60, 0x18,
+    0x70, 0x6, 0x1, 0x86, 0x0, 0x60, 0x18, 0x60, 0x6, 0x1, 0xce, 0x0,
+    0x60, 0xd, 0xc0, 0x6, 0x0, 0x7c, 0x0, 0x7e, 0x7, 0x80, 0x1f, 0xc0,
+    0x78, 0x7, 0xf0, 0xf, 0xc0, 0x78, 0x3, 0xcf, 0x0, 0x0, 0xf8, 0x7c,
+    0x0, 0x7e, 0x3, 0xe0, 0x7, 0x80, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+73B2 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0xe, 0x0, 0x7f, 0xe0, 0xf0, 0x7, 0xfe,
+    0x1f, 0x80, 0x6, 0x1, 0x98, 0x0, 0x60, 0x38, 0xc0, 0x6, 0x7, 0xe,
+    0x0, 0x60, 0xe0, 0x78, 0x6, 0x1e, 0x3, 0xc0, 0x61, 0xff, 0xfe, 0xf,
+    0x3b, 0xfe, 0xe7, 0xff, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x1f, 0xff, 0x0, 0x61, 0xff, 0xf8, 0x6, 0x1, 0xc3, 0xc0,
+    0x60, 0x1c, 0x1c, 0x6, 0x1, 0xc1, 0xc0, 0x64, 0x1c, 0x1c, 0x7, 0xe1,
+    0xc1, 0xc3, 0xf8, 0x1c, 0x1c, 0x7e, 0x1, 0xc7, 0x87, 0x0, 0x1c, 0xf8,
+    0x0, 0x1, 0xce, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+73BB */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x6, 0x0, 0x7f, 0xc0, 0x60, 0x7, 0xfc,
+    0x6, 0x0, 0x6, 0x7, 0xff, 0x80, 0x61, 0xff, 0xfc, 0x6, 0x1c, 0x60,
+    0xc0, 0x61, 0x86, 0xc, 0x6, 0x18, 0x61, 0xc0, 0x61, 0x86, 0x18, 0x3f,
+    0x98, 0x60, 0x7, 0xfd, 0x86, 0x0, 0x1f, 0x1f, 0xff, 0x80, 0x61, 0xff,
+    0xf8, 0x6, 0x18, 0x1, 0x80, 0x61, 0x98, 0x38, 0x6, 0x19, 0x83, 0x0,
+    0x63, 0x9c, 0x60, 0x6, 0xb8, 0xce, 0x0, 0xfb, 0xe, 0xc0, 0x3f, 0x30,
+    0x78, 0x7, 0xc7, 0x7, 0x80, 0x60, 0xe0, 0xfe, 0x0, 0xc, 0x3c, 0xf8,
+    0x1, 0xcf, 0x87, 0xe0, 0x1, 0xe0, 0x1e, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+73C9 */
+    0x0, 0x7, 0xff, 0x7, 0xfc, 0xff, 0xfc, 0x7f, 0xde, 0x1, 0xc0, 0x61,
+    0xc0, 0xc, 0x6, 0x1c, 0x0, 0xc0, 0x61, 0xc0, 0xc, 0x6, 0x1c, 0x1,
+    0xc0, 0x61, 0xff, 0xfc, 0x6, 0x1f, 0xff, 0x83, 0xf9, 0xc1, 0x80, 0x7f,
+    0xdc, 0x18, 0x3, 0xf9, 0xc1, 0x80, 0x6, 0x1c, 0x1c, 0x0, 0x61, 0xff,
+    0xfe, 0x6, 0x1f, 0xff, 0xe0, 0x61, 0xc1, 0xc0, 0x6, 0x1c, 0xc, 0x0,
+    0x61, 0xc0, 0xc0, 0x6, 0xdc, 0xe, 0x0, 0xfd, 0xc0, 0x62, 0x7f, 0x9c,
+    0x76, 0x67, 0xc1, 0xff, 0x76, 0x60, 0x1f, 0xc7, 0xe0, 0x7, 0xf0, 0x3e,
+    0x0, 0x7c, 0x1, 0xc0, 0x0, 0x0, 0x8,
+
+    /* U+73ED */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x7f, 0xc3, 0x7f, 0xe7, 0xfc,
+    0x37, 0xfe, 0xe, 0x3, 0x6, 0x0, 0xe1, 0x30, 0x60, 0xe, 0x33, 0x6,
+    0x0, 0xe3, 0x30, 0x60, 0xe, 0x33, 0x6, 0x0, 0xe3, 0x30, 0x60, 0xe,
+    0x33, 0x6, 0x7, 0xfb, 0x30, 0x60, 0x3f, 0xb3, 0x7f, 0xe0, 0xe3, 0x37,
+    0xfc, 0xe, 0x33, 0x6, 0x0, 0xe6, 0x30, 0x60, 0xe, 0x67, 0x6, 0x0,
+    0xe0, 0x70, 0x60, 0xe, 0x6, 0x6, 0x0, 0xe0, 0x60, 0x60, 0xf, 0xce,
+    0x6, 0x3, 0xf9, 0xc0, 0x60, 0x7e, 0x3c, 0x6, 0x6, 0x3, 0x8f, 0xfe,
+    0x0, 0x71, 0xff, 0xe0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+73FE */
+    0x0, 0x7, 0xff, 0x7, 0xfe, 0xff, 0xf8, 0x7f, 0xee, 0x1, 0x80, 0x60,
+    0xc0, 0x1c, 0x6, 0xc, 0x1, 0xc0, 0x60, 0xff, 0xfc, 0x6, 0xf, 0xff,
+    0xc0, 0x60, 0xc0, 0x1c, 0x6, 0xc, 0x1, 0xc3, 0xfc, 0xc0, 0x1c, 0x7f,
+    0xcf, 0xff, 0xc0, 0x70, 0xff, 0xfc, 0x6, 0xc, 0x1, 0xc0, 0x60, 0xc0,
+    0x1c, 0x6, 0xf, 0x3, 0x80, 0x60, 0xff, 0xf8, 0x6, 0x3, 0xfe, 0x0,
+    0x60, 0x19, 0xc0, 0x7, 0xe3, 0x9c, 0x1, 0xfc, 0x39, 0xc0, 0x7f, 0x7,
+    0x1c, 0x67, 0x80, 0x71, 0xc6, 0x0, 0x1e, 0x1c, 0x60, 0xf, 0xc1, 0xfe,
+    0x1, 0xf0, 0xf, 0xc0, 0x8, 0x0, 0x0,
+
+    /* U+7403 */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x70, 0x7f, 0xc0, 0x67, 0x87, 0xfc,
+    0x6, 0x18, 0xe, 0x0, 0x60, 0x0, 0xe3, 0xff, 0xfc, 0xe, 0x3f, 0xff,
+    0xe0, 0xe1, 0xff, 0xf8, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0x7f,
+    0x90, 0x70, 0xc7, 0xf9, 0x87, 0x1c, 0xe, 0x1c, 0x73, 0x80, 0xe0, 0xe7,
+    0xb0, 0xe, 0x6, 0x7e, 0x0, 0xe0, 0x6, 0xc0, 0xe, 0x0, 0x6c, 0x0,
+    0xe0, 0x16, 0x60, 0xf, 0xc7, 0x67, 0x0, 0xfd, 0xe6, 0x38, 0x7f, 0x3c,
+    0x61, 0xc7, 0x87, 0x6, 0x1e, 0x40, 0x60, 0x60, 0xe0, 0x0, 0x6, 0x0,
+    0x0, 0x3, 0xe0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x3, 0x80, 0x0,
+
+    /* U+7406 */
+    0x0, 0x7, 0xff, 0x7, 0xfc, 0xff, 0xfc, 0x7f, 0xdc, 0x71, 0xc0, 0xe1,
+    0xc7, 0xc, 0x6, 0x18, 0x70, 0xc0, 0x61, 0xc7, 0x1c, 0x6, 0x1f, 0xff,
+    0xc0, 0x61, 0xff, 0xfc, 0x6, 0x18, 0x70, 0xc3, 0xf9, 0x87, 0xc, 0x7f,
+    0xdc, 0x70, 0xc3, 0xf9, 0xff, 0xfc, 0x6, 0xf, 0xff, 0xc0, 0x60, 0x3f,
+    0xe0, 0x6, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0,
+    0x61, 0xff, 0xfc, 0x6, 0xdf, 0xff, 0xc0, 0xfc, 0x7, 0x0, 0x7f, 0x80,
+    0x70, 0x7, 0xc0, 0x7, 0x0, 0x60, 0x0, 0x70, 0x0, 0xf, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xe0,
+
+    /* U+742A */
+    0x0, 0x4, 0x2, 0x0, 0x0, 0x60, 0x30, 0x7f, 0xc6, 0x3, 0x7, 0xfc,
+    0x60, 0x30, 0x6, 0x3f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x6, 0x6, 0x7,
+    0x0, 0x60, 0x60, 0x30, 0x6, 0x6, 0x3, 0x0, 0x60, 0x7f, 0xf0, 0x3f,
+    0x87, 0xff, 0x7, 0xfc, 0x60, 0x30, 0x3f, 0x86, 0x3, 0x0, 0x60, 0x7f,
+    0xf0, 0x6, 0x7, 0xff, 0x0, 0x60, 0x60, 0x70, 0x6, 0x6, 0x3, 0x0,
+    0x60, 0x60, 0x30, 0x6, 0x3f, 0xff, 0xe0, 0x6f, 0xff, 0xfe, 0xf, 0xc0,
+    0x0, 0x7, 0xf0, 0x30, 0xc0, 0x7c, 0x7, 0xf, 0x4, 0x1, 0xe0, 0x7c,
+    0x0, 0x7c, 0x3, 0xe0, 0x7, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7434 */
+    0x3f, 0xf3, 0xff, 0xc3, 0xff, 0xbf, 0xfc, 0x3, 0x0, 0x18, 0x0, 0x30,
+    0x1, 0x80, 0x1f, 0xf1, 0xff, 0x81, 0xff, 0x1f, 0xf8, 0x3, 0x80, 0x18,
+    0x0, 0x30, 0x1, 0x80, 0x3, 0xf1, 0xff, 0xc3, 0xff, 0x7f, 0xfe, 0x7f,
+    0x1e, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0x3c, 0x7,
+    0x80, 0x1f, 0xc0, 0x3f, 0x87, 0xff, 0xfe, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0x80,
+    0x0, 0x0, 0x38, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+7440 */
+    0x0, 0x0, 0x1, 0x80, 0x0, 0x7f, 0xf1, 0xfe, 0x7f, 0xfe, 0x3f, 0xcf,
+    0xf0, 0x0, 0xc0, 0x6, 0x0, 0x18, 0x0, 0xc0, 0x3, 0x3, 0xff, 0xe0,
+    0x60, 0xff, 0xfc, 0xc, 0x18, 0x61, 0x81, 0x83, 0xc, 0x30, 0x38, 0x71,
+    0x86, 0x3f, 0xcf, 0xff, 0xc3, 0xf8, 0xff, 0xf0, 0x18, 0x0, 0xc0, 0x3,
+    0x0, 0x18, 0x0, 0x60, 0xff, 0xfc, 0xc, 0x3f, 0xff, 0xc1, 0x86, 0xc,
+    0x18, 0x30, 0xc1, 0x93, 0x6, 0x18, 0x36, 0x60, 0xff, 0x7, 0xec, 0x7f,
+    0x6f, 0xfd, 0x9f, 0x8d, 0xf9, 0xb3, 0x1, 0x80, 0x16, 0x0, 0x30, 0x3,
+    0xc0, 0x6, 0x0, 0xf8, 0x0, 0xc0, 0xc, 0x0,
+
+    /* U+7444 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x7f, 0xc0, 0x70, 0x7, 0xfd,
+    0xff, 0xf8, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0x80, 0xe, 0xe, 0x30, 0x0,
+    0xe0, 0xe3, 0x0, 0x6, 0xe, 0x37, 0xff, 0x60, 0xe3, 0x3f, 0xe4, 0x3f,
+    0x80, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x3f, 0x8f, 0xff, 0x80, 0xe0, 0xe0,
+    0x38, 0xe, 0xc, 0x1, 0x80, 0xe0, 0xc0, 0x38, 0xe, 0xf, 0xff, 0x80,
+    0xe0, 0xc0, 0x38, 0xe, 0xc, 0x1, 0x80, 0xfc, 0xc0, 0x38, 0xf, 0xcf,
+    0xff, 0x87, 0xf0, 0x7f, 0xe0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfe,
+
+    /* U+744B */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xc, 0x0, 0x7f, 0xe7, 0xfe, 0x7, 0xfe,
+    0xff, 0xf0, 0x6, 0x1, 0xc3, 0x80, 0x60, 0x18, 0x38, 0x6, 0x3, 0x83,
+    0x80, 0x61, 0xff, 0xfe, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x3f,
+    0x8f, 0xff, 0x87, 0xfc, 0xc0, 0x18, 0x1f, 0x8c, 0x1, 0x80, 0x60, 0xff,
+    0xf8, 0x6, 0x7, 0xff, 0x80, 0x60, 0x1, 0x80, 0x6, 0x0, 0x1c, 0x0,
+    0x61, 0xff, 0xfc, 0x6, 0xf, 0xff, 0xc0, 0x6c, 0xc1, 0x80, 0xf, 0xcc,
+    0x18, 0x7, 0xf9, 0xff, 0xfe, 0x7c, 0x1f, 0xff, 0xe6, 0x1, 0x81, 0xc0,
+    0x0, 0x10, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+745C */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x7f, 0xc0, 0xf0, 0x7, 0xfc,
+    0x1f, 0x0, 0xe, 0x3, 0x98, 0x0, 0xe0, 0x70, 0xe0, 0xe, 0xe, 0x7,
+    0x0, 0xe1, 0xc0, 0x38, 0xe, 0x7f, 0xff, 0xe0, 0xe7, 0x7f, 0xce, 0xe,
+    0x40, 0x0, 0x7, 0xf8, 0xe0, 0xc, 0x3f, 0xbf, 0x88, 0xc0, 0xe3, 0x98,
+    0xcc, 0xe, 0x31, 0xcc, 0xc0, 0xe3, 0xfc, 0xcc, 0xe, 0x3f, 0xcc, 0xc0,
+    0xe3, 0x1c, 0xcc, 0xe, 0x31, 0xcc, 0xc0, 0xe3, 0xfc, 0xcc, 0xf, 0xbf,
+    0xcc, 0xc3, 0xfb, 0x1c, 0xcc, 0x7e, 0x31, 0xc0, 0xc7, 0x3, 0x1c, 0xc,
+    0x0, 0x31, 0x81, 0xc0, 0x3, 0x78, 0x7c, 0x0, 0x33, 0x7, 0x0,
+
+    /* U+745E */
+    0x0, 0x0, 0x20, 0x0, 0x1, 0x6, 0x8, 0x7f, 0xd8, 0x60, 0xc7, 0xfd,
+    0x86, 0xc, 0xe, 0x18, 0x60, 0xc0, 0xe1, 0x86, 0x1c, 0xe, 0x1f, 0xff,
+    0xc0, 0xe1, 0xff, 0xf8, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe,
+    0x3f, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3f, 0x80, 0xc0, 0x0, 0xe0, 0xc,
+    0x0, 0xe, 0x1, 0x80, 0x0, 0xe1, 0xff, 0xfc, 0xe, 0x1f, 0xff, 0xc0,
+    0xe3, 0x99, 0x8c, 0xe, 0x31, 0x98, 0xc0, 0xe3, 0x19, 0x8c, 0xf, 0xf1,
+    0x98, 0xc3, 0xfb, 0x19, 0x8c, 0x7e, 0x31, 0x98, 0xc6, 0x3, 0x19, 0x8c,
+    0x0, 0x31, 0x99, 0xc0, 0x3, 0x18, 0xbc, 0x0, 0x10, 0x1, 0x80,
+
+    /* U+7469 */
+    0x2, 0x0, 0x30, 0x0, 0xc0, 0xc, 0x3, 0x33, 0x33, 0x19, 0x9d, 0xcc,
+    0xce, 0x66, 0x66, 0x33, 0x19, 0x91, 0x9c, 0x80, 0xf0, 0x7, 0xc0, 0x77,
+    0x7, 0x38, 0x78, 0xf7, 0x87, 0xbc, 0xd, 0xc0, 0x60, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7e, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xfc, 0x80, 0x3, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x3f, 0xff, 0xf0, 0xf, 0xff, 0xfc, 0x0, 0x3, 0x18, 0x0,
+    0x0, 0xc7, 0x0, 0x0, 0x70, 0xc0, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0xf0,
+
+    /* U+746A */
+    0x0, 0x7, 0xff, 0xcf, 0xf9, 0xff, 0xfd, 0xff, 0x70, 0xc0, 0x3, 0xc,
+    0x18, 0x0, 0x61, 0x83, 0x0, 0xc, 0x3f, 0xff, 0x81, 0x87, 0xff, 0xe0,
+    0x30, 0xc1, 0x80, 0x6, 0x18, 0x30, 0x7, 0xf3, 0xff, 0xf1, 0xff, 0x7f,
+    0xff, 0xf, 0x8e, 0x18, 0x0, 0x61, 0x83, 0x0, 0xc, 0x38, 0x60, 0x1,
+    0x87, 0xff, 0xf0, 0x30, 0x7f, 0xff, 0x6, 0x0, 0x0, 0xe0, 0xc2, 0x0,
+    0x8c, 0x1e, 0xd9, 0xb3, 0x8f, 0xfb, 0x33, 0x77, 0xf7, 0x37, 0x6e, 0xf0,
+    0xc6, 0x65, 0x80, 0x18, 0xc0, 0x30, 0x3, 0x0, 0x1e, 0x0, 0x0, 0xf,
+    0x80, 0x0, 0x1, 0xe0,
+
+    /* U+7470 */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xc, 0x0, 0x7f, 0xc1, 0xc0, 0x7, 0xf8,
+    0xff, 0xf0, 0xe, 0x1f, 0xff, 0x80, 0xe3, 0x86, 0x1c, 0xe, 0x30, 0x60,
+    0xc0, 0xe3, 0x6, 0xc, 0xe, 0x3f, 0xff, 0xc0, 0xe3, 0xff, 0xfc, 0x3f,
+    0xb0, 0x60, 0xc7, 0xfb, 0x6, 0xc, 0xe, 0x30, 0x60, 0xc0, 0xe3, 0xff,
+    0xfc, 0xe, 0x1f, 0xff, 0x80, 0xe0, 0x67, 0x0, 0xe, 0x6, 0x72, 0x0,
+    0xe0, 0x67, 0x64, 0xe, 0x6, 0x76, 0x60, 0xfc, 0xe7, 0x7e, 0x3f, 0x8c,
+    0x7f, 0xe7, 0xe1, 0xc7, 0x0, 0x70, 0x38, 0x70, 0x60, 0x7, 0x87, 0x6,
+    0x1, 0xf0, 0x3f, 0xe0, 0x3c, 0x3, 0xfc, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+7483 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x7f, 0xc0, 0x70, 0x7, 0xfb,
+    0xff, 0xfe, 0xe, 0x1f, 0xff, 0xe0, 0xe0, 0x0, 0x0, 0xe, 0x1b, 0xc,
+    0x80, 0xe1, 0x9f, 0x9c, 0xe, 0x18, 0xf9, 0xc0, 0xe1, 0x9f, 0xdc, 0xe,
+    0x1b, 0x8d, 0xc7, 0xf9, 0x80, 0x1c, 0x3f, 0x9f, 0xff, 0x80, 0xe0, 0xff,
+    0xf0, 0xe, 0x0, 0xe0, 0x0, 0xe0, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0xc0,
+    0xe3, 0x8c, 0x1c, 0xe, 0x38, 0xc8, 0xc0, 0xe3, 0x98, 0xcc, 0xf, 0xf9,
+    0x8c, 0xc3, 0xfb, 0xff, 0xec, 0x7e, 0x3f, 0xe6, 0xc6, 0x3, 0x80, 0xc,
+    0x0, 0x38, 0x1, 0xc0, 0x3, 0x0, 0x7c, 0x0, 0x10, 0x7, 0x0,
+
+    /* U+74B0 */
+    0x0, 0x1f, 0xff, 0x87, 0xf9, 0xff, 0xfc, 0x7f, 0xb9, 0x8c, 0xc0, 0xe3,
+    0x18, 0xcc, 0xe, 0x39, 0x8c, 0xc0, 0xe1, 0xff, 0xfc, 0xe, 0xf, 0xff,
+    0x80, 0xe0, 0x0, 0x0, 0xe, 0x3f, 0xff, 0xe3, 0xfb, 0xff, 0xfe, 0x7f,
+    0x80, 0x0, 0x0, 0xe0, 0xff, 0xf0, 0xe, 0x1f, 0xff, 0xc0, 0xe1, 0x80,
+    0x1c, 0xe, 0x18, 0x0, 0xc0, 0xe1, 0xff, 0xfc, 0xe, 0x1f, 0xff, 0x80,
+    0xe0, 0x1f, 0x4, 0xf, 0xc3, 0x98, 0xe1, 0xfc, 0xf1, 0xbc, 0x7f, 0x3f,
+    0xf, 0x7, 0x87, 0x30, 0x60, 0x0, 0x43, 0xb7, 0x80, 0x0, 0x7f, 0x3e,
+    0x0, 0x1f, 0xc0, 0xe0, 0x1, 0x80, 0x4,
+
+    /* U+74DC */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x1f, 0xff, 0x80, 0x7f,
+    0xff, 0xe0, 0xf, 0xfe, 0xe, 0x0, 0xe0, 0xe0, 0xe0, 0xc, 0xe, 0xe,
+    0x0, 0xc0, 0xe0, 0xe0, 0xc, 0xe, 0x6, 0x0, 0xc0, 0xe0, 0x60, 0xc,
+    0xe, 0x6, 0x0, 0xc0, 0xe0, 0x60, 0xc, 0xe, 0x6, 0x0, 0xc0, 0xe0,
+    0x60, 0xc, 0xe, 0x6, 0x0, 0xc0, 0xe0, 0x70, 0xc, 0xe, 0x7, 0x1,
+    0xc0, 0xe0, 0x30, 0x18, 0xe, 0x63, 0x1, 0x80, 0xe7, 0x38, 0x38, 0xe,
+    0x33, 0x83, 0x80, 0xef, 0x98, 0x30, 0xff, 0xf9, 0xc7, 0x1f, 0xf9, 0xce,
+    0x71, 0xe0, 0xc, 0xe6, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+74E6 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x1c, 0x3, 0x80, 0x1,
+    0x80, 0x18, 0x0, 0x18, 0x1, 0x80, 0x1, 0x98, 0x18, 0x0, 0x19, 0xc1,
+    0x80, 0x3, 0x8e, 0x18, 0x0, 0x38, 0x71, 0x80, 0x3, 0x3, 0x38, 0x0,
+    0x30, 0x3, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0x86, 0x7, 0x7,
+    0xf0, 0x60, 0x7f, 0xff, 0x86, 0x7f, 0xfc, 0x3d, 0xe7, 0xf8, 0x3, 0xfc,
+    0x70, 0x0, 0x1f, 0x80,
+
+    /* U+751F */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x6, 0x7, 0x0, 0x0, 0x60,
+    0x70, 0x0, 0x6, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x0, 0xf, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xfc, 0xc, 0x7, 0x0, 0x1, 0xc0, 0x70, 0x0, 0x18,
+    0x7, 0x0, 0x3, 0x80, 0x70, 0x0, 0x38, 0x7, 0x0, 0x7, 0x0, 0x70,
+    0x0, 0x73, 0xff, 0xff, 0x6, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0x0, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+7522 */
+    0x0, 0x4, 0x0, 0x0, 0x1, 0xc0, 0x0, 0xff, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xe1, 0xff, 0xff, 0xf0, 0x7, 0xc0, 0x78, 0x0, 0x7f, 0xfe, 0x0,
+    0x0, 0xfe, 0x0, 0x7, 0xfd, 0xfe, 0x0, 0xf8, 0x3, 0xc0, 0x18, 0x0,
+    0x18, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x70, 0x82, 0x0, 0xc,
+    0x30, 0xc0, 0x1, 0x8f, 0xff, 0xf8, 0x31, 0xff, 0xff, 0x86, 0x70, 0x70,
+    0x0, 0xdc, 0xc, 0x0, 0x1f, 0x1, 0xc0, 0x3, 0x1f, 0xff, 0xe0, 0xe1,
+    0xff, 0xfc, 0x1c, 0x0, 0xc0, 0x3, 0x80, 0x18, 0x0, 0x67, 0xff, 0xff,
+    0xdd, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7528 */
+    0x7, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xe1, 0xe0, 0x60, 0x38, 0x70, 0x18,
+    0x6, 0x1c, 0x6, 0x1, 0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x18, 0x7f,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0x87, 0x1, 0x80, 0x61, 0xc0, 0x60, 0x18,
+    0x70, 0x18, 0x6, 0x18, 0x6, 0x1, 0x86, 0x1, 0x80, 0x61, 0xff, 0xff,
+    0xf8, 0x7f, 0xff, 0xfe, 0x18, 0x6, 0x1, 0x86, 0x1, 0x80, 0x61, 0x80,
+    0x60, 0x18, 0xe0, 0x18, 0x6, 0x38, 0x6, 0x1, 0x8c, 0x1, 0x80, 0x67,
+    0x0, 0x60, 0x19, 0xc0, 0x18, 0x7e, 0x60, 0x6, 0x1f, 0x80, 0x0, 0x3,
+    0x0,
+
+    /* U+7530 */
+    0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x70, 0x3c, 0xe, 0x60, 0x18, 0x6,
+    0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6,
+    0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe,
+    0x7f, 0xff, 0xfe, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6,
+    0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6, 0x60, 0x18, 0x6,
+    0x70, 0x18, 0xe, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+7531 */
+    0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x18, 0x0, 0x3f, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x78, 0x3c, 0xf,
+    0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x60, 0x18, 0x7,
+    0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff,
+    0x60, 0x1c, 0x7, 0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x60, 0x18, 0x7,
+    0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x60, 0x18, 0x7, 0x7f, 0xff, 0xff,
+    0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
+
+    /* U+7532 */
+    0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xdc, 0x3, 0x0,
+    0xee, 0x1, 0x80, 0x77, 0x0, 0xc0, 0x3b, 0x80, 0x60, 0x1d, 0xc0, 0x30,
+    0xe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xb8, 0x6, 0x1, 0xdc, 0x3,
+    0x0, 0xee, 0x1, 0x80, 0x77, 0x0, 0xc0, 0x3b, 0x80, 0x60, 0x1c, 0xe0,
+    0x78, 0x1e, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x0, 0x6, 0x0, 0x0,
+    0x3, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x30, 0x0, 0x0, 0x18, 0x0, 0x0, 0xc, 0x0, 0x0,
+
+    /* U+7533 */
+    0x0, 0x10, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x38, 0x0,
+    0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7,
+    0xe0, 0x18, 0x7, 0xe0, 0x18, 0x7, 0x70, 0x3c, 0xe, 0x7f, 0xff, 0xfe,
+    0x1f, 0xff, 0xf8, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+7537 */
+    0xf, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xe1, 0xc0, 0xe0, 0x38, 0x60, 0x18,
+    0x6, 0x18, 0x6, 0x1, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf8, 0x60,
+    0x18, 0x6, 0x18, 0x6, 0x1, 0x86, 0x1, 0x80, 0x61, 0xff, 0xff, 0xf8,
+    0x3f, 0xff, 0xfc, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x80, 0xe, 0x0, 0x70, 0x3,
+    0x0, 0x1c, 0x0, 0xc0, 0x6, 0x0, 0x70, 0x1, 0x80, 0x78, 0x0, 0x60,
+    0x7c, 0x0, 0x39, 0xfc, 0x1, 0xfc, 0x7c, 0x0, 0x7f, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+7538 */
+    0x1, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x87, 0x0, 0x0, 0x31,
+    0xc0, 0x0, 0x6, 0x38, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x19, 0xbf, 0xff,
+    0xc3, 0x6, 0xc, 0x18, 0x60, 0xc1, 0x83, 0xc, 0x18, 0x30, 0x61, 0x83,
+    0x6, 0xc, 0x30, 0x7f, 0xff, 0x86, 0xf, 0xff, 0xf0, 0xc1, 0x83, 0x6,
+    0x18, 0x30, 0x60, 0xc7, 0x6, 0xc, 0x18, 0xe0, 0xc1, 0x83, 0x1c, 0x1f,
+    0xff, 0xe3, 0x1, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3f,
+    0x80, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+754C */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81, 0xc0,
+    0x60, 0x38, 0x18, 0x6, 0x1, 0x81, 0xc0, 0xe0, 0x38, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x18, 0x6, 0x1, 0x81, 0xc0, 0x60, 0x18, 0x1f,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0x80, 0x0, 0x7, 0x9c,
+    0x0, 0x0, 0xf0, 0xf0, 0x0, 0x3e, 0x3, 0xe0, 0x1f, 0x80, 0x1f, 0xc7,
+    0xec, 0x3, 0x7e, 0x78, 0xc0, 0x31, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc0,
+    0x30, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x30, 0x0, 0x78, 0x3, 0x0,
+    0x1f, 0x0, 0x30, 0x3, 0xe0, 0x3, 0x0, 0x18, 0x0, 0x30, 0x0,
+
+    /* U+7559 */
+    0x0, 0x30, 0x0, 0x0, 0x7e, 0x7f, 0xf0, 0x7f, 0x9f, 0xff, 0x1f, 0x1,
+    0xff, 0xf3, 0x80, 0x6, 0xe, 0x70, 0x80, 0xc1, 0x8e, 0x18, 0x18, 0x31,
+    0xc3, 0x83, 0x6, 0x38, 0x30, 0xe0, 0xc3, 0x3f, 0x38, 0x38, 0xff, 0x6e,
+    0xf, 0x3f, 0x3, 0x87, 0xc7, 0x80, 0xe0, 0xf0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc, 0x1c, 0x6, 0x3, 0x83, 0x0, 0xc0,
+    0x30, 0x60, 0x18, 0x6, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x30,
+    0xc, 0x3, 0x6, 0x1, 0x80, 0x60, 0xe0, 0x30, 0x1c, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7576 */
+    0x0, 0x0, 0x0, 0x1, 0x3, 0x0, 0x0, 0xe0, 0xc0, 0xc0, 0x1c, 0x30,
+    0x70, 0x7, 0xc, 0x18, 0x0, 0x83, 0x4, 0x7, 0xff, 0xff, 0xf9, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x1, 0xf8, 0xff, 0xfc, 0x7e, 0x7f, 0xff, 0x9f,
+    0x98, 0x0, 0x67, 0x6, 0x0, 0x18, 0x1, 0xc0, 0xe, 0x0, 0x7f, 0xff,
+    0x80, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xf0, 0xc0, 0x30, 0xc, 0x30, 0xc, 0x3, 0xf, 0xff, 0xff, 0xc3,
+    0xff, 0xff, 0xf0, 0xc0, 0x30, 0xc, 0x30, 0xc, 0x3, 0xf, 0xff, 0xff,
+    0xc3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+
+    /* U+7586 */
+    0x7f, 0x9f, 0xff, 0xc7, 0xfd, 0xff, 0xfe, 0x1, 0xc0, 0x0, 0x0, 0xc,
+    0x7f, 0xf8, 0x0, 0xcf, 0xff, 0xc0, 0x1c, 0xc3, 0xc, 0x3f, 0xcf, 0xff,
+    0xc3, 0xf8, 0xff, 0xfc, 0x30, 0xc, 0x31, 0xc6, 0x0, 0xff, 0xf8, 0x60,
+    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x3f, 0xdf, 0xff, 0xe0, 0xc, 0x0,
+    0x0, 0x18, 0xc7, 0xff, 0x81, 0x8c, 0xff, 0xfc, 0x7e, 0xcc, 0x30, 0xc1,
+    0xcc, 0xff, 0xfc, 0x18, 0xcf, 0xff, 0xc1, 0x8c, 0xc3, 0xc, 0x1e, 0xcf,
+    0xff, 0xc7, 0xec, 0x7f, 0xf8, 0x41, 0xc0, 0x0, 0x0, 0x79, 0xff, 0xfe,
+    0xf, 0x9f, 0xff, 0xe0, 0x40, 0x0, 0x0,
+
+    /* U+7591 */
+    0x10, 0x0, 0x0, 0x3, 0x0, 0x3f, 0xf0, 0x30, 0xf7, 0xff, 0xc3, 0xfe,
+    0x0, 0x3c, 0x3f, 0x0, 0x3, 0x83, 0x1, 0x8e, 0xe0, 0x30, 0x18, 0x7c,
+    0x3, 0x87, 0x83, 0x80, 0x3f, 0xf0, 0x1c, 0x0, 0xfc, 0x0, 0xc0, 0x18,
+    0xf, 0xff, 0xe1, 0x80, 0x7f, 0xfe, 0x3f, 0xf0, 0x38, 0xc3, 0xff, 0x3,
+    0x9c, 0x63, 0x3, 0x39, 0x80, 0x30, 0x33, 0x80, 0x3, 0x3, 0x38, 0x7,
+    0xff, 0xb3, 0xfc, 0x3f, 0xf7, 0x3f, 0xc0, 0x70, 0x63, 0x80, 0x7, 0x87,
+    0x38, 0x0, 0xee, 0xfb, 0x80, 0x1c, 0x6d, 0xf8, 0x3, 0x81, 0xcf, 0xe0,
+    0x70, 0x38, 0x3f, 0xe6, 0x3, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+75AB */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x70, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x6, 0x61, 0xff, 0x0, 0x36, 0x1f, 0xf8, 0x3, 0x61, 0x83, 0x84, 0x6,
+    0x18, 0x18, 0xe0, 0x63, 0x81, 0x8e, 0x6, 0x38, 0x1d, 0xc0, 0xe7, 0x1,
+    0xfc, 0x3e, 0xe0, 0x7, 0x7, 0xe0, 0x0, 0x0, 0x6e, 0x7f, 0xff, 0x0,
+    0xe7, 0xff, 0xf0, 0xc, 0x0, 0x7, 0x0, 0xc1, 0xc0, 0xe0, 0x1c, 0xe,
+    0x3c, 0x1, 0x80, 0x77, 0x0, 0x38, 0x3, 0xe0, 0x7, 0x0, 0xff, 0xc0,
+    0x71, 0xfe, 0x3f, 0xe6, 0x3f, 0x0, 0xfe, 0x1, 0x80, 0x0, 0x60,
+
+    /* U+75B9 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x70, 0x0, 0x0, 0x66, 0x1, 0xc0,
+    0x6, 0x60, 0x3c, 0x0, 0x36, 0x7, 0xe0, 0x3, 0x60, 0xe7, 0x80, 0x6,
+    0x1c, 0x3e, 0x0, 0x67, 0x80, 0xf8, 0x6, 0xf0, 0xe3, 0xe0, 0xec, 0x1c,
+    0xe, 0x3e, 0x7, 0x80, 0x7, 0xe1, 0xe0, 0xc0, 0x6e, 0x78, 0x3c, 0x0,
+    0xe6, 0x7, 0x80, 0xc, 0x3, 0xe0, 0x0, 0xc0, 0xf8, 0x1c, 0x1c, 0x3e,
+    0x7, 0x81, 0x83, 0x1, 0xf0, 0x38, 0x0, 0x7e, 0x3, 0x80, 0x7f, 0x0,
+    0x70, 0x3f, 0xc0, 0x6, 0xf, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0,
+
+    /* U+75DB */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x60, 0x0, 0x0, 0x66, 0xff, 0xff,
+    0x86, 0x6f, 0xff, 0xf8, 0x36, 0x4, 0xf, 0x83, 0x60, 0x73, 0xe0, 0x6,
+    0x3, 0xf0, 0x0, 0x60, 0xf, 0x0, 0x6, 0x7f, 0xff, 0x80, 0xe7, 0xff,
+    0xfc, 0x3e, 0xe0, 0xc1, 0xc7, 0xee, 0xc, 0xc, 0x6e, 0xff, 0xff, 0xc0,
+    0xcf, 0xff, 0xfc, 0xc, 0xe0, 0xc0, 0xc0, 0xce, 0xc, 0xc, 0x1c, 0xff,
+    0xff, 0xc1, 0x8f, 0xff, 0xfc, 0x38, 0xe0, 0xc0, 0xc3, 0x8e, 0xc, 0xc,
+    0x70, 0xe0, 0xc1, 0xc7, 0xe, 0xc, 0xf8, 0x40, 0x40, 0x7, 0x0,
+
+    /* U+75F2 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x60, 0x0, 0x0, 0x66, 0x10, 0x8,
+    0x6, 0x61, 0x0, 0xc0, 0x36, 0x10, 0xc, 0x3, 0x6f, 0xe7, 0xfc, 0x7,
+    0xff, 0xff, 0xe0, 0x63, 0x87, 0xfc, 0x6, 0x10, 0xc, 0x0, 0xe9, 0x24,
+    0xd8, 0x3e, 0xd2, 0x4d, 0x87, 0xed, 0x24, 0xd8, 0x6e, 0x92, 0x4d, 0x80,
+    0xc9, 0x24, 0xd8, 0xc, 0x92, 0x4d, 0x80, 0xd9, 0x2c, 0xd8, 0x19, 0x92,
+    0xcd, 0xa1, 0x99, 0x2c, 0xda, 0x3b, 0x91, 0xcd, 0xe7, 0x31, 0x18, 0xde,
+    0x72, 0x11, 0x8c, 0xc6, 0x1, 0x0, 0xc0, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+760B */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x60, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x6, 0x67, 0xff, 0xf0, 0x36, 0x7f, 0xff, 0x3, 0x6e, 0x0, 0x30, 0x6,
+    0xc7, 0xfb, 0x0, 0x6d, 0xff, 0x30, 0x6, 0xc1, 0x83, 0x0, 0xec, 0x18,
+    0x30, 0x3e, 0xcf, 0xfb, 0x7, 0xed, 0xff, 0xb0, 0x6e, 0xd9, 0x8f, 0x0,
+    0xcd, 0x98, 0xf0, 0xc, 0xdd, 0x9b, 0x80, 0xcc, 0xff, 0xb8, 0x1c, 0xc3,
+    0xf1, 0xa1, 0x9c, 0x19, 0x9a, 0x39, 0x81, 0x9d, 0xa7, 0x39, 0xff, 0xde,
+    0x73, 0x3f, 0xfe, 0xe6, 0x31, 0x0, 0x6e, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+761F */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x60, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x6, 0x67, 0xff, 0xf0, 0x36, 0x70, 0x3, 0x83, 0x66, 0xc, 0x18, 0x6,
+    0x63, 0xc1, 0x80, 0x66, 0x7f, 0x98, 0x6, 0x6e, 0x1d, 0x80, 0xe6, 0x0,
+    0x38, 0x3e, 0x7f, 0xff, 0x87, 0xe3, 0xff, 0xf0, 0x66, 0x0, 0x0, 0x0,
+    0xe3, 0xff, 0xf0, 0xc, 0xff, 0xff, 0x80, 0xce, 0x63, 0x1c, 0x1c, 0xc6,
+    0x31, 0xc1, 0x8c, 0x63, 0x1c, 0x38, 0xc6, 0x31, 0xc7, 0xc, 0x63, 0x1c,
+    0x73, 0xff, 0xff, 0xe6, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7626 */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x3f,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xe6, 0x60, 0xc, 0x0, 0x66, 0xc, 0xcf,
+    0x6, 0x67, 0xcd, 0xf8, 0x76, 0xf0, 0xc1, 0xc3, 0x6c, 0xc, 0x1c, 0x26,
+    0xfc, 0xdf, 0xc0, 0x6f, 0xed, 0xfc, 0x6, 0xe0, 0xc1, 0xc0, 0xee, 0xc,
+    0x1c, 0x3e, 0xfe, 0xdf, 0xc7, 0xe7, 0xcd, 0xf8, 0x6e, 0x0, 0xc0, 0x0,
+    0xe7, 0xff, 0xf0, 0xc, 0xff, 0xff, 0x80, 0xc0, 0x0, 0x38, 0x1c, 0x18,
+    0x7, 0x1, 0xc0, 0xe1, 0xe0, 0x38, 0x7, 0xf8, 0x7, 0x80, 0x3f, 0x80,
+    0x70, 0xff, 0xff, 0xc6, 0x3f, 0xc0, 0xfe, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+767B */
+    0x0, 0x2, 0x0, 0x1, 0xff, 0xb1, 0xc0, 0x1f, 0xfb, 0x98, 0x0, 0x3,
+    0x9f, 0x8, 0x8, 0x31, 0xe3, 0x80, 0xe7, 0xe, 0x70, 0x7, 0xe0, 0x7e,
+    0x0, 0x3c, 0x3, 0xc0, 0x7, 0x80, 0x1e, 0x1, 0xff, 0xff, 0xfc, 0x3d,
+    0xff, 0xf9, 0xe7, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xc, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff,
+    0xfc, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x0, 0xe, 0x7, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+767C */
+    0x0, 0x2, 0x0, 0x1, 0xff, 0xb0, 0xc0, 0x1f, 0xfb, 0x98, 0x0, 0x1,
+    0x9f, 0x8, 0x8, 0x30, 0xe1, 0x80, 0xe6, 0xf, 0x78, 0x7, 0xc0, 0x3e,
+    0x0, 0x78, 0x1, 0xe0, 0x1f, 0x0, 0xf, 0xc7, 0xc0, 0xf, 0xbe, 0x7f,
+    0xf1, 0xfc, 0xc0, 0x7f, 0x39, 0xc0, 0x0, 0x33, 0xc, 0x0, 0x3, 0x30,
+    0xc6, 0xf, 0xf7, 0xf, 0xc1, 0xfe, 0xe0, 0xfc, 0x18, 0x0, 0x0, 0x1,
+    0x80, 0x7f, 0xf0, 0x38, 0x7, 0xff, 0x81, 0xfe, 0x10, 0x70, 0xf, 0xf1,
+    0x8e, 0x0, 0x7, 0x1d, 0xc0, 0x0, 0x70, 0xf8, 0x0, 0x6, 0xf, 0x80,
+    0x0, 0xe7, 0xff, 0xc0, 0xfe, 0xf8, 0x7e, 0x7, 0x8c, 0x0, 0xc0,
+
+    /* U+767D */
+    0x0, 0x10, 0x0, 0x0, 0x30, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0,
+    0x0, 0xf0, 0x0, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x70, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x70, 0x0, 0x6, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x60, 0x0, 0x6,
+    0x60, 0x0, 0x6, 0x60, 0x0, 0x6, 0x70, 0x0, 0x6, 0x7f, 0xff, 0xfe,
+    0x3f, 0xff, 0xfe, 0xf, 0xff, 0xf8,
+
+    /* U+767E */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0x1c,
+    0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0,
+    0x38, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81,
+    0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0,
+    0x3, 0x81, 0xc0, 0x0, 0x38, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0,
+    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7684 */
+    0x6, 0x0, 0x80, 0x1, 0x80, 0x60, 0x0, 0x60, 0x18, 0x0, 0x38, 0xe,
+    0x0, 0xe, 0x3, 0x80, 0x1f, 0xf0, 0xff, 0xe7, 0xfe, 0x7f, 0xff, 0xc3,
+    0x98, 0x7, 0xe0, 0xee, 0x1, 0xf8, 0x1b, 0x0, 0x7e, 0x6, 0xc0, 0x1f,
+    0x81, 0x80, 0x7, 0xe0, 0x61, 0x1, 0xf8, 0x18, 0xe0, 0x7f, 0xfe, 0x1c,
+    0x1f, 0xff, 0x87, 0x7, 0xe0, 0xe0, 0xe1, 0xf8, 0x18, 0x18, 0x7e, 0x6,
+    0x6, 0x1f, 0x81, 0x80, 0x6, 0xe0, 0x60, 0x1, 0xb8, 0x18, 0x0, 0x6e,
+    0x6, 0x0, 0x1b, 0x83, 0x80, 0xe, 0x7f, 0xe0, 0x3f, 0x9f, 0xf0, 0x1f,
+    0xc0, 0x0, 0x3, 0x80,
+
+    /* U+7687 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0xff,
+    0xff, 0xf0, 0x1e, 0x0, 0x7, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3,
+    0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1c,
+    0x0, 0x3, 0x80, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+76AE */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0xf, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc, 0x1c, 0x7, 0x1,
+    0xc1, 0xc0, 0x70, 0x1c, 0x1c, 0x7, 0x3, 0x81, 0xc0, 0x70, 0x30, 0x1c,
+    0x7, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0x1, 0xc0, 0x0,
+    0x70, 0x1c, 0x0, 0x7, 0x1, 0x83, 0x0, 0xe0, 0x18, 0x38, 0xc, 0x1,
+    0x81, 0xc1, 0xc0, 0x18, 0x1c, 0x38, 0x1, 0x80, 0xe7, 0x0, 0x38, 0x7,
+    0xe0, 0x3, 0x0, 0x3e, 0x0, 0x30, 0xf, 0xf8, 0x7, 0x7, 0xe7, 0xf8,
+    0x63, 0xf8, 0x1f, 0xe6, 0x3e, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+76CA */
+    0x3, 0x0, 0x18, 0x0, 0x38, 0x3, 0x80, 0x3, 0x80, 0x38, 0x0, 0x1c,
+    0x3, 0x0, 0x0, 0x80, 0x70, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0xe, 0x7, 0x0, 0x1, 0xc0, 0x30, 0x0, 0x38, 0x1, 0x80, 0x3,
+    0x80, 0x1c, 0x0, 0xf0, 0x0, 0xe0, 0x1e, 0x0, 0x7, 0x83, 0xc0, 0x0,
+    0x3c, 0x7b, 0xff, 0xfc, 0xe6, 0xff, 0xff, 0xf6, 0xe, 0x71, 0xc7, 0x0,
+    0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30,
+    0xc3, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+76D2 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0x79, 0xc0, 0x0, 0x1e, 0xf, 0x0, 0x7, 0xc0, 0x3e,
+    0x1, 0xf8, 0x3, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x1e, 0x40,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x7, 0xff, 0xfe, 0x0, 0x60, 0x0,
+    0x60, 0x6, 0x0, 0x6, 0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x1c, 0x30, 0xc3, 0x87, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+76DB */
+    0x0, 0x1, 0x4, 0x0, 0x0, 0x18, 0xe0, 0x0, 0x1, 0x86, 0x0, 0xff,
+    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0x80, 0x18, 0x0, 0x18, 0x1, 0xc1,
+    0x1, 0xff, 0xc, 0x70, 0x1f, 0xf8, 0xc7, 0x1, 0x83, 0x8e, 0xe0, 0x18,
+    0x18, 0x7c, 0x23, 0x83, 0x87, 0x86, 0x39, 0xf0, 0xf8, 0x63, 0x3e, 0x7f,
+    0xee, 0x70, 0xf, 0x8f, 0xc7, 0x0, 0xe0, 0x3c, 0x60, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30,
+    0xc3, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+76DF */
+    0x1f, 0xc1, 0xff, 0x3, 0xfe, 0x3f, 0xf8, 0x38, 0x63, 0x81, 0xc3, 0x6,
+    0x30, 0xc, 0x30, 0x63, 0xff, 0xc3, 0xfe, 0x3f, 0xfc, 0x3f, 0xe3, 0x1,
+    0xc3, 0x6, 0x30, 0xc, 0x30, 0x63, 0x1, 0xc3, 0x6, 0x7f, 0xfc, 0x38,
+    0xe7, 0x1, 0xc3, 0xfe, 0x60, 0xc, 0xf, 0xce, 0x1, 0xc0, 0x1, 0xc0,
+    0xf8, 0x0, 0x18, 0xf, 0x80, 0x1, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30,
+    0xc3, 0x0, 0xc3, 0xc, 0x30, 0x1c, 0x30, 0xc3, 0x87, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+76E3 */
+    0x0, 0x0, 0x30, 0x1, 0xff, 0xe7, 0x0, 0x3f, 0xfe, 0x70, 0x3, 0x8c,
+    0xe, 0x0, 0x30, 0xc0, 0xff, 0xe3, 0xff, 0x9f, 0xfe, 0x3f, 0xfd, 0xc0,
+    0x3, 0x1, 0xf8, 0x0, 0x30, 0x1f, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x3f,
+    0xf8, 0x0, 0x3, 0xc, 0xf, 0xfc, 0x30, 0xc0, 0xff, 0xc3, 0xff, 0xc0,
+    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30,
+    0xc3, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+76F4 */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0xf, 0xff, 0xe0, 0x10, 0xff, 0xff, 0x3, 0x1c, 0x0, 0x70, 0x39,
+    0x80, 0x3, 0x3, 0x9f, 0xff, 0xf0, 0x39, 0xff, 0xff, 0x3, 0x9c, 0x0,
+    0x30, 0x39, 0x80, 0x3, 0x3, 0x9f, 0xff, 0xf0, 0x39, 0xff, 0xff, 0x3,
+    0x9c, 0x0, 0x30, 0x39, 0xc0, 0x3, 0x3, 0x9e, 0x0, 0x70, 0x38, 0xff,
+    0xff, 0x3, 0x83, 0xff, 0xc0, 0x38, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xfe,
+
+    /* U+76F8 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0xf, 0xff, 0x1, 0x83,
+    0xff, 0xe0, 0x30, 0x70, 0xe, 0x6, 0xe, 0x1, 0xcf, 0xfd, 0xc0, 0x3b,
+    0xff, 0xb8, 0x7, 0x7, 0x87, 0x0, 0xe0, 0xe0, 0xff, 0xfc, 0x1c, 0x1f,
+    0xff, 0x87, 0xc3, 0x80, 0x70, 0xfc, 0x70, 0xe, 0x3e, 0xce, 0x1, 0xc6,
+    0xdd, 0xc0, 0x39, 0xd9, 0xb8, 0x7, 0x33, 0x17, 0xff, 0xee, 0x60, 0xff,
+    0xfd, 0x8c, 0x1c, 0x3, 0x81, 0x83, 0x80, 0x70, 0x30, 0x70, 0xe, 0x6,
+    0xe, 0x1, 0xc0, 0xc1, 0xc0, 0x38, 0x18, 0x3c, 0xf, 0x3, 0x3, 0xff,
+    0xc0, 0x60, 0x3f, 0xf0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+7709 */
+    0x7, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x70, 0x1c, 0x7, 0xc, 0x3,
+    0x0, 0xe1, 0x80, 0x60, 0x1c, 0x38, 0xe, 0x3, 0x87, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xf0, 0x18, 0x0, 0x0, 0x3, 0x7, 0xff, 0xc0, 0x63, 0xff,
+    0xfe, 0xc, 0x70, 0x1, 0xc1, 0x8c, 0x0, 0x18, 0x31, 0x80, 0x3, 0x6,
+    0x3f, 0xff, 0xe0, 0xc7, 0xff, 0xfc, 0x38, 0xc0, 0x1, 0x87, 0x18, 0x0,
+    0x30, 0xe3, 0xff, 0xfe, 0x18, 0x7f, 0xff, 0xc3, 0xc, 0x0, 0x18, 0xe1,
+    0x80, 0x3, 0x1c, 0x30, 0x0, 0xe3, 0x7, 0xff, 0xfc, 0x40, 0x7f, 0xff,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+770B */
+    0x0, 0x0, 0x1, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x1, 0xf9,
+    0xe0, 0x0, 0x0, 0x1c, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
+    0x80, 0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x1c, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x1, 0xf8, 0x0, 0x30, 0x3b, 0x80, 0x3, 0x7,
+    0x3f, 0xff, 0xf0, 0x63, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0xff,
+    0xff, 0x0, 0x3f, 0xff, 0xf0, 0x3, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30,
+    0x1, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+771F */
+    0x4, 0x0, 0x0, 0x1, 0x80, 0x7f, 0x80, 0x3f, 0xff, 0xe0, 0x7, 0xf8,
+    0x1, 0x80, 0xe0, 0x0, 0x30, 0x1f, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x2, 0x3f, 0xff, 0xc0, 0xe6, 0x0,
+    0x1c, 0x1c, 0xe0, 0x3, 0x83, 0x9f, 0xff, 0xf0, 0x73, 0x0, 0xe, 0xe,
+    0x60, 0x1, 0xc1, 0xcf, 0xff, 0xf8, 0x39, 0x80, 0x7, 0x7, 0x30, 0x0,
+    0xe0, 0xe7, 0xff, 0xf8, 0x1c, 0x3f, 0xfe, 0x3, 0xc0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x83, 0xff, 0xff, 0xf0, 0x7, 0x3, 0x80, 0x1f, 0xe0, 0x7f,
+    0x8f, 0xf0, 0x3, 0xfd, 0xc0, 0x0, 0x3, 0x0,
+
+    /* U+7720 */
+    0x1e, 0x7, 0xfe, 0xf, 0xe3, 0xff, 0xf1, 0xce, 0x70, 0xe, 0x30, 0xcc,
+    0x0, 0xc6, 0x19, 0x80, 0x18, 0xc3, 0x30, 0x3, 0x18, 0x66, 0x0, 0xe3,
+    0xfc, 0xff, 0xfc, 0x7f, 0x9f, 0xff, 0xc, 0x33, 0x7, 0x1, 0x86, 0x60,
+    0xe0, 0x30, 0xcc, 0x1c, 0x6, 0x19, 0x83, 0x80, 0xc3, 0x3f, 0xff, 0x9f,
+    0xe7, 0xff, 0xf3, 0xfc, 0xc0, 0xc0, 0x61, 0x98, 0x18, 0xc, 0x33, 0x3,
+    0x1, 0x86, 0x60, 0x30, 0x30, 0xcc, 0x6, 0x26, 0x19, 0x86, 0xcc, 0xe7,
+    0x37, 0xdd, 0x9f, 0xc7, 0xf1, 0xf0, 0xf3, 0xf0, 0x3e, 0x0, 0x78, 0x3,
+    0x80, 0x0, 0x0, 0x0,
+
+    /* U+773C */
+    0x0, 0x0, 0x0, 0x3, 0xc0, 0xff, 0xc1, 0xfe, 0x3f, 0xfc, 0x39, 0xc7,
+    0x1, 0xc6, 0x18, 0xc0, 0x38, 0xc3, 0x18, 0x7, 0x18, 0x63, 0x0, 0xe3,
+    0xc, 0x7f, 0xfc, 0x7f, 0x8f, 0xff, 0x8f, 0xf1, 0x80, 0x71, 0x86, 0x30,
+    0xe, 0x30, 0xc6, 0x1, 0xc6, 0x18, 0xff, 0xf0, 0xc3, 0x1f, 0xfe, 0x18,
+    0x63, 0x18, 0x3, 0xfc, 0x61, 0x8e, 0x7f, 0x8c, 0x33, 0x8c, 0x31, 0x86,
+    0xe1, 0x86, 0x30, 0xf8, 0x30, 0xc6, 0xe, 0x6, 0x18, 0xc1, 0xc0, 0xc3,
+    0x18, 0x9c, 0x1c, 0xe3, 0x79, 0xc3, 0xfc, 0xfe, 0x3c, 0x1f, 0x3f, 0x3,
+    0xc0, 0x7, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+773E */
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf1, 0xc3, 0x86,
+    0xe, 0x70, 0xe1, 0x83, 0x9c, 0x38, 0x60, 0xe3, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
+    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x8, 0x30, 0x70, 0x6, 0xc, 0x18, 0x3, 0x83, 0xe, 0x0, 0xf0,
+    0xc3, 0x80, 0x7e, 0x31, 0xf0, 0x39, 0xcc, 0xef, 0xe, 0x33, 0x31, 0xe7,
+    0x0, 0xdc, 0x3d, 0x80, 0x30, 0x7, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0,
+    0x0,
+
+    /* U+775B */
+    0x0, 0x0, 0x40, 0x3, 0xc0, 0x1c, 0x1, 0xfc, 0xff, 0xfe, 0x3b, 0xbf,
+    0xff, 0xe6, 0x30, 0xe, 0x0, 0xc6, 0x1, 0xc0, 0x18, 0xc7, 0xff, 0xc3,
+    0x18, 0xff, 0xf8, 0x7f, 0x0, 0xe0, 0xf, 0xe0, 0x1c, 0x1, 0x8d, 0xff,
+    0xff, 0x31, 0x9f, 0xff, 0xc6, 0x30, 0x0, 0x0, 0xc6, 0x3f, 0xfc, 0x18,
+    0xc7, 0xff, 0xc3, 0xf9, 0xc0, 0x18, 0x7f, 0x3f, 0xff, 0xc, 0x67, 0xff,
+    0xe1, 0x8c, 0xe0, 0xc, 0x31, 0x9c, 0x1, 0x86, 0x33, 0xff, 0xf0, 0xc6,
+    0x7f, 0xfe, 0x1c, 0xce, 0x0, 0xc3, 0xf9, 0xc0, 0x18, 0x1e, 0x38, 0x1f,
+    0x0, 0x3, 0x7, 0xe0, 0x0, 0x40, 0x70, 0x0,
+
+    /* U+7761 */
+    0x0, 0x0, 0x1, 0x3, 0xc0, 0xff, 0xf1, 0xfd, 0xff, 0xfc, 0x3b, 0x9f,
+    0xf0, 0x6, 0x30, 0xc, 0x0, 0xc6, 0x1, 0x80, 0x18, 0xcf, 0xff, 0xe3,
+    0x1b, 0xff, 0xfe, 0x7f, 0x1c, 0xe7, 0xf, 0xe3, 0x18, 0x61, 0x8c, 0x63,
+    0xc, 0x31, 0x8c, 0x61, 0x86, 0x3f, 0xff, 0xfc, 0xc7, 0xff, 0xff, 0x98,
+    0xc6, 0x31, 0xc3, 0xf8, 0xc6, 0x18, 0x7f, 0x18, 0xc3, 0xc, 0x63, 0x18,
+    0x61, 0x8c, 0xff, 0xfe, 0x31, 0xbf, 0xff, 0xe6, 0x30, 0xe, 0x0, 0xc6,
+    0x1, 0x80, 0x1c, 0xc0, 0x30, 0x3, 0xf8, 0x7, 0x0, 0x1e, 0x7f, 0xff,
+    0xc0, 0xf, 0xff, 0xf8,
+
+    /* U+77AD */
+    0x0, 0x0, 0xc0, 0x3, 0xc0, 0x18, 0x1, 0xfc, 0x7, 0x0, 0x3b, 0x9f,
+    0xff, 0xc6, 0x37, 0xff, 0xfc, 0xc6, 0x7f, 0xff, 0x18, 0xc0, 0xcc, 0x3,
+    0x1b, 0xb0, 0xdc, 0x7f, 0x3c, 0xf, 0xf, 0xe3, 0x81, 0xc1, 0x8c, 0xff,
+    0xfc, 0x31, 0xbf, 0xff, 0xc6, 0x3f, 0x80, 0x7c, 0xc7, 0xb8, 0xc, 0x18,
+    0xc7, 0xff, 0x83, 0xf8, 0xff, 0xf0, 0x7f, 0x18, 0x6, 0xc, 0x63, 0xff,
+    0xc1, 0x8c, 0x3f, 0xf0, 0x31, 0x80, 0x70, 0x6, 0x30, 0xcc, 0x40, 0xc6,
+    0x39, 0x9c, 0x1d, 0xce, 0x31, 0xc3, 0xfb, 0x86, 0x1c, 0x1e, 0x63, 0xc1,
+    0xc0, 0x0, 0xf8, 0x0, 0x0, 0xe, 0x0, 0x0,
+
+    /* U+77ED */
+    0x8, 0x0, 0x0, 0x1, 0xc0, 0x7f, 0xfc, 0x18, 0xf, 0xff, 0xe1, 0x80,
+    0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x33, 0x0, 0x0,
+    0x7, 0x30, 0x7f, 0xf8, 0x63, 0x7, 0xff, 0xc4, 0x30, 0x60, 0xc, 0x3,
+    0x6, 0x0, 0xc0, 0x70, 0x60, 0xc, 0x7f, 0xf6, 0x0, 0xc7, 0xfe, 0x60,
+    0xc, 0x7, 0x7, 0x1, 0xc0, 0x70, 0x7f, 0xfc, 0x7, 0x1, 0xff, 0x0,
+    0x7c, 0x10, 0x10, 0x6, 0xe3, 0x83, 0x0, 0xe6, 0x18, 0x30, 0xe, 0x71,
+    0x83, 0x1, 0xc3, 0x18, 0x30, 0x1c, 0x0, 0x87, 0x3, 0x80, 0x0, 0x70,
+    0x70, 0x3f, 0xff, 0xe6, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+77EF */
+    0x8, 0x0, 0x3, 0x81, 0xc0, 0xff, 0xf8, 0x18, 0x1f, 0xfe, 0x1, 0x80,
+    0xe, 0x0, 0x3f, 0xc0, 0xc0, 0x3, 0xff, 0xff, 0xfe, 0x76, 0x3f, 0xff,
+    0xe6, 0x60, 0x38, 0xc0, 0x66, 0x7, 0x6, 0x4, 0x60, 0xff, 0xf0, 0x6,
+    0x1f, 0xff, 0xc3, 0xfb, 0xe0, 0x7e, 0x7f, 0xf7, 0x6, 0x67, 0xf8, 0x3f,
+    0xe0, 0x6, 0x1, 0xfc, 0x0, 0x60, 0x0, 0x0, 0x6, 0x1f, 0xff, 0xc0,
+    0xe3, 0xff, 0xfc, 0xf, 0x38, 0x0, 0xe0, 0xfb, 0x9f, 0xce, 0xd, 0xfb,
+    0xfc, 0xe1, 0x8f, 0xb0, 0xce, 0x38, 0xfb, 0xc, 0xe3, 0x83, 0xbf, 0xce,
+    0x70, 0x39, 0xfd, 0xe6, 0x3, 0x0, 0x3c, 0x0, 0x10, 0x3, 0x80,
+
+    /* U+77F3 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x3,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3,
+    0x80, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x7, 0xff, 0xff, 0x80, 0xf8, 0x0,
+    0x38, 0x1f, 0x80, 0x1, 0x83, 0x98, 0x0, 0x18, 0x79, 0x80, 0x1, 0x87,
+    0x18, 0x0, 0x18, 0x41, 0x80, 0x1, 0x80, 0x18, 0x0, 0x18, 0x1, 0x80,
+    0x1, 0x80, 0x18, 0x0, 0x38, 0x1, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf8,
+    0x0, 0x7f, 0xfe, 0x0,
+
+    /* U+77FD */
+    0x0, 0x0, 0x30, 0x7, 0xfe, 0x6, 0x1, 0xff, 0xe1, 0xc0, 0x1f, 0xf8,
+    0x38, 0x0, 0x60, 0xf, 0xfc, 0xc, 0x1, 0xff, 0x83, 0x80, 0x38, 0x38,
+    0x60, 0xe, 0x7, 0xc, 0x1, 0xc0, 0xe1, 0x80, 0x70, 0x18, 0x7f, 0xe,
+    0x3, 0xf, 0xf3, 0xb0, 0xe3, 0xef, 0xe7, 0x9c, 0x78, 0xe8, 0x7f, 0x1f,
+    0x1c, 0x7, 0xe3, 0xe3, 0x80, 0x78, 0x6c, 0x70, 0x7, 0x1, 0x8e, 0x1,
+    0xc0, 0x31, 0xc0, 0x78, 0x6, 0x38, 0x1e, 0x0, 0xc7, 0x7, 0x80, 0x1f,
+    0xc3, 0xe0, 0x3, 0xf8, 0xf8, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+7802 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x7, 0x0, 0x7f, 0xe0, 0x70, 0x7, 0xfe,
+    0x7, 0x0, 0xc, 0x0, 0x70, 0x0, 0xc0, 0x67, 0x30, 0xc, 0x6, 0x73,
+    0x80, 0xc0, 0x67, 0x18, 0x1c, 0xe, 0x71, 0xc1, 0x80, 0xc7, 0xe, 0x18,
+    0xc, 0x70, 0xe1, 0xfd, 0xc7, 0x6, 0x3f, 0xd8, 0x70, 0x3, 0x8d, 0x87,
+    0x0, 0x78, 0xc0, 0x70, 0xc7, 0x8c, 0x7, 0x1c, 0x78, 0xc0, 0x71, 0x81,
+    0x8c, 0x3e, 0x38, 0x18, 0xc3, 0xe7, 0x1, 0x8c, 0x0, 0xe0, 0x18, 0xc0,
+    0x1c, 0x1, 0xcc, 0x7, 0x80, 0x1f, 0xc0, 0xf0, 0x0, 0xf8, 0x7e, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7814 */
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0xff, 0xfe, 0x7f, 0xef, 0xff, 0xe0, 0x60,
+    0x18, 0x30, 0x6, 0x1, 0x83, 0x0, 0xe0, 0x18, 0x30, 0xc, 0x1, 0x83,
+    0x0, 0xc0, 0x18, 0x30, 0xc, 0x1, 0x83, 0x1, 0xc0, 0x18, 0x30, 0x1f,
+    0xcf, 0xff, 0xc3, 0xfd, 0xff, 0xfe, 0x3c, 0xef, 0xff, 0xe7, 0xce, 0x18,
+    0x30, 0x7c, 0xe1, 0x83, 0x7, 0xce, 0x38, 0x30, 0x4c, 0xe3, 0x83, 0x0,
+    0xce, 0x30, 0x30, 0xc, 0xe3, 0x3, 0x0, 0xce, 0x70, 0x30, 0xc, 0xee,
+    0x3, 0x0, 0xfc, 0xe0, 0x30, 0xf, 0xdc, 0x3, 0x0, 0x1, 0xc0, 0x30,
+    0x0, 0x38, 0x3, 0x0, 0x0, 0x0, 0x20,
+
+    /* U+7834 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x3, 0x0, 0x7f, 0xe0, 0x30, 0x7, 0xfe,
+    0x3, 0x0, 0xe, 0x3, 0xff, 0x80, 0xc0, 0xff, 0xfc, 0xc, 0xe, 0x30,
+    0xc0, 0xc0, 0xc3, 0xc, 0xc, 0xc, 0x31, 0xc1, 0x80, 0xc3, 0x18, 0x18,
+    0xc, 0x30, 0x1, 0xfc, 0xc7, 0x0, 0x3f, 0xcf, 0xff, 0xc3, 0x8c, 0xff,
+    0xfc, 0x78, 0xcc, 0x1, 0xc7, 0x8c, 0xd8, 0x18, 0x78, 0xcc, 0xc3, 0x81,
+    0x8c, 0xcc, 0x30, 0x18, 0xdc, 0xe7, 0x1, 0x8d, 0x87, 0xe0, 0x18, 0xd8,
+    0x3c, 0x1, 0xcd, 0x83, 0xc0, 0xf, 0xf8, 0x7e, 0x0, 0xff, 0x1f, 0xf8,
+    0x0, 0x73, 0xc3, 0xe0, 0x2, 0x78, 0x1e, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+789F */
+    0x0, 0x4, 0x21, 0x0, 0x0, 0x63, 0x18, 0x7f, 0xce, 0x33, 0x87, 0xfc,
+    0xe7, 0x38, 0xc, 0x3f, 0xff, 0xe0, 0xc1, 0xff, 0xfe, 0xc, 0xe, 0x33,
+    0x80, 0xc0, 0xe3, 0x38, 0x1c, 0xe, 0x3f, 0x81, 0x80, 0xe3, 0xf0, 0x18,
+    0xe, 0x0, 0x1, 0xf8, 0x60, 0x0, 0x3f, 0xc7, 0xff, 0xc3, 0x8c, 0x7f,
+    0xfc, 0x78, 0xc0, 0x30, 0x7, 0x8c, 0x3, 0x0, 0x58, 0xdf, 0xff, 0xe1,
+    0x8d, 0xff, 0xfe, 0x18, 0xc0, 0x78, 0x1, 0x8c, 0xf, 0x80, 0x18, 0xc1,
+    0xfc, 0x1, 0xdc, 0x3b, 0x60, 0x1f, 0xcf, 0x33, 0x80, 0xf9, 0xe3, 0x3c,
+    0x0, 0x3c, 0x31, 0xe0, 0x7, 0x3, 0x6, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+78A7 */
+    0x0, 0x0, 0x30, 0x3, 0xff, 0x7, 0x0, 0x7f, 0xf1, 0xff, 0x0, 0x30,
+    0x7f, 0xfc, 0x3, 0x7, 0x1, 0xc0, 0x30, 0x60, 0xc, 0x3f, 0xf6, 0x0,
+    0xc3, 0xff, 0x7f, 0xfc, 0x3, 0x7, 0xff, 0xc0, 0x30, 0x60, 0xc, 0x3,
+    0x6, 0x0, 0xc3, 0xff, 0x7f, 0xfc, 0x7f, 0xf7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0xc, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x1f, 0xff,
+    0xff, 0x83, 0xf0, 0x0, 0x38, 0x73, 0x0, 0x1, 0x86, 0x30, 0x0, 0x38,
+    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+78BA */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x6, 0x0, 0x7f, 0xc0, 0x60, 0x7, 0xfc,
+    0x7f, 0xf8, 0xe, 0x1f, 0xff, 0xc0, 0xc1, 0xce, 0x1e, 0xc, 0x18, 0xc0,
+    0xe0, 0xc1, 0x98, 0x6, 0xc, 0x19, 0x8c, 0x61, 0x80, 0x30, 0xc0, 0x18,
+    0x3, 0x18, 0x1, 0xfc, 0x7f, 0xfe, 0x3f, 0xcf, 0xff, 0xc3, 0x8d, 0xe1,
+    0x80, 0x78, 0xfe, 0x18, 0x7, 0x8f, 0x7f, 0xfc, 0x78, 0xc7, 0xff, 0xc1,
+    0x8c, 0x61, 0x80, 0x18, 0xc6, 0x18, 0x1, 0x8c, 0x7f, 0xfc, 0x18, 0xc7,
+    0xff, 0xc1, 0xcc, 0x61, 0x80, 0xf, 0xc6, 0x18, 0x0, 0xfc, 0x71, 0x80,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0x3f, 0xfe,
+
+    /* U+78C1 */
+    0x0, 0x2, 0x3, 0x0, 0x0, 0x70, 0x70, 0x7f, 0xe3, 0x7, 0x7, 0xfe,
+    0x38, 0xe0, 0xe, 0x1, 0xc, 0x0, 0xc3, 0xff, 0xfe, 0xc, 0x3f, 0xff,
+    0xe0, 0xc0, 0x60, 0x20, 0x1c, 0x6, 0x6, 0x1, 0x80, 0x60, 0x60, 0x18,
+    0xe, 0x4e, 0x63, 0xf8, 0xcc, 0xce, 0x3f, 0xcd, 0xcc, 0xc3, 0x8f, 0x9d,
+    0x8c, 0x78, 0xf9, 0xf9, 0xc7, 0x8d, 0xfb, 0x98, 0x78, 0xcf, 0x1f, 0x81,
+    0x8c, 0x70, 0xf0, 0x18, 0xc6, 0x7, 0x1, 0x8c, 0x78, 0x6c, 0x18, 0xcd,
+    0x86, 0xc1, 0xcc, 0xcc, 0xce, 0xf, 0xd8, 0xcc, 0xe0, 0xfb, 0xfd, 0xfe,
+    0x0, 0x7f, 0xff, 0xe0, 0x7, 0xf, 0x6, 0x0, 0x0, 0x0, 0x20,
+
+    /* U+793A */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x2, 0x6, 0x8, 0x0, 0x70, 0x60, 0xc0, 0x7, 0x6, 0xe, 0x0,
+    0xe0, 0x60, 0x70, 0x1c, 0x6, 0x7, 0x83, 0xc0, 0x60, 0x3c, 0x38, 0x6,
+    0x1, 0xe7, 0x0, 0x60, 0xe, 0x60, 0x6, 0x0, 0x40, 0x7, 0xe0, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x3, 0x80, 0x0,
+
+    /* U+793E */
+    0x0, 0x0, 0x30, 0x1, 0xfc, 0x3, 0x0, 0x3f, 0xe0, 0x30, 0x1, 0xfc,
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30,
+    0x7, 0xff, 0x3, 0x0, 0x7f, 0xe7, 0xff, 0x80, 0x61, 0xff, 0xfc, 0x6,
+    0xf, 0xff, 0xc2, 0x66, 0x3, 0x0, 0x66, 0x60, 0x30, 0x6, 0x66, 0x3,
+    0x0, 0x66, 0x60, 0x30, 0x6, 0x66, 0x3, 0x0, 0x66, 0x60, 0x30, 0x6,
+    0x66, 0x3, 0x0, 0x66, 0x60, 0x30, 0x6, 0x66, 0x3, 0x0, 0x66, 0x60,
+    0x30, 0x6, 0x66, 0x3, 0x0, 0x66, 0x0, 0x30, 0x4, 0x63, 0xff, 0xfe,
+    0x6, 0x3f, 0xff, 0xe0, 0x61, 0xff, 0xfc, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7956 */
+    0x1f, 0xc0, 0x0, 0x3, 0xfe, 0x3f, 0xf0, 0x1f, 0xc7, 0xff, 0x80, 0x0,
+    0x60, 0x38, 0x0, 0x6, 0x1, 0x80, 0x0, 0x60, 0x18, 0x7f, 0xf6, 0x1,
+    0x87, 0xfe, 0x60, 0x18, 0x6, 0x7, 0xff, 0x80, 0x60, 0x7f, 0xf8, 0x26,
+    0x66, 0x1, 0x83, 0x66, 0x60, 0x18, 0x36, 0x66, 0x1, 0x83, 0x66, 0x60,
+    0x18, 0x76, 0x66, 0x1, 0x87, 0x66, 0x7f, 0xf8, 0x76, 0x67, 0xff, 0x86,
+    0x66, 0x60, 0x18, 0x66, 0x66, 0x1, 0x86, 0x66, 0x60, 0x18, 0x66, 0x66,
+    0x1, 0x86, 0x66, 0x60, 0x18, 0x46, 0x6, 0x1, 0x80, 0x67, 0xff, 0xfe,
+    0x6, 0x3f, 0xff, 0xe0, 0x20, 0x0, 0x0,
+
+    /* U+795D */
+    0x1f, 0x80, 0x0, 0x3, 0xfc, 0xff, 0xf8, 0x3f, 0x8f, 0xff, 0x80, 0x0,
+    0xc0, 0x1c, 0x0, 0xc, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x7f, 0xcc, 0x0,
+    0xc7, 0xfc, 0xc0, 0xc, 0x6, 0xc, 0x0, 0xc0, 0x60, 0xc0, 0x1c, 0x26,
+    0xcf, 0xff, 0x86, 0x6c, 0xff, 0xf8, 0x66, 0xc3, 0x9c, 0x6, 0x6c, 0x18,
+    0xc0, 0x66, 0xc1, 0x8c, 0x6, 0x6c, 0x18, 0xc0, 0x66, 0xc3, 0x8c, 0x6,
+    0x6c, 0x30, 0xc0, 0x66, 0xc3, 0xc, 0x6, 0x6c, 0x30, 0xc6, 0x66, 0xc6,
+    0xc, 0x66, 0x6c, 0xe0, 0xc6, 0x46, 0x1c, 0xe, 0xe0, 0x67, 0x80, 0xfe,
+    0x6, 0x70, 0x7, 0xc0, 0x40, 0x0, 0x0,
+
+    /* U+7965 */
+    0x0, 0x0, 0x0, 0x1, 0xf8, 0x60, 0x30, 0x3f, 0xc7, 0x7, 0x3, 0xf8,
+    0x30, 0x60, 0x0, 0x3, 0x6, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xf, 0xff,
+    0xc7, 0xfd, 0xff, 0xfe, 0x7f, 0xc0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6,
+    0x0, 0x30, 0x2, 0x6c, 0x7, 0x0, 0x66, 0xcf, 0xff, 0xc6, 0x6c, 0xff,
+    0xf8, 0x66, 0xc0, 0x30, 0x6, 0x6c, 0x3, 0x0, 0x66, 0xc0, 0x30, 0x6,
+    0x6c, 0xff, 0xfc, 0x66, 0xdf, 0xff, 0xe6, 0x6c, 0xff, 0xfc, 0x66, 0xc0,
+    0x30, 0x6, 0x6c, 0x3, 0x0, 0x66, 0xc0, 0x30, 0x4, 0x64, 0x3, 0x0,
+    0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x4, 0x0, 0x20, 0x0,
+
+    /* U+7968 */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x70, 0xe0, 0x0, 0x6,
+    0xc, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xfc, 0x38, 0x70, 0xe1,
+    0xc3, 0x6, 0xc, 0xc, 0x30, 0x60, 0xc0, 0xc3, 0xff, 0xff, 0xfc, 0x1f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x3, 0x86,
+    0x18, 0x0, 0xf0, 0x61, 0xf0, 0x3e, 0x6, 0xf, 0xc7, 0x83, 0xe0, 0x3e,
+    0x60, 0x7e, 0x0, 0xe0, 0x3, 0x80, 0x0,
+
+    /* U+796D */
+    0x0, 0x82, 0x0, 0x0, 0x18, 0x33, 0xf0, 0x3, 0xfb, 0x7f, 0xc0, 0x7f,
+    0xf8, 0x3c, 0x1e, 0x1d, 0x83, 0x83, 0xd1, 0x9c, 0x70, 0x73, 0xb8, 0xee,
+    0x6, 0x1f, 0x7, 0xc0, 0x18, 0xe0, 0x38, 0x1, 0xcc, 0x3, 0xc0, 0xf,
+    0xc0, 0x1e, 0x0, 0x70, 0x0, 0xf8, 0x1f, 0xff, 0xff, 0xc7, 0x9f, 0xff,
+    0x8e, 0x70, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0x1, 0x86,
+    0x18, 0x0, 0x78, 0x61, 0xe0, 0xf, 0x6, 0xf, 0x83, 0xe0, 0x60, 0x7c,
+    0x78, 0x3e, 0x1, 0xe6, 0x7, 0xe0, 0x6, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+797A */
+    0x0, 0x2, 0x1, 0x1, 0xfc, 0x30, 0x30, 0x3f, 0xc3, 0x3, 0x3, 0xfc,
+    0x30, 0x30, 0x0, 0xf, 0xff, 0xc0, 0x1, 0xff, 0xfe, 0x0, 0x3, 0x3,
+    0x87, 0xfe, 0x30, 0x30, 0x7f, 0xe3, 0x3, 0x0, 0x60, 0x3f, 0xf0, 0x6,
+    0x3, 0xff, 0x2, 0x64, 0x30, 0x30, 0x36, 0xe3, 0x3, 0x3, 0x6e, 0x30,
+    0x30, 0x76, 0xe3, 0xff, 0x7, 0x6e, 0x3f, 0xf0, 0x76, 0xe3, 0x3, 0x7,
+    0x6e, 0x30, 0x30, 0x66, 0xef, 0xff, 0xe6, 0x6f, 0xff, 0xfe, 0x66, 0xe0,
+    0x0, 0x6, 0x6e, 0x18, 0x40, 0x66, 0x63, 0x87, 0x4, 0x64, 0xf0, 0x38,
+    0x6, 0x1e, 0x1, 0xe0, 0x63, 0x80, 0xe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+7981 */
+    0x1, 0x0, 0x18, 0x0, 0x30, 0x1, 0x80, 0x3, 0x0, 0x18, 0x7, 0xff,
+    0x3f, 0xfe, 0x7f, 0xfb, 0xff, 0xe0, 0x78, 0x3, 0xc0, 0x7, 0x80, 0x7e,
+    0x0, 0xfe, 0xd, 0xf0, 0x1b, 0x71, 0xdb, 0x83, 0xb1, 0x39, 0x9c, 0x73,
+    0x7, 0x18, 0xe6, 0x30, 0xc1, 0x86, 0x3, 0x0, 0x18, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x6,
+    0x0, 0x0, 0x38, 0x61, 0x80, 0xf, 0x6, 0x1f, 0x3, 0xe0, 0x60, 0xfc,
+    0x7c, 0x1e, 0x3, 0xe7, 0x7, 0xe0, 0xe, 0x0, 0x3c, 0x0, 0x0,
+
+    /* U+798F */
+    0x1f, 0x8f, 0xff, 0xc3, 0xfd, 0xff, 0xfe, 0x3f, 0x8f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x7f, 0xf8, 0x7f, 0xee, 0x1,
+    0x87, 0xfe, 0xc0, 0x1c, 0x6, 0xc, 0x1, 0xc0, 0x60, 0xe0, 0x38, 0x26,
+    0x47, 0xff, 0x86, 0x6c, 0x0, 0x0, 0x66, 0xc0, 0x0, 0x6, 0x6c, 0x7f,
+    0xf8, 0x66, 0xcf, 0xff, 0xc6, 0x6d, 0xc3, 0xc, 0x66, 0xd8, 0x30, 0xc6,
+    0x6d, 0x83, 0xc, 0x66, 0xdf, 0xff, 0xc6, 0x6d, 0xff, 0xfc, 0x66, 0xd8,
+    0x30, 0xc6, 0x6d, 0x83, 0xc, 0x46, 0x1c, 0x30, 0xc0, 0x61, 0xff, 0xfc,
+    0x6, 0xf, 0xff, 0xc0, 0x60, 0x0, 0x0,
+
+    /* U+79A7 */
+    0x0, 0x0, 0x20, 0x1, 0xf8, 0x3, 0x0, 0x3f, 0xdf, 0xff, 0xe1, 0xfd,
+    0xff, 0xfe, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xf, 0xff,
+    0xc7, 0xfe, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x60, 0x7f, 0xf8, 0x6,
+    0xf, 0xff, 0x82, 0x64, 0xc0, 0x1c, 0x66, 0xce, 0x1, 0xc7, 0x6c, 0xff,
+    0xf8, 0x76, 0xc3, 0x87, 0x7, 0x6c, 0x18, 0x60, 0x66, 0xcf, 0xff, 0xc6,
+    0x6d, 0xff, 0xfe, 0x66, 0xc0, 0x0, 0x6, 0x6c, 0x0, 0x0, 0x66, 0xcf,
+    0xff, 0x86, 0x6c, 0xff, 0xfc, 0x66, 0xcc, 0x0, 0xc4, 0x64, 0xc0, 0xc,
+    0x6, 0xf, 0xff, 0xc0, 0x60, 0x7f, 0xf8, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+79AE */
+    0x0, 0x0, 0x88, 0x3, 0xf8, 0xc, 0xc0, 0x7f, 0xc1, 0xcc, 0x3, 0xf8,
+    0xff, 0xfc, 0x0, 0x1d, 0xdd, 0xc0, 0x1, 0x8c, 0xcc, 0x0, 0x1f, 0xff,
+    0xc7, 0xfd, 0xff, 0xfc, 0x7f, 0xd8, 0xcc, 0xc0, 0xe1, 0xcc, 0xcc, 0x6,
+    0xf, 0xff, 0xc2, 0x6c, 0xff, 0xf8, 0x66, 0xc0, 0x0, 0x6, 0x6d, 0xff,
+    0xfe, 0x66, 0xdf, 0xff, 0xe6, 0x6c, 0x0, 0x0, 0x66, 0xc7, 0xff, 0x86,
+    0x6c, 0xff, 0xf8, 0x66, 0xcc, 0x1, 0xc6, 0x6c, 0xc0, 0x1c, 0x66, 0xcf,
+    0xff, 0x86, 0x6c, 0x7f, 0xf8, 0x66, 0xc3, 0x6, 0x4, 0x60, 0x18, 0x60,
+    0x6, 0x1f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+79BE */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x1f, 0xff, 0xff, 0x1, 0xff,
+    0xfe, 0x0, 0xe, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xff, 0xe1, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xf8,
+    0x0, 0x0, 0x7e, 0xc0, 0x0, 0x6, 0x6e, 0x0, 0x0, 0xe6, 0x70, 0x0,
+    0x1c, 0x63, 0x80, 0x7, 0x86, 0x1c, 0x0, 0xf0, 0x60, 0xf0, 0x1e, 0x6,
+    0x7, 0x83, 0xc0, 0x60, 0x3e, 0x78, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x6,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+79C0 */
+    0x0, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x1, 0xfc,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0xe6, 0x70, 0x0, 0x3c, 0x63, 0xc0, 0x1f, 0x6, 0xf, 0x87, 0xe0, 0x60,
+    0x7e, 0x7f, 0xff, 0xf1, 0xe4, 0x7f, 0xff, 0x0, 0x0, 0x70, 0x30, 0x0,
+    0x7, 0x3, 0x0, 0x0, 0x70, 0x3f, 0x80, 0x6, 0x3, 0xf8, 0x0, 0xe0,
+    0x1, 0xc0, 0xe, 0x0, 0x18, 0x3, 0xc0, 0x1, 0x80, 0xf8, 0x0, 0x38,
+    0x3f, 0x0, 0x1f, 0x87, 0xc0, 0x3, 0xf0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+79C1 */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x83, 0x0, 0x7f, 0xf8, 0x70, 0x7, 0xf8,
+    0x7, 0x0, 0x3, 0x80, 0x70, 0x0, 0x38, 0x6, 0x0, 0x3, 0x80, 0x60,
+    0x0, 0x38, 0x6, 0x0, 0x7f, 0xfc, 0x60, 0x7, 0xff, 0xce, 0x0, 0x3,
+    0x80, 0xe0, 0x0, 0x38, 0xc, 0x0, 0x7, 0x80, 0xc0, 0x0, 0x7e, 0xc,
+    0x0, 0xf, 0xe0, 0xc6, 0x0, 0xfb, 0x1c, 0x70, 0x1b, 0xb9, 0x83, 0x1,
+    0xb9, 0xd8, 0x38, 0x33, 0x89, 0x81, 0x87, 0x38, 0x18, 0x18, 0x63, 0x83,
+    0x81, 0xc4, 0x38, 0x30, 0x1c, 0x3, 0x83, 0x3f, 0xe0, 0x39, 0xff, 0xfe,
+    0x3, 0x9f, 0xe0, 0x60, 0x18, 0x0, 0x6, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+79C9 */
+    0x0, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0xe, 0x3, 0x80, 0x0, 0x60, 0x38, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x6, 0x3, 0x80, 0x0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xf0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xe6,
+    0xf0, 0x0, 0x1c, 0x67, 0x80, 0xf, 0x86, 0x1f, 0x3, 0xe0, 0x60, 0xfe,
+    0x7c, 0x6, 0x3, 0xe7, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+79CB */
+    0x0, 0x0, 0x0, 0x0, 0xfe, 0x3, 0x0, 0x7f, 0xc0, 0x30, 0x7, 0xf0,
+    0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0x4, 0x70,
+    0x40, 0x70, 0x67, 0xc, 0x7f, 0xee, 0x70, 0xc7, 0xfc, 0xe7, 0x1c, 0x6,
+    0xc, 0x71, 0xc0, 0xe0, 0xc7, 0x18, 0xe, 0x1c, 0x73, 0x80, 0xf9, 0xc7,
+    0x10, 0x1f, 0xc8, 0x70, 0x1, 0xee, 0x7, 0x80, 0x36, 0x60, 0xf8, 0x7,
+    0x62, 0xd, 0xc0, 0x66, 0x1, 0xcc, 0x6, 0x60, 0x1c, 0xe0, 0x6, 0x3,
+    0x87, 0x0, 0x60, 0x78, 0x78, 0x6, 0xf, 0x3, 0xc0, 0x61, 0xe0, 0x1c,
+    0x6, 0x3c, 0x0, 0xe0, 0x63, 0x0, 0x6, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+79D1 */
+    0x0, 0x0, 0x2, 0x0, 0x3f, 0x0, 0x30, 0x7f, 0xe1, 0x7, 0x7, 0xf8,
+    0x38, 0x70, 0x3, 0x1, 0xe7, 0x0, 0x30, 0xe, 0x70, 0x3, 0x0, 0x67,
+    0x0, 0x30, 0x0, 0x70, 0x7f, 0xf0, 0x7, 0x7, 0xff, 0x20, 0x70, 0x7,
+    0x7, 0x87, 0x0, 0x70, 0x3c, 0x70, 0x7, 0x1, 0xe7, 0x0, 0xfc, 0x4,
+    0x70, 0xf, 0xe0, 0x7, 0x1, 0xb7, 0x0, 0x76, 0x1b, 0x30, 0xf, 0xe3,
+    0xb1, 0x1f, 0xfc, 0x33, 0xf, 0xff, 0x7, 0x31, 0xf8, 0x70, 0x63, 0x0,
+    0x7, 0x4, 0x30, 0x0, 0x70, 0x3, 0x0, 0x7, 0x0, 0x30, 0x0, 0x70,
+    0x3, 0x0, 0x7, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x2, 0x0,
+
+    /* U+79DF */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x7f, 0xf3, 0xff, 0x7, 0xf8,
+    0x3f, 0xf8, 0x3, 0x3, 0x3, 0x80, 0x30, 0x30, 0x18, 0x3, 0x3, 0x1,
+    0x80, 0x30, 0x30, 0x18, 0x7f, 0xf3, 0x1, 0x87, 0xff, 0x3f, 0xf8, 0x3,
+    0x3, 0xff, 0x80, 0x70, 0x30, 0x18, 0x7, 0x3, 0x1, 0x80, 0xfc, 0x30,
+    0x18, 0xf, 0xe3, 0x1, 0x80, 0xb7, 0x30, 0x18, 0x1b, 0x33, 0xff, 0x83,
+    0xb1, 0x3f, 0xf8, 0x33, 0x3, 0x1, 0x87, 0x30, 0x30, 0x18, 0x63, 0x3,
+    0x1, 0x84, 0x30, 0x30, 0x18, 0x3, 0x3, 0x1, 0x80, 0x30, 0x30, 0x38,
+    0x3, 0x3f, 0xff, 0xe0, 0x33, 0xff, 0xfe, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+79E6 */
+    0x0, 0x8, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x0, 0x60, 0xe0, 0x0, 0xe, 0x6, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x3, 0x80, 0x1c, 0x0, 0x70, 0x6,
+    0xe0, 0xe, 0xff, 0xe7, 0x83, 0xdf, 0xe0, 0x3e, 0x78, 0x6, 0x1, 0xe6,
+    0x0, 0x60, 0x6, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x1f,
+    0x80, 0x0, 0x7, 0xfe, 0x0, 0x1, 0xe6, 0x78, 0x0, 0xf8, 0x63, 0xf0,
+    0x3f, 0x6, 0xf, 0xc3, 0xc0, 0x60, 0x3c, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7A0B */
+    0x0, 0x40, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x7f, 0xcf, 0xff, 0x87, 0xe0,
+    0xff, 0xf8, 0x6, 0x1c, 0x1, 0xc0, 0x61, 0xc0, 0x1c, 0x6, 0x1c, 0x1,
+    0xc0, 0x71, 0xc0, 0x1c, 0x7f, 0xec, 0x1, 0xc7, 0xfc, 0xff, 0xf8, 0x6,
+    0x7, 0xff, 0x80, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x7, 0x80, 0xf8, 0xff,
+    0xf8, 0x1f, 0xdf, 0xfc, 0x3, 0x6c, 0x7, 0x0, 0x36, 0x60, 0x70, 0x7,
+    0x62, 0x7, 0x0, 0x66, 0xf, 0xff, 0x86, 0x60, 0xff, 0xf8, 0x6, 0x0,
+    0x70, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0,
+    0x6, 0x7f, 0xff, 0xe0, 0x63, 0xff, 0xfe, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7A31 */
+    0x0, 0x40, 0x3, 0xc1, 0xfc, 0x7f, 0xfc, 0x7f, 0xdf, 0xfe, 0x7, 0xe0,
+    0xc4, 0x8, 0x6, 0x8, 0x61, 0x80, 0x60, 0xc6, 0x18, 0x6, 0x6, 0x33,
+    0x0, 0xe0, 0x60, 0x30, 0x7f, 0xc0, 0x60, 0x7, 0xfc, 0x7, 0x0, 0xe,
+    0xf, 0xff, 0x80, 0xe1, 0xff, 0xf8, 0xe, 0x1c, 0x61, 0xc1, 0xf9, 0x86,
+    0xc, 0x1f, 0x9f, 0xff, 0xc3, 0xed, 0xff, 0xfc, 0x36, 0x5c, 0x71, 0xc7,
+    0x61, 0x86, 0xc, 0x66, 0x18, 0x60, 0xc6, 0x67, 0xff, 0xfe, 0x6, 0x7f,
+    0xff, 0xe0, 0x61, 0xc0, 0x1c, 0x6, 0x18, 0x0, 0xc0, 0x61, 0x80, 0x1c,
+    0x6, 0x18, 0x7, 0xc0, 0x61, 0x80, 0xf8, 0x6, 0x8, 0xf, 0x0,
+
+    /* U+7A4E */
+    0x10, 0x0, 0x0, 0x3, 0x0, 0x3f, 0xfc, 0x30, 0x77, 0xff, 0xe3, 0x3e,
+    0x3f, 0xfc, 0x3f, 0x80, 0x38, 0x3, 0x80, 0x3, 0x0, 0x30, 0x18, 0xff,
+    0x83, 0x3, 0x9f, 0xfc, 0x3f, 0xf9, 0x81, 0xc1, 0xff, 0x38, 0xc, 0x0,
+    0x3, 0xff, 0xc1, 0xff, 0x3f, 0xfc, 0x3f, 0xe3, 0x81, 0xc0, 0x38, 0x38,
+    0xc, 0x1, 0x83, 0x81, 0xc3, 0xff, 0xbf, 0xfc, 0x7f, 0xfb, 0xff, 0xc0,
+    0x78, 0x38, 0xc, 0x7, 0x83, 0x81, 0xc1, 0xfe, 0x1f, 0xfc, 0x39, 0xf1,
+    0xff, 0x83, 0x9b, 0x80, 0x0, 0x71, 0x80, 0xe7, 0x4, 0x18, 0x3c, 0x38,
+    0x1, 0x8f, 0x81, 0xe0, 0x18, 0xe0, 0xe, 0x1, 0x8, 0x0, 0x20,
+
+    /* U+7A76 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x70, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xf9, 0xc1, 0xc6, 0x3, 0xb8, 0x30, 0xc0, 0x77,
+    0x6, 0x18, 0xe, 0xe1, 0xc3, 0x7, 0xc8, 0x70, 0x71, 0xd0, 0x7c, 0xf,
+    0xf0, 0xf, 0x18, 0x7c, 0x0, 0x3, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf,
+    0xff, 0xf0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x70, 0xe0, 0x0, 0xc, 0xc,
+    0x0, 0x1, 0x81, 0x80, 0x0, 0x70, 0x30, 0x20, 0xc, 0x6, 0xc, 0x3,
+    0x80, 0xc1, 0x81, 0xe0, 0x18, 0x30, 0xf8, 0x3, 0x8e, 0x7c, 0x0, 0x7f,
+    0xde, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7A7A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x7, 0x1c, 0xe, 0x70, 0x61, 0xc0,
+    0xe7, 0x6, 0x1c, 0xe, 0x70, 0xe1, 0xc0, 0xe2, 0xe, 0x1c, 0x34, 0x1,
+    0xc1, 0xc7, 0x0, 0x78, 0x1f, 0xf0, 0x1f, 0x0, 0xfe, 0x1, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff, 0xfc,
+    0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc,
+
+    /* U+7A7F */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0x71, 0x80, 0xe7, 0x6, 0x18, 0x2e, 0x70, 0xe1, 0x86,
+    0xe6, 0x3c, 0x1f, 0xe6, 0xf, 0x80, 0xfe, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x20, 0x7,
+    0x0, 0x7, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0, 0x7, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xfe, 0xc, 0x3, 0xf0, 0x1, 0xc0, 0xff, 0x0, 0x0, 0x3e,
+    0x70, 0x0, 0xf, 0x87, 0x0, 0x7, 0xe0, 0x70, 0x7, 0xf8, 0x7, 0x0,
+    0x7c, 0x1, 0xf0, 0x6, 0x0, 0x7e, 0x0, 0x0, 0x7, 0xc0, 0x0,
+
+    /* U+7A97 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x78, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xfd, 0xc1, 0xc6, 0x3, 0xb8, 0x30, 0xc1, 0xb7,
+    0x1e, 0x1c, 0x76, 0x1f, 0x93, 0xfc, 0x3, 0xc6, 0x3f, 0x0, 0x0, 0xc0,
+    0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf0, 0x60, 0x0, 0x7, 0xc,
+    0x3, 0x4, 0xe1, 0x90, 0xc1, 0x9c, 0x37, 0xf8, 0x73, 0x86, 0x1f, 0x8c,
+    0x70, 0xc3, 0xff, 0x8e, 0x18, 0xe1, 0xf1, 0xc3, 0x10, 0x3f, 0xb8, 0x60,
+    0xe, 0x77, 0xc, 0x3, 0x80, 0xe1, 0x80, 0x0, 0x1c, 0x3f, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xe0,
+
+    /* U+7AA9 */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x80, 0x0, 0xff, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xee, 0xe, 0x30, 0x1d, 0xc1, 0xc6, 0xd, 0xb8, 0xf0, 0xff, 0xb2,
+    0xfc, 0xf, 0xe4, 0x1c, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x3f, 0xff,
+    0xf0, 0x6, 0x0, 0x7, 0x0, 0xc0, 0x0, 0xe0, 0x18, 0x1f, 0xfc, 0x3,
+    0x7, 0x3, 0x80, 0x60, 0xc0, 0x70, 0x3f, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xf1, 0xc0, 0x0, 0x7, 0x30, 0x7f, 0xe0, 0xe6, 0x1f, 0xfe, 0x1c, 0xc7,
+    0x0, 0xe3, 0x98, 0xe0, 0xc, 0x73, 0x1c, 0x3, 0x8e, 0x61, 0xff, 0xe7,
+    0x8c, 0x0, 0x1, 0xf1, 0x80, 0x0, 0x1c, 0x0,
+
+    /* U+7ACB */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x6,
+    0x0, 0xe, 0x0, 0x70, 0x1, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x30, 0x1,
+    0xc0, 0x3, 0x80, 0x18, 0x0, 0x38, 0x3, 0x80, 0x1, 0x80, 0x38, 0x0,
+    0x1c, 0x3, 0x80, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x7, 0x0, 0x0, 0xc0,
+    0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+7AD9 */
+    0x2, 0x0, 0x20, 0x0, 0x30, 0x7, 0x0, 0x3, 0x0, 0x70, 0x0, 0x30,
+    0x7, 0x0, 0x3, 0x0, 0x70, 0x7, 0xff, 0x7, 0x0, 0x7f, 0xf8, 0x7f,
+    0xe3, 0xfe, 0x7, 0xfe, 0x0, 0x0, 0x70, 0x3, 0x6, 0x7, 0x0, 0x30,
+    0xe0, 0x70, 0x3, 0xc, 0x7, 0x0, 0x30, 0xc0, 0x70, 0x3, 0x8c, 0x1f,
+    0xf0, 0x38, 0xc7, 0xff, 0xc1, 0x8c, 0x7f, 0xfc, 0x19, 0x8e, 0x0, 0xc1,
+    0x98, 0xe0, 0xc, 0x1, 0x8e, 0x0, 0xc0, 0x1f, 0xe0, 0xc, 0xf, 0xfe,
+    0x0, 0xc7, 0xfc, 0xe0, 0xc, 0x7c, 0xe, 0x0, 0xc0, 0x0, 0x70, 0x3c,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x3f, 0xf0,
+
+    /* U+7ADF */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff,
+    0xff, 0xf8, 0x1, 0xc0, 0x38, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0,
+    0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x71,
+    0xc0, 0x0, 0x6, 0xc, 0x6, 0x0, 0xe0, 0xc0, 0x60, 0x3c, 0xc, 0xe,
+    0x1f, 0x80, 0xff, 0xe7, 0xe0, 0xf, 0xfc, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+7AE0 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0x80, 0x1c, 0x3, 0x0, 0x0, 0xc0, 0x30,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x6,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0xe0, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7AE5 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x1, 0xc0, 0x38, 0x0, 0x1c, 0x3, 0x0, 0x1, 0xc0, 0x70,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x6, 0x3, 0x0, 0xc0, 0xe0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0xe0, 0x30, 0xc, 0x6, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+7AEF */
+    0x4, 0x0, 0x20, 0x0, 0x60, 0x83, 0x0, 0x6, 0xc, 0x30, 0xc0, 0x61,
+    0xc3, 0xc, 0x6, 0x1c, 0x30, 0xc7, 0xfd, 0xc3, 0x1c, 0x7f, 0xef, 0xff,
+    0xc3, 0xf8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xc, 0x0, 0x0, 0x31,
+    0x9f, 0xff, 0xe3, 0x19, 0xff, 0xfe, 0x31, 0x80, 0xe0, 0x3, 0x18, 0xc,
+    0x0, 0x31, 0x81, 0xc0, 0x3, 0x98, 0xff, 0xfc, 0x1b, 0x1f, 0xff, 0xc1,
+    0xb1, 0xd8, 0xcc, 0x3, 0x19, 0x8c, 0xc0, 0x3d, 0x98, 0xcc, 0x1f, 0xd9,
+    0x8c, 0xc7, 0xf9, 0x98, 0xcc, 0x78, 0x19, 0x8c, 0xc0, 0x1, 0x98, 0xcc,
+    0x0, 0x19, 0x8d, 0xc0, 0x1, 0x98, 0xbc, 0x0, 0x8, 0x1, 0x80,
+
+    /* U+7AF9 */
+    0x2, 0x0, 0x40, 0x0, 0x70, 0xe, 0x0, 0x6, 0x0, 0xc0, 0x0, 0xe0,
+    0xc, 0x0, 0xe, 0x1, 0xc0, 0x0, 0xc0, 0x1c, 0x0, 0x1e, 0x1, 0xc0,
+    0x1, 0xff, 0x9f, 0xfe, 0x1f, 0xfb, 0xff, 0xe3, 0x98, 0x30, 0x70, 0x31,
+    0x87, 0x7, 0x7, 0x18, 0x60, 0x70, 0x61, 0x8e, 0x7, 0x6, 0x18, 0xc0,
+    0x70, 0x1, 0x8c, 0x7, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x0,
+    0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80,
+    0x7, 0x0, 0x18, 0x0, 0x70, 0x1, 0x80, 0x7, 0x0, 0x18, 0x0, 0x60,
+    0x1, 0x80, 0x7e, 0x0, 0x18, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+7AFF */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xe, 0x1, 0xe0, 0x1, 0xff,
+    0xdf, 0xfe, 0x3f, 0xfb, 0xff, 0xc3, 0x8c, 0x70, 0xc0, 0x70, 0xc6, 0xc,
+    0x4, 0xc, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+7B2C */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xe, 0x1, 0xe0, 0x1, 0xff,
+    0xdf, 0xfe, 0x3f, 0xfb, 0xff, 0xc7, 0xc, 0x70, 0xc0, 0x60, 0xc6, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x0,
+    0x6, 0x1, 0x80, 0x0, 0x60, 0x18, 0x7, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xf8, 0x1c, 0x7, 0x0, 0x1, 0x80, 0x60, 0x0, 0x18, 0x7, 0x0, 0x1,
+    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xc0, 0x1, 0xe0, 0xc, 0x0, 0x7e,
+    0x0, 0xc0, 0x1e, 0x60, 0xc, 0x7, 0xc6, 0x1, 0xc3, 0xf0, 0x61, 0xfc,
+    0x7c, 0x6, 0x1f, 0x87, 0x0, 0x60, 0xe0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+7B49 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xe, 0x1, 0xe0, 0x1, 0xff,
+    0xdf, 0xfe, 0x3f, 0xfb, 0xff, 0xc7, 0xc, 0x70, 0xc0, 0x60, 0xc2, 0xc,
+    0x0, 0x4, 0x60, 0x40, 0x0, 0xe, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0x80, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x1, 0x80, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x38, 0x0, 0x18, 0x1, 0x80, 0x1, 0xc0, 0x18, 0x0, 0xe, 0x3, 0x80,
+    0x0, 0xe1, 0xf8, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x1, 0xe0, 0x0,
+
+    /* U+7B51 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xe, 0x1, 0xc0, 0x1, 0xff,
+    0xdf, 0xfe, 0x3f, 0xfb, 0xff, 0xe3, 0x8c, 0x70, 0xc0, 0x70, 0xc7, 0xc,
+    0x0, 0x4, 0x40, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x7f,
+    0xf7, 0xfe, 0x3, 0xfe, 0x60, 0x60, 0x7, 0x6, 0x6, 0x0, 0x70, 0x60,
+    0x60, 0x7, 0x6, 0x86, 0x0, 0x70, 0x6c, 0x60, 0x7, 0x6, 0xe6, 0x0,
+    0x70, 0x66, 0x60, 0x7, 0x6, 0x76, 0x0, 0x76, 0xe3, 0x62, 0x7, 0xec,
+    0x16, 0x63, 0xfc, 0xc0, 0x66, 0x7e, 0x18, 0x6, 0x66, 0x3, 0x80, 0x7e,
+    0x0, 0x70, 0x7, 0xe0, 0xe, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7B56 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xe, 0x0, 0xe, 0x1, 0xe0, 0x1, 0xff,
+    0xdf, 0xfe, 0x3f, 0xfb, 0xff, 0xc7, 0xc, 0x30, 0xc0, 0x60, 0xc2, 0xc,
+    0x0, 0x4, 0x60, 0x40, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0x18, 0xe, 0x1, 0x81,
+    0x81, 0xf0, 0x38, 0x18, 0x3f, 0x8f, 0x81, 0x87, 0xfc, 0xf0, 0x0, 0xe6,
+    0xfc, 0x0, 0x3c, 0x67, 0xc0, 0xf, 0x86, 0x1f, 0x3, 0xe0, 0x60, 0xfc,
+    0x78, 0x6, 0x3, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+7B71 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xf, 0xf9, 0xff, 0xc1, 0xff,
+    0xdf, 0xfe, 0x3d, 0xc3, 0x9c, 0x7, 0xc, 0x70, 0xc0, 0x60, 0xc6, 0xe,
+    0x0, 0x0, 0xc, 0x40, 0x3, 0x0, 0xc0, 0x0, 0x70, 0x1c, 0x0, 0x6,
+    0x1, 0xc0, 0x0, 0xe6, 0x3f, 0xfe, 0xe, 0x63, 0xff, 0xc1, 0xe6, 0x78,
+    0x30, 0x1e, 0x67, 0x83, 0x3, 0xe6, 0xd8, 0x30, 0x3e, 0x6c, 0x83, 0x6,
+    0xe6, 0xc, 0x70, 0x4e, 0x60, 0xc6, 0x0, 0xe6, 0x6, 0xe0, 0xe, 0x60,
+    0x7c, 0x0, 0xe6, 0x3, 0x80, 0xe, 0x60, 0xfe, 0x0, 0xe6, 0x3e, 0xf8,
+    0xe, 0xf, 0x83, 0xe0, 0xe1, 0xe0, 0x1e, 0x4, 0x18, 0x0, 0x0,
+
+    /* U+7B97 */
+    0x2, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0xf9, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x38, 0xc3, 0xc, 0x7, 0xc, 0x70, 0xc0, 0x40, 0x40, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xe0, 0x0, 0xe0, 0x70, 0x0, 0xe, 0x3, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x1, 0xc0, 0x30, 0x0, 0x3c, 0x3, 0x0,
+    0x1f, 0x80, 0x30, 0x3, 0xe0, 0x3, 0x0, 0x30, 0x0, 0x20, 0x0,
+
+    /* U+7BA1 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xf, 0xf9, 0xff, 0xe1, 0xff,
+    0xdf, 0xfe, 0x39, 0xc3, 0x9c, 0x7, 0xc, 0x30, 0xc0, 0x60, 0x46, 0xc,
+    0x0, 0x0, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x70,
+    0x0, 0x0, 0xe7, 0x0, 0x0, 0xe, 0x73, 0xff, 0xfc, 0xe7, 0x7f, 0xff,
+    0xee, 0x26, 0x0, 0xe, 0x40, 0x60, 0x0, 0xe0, 0x7, 0xff, 0xfe, 0x0,
+    0x7f, 0xff, 0xc0, 0x6, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xf0, 0x6, 0x0, 0x3, 0x80, 0x70, 0x0, 0x38,
+    0x7, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7BC0 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xf, 0xf9, 0xff, 0xc1, 0xff,
+    0xdf, 0xfe, 0x3d, 0xc3, 0x9c, 0x7, 0xc, 0x70, 0xc0, 0x60, 0xc6, 0xc,
+    0x0, 0x4, 0x0, 0x40, 0xf, 0xf0, 0x7f, 0x1, 0xff, 0x8f, 0xfc, 0x18,
+    0x1c, 0xff, 0xc1, 0x81, 0xdc, 0xc, 0x1f, 0xfd, 0xc0, 0xc1, 0xff, 0xdc,
+    0xc, 0x18, 0x1d, 0xc0, 0xc1, 0x81, 0xdc, 0xc, 0x18, 0x1d, 0xc0, 0xc1,
+    0xff, 0x9c, 0xc, 0x1f, 0xf1, 0xc0, 0xc1, 0x82, 0x1c, 0xc, 0x18, 0x31,
+    0xc0, 0xc1, 0x83, 0x9c, 0x1c, 0x19, 0xfd, 0xcf, 0xc3, 0xfe, 0xdc, 0xf8,
+    0x7e, 0x5, 0xc0, 0x7, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+7BC7 */
+    0x2, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0xf9, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x38, 0xc3, 0xc, 0x7, 0xc, 0x70, 0xc0, 0x40, 0x40, 0x0,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c, 0x0, 0x1, 0xc1, 0x80, 0x0,
+    0x1c, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf0, 0x18, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xf8, 0x1b, 0xff, 0xff, 0xc1, 0xb0, 0xc6, 0x1c, 0x3b, 0xc,
+    0x61, 0xc3, 0xbf, 0xff, 0xfc, 0x33, 0xff, 0xff, 0xc7, 0x30, 0xc6, 0xc,
+    0x73, 0xc, 0x63, 0xc6, 0x30, 0xc6, 0x78, 0x1, 0x0, 0x2, 0x0,
+
+    /* U+7BC9 */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xf, 0xf9, 0xff, 0xc1, 0xff,
+    0xdf, 0xfe, 0x39, 0xc3, 0x9c, 0x7, 0xc, 0x70, 0xc0, 0x60, 0x46, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0xfc, 0x3, 0xfe, 0x71, 0xc0, 0x3,
+    0x6, 0xc, 0x0, 0x30, 0x6c, 0xc2, 0x3, 0x26, 0xec, 0x60, 0x7f, 0xe6,
+    0xe6, 0x3f, 0xdc, 0x2f, 0xe7, 0xc1, 0x80, 0x7c, 0x0, 0x16, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f,
+    0x80, 0x0, 0x7, 0xfe, 0x0, 0x3, 0xe6, 0x78, 0x1, 0xf8, 0x63, 0xf8,
+    0x7e, 0x6, 0xf, 0xe7, 0x80, 0x60, 0x1e, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7C3D */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xe, 0x0, 0xf, 0xf8, 0xff, 0xc1, 0xff,
+    0xdf, 0xfe, 0x3d, 0xc3, 0x9c, 0x7, 0xc, 0x30, 0xc0, 0x60, 0xce, 0xe,
+    0x0, 0xd, 0xf8, 0x40, 0x0, 0x79, 0xc0, 0x0, 0xf, 0xf, 0x0, 0x7,
+    0xc0, 0x3e, 0x1, 0xfc, 0x1, 0xfc, 0x7c, 0xff, 0xf3, 0xe7, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf, 0xf0, 0x1f, 0xf9, 0xff, 0x81,
+    0x81, 0x98, 0x18, 0x1c, 0x39, 0x83, 0x81, 0xff, 0x9f, 0xf8, 0xf, 0xf0,
+    0xff, 0x0, 0x38, 0x3, 0x0, 0x3, 0x80, 0x78, 0x0, 0x7e, 0xf, 0xe0,
+    0x1e, 0x7b, 0xc7, 0x87, 0x81, 0x78, 0x1e, 0x60, 0x2, 0x0, 0x40,
+
+    /* U+7C3E */
+    0x2, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0xf9, 0xff, 0xe1, 0xff,
+    0xdf, 0xfe, 0x38, 0xc3, 0xc, 0x7, 0xc, 0x20, 0xc0, 0x40, 0x43, 0x0,
+    0x0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe1, 0x83, 0x1, 0x80, 0x18,
+    0x30, 0x18, 0x1, 0xbf, 0xff, 0xfe, 0x18, 0x1c, 0x70, 0x1, 0x81, 0xc6,
+    0x0, 0x19, 0xff, 0xff, 0x81, 0x81, 0xc6, 0x38, 0x38, 0x1c, 0x61, 0xc3,
+    0xbf, 0xff, 0xfe, 0x30, 0x1c, 0x61, 0x83, 0x1, 0xc6, 0x18, 0x31, 0xff,
+    0xff, 0x83, 0x3, 0xc7, 0x80, 0x70, 0x7c, 0x7c, 0x7, 0x1e, 0xc6, 0xf0,
+    0x67, 0x8c, 0x63, 0xe6, 0xe0, 0xc6, 0xe, 0x0, 0x8, 0x20, 0x0,
+
+    /* U+7C4D */
+    0x2, 0x0, 0x40, 0x0, 0x60, 0xc, 0x0, 0xf, 0xf9, 0xff, 0xe1, 0xff,
+    0xdf, 0xfe, 0x39, 0xc3, 0x9c, 0x7, 0xc, 0x70, 0xc0, 0x60, 0xc6, 0xc,
+    0x0, 0x10, 0x8, 0x20, 0x3, 0x0, 0xc6, 0x3, 0xff, 0x1c, 0x70, 0x3f,
+    0xf7, 0xff, 0xc0, 0x30, 0x1c, 0x70, 0x3, 0x80, 0xc6, 0x1, 0xff, 0xc,
+    0x70, 0x3, 0x87, 0xff, 0xe0, 0x30, 0x7f, 0xfe, 0x7f, 0xf0, 0x0, 0x7,
+    0xff, 0x1f, 0xf0, 0x3, 0x3, 0xff, 0x80, 0x7c, 0x30, 0x18, 0xf, 0xe3,
+    0x1, 0x81, 0xb7, 0x3f, 0xf8, 0x3b, 0x3b, 0x1, 0x87, 0x30, 0x30, 0x18,
+    0x63, 0x3, 0xff, 0x80, 0x30, 0x3f, 0xf8, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+7C60 */
+    0x6, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0xfd, 0xff, 0xe3, 0xff,
+    0xbf, 0xfe, 0x38, 0xc3, 0xc, 0x7, 0x4, 0x70, 0xc0, 0x41, 0x1, 0x80,
+    0x0, 0x38, 0x1c, 0x0, 0x3f, 0xfd, 0xff, 0xc1, 0xff, 0x98, 0x0, 0xc,
+    0x61, 0xff, 0x0, 0xc6, 0xf, 0xfc, 0x7f, 0xfc, 0x0, 0xc7, 0xff, 0xc7,
+    0xfc, 0x0, 0x1, 0xff, 0x81, 0xff, 0x1c, 0x0, 0x1f, 0xf9, 0xff, 0x83,
+    0x81, 0x9f, 0xf8, 0x3f, 0xf9, 0x80, 0x3, 0xff, 0x9f, 0xf8, 0x38, 0x19,
+    0x80, 0x3, 0xff, 0x9c, 0x0, 0x3f, 0xf9, 0xff, 0x83, 0x81, 0x98, 0x2,
+    0x38, 0x39, 0xc0, 0xe3, 0x8f, 0x9f, 0xfe, 0x10, 0x70, 0x3f, 0x0,
+
+    /* U+7C64 */
+    0x2, 0x0, 0x40, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0xf9, 0xff, 0xe1, 0xff,
+    0xff, 0xfe, 0x38, 0xc3, 0xc, 0x7, 0xc, 0x70, 0xc0, 0x44, 0x8, 0x60,
+    0x0, 0xc1, 0x86, 0x60, 0x1c, 0x38, 0x67, 0x1, 0xf3, 0xe6, 0x30, 0x33,
+    0x66, 0x61, 0x3, 0x16, 0x26, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x73, 0x87,
+    0x0, 0x3, 0x38, 0x60, 0x3, 0xf3, 0xf7, 0x18, 0x7, 0x38, 0x33, 0x80,
+    0x73, 0x83, 0x30, 0x3f, 0x3f, 0x37, 0x0, 0x73, 0x83, 0xe0, 0x7, 0x38,
+    0x1e, 0x23, 0xf3, 0xf1, 0xc6, 0x3, 0x30, 0x3c, 0x60, 0x33, 0xe7, 0xe6,
+    0x7f, 0xff, 0xe7, 0xe7, 0xf0, 0x1c, 0x3e, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+7C73 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x20, 0xc, 0x6, 0x7, 0x0, 0xe0,
+    0x60, 0x70, 0xe, 0x6, 0xe, 0x0, 0x70, 0x60, 0xe0, 0x3, 0x86, 0x1c,
+    0x0, 0x10, 0x60, 0x80, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xf8,
+    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x7, 0x6e, 0x0, 0x0, 0xe6, 0x60, 0x0,
+    0x1c, 0x67, 0x0, 0x3, 0x86, 0x3c, 0x0, 0x70, 0x61, 0xe0, 0x1e, 0x6,
+    0xf, 0x83, 0xc0, 0x60, 0x3c, 0x78, 0x6, 0x1, 0xe7, 0x0, 0x60, 0xe,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7C89 */
+    0x2, 0x0, 0x0, 0x0, 0x30, 0x7, 0xc0, 0x3, 0x0, 0x7e, 0x6, 0x33,
+    0x0, 0xe0, 0x73, 0x73, 0x6, 0x3, 0x36, 0x30, 0x70, 0x33, 0x63, 0x7,
+    0x0, 0x30, 0x70, 0x30, 0x7, 0x6, 0x3, 0x87, 0xfe, 0xe0, 0x38, 0x7f,
+    0xec, 0x1, 0xc0, 0x71, 0x80, 0xe, 0x7, 0x38, 0x0, 0xe0, 0xf3, 0xff,
+    0xfe, 0xf, 0x87, 0xff, 0x81, 0xfc, 0xc, 0x18, 0x1b, 0x60, 0xc1, 0x83,
+    0xb7, 0x18, 0x18, 0x73, 0x31, 0x81, 0x87, 0x30, 0x18, 0x18, 0x63, 0x3,
+    0x81, 0x80, 0x30, 0x30, 0x38, 0x3, 0x7, 0x3, 0x80, 0x30, 0xe0, 0x70,
+    0x3, 0x3c, 0x3f, 0x0, 0x37, 0x83, 0xe0, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7CA5 */
+    0x0, 0x6, 0x0, 0xf, 0xc0, 0xc3, 0xf1, 0xfc, 0x18, 0x7f, 0x3, 0xd3,
+    0x30, 0x70, 0x3a, 0x66, 0x6, 0x3, 0x6d, 0xc0, 0xc0, 0xed, 0xb0, 0x18,
+    0x1d, 0xb6, 0x7, 0x3f, 0x6, 0xf, 0xc7, 0xc0, 0xc3, 0xf1, 0xc1, 0xff,
+    0xe0, 0x30, 0x3f, 0xfc, 0x6, 0x0, 0xe1, 0x80, 0xe0, 0x1c, 0x30, 0x1f,
+    0xc3, 0x87, 0xf1, 0xfc, 0xfc, 0x7f, 0x3, 0x9f, 0xc0, 0xe0, 0x72, 0xd8,
+    0xc, 0xe, 0xdb, 0x83, 0x81, 0xbb, 0x38, 0x70, 0x36, 0x63, 0xc, 0x7,
+    0xcc, 0x1, 0x80, 0xd1, 0x80, 0x30, 0x38, 0x30, 0xe, 0x3e, 0x6, 0xf,
+    0xc7, 0xc0, 0xc1, 0xf0, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+7CBE */
+    0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0xf, 0xff, 0xc6, 0x66,
+    0xff, 0xfe, 0x66, 0x60, 0x38, 0x3, 0x66, 0x3, 0x0, 0x36, 0xc7, 0xff,
+    0x80, 0x60, 0x3f, 0xf8, 0x6, 0x0, 0x30, 0x7, 0xfc, 0x3, 0x80, 0x7f,
+    0xdf, 0xff, 0xe0, 0xe0, 0xff, 0xfc, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x3f,
+    0xf8, 0x1f, 0x87, 0xff, 0x81, 0xfc, 0x60, 0x1c, 0x3e, 0xc6, 0x1, 0xc3,
+    0x66, 0x7f, 0xfc, 0x76, 0x66, 0x1, 0xc6, 0x60, 0x60, 0x1c, 0x66, 0x7,
+    0xff, 0xc4, 0x60, 0x7f, 0xfc, 0x6, 0x6, 0x1, 0xc0, 0x60, 0x60, 0x1c,
+    0x6, 0x6, 0x3, 0x80, 0x60, 0x60, 0xf8, 0x6, 0x6, 0x6, 0x0,
+
+    /* U+7CD5 */
+    0x6, 0x2, 0x2, 0x0, 0x60, 0x30, 0x60, 0x6, 0x3, 0x6, 0x6, 0x66,
+    0x38, 0x60, 0x66, 0xe1, 0xc, 0x7, 0x6d, 0xff, 0xfc, 0x36, 0xdf, 0xff,
+    0xe0, 0x68, 0x7, 0x0, 0x6, 0x0, 0x30, 0x7, 0xfe, 0x3, 0x0, 0x7f,
+    0xc0, 0x30, 0x0, 0xe0, 0xff, 0xfc, 0xe, 0xf, 0xff, 0xc0, 0xf0, 0x3,
+    0x0, 0x1f, 0x80, 0x30, 0x1, 0xfc, 0x3, 0x0, 0x3e, 0xc0, 0x30, 0x3,
+    0x67, 0xff, 0xfe, 0x76, 0x3f, 0xff, 0xe6, 0x60, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0x4, 0x61, 0x90, 0x88, 0x6, 0x19, 0x9c, 0xc0, 0x63, 0x98, 0xce,
+    0x6, 0x31, 0xcc, 0xe0, 0x63, 0xc, 0xc6, 0x6, 0x20, 0x0, 0x20,
+
+    /* U+7CFB */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x1f, 0xf0, 0x1f, 0xff, 0xff, 0x3, 0xff,
+    0xf8, 0x0, 0x3e, 0x38, 0x0, 0x0, 0x3, 0x83, 0x0, 0x0, 0x70, 0x70,
+    0x1, 0xc6, 0xf, 0x0, 0xf, 0xc1, 0xe0, 0x0, 0x7c, 0x3c, 0x0, 0x1,
+    0xe3, 0x80, 0x0, 0x7, 0xf0, 0xe0, 0x0, 0x3e, 0x7, 0x0, 0x1, 0xc0,
+    0x38, 0x0, 0x38, 0x3f, 0xc7, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xc0, 0xe0,
+    0x0, 0xe0, 0x6, 0x0, 0xe, 0x10, 0x0, 0x30, 0xe1, 0x80, 0x7, 0xe,
+    0x1e, 0x0, 0xe0, 0xe0, 0xf0, 0x1c, 0xe, 0x7, 0x83, 0x80, 0xe0, 0x3c,
+    0x70, 0xe, 0x1, 0xe6, 0x0, 0xe0, 0x4, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+7CFE */
+    0x0, 0x0, 0x0, 0x80, 0xc0, 0x0, 0x70, 0x70, 0x0, 0x1c, 0x18, 0x1,
+    0x7, 0xe, 0x30, 0xc1, 0xdf, 0x18, 0x30, 0x77, 0x8e, 0xc, 0x1c, 0xf3,
+    0x3, 0x7, 0xf, 0x80, 0xc1, 0xc1, 0xe0, 0x30, 0x70, 0x73, 0xc, 0x1c,
+    0x18, 0xc3, 0x7, 0xf, 0xf8, 0xc1, 0xdf, 0xfe, 0x30, 0x77, 0xb1, 0x8c,
+    0x1c, 0xc, 0x3, 0x7, 0x13, 0x20, 0xc1, 0xcc, 0xcc, 0x31, 0xf3, 0x33,
+    0xf, 0xfc, 0xcc, 0xdf, 0xff, 0x33, 0x3f, 0x81, 0xdc, 0xc6, 0x0, 0x76,
+    0x31, 0x80, 0x1d, 0x8c, 0x0, 0x7, 0x3, 0x0, 0x1, 0xc0, 0xc0, 0x0,
+    0x70, 0x10, 0x0, 0x8,
+
+    /* U+7D00 */
+    0x3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0x7, 0xff, 0x0, 0xe0,
+    0x7f, 0xf8, 0xc, 0x60, 0x1, 0x87, 0xce, 0x0, 0x18, 0x78, 0xc0, 0x1,
+    0x83, 0xdc, 0x0, 0x18, 0x1f, 0x80, 0x1, 0x80, 0x70, 0x0, 0x18, 0x7,
+    0x60, 0x1, 0x80, 0xe7, 0x1f, 0xf8, 0x3f, 0xf3, 0xff, 0x87, 0xff, 0xb0,
+    0x0, 0x7f, 0x1b, 0x0, 0x0, 0x30, 0x30, 0x0, 0x33, 0x23, 0x0, 0x3,
+    0x37, 0x30, 0x0, 0x33, 0x33, 0x0, 0x7, 0x33, 0x30, 0x0, 0x63, 0x33,
+    0x0, 0x66, 0x33, 0x30, 0x6, 0x63, 0x13, 0x0, 0x64, 0x30, 0x30, 0x1e,
+    0x3, 0x3, 0xff, 0xc0, 0x30, 0x1f, 0xf8, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+7D04 */
+    0x3, 0x0, 0xc0, 0x0, 0xe0, 0x18, 0x0, 0x1c, 0x7, 0x0, 0x7, 0x0,
+    0xe0, 0x0, 0xc6, 0x18, 0x0, 0xf9, 0xc7, 0xfe, 0x1e, 0x30, 0xff, 0xf1,
+    0xee, 0x1f, 0xfe, 0x1f, 0x87, 0x0, 0xc0, 0xe1, 0xc0, 0x18, 0x1c, 0xb0,
+    0x3, 0x7, 0x18, 0x0, 0x61, 0xff, 0x0, 0xc, 0xff, 0xe3, 0x81, 0x9f,
+    0xc6, 0x30, 0x30, 0x18, 0x7, 0x6, 0x33, 0x20, 0x60, 0xc6, 0x66, 0xe,
+    0x18, 0xcc, 0xc0, 0xc3, 0x39, 0x98, 0x0, 0x66, 0x33, 0x80, 0x1c, 0xc6,
+    0x70, 0x3, 0x98, 0xc6, 0x0, 0x62, 0x18, 0x0, 0x1c, 0x3, 0x0, 0x3f,
+    0x80, 0x60, 0x7, 0xe0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+7D05 */
+    0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0,
+    0xff, 0xfc, 0xc, 0x6f, 0xff, 0xc7, 0xce, 0x3, 0x0, 0x79, 0xc0, 0x30,
+    0x3, 0xdc, 0x3, 0x0, 0x1f, 0x80, 0x30, 0x0, 0x70, 0x3, 0x0, 0x6,
+    0x60, 0x30, 0x0, 0xe3, 0x3, 0x0, 0x3f, 0xf0, 0x30, 0x7, 0xff, 0x83,
+    0x0, 0x7f, 0x18, 0x30, 0x0, 0x30, 0x3, 0x0, 0x33, 0x20, 0x30, 0x3,
+    0x33, 0x3, 0x0, 0x33, 0x30, 0x30, 0x7, 0x33, 0x3, 0x0, 0x63, 0x30,
+    0x30, 0x6, 0x33, 0x3, 0x0, 0x63, 0x0, 0x30, 0x4, 0x31, 0xff, 0xfe,
+    0x3, 0x1f, 0xff, 0xe0, 0x30, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D17 */
+    0x2, 0x0, 0x10, 0x0, 0x60, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0xe0,
+    0x3, 0x0, 0xc, 0x40, 0x30, 0x7, 0x8c, 0x33, 0x30, 0x79, 0xc3, 0x33,
+    0x83, 0xd8, 0x33, 0x18, 0xf, 0x7, 0x31, 0xc0, 0x70, 0x63, 0xe, 0x6,
+    0x46, 0x30, 0xe0, 0xc6, 0xe3, 0x6, 0x1f, 0xec, 0x30, 0x7, 0xfe, 0x43,
+    0x0, 0x7f, 0x20, 0x30, 0xc0, 0x60, 0x3, 0x1c, 0x26, 0x40, 0x31, 0xc3,
+    0x66, 0x1f, 0x38, 0x76, 0x61, 0xe7, 0x6, 0x66, 0x0, 0x60, 0x66, 0x60,
+    0xc, 0x6, 0x66, 0x3, 0xc0, 0x66, 0x20, 0x78, 0x4, 0x60, 0x3e, 0x0,
+    0x6, 0x1f, 0x80, 0x0, 0x61, 0xf0, 0x0, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D19 */
+    0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0xfc, 0x6, 0x1, 0xff, 0x80, 0xe0,
+    0x7f, 0xc0, 0xc, 0x47, 0x1c, 0x7, 0x8c, 0x60, 0xc0, 0x79, 0xc6, 0xc,
+    0x3, 0xd8, 0x60, 0xc0, 0xf, 0x86, 0xc, 0x0, 0x70, 0x60, 0xc0, 0x6,
+    0x47, 0x1c, 0x0, 0xc6, 0x7f, 0xfe, 0x1d, 0xe7, 0xff, 0xc7, 0xff, 0x60,
+    0xc0, 0x7f, 0x36, 0xc, 0x0, 0x60, 0x60, 0xc0, 0x36, 0x46, 0xe, 0x3,
+    0x66, 0x60, 0xe0, 0x76, 0x66, 0xe, 0x7, 0x66, 0x60, 0x62, 0x66, 0x66,
+    0x6, 0x26, 0x66, 0x61, 0x76, 0x66, 0x26, 0xf3, 0x66, 0x60, 0x7e, 0x3e,
+    0x6, 0x1f, 0x81, 0xe0, 0x61, 0xc0, 0xc, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D1A */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x1f, 0xfe, 0x0, 0xc1,
+    0xff, 0xe0, 0x1c, 0xc3, 0x6, 0x7, 0x8c, 0x30, 0x60, 0x79, 0xc3, 0xe,
+    0x3, 0xf8, 0x30, 0xc0, 0x1f, 0x3, 0x8c, 0x0, 0x70, 0x38, 0xc0, 0xe,
+    0x43, 0x8f, 0xc0, 0xc6, 0x38, 0xfc, 0x1f, 0xe3, 0xc0, 0xc7, 0xff, 0x6c,
+    0xc, 0x7e, 0x36, 0x41, 0xc0, 0x60, 0x66, 0x18, 0x36, 0xc6, 0x61, 0x83,
+    0x6c, 0x63, 0x30, 0x36, 0x6c, 0x33, 0x7, 0x66, 0xc1, 0xe0, 0x66, 0x6c,
+    0x1e, 0x6, 0x67, 0x81, 0xe0, 0x66, 0x38, 0x3f, 0x4, 0x63, 0x7, 0x3c,
+    0x6, 0x73, 0xe1, 0xe0, 0x62, 0x38, 0xe, 0x6, 0x2, 0x0, 0x0,
+
+    /* U+7D20 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x38, 0x0, 0x0, 0x27, 0xe,
+    0x0, 0x3, 0xe1, 0xc0, 0x0, 0x1e, 0x38, 0x40, 0x0, 0x7f, 0x6, 0x0,
+    0x3, 0xe0, 0x38, 0x0, 0x1f, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xee,
+    0x0, 0xe0, 0x0, 0x60, 0x0, 0x3, 0x86, 0x1e, 0x1, 0xf8, 0x60, 0xf8,
+    0x7e, 0x6, 0x7, 0xe7, 0x80, 0x60, 0xe, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7D22 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x1, 0x80, 0xe, 0x70,
+    0x38, 0x60, 0xe7, 0x33, 0xe, 0xe, 0x23, 0xe1, 0xc0, 0x40, 0x1e, 0x38,
+    0x0, 0x0, 0x7f, 0xe, 0x0, 0x3, 0xe0, 0x70, 0x0, 0x1c, 0x7, 0x83,
+    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc3, 0x80, 0xe0, 0xe, 0x0, 0x6,
+    0x0, 0x0, 0x38, 0x61, 0xc0, 0xf, 0x86, 0x1f, 0x87, 0xe0, 0x60, 0x7e,
+    0x78, 0x6, 0x1, 0xe6, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+7D2B */
+    0x0, 0xc0, 0xc0, 0x0, 0xc, 0xc, 0x0, 0x8, 0xc0, 0xc3, 0xc1, 0x8f,
+    0xcc, 0xf8, 0x18, 0xfc, 0xff, 0x1, 0x8c, 0xf, 0x80, 0x18, 0xc0, 0xc0,
+    0x1, 0x8c, 0xc, 0x6, 0x18, 0xde, 0xc0, 0x61, 0xff, 0xee, 0x1e, 0x7f,
+    0xe0, 0xff, 0xc7, 0xc1, 0x87, 0xf8, 0x0, 0x38, 0x0, 0x0, 0x77, 0xe,
+    0x0, 0x3, 0xe1, 0xc0, 0x0, 0x1e, 0x38, 0x40, 0x0, 0x7f, 0x7, 0x0,
+    0x3, 0xe0, 0x78, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xce,
+    0x0, 0xe0, 0x0, 0x60, 0x0, 0x3, 0x86, 0x3c, 0x1, 0xf8, 0x61, 0xf8,
+    0x7e, 0x6, 0x7, 0xe7, 0x0, 0x60, 0xe, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+7D30 */
+    0x2, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x38, 0xf, 0xfc, 0x7, 0x3,
+    0xff, 0xe1, 0xc6, 0x73, 0x9c, 0xf1, 0xcc, 0x61, 0x9e, 0x71, 0x8c, 0x31,
+    0xec, 0x31, 0x86, 0x1f, 0x86, 0x30, 0xc0, 0xe0, 0xc6, 0x18, 0x19, 0x18,
+    0xc3, 0x6, 0x33, 0x18, 0x61, 0xfe, 0x63, 0x8c, 0xff, 0xef, 0xff, 0x9f,
+    0xcd, 0xff, 0xf0, 0x30, 0x31, 0x86, 0x36, 0x46, 0x30, 0xc6, 0xcc, 0xc6,
+    0x18, 0xd9, 0x98, 0xc3, 0x33, 0x33, 0x18, 0x66, 0x66, 0x63, 0xc, 0xcc,
+    0xcc, 0x61, 0x99, 0x99, 0x8c, 0x32, 0x30, 0x39, 0xce, 0x6, 0x7, 0xff,
+    0xc0, 0xc0, 0x7f, 0xe0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+7D39 */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x18, 0x3f, 0xff, 0x7, 0x3,
+    0xff, 0xe0, 0xc6, 0x6, 0xe, 0xf1, 0x81, 0xc1, 0xde, 0x70, 0x38, 0x31,
+    0xec, 0x7, 0x6, 0xf, 0x80, 0xc0, 0xc0, 0xe0, 0x38, 0x18, 0x19, 0xe,
+    0x3, 0x6, 0x33, 0xc3, 0xe1, 0xfe, 0x70, 0xf8, 0xff, 0xe8, 0x18, 0x1f,
+    0xcc, 0x0, 0x0, 0x30, 0x1f, 0xfc, 0x36, 0x67, 0xff, 0xc6, 0xcc, 0xe0,
+    0x18, 0xd9, 0x98, 0x3, 0x33, 0x33, 0x0, 0x66, 0x67, 0x60, 0xc, 0xcc,
+    0x6c, 0x1, 0x99, 0x8d, 0x80, 0x32, 0x30, 0x38, 0x6, 0x6, 0x7, 0xff,
+    0xc0, 0xc0, 0x7f, 0xf0, 0x8, 0x0, 0x0, 0x0,
+
+    /* U+7D42 */
+    0x2, 0x0, 0x80, 0x0, 0x70, 0x18, 0x0, 0x6, 0x1, 0x80, 0x0, 0xe0,
+    0x38, 0x0, 0xc, 0xe3, 0xff, 0x87, 0x8c, 0x7f, 0xf8, 0x79, 0xcf, 0x3,
+    0x83, 0xd8, 0xd8, 0x30, 0xf, 0x19, 0x87, 0x0, 0x71, 0xc, 0xe0, 0x6,
+    0x40, 0x7c, 0x0, 0xc6, 0x7, 0x80, 0x1f, 0xe0, 0x78, 0x7, 0xff, 0x1f,
+    0xe0, 0x7f, 0x33, 0xcf, 0x80, 0x60, 0xf0, 0x3e, 0x26, 0x4e, 0x41, 0xe3,
+    0x66, 0x8f, 0x0, 0x76, 0x60, 0x7c, 0x6, 0x66, 0x1, 0xc0, 0x66, 0x70,
+    0x4, 0x6, 0x63, 0x0, 0x0, 0x66, 0x37, 0xe0, 0x4, 0x60, 0x3f, 0xe0,
+    0x6, 0x0, 0x7f, 0x80, 0x60, 0x0, 0x7c, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D50 */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0xe, 0x0, 0x30, 0x0, 0xc0,
+    0x3, 0x0, 0x1c, 0xcf, 0xff, 0xe7, 0x8d, 0xff, 0xfe, 0x79, 0x80, 0x78,
+    0x3, 0xf8, 0x3, 0x0, 0x1f, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0xe,
+    0x40, 0x30, 0x0, 0xc6, 0xff, 0xfe, 0x1f, 0xef, 0xff, 0xc7, 0xfe, 0x0,
+    0x0, 0x7e, 0x20, 0x0, 0x0, 0x60, 0x0, 0x0, 0x36, 0x47, 0xff, 0x83,
+    0x66, 0x7f, 0xfc, 0x76, 0x66, 0x1, 0xc6, 0x66, 0x60, 0xc, 0x66, 0x66,
+    0x0, 0xc6, 0x66, 0x60, 0xc, 0x66, 0x66, 0x0, 0xc4, 0x60, 0x60, 0x1c,
+    0x6, 0x7, 0xff, 0x80, 0x60, 0x3f, 0xf8, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D66 */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x3, 0x0, 0x6, 0x0, 0x70, 0x0, 0xe0,
+    0x7, 0x0, 0xc, 0x0, 0xf8, 0x1, 0xcc, 0x1d, 0xc0, 0x79, 0xc1, 0x8c,
+    0x7, 0x98, 0x38, 0x60, 0x3f, 0x87, 0x7, 0x81, 0xf0, 0xe0, 0x3c, 0x6,
+    0x1c, 0x1, 0xe0, 0xeb, 0xff, 0xfe, 0xc, 0xd3, 0xff, 0x1, 0xfe, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x7, 0xe6, 0x0, 0x0, 0x6, 0x3, 0xff, 0x3,
+    0x68, 0x7f, 0xf8, 0x36, 0xce, 0x1, 0x83, 0x6c, 0xe0, 0x18, 0x76, 0xee,
+    0x1, 0x86, 0x66, 0xe0, 0x18, 0x66, 0x6e, 0x1, 0x86, 0x66, 0xe0, 0x18,
+    0x46, 0xe, 0x1, 0x80, 0x60, 0x7f, 0xf8, 0x6, 0x3, 0xff, 0x0, 0x60,
+    0x0, 0x0,
+
+    /* U+7D71 */
+    0x2, 0x0, 0x20, 0x0, 0x70, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0xe0,
+    0x3, 0x0, 0xc, 0xdf, 0xff, 0xe7, 0x8d, 0xff, 0xfe, 0x79, 0xc0, 0xc0,
+    0x3, 0x98, 0xc, 0x0, 0x1f, 0x0, 0xc2, 0x0, 0x70, 0x18, 0x30, 0x6,
+    0x41, 0x81, 0x80, 0xc4, 0x18, 0x1c, 0x1f, 0xef, 0xff, 0xc7, 0xfe, 0xff,
+    0xee, 0x7f, 0x21, 0x8c, 0x60, 0x60, 0x18, 0xc0, 0x36, 0x41, 0x8c, 0x3,
+    0x66, 0x18, 0xc0, 0x76, 0x61, 0x8c, 0x7, 0x66, 0x38, 0xc0, 0x66, 0x63,
+    0xc, 0x26, 0x66, 0x70, 0xc6, 0x66, 0x26, 0xc, 0x64, 0x60, 0xe0, 0xc6,
+    0x6, 0x1c, 0xf, 0xe0, 0x63, 0x80, 0x7c, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+7D72 */
+    0x3, 0x0, 0x0, 0x0, 0x70, 0x7, 0x0, 0x7, 0x0, 0x60, 0x0, 0xe0,
+    0xe, 0x10, 0xc, 0x60, 0xc3, 0x7, 0xce, 0x78, 0x70, 0x78, 0xe7, 0x8e,
+    0x3, 0xdc, 0x3c, 0xc0, 0x1f, 0x80, 0xfc, 0x0, 0x78, 0x7, 0x98, 0x7,
+    0x40, 0x31, 0x80, 0xe6, 0x6, 0xc, 0xf, 0xe0, 0xff, 0xc7, 0xff, 0x7f,
+    0xfe, 0x7f, 0x37, 0xf8, 0x60, 0x30, 0x1, 0x82, 0x33, 0x61, 0x19, 0x3,
+    0x36, 0x19, 0x98, 0x33, 0x73, 0x19, 0x87, 0x33, 0x31, 0x9c, 0x63, 0x33,
+    0x19, 0xc6, 0x33, 0x71, 0x8c, 0x63, 0x16, 0x18, 0xe4, 0x30, 0xe1, 0x86,
+    0x3, 0x4, 0x18, 0x20, 0x30, 0x1, 0x80, 0x2, 0x0, 0x10, 0x0,
+
+    /* U+7D93 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x1f, 0xff, 0xe0, 0xc1,
+    0xff, 0xfe, 0x1c, 0xc0, 0x10, 0x87, 0x9c, 0x63, 0x18, 0x79, 0x86, 0x31,
+    0x83, 0xf8, 0xc7, 0x38, 0xf, 0xc, 0x63, 0x0, 0x60, 0xc6, 0x30, 0xe,
+    0xdc, 0x63, 0x0, 0xcc, 0xc6, 0x30, 0x1f, 0xee, 0x71, 0x87, 0xfe, 0x63,
+    0x1c, 0x7e, 0x27, 0x38, 0xc0, 0x60, 0x1, 0x0, 0x36, 0xc0, 0x0, 0x3,
+    0x6c, 0xff, 0xfc, 0x76, 0xef, 0xff, 0xc6, 0x66, 0x3, 0x0, 0x66, 0x60,
+    0x30, 0x6, 0x66, 0x3, 0x0, 0x66, 0x60, 0x30, 0x4, 0x60, 0x3, 0x0,
+    0x6, 0x3f, 0xff, 0xe0, 0x61, 0xff, 0xfe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+7DA0 */
+    0x2, 0x1, 0x0, 0x0, 0x60, 0x30, 0x0, 0xe, 0x3, 0xfe, 0x0, 0xe0,
+    0x7f, 0xf8, 0x1c, 0xc7, 0x3, 0x87, 0x8c, 0x60, 0x38, 0x79, 0xc6, 0x3,
+    0x83, 0xf8, 0x7f, 0xf0, 0x1f, 0x7, 0xff, 0x0, 0x70, 0x0, 0x30, 0xe,
+    0x40, 0x3, 0x0, 0xc6, 0xff, 0xfe, 0x1f, 0xef, 0xff, 0xe7, 0xfe, 0x3,
+    0x0, 0x7f, 0x30, 0x30, 0x40, 0x60, 0x63, 0xe, 0x36, 0x46, 0x39, 0xc3,
+    0x64, 0x33, 0xf8, 0x36, 0x60, 0x3e, 0x6, 0x66, 0x3, 0x60, 0x66, 0x61,
+    0xb3, 0x6, 0x66, 0x7b, 0x38, 0x66, 0xf, 0x31, 0xc4, 0x61, 0xc3, 0xe,
+    0x6, 0x18, 0x70, 0x60, 0x60, 0x1f, 0x0, 0x2, 0x1, 0xc0, 0x0,
+
+    /* U+7DAD */
+    0x2, 0x1, 0x2, 0x0, 0x60, 0x38, 0x60, 0x6, 0x3, 0x6, 0x0, 0xe0,
+    0x70, 0xe0, 0xc, 0xc6, 0xc, 0x7, 0x8c, 0xe1, 0xc0, 0x79, 0xcf, 0xff,
+    0xe3, 0xf9, 0xff, 0xfe, 0x1f, 0x1e, 0xc, 0x0, 0x73, 0x60, 0xc0, 0xe,
+    0x46, 0xc, 0x0, 0xc6, 0x71, 0xc0, 0x1f, 0xe7, 0xff, 0xc7, 0xfe, 0x7f,
+    0xf8, 0x7e, 0x36, 0xc, 0x0, 0x60, 0x60, 0xc0, 0x36, 0x46, 0xc, 0x3,
+    0x6c, 0x7f, 0xfc, 0x36, 0x67, 0xff, 0xc6, 0x66, 0x61, 0xc0, 0x66, 0x66,
+    0xc, 0x6, 0x66, 0x60, 0xc0, 0x66, 0x66, 0xc, 0x4, 0x60, 0x71, 0xc0,
+    0x6, 0x7, 0xff, 0xe0, 0x60, 0x3f, 0xfe, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+7DB1 */
+    0x6, 0x0, 0x0, 0x0, 0xc0, 0xff, 0xe0, 0x38, 0x3f, 0xff, 0x6, 0xf,
+    0x0, 0xe1, 0x8d, 0x80, 0x4c, 0xf3, 0xb3, 0x1d, 0x9c, 0x66, 0x63, 0x31,
+    0xdc, 0xc6, 0x66, 0x1f, 0x18, 0x98, 0xc1, 0xc3, 0x7f, 0xd8, 0x32, 0x6f,
+    0xff, 0x6, 0x6c, 0x18, 0x61, 0xfd, 0x83, 0xc, 0xff, 0xb2, 0x6d, 0x9f,
+    0x9e, 0xcd, 0xb0, 0x30, 0xd9, 0xb6, 0x26, 0x9b, 0x36, 0xc4, 0xdb, 0x66,
+    0xd9, 0x9b, 0x6c, 0xdb, 0x33, 0x6d, 0x9b, 0x66, 0x6d, 0x9f, 0xec, 0xcd,
+    0xb3, 0xf9, 0x99, 0x96, 0x0, 0x32, 0x30, 0xc0, 0x6, 0x6, 0x18, 0x3,
+    0xc0, 0xc3, 0x0, 0xf8, 0x10, 0x20, 0x1c, 0x0,
+
+    /* U+7DB2 */
+    0x6, 0x0, 0x0, 0x0, 0xc0, 0x7f, 0xe0, 0x38, 0x3f, 0xff, 0x6, 0xf,
+    0x0, 0xe1, 0x8d, 0x90, 0x4c, 0xf3, 0xb3, 0x19, 0x9c, 0x66, 0x63, 0x31,
+    0xd8, 0xc6, 0x66, 0x1f, 0x18, 0x18, 0xc1, 0xc3, 0x7f, 0xd8, 0x32, 0x6f,
+    0xff, 0x6, 0x6c, 0x0, 0x61, 0xfd, 0x83, 0xc, 0xff, 0xb0, 0x61, 0x9f,
+    0x96, 0xff, 0xb0, 0x30, 0xdf, 0xfe, 0x26, 0x99, 0x80, 0xc6, 0xdb, 0x30,
+    0x19, 0x9b, 0x66, 0x3, 0x33, 0x6c, 0xc0, 0x66, 0x6d, 0x9c, 0xc, 0xcd,
+    0xb1, 0xfd, 0x99, 0x96, 0x1f, 0x32, 0x30, 0xc0, 0x6, 0x6, 0x18, 0x3,
+    0xc0, 0xc3, 0x0, 0xf8, 0x10, 0x20, 0x1c, 0x0,
+
+    /* U+7DDA */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x7, 0x0, 0xe, 0x0, 0x60, 0x0, 0xc0,
+    0x7f, 0xf8, 0x1c, 0xcf, 0xff, 0xc7, 0x9c, 0xc0, 0x1c, 0x79, 0xcc, 0x0,
+    0xc3, 0xf8, 0xff, 0xfc, 0xf, 0xf, 0xff, 0xc0, 0x70, 0xc0, 0xc, 0xe,
+    0x4c, 0x0, 0xc0, 0xcc, 0xff, 0xfc, 0x1f, 0xef, 0xff, 0x87, 0xfe, 0x3,
+    0x0, 0x7e, 0x20, 0x30, 0x40, 0x61, 0xf3, 0x8c, 0x26, 0x5f, 0xbb, 0xc3,
+    0x6c, 0x3b, 0xf0, 0x76, 0x63, 0x36, 0x6, 0x66, 0x33, 0x60, 0x66, 0x66,
+    0x33, 0x6, 0x62, 0xe3, 0x38, 0x66, 0x1c, 0x31, 0xc4, 0x63, 0x83, 0xe,
+    0x6, 0x30, 0xf0, 0x60, 0x60, 0x1f, 0x0, 0x6, 0x1, 0xc0, 0x0,
+
+    /* U+7DE3 */
+    0x2, 0x2, 0x0, 0x0, 0x60, 0x30, 0x0, 0xe, 0x7, 0xff, 0x0, 0xc0,
+    0x7f, 0xf0, 0x1c, 0xc6, 0x3, 0x7, 0x9c, 0x60, 0x30, 0x79, 0x8f, 0xff,
+    0x3, 0xf8, 0x7f, 0xf0, 0xf, 0x0, 0x7, 0x0, 0x60, 0x0, 0x70, 0xe,
+    0xdf, 0xff, 0xe0, 0xcd, 0xff, 0xfe, 0x3f, 0xe0, 0xe0, 0x7, 0xfe, 0x3e,
+    0xc, 0x6, 0x2f, 0x61, 0x80, 0x61, 0xc7, 0x30, 0x26, 0xc0, 0xfe, 0x3,
+    0x6c, 0x3d, 0xc0, 0x76, 0xc7, 0xbe, 0x6, 0x6d, 0xe7, 0xf0, 0x66, 0xf8,
+    0xfb, 0x6, 0x64, 0x3d, 0x9c, 0x66, 0xf, 0x98, 0xe4, 0x63, 0xe1, 0x86,
+    0x6, 0x78, 0x38, 0x20, 0x62, 0xf, 0x80, 0x4, 0x0, 0xe0, 0x0,
+
+    /* U+7DE8 */
+    0x2, 0x0, 0x0, 0x0, 0x61, 0xff, 0xfe, 0xe, 0x3f, 0xff, 0xe0, 0xc0,
+    0x0, 0x0, 0x1c, 0xc0, 0x0, 0x7, 0x9c, 0x3f, 0xf0, 0x79, 0x8f, 0xff,
+    0xc3, 0xf8, 0xe0, 0x1c, 0xf, 0xc, 0x0, 0xc0, 0x70, 0xc0, 0xc, 0xe,
+    0xcf, 0xff, 0xc0, 0xcc, 0xff, 0xf8, 0x1f, 0xec, 0x0, 0x7, 0xfe, 0xc0,
+    0x0, 0x7e, 0x6f, 0xff, 0xc0, 0x61, 0xff, 0xfc, 0x26, 0x5f, 0x66, 0x63,
+    0x6d, 0xf6, 0x66, 0x66, 0xdb, 0x66, 0xe6, 0x65, 0xbf, 0xfe, 0x66, 0x7b,
+    0xff, 0xe6, 0x63, 0xb6, 0x66, 0x66, 0x33, 0x66, 0x64, 0x63, 0x36, 0x66,
+    0x6, 0x73, 0x66, 0xc0, 0x66, 0x32, 0x7c, 0x6, 0x2, 0x1, 0x80,
+
+    /* U+7DEC */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0xff, 0xfc, 0xe, 0x3f, 0xff, 0xe0, 0xc1,
+    0xff, 0xfe, 0x1c, 0xc0, 0x60, 0x7, 0x9c, 0x6, 0x0, 0x79, 0x80, 0xe0,
+    0x3, 0xf8, 0x7f, 0xf8, 0x1f, 0xf, 0xff, 0xc0, 0x60, 0xcc, 0xdc, 0xe,
+    0x8c, 0xcc, 0xc0, 0xcc, 0xcc, 0xcc, 0x1f, 0xcc, 0xcc, 0xc7, 0xfe, 0xcf,
+    0xcc, 0x7e, 0x6c, 0xfc, 0xc0, 0x60, 0xcc, 0xcc, 0x26, 0x8c, 0xcc, 0xc3,
+    0x6c, 0xcc, 0xcc, 0x76, 0xcc, 0xfc, 0xc6, 0x6c, 0xcf, 0xcc, 0x66, 0xec,
+    0xcc, 0xc6, 0x66, 0xcc, 0xcc, 0x66, 0x6c, 0xcc, 0xc4, 0x60, 0xcc, 0xcc,
+    0x6, 0xf, 0xff, 0xc0, 0x60, 0x7f, 0xf8, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+7DF4 */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0xe, 0x0, 0x30, 0x0, 0xc1,
+    0xff, 0xfe, 0x1c, 0xdf, 0xff, 0xe7, 0x9c, 0x3, 0x0, 0x79, 0x80, 0x30,
+    0x3, 0xf8, 0x7f, 0xf8, 0xf, 0xf, 0xff, 0xc0, 0x60, 0xc7, 0xc, 0xe,
+    0xcd, 0x32, 0xc0, 0xcc, 0xd3, 0x6c, 0x1f, 0xed, 0xb6, 0xc7, 0xfe, 0xdb,
+    0x4c, 0x7e, 0x2c, 0x30, 0xc0, 0x60, 0xff, 0xfc, 0x26, 0x4f, 0xff, 0xc3,
+    0x6c, 0xf, 0x80, 0x66, 0x40, 0xfc, 0x6, 0x66, 0x1b, 0xe0, 0x66, 0x63,
+    0x37, 0x6, 0x60, 0xe3, 0x38, 0x66, 0x1c, 0x31, 0xe4, 0x63, 0x83, 0xe,
+    0x6, 0x70, 0x30, 0x60, 0x60, 0x3, 0x0, 0x6, 0x0, 0x20, 0x0,
+
+    /* U+7E23 */
+    0x0, 0x0, 0x0, 0x40, 0x7f, 0x3, 0xfc, 0x7, 0xfb, 0xff, 0x86, 0x61,
+    0xbf, 0x80, 0x66, 0x18, 0x30, 0x6, 0x7f, 0x83, 0x18, 0x67, 0xfb, 0x61,
+    0x86, 0x61, 0xbe, 0x38, 0x66, 0x19, 0xc7, 0x6, 0x7f, 0x8f, 0x60, 0x66,
+    0x18, 0x7e, 0x6, 0x61, 0x81, 0xc8, 0x67, 0x38, 0x18, 0xc6, 0x7f, 0x83,
+    0x8c, 0x60, 0x3, 0xff, 0xe7, 0x0, 0x3f, 0xe6, 0x7f, 0xfc, 0x1c, 0x23,
+    0xff, 0xc1, 0xc0, 0x1, 0x80, 0xdd, 0x80, 0x99, 0xd, 0xd8, 0x19, 0x99,
+    0xdd, 0xc3, 0x99, 0x99, 0xcc, 0x31, 0x8d, 0x9c, 0xe7, 0x18, 0x31, 0xc6,
+    0x61, 0x83, 0x1c, 0x24, 0x18, 0x1, 0xc0, 0x0, 0x80, 0x8, 0x0,
+
+    /* U+7E2E */
+    0x4, 0x0, 0x30, 0x0, 0xe0, 0x3, 0x0, 0xc, 0x0, 0x30, 0x1, 0xc0,
+    0xff, 0xf8, 0x19, 0x9f, 0xff, 0xe7, 0x99, 0xc0, 0xe, 0x73, 0x98, 0x0,
+    0x63, 0xb1, 0xb0, 0x6, 0x1f, 0x1f, 0xff, 0xc0, 0xe0, 0x6f, 0xf8, 0xc,
+    0x8e, 0xc, 0x1, 0xc8, 0xe0, 0xc0, 0x1f, 0xce, 0x18, 0x7, 0xfd, 0xe7,
+    0xf8, 0x7e, 0x7e, 0x7f, 0xc0, 0x63, 0xee, 0xc, 0x26, 0xb6, 0xe0, 0xc2,
+    0x6c, 0x6e, 0xc, 0x66, 0xc6, 0xff, 0xc6, 0x6c, 0x6f, 0xfc, 0x66, 0xc6,
+    0xe0, 0xc6, 0x6c, 0x6e, 0xc, 0x66, 0xc6, 0xe0, 0xc4, 0x64, 0x6e, 0x1c,
+    0x6, 0x6, 0x7f, 0xc0, 0x60, 0x67, 0xf8, 0x4, 0x4, 0x0, 0x0,
+
+    /* U+7E3D */
+    0x2, 0x0, 0x20, 0x0, 0x60, 0x7, 0x0, 0xe, 0x0, 0x60, 0x0, 0xc0,
+    0xff, 0xfc, 0x1c, 0xcf, 0xff, 0xc7, 0x9d, 0xc2, 0xc, 0x79, 0x98, 0x60,
+    0xc3, 0xf9, 0xfe, 0x6c, 0xf, 0x1f, 0xec, 0xc0, 0x61, 0x9f, 0xcc, 0xe,
+    0x9b, 0xbe, 0xc0, 0xcd, 0x93, 0xfc, 0x1f, 0xd8, 0x33, 0xc7, 0xff, 0xc2,
+    0xc, 0x7e, 0x7f, 0xff, 0xc0, 0x60, 0xff, 0xfc, 0x36, 0x80, 0x0, 0x3,
+    0x6c, 0x18, 0x0, 0x76, 0xc1, 0xb1, 0x86, 0x6c, 0x99, 0x98, 0x66, 0xf9,
+    0x98, 0xc6, 0x67, 0x98, 0xe, 0x66, 0x59, 0x82, 0x64, 0x61, 0x98, 0x66,
+    0x6, 0x31, 0xfe, 0x0, 0x60, 0x1f, 0xe0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+7E55 */
+    0x2, 0x0, 0x2, 0x0, 0x60, 0x30, 0x30, 0xe, 0x3, 0x86, 0x0, 0xc0,
+    0xff, 0xfc, 0x1c, 0xdf, 0xff, 0xe7, 0x9c, 0x3, 0x0, 0x79, 0x80, 0x30,
+    0x3, 0xf8, 0x7f, 0xf8, 0xf, 0x7, 0xff, 0x80, 0x60, 0x3, 0x0, 0xe,
+    0x80, 0x30, 0x0, 0xcd, 0xff, 0xfe, 0x1f, 0xef, 0xff, 0xe7, 0xfe, 0x30,
+    0x30, 0x7e, 0x61, 0x2, 0x0, 0x60, 0x38, 0x70, 0x26, 0x1f, 0xff, 0xe3,
+    0x6c, 0x0, 0x0, 0x36, 0xc0, 0x0, 0x6, 0x66, 0x7f, 0xf8, 0x66, 0x67,
+    0xff, 0xc6, 0x66, 0xe0, 0xc, 0x66, 0x6c, 0x0, 0xc4, 0x60, 0xc0, 0xc,
+    0x6, 0xf, 0xff, 0xc0, 0x60, 0x7f, 0xf8, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+7E69 */
+    0x4, 0x0, 0x0, 0x0, 0xe0, 0xff, 0xf8, 0xc, 0xf, 0xff, 0xc1, 0xc1,
+    0xcd, 0x8c, 0x19, 0x98, 0xd8, 0xc7, 0x99, 0x8d, 0x8c, 0x73, 0x9f, 0xdf,
+    0xc3, 0xb0, 0xfd, 0xfc, 0x1f, 0x0, 0xdc, 0x0, 0xe0, 0xd, 0x80, 0xc,
+    0x8f, 0xdf, 0xc1, 0xc8, 0xfd, 0xfc, 0x1f, 0xd8, 0xd8, 0xe7, 0xfd, 0x8d,
+    0x86, 0x7e, 0x5c, 0xdc, 0xe0, 0x61, 0xfd, 0xfe, 0x26, 0x9c, 0xdc, 0xe2,
+    0x6d, 0x8d, 0x86, 0x66, 0xd8, 0xd8, 0x66, 0x6d, 0xcd, 0xfc, 0x66, 0xcf,
+    0xdf, 0xc6, 0x6c, 0xd, 0xc0, 0x66, 0x40, 0xd8, 0x64, 0x60, 0xd, 0x86,
+    0x6, 0x0, 0xff, 0xe0, 0x60, 0x7, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+7E73 */
+    0x4, 0x0, 0x6, 0x0, 0x60, 0x60, 0x60, 0xe, 0x6, 0x6, 0x0, 0xc1,
+    0xf8, 0xc0, 0x1c, 0xbf, 0xcc, 0x7, 0x9b, 0xc, 0xc0, 0x71, 0xb0, 0xcf,
+    0xe3, 0xb3, 0xfd, 0xfe, 0x1f, 0x38, 0xdc, 0xc0, 0xe3, 0xd, 0xcc, 0xc,
+    0xb9, 0xfc, 0xc0, 0xcd, 0xff, 0xcc, 0x1f, 0xc6, 0x3c, 0xc7, 0xfc, 0x62,
+    0xcc, 0x7e, 0x46, 0x4, 0xc0, 0x63, 0xfe, 0x4c, 0x26, 0xbf, 0xc7, 0x82,
+    0x68, 0xc0, 0x78, 0x66, 0x8f, 0x87, 0x86, 0x6d, 0xfc, 0x30, 0x66, 0xd8,
+    0xe3, 0x6, 0x6d, 0x84, 0x78, 0x66, 0x30, 0xcf, 0x84, 0x67, 0xd, 0xdc,
+    0x6, 0x67, 0xd8, 0xe0, 0x6e, 0x7b, 0x86, 0x4, 0x0, 0x20, 0x20,
+
+    /* U+7E8C */
+    0x4, 0x0, 0x20, 0x0, 0xe0, 0x7, 0x0, 0xc, 0x3f, 0xff, 0xe0, 0xc1,
+    0xff, 0xfc, 0x18, 0x80, 0x70, 0x7, 0x98, 0xff, 0xfc, 0x73, 0x80, 0x0,
+    0x3, 0xb0, 0x7f, 0xf8, 0x1f, 0x1f, 0xff, 0xc0, 0xe1, 0x99, 0x86, 0xc,
+    0x9b, 0x8f, 0xe0, 0xc9, 0xa0, 0xe, 0x19, 0xdf, 0xff, 0xc7, 0xfc, 0x7f,
+    0xf0, 0x7e, 0x43, 0xff, 0x0, 0x60, 0xff, 0xfc, 0x26, 0x8c, 0x0, 0xc2,
+    0x68, 0xff, 0xfc, 0x26, 0xcc, 0x0, 0xc6, 0x6c, 0xff, 0xfc, 0x66, 0xcf,
+    0xff, 0xc6, 0x6c, 0xc0, 0xc, 0x66, 0x4f, 0xff, 0xc4, 0x60, 0x3f, 0xe0,
+    0x6, 0x7, 0x8f, 0x0, 0x63, 0xf0, 0x7e, 0x4, 0x30, 0x0, 0xe0,
+
+    /* U+7F69 */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38, 0x60, 0xc1, 0xc3, 0x6,
+    0xc, 0xc, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0xe0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+7F72 */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38, 0x60, 0xc1, 0xc3, 0x6,
+    0xc, 0xc, 0x38, 0x70, 0xe1, 0xc1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x0, 0x1, 0x80, 0x10, 0xf, 0xff, 0xc7, 0x1, 0xff, 0xfe, 0xe0, 0x0,
+    0x18, 0x3c, 0x0, 0x1, 0x87, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x1e, 0x0, 0x0, 0x7, 0x80, 0x0, 0x7, 0xff, 0xff, 0x3,
+    0xff, 0xff, 0xf0, 0x7f, 0x80, 0x3, 0x86, 0x38, 0x0, 0x38, 0x3, 0xff,
+    0xff, 0x80, 0x38, 0x0, 0x38, 0x1, 0x80, 0x3, 0x80, 0x1f, 0xff, 0xf0,
+    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7F77 */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38, 0x60, 0xc1, 0xc3, 0x6,
+    0xc, 0xc, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x2, 0x0, 0x0,
+    0x0, 0x62, 0xc, 0x18, 0xe, 0x39, 0xcf, 0x80, 0xe7, 0xdf, 0xe0, 0x7f,
+    0xfd, 0xe0, 0x7, 0xe0, 0x7c, 0x6, 0x0, 0x1, 0xc0, 0xe1, 0xff, 0x8f,
+    0xfe, 0x1f, 0xf8, 0xff, 0xc3, 0x81, 0x80, 0x0, 0x3f, 0xf8, 0xc0, 0x3,
+    0xff, 0x9c, 0x3c, 0x38, 0x19, 0xff, 0x83, 0x81, 0x9f, 0xc0, 0x3f, 0xf9,
+    0xc0, 0x3, 0xff, 0x9c, 0x6, 0x38, 0x19, 0xc0, 0x63, 0x87, 0x8f, 0xfe,
+    0x38, 0xf8, 0xff, 0xc1, 0x6, 0x0, 0x0,
+
+    /* U+7F85 */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38, 0x60, 0xc1, 0xc3, 0x6,
+    0xc, 0xc, 0x38, 0x70, 0xe1, 0xc3, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
+    0x0, 0xe0, 0x18, 0x60, 0xc, 0x43, 0xe, 0x1, 0xcc, 0x70, 0xc0, 0x79,
+    0xc7, 0xff, 0xe3, 0xb8, 0xff, 0xfe, 0x1f, 0x1e, 0x1c, 0x0, 0xe5, 0xe0,
+    0xc0, 0xe, 0x67, 0xff, 0x87, 0xfe, 0x7f, 0xfc, 0x7f, 0x36, 0x1c, 0x0,
+    0x60, 0x60, 0xc0, 0x26, 0x46, 0x1c, 0x3, 0x66, 0x7f, 0xfc, 0x66, 0x67,
+    0xff, 0x86, 0x66, 0x60, 0xc0, 0x66, 0x76, 0xc, 0x6, 0x62, 0x7f, 0xfe,
+    0x6, 0x3, 0xff, 0xe0, 0x60, 0x0, 0x0,
+
+    /* U+7F8E */
+    0x0, 0x80, 0x30, 0x0, 0x1c, 0x7, 0x0, 0x0, 0xc0, 0x60, 0x0, 0xe,
+    0xe, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x4, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf8, 0x0, 0x0, 0x1b,
+    0x80, 0x0, 0x3, 0x9c, 0x0, 0x0, 0xf0, 0xf0, 0x0, 0x3e, 0x7, 0xe0,
+    0x3f, 0x80, 0x1f, 0xe7, 0xe0, 0x0, 0x7e, 0x60, 0x0, 0x0, 0x40,
+
+    /* U+7F9E */
+    0x0, 0x80, 0x10, 0x0, 0x1c, 0x3, 0x80, 0x0, 0xe0, 0x70, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x0,
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x3, 0x3f, 0xfe, 0x0,
+    0x70, 0x60, 0x60, 0xe, 0x6, 0x6, 0x1, 0xff, 0xff, 0xfe, 0x3d, 0xff,
+    0xff, 0xe3, 0x80, 0x60, 0x60, 0x70, 0xe, 0x6, 0x6, 0x0, 0xe0, 0x60,
+    0x7, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfc,
+
+    /* U+7FA4 */
+    0x0, 0x0, 0x0, 0x83, 0xfe, 0x18, 0x18, 0x7f, 0xf1, 0xc1, 0x80, 0xe3,
+    0x8c, 0x38, 0x6, 0x18, 0xc3, 0x0, 0x61, 0x80, 0x30, 0x3f, 0xf8, 0xff,
+    0xc7, 0xff, 0xdf, 0xfe, 0xe, 0x38, 0xff, 0xc0, 0x61, 0x81, 0xc0, 0x6,
+    0x38, 0x1c, 0x1, 0xff, 0x81, 0xc0, 0x7f, 0xf1, 0xff, 0xc0, 0xc0, 0x1f,
+    0xfc, 0xc, 0x0, 0x1c, 0x1, 0x80, 0x1, 0xc0, 0x1f, 0xf0, 0x1c, 0x3,
+    0xff, 0x81, 0xc0, 0x3c, 0x1b, 0xff, 0xe7, 0xc1, 0xbf, 0xfe, 0x6c, 0x18,
+    0x1c, 0x4, 0xc1, 0x81, 0xc0, 0xc, 0x18, 0x1c, 0x0, 0xff, 0x81, 0xc0,
+    0xf, 0xf8, 0x1c, 0x0, 0x3e, 0x1, 0x80, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+7FA9 */
+    0x0, 0x80, 0x30, 0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x18, 0x44, 0x1, 0xff, 0x8c,
+    0x70, 0x1f, 0xc0, 0xc3, 0x0, 0xc, 0xe, 0x10, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0xc0, 0x60, 0x0, 0xc, 0x7, 0x30, 0x3, 0xfe,
+    0x37, 0x7, 0xff, 0xc3, 0xe0, 0x7d, 0xc0, 0x7c, 0x60, 0xc, 0x1f, 0xc6,
+    0x1, 0xc7, 0xc7, 0xe0, 0xf8, 0xe0, 0x3e, 0x7, 0x0, 0x0, 0x80,
+
+    /* U+7FBD */
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0xff, 0xe7, 0xff, 0x3f, 0xf8, 0x1, 0xc0,
+    0x7, 0x0, 0x30, 0x1, 0xc0, 0xc, 0x0, 0x73, 0x3, 0x18, 0x1c, 0xe0,
+    0xc7, 0x7, 0x1c, 0x30, 0xe1, 0xc3, 0x8c, 0x1c, 0x70, 0x73, 0x3, 0x9c,
+    0x8, 0xc0, 0x47, 0x0, 0x30, 0x1, 0xc0, 0xc, 0x0, 0x70, 0x1b, 0x1,
+    0xdc, 0x1e, 0xc1, 0xf7, 0x1f, 0xb1, 0xf9, 0xdf, 0x8c, 0xf8, 0x77, 0x83,
+    0x38, 0x1d, 0x80, 0xc0, 0x7, 0x0, 0x30, 0x1, 0xc0, 0xc, 0x0, 0x70,
+    0x3, 0x0, 0x1c, 0xf, 0xc0, 0x7f, 0x3, 0xf0, 0x1f, 0x80, 0xf0, 0x7,
+    0x80,
+
+    /* U+7FC1 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x1, 0xc3, 0xf8, 0x0, 0x3c,
+    0x1, 0xc0, 0x7, 0x98, 0xe, 0x1, 0xe3, 0x80, 0x78, 0x7c, 0x38, 0x63,
+    0xe7, 0x7, 0x3, 0x8e, 0x40, 0x60, 0x1c, 0x0, 0xff, 0xff, 0xe0, 0xf,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xbf,
+    0xf8, 0x3f, 0xf9, 0xff, 0x80, 0x1, 0x80, 0x1c, 0x1c, 0x19, 0xc1, 0xc0,
+    0xe1, 0x8f, 0x1c, 0x7, 0x18, 0x71, 0xc0, 0x1, 0x80, 0x1c, 0x1, 0xd8,
+    0xd, 0xc0, 0xfd, 0x87, 0xdc, 0x7f, 0x19, 0xf1, 0xc7, 0x81, 0xbc, 0x1c,
+    0x0, 0xf8, 0x1f, 0x80, 0x1f, 0x81, 0xf8, 0x1, 0xf0, 0x1e, 0x0,
+
+    /* U+7FCE */
+    0x2, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1c, 0x3f, 0x7f, 0x7, 0xc7,
+    0xef, 0xe0, 0xdc, 0xc, 0xc, 0x39, 0xc1, 0x81, 0x86, 0x1c, 0x30, 0x31,
+    0x81, 0xe6, 0x46, 0x70, 0xe, 0xcc, 0xcf, 0xfc, 0xd9, 0xd9, 0x3f, 0x1b,
+    0x1b, 0x0, 0x1, 0xe3, 0x60, 0x0, 0xc, 0xc, 0xff, 0xc1, 0x81, 0x8f,
+    0xf8, 0x30, 0x30, 0x63, 0x6, 0x16, 0xc, 0x63, 0xc7, 0xc1, 0x8c, 0xd9,
+    0xd8, 0x31, 0xbb, 0x73, 0x6, 0x36, 0x7c, 0x60, 0xce, 0x8d, 0xc, 0x1b,
+    0xc1, 0x81, 0x83, 0x20, 0x30, 0x30, 0x60, 0x6, 0x6, 0xc, 0x3, 0xc7,
+    0xc1, 0x80, 0xf8, 0xf8, 0x10, 0xc, 0xc, 0x0,
+
+    /* U+7FD2 */
+    0x7f, 0xe3, 0xff, 0x8f, 0xfe, 0x7f, 0xf8, 0x0, 0xe0, 0x7, 0xc, 0x1c,
+    0x60, 0x61, 0xc3, 0x8f, 0xc, 0x1c, 0x70, 0xe1, 0x80, 0xe, 0x4, 0x30,
+    0x5, 0xc0, 0x66, 0x7, 0xb8, 0x3c, 0xc3, 0xe7, 0x1f, 0x19, 0xf0, 0x67,
+    0x83, 0x30, 0x2, 0x40, 0x60, 0x0, 0xe0, 0x0, 0x7, 0xff, 0xf8, 0x3,
+    0xff, 0xff, 0xc0, 0x70, 0x0, 0x38, 0xc, 0x0, 0x3, 0x81, 0x80, 0x0,
+    0x70, 0x3f, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xc0, 0xc0, 0x0, 0x38, 0x18,
+    0x0, 0x7, 0x3, 0x0, 0x0, 0xc0, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+7FD4 */
+    0x0, 0x60, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x63, 0xff, 0x7f, 0xc, 0x67,
+    0xef, 0xe1, 0x8c, 0xc, 0xc, 0x3, 0x81, 0x81, 0x9f, 0xfc, 0x30, 0x33,
+    0xff, 0x6, 0x46, 0x3, 0xc, 0xcc, 0xc0, 0x61, 0xd9, 0xd8, 0xc, 0x1b,
+    0x1b, 0x1f, 0xf3, 0x63, 0x63, 0xfe, 0xc, 0xc, 0xe, 0x1, 0x81, 0x80,
+    0xc0, 0x30, 0x30, 0x18, 0x6, 0x16, 0x7, 0xe6, 0xc7, 0xcf, 0xfd, 0xd9,
+    0xd9, 0xfc, 0x73, 0x73, 0x3, 0x1c, 0x6c, 0x60, 0x63, 0xc, 0xc, 0xc,
+    0x1, 0x81, 0x83, 0x80, 0x30, 0x30, 0xe0, 0x6, 0x6, 0x38, 0x7, 0xc7,
+    0xce, 0x1, 0xf9, 0xf8, 0x0, 0x1c, 0x1c, 0x0,
+
+    /* U+7FE0 */
+    0x7f, 0xf3, 0xff, 0x87, 0xff, 0xbf, 0xfc, 0x0, 0x38, 0x1, 0xc1, 0xc1,
+    0x8e, 0xc, 0xe, 0x18, 0x70, 0xc0, 0x21, 0x81, 0xc, 0x3, 0x98, 0x3c,
+    0xc3, 0xf9, 0x9f, 0xcc, 0x7e, 0x1b, 0xc0, 0xc0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc0, 0x1c, 0x3,
+    0x80, 0x3, 0xc0, 0x70, 0x0, 0x7e, 0xf, 0xc0, 0x1e, 0x7b, 0xcf, 0x1,
+    0xc1, 0x30, 0x38, 0x0, 0x6, 0x0, 0x83, 0xff, 0xff, 0xfc, 0x7f, 0xff,
+    0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+7FF0 */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x1, 0x0, 0x3, 0x0, 0x30, 0x0, 0x30,
+    0x7, 0x80, 0x7f, 0xf0, 0xfc, 0x7, 0xff, 0x8c, 0xe0, 0x3, 0x1, 0x87,
+    0x0, 0x30, 0x38, 0x3c, 0x1f, 0xc7, 0x1, 0xe3, 0xfe, 0xe0, 0xe, 0x30,
+    0x7c, 0x0, 0x23, 0x3, 0x7c, 0xf8, 0x3f, 0xf7, 0xef, 0xc3, 0xff, 0xe,
+    0xc, 0x30, 0x30, 0x60, 0xc3, 0x7, 0x46, 0xcc, 0x3f, 0xe6, 0x6e, 0xc1,
+    0xfe, 0x36, 0x6c, 0x3, 0x0, 0x60, 0xc0, 0x30, 0x6, 0xc, 0x7f, 0xe1,
+    0x63, 0xc7, 0xff, 0x76, 0xec, 0x7, 0xe, 0x7c, 0xc0, 0x31, 0xc7, 0x8c,
+    0x3, 0x0, 0x60, 0xc0, 0x30, 0xe, 0x1c, 0x3, 0x3, 0xc7, 0xc0, 0x20,
+    0x38, 0x70,
+
+    /* U+7FFB */
+    0x0, 0x10, 0x0, 0x3, 0xfe, 0x71, 0xf1, 0xff, 0xdf, 0xbf, 0x19, 0x81,
+    0xf3, 0xe3, 0x33, 0x6, 0xc, 0x66, 0x60, 0xc1, 0x86, 0xcc, 0x18, 0x30,
+    0x19, 0x13, 0x66, 0x7f, 0xff, 0x6e, 0xcf, 0xff, 0x6c, 0xd8, 0x1e, 0x7,
+    0x8b, 0x7, 0xf0, 0x30, 0x61, 0xbf, 0x6, 0xc, 0x66, 0x70, 0xc1, 0x9c,
+    0xc6, 0x18, 0x72, 0x8, 0xf, 0x1e, 0x1f, 0xf3, 0xe7, 0xc7, 0xfe, 0xed,
+    0xd8, 0xcc, 0x79, 0xf3, 0x19, 0x8e, 0x34, 0x63, 0xff, 0x86, 0xc, 0x7f,
+    0xf0, 0xc1, 0x8c, 0xc6, 0x18, 0x31, 0x98, 0xc3, 0x6, 0x3f, 0xf9, 0xe3,
+    0xc7, 0xfe, 0x7c, 0xf8, 0x0, 0x6, 0xc, 0x0,
+
+    /* U+8000 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0xfd, 0xf8, 0x6, 0x1f, 0xdf, 0xc0, 0x66,
+    0xe, 0xc, 0x66, 0x6c, 0xf8, 0xc6, 0x66, 0x7e, 0xec, 0x36, 0xc3, 0xe6,
+    0xc3, 0x6c, 0xe, 0xc, 0x16, 0x3, 0xe6, 0xc0, 0x60, 0xef, 0xcc, 0x7f,
+    0xec, 0x58, 0xc7, 0xfe, 0x20, 0x84, 0x1d, 0xc6, 0x18, 0x1, 0x98, 0xff,
+    0xfc, 0x19, 0x9f, 0xff, 0xe1, 0x99, 0xe1, 0xc0, 0x19, 0xbe, 0x18, 0x1,
+    0x98, 0x7f, 0xfc, 0x19, 0x87, 0xff, 0xc1, 0x98, 0x61, 0x80, 0x31, 0x97,
+    0xff, 0x83, 0x1f, 0x7f, 0xfc, 0x71, 0xe6, 0x18, 0x7, 0x1c, 0x61, 0x80,
+    0x60, 0x7, 0xff, 0xe4, 0x0, 0x3f, 0xfe,
+
+    /* U+8001 */
+    0x0, 0x10, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x38, 0x3, 0x80, 0x3,
+    0x80, 0x70, 0x1f, 0xff, 0xef, 0x1, 0xff, 0xfe, 0xe0, 0x0, 0x38, 0x1c,
+    0x0, 0x3, 0x83, 0x80, 0x0, 0x38, 0x70, 0x0, 0x3, 0x8e, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xf, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0x0, 0xf8, 0x0, 0x0, 0xf, 0x1, 0xe0, 0x1, 0xc0, 0xfe, 0x0,
+    0x7c, 0x7f, 0x80, 0x1f, 0xff, 0x80, 0x7, 0xcf, 0x80, 0x0, 0x70, 0xc0,
+    0x0, 0xc0, 0xc, 0x0, 0x1c, 0x0, 0xc0, 0x1, 0xc0, 0xe, 0x0, 0x7c,
+    0x0, 0xff, 0xff, 0x80, 0x7, 0xff, 0xf0,
+
+    /* U+8003 */
+    0x0, 0x10, 0x0, 0x0, 0x3, 0x80, 0x10, 0x0, 0x38, 0x3, 0x81, 0xff,
+    0xfe, 0x70, 0x1f, 0xff, 0xfe, 0x0, 0x3, 0x83, 0xc0, 0x0, 0x38, 0x78,
+    0x0, 0x3, 0x8e, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0,
+    0xf, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xf8, 0x7, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x79, 0x80, 0x0, 0x6,
+    0x18, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
+    0x3, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x70,
+    0x0, 0x0, 0xff, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0xf8, 0x0,
+
+    /* U+8005 */
+    0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x18, 0x3, 0x80, 0xff,
+    0xfe, 0x78, 0xf, 0xff, 0xff, 0x0, 0x3, 0x81, 0xe0, 0x0, 0x18, 0x38,
+    0x0, 0x1, 0x87, 0x0, 0x0, 0x19, 0xe0, 0x7, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xff, 0xe0, 0x1, 0xe0, 0x0, 0x0, 0x38, 0x0, 0x0, 0xf, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x3f, 0x0, 0x3, 0x7,
+    0xb0, 0x0, 0x30, 0x63, 0x0, 0x3, 0x0, 0x3f, 0xff, 0xf0, 0x3, 0xff,
+    0xff, 0x0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x38, 0x0, 0x30,
+    0x3, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+800D */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1c, 0x0, 0x0, 0x1,
+    0x80, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x1c, 0x70, 0xe1,
+    0xc1, 0x87, 0xc, 0x1c, 0x18, 0x70, 0xc1, 0xc1, 0x87, 0xc, 0x1c, 0x18,
+    0x70, 0xc1, 0xc1, 0x87, 0xc, 0x7c, 0x18, 0x38, 0xcf, 0x81, 0x3, 0x80,
+    0x0, 0x0, 0x30, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0xc, 0x3, 0x0, 0x1, 0x80, 0x70, 0x0, 0x3c, 0xe, 0x0, 0x1, 0xff,
+    0xc0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0xf, 0xfe, 0x3, 0xff, 0xe3, 0xf8,
+    0x3f, 0xf0, 0x7, 0x80, 0x0, 0x0, 0x8,
+
+    /* U+8033 */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x70,
+    0x0, 0xe0, 0x7, 0x0, 0xe, 0x0, 0x70, 0x0, 0xe0, 0x7, 0xff, 0xfe,
+    0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x70, 0x0, 0xe0, 0x7,
+    0x0, 0xe, 0x0, 0x70, 0x0, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xe0, 0x7, 0xff, 0xfe, 0x0, 0x70, 0x0, 0xe0, 0x7, 0x0, 0xe, 0x0,
+    0x70, 0x0, 0xe0, 0x7, 0x0, 0xff, 0xe1, 0xff, 0xff, 0xfe, 0x7f, 0xff,
+    0xee, 0x7, 0xf0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+8036 */
+    0x7f, 0xfc, 0x3f, 0x7, 0xff, 0xef, 0xfc, 0x1c, 0x38, 0xff, 0xe1, 0x81,
+    0x8c, 0xc, 0x18, 0x18, 0xc1, 0xc1, 0x81, 0x8c, 0x18, 0x1f, 0xf8, 0xc3,
+    0x81, 0xff, 0x8c, 0x30, 0x18, 0x38, 0xc7, 0x1, 0x81, 0x8c, 0x60, 0x18,
+    0x18, 0xc6, 0x1, 0x81, 0x8c, 0x70, 0x1f, 0xf8, 0xc3, 0x81, 0xff, 0x8c,
+    0x18, 0x1c, 0x38, 0xc0, 0xc1, 0x81, 0x8c, 0xc, 0x18, 0x18, 0xc0, 0xe1,
+    0x83, 0x8c, 0xe, 0x18, 0xf8, 0xc0, 0xe1, 0xff, 0x8c, 0xe, 0x7f, 0xb8,
+    0xcf, 0xc7, 0xc1, 0x8c, 0xf8, 0x0, 0x18, 0xc6, 0x0, 0x1, 0x8c, 0x0,
+    0x0, 0x18, 0xc0, 0x0, 0x1, 0xc, 0x0,
+
+    /* U+8056 */
+    0x7f, 0xfe, 0x0, 0x7, 0xff, 0xe3, 0xf0, 0x18, 0x18, 0xff, 0xc1, 0xc1,
+    0x8e, 0x1c, 0x1f, 0xf8, 0xc0, 0xc1, 0xc1, 0x8c, 0xc, 0x18, 0x18, 0xc0,
+    0xc1, 0xff, 0x8c, 0xc, 0x1f, 0xf8, 0xc0, 0xc1, 0x81, 0x8c, 0xc, 0x1c,
+    0xf8, 0xff, 0xc7, 0xff, 0x8f, 0xf8, 0x7e, 0x18, 0x0, 0x0, 0x1, 0x80,
+    0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0xe, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xe,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+805A */
+    0x7f, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x60, 0x63, 0xff, 0xf, 0xfc,
+    0x0, 0xe1, 0xff, 0x88, 0x18, 0x30, 0x31, 0xc6, 0x7, 0xfe, 0x1f, 0x80,
+    0xff, 0xc0, 0xf0, 0x18, 0x18, 0x3f, 0x83, 0x7, 0x1e, 0x78, 0xff, 0xef,
+    0x83, 0xbf, 0xcd, 0xc0, 0x22, 0x1, 0x80, 0x10, 0x1, 0xff, 0xff, 0x7,
+    0xff, 0xff, 0xc0, 0x60, 0x30, 0x0, 0x3, 0x6, 0xc, 0x0, 0x60, 0xc1,
+    0x80, 0x1c, 0x18, 0x70, 0x3, 0x83, 0xe, 0x0, 0xfc, 0x63, 0xe0, 0x39,
+    0xcc, 0xef, 0xe, 0x1d, 0xb8, 0xf1, 0x81, 0x3e, 0x6, 0x20, 0x6, 0x0,
+    0x0, 0x0, 0xc0, 0x0,
+
+    /* U+805E */
+    0x3f, 0xc1, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x19, 0x81, 0xce,
+    0x6, 0x7f, 0xf3, 0xff, 0x98, 0x1c, 0xe0, 0x66, 0x7, 0x38, 0x19, 0xff,
+    0x87, 0xfe, 0x7f, 0xe1, 0xff, 0x98, 0x0, 0x0, 0x66, 0x0, 0x0, 0x19,
+    0x9f, 0xff, 0xf6, 0x61, 0xc0, 0xe1, 0x98, 0x60, 0x18, 0x66, 0x1f, 0xfe,
+    0x19, 0x87, 0xff, 0x86, 0x61, 0x80, 0x61, 0x98, 0x7f, 0xf8, 0x66, 0x1f,
+    0xfe, 0x19, 0x86, 0x1, 0x86, 0x61, 0x81, 0xe1, 0x98, 0xff, 0xf8, 0x66,
+    0x7f, 0x8e, 0x19, 0x80, 0x1, 0xbe, 0x60, 0x0, 0x4f, 0x98, 0x0, 0x3,
+    0x80,
+
+    /* U+806F */
+    0x0, 0x2, 0x0, 0x7, 0xfe, 0x70, 0x30, 0x7f, 0xe6, 0x7, 0x3, 0x9c,
+    0x60, 0x60, 0x31, 0xcc, 0xce, 0xe3, 0x1c, 0xdc, 0xcc, 0x31, 0xf9, 0xbd,
+    0xc3, 0xff, 0xf9, 0xf8, 0x3f, 0xcf, 0xf, 0x83, 0x9c, 0x78, 0x34, 0x31,
+    0xc6, 0xc6, 0xc3, 0x1c, 0xfc, 0x6e, 0x31, 0xff, 0xff, 0xe3, 0xff, 0xc7,
+    0xf6, 0x3f, 0xc0, 0x48, 0x3, 0x9d, 0x8c, 0xc6, 0x31, 0xd8, 0xcc, 0x63,
+    0x1d, 0x8c, 0xc6, 0x31, 0xd8, 0xcc, 0x63, 0x3d, 0xdc, 0xfe, 0x3f, 0xdf,
+    0xcf, 0xe7, 0xfc, 0x7c, 0xc0, 0x71, 0xc1, 0x8c, 0x0, 0x1c, 0x38, 0xc0,
+    0x1, 0xcf, 0xc, 0x0, 0x1d, 0xe0, 0xc0, 0x0, 0x88, 0x8, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8072 */
+    0x1, 0x80, 0x0, 0x3, 0xff, 0xcf, 0xe0, 0x7f, 0xfe, 0xfe, 0x0, 0x18,
+    0xc, 0x66, 0x3, 0xc1, 0x87, 0xe3, 0xff, 0xf8, 0x3c, 0x0, 0x1, 0x0,
+    0x0, 0xff, 0x1f, 0xfc, 0x3f, 0xfd, 0xff, 0xc3, 0x18, 0xcc, 0x38, 0x31,
+    0x8c, 0x7e, 0x3, 0xff, 0xc7, 0xe0, 0x3f, 0xf3, 0xff, 0xe3, 0x0, 0x30,
+    0x1e, 0x6f, 0xff, 0xff, 0x86, 0xff, 0xff, 0xf0, 0x63, 0x0, 0xc, 0x4,
+    0x3f, 0xff, 0xc0, 0x3, 0xff, 0xfc, 0x0, 0x30, 0x0, 0xc0, 0x3, 0xff,
+    0xfc, 0x0, 0x3f, 0xff, 0xc0, 0x3, 0x0, 0xe, 0xc0, 0xff, 0xff, 0xfc,
+    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+
+    /* U+8077 */
+    0x0, 0x2, 0xc, 0x7, 0xfc, 0x30, 0xc0, 0x7f, 0xe3, 0xc, 0x3, 0x9f,
+    0xfe, 0xc0, 0x31, 0xbf, 0xed, 0x83, 0x19, 0x8c, 0xcc, 0x31, 0x98, 0xcc,
+    0xc3, 0xf9, 0x8c, 0xc6, 0x3f, 0x98, 0xcc, 0x3, 0xf9, 0x8c, 0xc0, 0x31,
+    0xff, 0xff, 0xe3, 0x1f, 0xff, 0xfe, 0x31, 0x80, 0xc, 0x3, 0xf8, 0xf8,
+    0xc4, 0x3f, 0x9f, 0xcc, 0xc3, 0xf9, 0x8e, 0xcc, 0x31, 0x98, 0x6d, 0xc3,
+    0x19, 0x86, 0x78, 0x31, 0x9f, 0xe7, 0x83, 0x19, 0xfe, 0x70, 0x3f, 0x98,
+    0x67, 0x27, 0xf9, 0x8e, 0x72, 0x71, 0x9f, 0xdf, 0x60, 0x19, 0xff, 0xbe,
+    0x1, 0x80, 0x71, 0xe0, 0x18, 0xe, 0x1c, 0x1, 0x80, 0xc0, 0x0,
+
+    /* U+807D */
+    0x0, 0x0, 0x20, 0x7, 0xff, 0x3, 0x0, 0x7f, 0xf0, 0x30, 0x3, 0x8c,
+    0xff, 0xfc, 0x18, 0xcf, 0xff, 0xc1, 0xfc, 0x3, 0x0, 0x1f, 0xc0, 0x30,
+    0x1, 0x8c, 0xff, 0xfc, 0x18, 0xcf, 0xff, 0xc1, 0xfc, 0xcc, 0xcc, 0x18,
+    0xcc, 0xcc, 0xc1, 0x8c, 0xcc, 0xcc, 0x19, 0xcf, 0xff, 0xc7, 0xfc, 0x7f,
+    0xf8, 0x7c, 0xc0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x7e, 0xdf, 0xff, 0xe1,
+    0xcc, 0x0, 0x0, 0xc, 0xc0, 0x90, 0x3, 0xec, 0xd9, 0x8c, 0x3e, 0xcd,
+    0x88, 0xc0, 0xcd, 0x98, 0xe, 0xc, 0xd9, 0x82, 0x61, 0xfd, 0x98, 0x66,
+    0x7e, 0xd9, 0xfe, 0x0, 0xc, 0x1f, 0xe0, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+8089 */
+    0x0, 0x10, 0x0, 0x0, 0x1c, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff, 0xfe,
+    0x7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfb, 0x80, 0xc0, 0x1d, 0xc0, 0xe0,
+    0x6, 0xc0, 0x7c, 0x3, 0x60, 0x77, 0x81, 0xb0, 0x71, 0xf0, 0xd8, 0xf0,
+    0x3c, 0x6c, 0xf1, 0x8f, 0x36, 0x70, 0xc1, 0x9b, 0x0, 0xe0, 0xd, 0x80,
+    0x70, 0x6, 0xc0, 0x7c, 0x3, 0x60, 0x77, 0x81, 0xb0, 0x71, 0xe0, 0xd8,
+    0x70, 0x3c, 0x6c, 0xf0, 0xf, 0x36, 0x70, 0x1, 0x9b, 0x0, 0x0, 0xd,
+    0x80, 0x0, 0xe, 0xc0, 0x0, 0x3f, 0x60, 0x0, 0x3f, 0x10, 0x0, 0xe,
+    0x0,
+
+    /* U+80A1 */
+    0xf, 0x81, 0xf8, 0x1, 0xfc, 0x3f, 0xc0, 0x18, 0xc7, 0x1c, 0x1, 0x8c,
+    0x70, 0xc0, 0x18, 0xc7, 0xc, 0x1, 0x8c, 0x70, 0xc6, 0x18, 0xc7, 0xc,
+    0x61, 0xfc, 0x60, 0xc6, 0x1f, 0xce, 0xf, 0xe1, 0x8d, 0xc0, 0x7c, 0x18,
+    0xc8, 0x0, 0x1, 0x8c, 0x0, 0x0, 0x18, 0xcf, 0xff, 0x81, 0x8c, 0xff,
+    0xf8, 0x3f, 0xc0, 0x3, 0x83, 0xfc, 0x30, 0x38, 0x38, 0xc3, 0x7, 0x3,
+    0xc, 0x38, 0x60, 0x30, 0xc1, 0xce, 0x3, 0xc, 0xf, 0xc0, 0x30, 0xc0,
+    0x78, 0x3, 0xc, 0x1f, 0xc0, 0x70, 0xc7, 0xff, 0x6, 0x3d, 0xf8, 0xfe,
+    0x67, 0xde, 0x1, 0xe0, 0x30, 0x0, 0x0,
+
+    /* U+80B2 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x7, 0x2, 0x0, 0x0, 0xe0, 0x38,
+    0x0, 0xc, 0x0, 0xe0, 0x1, 0xdf, 0xff, 0x87, 0xff, 0xff, 0xfc, 0x3f,
+    0xc0, 0x0, 0xe0, 0x0, 0x0, 0x4, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30,
+    0xc, 0x0, 0x3f, 0x0, 0xc0, 0x7, 0xf0, 0xc, 0x0, 0x3c, 0x0,
+
+    /* U+80B4 */
+    0x6, 0x0, 0x2, 0x0, 0x7e, 0x1, 0xe0, 0x1, 0xfe, 0x7c, 0x0, 0x1,
+    0xff, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0xff, 0x83, 0xf0, 0x1f, 0x8, 0xf,
+    0x80, 0x1, 0x80, 0x10, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0,
+    0xf0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x3f, 0xff,
+    0xf0, 0xf, 0x80, 0x7, 0x1, 0xf8, 0x0, 0x30, 0x3b, 0xff, 0xff, 0x7,
+    0x3f, 0xff, 0xf0, 0x43, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0xff,
+    0xff, 0x0, 0x3f, 0xff, 0xf0, 0x3, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30,
+    0x3, 0x80, 0x3f, 0x0, 0x38, 0x3, 0xf0, 0x1, 0x0, 0x3c, 0x0,
+
+    /* U+80BA */
+    0x0, 0x0, 0x30, 0x0, 0xf8, 0x3, 0x0, 0x1f, 0xc0, 0x30, 0x1, 0x9c,
+    0x3, 0x0, 0x18, 0xcf, 0xff, 0xe1, 0x8d, 0xff, 0xfe, 0x18, 0xc0, 0x78,
+    0x1, 0x8c, 0x3, 0x0, 0x1f, 0xc0, 0x30, 0x1, 0xfc, 0x3, 0x0, 0x18,
+    0xc7, 0xff, 0x81, 0x8c, 0xff, 0xfc, 0x18, 0xce, 0x30, 0xc1, 0x8c, 0xc3,
+    0xc, 0x18, 0xcc, 0x30, 0xc1, 0xfc, 0xc3, 0xc, 0x1f, 0xcc, 0x30, 0xc3,
+    0x8c, 0xc3, 0xc, 0x38, 0xcc, 0x30, 0xc3, 0x8c, 0xc3, 0xc, 0x30, 0xcc,
+    0x30, 0xc3, 0xc, 0xc3, 0x1c, 0x30, 0xcc, 0x37, 0xc7, 0xc, 0xc3, 0x38,
+    0x63, 0xc0, 0x30, 0x6, 0x7c, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0,
+
+    /* U+80CC */
+    0x0, 0x60, 0x80, 0x0, 0x6, 0x1c, 0x18, 0x0, 0xe1, 0xc7, 0xc7, 0xfe,
+    0x1f, 0xf8, 0x7f, 0xe1, 0xf8, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x61, 0xc0,
+    0x60, 0x3e, 0x1c, 0xe, 0x7f, 0xe1, 0xff, 0xe7, 0xc6, 0xf, 0xfc, 0x60,
+    0x60, 0x0, 0x0, 0x1f, 0xff, 0x80, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30,
+    0xc, 0x0, 0x3f, 0x0, 0xc0, 0x7, 0xf0, 0xc, 0x0, 0x3c, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+80CE */
+    0x0, 0x0, 0x40, 0x0, 0xf8, 0xe, 0x0, 0x1f, 0xc0, 0xc0, 0x1, 0xcc,
+    0x1c, 0x0, 0x18, 0xc1, 0xc6, 0x1, 0x8c, 0x18, 0x70, 0x18, 0xc3, 0x83,
+    0x81, 0x8c, 0x38, 0x38, 0x1f, 0xc3, 0x1, 0xc1, 0xfc, 0x7f, 0xfe, 0x18,
+    0xdf, 0xff, 0xe1, 0x8d, 0xf8, 0x6, 0x18, 0xc0, 0x0, 0x1, 0x8c, 0x0,
+    0x0, 0x18, 0xc3, 0xff, 0x3, 0xfc, 0x7f, 0xf8, 0x3f, 0xc7, 0x3, 0xc3,
+    0x8c, 0x60, 0x1c, 0x38, 0xc6, 0x1, 0xc3, 0x8c, 0x60, 0x1c, 0x30, 0xc6,
+    0x1, 0xc3, 0xc, 0x60, 0x1c, 0x30, 0xc6, 0x1, 0xc7, 0xc, 0x70, 0x3c,
+    0x73, 0xc7, 0xff, 0x86, 0x7c, 0x3f, 0xf0, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+80FD */
+    0x3, 0x0, 0x80, 0x0, 0x70, 0xc, 0x0, 0x7, 0x0, 0xc0, 0x80, 0x63,
+    0xc, 0x3c, 0xe, 0x38, 0xdf, 0x80, 0xc1, 0xcf, 0xc0, 0x1f, 0xfc, 0xe0,
+    0x7, 0xff, 0xec, 0x0, 0x7c, 0x6, 0xc0, 0x60, 0x0, 0xc, 0xe, 0x1f,
+    0xf8, 0xff, 0xe1, 0xff, 0x8f, 0xfc, 0x18, 0x18, 0xc, 0x1, 0x81, 0x80,
+    0x0, 0x1f, 0xf8, 0xc0, 0x1, 0xff, 0x8c, 0x8, 0x18, 0x18, 0xc7, 0xc1,
+    0x81, 0x8d, 0xf8, 0x18, 0x18, 0xfe, 0x1, 0xff, 0x8e, 0x0, 0x1f, 0xf8,
+    0xc0, 0x1, 0x81, 0x8c, 0x0, 0x18, 0x18, 0xc0, 0x61, 0x81, 0x8e, 0xe,
+    0x18, 0x78, 0xff, 0xe1, 0x8f, 0x87, 0xfc, 0x10, 0x70, 0x0, 0x0,
+
+    /* U+8105 */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x30, 0x0, 0xf, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf8, 0x0, 0xf0, 0x6, 0x3, 0xfc, 0x1f, 0xc3,
+    0xfc, 0x7, 0xf0, 0x3, 0x0, 0x18, 0x7, 0xfe, 0x3f, 0xf0, 0xff, 0xef,
+    0xff, 0x83, 0x8c, 0x18, 0x70, 0x61, 0x86, 0xe, 0x39, 0xf7, 0xcf, 0x9e,
+    0x3c, 0xc1, 0xe3, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x1, 0xc0, 0x0,
+    0xe0, 0x30, 0x0, 0xc, 0x7, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x18,
+    0x0, 0x6, 0x3, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xf8, 0xc, 0x0, 0x3,
+    0x1, 0x80, 0x0, 0xe0, 0x30, 0x1, 0xfc, 0x6, 0x0, 0x1e, 0x0,
+
+    /* U+8166 */
+    0x0, 0x0, 0x0, 0x1, 0xf0, 0xc6, 0x18, 0x7f, 0x38, 0xc6, 0xc, 0xe6,
+    0x38, 0xc1, 0x8c, 0xc6, 0x30, 0x31, 0xb0, 0xc6, 0x6, 0x36, 0x18, 0xc0,
+    0xc6, 0x63, 0x9c, 0x1f, 0xce, 0x31, 0xc3, 0xf8, 0xc7, 0x38, 0x63, 0x18,
+    0x63, 0xc, 0x60, 0x70, 0x1, 0x8c, 0xe, 0x0, 0x31, 0x9f, 0xff, 0x86,
+    0x77, 0xff, 0xf0, 0xfe, 0xe0, 0x6, 0x3f, 0xd9, 0x6, 0xc7, 0x1b, 0x39,
+    0x98, 0xe3, 0x63, 0xe3, 0x18, 0x6c, 0x3c, 0x63, 0xd, 0x8f, 0xcc, 0x61,
+    0xb3, 0x9d, 0x8c, 0x36, 0xe0, 0xf3, 0x86, 0xe0, 0x6, 0x63, 0xdf, 0xff,
+    0xcc, 0xf1, 0xff, 0xf8, 0xc, 0x0, 0x0, 0x0,
+
+    /* U+819C */
+    0x0, 0x1, 0x6, 0x0, 0xf0, 0x18, 0x60, 0x1f, 0xc3, 0x86, 0x1, 0xdd,
+    0xff, 0xfe, 0x18, 0xdf, 0xff, 0xe1, 0x8c, 0x18, 0x60, 0x18, 0xc1, 0x6,
+    0x1, 0x8c, 0x0, 0x0, 0x1f, 0xcf, 0xff, 0xc1, 0xfc, 0xe0, 0x1c, 0x18,
+    0xcc, 0x0, 0xc1, 0x8c, 0xff, 0xfc, 0x18, 0xcf, 0xff, 0xc1, 0x8c, 0xc0,
+    0xc, 0x19, 0xce, 0x1, 0xc1, 0xfc, 0xff, 0xfc, 0x1f, 0xc0, 0x70, 0x3,
+    0x8c, 0x6, 0x0, 0x38, 0xdf, 0xff, 0xe3, 0xd, 0xff, 0xfe, 0x30, 0xc0,
+    0xf0, 0x3, 0xc, 0xf, 0x80, 0x30, 0xc1, 0xcc, 0x7, 0xc, 0x78, 0x78,
+    0x63, 0xdf, 0x3, 0xe6, 0x7b, 0xe0, 0x1e, 0x2, 0x10, 0x0, 0x0,
+
+    /* U+81A0 */
+    0xf, 0x1f, 0x9f, 0x81, 0xfd, 0xfd, 0xfc, 0x1d, 0xc0, 0xc0, 0xc1, 0x8d,
+    0xcd, 0xcc, 0x18, 0xce, 0xce, 0xc1, 0x8c, 0x6c, 0x4c, 0x18, 0xc0, 0xc3,
+    0xc1, 0xfc, 0x7c, 0xfc, 0x1f, 0xce, 0xdc, 0xc1, 0x8d, 0xcf, 0xc, 0x18,
+    0xd0, 0x70, 0x41, 0x8c, 0xf, 0x80, 0x18, 0xc1, 0x8c, 0x1, 0x9c, 0x70,
+    0x70, 0x1f, 0xce, 0x33, 0xc1, 0xfd, 0xc7, 0x1e, 0x38, 0xf1, 0xe0, 0x63,
+    0x8c, 0x78, 0xe0, 0x30, 0xce, 0x1c, 0x3, 0xc, 0x8f, 0x8c, 0x30, 0xc3,
+    0xc3, 0xc3, 0xc, 0x70, 0x78, 0x70, 0xc0, 0x3f, 0x6, 0x3c, 0x3f, 0x80,
+    0x67, 0x9f, 0xc0, 0x0, 0x21, 0xe0, 0x0,
+
+    /* U+81BD */
+    0x0, 0x2, 0x0, 0x0, 0xf0, 0x70, 0x0, 0x1f, 0x8f, 0xfe, 0x1, 0xb9,
+    0xff, 0xe0, 0x31, 0xb8, 0xc, 0x3, 0x1b, 0xff, 0xfe, 0x31, 0x9f, 0xff,
+    0xe3, 0x19, 0x8c, 0xc4, 0x3f, 0x99, 0x8f, 0xc3, 0xf9, 0xf8, 0x7c, 0x31,
+    0x98, 0x0, 0x3, 0x19, 0xbf, 0xfc, 0x31, 0x99, 0xff, 0x83, 0x19, 0xc0,
+    0x0, 0x39, 0x9f, 0xff, 0xe3, 0xf9, 0x80, 0x0, 0x3f, 0x9b, 0xff, 0xc3,
+    0x19, 0x9f, 0xf8, 0x31, 0x98, 0x0, 0x3, 0x19, 0xbf, 0xfc, 0x31, 0xb8,
+    0x0, 0x3, 0x1b, 0x3f, 0xfc, 0x71, 0xb3, 0xff, 0xc6, 0x1b, 0x30, 0xc,
+    0x63, 0xf3, 0x1, 0xc4, 0x7a, 0x3f, 0xfc, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+81C9 */
+    0x0, 0x0, 0x20, 0x0, 0xf8, 0x6, 0x0, 0x1f, 0xc0, 0xe0, 0x1, 0x9c,
+    0x1f, 0x0, 0x18, 0xc1, 0x98, 0x1, 0x8c, 0x39, 0xc0, 0x18, 0xc7, 0xf,
+    0x1, 0x8c, 0xe0, 0x78, 0x1f, 0xdf, 0xff, 0xe1, 0xff, 0xbf, 0xee, 0x18,
+    0xd0, 0x0, 0x21, 0x8c, 0x0, 0x0, 0x18, 0xcf, 0x9f, 0x83, 0x8c, 0xfd,
+    0xfc, 0x39, 0xd8, 0xd8, 0xc3, 0xfd, 0x8d, 0x8c, 0x3f, 0xd8, 0xd8, 0xc3,
+    0x8d, 0xdd, 0xdc, 0x38, 0xcf, 0xdf, 0x83, 0x8c, 0x70, 0x60, 0x30, 0xc6,
+    0x6, 0x3, 0xc, 0x60, 0xe0, 0x30, 0xcf, 0x8f, 0x7, 0xd, 0xd9, 0xf8,
+    0x63, 0xd8, 0x39, 0xc6, 0x7b, 0x87, 0xe, 0x43, 0x0, 0x0, 0x40,
+
+    /* U+81E8 */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0xe0, 0x1, 0xff, 0x9c, 0x0, 0x3f, 0xf7,
+    0xff, 0xe6, 0x60, 0xff, 0xfc, 0xcc, 0x38, 0x0, 0x19, 0x86, 0x0, 0x3,
+    0x31, 0xdf, 0xf8, 0x7f, 0x87, 0xff, 0xf, 0xf8, 0xc0, 0x61, 0x87, 0x18,
+    0xc, 0x30, 0x73, 0x1, 0x86, 0xe, 0x70, 0x70, 0xc1, 0xcf, 0xfe, 0x18,
+    0x38, 0x7f, 0x3, 0xe, 0x0, 0x0, 0x7f, 0xcf, 0x8f, 0x8f, 0xf3, 0xfb,
+    0xf9, 0x9c, 0x73, 0x67, 0x33, 0x8c, 0x6c, 0x66, 0x71, 0x8d, 0x8c, 0xce,
+    0x31, 0xb1, 0x99, 0xc6, 0x36, 0x33, 0xfe, 0xee, 0xee, 0x7f, 0xff, 0xdf,
+    0xc0, 0x0, 0xe1, 0xe0,
+
+    /* U+81EA */
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x7, 0x0, 0x0, 0x18, 0x0, 0x1f,
+    0xff, 0xc1, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x0, 0x7, 0xe0, 0x0,
+    0x1f, 0x80, 0x0, 0x7e, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x7e, 0x0, 0x1, 0xf8, 0x0, 0x7, 0xe0, 0x0, 0x1f, 0x80,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0x80, 0x0,
+    0x7e, 0x0, 0x1, 0xf8, 0x0, 0x7, 0x60, 0x0, 0x1d, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0x0, 0x0, 0x0,
+
+    /* U+81F3 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x3,
+    0x0, 0x0, 0x0, 0x70, 0x30, 0x0, 0x6, 0x3, 0x80, 0x0, 0xe0, 0x1c,
+    0x0, 0xc, 0x0, 0xe0, 0x1, 0xc0, 0x7, 0x1, 0xff, 0xff, 0xf8, 0x3f,
+    0xff, 0xff, 0xc3, 0xc0, 0x60, 0xc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0,
+
+    /* U+81F4 */
+    0x0, 0x0, 0x30, 0x1, 0xff, 0x83, 0x0, 0x7f, 0xfe, 0x70, 0x3, 0xff,
+    0xc7, 0x0, 0x6, 0x0, 0x60, 0x0, 0x62, 0x6, 0x0, 0xe, 0x30, 0xff,
+    0xe0, 0xc3, 0x8f, 0xfe, 0xc, 0x19, 0xc1, 0x83, 0xff, 0xdc, 0x18, 0x7f,
+    0xcf, 0xc3, 0x80, 0x38, 0x3c, 0x38, 0x3, 0x83, 0x63, 0x0, 0x38, 0x66,
+    0x30, 0x3, 0x80, 0x63, 0x3, 0xff, 0xc6, 0x70, 0x3f, 0xfc, 0x76, 0x0,
+    0x38, 0x3, 0x60, 0x3, 0x80, 0x3e, 0x0, 0x38, 0x1, 0xc0, 0x3, 0x80,
+    0x1c, 0x0, 0x3f, 0xc7, 0xe0, 0x1f, 0xfc, 0xff, 0x7, 0xfc, 0x3c, 0x3c,
+    0x78, 0x7, 0x81, 0xe0, 0x0, 0xf0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+81FA */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0xe0, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x87, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0xe6, 0xff, 0xff, 0xf6, 0x67, 0xff, 0xfe, 0x60,
+    0x6, 0x1, 0xc0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x6,
+    0x0, 0x80, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x60, 0x0,
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+81FB */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x7f, 0xe0, 0x60, 0x7, 0xfe,
+    0xff, 0xfc, 0xe, 0xf, 0xff, 0xc0, 0xc0, 0xc, 0x0, 0xc, 0x0, 0xe0,
+    0x1, 0xc8, 0xff, 0xf8, 0x18, 0xc1, 0xcc, 0x1, 0xbc, 0x18, 0xc0, 0x7f,
+    0xe3, 0x8e, 0x7, 0xe7, 0xff, 0xfe, 0x6, 0x7, 0x7, 0x80, 0x60, 0x60,
+    0x38, 0x6, 0xe, 0xfd, 0xc7, 0xfd, 0xff, 0xce, 0x7f, 0xd8, 0x70, 0x60,
+    0x63, 0x87, 0x0, 0x6, 0xf, 0xff, 0x80, 0x60, 0xff, 0xf8, 0x6, 0x0,
+    0xf0, 0x0, 0x7e, 0x1f, 0xc0, 0x3f, 0xe7, 0x3f, 0x7, 0xf1, 0xe3, 0x3c,
+    0x70, 0x3c, 0x31, 0xe0, 0x7, 0x3, 0x4, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+8205 */
+    0x0, 0x18, 0x0, 0x1, 0xff, 0x3f, 0xf0, 0x7f, 0x87, 0xff, 0x1c, 0x0,
+    0x0, 0xe3, 0xff, 0xf, 0xfc, 0x7f, 0xe1, 0xff, 0x8e, 0x0, 0x0, 0x70,
+    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xfc, 0xf, 0xff, 0xff, 0xc1, 0x80, 0x60, 0x18, 0x3f, 0xff, 0xff, 0x7,
+    0xff, 0xff, 0xe0, 0xc0, 0x30, 0xc, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff,
+    0xf0, 0x0, 0x30, 0x0, 0x0, 0xf, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
+    0x78, 0x7, 0x80, 0xe, 0x0, 0x70, 0x7, 0x80, 0xe, 0xf, 0xe0, 0x3f,
+    0x8f, 0xf0, 0xf, 0xf1, 0xf0, 0x0, 0xf0, 0x0,
+
+    /* U+8207 */
+    0x1, 0x90, 0x0, 0x0, 0x79, 0x81, 0xf0, 0x1f, 0x1f, 0xbf, 0x81, 0xc1,
+    0xf8, 0xf8, 0x18, 0x18, 0x1, 0x81, 0x81, 0x80, 0x18, 0x18, 0x18, 0x1,
+    0x81, 0xf9, 0xf1, 0xf8, 0x1f, 0x9f, 0x9f, 0x81, 0x80, 0x18, 0x18, 0x18,
+    0x1, 0x81, 0x81, 0x81, 0x98, 0x18, 0x1f, 0x99, 0x9f, 0x81, 0xf9, 0x99,
+    0xf8, 0x1c, 0x19, 0x83, 0x81, 0x81, 0x98, 0x18, 0x18, 0x11, 0x81, 0x81,
+    0x80, 0x18, 0x18, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x6, 0x0, 0x3, 0xe0, 0x78, 0x0, 0xfc, 0x3, 0xf0,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8208 */
+    0x0, 0x0, 0x0, 0x0, 0xf3, 0xfc, 0xf0, 0x1e, 0x7f, 0xef, 0x81, 0x8e,
+    0x6, 0x7c, 0x38, 0xe0, 0x61, 0xc3, 0x8f, 0xf6, 0x1c, 0x38, 0xff, 0xe1,
+    0xc3, 0xfe, 0x6, 0xfc, 0x3f, 0xe0, 0x6f, 0x83, 0x8e, 0xf6, 0x18, 0x18,
+    0xef, 0x61, 0x81, 0x8f, 0x96, 0x18, 0x1e, 0xf9, 0x6f, 0x81, 0xff, 0x96,
+    0xf8, 0x18, 0xfb, 0x61, 0x81, 0x8e, 0xf6, 0x18, 0x18, 0xe6, 0x61, 0x81,
+    0x8e, 0x6, 0x18, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x2, 0x0, 0x3, 0xe0, 0x7c, 0x0, 0xfc, 0x3, 0xf8,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x3e, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+8209 */
+    0x0, 0x90, 0x0, 0x0, 0xfd, 0xf9, 0xf0, 0x1f, 0x1f, 0x9f, 0x81, 0x81,
+    0x80, 0x18, 0x1c, 0x18, 0x1, 0x81, 0xf9, 0xf9, 0xf8, 0x1c, 0x3, 0x81,
+    0x81, 0x81, 0x18, 0x18, 0x1f, 0x99, 0x9f, 0x81, 0xf9, 0x99, 0xf8, 0x18,
+    0x11, 0x81, 0x81, 0xc0, 0x1c, 0x1c, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfc, 0x3, 0x6, 0xe, 0x0, 0xe0, 0x60, 0x70, 0x3c, 0x6, 0x3, 0xc7,
+    0xbf, 0xff, 0xde, 0x63, 0xff, 0xfc, 0x60, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+820D */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1,
+    0xf0, 0x0, 0x0, 0x7b, 0xc0, 0x0, 0xf, 0x1e, 0x0, 0x1, 0xe0, 0x78,
+    0x0, 0x7c, 0x3, 0xf0, 0x1f, 0x0, 0xf, 0xc7, 0xff, 0xff, 0xfe, 0x71,
+    0xff, 0xf8, 0xe0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x7f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xe0, 0xf, 0xff,
+    0xff, 0x0, 0xe0, 0x0, 0x70, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30,
+    0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8212 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x83, 0xff, 0xc0, 0x7e,
+    0x3f, 0xfc, 0xe, 0x70, 0x3, 0x81, 0xc3, 0x80, 0x70, 0x18, 0x1c, 0xce,
+    0x3, 0x80, 0x8f, 0xc0, 0x7f, 0xf0, 0x78, 0x6, 0xff, 0x1, 0xc0, 0x3,
+    0x80, 0xc, 0x0, 0x38, 0x3f, 0xfc, 0x3, 0x87, 0xff, 0xe7, 0xff, 0x83,
+    0x8e, 0x7f, 0xf8, 0x38, 0xc0, 0x38, 0x3, 0x9c, 0x3, 0x80, 0x39, 0x80,
+    0xfe, 0x3, 0xb0, 0x3f, 0xf8, 0x38, 0x3, 0xff, 0x83, 0x80, 0x30, 0x18,
+    0x38, 0x3, 0x1, 0x83, 0x80, 0x30, 0x18, 0x38, 0x3, 0x83, 0x83, 0x80,
+    0x3f, 0xf9, 0xf0, 0x0, 0xfe, 0x1f, 0x0, 0x0, 0x1, 0xe0, 0x0,
+
+    /* U+821E */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xfc, 0x3e, 0x30, 0xc6, 0x7, 0x63, 0xc, 0x60, 0x6, 0x30, 0xc6,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x63, 0xc, 0x60, 0x6,
+    0x30, 0xc6, 0x0, 0x63, 0xc, 0x60, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff,
+    0xfc, 0x2, 0x0, 0x2, 0x0, 0x60, 0x0, 0x60, 0xf, 0xf3, 0xff, 0xc1,
+    0xff, 0xbf, 0xfc, 0x38, 0x38, 0x7, 0x7, 0x43, 0x18, 0x60, 0x66, 0x71,
+    0x86, 0x0, 0x7e, 0x3f, 0xfe, 0x3, 0xc3, 0xff, 0xe0, 0x78, 0x38, 0x70,
+    0x3f, 0x3, 0x6, 0x7, 0xc0, 0x0, 0x60, 0x60, 0x0, 0x2, 0x0,
+
+    /* U+822A */
+    0x1, 0x0, 0x20, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x30, 0x0, 0x70,
+    0x3, 0x0, 0x1f, 0xe0, 0x70, 0x1, 0xfe, 0xff, 0xfe, 0x18, 0x67, 0xff,
+    0xc1, 0xa6, 0x0, 0x0, 0x1b, 0x60, 0x0, 0x1, 0xb6, 0x0, 0x0, 0x19,
+    0x61, 0xfc, 0x1, 0x86, 0x1f, 0xe0, 0x18, 0xf9, 0x8e, 0x7, 0xff, 0x98,
+    0x60, 0x7f, 0x61, 0x86, 0x3, 0xb6, 0x18, 0x60, 0x1b, 0x61, 0x86, 0x3,
+    0x36, 0x18, 0x60, 0x33, 0x63, 0x86, 0x3, 0x36, 0x30, 0x60, 0x33, 0x63,
+    0x6, 0x23, 0x36, 0x30, 0x66, 0x70, 0x67, 0x6, 0x67, 0x6, 0x60, 0x7e,
+    0x60, 0xee, 0x7, 0xe6, 0x1e, 0xc0, 0x18, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+822C */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x3, 0x0, 0x3, 0x1, 0xfc, 0x0, 0x70,
+    0x1f, 0xe0, 0x1f, 0xe1, 0x86, 0x1, 0xff, 0x18, 0x60, 0x18, 0x31, 0x86,
+    0x61, 0xb3, 0x38, 0x66, 0x1b, 0x33, 0x86, 0x61, 0xb3, 0x30, 0x7e, 0x19,
+    0x37, 0x7, 0xe1, 0x83, 0x60, 0x0, 0x18, 0xf8, 0x0, 0x7, 0xff, 0xbf,
+    0xf8, 0x7f, 0xf3, 0xff, 0xc3, 0xb3, 0x0, 0x18, 0x1b, 0x31, 0x83, 0x83,
+    0xb3, 0x18, 0x30, 0x3b, 0x30, 0xc7, 0x3, 0x33, 0xe, 0xe0, 0x33, 0x30,
+    0x7c, 0x3, 0x33, 0x3, 0x80, 0x70, 0x30, 0x7c, 0x7, 0x3, 0x1f, 0xf8,
+    0x60, 0xf7, 0xc7, 0xe6, 0x1f, 0xf0, 0x1e, 0x1, 0xc0, 0x0, 0x0,
+
+    /* U+8239 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0xc0, 0x3, 0x0, 0x1f, 0x0, 0x30,
+    0x1, 0xf0, 0x1f, 0xe0, 0xc3, 0x1, 0xfe, 0x18, 0x30, 0x18, 0x61, 0x81,
+    0x81, 0xa6, 0x18, 0x18, 0x1b, 0x61, 0x81, 0x81, 0xb6, 0x30, 0x18, 0x19,
+    0x63, 0x0, 0xc1, 0x87, 0x30, 0xc, 0x1b, 0xf6, 0x0, 0xe7, 0xff, 0x60,
+    0x6, 0x7f, 0x64, 0x7e, 0x61, 0xb6, 0x1f, 0xf8, 0x1b, 0x61, 0xc3, 0x83,
+    0xb6, 0x18, 0x18, 0x3b, 0x61, 0x81, 0x83, 0x36, 0x18, 0x18, 0x33, 0x61,
+    0x81, 0x83, 0x26, 0x18, 0x18, 0x30, 0x61, 0x81, 0x87, 0x6, 0x18, 0x18,
+    0x60, 0xe1, 0xff, 0x86, 0x3e, 0x1f, 0xf8, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+8272 */
+    0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0x7, 0xff, 0xf0, 0x0, 0xe0, 0xe, 0x0, 0x3c, 0x1, 0xc0,
+    0x7, 0x80, 0x38, 0x0, 0x7f, 0xff, 0xff, 0x4, 0xff, 0xff, 0xf8, 0xc,
+    0x6, 0x3, 0x81, 0xc0, 0x60, 0x18, 0x1c, 0x6, 0x1, 0x81, 0xc0, 0x60,
+    0x18, 0x1c, 0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81,
+    0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x61, 0xc0, 0x0, 0xe, 0x1c, 0x0, 0x0, 0xe0, 0xf0, 0x0, 0x3e,
+    0xf, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xf0,
+
+    /* U+8277 */
+    0x0, 0x80, 0x10, 0x6, 0x5b, 0x63, 0x0, 0x6f, 0xbe, 0x30, 0x6, 0xfb,
+    0x67, 0xf0, 0x6d, 0xb6, 0x7f, 0x86, 0xfb, 0xee, 0x38, 0x6d, 0xb6, 0xc3,
+    0x7, 0xff, 0xf8, 0x60, 0x65, 0xb7, 0x8e, 0x7, 0x18, 0x67, 0xfc, 0x3f,
+    0xfe, 0xff, 0xc0, 0x0, 0xc, 0xcc, 0x0, 0x0, 0xcc, 0xc7, 0xff, 0xec,
+    0xcc, 0x0, 0x0, 0xcc, 0xc0, 0x0, 0xc, 0xcc, 0x1f, 0xfc, 0xff, 0xc3,
+    0x81, 0xcf, 0xf8, 0x30, 0xc, 0xc0, 0x3, 0xff, 0xcc, 0x0, 0x1f, 0xfc,
+    0xc0, 0x0, 0xc3, 0xc, 0x6, 0xc, 0x30, 0xc0, 0x60, 0xc3, 0xec, 0x6,
+    0x7f, 0xfe, 0xff, 0xe7, 0xf8, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+827E */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x6, 0x0, 0x0, 0xc0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x0, 0xc, 0x6, 0x0, 0x0, 0x40, 0x20, 0x0, 0x20, 0x0, 0x40, 0x3,
+    0x0, 0xc, 0x0, 0x30, 0x1, 0xc0, 0x3, 0x80, 0x18, 0x0, 0x18, 0x3,
+    0x80, 0x1, 0xc0, 0x30, 0x0, 0xe, 0x7, 0x0, 0x0, 0x60, 0xe0, 0x0,
+    0x7, 0x1c, 0x0, 0x0, 0x3b, 0x80, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x1f,
+    0x0, 0x0, 0x7, 0xfc, 0x0, 0x1, 0xf9, 0xf0, 0x0, 0xfe, 0x7, 0xf0,
+    0x7f, 0x80, 0x1f, 0xe7, 0xc0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8299 */
+    0x0, 0x80, 0x20, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30,
+    0x0, 0x8, 0x62, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x1f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0xe, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0,
+    0x1, 0xf0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x70,
+    0xe0, 0x0, 0xe, 0xf, 0x0, 0x3, 0xc0, 0x7c, 0x0, 0xf8, 0x1, 0xf8,
+    0x7e, 0x0, 0x7, 0xe7, 0x80, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+82AC */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x4, 0x2, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x18, 0x7f, 0x0, 0x3,
+    0x80, 0x78, 0x0, 0x78, 0x3, 0x80, 0xf, 0x0, 0x1c, 0x0, 0xe0, 0x0,
+    0xe0, 0x1c, 0x0, 0x7, 0x87, 0xff, 0xff, 0xbe, 0x77, 0xff, 0xfd, 0xe4,
+    0x3, 0x81, 0xe0, 0x0, 0x30, 0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xe, 0x0, 0xe, 0x0, 0xe0, 0x1, 0xe0, 0xc, 0x0, 0x7c, 0x1, 0xc0,
+    0x3f, 0x1, 0xfc, 0x3, 0xc0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+82AF */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x0, 0xc, 0x7, 0x0, 0x0, 0x40, 0x20, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xf, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x43, 0xc0, 0x0, 0x6, 0xc,
+    0x60, 0x8, 0x60, 0x6, 0x1, 0xc6, 0x0, 0x70, 0x18, 0x60, 0x3, 0x81,
+    0x86, 0x0, 0x38, 0x38, 0x60, 0x1, 0xc3, 0x86, 0x0, 0x1c, 0x38, 0x60,
+    0xc, 0xe3, 0x6, 0x1, 0xce, 0x30, 0x60, 0x1c, 0x47, 0x6, 0x3, 0xc0,
+    0x0, 0x7f, 0xf8, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+82B1 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x70,
+    0x0, 0x4, 0x2, 0x0, 0x0, 0x81, 0x0, 0x0, 0x1c, 0x18, 0x0, 0x1,
+    0x81, 0x81, 0x80, 0x38, 0x18, 0x38, 0x7, 0x1, 0x8f, 0x80, 0x70, 0x19,
+    0xf0, 0xf, 0x1, 0xfc, 0x1, 0xf0, 0x1f, 0x0, 0x3b, 0x1, 0xc0, 0x7,
+    0x30, 0x18, 0x0, 0x73, 0x1, 0x80, 0x4, 0x30, 0x18, 0x0, 0x3, 0x1,
+    0x80, 0x60, 0x30, 0x18, 0x6, 0x3, 0x1, 0x80, 0xe0, 0x30, 0x1f, 0xfe,
+    0x3, 0x1, 0xff, 0xc0, 0x30, 0x7, 0xf8, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+82B3 */
+    0x0, 0x80, 0x20, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc4, 0x30,
+    0x0, 0x8, 0x62, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfe, 0x0,
+    0x6, 0x0, 0xf0, 0x0, 0xe0, 0x6, 0x0, 0xc, 0x0, 0x60, 0x1, 0xc0,
+    0x6, 0x0, 0x38, 0x0, 0x60, 0x7, 0x80, 0xe, 0x1, 0xf0, 0x1, 0xe0,
+    0x3c, 0x1, 0xfc, 0x7, 0x80, 0x1f, 0x80, 0x20, 0x0, 0x80, 0x0,
+
+    /* U+82D1 */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x7f, 0x1f, 0xf0, 0xf,
+    0xf9, 0xff, 0x80, 0xff, 0xb8, 0x38, 0x1c, 0x1b, 0x81, 0x83, 0x81, 0xb8,
+    0x18, 0x30, 0x1b, 0x81, 0x87, 0x63, 0xb8, 0x18, 0x67, 0x33, 0x81, 0x80,
+    0x3f, 0x38, 0x38, 0x1, 0xe3, 0x8f, 0x80, 0xe, 0x39, 0xf0, 0x1, 0xc3,
+    0x80, 0x0, 0x38, 0x38, 0x6, 0x7, 0x3, 0x80, 0x61, 0xe0, 0x38, 0xe,
+    0x3c, 0x1, 0xff, 0xe7, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+82D3 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc6, 0x30,
+    0x0, 0xd, 0xe3, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x7, 0xbc, 0x0, 0x0,
+    0xe0, 0xf0, 0x0, 0x3c, 0x7, 0xc0, 0xf, 0x80, 0x1f, 0x83, 0xff, 0xff,
+    0xfe, 0x78, 0xff, 0xf3, 0xe6, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xc0, 0xf, 0xff, 0xfe, 0x0, 0x3, 0x80, 0xe0, 0x0, 0x30,
+    0x6, 0x0, 0x3, 0x0, 0x60, 0x0, 0x30, 0xe, 0x0, 0x3, 0x7, 0xe0,
+    0x0, 0x30, 0xfc, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+82D7 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0xc, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f,
+    0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60,
+    0x18, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x1f, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xf8, 0x18, 0xe, 0x1, 0x81, 0x80, 0x60, 0x18, 0x18, 0x6,
+    0x1, 0x81, 0x80, 0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0xc0, 0x60, 0x38,
+    0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+82F1 */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30,
+    0x0, 0xc, 0x63, 0x0, 0x0, 0xe, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x7,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0xe, 0x7, 0x0, 0xe0, 0xe0,
+    0x70, 0xe, 0xe, 0x7, 0x0, 0xe0, 0xc0, 0x70, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0x1f, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x39,
+    0x80, 0x0, 0x7, 0x1e, 0x0, 0x0, 0xe0, 0xf8, 0x0, 0x7c, 0x3, 0xf0,
+    0x3f, 0x80, 0x1f, 0xe7, 0xe0, 0x0, 0x7e, 0x20, 0x0, 0x0, 0x40,
+
+    /* U+8302 */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x72,
+    0x0, 0xc, 0x63, 0x70, 0x0, 0x6, 0x3, 0x0, 0x0, 0x60, 0x10, 0x7,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xfe, 0xe, 0x7, 0x0, 0x1, 0xc0, 0x30,
+    0x0, 0xc, 0x3, 0x3, 0x1, 0xc0, 0x30, 0x70, 0x1c, 0x3, 0x8f, 0x1,
+    0xc0, 0x19, 0xe0, 0x18, 0x1, 0xbc, 0x1, 0x80, 0xf, 0x80, 0x18, 0x0,
+    0xf0, 0x63, 0x80, 0x3f, 0x6, 0x38, 0xf, 0xb8, 0x67, 0x7, 0xe1, 0xee,
+    0x70, 0xf8, 0xf, 0xe6, 0x1e, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+8303 */
+    0x0, 0xc0, 0x60, 0x0, 0xc, 0x6, 0x0, 0x0, 0xc0, 0x60, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x6, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x4, 0x2, 0x0, 0xc, 0x0, 0x0, 0x0, 0xe1, 0xff, 0xf0, 0x7,
+    0x1f, 0xff, 0x0, 0x11, 0x80, 0x38, 0x0, 0x18, 0x3, 0x83, 0x1, 0x80,
+    0x38, 0x3c, 0x18, 0x3, 0x81, 0xc1, 0x80, 0x38, 0x4, 0x18, 0x3, 0x80,
+    0x1, 0x80, 0xf0, 0x0, 0x18, 0x3f, 0x0, 0x31, 0x83, 0xc0, 0x6, 0x18,
+    0x0, 0x60, 0xe1, 0x80, 0x6, 0x1c, 0x18, 0x0, 0xe1, 0xc1, 0xc0, 0x1e,
+    0x38, 0x1f, 0xff, 0xc3, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8309 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc4, 0x30,
+    0x0, 0xc, 0x62, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f,
+    0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
+    0x1, 0xf8, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0xe, 0x6f, 0x0, 0x3, 0xc6,
+    0x78, 0x0, 0xf8, 0x61, 0xf0, 0x3f, 0x6, 0xf, 0xc7, 0xc0, 0x60, 0x3e,
+    0x70, 0x6, 0x0, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+831C */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0,
+    0x71, 0xc0, 0x0, 0x3, 0x18, 0x0, 0x0, 0x71, 0x80, 0x0, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xff, 0xc3, 0x87, 0x1c, 0x1c, 0x30, 0x61, 0x80, 0xc3,
+    0x6, 0x18, 0x4c, 0x30, 0xe1, 0x8c, 0xc3, 0x1c, 0x1f, 0xcc, 0x33, 0x80,
+    0xfc, 0xc3, 0x30, 0x0, 0xc, 0x30, 0x0, 0x0, 0xc3, 0x80, 0x0, 0x1c,
+    0x3f, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf0,
+
+    /* U+8336 */
+    0x0, 0x80, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x3, 0x0, 0x0, 0xc6, 0x30,
+    0x0, 0xc, 0xe3, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3, 0x9c, 0x0, 0x0,
+    0xf0, 0xe0, 0x0, 0x1e, 0x7, 0x80, 0x7, 0x86, 0x1e, 0x1, 0xf0, 0x60,
+    0xfc, 0x7c, 0x6, 0x3, 0xe7, 0x3f, 0xff, 0xce, 0x7, 0xff, 0xfe, 0x0,
+    0x3f, 0xff, 0xc0, 0x0, 0x6, 0x0, 0x0, 0x8, 0x61, 0x0, 0x3, 0x86,
+    0x1c, 0x0, 0x78, 0x61, 0xf0, 0x1f, 0x6, 0x7, 0x87, 0xc0, 0x60, 0x3c,
+    0x78, 0x6, 0x1, 0xe0, 0x0, 0x60, 0x4, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+8349 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x7, 0x0, 0x0, 0x40, 0x20,
+    0x0, 0x3f, 0xff, 0xc0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xc,
+    0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0x7f, 0xff, 0xe0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8352 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x1, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x3, 0x0, 0x0, 0xc6, 0x30,
+    0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0xe,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xf0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x30, 0xc1, 0x80, 0x7, 0xe, 0x18, 0x0, 0x70, 0xe1, 0x80, 0x7, 0xe,
+    0x18, 0x20, 0x60, 0xe1, 0x86, 0xe, 0xe, 0x18, 0x61, 0xc0, 0xe1, 0x86,
+    0x7c, 0xe, 0x1f, 0xe7, 0x0, 0x41, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8377 */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0x24, 0x2, 0x0, 0x7, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0xe,
+    0xff, 0xff, 0xe0, 0xe0, 0x0, 0x30, 0x1e, 0x0, 0x3, 0x1, 0xe1, 0xf8,
+    0x30, 0x3e, 0x3f, 0xc3, 0x3, 0xe7, 0xe, 0x30, 0x7e, 0x70, 0x63, 0x6,
+    0xe7, 0x6, 0x30, 0xe, 0x70, 0x63, 0x0, 0xe7, 0xe, 0x30, 0xe, 0x3f,
+    0xc3, 0x0, 0xe3, 0xfc, 0x30, 0xe, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x30,
+    0xe, 0x0, 0x1f, 0x0, 0xe0, 0x3, 0xf0, 0x4, 0x0, 0x3c, 0x0,
+
+    /* U+8386 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x3, 0x0, 0x0, 0x6, 0x6,
+    0x0, 0x0, 0x60, 0x30, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xf8, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x18, 0x1f, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xf8, 0x1c, 0x6, 0x1, 0x81, 0xc0, 0x60, 0x18, 0x1f, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xf8, 0x1c, 0x6, 0x1, 0x81, 0xc0, 0x60, 0x18,
+    0x1c, 0x6, 0xf, 0x81, 0x80, 0x61, 0xf0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8389 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x0, 0xc0, 0x0, 0x1f, 0xfe, 0x1, 0xc7, 0xff, 0x86, 0x1c, 0x31,
+    0xc0, 0x61, 0xc0, 0x18, 0x6, 0x1c, 0x1, 0x80, 0x61, 0xc7, 0xff, 0xe6,
+    0x1c, 0x7f, 0xfe, 0x61, 0xc0, 0x1c, 0x6, 0x1c, 0x3, 0x80, 0x61, 0xc0,
+    0x7e, 0x6, 0x1c, 0x7, 0xf0, 0x61, 0xc0, 0xd9, 0xc6, 0x1c, 0x1d, 0x8e,
+    0x61, 0xc3, 0x98, 0x66, 0x1c, 0x71, 0x80, 0x1, 0xc6, 0x18, 0x0, 0x1c,
+    0x1, 0x80, 0xf, 0x80, 0x18, 0x1, 0xf8, 0x0, 0x80, 0xf, 0x0,
+
+    /* U+838A */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xe, 0x7, 0x0, 0x0, 0x40, 0x20,
+    0x0, 0x4, 0x1, 0x0, 0x30, 0xc0, 0x30, 0x3, 0xc, 0x3, 0x0, 0x30,
+    0xc0, 0x30, 0x3, 0xc, 0x3, 0x0, 0x3f, 0xc0, 0x38, 0x3, 0xfc, 0xff,
+    0xfe, 0x0, 0xcf, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x3,
+    0xfc, 0x3, 0x0, 0x7f, 0xc0, 0x30, 0x3, 0xfc, 0x3, 0x0, 0x18, 0xc0,
+    0x30, 0x1, 0x8c, 0x3, 0x0, 0x18, 0xc0, 0x30, 0x3, 0x8c, 0x7f, 0xf8,
+    0x70, 0xcf, 0xff, 0xc6, 0xc, 0x7f, 0xf8, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+838E */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xc0, 0x60,
+    0x0, 0x4, 0x2, 0x0, 0x1c, 0x0, 0x40, 0x1, 0xe0, 0xe, 0x0, 0x7,
+    0x0, 0xe0, 0x0, 0x1, 0x8e, 0x60, 0x0, 0x38, 0xe7, 0x87, 0x3, 0xe,
+    0x3c, 0x78, 0x70, 0xe1, 0xc1, 0xce, 0xe, 0xe, 0x0, 0xc0, 0xe0, 0x60,
+    0x8, 0xe, 0x0, 0x6, 0x0, 0xc1, 0x0, 0xe0, 0x7c, 0x38, 0xe, 0x7,
+    0xcf, 0x1, 0xc0, 0x3, 0xe0, 0x38, 0x0, 0xf8, 0x3, 0x80, 0xff, 0x0,
+    0x70, 0xff, 0x80, 0x6, 0x1f, 0xc0, 0x0, 0x0, 0x80, 0x0, 0x0,
+
+    /* U+8398 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x7, 0x0, 0x0, 0xc4, 0x70,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf,
+    0xff, 0xff, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x0, 0xe, 0x6,
+    0x0, 0x0, 0xe0, 0xf0, 0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+    0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+83AB */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x7, 0x0, 0x0, 0x40, 0x20,
+    0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x70, 0xc,
+    0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0,
+    0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f,
+    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x79, 0xc0, 0x0, 0x1f, 0xf, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xe7, 0xf0, 0x0, 0xfe, 0x70, 0x0, 0x0, 0xc0,
+
+    /* U+83C1 */
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x0, 0xc6, 0x30,
+    0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0,
+    0xf, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0,
+    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
+    0x7f, 0xff, 0xe0, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0,
+    0xe, 0x0, 0x7, 0x0, 0xc0, 0x3, 0xf0, 0xc, 0x0, 0x7e, 0x0, 0x40,
+    0x3, 0xc0,
+
+    /* U+83DC */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x6, 0x0, 0x0, 0x0, 0xf,
+    0xc3, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x1, 0x0, 0x40, 0x10, 0x8,
+    0xe, 0x3, 0x81, 0xc0, 0x60, 0x70, 0xe, 0x6, 0x7, 0x0, 0x60, 0x0,
+    0xe0, 0x2, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xf6,
+    0xf0, 0x0, 0x3c, 0x67, 0xc0, 0x1f, 0x86, 0x1f, 0x87, 0xe0, 0x60, 0x7e,
+    0x78, 0x6, 0x1, 0xe0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+83EF */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x7, 0x0, 0x0, 0x0, 0x20,
+    0x3, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x80, 0x30, 0x60, 0xc0, 0x3,
+    0x6, 0xc, 0x0, 0x38, 0xe1, 0xc0, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfc, 0x3, 0x6, 0xc, 0x0, 0x30, 0x60, 0xc0, 0xf, 0xff, 0xff, 0x3,
+    0xff, 0xff, 0xfc, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+83F2 */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x7, 0x0, 0x0, 0xc0, 0x30,
+    0x0, 0x4, 0x2, 0x0, 0x0, 0x30, 0xc0, 0x0, 0x7, 0xe, 0x0, 0x3f,
+    0xf0, 0xff, 0xc3, 0xff, 0xf, 0xfc, 0x0, 0x30, 0xc0, 0x0, 0x3, 0xc,
+    0x0, 0xf, 0xf0, 0xe0, 0x3, 0xff, 0xf, 0xfc, 0x1f, 0xf0, 0xff, 0x80,
+    0x7, 0xc, 0x0, 0x0, 0x70, 0xc0, 0x3, 0xfe, 0xc, 0x0, 0x7f, 0xe0,
+    0xff, 0xe3, 0xe, 0xf, 0xfe, 0x1, 0xc0, 0xe0, 0x0, 0x3c, 0xc, 0x0,
+    0x1f, 0x0, 0xc0, 0x3, 0xe0, 0xc, 0x0, 0x38, 0x0, 0x40, 0x0,
+
+    /* U+840A */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0x4, 0x62, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x7f,
+    0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x3, 0x6, 0x4, 0x0, 0x70, 0x60,
+    0xc0, 0xe, 0x6, 0x1c, 0x1, 0xf8, 0x63, 0xf0, 0x3d, 0xc6, 0x77, 0x83,
+    0x8e, 0xf6, 0x1c, 0x70, 0x1f, 0x80, 0xc0, 0x3, 0xfc, 0x0, 0x0, 0xe6,
+    0xe0, 0x0, 0x3c, 0x67, 0x80, 0xf, 0x86, 0x1f, 0x3, 0xf0, 0x60, 0xfc,
+    0x7c, 0x6, 0x3, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+842C */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x60, 0x30, 0xf,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x6, 0x3, 0x0, 0xe0, 0x60,
+    0x70, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x6, 0x0, 0x1,
+    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc3, 0x80, 0x60, 0x1c, 0x30, 0x6,
+    0x10, 0xc3, 0x0, 0xff, 0x8c, 0x33, 0xff, 0xfc, 0xc3, 0x3f, 0x0, 0xdc,
+    0x30, 0x0, 0x3, 0xc3, 0x0, 0x0, 0xf8, 0x10, 0x0, 0xf, 0x0,
+
+    /* U+8449 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x30, 0x0, 0x4c, 0x43, 0x60, 0x6, 0xc, 0x6,
+    0x0, 0xe0, 0xe0, 0x60, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x6,
+    0xc, 0x6, 0x0, 0x60, 0xe0, 0xe0, 0x6, 0x7, 0xfe, 0x0, 0x60, 0x0,
+    0x0, 0x7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x1, 0xff, 0xff, 0x80,
+    0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x1f,
+    0x80, 0x0, 0x7, 0xfc, 0x0, 0x1, 0xe6, 0xf8, 0x1, 0xfc, 0x63, 0xf8,
+    0x7f, 0x6, 0xf, 0xe7, 0x80, 0x60, 0x1e, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8473 */
+    0x0, 0xc0, 0x18, 0x0, 0xc, 0x1, 0x80, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x1, 0xc0, 0x38, 0x0, 0xc, 0x1, 0xb0, 0x0, 0x0, 0x63,
+    0x80, 0x0, 0xe, 0x18, 0xf, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xfc, 0x1c,
+    0x0, 0x60, 0x1, 0x80, 0x6, 0x0, 0x1b, 0xff, 0x61, 0x81, 0x9f, 0xe7,
+    0x18, 0x18, 0x60, 0x73, 0x81, 0x8e, 0x3, 0x30, 0x1b, 0xfe, 0x37, 0x1,
+    0xbf, 0xe3, 0x60, 0x19, 0xc6, 0x3e, 0x1, 0x98, 0x61, 0xc0, 0x39, 0xee,
+    0x1c, 0x3, 0x9f, 0xe3, 0xc6, 0x30, 0x3f, 0x7e, 0x67, 0x7, 0xfe, 0x76,
+    0x71, 0xe1, 0xc3, 0xe6, 0x3c, 0x38, 0x1c, 0x0, 0x2, 0x0, 0x80,
+
+    /* U+8490 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x1, 0xc0, 0x70, 0x0, 0xc, 0xc3, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x1, 0xc0, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf0, 0x1c,
+    0x6, 0x3, 0x1, 0xc0, 0xe0, 0x30, 0x1f, 0xff, 0xff, 0x1, 0xff, 0xff,
+    0xf0, 0x1c, 0x6, 0x3, 0x1, 0xc0, 0xe0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0x7f, 0xff, 0xe0, 0x0, 0xc7, 0x10, 0x0, 0xc, 0x73, 0x10, 0x1, 0x87,
+    0x31, 0x80, 0x18, 0x77, 0xf8, 0x7, 0x87, 0xf8, 0xe0, 0xf0, 0x70, 0x6,
+    0x7c, 0x3, 0xff, 0xe7, 0x80, 0x3f, 0xfc, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+84B2 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x3, 0x40, 0x10, 0x0, 0xc7,
+    0x1, 0xc0, 0xc, 0x30, 0x1e, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xfe, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x70, 0x7f, 0xff, 0x87, 0x87, 0xff,
+    0xf8, 0x3c, 0x60, 0xc1, 0xc0, 0x6, 0xc, 0x1c, 0x0, 0x7f, 0xff, 0xc0,
+    0x7, 0xff, 0xfc, 0x6, 0x60, 0xc1, 0xc0, 0xe6, 0xc, 0x1c, 0xc, 0x7f,
+    0xff, 0xc1, 0xc6, 0xc, 0x1c, 0x38, 0x60, 0xc1, 0xc3, 0x86, 0xc, 0x1c,
+    0x70, 0x60, 0xcf, 0x87, 0x6, 0xc, 0xf8, 0x0, 0x40, 0xc0, 0x0,
+
+    /* U+84C1 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x30, 0x0, 0xc, 0xc3, 0x0, 0x0, 0xc, 0x0,
+    0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x3, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x60, 0x60, 0x7, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x38, 0x1, 0xc0, 0xf, 0x3f, 0xff, 0x1,
+    0xcf, 0xfe, 0x7c, 0x78, 0x6, 0x1, 0xe7, 0x0, 0xe0, 0x6, 0xf, 0xff,
+    0xff, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3e, 0x67, 0x80,
+    0x1f, 0x86, 0x1f, 0x83, 0xe0, 0x60, 0x7c, 0x30, 0x6, 0x0, 0xc0,
+
+    /* U+84EE */
+    0x0, 0xc0, 0x20, 0x0, 0xc, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0x0, 0xc0,
+    0x1, 0xc0, 0xe, 0x0, 0xe, 0xff, 0xff, 0xe0, 0x60, 0xe, 0x0, 0x0,
+    0x0, 0xe0, 0x3, 0x83, 0xff, 0xf8, 0x3c, 0x70, 0xe3, 0x80, 0xc7, 0xc,
+    0x18, 0x0, 0x7f, 0xff, 0x80, 0x7, 0xe, 0x18, 0x7c, 0x70, 0xc1, 0x87,
+    0xe3, 0xff, 0xf8, 0xe, 0x1f, 0xff, 0x0, 0xe0, 0xc, 0x0, 0xe, 0xff,
+    0xff, 0xc0, 0xef, 0xff, 0xfc, 0xf, 0x0, 0xc0, 0x3, 0xfc, 0xc, 0x0,
+    0x79, 0xff, 0xff, 0xe6, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8521 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x6, 0x0, 0x1, 0x80, 0x0,
+    0x0, 0x3f, 0xe7, 0xf0, 0x7, 0xfe, 0x7f, 0x80, 0xc0, 0xf0, 0x70, 0x39,
+    0x9f, 0x8e, 0x7, 0x1f, 0x8f, 0xc0, 0x68, 0xf0, 0x78, 0x0, 0xee, 0x3,
+    0xc0, 0x7, 0xc0, 0x1f, 0x80, 0x7f, 0xff, 0xfe, 0x1e, 0x7f, 0xf1, 0xe7,
+    0x80, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x60, 0x0, 0x3, 0x86, 0x1c, 0x0, 0xf0, 0x61, 0xf8,
+    0x3e, 0xe, 0x7, 0xe7, 0x83, 0xe0, 0x1e, 0x0, 0x38, 0x0, 0x0,
+
+    /* U+859B */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xe, 0x7, 0x0, 0x3, 0x40, 0x20,
+    0x0, 0x30, 0x1, 0x80, 0x7, 0x0, 0x38, 0x1, 0xfe, 0x7f, 0xfc, 0x3f,
+    0xf7, 0xff, 0xc3, 0x3, 0x18, 0x30, 0x30, 0x31, 0x83, 0x3, 0x3, 0x18,
+    0x30, 0x3f, 0xf1, 0xc3, 0x3, 0xfe, 0xff, 0xfe, 0x30, 0xf, 0xff, 0xe3,
+    0x0, 0x3, 0x80, 0x3f, 0xe0, 0x38, 0x3, 0xff, 0x3, 0x80, 0x30, 0x37,
+    0xff, 0xc3, 0x3, 0x7f, 0xfc, 0x30, 0x30, 0x38, 0x3, 0x87, 0x3, 0x80,
+    0x3f, 0xf0, 0x38, 0x1, 0xfe, 0x3, 0x80, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+85AA */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0xc, 0x6, 0x0, 0x1, 0x80, 0x0,
+    0xc0, 0x18, 0x3, 0xfc, 0x7f, 0xfe, 0xff, 0x83, 0xff, 0xce, 0x0, 0x18,
+    0x30, 0xc0, 0x0, 0xc3, 0xc, 0x0, 0xc, 0x70, 0xc0, 0x7, 0xff, 0xef,
+    0xfc, 0x7f, 0xfe, 0xff, 0xe0, 0x18, 0xf, 0xfc, 0x1, 0x80, 0xc3, 0x7,
+    0xff, 0xec, 0x30, 0x3f, 0xfc, 0xc3, 0x0, 0x38, 0x1c, 0x30, 0x7, 0xe1,
+    0x83, 0x1, 0xdb, 0x98, 0x30, 0x39, 0x9b, 0x83, 0x7, 0x18, 0xf0, 0x30,
+    0x61, 0x87, 0x3, 0x0, 0x18, 0x60, 0x30, 0x1, 0x80, 0x3, 0x0,
+
+    /* U+85AF */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x60, 0x0, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
+    0xc3, 0x86, 0xc, 0xc, 0x38, 0x60, 0xe1, 0xc1, 0xff, 0xff, 0xf8, 0x0,
+    0x1c, 0x0, 0x0, 0x1, 0xc0, 0x70, 0xf, 0xff, 0xee, 0x0, 0x1, 0xc3,
+    0xc0, 0x0, 0x1c, 0x70, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x7, 0xc0, 0x0, 0x7, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xf0, 0x7b, 0x0,
+    0x3, 0x80, 0x3f, 0xff, 0xf8, 0x3, 0xff, 0xff, 0x80, 0x30, 0x0, 0x38,
+    0x3, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+85CD */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x70, 0x0, 0x4, 0x2, 0x0, 0x1f, 0xfc, 0x20,
+    0x3, 0xff, 0xc6, 0x0, 0x38, 0xc0, 0xff, 0xc3, 0x8e, 0xf, 0xfe, 0x3f,
+    0xfd, 0xc0, 0x3, 0x1, 0xd8, 0x0, 0x38, 0x1f, 0x0, 0x3, 0xff, 0x80,
+    0x0, 0x38, 0xc0, 0xff, 0xc3, 0x8c, 0xf, 0xfc, 0x3f, 0xfe, 0x0, 0x0,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+85CF */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x6, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x6, 0x10, 0x0, 0x40, 0x31,
+    0x82, 0x0, 0x3, 0x88, 0x67, 0xff, 0xff, 0xe6, 0x7f, 0xff, 0xfc, 0x66,
+    0x0, 0x38, 0x7, 0xe7, 0xfd, 0x80, 0x3e, 0xff, 0xd8, 0xc0, 0x6c, 0x61,
+    0x8c, 0x6, 0xc6, 0x19, 0xc7, 0xef, 0xf9, 0x98, 0x7e, 0xff, 0xd9, 0x83,
+    0x6c, 0xd, 0xf0, 0x36, 0xc0, 0xcf, 0x7, 0x6f, 0xfc, 0xf0, 0x6e, 0xff,
+    0x8e, 0x26, 0xcc, 0x60, 0xe6, 0x4c, 0xe6, 0x1e, 0x61, 0xcf, 0xff, 0xf6,
+    0x38, 0x7f, 0xf3, 0xe3, 0x80, 0xe, 0x1e, 0x0, 0x0, 0x40, 0x0,
+
+    /* U+85DD */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0x10, 0x2, 0x0, 0x1f, 0xf8, 0x30,
+    0x1, 0xff, 0x8f, 0xe0, 0x3, 0x81, 0xff, 0x7, 0xff, 0xc3, 0x30, 0xe,
+    0xe4, 0x33, 0x3, 0xc7, 0xdf, 0x30, 0x79, 0x78, 0xf3, 0x21, 0xff, 0x7,
+    0xb2, 0x1f, 0xf8, 0xf9, 0xa0, 0x39, 0x9c, 0x1e, 0x7f, 0xfb, 0x0, 0xe3,
+    0x0, 0x0, 0x4, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xc, 0x1, 0xe0,
+    0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xe0,
+
+    /* U+85E5 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x30, 0x0, 0x4c, 0x63, 0x0, 0xc, 0xe, 0x6,
+    0x0, 0xc1, 0xf8, 0xc0, 0x1d, 0xbf, 0xcc, 0x83, 0x9b, 0xf, 0x98, 0x3b,
+    0x30, 0xfb, 0x81, 0xf3, 0xfd, 0xf0, 0xf, 0x3f, 0xce, 0x0, 0xdb, 0xc,
+    0xec, 0x1d, 0xb0, 0xcc, 0xc3, 0xff, 0xff, 0xfe, 0x38, 0xdf, 0xbe, 0x60,
+    0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x3f,
+    0x80, 0x0, 0x7, 0xfe, 0x0, 0x1, 0xe6, 0x78, 0x0, 0xf8, 0x63, 0xf8,
+    0x7e, 0x6, 0xf, 0xe7, 0x80, 0x60, 0x1e, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8607 */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xe0, 0x70, 0x0, 0x6c, 0x6, 0x0, 0xe, 0x0, 0x3,
+    0x80, 0xfe, 0xf, 0xfc, 0x1f, 0xf1, 0xfe, 0x3, 0x86, 0x0, 0xc0, 0x70,
+    0xe0, 0xc, 0x7, 0xff, 0x80, 0xc0, 0x3f, 0xf9, 0xff, 0xc3, 0x18, 0xff,
+    0xfe, 0x31, 0x8c, 0x3e, 0x3, 0xff, 0xc1, 0xe0, 0x3f, 0xfc, 0x3f, 0x3,
+    0x18, 0xc7, 0xf8, 0x31, 0x8c, 0x6d, 0x83, 0xff, 0x8c, 0xdc, 0x1f, 0xf9,
+    0xcc, 0xe0, 0x0, 0x38, 0xc6, 0x26, 0x4d, 0xc, 0x26, 0x66, 0xe0, 0xc0,
+    0x66, 0x66, 0xc, 0x6, 0x66, 0x60, 0xc0, 0x40, 0x0, 0x8, 0x0,
+
+    /* U+862D */
+    0x0, 0x40, 0x20, 0x0, 0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0xc0, 0x70, 0x0, 0x4, 0x2, 0x0, 0x1f, 0xf0, 0xff,
+    0x83, 0xff, 0x1f, 0xfc, 0x30, 0x39, 0x80, 0xc3, 0xff, 0x9f, 0xfc, 0x30,
+    0x39, 0x80, 0xc3, 0xff, 0x1f, 0xfc, 0x3f, 0xe6, 0xff, 0xc3, 0x0, 0x60,
+    0xc, 0x33, 0xff, 0xfc, 0xc3, 0x0, 0xe0, 0xc, 0x30, 0xff, 0xf0, 0xc3,
+    0x1f, 0xff, 0x8c, 0x31, 0x26, 0x58, 0xc3, 0x1b, 0x6d, 0x8c, 0x31, 0xff,
+    0xf8, 0xc3, 0xf, 0xff, 0xc, 0x30, 0x1f, 0x80, 0xc3, 0x7, 0x7e, 0xc,
+    0x33, 0xe6, 0x79, 0xc3, 0x38, 0x61, 0x7c, 0x30, 0x4, 0x3, 0x0,
+
+    /* U+8655 */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
+    0xff, 0xf0, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0xc1, 0x80, 0xc0, 0xe, 0x18, 0xf, 0xfe, 0xe1, 0x9f, 0xff, 0xc4, 0x19,
+    0x8c, 0x1, 0x81, 0x80, 0xff, 0xf8, 0x18, 0x47, 0xff, 0x1, 0x8c, 0x0,
+    0x0, 0x18, 0xc0, 0x18, 0x1, 0x9f, 0xe7, 0xe0, 0x19, 0xff, 0x77, 0x1,
+    0x9c, 0x66, 0x30, 0x3b, 0xe6, 0x63, 0x23, 0xb6, 0xcc, 0x36, 0x36, 0x3c,
+    0xc3, 0x63, 0x3, 0x9c, 0x3e, 0x30, 0x7d, 0x80, 0x87, 0xe, 0xf8, 0x0,
+    0x63, 0xc3, 0xff, 0xe6, 0x78, 0xf, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+865F */
+    0x0, 0x0, 0x20, 0x3, 0xf8, 0x7, 0x0, 0x3f, 0xc0, 0x7f, 0xc7, 0xc,
+    0x7, 0xfc, 0x70, 0xc0, 0x70, 0x7, 0xc, 0x7, 0x0, 0x71, 0xcf, 0xff,
+    0xc3, 0xfc, 0xff, 0xfe, 0x1f, 0x8c, 0x60, 0xe0, 0x1, 0xc6, 0x6, 0x7f,
+    0xdc, 0x7f, 0x67, 0xff, 0xff, 0xf0, 0x1c, 0x1d, 0xe0, 0x1, 0x81, 0xc6,
+    0x6, 0x18, 0x1c, 0x70, 0xe1, 0x81, 0xc7, 0xfc, 0x1f, 0x98, 0x3f, 0x81,
+    0xfd, 0x80, 0x0, 0x0, 0xd8, 0xcc, 0x0, 0x1d, 0x8c, 0xc0, 0x1, 0x98,
+    0xcc, 0x20, 0x1b, 0x9c, 0xc6, 0x1, 0xb1, 0x8c, 0x60, 0x3b, 0x38, 0xe6,
+    0x1f, 0x77, 0xf, 0xe1, 0xe6, 0x60, 0x7c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8679 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30,
+    0x7f, 0xfc, 0x3, 0x7, 0xff, 0xc1, 0xfe, 0x3, 0x80, 0x3f, 0xf0, 0x38,
+    0x3, 0x37, 0x3, 0x80, 0x33, 0x30, 0x38, 0x3, 0x33, 0x3, 0x80, 0x33,
+    0x30, 0x38, 0x3, 0x33, 0x3, 0x80, 0x33, 0x30, 0x38, 0x3, 0x33, 0x3,
+    0x80, 0x3b, 0x70, 0x38, 0x3, 0xff, 0x3, 0x80, 0xf, 0xc0, 0x38, 0x0,
+    0x30, 0x3, 0x80, 0x3, 0x30, 0x38, 0x0, 0x33, 0x3, 0x80, 0x3, 0x38,
+    0x38, 0x0, 0x7f, 0x83, 0x80, 0x7f, 0xd8, 0x38, 0x7, 0xe0, 0xff, 0xfe,
+    0x60, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+86CB */
+    0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x6, 0x1, 0xc0, 0x0,
+    0x60, 0x38, 0x7, 0x6, 0x6, 0x0, 0x70, 0x7f, 0xf0, 0x7, 0x7, 0xff,
+    0x0, 0x78, 0x60, 0x0, 0xf, 0xc6, 0x0, 0x1, 0xcf, 0xe0, 0x0, 0x1c,
+    0x7f, 0xff, 0xe7, 0x80, 0xff, 0xfe, 0x70, 0x6, 0x0, 0x6, 0x0, 0x60,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0x6, 0x3, 0x81,
+    0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x80, 0xff, 0xff, 0xf0, 0x7, 0xff,
+    0xfe, 0x0, 0x0, 0x60, 0x70, 0x0, 0x6, 0x3, 0x83, 0xff, 0xff, 0xfc,
+    0x7f, 0xff, 0xf8, 0xe0, 0x0, 0x0, 0x6,
+
+    /* U+86FB */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x3, 0xc0, 0x6, 0x0, 0x3e, 0x0, 0x60,
+    0x0, 0x70, 0x6, 0x3, 0x3, 0x1, 0xf8, 0x70, 0x18, 0x3f, 0xe6, 0x1,
+    0xc3, 0x7e, 0xe0, 0xc, 0x36, 0x7c, 0x0, 0xe3, 0x67, 0xff, 0xfa, 0x36,
+    0x67, 0xff, 0x83, 0x66, 0x60, 0x18, 0x36, 0x66, 0x1, 0x83, 0x66, 0x60,
+    0x18, 0x36, 0x66, 0x1, 0x83, 0xfe, 0x7f, 0xf8, 0x1f, 0xc3, 0xff, 0x80,
+    0x60, 0x1d, 0xc0, 0x6, 0x41, 0xcc, 0x0, 0x66, 0x1c, 0xc0, 0x6, 0x61,
+    0x8c, 0x0, 0x7e, 0x18, 0xc2, 0x7f, 0xf7, 0x8c, 0x67, 0xe3, 0xf0, 0xc6,
+    0x60, 0x1e, 0xf, 0xe0, 0x3, 0xc0, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+871C */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
+    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe7, 0x0, 0xc0, 0x8e, 0x70, 0x6f, 0x38,
+    0xe7, 0x66, 0x37, 0x8e, 0x2e, 0x61, 0xe3, 0x40, 0xc6, 0x7c, 0x38, 0x18,
+    0x7f, 0x5, 0xc1, 0x8f, 0xc0, 0xce, 0xf, 0xfe, 0xfc, 0x67, 0xf7, 0xff,
+    0x80, 0x70, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xf8, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x2, 0x0, 0x0, 0x60, 0x38,
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xee, 0x20, 0x0, 0x0, 0x60,
+
+    /* U+8766 */
+    0x4, 0x0, 0x0, 0x0, 0x60, 0x78, 0xf0, 0x6, 0xf, 0xdf, 0xc0, 0x61,
+    0xfc, 0xfc, 0x6, 0x18, 0xc0, 0xc3, 0xf9, 0x8c, 0xc, 0x7f, 0xd8, 0xc0,
+    0xc7, 0xed, 0x8c, 0xc, 0x66, 0xdf, 0xcf, 0xc6, 0x6d, 0xfd, 0xfc, 0x66,
+    0xdc, 0x0, 0x6, 0x6d, 0x80, 0x0, 0x66, 0xd8, 0x3f, 0xc6, 0x6d, 0xc3,
+    0xfe, 0x7f, 0xdf, 0xc0, 0xe7, 0xfd, 0xf9, 0xc, 0x1f, 0x98, 0x18, 0xc0,
+    0x61, 0x81, 0x9c, 0x6, 0x98, 0x19, 0x80, 0x6d, 0xc0, 0xf0, 0x6, 0xdf,
+    0xcf, 0x0, 0x7d, 0xf8, 0xe0, 0x3f, 0xf8, 0x1f, 0x7, 0xe7, 0x83, 0xfc,
+    0x60, 0x18, 0x71, 0xe0, 0x1, 0x8e, 0xe, 0x0, 0x8, 0x80, 0x0,
+
+    /* U+87BA */
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x7f, 0xf8, 0x6, 0xf, 0xff, 0xc0, 0x60,
+    0xc3, 0xc, 0x6, 0xc, 0x30, 0xc1, 0xfc, 0xff, 0xfc, 0x3f, 0xef, 0xff,
+    0xc7, 0x6e, 0xc3, 0xc, 0x66, 0x6c, 0x30, 0xc6, 0x66, 0xff, 0xfc, 0x66,
+    0x6f, 0xff, 0xc6, 0x66, 0xe, 0x0, 0x66, 0x60, 0xc6, 0x6, 0x66, 0x7c,
+    0x60, 0x76, 0xe7, 0x8e, 0x3, 0xfe, 0x1d, 0xc0, 0x3f, 0xc0, 0xf9, 0x80,
+    0x60, 0x7, 0xc, 0x6, 0xcf, 0xff, 0xe0, 0x6d, 0xff, 0xfe, 0x6, 0x6c,
+    0x30, 0x20, 0x7e, 0x13, 0x20, 0x3f, 0xf3, 0x33, 0x87, 0xf3, 0x73, 0x1c,
+    0x70, 0x2e, 0x30, 0xe0, 0x0, 0xc3, 0x6, 0x0, 0x0, 0x30, 0x0,
+
+    /* U+8840 */
+    0x0, 0x8, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x3,
+    0x80, 0x0, 0x0, 0x30, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
+    0x1, 0xc7, 0xc, 0x38, 0x1c, 0x30, 0xc3, 0x81, 0x83, 0xc, 0x18, 0x18,
+    0x30, 0xc1, 0x81, 0x83, 0xc, 0x18, 0x18, 0x30, 0xc1, 0x81, 0x83, 0xc,
+    0x18, 0x18, 0x30, 0xc1, 0x81, 0x83, 0xc, 0x18, 0x18, 0x30, 0xc1, 0x81,
+    0x83, 0xc, 0x18, 0x18, 0x30, 0xc1, 0x81, 0x83, 0xc, 0x18, 0x18, 0x30,
+    0xc1, 0x81, 0x83, 0xc, 0x18, 0x1c, 0x70, 0xc3, 0x87, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+884C */
+    0x0, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7, 0x8f, 0xff, 0xc1, 0xf0,
+    0x7f, 0xfc, 0x3c, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7,
+    0x1f, 0xff, 0xe0, 0xf0, 0xff, 0xfe, 0x1e, 0x0, 0xe, 0x3, 0xe0, 0x0,
+    0xe0, 0x7e, 0x0, 0xe, 0x7, 0x60, 0x0, 0xe0, 0x46, 0x0, 0xe, 0x0,
+    0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0,
+    0xe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe, 0x0, 0x60, 0x0, 0xe0,
+    0x6, 0x0, 0xfc, 0x0, 0x60, 0xf, 0xc0, 0x6, 0x0, 0x70, 0x0,
+
+    /* U+8853 */
+    0x2, 0x4, 0x0, 0x0, 0x70, 0x60, 0x0, 0xe, 0x6, 0xcf, 0xe1, 0xc0,
+    0x6e, 0xfe, 0x38, 0x6, 0x60, 0x7, 0x0, 0x60, 0x0, 0x60, 0x7f, 0xe0,
+    0x0, 0x37, 0xfe, 0x0, 0x7, 0x6, 0x0, 0x0, 0x60, 0x60, 0x0, 0xe,
+    0x6, 0x1f, 0xe1, 0xc6, 0x6d, 0xfe, 0x1c, 0x66, 0xc3, 0x83, 0xc6, 0x66,
+    0x38, 0x7c, 0x66, 0x63, 0x86, 0xc6, 0x66, 0x38, 0xc, 0x66, 0x63, 0x80,
+    0xc6, 0x66, 0x38, 0xc, 0x66, 0x63, 0x80, 0xce, 0x66, 0x38, 0xc, 0xc6,
+    0x63, 0x80, 0xcc, 0x66, 0x38, 0xd, 0xc6, 0x3, 0x80, 0xd8, 0x60, 0x38,
+    0xc, 0x6, 0xf, 0x80, 0xc0, 0x61, 0xf0, 0xc, 0x4, 0x1e, 0x0,
+
+    /* U+8857 */
+    0x2, 0x4, 0x0, 0x0, 0x70, 0xc0, 0x0, 0xe, 0xe, 0x1f, 0xe1, 0xc0,
+    0xe1, 0xfe, 0x38, 0x7f, 0xc0, 0x7, 0x7, 0xfc, 0x0, 0x60, 0xe, 0x0,
+    0x0, 0x30, 0xe0, 0x0, 0x7, 0xe, 0x0, 0x0, 0x77, 0xf8, 0x0, 0xe,
+    0xff, 0xff, 0xe1, 0xc7, 0xfd, 0xfe, 0x1c, 0x4, 0x1, 0x83, 0xc0, 0xc0,
+    0x18, 0x7c, 0xc, 0x1, 0x86, 0xc0, 0xe0, 0x18, 0xc, 0xff, 0xe1, 0x80,
+    0xcf, 0xfc, 0x18, 0xc, 0xc, 0x1, 0x80, 0xc0, 0xc0, 0x18, 0xc, 0xc,
+    0x1, 0x80, 0xc0, 0xee, 0x18, 0xc, 0xff, 0xe1, 0x80, 0xdf, 0xf8, 0x38,
+    0xc, 0xe0, 0xf, 0x80, 0xc0, 0x1, 0xf0, 0x8, 0x0, 0xe, 0x0,
+
+    /* U+885B */
+    0x2, 0x8, 0x0, 0x0, 0x71, 0xc0, 0x0, 0xe, 0x7f, 0x9f, 0xe1, 0xc7,
+    0xfc, 0xfc, 0x38, 0x18, 0xc0, 0x7, 0x1, 0x8c, 0x0, 0x60, 0xff, 0xf0,
+    0x0, 0xf, 0xff, 0x0, 0x3, 0x0, 0x0, 0x0, 0x63, 0xf8, 0x0, 0xe,
+    0x7f, 0xff, 0xe1, 0xce, 0xe, 0xfe, 0x3c, 0xe0, 0x61, 0x83, 0xc7, 0xfe,
+    0x18, 0x7c, 0x7f, 0xc1, 0x86, 0xc0, 0x30, 0x18, 0xc, 0xff, 0xe1, 0x80,
+    0xdf, 0xff, 0x18, 0xc, 0x3, 0x1, 0x80, 0xcc, 0x30, 0x18, 0xc, 0xff,
+    0xe1, 0x80, 0xcf, 0xff, 0x18, 0xd, 0xc7, 0x81, 0x80, 0xd8, 0x30, 0x38,
+    0xc, 0x3, 0xf, 0x80, 0xc0, 0x31, 0xf0, 0x8, 0x3, 0xe, 0x0,
+
+    /* U+8863 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x1, 0xf0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0,
+    0x73, 0x1, 0x80, 0x6, 0x18, 0x38, 0x0, 0xe1, 0x87, 0x0, 0x1c, 0x1c,
+    0xe0, 0x3, 0xc0, 0xdc, 0x0, 0x7c, 0xf, 0x80, 0xf, 0xc0, 0x70, 0x1,
+    0xcc, 0x7, 0x0, 0x38, 0xc0, 0x38, 0x7, 0xc, 0x1, 0xc0, 0x60, 0xc0,
+    0x1e, 0x0, 0xc, 0x18, 0xf0, 0x0, 0xdf, 0x87, 0xc0, 0x1f, 0xf0, 0x3e,
+    0xf, 0xf8, 0x0, 0xe0, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8868 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xe0, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff,
+    0xfe, 0x0, 0x1f, 0x0, 0x0, 0x3, 0xb8, 0x10, 0x0, 0x71, 0x83, 0x80,
+    0x1e, 0x1c, 0xf0, 0x7, 0xc0, 0xde, 0x1, 0xfc, 0x7, 0x80, 0x7c, 0xc0,
+    0x70, 0x7, 0xc, 0x3, 0x80, 0x0, 0xc7, 0x1e, 0x0, 0xf, 0xf0, 0x78,
+    0x7, 0xfe, 0x3, 0xe0, 0xfe, 0x0, 0x1e, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+88AB */
+    0x4, 0x0, 0x20, 0x0, 0xe0, 0x3, 0x0, 0xe, 0x0, 0x30, 0x0, 0xe0,
+    0x3, 0x0, 0xe, 0x7, 0xff, 0x87, 0xfc, 0xff, 0xfc, 0x7f, 0xce, 0x70,
+    0xc0, 0xc, 0xc3, 0xc, 0x1, 0xcc, 0x31, 0xc0, 0x38, 0xc3, 0x18, 0x3,
+    0xc, 0x30, 0x0, 0x74, 0xc3, 0x0, 0xe, 0xef, 0xff, 0xc1, 0xfc, 0xff,
+    0xfc, 0x3f, 0x8c, 0x1, 0xc7, 0xe0, 0xd8, 0x18, 0x6f, 0xc, 0xc3, 0x84,
+    0xfd, 0xcc, 0x30, 0xe, 0xdc, 0xe7, 0x0, 0xe7, 0x87, 0xe0, 0xe, 0x18,
+    0x3c, 0x0, 0xe1, 0x83, 0xc0, 0xe, 0x38, 0x7e, 0x0, 0xe7, 0xf, 0xf8,
+    0xe, 0x73, 0xc3, 0xe0, 0xe6, 0x78, 0x1e, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+88D5 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x18, 0xc0, 0xc, 0x3, 0x8e, 0x0, 0xc0,
+    0x70, 0x70, 0xe, 0xe, 0x3, 0xc7, 0xfd, 0xe0, 0x1c, 0x7f, 0xdc, 0x30,
+    0xe0, 0x1c, 0x7, 0x0, 0x1, 0x80, 0xf0, 0x0, 0x38, 0xf, 0x80, 0x7,
+    0x1, 0xdc, 0x0, 0x64, 0x38, 0xe0, 0xe, 0xc7, 0x7, 0x1, 0xdc, 0xe0,
+    0x3c, 0x3d, 0x9c, 0x1, 0xe7, 0xc3, 0x80, 0xe, 0x6c, 0x37, 0xff, 0x80,
+    0xf8, 0x7f, 0xf8, 0xd, 0xc6, 0x1, 0x80, 0xcc, 0x60, 0x18, 0xc, 0x6,
+    0x1, 0x80, 0xc0, 0x60, 0x18, 0xc, 0x6, 0x1, 0x80, 0xc0, 0x60, 0x38,
+    0xc, 0x7, 0xff, 0x80, 0xc0, 0x3f, 0xf0, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+88DC */
+    0x4, 0x0, 0x22, 0x0, 0xe0, 0x7, 0x30, 0xe, 0x0, 0x71, 0x80, 0xe0,
+    0x7, 0x8, 0xe, 0x1f, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xc0, 0x70,
+    0x0, 0xc, 0x7, 0x0, 0x1, 0xc0, 0x70, 0x0, 0x38, 0xff, 0xf8, 0x3,
+    0xf, 0xff, 0xc0, 0x71, 0xc7, 0xc, 0xe, 0x7c, 0x70, 0xc1, 0xed, 0xff,
+    0xfc, 0x3f, 0xdf, 0xff, 0xc7, 0xe1, 0xc7, 0xc, 0x6f, 0x9c, 0x70, 0xc4,
+    0xfd, 0xc7, 0xc, 0xe, 0xff, 0xff, 0xc0, 0xe7, 0xff, 0xfc, 0xe, 0x1c,
+    0x70, 0xc0, 0xe1, 0xc7, 0xc, 0xe, 0x1c, 0x70, 0xc0, 0xe1, 0xc7, 0xc,
+    0xe, 0x1c, 0x77, 0xc0, 0xe1, 0x86, 0x78, 0x4, 0x8, 0x20, 0x0,
+
+    /* U+88DD */
+    0x0, 0x40, 0x30, 0x3, 0xe, 0x3, 0x0, 0x30, 0xe0, 0x30, 0x3, 0x8e,
+    0x3, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xfe, 0x0, 0xe0, 0x30,
+    0x0, 0xe, 0x3, 0x0, 0x7f, 0xe0, 0x30, 0x7, 0xfe, 0x3, 0x0, 0x18,
+    0xe7, 0xff, 0xc1, 0x8e, 0xff, 0xfc, 0x78, 0xe0, 0x0, 0x7, 0xc, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x3, 0xf0, 0x0, 0x0, 0x3b, 0x83, 0x0, 0xf, 0x1c, 0x70, 0x3, 0xe0,
+    0xfe, 0x0, 0xfe, 0x7, 0x80, 0x3e, 0x60, 0x3e, 0x7, 0x86, 0x78, 0xf8,
+    0x60, 0xff, 0x87, 0xe0, 0x7f, 0xc0, 0xe, 0x7, 0x0, 0x0, 0x0,
+
+    /* U+88E1 */
+    0x4, 0x0, 0x0, 0x0, 0xc0, 0x7f, 0xf0, 0xc, 0xf, 0xff, 0xc0, 0xc0,
+    0xe7, 0x1c, 0xe, 0x1c, 0x70, 0xc7, 0xfd, 0xc7, 0xc, 0x7f, 0xdc, 0x70,
+    0xc0, 0x1d, 0xff, 0xfc, 0x1, 0x9f, 0xff, 0xc0, 0x39, 0xc7, 0xc, 0x7,
+    0x1c, 0x70, 0xc0, 0x65, 0xc7, 0xc, 0xe, 0xcf, 0xff, 0xc1, 0xdc, 0xff,
+    0xfc, 0x3d, 0x83, 0xff, 0x7, 0xc0, 0x7, 0x0, 0x6d, 0x0, 0x70, 0x0,
+    0xf8, 0x7, 0x0, 0xc, 0xdf, 0xff, 0xc0, 0xc4, 0xff, 0xfc, 0xc, 0x0,
+    0x70, 0x0, 0xc0, 0x7, 0x0, 0xc, 0x0, 0x70, 0x0, 0xc0, 0x7, 0x0,
+    0xc, 0x7f, 0xff, 0xe0, 0xc7, 0xff, 0xfe, 0x4, 0x0, 0x0, 0x0,
+
+    /* U+88F9 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
+    0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x1c,
+    0x6, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x60,
+    0x0, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0xc6, 0x38, 0x0,
+    0x7c, 0x73, 0xf0, 0x3f, 0x1e, 0x7, 0xc3, 0x83, 0xf0, 0xc, 0x0, 0xf1,
+    0x8e, 0x0, 0x7e, 0xf, 0xc0, 0x3f, 0xe0, 0x78, 0x7, 0x8e, 0x73, 0xe0,
+    0x0, 0xff, 0xf, 0xc0, 0x7f, 0xc0, 0x3e, 0x3, 0x0, 0x0, 0x0,
+
+    /* U+8907 */
+    0x4, 0x3, 0x0, 0x0, 0xc0, 0x70, 0x0, 0xc, 0x7, 0xff, 0xc0, 0xc0,
+    0xff, 0xfe, 0xe, 0x1c, 0x0, 0x7, 0xfd, 0x80, 0x0, 0x7f, 0xf7, 0xff,
+    0x80, 0x1c, 0x7f, 0xf8, 0x1, 0x8e, 0x1, 0xc0, 0x30, 0xff, 0xfc, 0x7,
+    0xf, 0xff, 0xc0, 0x64, 0xe0, 0x1c, 0xc, 0xc6, 0x1, 0xc1, 0xdc, 0x7f,
+    0xf8, 0x3d, 0x81, 0xc6, 0x7, 0xc0, 0x38, 0x0, 0x6f, 0x83, 0xff, 0x80,
+    0xdc, 0x7f, 0xf8, 0xc, 0xcf, 0x3, 0x80, 0xc5, 0xd8, 0x70, 0xc, 0x39,
+    0xce, 0x0, 0xc0, 0xf, 0x80, 0xc, 0x0, 0xf8, 0x0, 0xc0, 0x3f, 0xf0,
+    0xc, 0x1f, 0x8f, 0xe0, 0xc7, 0xe0, 0x3e, 0x4, 0x20, 0x0, 0x0,
+
+    /* U+897F */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x7,
+    0x1c, 0x0, 0x0, 0x61, 0xc0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0x61, 0xc0,
+    0x0, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x38,
+    0x61, 0xc1, 0xc3, 0x6, 0x1c, 0xc, 0x30, 0x61, 0xc0, 0xc3, 0x6, 0x1c,
+    0xc, 0x30, 0xe1, 0xc4, 0xc3, 0xc, 0x1c, 0xcc, 0x31, 0xc1, 0xfc, 0xc3,
+    0x38, 0xf, 0xcc, 0x33, 0x0, 0x70, 0xc3, 0x0, 0x0, 0xc, 0x30, 0x0,
+    0x0, 0xc3, 0x80, 0x0, 0x1c, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc,
+    0xf, 0xff, 0xff, 0x0,
+
+    /* U+8981 */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x7,
+    0xc, 0x0, 0x0, 0x70, 0xc0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
+    0x81, 0x87, 0xc, 0x18, 0x18, 0x70, 0xc1, 0x81, 0x87, 0xc, 0x18, 0x1f,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x3c, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0xc, 0x3, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x3e, 0xe, 0x0, 0x1, 0xff,
+    0xc0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x1f, 0xfc, 0x1, 0xff, 0xc3, 0xf8,
+    0x3f, 0xf0, 0x7, 0xc1, 0x80, 0x0, 0x18,
+
+    /* U+8986 */
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x60, 0x60, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc3, 0x86, 0x6, 0xc, 0x30, 0x60, 0x61,
+    0xc3, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0x0, 0x63, 0xff, 0xf0, 0x1e,
+    0x7f, 0xff, 0x83, 0xc6, 0x0, 0x0, 0x70, 0xdf, 0xff, 0x86, 0x31, 0x80,
+    0x18, 0x7, 0x3f, 0xff, 0x80, 0xe3, 0xff, 0xf8, 0x1c, 0x18, 0x1, 0x83,
+    0xc1, 0xff, 0xf8, 0x7c, 0xe, 0x0, 0x6, 0xc1, 0xff, 0xf8, 0xc, 0x7f,
+    0x7, 0x80, 0xce, 0x70, 0xf0, 0xc, 0x1, 0xfc, 0x0, 0xc0, 0x3f, 0xf0,
+    0xc, 0xff, 0x9f, 0xe0, 0xcf, 0x0, 0xe,
+
+    /* U+898B */
+    0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0,
+    0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0,
+    0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0,
+    0x6, 0xc, 0x0, 0x0, 0x60, 0xc0, 0x0, 0xe, 0xc, 0x2, 0x0, 0xc0,
+    0xc0, 0x60, 0x1c, 0xc, 0x6, 0x7, 0x80, 0xe0, 0xe7, 0xf0, 0xf, 0xfe,
+    0x7c, 0x0, 0x7f, 0xc6, 0x0, 0x0, 0x0,
+
+    /* U+898F */
+    0x2, 0x0, 0x0, 0x0, 0x70, 0x1f, 0xe0, 0x7, 0x7, 0xff, 0x80, 0x70,
+    0x70, 0x18, 0x7, 0x6, 0x1, 0xc3, 0xfc, 0x60, 0x1c, 0x7f, 0xe7, 0xff,
+    0xc3, 0xfe, 0x7f, 0xfc, 0x7, 0x6, 0x1, 0xc0, 0x70, 0x60, 0x1c, 0x7,
+    0x6, 0x1, 0xc3, 0xfc, 0x7f, 0xfc, 0x7f, 0xf7, 0xff, 0xc7, 0xfe, 0x60,
+    0x1c, 0x6, 0x6, 0x1, 0xc0, 0x60, 0x60, 0x38, 0x6, 0x7, 0xff, 0x80,
+    0x78, 0x1f, 0xe0, 0xf, 0xc1, 0x8c, 0x0, 0xce, 0x18, 0xc0, 0x1c, 0x71,
+    0x8c, 0x3, 0x82, 0x30, 0xc6, 0x38, 0x7, 0xc, 0x67, 0x1, 0xe0, 0xc6,
+    0x60, 0x7c, 0xf, 0xe0, 0xf, 0x0, 0xfc, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+8996 */
+    0x1f, 0xc3, 0xff, 0x7, 0xfe, 0x7f, 0xf8, 0x3f, 0xce, 0x1, 0xc0, 0x0,
+    0xc0, 0x1c, 0x0, 0xc, 0x1, 0xc0, 0x0, 0xff, 0xfc, 0x7f, 0xef, 0xff,
+    0xc7, 0xfe, 0xe0, 0x1c, 0x6, 0xc, 0x1, 0xc0, 0x60, 0xc0, 0x1c, 0x26,
+    0x6f, 0xff, 0xc7, 0x66, 0xff, 0xfc, 0x76, 0x6c, 0x1, 0xc7, 0x66, 0xc0,
+    0x1c, 0x76, 0x6e, 0x1, 0xc6, 0x66, 0x7f, 0xf8, 0x66, 0x63, 0xff, 0x6,
+    0x66, 0x1c, 0xc0, 0x66, 0x61, 0x8c, 0x6, 0x66, 0x18, 0xc0, 0x66, 0x63,
+    0x8c, 0x66, 0x66, 0x30, 0xc6, 0x46, 0x7, 0xc, 0x60, 0x61, 0xe0, 0xfe,
+    0x6, 0x7c, 0xf, 0xc0, 0x22, 0x0, 0x0,
+
+    /* U+89AA */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0xf, 0xf0, 0x3, 0x81, 0xff, 0x83, 0xff,
+    0xbf, 0xfc, 0x7f, 0xfb, 0x81, 0xc1, 0x87, 0x38, 0xc, 0x18, 0x63, 0xff,
+    0xc1, 0x86, 0x3f, 0xfc, 0xc, 0x63, 0x81, 0xc7, 0xff, 0xb8, 0xc, 0x7f,
+    0xff, 0x81, 0xc3, 0xff, 0x3f, 0xfc, 0x3, 0x83, 0xff, 0xc0, 0x38, 0x38,
+    0xc, 0x3f, 0xfb, 0x81, 0xc7, 0xff, 0xbf, 0xfc, 0x7, 0x81, 0xff, 0x80,
+    0x78, 0xf, 0xf0, 0x7, 0xe0, 0xce, 0x0, 0xff, 0xc, 0xe0, 0x1b, 0xb8,
+    0xce, 0x3, 0x39, 0x8c, 0xe6, 0x73, 0x81, 0x8e, 0x66, 0x38, 0x78, 0xe6,
+    0x3, 0x8f, 0x7, 0xe0, 0x39, 0xe0, 0x7c, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+89BD */
+    0x0, 0x0, 0x80, 0x3, 0xff, 0x9c, 0x0, 0x3f, 0xf3, 0xff, 0xe6, 0x18,
+    0x70, 0x0, 0x7f, 0xf6, 0xff, 0x87, 0xff, 0xdf, 0xfc, 0x60, 0x38, 0x0,
+    0x7, 0xff, 0x3f, 0xfc, 0x7f, 0xf3, 0x76, 0xe6, 0x18, 0x26, 0x66, 0x3f,
+    0xfb, 0x66, 0xe3, 0xff, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0,
+    0x7, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x71, 0xc0, 0x60, 0xe, 0x18, 0x6,
+    0x7, 0xc1, 0xff, 0xe7, 0xf8, 0xf, 0xfc, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+89C0 */
+    0x4, 0x20, 0x0, 0x0, 0xc3, 0x3, 0xf0, 0x7f, 0xfe, 0xff, 0xc7, 0xff,
+    0xee, 0x1c, 0xc, 0x30, 0xc0, 0xc0, 0x42, 0xc, 0xc, 0x3e, 0x7c, 0xff,
+    0xc7, 0xef, 0xcf, 0xfc, 0x63, 0xc6, 0xc0, 0xc6, 0x7c, 0x6c, 0xc, 0x3e,
+    0x7c, 0xc0, 0xc1, 0x83, 0x8f, 0xfc, 0x8, 0x60, 0xff, 0xc1, 0xff, 0xcc,
+    0xc, 0x3f, 0xfe, 0xc0, 0xc7, 0x8c, 0xf, 0xfc, 0x78, 0xc0, 0xff, 0xc5,
+    0xff, 0xc7, 0xf0, 0x1f, 0xfc, 0x66, 0x1, 0x8c, 0x6, 0x60, 0x1f, 0xfc,
+    0x66, 0x1, 0xff, 0xc6, 0x62, 0x18, 0xc0, 0xe6, 0x61, 0x8c, 0xc, 0x66,
+    0x1f, 0xff, 0xc7, 0xe0, 0xff, 0xf8, 0x7e, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+89D2 */
+    0x0, 0x40, 0x0, 0x0, 0x30, 0x0, 0x0, 0x1f, 0xff, 0x0, 0xf, 0xff,
+    0xe0, 0x7, 0x0, 0x70, 0x7, 0x80, 0x38, 0x3, 0xc0, 0x1c, 0x1, 0xef,
+    0xff, 0xfc, 0x67, 0xff, 0xff, 0x81, 0x81, 0xc0, 0x60, 0xe0, 0x70, 0x18,
+    0x38, 0x1c, 0x6, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xe0, 0xe0, 0x70,
+    0x18, 0x38, 0x1c, 0x6, 0xe, 0x7, 0x1, 0x83, 0x81, 0xc0, 0x60, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xfe, 0xc, 0x0, 0x1, 0x87, 0x0, 0x0, 0x63,
+    0xc0, 0x0, 0x18, 0xe0, 0x0, 0x6, 0x78, 0x0, 0x1f, 0x9c, 0x0, 0xf,
+    0xe6, 0x0, 0x1, 0xe0,
+
+    /* U+89E3 */
+    0x4, 0x0, 0x0, 0x0, 0xe0, 0x3f, 0xf0, 0xf, 0xe7, 0xff, 0xc1, 0xff,
+    0x7, 0x1e, 0x38, 0x70, 0x70, 0xe3, 0xe, 0x6, 0xc, 0x71, 0xc0, 0xe0,
+    0xc7, 0xff, 0x9c, 0x1c, 0x1f, 0xf9, 0xcf, 0xc3, 0x99, 0xf8, 0xf0, 0x31,
+    0x98, 0x0, 0x3, 0x19, 0x8c, 0xc0, 0x3f, 0xf9, 0xcc, 0x3, 0xff, 0x9f,
+    0xfc, 0x39, 0x99, 0xff, 0xe3, 0x19, 0xb9, 0xc0, 0x31, 0x9f, 0xc, 0x3,
+    0x19, 0x80, 0xc0, 0x3f, 0xf8, 0xc, 0x3, 0xff, 0xbf, 0xfe, 0x30, 0x1b,
+    0xff, 0xe3, 0x1, 0x80, 0xc0, 0x70, 0x18, 0xc, 0x6, 0x1, 0x80, 0xc0,
+    0x60, 0x18, 0xc, 0x6, 0xf, 0x80, 0xc0, 0x40, 0xf0, 0x8, 0x0,
+
+    /* U+8A00 */
+    0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x1, 0xc0, 0x0, 0x38, 0x1c, 0x0,
+    0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x80, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A02 */
+    0x3f, 0xe0, 0x0, 0x3, 0xfe, 0x3f, 0xfc, 0x3f, 0xc7, 0xff, 0xe0, 0x0,
+    0x3f, 0xfc, 0x7f, 0xf0, 0xc, 0x7, 0xff, 0x0, 0xc0, 0x3f, 0xe0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x3f, 0xe0, 0xc, 0x3, 0xfe, 0x0, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x3f, 0xe0, 0xc, 0x3, 0xfe, 0x0,
+    0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x1f, 0xc0, 0xc, 0x3,
+    0xfe, 0x0, 0xc0, 0x38, 0xe0, 0xc, 0x3, 0x6, 0x0, 0xc0, 0x30, 0x60,
+    0xc, 0x3, 0x6, 0x0, 0xc0, 0x38, 0xe0, 0x1c, 0x3, 0xfe, 0x1f, 0xc0,
+    0xf, 0x81, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A08 */
+    0x0, 0x0, 0x10, 0x3, 0xfe, 0x3, 0x80, 0x3f, 0xe0, 0x38, 0x1, 0xfc,
+    0x3, 0x80, 0x0, 0x0, 0x38, 0x7, 0xff, 0x3, 0x80, 0x7f, 0xf0, 0x38,
+    0x3, 0xfe, 0x3, 0x80, 0x0, 0x0, 0x38, 0x3, 0xfc, 0x3, 0x80, 0x3f,
+    0xef, 0xff, 0xe0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x38, 0x3, 0xfe, 0x3,
+    0x80, 0x3f, 0xe0, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x1,
+    0xfc, 0x3, 0x80, 0x3f, 0xe0, 0x38, 0x3, 0x6, 0x3, 0x80, 0x30, 0x60,
+    0x38, 0x3, 0x6, 0x3, 0x80, 0x30, 0x60, 0x38, 0x3, 0xe, 0x3, 0x80,
+    0x3f, 0xe0, 0x38, 0x1, 0xfc, 0x3, 0x80, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+8A0A */
+    0x3f, 0x80, 0x0, 0x3, 0xfd, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x18, 0x30, 0x7f, 0xc1, 0x83, 0x7, 0xfe, 0x18, 0x30, 0x0, 0x1, 0x83,
+    0x0, 0x0, 0x18, 0x30, 0x3f, 0xc1, 0x83, 0x3, 0xfc, 0x18, 0x30, 0x0,
+    0xf, 0xf3, 0x0, 0x0, 0xff, 0x30, 0x3f, 0xc1, 0xc3, 0x3, 0xfc, 0x18,
+    0x30, 0x0, 0x1, 0x83, 0x0, 0x0, 0x18, 0x30, 0x1f, 0x81, 0x83, 0x3,
+    0xfc, 0x18, 0x30, 0x30, 0xc1, 0x83, 0x23, 0xc, 0x18, 0x36, 0x30, 0xc1,
+    0x83, 0x63, 0xc, 0x18, 0x1e, 0x30, 0xc1, 0x81, 0xe3, 0xfc, 0x18, 0x1e,
+    0x3f, 0x81, 0x80, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+8A0E */
+    0x0, 0x0, 0x2, 0x3, 0xfe, 0x0, 0x30, 0x3f, 0xe0, 0x7, 0x0, 0x0,
+    0x0, 0x70, 0x0, 0x0, 0x7, 0x7, 0xff, 0x0, 0x70, 0x7f, 0xf7, 0xff,
+    0xe0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x7, 0x3, 0xfe, 0x0, 0x70, 0x3f,
+    0xe0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x3, 0x7, 0x3, 0xfe, 0x38,
+    0x70, 0x3f, 0xe1, 0x87, 0x0, 0x0, 0x1c, 0x70, 0x0, 0x0, 0xe7, 0x1,
+    0xfc, 0x6, 0x70, 0x3f, 0xe0, 0x7, 0x3, 0x6, 0x0, 0x70, 0x30, 0x60,
+    0x7, 0x3, 0x6, 0x0, 0x70, 0x30, 0x60, 0x7, 0x3, 0x8e, 0x0, 0x70,
+    0x3f, 0xe0, 0x3e, 0x1, 0xfc, 0x7, 0xe0, 0x0, 0x0, 0x78, 0x0,
+
+    /* U+8A13 */
+    0x0, 0x0, 0x0, 0x7, 0xf8, 0xc2, 0x18, 0xff, 0x18, 0x63, 0x0, 0x3,
+    0xc, 0x60, 0x0, 0x61, 0x8c, 0xff, 0xcc, 0x31, 0x9f, 0xfd, 0x86, 0x30,
+    0x0, 0x30, 0xc6, 0x0, 0x6, 0x18, 0xc7, 0xf8, 0xc3, 0x18, 0xff, 0x18,
+    0x63, 0x0, 0x3, 0xc, 0x60, 0x0, 0x61, 0x8c, 0x7f, 0x8c, 0x31, 0x8f,
+    0xf1, 0x86, 0x30, 0x0, 0x30, 0xc6, 0x0, 0x6, 0x18, 0xc3, 0xf0, 0xc3,
+    0x18, 0xff, 0x18, 0x63, 0x18, 0x63, 0xc, 0x63, 0xc, 0x61, 0x8c, 0x61,
+    0x9c, 0x31, 0x8c, 0x33, 0x6, 0x31, 0xc6, 0x60, 0xc6, 0x3f, 0xdc, 0x0,
+    0xc1, 0xe3, 0x0, 0x18, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+8A18 */
+    0x3f, 0xc0, 0x0, 0x3, 0xfe, 0x7f, 0xf8, 0x1f, 0xc7, 0xff, 0x80, 0x0,
+    0x0, 0x18, 0x7f, 0xe0, 0x1, 0x87, 0xff, 0x0, 0x18, 0x0, 0x0, 0x1,
+    0x80, 0x0, 0x0, 0x18, 0x3f, 0xc0, 0x1, 0x83, 0xfe, 0x0, 0x38, 0x0,
+    0x3, 0xff, 0x80, 0x0, 0x3f, 0xf0, 0x3f, 0xe7, 0x0, 0x3, 0xfe, 0x70,
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x1f, 0xc7, 0x0, 0x3,
+    0xfe, 0x70, 0x0, 0x30, 0xe7, 0x0, 0x3, 0x6, 0x70, 0x6, 0x30, 0x67,
+    0x0, 0x63, 0x6, 0x70, 0xe, 0x38, 0xe3, 0xe3, 0xe3, 0xfc, 0x3f, 0xfc,
+    0x1f, 0x81, 0xff, 0x80,
+
+    /* U+8A1F */
+    0x3f, 0x80, 0x7c, 0x3, 0xfc, 0x7, 0xe0, 0x1f, 0x80, 0xe, 0x0, 0x0,
+    0x30, 0x60, 0x7f, 0xc3, 0x7, 0x7, 0xfe, 0x70, 0x70, 0x3f, 0x86, 0x3,
+    0x0, 0x0, 0x60, 0x30, 0x3f, 0xce, 0x3, 0x83, 0xfc, 0xc0, 0x18, 0x0,
+    0xc, 0x1, 0xc0, 0x1, 0xc6, 0xe, 0x3f, 0xd8, 0xe0, 0xe3, 0xfd, 0xe,
+    0x6, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x1f, 0x81, 0xc4, 0x3,
+    0xfc, 0x18, 0x70, 0x30, 0xc1, 0x87, 0x3, 0xc, 0x30, 0x38, 0x30, 0xc3,
+    0x1, 0x83, 0xc, 0x30, 0xfc, 0x39, 0xdf, 0xff, 0xe3, 0xfd, 0xff, 0x8e,
+    0xf, 0x8, 0x0, 0x60,
+
+    /* U+8A2A */
+    0x0, 0x0, 0x20, 0x3, 0xfc, 0x6, 0x0, 0x3f, 0xc0, 0x70, 0x1, 0xf8,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x7, 0xfc, 0xff, 0xfe, 0x7f, 0xef, 0xff,
+    0xe3, 0xf8, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x3, 0xfc, 0x1c, 0x0, 0x3f,
+    0xc1, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x1, 0xff, 0x83, 0xfc, 0x1c,
+    0x3c, 0x3f, 0xc1, 0x81, 0xc0, 0x0, 0x18, 0x1c, 0x0, 0x1, 0x81, 0xc1,
+    0xf8, 0x18, 0x18, 0x3f, 0xc3, 0x81, 0x83, 0xc, 0x38, 0x18, 0x30, 0xc3,
+    0x1, 0x83, 0xc, 0x70, 0x18, 0x30, 0xce, 0x3, 0x83, 0x1d, 0xe0, 0x78,
+    0x3f, 0xdc, 0x3f, 0x0, 0xf1, 0x83, 0xe0, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+8A2D */
+    0x3f, 0x81, 0xf8, 0x3, 0xfc, 0x3f, 0xc0, 0x1f, 0x83, 0x1c, 0x0, 0x0,
+    0x30, 0xc0, 0x7f, 0xc3, 0xc, 0x7, 0xfe, 0x30, 0xc6, 0x0, 0x7, 0xc,
+    0x60, 0x0, 0x60, 0xe6, 0x3f, 0x8e, 0xf, 0xe3, 0xfd, 0xc0, 0x7c, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xcf, 0xff, 0x83, 0xfc, 0xff,
+    0xfc, 0x0, 0x0, 0x3, 0x80, 0x0, 0x30, 0x38, 0x1f, 0x83, 0x7, 0x3,
+    0xfc, 0x38, 0xe0, 0x31, 0xc1, 0xce, 0x3, 0xc, 0xf, 0xc0, 0x30, 0xc0,
+    0xf8, 0x3, 0xc, 0x1f, 0xc0, 0x39, 0xc7, 0xff, 0x83, 0xfd, 0xf8, 0x7e,
+    0x1f, 0x3e, 0x3, 0xe0, 0x1, 0x0, 0x0,
+
+    /* U+8A31 */
+    0x0, 0x1, 0x0, 0x3, 0xfc, 0x38, 0x0, 0x3f, 0xc3, 0x0, 0x0, 0x0,
+    0x30, 0x0, 0x0, 0x7, 0x0, 0x7, 0xfe, 0x7f, 0xfe, 0x7f, 0xe7, 0xff,
+    0xc0, 0x0, 0xe3, 0x80, 0x0, 0xc, 0x38, 0x3, 0xfd, 0xc3, 0x80, 0x3f,
+    0xc8, 0x38, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x3, 0xfc, 0x3,
+    0x80, 0x3f, 0xdf, 0xff, 0xe0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x38, 0x1,
+    0xf8, 0x3, 0x80, 0x3f, 0xc0, 0x38, 0x3, 0xc, 0x3, 0x80, 0x30, 0xc0,
+    0x38, 0x3, 0xc, 0x3, 0x80, 0x30, 0xc0, 0x38, 0x3, 0x8c, 0x3, 0x80,
+    0x3f, 0xc0, 0x38, 0x0, 0xf8, 0x3, 0x80, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+8A34 */
+    0x0, 0x0, 0x0, 0x83, 0xf8, 0x3, 0xfc, 0x3f, 0xc7, 0xff, 0xc1, 0xf8,
+    0x7f, 0x80, 0x0, 0xe, 0x0, 0x7, 0xfc, 0xe0, 0x0, 0x7f, 0xee, 0x0,
+    0x3, 0xfc, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x3, 0xfc, 0xff, 0xfe, 0x3f,
+    0xcf, 0xff, 0xe0, 0x0, 0xe0, 0xe0, 0x0, 0xe, 0xe, 0x3, 0xfc, 0xe0,
+    0xe0, 0x3f, 0xce, 0xe, 0x0, 0x0, 0xec, 0xe0, 0x0, 0xe, 0xfe, 0x1,
+    0xf8, 0xc7, 0xe0, 0x3f, 0xcc, 0xf, 0x83, 0xc, 0xc0, 0xfe, 0x30, 0xcc,
+    0xe, 0xe3, 0xd, 0xc0, 0xe6, 0x30, 0xdc, 0xe, 0x3, 0x1d, 0x80, 0xe0,
+    0x3f, 0xf8, 0xe, 0x0, 0xf1, 0x0, 0xe0, 0x0, 0x0, 0x4, 0x0,
+
+    /* U+8A3A */
+    0x0, 0x0, 0x20, 0x3, 0xfc, 0x6, 0x0, 0x3f, 0xc0, 0xf0, 0x1, 0xf8,
+    0xf, 0x0, 0x0, 0x1, 0xd8, 0x7, 0xfc, 0x39, 0xc0, 0x7f, 0xe3, 0xe,
+    0x3, 0xfc, 0x70, 0x70, 0x0, 0xe, 0x3, 0xc3, 0xf9, 0xc3, 0x1e, 0x3f,
+    0xf8, 0x70, 0xe0, 0x0, 0x1e, 0x2, 0x0, 0x3, 0xc0, 0x3, 0xfc, 0x78,
+    0x0, 0x3f, 0xce, 0xe, 0x0, 0x0, 0xc1, 0xc0, 0x0, 0x0, 0x78, 0x1,
+    0xf8, 0x1f, 0x0, 0x3f, 0xc7, 0xc0, 0xc3, 0xc, 0x78, 0x3c, 0x30, 0xc4,
+    0x7, 0x83, 0xc, 0x0, 0xf0, 0x30, 0xc0, 0x7e, 0x3, 0x1c, 0x1f, 0x80,
+    0x3f, 0xcf, 0xe0, 0x0, 0xf0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A3B */
+    0x0, 0x0, 0x0, 0x3, 0xfc, 0xe, 0x0, 0x3f, 0xc0, 0xf0, 0x1, 0xf8,
+    0x7, 0x80, 0x0, 0x0, 0x18, 0x7, 0xfe, 0x0, 0x0, 0x7f, 0xef, 0xff,
+    0xe3, 0xfc, 0xff, 0xfe, 0x0, 0x0, 0x30, 0x3, 0xfc, 0x3, 0x0, 0x3f,
+    0xc0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x3, 0xfc, 0x3,
+    0x0, 0x3f, 0xc7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x30, 0x1,
+    0xf8, 0x3, 0x0, 0x3f, 0xc0, 0x30, 0x3, 0xc, 0x3, 0x0, 0x30, 0xc0,
+    0x30, 0x3, 0xc, 0x3, 0x0, 0x30, 0xc0, 0x30, 0x3, 0x8c, 0xff, 0xfe,
+    0x3f, 0xdf, 0xff, 0xe1, 0xf8, 0x0, 0x0,
+
+    /* U+8A50 */
+    0x0, 0x0, 0x80, 0x3, 0xfc, 0x18, 0x0, 0x3f, 0xe1, 0x80, 0x1, 0xf8,
+    0x38, 0x0, 0x0, 0x3, 0xff, 0xc7, 0xfe, 0x7f, 0xfe, 0x7f, 0xf7, 0xff,
+    0xc0, 0x0, 0xe7, 0x0, 0x0, 0xc, 0x70, 0x3, 0xfd, 0xc7, 0x0, 0x3f,
+    0xd8, 0x70, 0x0, 0x1, 0x7, 0xf8, 0x0, 0x0, 0x7f, 0xc3, 0xfc, 0x7,
+    0x0, 0x3f, 0xc0, 0x70, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x1,
+    0xfc, 0x7, 0x0, 0x3f, 0xc0, 0x7f, 0xc3, 0xe, 0x7, 0xfc, 0x30, 0xe0,
+    0x70, 0x3, 0xe, 0x7, 0x0, 0x30, 0xe0, 0x70, 0x3, 0xe, 0x7, 0x0,
+    0x3f, 0xc0, 0x70, 0x1, 0xf8, 0x3, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+8A55 */
+    0x3f, 0x87, 0xff, 0x83, 0xfd, 0xff, 0xfe, 0x1f, 0x8f, 0xff, 0xc0, 0x0,
+    0x3, 0x0, 0x7f, 0xc0, 0x30, 0x7, 0xfe, 0x33, 0x20, 0x0, 0x3, 0x33,
+    0x0, 0x0, 0x73, 0x38, 0x3f, 0x86, 0x31, 0x83, 0xfc, 0xe3, 0x1c, 0x0,
+    0xc, 0x30, 0xc0, 0x0, 0x83, 0x4, 0x3f, 0xc0, 0x30, 0x3, 0xfc, 0x3,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x1, 0xff, 0xfe, 0x1f, 0x80, 0x30, 0x3,
+    0xfc, 0x3, 0x0, 0x31, 0xc0, 0x30, 0x3, 0xc, 0x3, 0x0, 0x30, 0xc0,
+    0x30, 0x3, 0xc, 0x3, 0x0, 0x31, 0xc0, 0x30, 0x3, 0xfc, 0x3, 0x0,
+    0xf, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+8A5E */
+    0x3f, 0x8f, 0xfe, 0x7, 0xfb, 0xff, 0xf8, 0x7e, 0x7f, 0xff, 0x0, 0x0,
+    0x0, 0x67, 0xfe, 0x0, 0xc, 0xff, 0xc0, 0x1, 0x8f, 0xf3, 0xff, 0x30,
+    0x0, 0x7f, 0xc6, 0x3f, 0xc0, 0x0, 0xc7, 0xf8, 0x0, 0x18, 0x0, 0x0,
+    0x3, 0x0, 0x3, 0xfc, 0x63, 0xfc, 0xff, 0x8c, 0x7f, 0x98, 0x31, 0x80,
+    0x3, 0x6, 0x30, 0x0, 0x60, 0xc6, 0x1f, 0x8c, 0x18, 0xc7, 0xf9, 0x83,
+    0x18, 0xc3, 0x3f, 0xe3, 0x18, 0x67, 0xfc, 0x63, 0xc, 0x0, 0xc, 0x61,
+    0x80, 0x1, 0x8c, 0x70, 0x0, 0x71, 0xfe, 0x0, 0x7e, 0xf, 0x0, 0xf,
+    0x80, 0x0, 0x1, 0xc0,
+
+    /* U+8A62 */
+    0x0, 0x3, 0x0, 0x7, 0xf0, 0x60, 0x0, 0xff, 0x1c, 0x0, 0xf, 0xc3,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0xff, 0x9f, 0xff, 0x9f, 0xfb, 0x80, 0x71,
+    0xfc, 0xe0, 0x7, 0x0, 0x18, 0x0, 0xe7, 0xf7, 0x7e, 0x1c, 0xff, 0xff,
+    0xe3, 0x0, 0x7, 0x1c, 0x60, 0x0, 0xc1, 0x8c, 0x7f, 0x18, 0x31, 0x8f,
+    0xf3, 0x86, 0x30, 0x0, 0x7f, 0xc6, 0x0, 0xf, 0xf8, 0xc3, 0xf1, 0x83,
+    0x18, 0xff, 0x30, 0x63, 0x18, 0xe7, 0xc, 0x63, 0xc, 0xff, 0x8c, 0x61,
+    0x8f, 0xf3, 0x8c, 0x30, 0x0, 0x71, 0xce, 0x0, 0xc, 0x3f, 0x80, 0x1f,
+    0x83, 0xe0, 0x3, 0xe0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+8A66 */
+    0x0, 0x0, 0x18, 0x3, 0xf8, 0x1, 0x90, 0x3f, 0x80, 0x19, 0x81, 0xf0,
+    0x1, 0x9c, 0x0, 0x0, 0x18, 0xc7, 0xf8, 0x1, 0x80, 0x7f, 0xff, 0xff,
+    0xe0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x18, 0x3, 0xf8, 0x1, 0x80, 0x3f,
+    0x80, 0x18, 0x0, 0x1, 0xfd, 0x80, 0x0, 0x3f, 0xfc, 0x3, 0xf9, 0xfd,
+    0xc0, 0x3f, 0x87, 0x1c, 0x0, 0x0, 0x70, 0xc0, 0x0, 0x7, 0xc, 0x3,
+    0xf8, 0x70, 0xc0, 0x3f, 0x87, 0xe, 0x3, 0x18, 0x70, 0xe2, 0x31, 0x87,
+    0x6, 0x63, 0x18, 0x7e, 0x66, 0x31, 0x9f, 0xe7, 0x63, 0x1b, 0xf0, 0x3e,
+    0x3f, 0xb8, 0x3, 0xe1, 0xf0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A69 */
+    0x0, 0x0, 0x20, 0x3, 0xf8, 0x6, 0x0, 0x3f, 0xc0, 0x60, 0x1, 0xf8,
+    0x7, 0x0, 0x0, 0xf, 0xff, 0xc7, 0xfc, 0xff, 0xfc, 0x7f, 0xe0, 0x60,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x3, 0xf8, 0xff, 0xfc, 0x3f,
+    0xdf, 0xff, 0xe0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x6, 0x3, 0xf8, 0x0,
+    0x60, 0x3f, 0xc0, 0x6, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xe1,
+    0xf8, 0x0, 0x70, 0x3f, 0xc4, 0x6, 0x3, 0xc, 0x70, 0x60, 0x30, 0xc3,
+    0x86, 0x3, 0xc, 0x38, 0x60, 0x30, 0xc0, 0x86, 0x3, 0x9c, 0x0, 0x60,
+    0x3f, 0x80, 0x3e, 0x1, 0xf0, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+8A71 */
+    0x0, 0x0, 0x0, 0x3, 0xfc, 0x7, 0xfc, 0x3f, 0xcf, 0xff, 0x81, 0xf9,
+    0xff, 0x80, 0x0, 0x0, 0x30, 0x7, 0xfe, 0x3, 0x0, 0x7f, 0xe0, 0x30,
+    0x3, 0xfc, 0x3, 0x0, 0x0, 0xf, 0xff, 0xe3, 0xfd, 0xff, 0xfe, 0x3f,
+    0xc0, 0x78, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x3, 0xfc, 0x3,
+    0x0, 0x3f, 0xc0, 0x30, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x7, 0xff, 0xc1,
+    0xf8, 0xf0, 0x1c, 0x3f, 0xce, 0x1, 0xc3, 0xc, 0xe0, 0x1c, 0x30, 0xce,
+    0x1, 0xc3, 0xc, 0xe0, 0x1c, 0x30, 0xce, 0x1, 0xc3, 0x1c, 0x70, 0x3c,
+    0x3f, 0xc7, 0xff, 0x81, 0xf0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A72 */
+    0x0, 0x0, 0x20, 0x3, 0xfc, 0x3, 0x0, 0x3f, 0xc0, 0x30, 0x1, 0xf8,
+    0x3, 0x0, 0x0, 0xf, 0xff, 0xe7, 0xfd, 0xff, 0xfe, 0x7f, 0xe0, 0x70,
+    0x3, 0xfc, 0xe, 0x0, 0x0, 0x0, 0xc0, 0x3, 0xf8, 0x1c, 0x30, 0x3f,
+    0xdb, 0x87, 0x0, 0x1, 0xf0, 0xe0, 0x0, 0xf, 0x1c, 0x3, 0xfc, 0x3b,
+    0x80, 0x3f, 0xc1, 0xf0, 0xc0, 0x0, 0xe, 0x1c, 0x0, 0x1, 0xc3, 0xc1,
+    0xf8, 0x38, 0x78, 0x3f, 0xc7, 0x7, 0x3, 0xd, 0xe0, 0xe0, 0x30, 0xdc,
+    0x1c, 0x3, 0xc, 0x7, 0xf0, 0x30, 0xc1, 0xf7, 0x83, 0xc, 0x3c, 0x3c,
+    0x3f, 0xcf, 0x81, 0xe1, 0xf9, 0xe0, 0xe, 0x0, 0x18, 0x0, 0x20,
+
+    /* U+8A73 */
+    0x0, 0x0, 0x1, 0x3, 0xf8, 0x60, 0x30, 0x3f, 0xc7, 0x7, 0x0, 0x0,
+    0x30, 0x60, 0x0, 0x1, 0x86, 0x7, 0xfc, 0x0, 0xe0, 0x7f, 0xef, 0xff,
+    0xe0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x30, 0x3, 0xfc, 0x3, 0x0, 0x3f,
+    0xc0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0xf, 0xff, 0xc3, 0xfc, 0x7f,
+    0xf8, 0x3f, 0xc0, 0x30, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x1,
+    0xf9, 0xff, 0xfc, 0x3f, 0xdf, 0xff, 0xe3, 0xc, 0xff, 0xfc, 0x30, 0xc0,
+    0x30, 0x3, 0xc, 0x3, 0x0, 0x30, 0xc0, 0x30, 0x3, 0x1c, 0x3, 0x0,
+    0x3f, 0xc0, 0x30, 0x1, 0xf0, 0x3, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+8A79 */
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x3f,
+    0xff, 0x80, 0x7, 0xff, 0xf8, 0x0, 0xe0, 0x3, 0x80, 0x3e, 0x0, 0x70,
+    0x7, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xe0, 0xc1, 0xc6, 0x8, 0xc,
+    0xf8, 0x7f, 0x80, 0xdf, 0x3, 0xf8, 0xc, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf8, 0xc, 0xff, 0xff, 0x0, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xe0,
+    0xc0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0x81, 0x9f, 0xff, 0xf8, 0x38, 0x0, 0x0, 0x3, 0x9f, 0xff, 0xf8,
+    0x73, 0x80, 0x1, 0xc7, 0x38, 0x0, 0x1c, 0x61, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0,
+
+    /* U+8A8C */
+    0x0, 0x0, 0x20, 0x3, 0xf8, 0x7, 0x0, 0x7f, 0xc0, 0x70, 0x1, 0xf8,
+    0x7, 0x0, 0x0, 0x1f, 0xff, 0xe7, 0xfb, 0xff, 0xfe, 0x7f, 0xc0, 0x70,
+    0x3, 0xf8, 0x7, 0x0, 0x0, 0x0, 0x70, 0x3, 0xf8, 0x7, 0x0, 0x3f,
+    0x80, 0x70, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xc3, 0xf8, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x3, 0xb8, 0x1,
+    0xf9, 0xb9, 0x98, 0x3f, 0x9b, 0x99, 0x83, 0x19, 0xb8, 0xc, 0x31, 0x9b,
+    0x82, 0xc3, 0x1b, 0xb8, 0x3e, 0x31, 0xb3, 0x86, 0x63, 0x1b, 0x38, 0xe6,
+    0x3f, 0xb1, 0xfe, 0x1, 0xf0, 0xf, 0xc0,
+
+    /* U+8A8D */
+    0x3f, 0x80, 0x0, 0x7, 0xfd, 0xff, 0xfc, 0x1f, 0x8f, 0xff, 0xe0, 0x0,
+    0x6, 0xe, 0x7f, 0xc0, 0x60, 0xe7, 0xfe, 0x7e, 0xe, 0x3f, 0x87, 0xc0,
+    0xc0, 0x0, 0x1f, 0xc, 0x3f, 0x81, 0xf8, 0xc7, 0xf8, 0x19, 0x8c, 0x0,
+    0x3, 0x1, 0xc0, 0x0, 0xf0, 0x7c, 0x3f, 0x9e, 0xf, 0x87, 0xf9, 0x80,
+    0x40, 0x0, 0x0, 0x30, 0x0, 0x0, 0x13, 0x80, 0x3f, 0x81, 0x99, 0x3,
+    0xf9, 0x98, 0x18, 0x71, 0xd9, 0x81, 0xc6, 0x1d, 0x98, 0xc, 0x61, 0xd9,
+    0x86, 0xe6, 0x1f, 0x98, 0x66, 0x71, 0xb1, 0x86, 0x63, 0xfb, 0x1f, 0xe0,
+    0x1f, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A95 */
+    0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x1e, 0x3f, 0xff, 0x3f, 0xc1, 0xf3,
+    0xf7, 0xf0, 0x0, 0x6, 0x76, 0x7, 0xf8, 0x60, 0x60, 0x7f, 0xcc, 0x6,
+    0x3, 0xf0, 0xc0, 0x60, 0x0, 0x18, 0x26, 0x3, 0xf1, 0x83, 0x70, 0x3f,
+    0xbf, 0x37, 0xe0, 0x3, 0xf3, 0x7c, 0x0, 0x3, 0x36, 0x3, 0xf0, 0x33,
+    0x60, 0x3f, 0x83, 0x36, 0x0, 0x3, 0x33, 0x60, 0x0, 0x33, 0x36, 0x1,
+    0xf3, 0xb3, 0x60, 0x3f, 0x9b, 0x37, 0x3, 0x19, 0xef, 0xfe, 0x31, 0x8e,
+    0xff, 0xe3, 0x18, 0xe0, 0x0, 0x31, 0x9f, 0x80, 0x3, 0x3b, 0xff, 0xc0,
+    0x3f, 0x30, 0xff, 0xe1, 0xe7, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8A9E */
+    0x3f, 0xc0, 0x0, 0x3, 0xfd, 0xff, 0xfe, 0x1f, 0x8f, 0xff, 0xc0, 0x0,
+    0xc, 0x0, 0x7f, 0xe0, 0xc0, 0x7, 0xfe, 0x1c, 0x0, 0x3f, 0xcf, 0xff,
+    0x0, 0x0, 0x7f, 0xf0, 0x3f, 0xc1, 0x83, 0x83, 0xfc, 0x18, 0x38, 0x0,
+    0x1, 0x83, 0x80, 0x0, 0x38, 0x38, 0x3f, 0xdf, 0xff, 0xe3, 0xfd, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x87, 0xff, 0x83,
+    0xfc, 0x7f, 0xfc, 0x30, 0xc6, 0x1, 0xc3, 0xc, 0x60, 0x1c, 0x30, 0xc6,
+    0x1, 0xc3, 0xc, 0x60, 0x1c, 0x31, 0xc6, 0x1, 0xc3, 0xfc, 0x7f, 0xf8,
+    0x1f, 0x83, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+8AAA */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x7f, 0xc0, 0x7e, 0x3, 0xfc,
+    0x10, 0x70, 0x0, 0x3, 0x3, 0x0, 0x0, 0x70, 0x38, 0x7f, 0xee, 0x1,
+    0xc7, 0xfc, 0xc0, 0xe, 0x0, 0x1f, 0xff, 0xe3, 0xf9, 0xff, 0xfa, 0x3f,
+    0xc7, 0x3, 0x81, 0xf8, 0x60, 0x18, 0x0, 0x6, 0x1, 0x83, 0xfc, 0x60,
+    0x18, 0x3f, 0xc6, 0x1, 0x80, 0x0, 0x7f, 0xf8, 0x0, 0x3, 0xff, 0x1,
+    0xf8, 0x1d, 0xc0, 0x3f, 0xc1, 0xdc, 0x3, 0xc, 0x1d, 0xc0, 0x30, 0xc1,
+    0x9c, 0x3, 0xc, 0x19, 0xc6, 0x30, 0xc3, 0x9c, 0x63, 0x1c, 0xf1, 0xc6,
+    0x3f, 0xde, 0xf, 0xe1, 0xfb, 0xc0, 0xfc, 0x0, 0x10, 0x0, 0x0,
+
+    /* U+8AB0 */
+    0x0, 0x1, 0x0, 0x3, 0xfc, 0x38, 0x60, 0x3f, 0xc3, 0xe, 0x1, 0xf8,
+    0x70, 0xc0, 0x0, 0x6, 0x1c, 0x7, 0xfc, 0xe1, 0x80, 0x7f, 0xff, 0xff,
+    0xe0, 0x1, 0xff, 0xfe, 0x0, 0x3e, 0x18, 0x3, 0xfb, 0x61, 0x80, 0x3f,
+    0xc6, 0x18, 0x0, 0x0, 0x61, 0xc0, 0x0, 0x7, 0xff, 0xc3, 0xfc, 0x7f,
+    0xfc, 0x3f, 0xc6, 0x18, 0x0, 0x0, 0x61, 0x80, 0x0, 0x6, 0x18, 0x1,
+    0xf8, 0x7f, 0xfc, 0x3f, 0xc7, 0xff, 0xc3, 0xc, 0x61, 0xc0, 0x30, 0xc6,
+    0x18, 0x3, 0xc, 0x61, 0x80, 0x30, 0xc6, 0x18, 0x3, 0x9c, 0x61, 0x80,
+    0x3f, 0xc7, 0xff, 0xe0, 0xf0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8AB2 */
+    0x1f, 0x83, 0xfe, 0x3, 0xfc, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xc0, 0x1,
+    0xc7, 0xc, 0x7f, 0xdc, 0x70, 0xc7, 0xfd, 0xff, 0xfc, 0x0, 0x1f, 0xff,
+    0xc0, 0x1, 0xc7, 0x1c, 0x3f, 0x9c, 0x70, 0xc3, 0xf9, 0xc7, 0x1c, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0xff, 0xf8, 0x3f, 0x80, 0x70, 0x3, 0xf8, 0x7,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x3, 0xff, 0xfe, 0x1f, 0x80, 0xf8, 0x3,
+    0xf8, 0xf, 0x80, 0x31, 0x81, 0xfc, 0x3, 0x18, 0x3f, 0xe0, 0x31, 0x87,
+    0x77, 0x83, 0x19, 0xe7, 0x3c, 0x31, 0xbc, 0x71, 0xe3, 0xfb, 0x7, 0x6,
+    0x1f, 0x0, 0x70, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+8ABF */
+    0x3f, 0x87, 0xff, 0xf, 0xf1, 0xff, 0xf8, 0x7c, 0x7f, 0xff, 0x0, 0xe,
+    0x10, 0x67, 0xfd, 0x83, 0xc, 0xff, 0xb0, 0x61, 0x80, 0x6, 0x3f, 0x30,
+    0x0, 0xcf, 0xf6, 0x3f, 0x98, 0x70, 0xc7, 0xf3, 0x6, 0x18, 0x0, 0x61,
+    0xc3, 0x0, 0xd, 0xff, 0x63, 0xf9, 0x9f, 0xcc, 0x7f, 0x30, 0x1, 0x80,
+    0x6, 0x3f, 0x30, 0x0, 0xcf, 0xe6, 0x3f, 0x19, 0x8e, 0xc7, 0xf3, 0x30,
+    0xd8, 0xc6, 0x66, 0x1b, 0x18, 0xcc, 0xc7, 0x63, 0x1b, 0x9f, 0xcc, 0x63,
+    0x73, 0xf9, 0x8c, 0x6e, 0x0, 0x31, 0xfd, 0x80, 0x3e, 0x1f, 0x70, 0x7,
+    0xc0, 0x4, 0x0, 0xe0,
+
+    /* U+8AC7 */
+    0x0, 0x0, 0x20, 0x3, 0xf8, 0x6, 0x0, 0x3f, 0xc0, 0x60, 0x1, 0xf8,
+    0xc6, 0x1c, 0x0, 0xc, 0x61, 0xc7, 0xfd, 0xc7, 0x38, 0x7f, 0xd8, 0xf3,
+    0x3, 0xf9, 0x8f, 0x80, 0x0, 0x1, 0xdc, 0x3, 0xf8, 0x18, 0xe0, 0x3f,
+    0x87, 0x87, 0x80, 0x0, 0xf0, 0x3c, 0x0, 0x3c, 0x1, 0xe3, 0xfb, 0x86,
+    0xe, 0x3f, 0x80, 0x60, 0x0, 0x0, 0x46, 0xc, 0x0, 0xc, 0x61, 0xc3,
+    0xf8, 0xc6, 0x18, 0x3f, 0x9c, 0xf3, 0x83, 0x1d, 0x8f, 0xb0, 0x31, 0xc0,
+    0xd8, 0x3, 0x1c, 0x1c, 0xc0, 0x31, 0xc3, 0x8f, 0x3, 0x1c, 0xf0, 0x78,
+    0x3f, 0x9e, 0x3, 0xe1, 0xf3, 0xc0, 0xe, 0x0, 0x10, 0x0, 0x0,
+
+    /* U+8ACB */
+    0x0, 0x0, 0x30, 0x3, 0xf8, 0x3, 0x0, 0x3f, 0xcf, 0xff, 0xc1, 0xf8,
+    0xff, 0xfe, 0x0, 0x0, 0x30, 0x7, 0xfc, 0x3, 0x0, 0x7f, 0xe7, 0xff,
+    0x83, 0xf8, 0x7f, 0xf8, 0x0, 0x0, 0x30, 0x3, 0xf8, 0x3, 0x80, 0x3f,
+    0xdf, 0xff, 0xe0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x3f,
+    0xf8, 0x3f, 0xc7, 0xff, 0x80, 0x0, 0x60, 0x1c, 0x0, 0x7, 0xff, 0xc1,
+    0xf8, 0x7f, 0xfc, 0x3f, 0xc6, 0x1, 0xc3, 0xc, 0x60, 0x1c, 0x30, 0xc7,
+    0xff, 0xc3, 0xc, 0x7f, 0xfc, 0x30, 0xc6, 0x1, 0xc3, 0xc, 0x60, 0x1c,
+    0x3f, 0xc6, 0x1, 0x81, 0xf8, 0x60, 0xf8, 0x0, 0x4, 0x6, 0x0,
+
+    /* U+8AD6 */
+    0x0, 0x0, 0x60, 0x3, 0xf8, 0xe, 0x0, 0x3f, 0x80, 0xf0, 0x1, 0xf0,
+    0x1f, 0x80, 0x0, 0x3, 0x98, 0x7, 0xfc, 0x30, 0xc0, 0x7f, 0xc7, 0xe,
+    0x3, 0xf8, 0xe0, 0x78, 0x0, 0x1f, 0xff, 0xc3, 0xfb, 0xff, 0xfe, 0x3f,
+    0xf0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x3, 0xf9, 0xff,
+    0xf8, 0x3f, 0x99, 0x99, 0xc0, 0x3, 0x99, 0x8c, 0x0, 0x39, 0x98, 0xc3,
+    0xf3, 0x99, 0x8c, 0x3f, 0xbf, 0xff, 0xc3, 0x1b, 0xff, 0xfc, 0x31, 0xb9,
+    0x98, 0xc3, 0x1b, 0x99, 0x8c, 0x31, 0xb9, 0x98, 0xc3, 0x1b, 0x99, 0x8c,
+    0x3f, 0xb9, 0x99, 0xc1, 0xf1, 0x99, 0xf8, 0x0, 0x10, 0x3, 0x0,
+
+    /* U+8AED */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x3f, 0x80, 0xe0, 0x3, 0xf8,
+    0xf, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x39, 0xc0, 0x7f, 0xc7, 0xf,
+    0x7, 0xfc, 0xe0, 0x7c, 0x0, 0x3f, 0xff, 0xe0, 0x3, 0xff, 0xee, 0x3f,
+    0xa1, 0xfc, 0x3, 0xf8, 0x0, 0x0, 0x0, 0xf, 0x80, 0xc0, 0x1, 0xfc,
+    0xcc, 0x3f, 0x98, 0xcc, 0xc3, 0xf9, 0x8c, 0xcc, 0x0, 0x1f, 0xcc, 0xc0,
+    0x1, 0xfc, 0xcc, 0x3f, 0x98, 0xcc, 0xc3, 0xf9, 0x8c, 0xcc, 0x31, 0x9f,
+    0xcc, 0xc3, 0x19, 0xfc, 0xcc, 0x31, 0x98, 0xcc, 0xc3, 0x19, 0x8c, 0xc,
+    0x31, 0x98, 0xc0, 0xc3, 0xf9, 0x8c, 0x1c, 0x1f, 0x1b, 0xc7, 0xc0, 0x1,
+    0x18, 0x78,
+
+    /* U+8AFE */
+    0x0, 0x1, 0x6, 0x3, 0xf8, 0x30, 0x60, 0x3f, 0xc3, 0x6, 0x1, 0xf9,
+    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xe7, 0xfc, 0x30, 0x60, 0x7f, 0xe3, 0x6,
+    0x3, 0xf8, 0x17, 0x60, 0x0, 0x0, 0x60, 0x3, 0xf8, 0x6, 0x0, 0x3f,
+    0xff, 0xff, 0xe0, 0x1, 0xff, 0xfe, 0x0, 0x1, 0xc0, 0x3, 0xf8, 0x18,
+    0x0, 0x3f, 0xc3, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0xf, 0xff, 0xc1,
+    0xf9, 0xff, 0xfc, 0x3f, 0xdf, 0x0, 0xc3, 0x1f, 0x30, 0xc, 0x30, 0xc3,
+    0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0x1c, 0x30, 0x1c,
+    0x3f, 0xc3, 0xff, 0xc1, 0xf0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8B19 */
+    0x0, 0x4, 0x6, 0x3, 0xf0, 0x60, 0x60, 0x3f, 0x87, 0xe, 0x1, 0xf0,
+    0x70, 0xc0, 0x0, 0x3f, 0xff, 0xe7, 0xfb, 0xff, 0xfe, 0x7f, 0xc3, 0x18,
+    0x0, 0x0, 0x31, 0x80, 0x0, 0x1f, 0xff, 0x83, 0xf1, 0xff, 0xf8, 0x3f,
+    0x83, 0x19, 0xc0, 0x0, 0x31, 0x8c, 0x0, 0x3f, 0xff, 0xe3, 0xfb, 0xff,
+    0xfe, 0x3f, 0x83, 0x18, 0xc0, 0x0, 0x31, 0x8c, 0x0, 0x3, 0xb9, 0x81,
+    0xf1, 0xff, 0xf8, 0x3f, 0x83, 0x9c, 0x3, 0x18, 0x71, 0xc0, 0x31, 0x8f,
+    0x1e, 0x3, 0x18, 0xf1, 0xb0, 0x31, 0x9b, 0x1b, 0x83, 0x3b, 0xb1, 0x9c,
+    0x3f, 0xf3, 0x18, 0xe1, 0xe2, 0x31, 0x86, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+8B1B */
+    0x0, 0x1, 0x4, 0x3, 0xf8, 0x30, 0xe0, 0x3f, 0x83, 0x8e, 0x1, 0xf1,
+    0xff, 0xfe, 0x0, 0x3, 0x8e, 0x7, 0xfc, 0x30, 0xe0, 0x7f, 0xcf, 0xff,
+    0x83, 0xf8, 0xff, 0xf8, 0x0, 0x3, 0xe, 0x3, 0xf8, 0x30, 0xe0, 0x3f,
+    0xbf, 0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x60, 0x3, 0xf8, 0xff,
+    0xf8, 0x3f, 0x8f, 0xff, 0x80, 0x0, 0xc6, 0x18, 0x0, 0x1c, 0x71, 0x83,
+    0xf1, 0xff, 0xf8, 0x3f, 0x9c, 0x61, 0x83, 0x19, 0xc6, 0x18, 0x31, 0xbf,
+    0xff, 0xe3, 0x1b, 0xff, 0xfe, 0x31, 0x9c, 0x1, 0x83, 0x19, 0xc0, 0x18,
+    0x3f, 0x9c, 0x3, 0x81, 0xf1, 0xc0, 0xf8, 0x0, 0x8, 0xf, 0x0,
+
+    /* U+8B1D */
+    0x0, 0x6, 0x0, 0x83, 0xf0, 0x60, 0x18, 0x3f, 0x86, 0x1, 0x80, 0x0,
+    0xf0, 0x18, 0x0, 0x1f, 0xc1, 0x87, 0xfb, 0x9c, 0x18, 0x7f, 0xf0, 0xc1,
+    0xc0, 0x3, 0x8f, 0xfe, 0x0, 0x3f, 0xdf, 0xe3, 0xf3, 0x8c, 0x18, 0x3f,
+    0xb0, 0xc1, 0x80, 0x3, 0xc, 0x18, 0x0, 0x3f, 0xd1, 0x83, 0xf3, 0xfd,
+    0x98, 0x3f, 0xb0, 0xdd, 0x80, 0x3, 0xc, 0xd8, 0x0, 0x3f, 0xcd, 0x81,
+    0xf7, 0xfc, 0x58, 0x3f, 0xb3, 0xc1, 0x83, 0x18, 0x7c, 0x18, 0x31, 0x8e,
+    0xc1, 0x83, 0x19, 0xcc, 0x18, 0x31, 0xb8, 0xc1, 0x83, 0x1f, 0xc, 0x18,
+    0x3f, 0x81, 0xcf, 0x83, 0xf0, 0x78, 0xf8, 0x0, 0x7, 0xe, 0x0,
+
+    /* U+8B49 */
+    0x3f, 0x8f, 0xc0, 0x3, 0xf9, 0xfe, 0x10, 0x1f, 0x0, 0xe3, 0x0, 0x0,
+    0xf, 0x60, 0x7f, 0xd9, 0xdc, 0x47, 0xfd, 0xd9, 0xcc, 0x3f, 0x8f, 0xf,
+    0x80, 0x0, 0x60, 0x70, 0x3f, 0x8c, 0x3, 0x83, 0xf9, 0xff, 0xfc, 0x0,
+    0x3f, 0xfe, 0xe0, 0x6, 0x0, 0x6, 0x3f, 0x80, 0x0, 0x3, 0xf8, 0xff,
+    0xf0, 0x0, 0xf, 0xff, 0x80, 0x1, 0xc0, 0x38, 0x3f, 0x9c, 0x1, 0x83,
+    0xf9, 0xc0, 0x38, 0x31, 0x8f, 0xff, 0x83, 0x18, 0x7f, 0xf0, 0x31, 0x83,
+    0xc, 0x3, 0x18, 0x30, 0xc0, 0x31, 0x83, 0xc, 0x3, 0xfb, 0xff, 0xfe,
+    0x1f, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+8B58 */
+    0x0, 0x2, 0xc, 0x3, 0xf0, 0x70, 0xc0, 0x3f, 0x87, 0xc, 0x1, 0xf3,
+    0xfe, 0xc0, 0x0, 0x7f, 0xed, 0x87, 0xf9, 0x8c, 0xcc, 0x7f, 0x98, 0xcc,
+    0xc0, 0x1, 0x8c, 0xc6, 0x0, 0x18, 0xcc, 0x3, 0xf1, 0x8c, 0xc0, 0x3f,
+    0xff, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0xc, 0x3, 0xf0, 0xf8,
+    0xc0, 0x3f, 0x9f, 0xcc, 0xc0, 0x3, 0x8e, 0xcc, 0x0, 0x30, 0x6f, 0xc3,
+    0xf3, 0xe, 0x78, 0x3f, 0xbf, 0xe7, 0x83, 0x1b, 0xfe, 0x70, 0x31, 0xb0,
+    0x67, 0x23, 0x1b, 0xe, 0x76, 0x31, 0x9f, 0xdf, 0x63, 0x39, 0xff, 0xbe,
+    0x3f, 0x80, 0x71, 0xe1, 0xe0, 0xe, 0x1c, 0x0, 0x0, 0xc0, 0x0,
+
+    /* U+8B5A */
+    0x3f, 0x3f, 0xff, 0xe3, 0xfb, 0xff, 0xfe, 0x0, 0x1, 0x8c, 0x0, 0x0,
+    0x18, 0xc0, 0x7f, 0x9f, 0xff, 0xc7, 0xfd, 0xdd, 0xdc, 0x0, 0x39, 0x8c,
+    0xe0, 0x1, 0x98, 0xce, 0x3f, 0x9f, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x3f, 0x9f, 0xff, 0xc3, 0xf9, 0x80,
+    0x1c, 0x0, 0x1f, 0xff, 0xc0, 0x1, 0xff, 0xfc, 0x3f, 0x9c, 0x1, 0xc3,
+    0xf8, 0xff, 0xf8, 0x31, 0x87, 0xff, 0x3, 0x18, 0x7, 0x0, 0x31, 0xbf,
+    0xff, 0xe3, 0x1b, 0xff, 0xfe, 0x31, 0x80, 0x70, 0x3, 0xf8, 0x7, 0x0,
+    0x1f, 0x0, 0x70, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+8B66 */
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x2, 0x0, 0x7f, 0xfe, 0x60, 0x7, 0xff,
+    0xef, 0xfc, 0x6, 0x60, 0xff, 0xe1, 0x80, 0x1e, 0x30, 0x3f, 0xff, 0xb7,
+    0x7, 0x0, 0xc3, 0x60, 0x7f, 0xcc, 0x1c, 0x1, 0x8e, 0xc3, 0xe0, 0x1f,
+    0xed, 0xf7, 0x80, 0xff, 0xfc, 0x1e, 0x0, 0x39, 0x0, 0x60, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8B70 */
+    0x0, 0x2, 0x6, 0x3, 0xf0, 0x70, 0x60, 0x3f, 0x83, 0xc, 0x0, 0x1,
+    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xc7, 0xf8, 0x6, 0x0, 0x7f, 0xc0, 0x60,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x60, 0x3, 0xf8, 0x6, 0x0, 0x3f,
+    0xbf, 0xff, 0xe0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x99, 0x3, 0xfb, 0xfd,
+    0x98, 0x3f, 0xbf, 0x18, 0xc0, 0x0, 0x71, 0x80, 0x0, 0x3f, 0xff, 0xe3,
+    0xf3, 0xff, 0xfc, 0x3f, 0x83, 0xc, 0x7, 0x18, 0x7c, 0xcc, 0x71, 0xbf,
+    0xcf, 0x87, 0x1b, 0xf0, 0x70, 0x71, 0x83, 0xe, 0x27, 0x18, 0x73, 0xf2,
+    0x3f, 0x86, 0x73, 0xe3, 0xf1, 0xe4, 0x1e, 0x0, 0x1c, 0x0, 0x40,
+
+    /* U+8B77 */
+    0x0, 0x0, 0x4, 0x3, 0xf0, 0x30, 0x60, 0x3f, 0xbf, 0xff, 0xe1, 0xf3,
+    0xff, 0xfe, 0x0, 0x3, 0xe, 0x7, 0xf8, 0x30, 0x60, 0x7f, 0xcc, 0x30,
+    0x0, 0x1, 0xc7, 0x0, 0x0, 0x3f, 0xff, 0xe3, 0xf3, 0xc3, 0x0, 0x3f,
+    0xff, 0xff, 0x80, 0x1, 0xff, 0xf8, 0x0, 0x18, 0x30, 0x3, 0xf9, 0xff,
+    0xf8, 0x3f, 0x9f, 0xff, 0x80, 0x1, 0xc3, 0x0, 0x0, 0xf, 0xff, 0xe3,
+    0xf0, 0x7f, 0xfc, 0x3f, 0x80, 0x0, 0x3, 0x1b, 0xff, 0xf8, 0x31, 0x9f,
+    0xff, 0x83, 0x18, 0x60, 0x70, 0x31, 0x83, 0x9e, 0x3, 0x18, 0x1f, 0x80,
+    0x3f, 0x8f, 0xff, 0xc1, 0xe7, 0xf8, 0xfe, 0x0, 0x30, 0x0, 0x40,
+
+    /* U+8B80 */
+    0x0, 0x0, 0x20, 0x3, 0xf0, 0x7, 0x0, 0x3f, 0x9f, 0xff, 0xe1, 0xf0,
+    0xff, 0xfc, 0x0, 0x0, 0x70, 0x7, 0xf8, 0xff, 0xfc, 0x7f, 0xc0, 0x0,
+    0x0, 0x1, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xe3, 0xf9, 0x99, 0x86, 0x3f,
+    0x9b, 0x8f, 0xe0, 0x1, 0x80, 0xe, 0x0, 0x1f, 0xff, 0xe3, 0xf8, 0xff,
+    0xf8, 0x3f, 0x83, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0, 0xc, 0x0, 0xc3,
+    0xf8, 0xff, 0xfc, 0x3f, 0x8c, 0x0, 0xc3, 0x18, 0xff, 0xfc, 0x31, 0x8f,
+    0xff, 0xc3, 0x18, 0xc0, 0xc, 0x31, 0x8f, 0xff, 0xc3, 0x18, 0x3f, 0xe0,
+    0x3f, 0x87, 0x8f, 0x1, 0xf3, 0xf0, 0x7e, 0x0, 0x38, 0x0, 0xe0,
+
+    /* U+8B8A */
+    0xc, 0x0, 0x6, 0x1, 0xc3, 0xf8, 0x60, 0x18, 0x0, 0xc, 0x7, 0x33,
+    0xfb, 0x9c, 0x73, 0x7f, 0xf9, 0x83, 0xe0, 0x1, 0xf8, 0xd, 0x3f, 0x8f,
+    0x41, 0xd9, 0xf8, 0xec, 0x7f, 0xc0, 0x3f, 0xe7, 0xef, 0xfb, 0xfe, 0xc,
+    0x0, 0x3, 0x2, 0xd9, 0xf1, 0x34, 0x6d, 0xbf, 0x93, 0x66, 0xcb, 0xf,
+    0x36, 0x6c, 0xbf, 0xb3, 0x20, 0xc5, 0xf8, 0x30, 0x0, 0xc0, 0x0, 0x0,
+    0x3f, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xc1, 0xf8, 0x3, 0x80, 0x38, 0xc0,
+    0x30, 0x2, 0x7, 0xe, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x1, 0xfe, 0x0,
+    0x1f, 0xff, 0xff, 0xe7, 0xfe, 0x3, 0xfe, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+8B93 */
+    0x0, 0x0, 0x20, 0x3, 0xf8, 0x7, 0x0, 0x7f, 0xbf, 0xff, 0xe3, 0xf3,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xf8, 0xf8, 0x7f, 0xdf, 0xdf,
+    0xc3, 0xf9, 0x8d, 0x86, 0x0, 0x18, 0xd8, 0xc3, 0xf9, 0xf9, 0xfc, 0x3f,
+    0x83, 0xe, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xc3, 0xf8, 0x38,
+    0xe0, 0x3f, 0x8f, 0xff, 0x80, 0x1, 0xff, 0xfc, 0x0, 0x3, 0xe, 0x1,
+    0xf1, 0xff, 0xfc, 0x3f, 0xbf, 0xff, 0xe3, 0x18, 0x1f, 0x8, 0x31, 0x87,
+    0x99, 0xc3, 0x19, 0xf1, 0xf8, 0x31, 0xff, 0xf, 0x3, 0x1b, 0x37, 0x78,
+    0x3f, 0x87, 0xf1, 0xe1, 0xf1, 0xf8, 0xe, 0x0, 0x18, 0x0, 0x0,
+
+    /* U+8C46 */
+    0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x1, 0xc0, 0x0, 0x38, 0x1c,
+    0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x80, 0xe0, 0x0,
+    0x70, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x1, 0x0, 0x10, 0x0,
+    0x18, 0x1, 0x80, 0x1, 0xc0, 0x38, 0x0, 0x1c, 0x3, 0x0, 0x0, 0xc0,
+    0x30, 0x0, 0x8, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+8C50 */
+    0x0, 0x86, 0x10, 0x3, 0x8, 0x63, 0xc, 0x37, 0xf6, 0xfe, 0xc3, 0x3e,
+    0x67, 0xcc, 0x31, 0xc6, 0x38, 0xc3, 0x7f, 0x6f, 0xcc, 0x31, 0x86, 0x30,
+    0xc3, 0x7f, 0x6f, 0xec, 0x37, 0xf6, 0xfc, 0xc3, 0x18, 0x63, 0xc, 0x3f,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8C6C */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xe, 0x0, 0x7f, 0xf0, 0xe0, 0x47, 0xff,
+    0xe, 0xc, 0x6, 0x7, 0xfd, 0xc0, 0xc0, 0x7f, 0xf8, 0x1c, 0x20, 0xe7,
+    0x3, 0xc7, 0xe, 0x70, 0x76, 0x60, 0xee, 0x6, 0x6f, 0xff, 0xfe, 0x7,
+    0xdf, 0xff, 0xe0, 0xf0, 0x7, 0x0, 0x1f, 0x80, 0x60, 0x3, 0x9e, 0x1c,
+    0x0, 0x71, 0xb3, 0xc0, 0x6, 0x39, 0x7f, 0xf8, 0x7, 0x8f, 0xff, 0xc0,
+    0xf9, 0xf0, 0xc, 0x1d, 0xb3, 0x0, 0xc3, 0x98, 0x3f, 0xfc, 0x71, 0x83,
+    0xff, 0xc6, 0x18, 0x30, 0x1c, 0x1, 0x83, 0x0, 0xc0, 0x38, 0x38, 0x1c,
+    0x1f, 0x83, 0xff, 0xc1, 0xf0, 0x1f, 0xf8, 0xc, 0x0, 0x0, 0x0,
+
+    /* U+8C93 */
+    0x0, 0x0, 0x2, 0x0, 0x18, 0x18, 0x70, 0x7, 0x81, 0x87, 0x1, 0xf0,
+    0x18, 0x70, 0x7e, 0xf, 0xff, 0xe7, 0x30, 0xff, 0xfe, 0x3, 0xe1, 0xc7,
+    0x3, 0x1e, 0x18, 0x70, 0x3b, 0xc1, 0x87, 0x1, 0xf8, 0x18, 0x70, 0x1f,
+    0x0, 0x0, 0x7, 0xf0, 0x3f, 0xf0, 0x63, 0x8f, 0xff, 0xc0, 0xf8, 0xe3,
+    0x9c, 0x1c, 0xcc, 0x30, 0xe7, 0x8c, 0xc3, 0xe, 0x31, 0xcc, 0x30, 0xe0,
+    0x3c, 0xff, 0xfe, 0x7, 0x6f, 0xff, 0xe1, 0xe6, 0xc3, 0x8e, 0x3c, 0x6c,
+    0x30, 0xe7, 0xe, 0xc3, 0xe, 0x0, 0xec, 0x30, 0xe0, 0x1c, 0xe3, 0xc,
+    0xf, 0xcf, 0xff, 0xc0, 0xf8, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8C9D */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xe0,
+    0x0, 0x70, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3,
+    0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1c,
+    0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81,
+    0xc0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff,
+    0xfc, 0x0, 0x4, 0x2, 0x0, 0x1, 0xe0, 0x78, 0x0, 0xfc, 0x3, 0xf0,
+    0x7f, 0x0, 0xf, 0xe7, 0xc0, 0x0, 0x3e, 0x60, 0x0, 0x0, 0x40,
+
+    /* U+8CA0 */
+    0x0, 0x40, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x7f,
+    0xff, 0x0, 0xf, 0x0, 0xf0, 0x3, 0xc0, 0xe, 0x0, 0x78, 0x1, 0xc0,
+    0x7, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x38, 0xc,
+    0x0, 0x3, 0x80, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80, 0xc0, 0x0,
+    0x38, 0xc, 0x0, 0x3, 0x80, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80,
+    0xc0, 0x0, 0x38, 0xc, 0x0, 0x3, 0x80, 0xe0, 0x0, 0x30, 0xf, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x40, 0x70, 0x0, 0x3e, 0x7, 0xe0,
+    0x3f, 0xc0, 0x3f, 0xc7, 0xe0, 0x0, 0x7e, 0x60, 0x0, 0x0, 0x60,
+
+    /* U+8CA1 */
+    0x0, 0x0, 0x2, 0x0, 0xfc, 0x0, 0x70, 0x1f, 0xf0, 0x7, 0x1, 0x87,
+    0x0, 0x70, 0x38, 0x30, 0x7, 0x3, 0x83, 0x0, 0x70, 0x38, 0x37, 0xff,
+    0xe3, 0xff, 0x7f, 0xfe, 0x3f, 0xf0, 0xf, 0x3, 0x83, 0x0, 0xf0, 0x38,
+    0x30, 0x1f, 0x3, 0x83, 0x1, 0xf0, 0x3f, 0xf0, 0x3f, 0x3, 0xff, 0x3,
+    0x70, 0x38, 0x30, 0x67, 0x3, 0x83, 0xe, 0x70, 0x38, 0x31, 0xc7, 0x1,
+    0x87, 0x38, 0x70, 0x1f, 0xf7, 0x87, 0x0, 0xfe, 0x70, 0x70, 0x0, 0x6,
+    0x7, 0x0, 0xc6, 0x0, 0x70, 0x1c, 0x70, 0x7, 0x3, 0x83, 0x80, 0x70,
+    0x70, 0x18, 0x3e, 0x6, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x38, 0x0,
+
+    /* U+8CA2 */
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0, 0x1c,
+    0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xf8, 0x18, 0x0, 0x1, 0x81, 0xc0, 0x0, 0x38, 0x1f, 0xff, 0xff, 0x81,
+    0xc0, 0x0, 0x38, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x7c, 0x3, 0xfc, 0x3, 0xfc,
+    0x7f, 0x0, 0xf, 0xe7, 0x0, 0x0, 0xe,
+
+    /* U+8CA8 */
+    0x0, 0x82, 0x0, 0x0, 0x38, 0x70, 0x78, 0x7, 0x7, 0x7f, 0x0, 0xe0,
+    0x7f, 0x80, 0x3e, 0x7, 0x0, 0x67, 0xe0, 0x70, 0x6, 0x66, 0x7, 0x0,
+    0x60, 0x60, 0x3f, 0xfe, 0x6, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xc0, 0x0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0, 0x1e, 0x7, 0x80,
+    0x1f, 0xc0, 0x7f, 0xc7, 0xf0, 0x0, 0xfe, 0x70, 0x0, 0x0, 0x60,
+
+    /* U+8CAA */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0x3e, 0xf, 0x80, 0xf, 0xc0, 0x7f,
+    0x7, 0xef, 0xfe, 0xfe, 0x78, 0x0, 0x3, 0xe4, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x3f, 0xff,
+    0xc0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0,
+    0x0, 0x60, 0x60, 0x0, 0xfe, 0x7, 0xf8, 0x7f, 0x80, 0x1f, 0xe7, 0x80,
+    0x0, 0xe,
+
+    /* U+8CAC */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0,
+    0x70, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xe, 0x6, 0x0,
+    0xf, 0xe0, 0x7f, 0x7, 0xfc, 0x1, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CB7 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc3, 0x6,
+    0xe, 0xc, 0x30, 0x60, 0xe0, 0xc3, 0x6, 0xe, 0xc, 0x3f, 0xff, 0xff,
+    0xc1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0x1, 0xc0, 0x0, 0x38, 0x18, 0x0, 0x1, 0x81, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x81, 0x80, 0x0, 0x18, 0x1c, 0x0, 0x3, 0x81,
+    0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3, 0x81, 0xc0, 0x0, 0x38, 0x1f, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc7, 0xf0, 0x0, 0xfe, 0x70, 0x0, 0x0, 0xe0,
+
+    /* U+8CB8 */
+    0x1, 0x1, 0xc, 0x0, 0x70, 0x38, 0xe0, 0x7, 0x1, 0x86, 0x0, 0xe0,
+    0x3f, 0xfe, 0x1e, 0x7f, 0xff, 0xc3, 0xef, 0xfe, 0x0, 0x7e, 0x0, 0xe0,
+    0x26, 0xe0, 0x7, 0x6, 0xe, 0x0, 0x3e, 0xe0, 0xc0, 0x0, 0xfe, 0x0,
+    0x0, 0x7, 0xc0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x6, 0x2, 0x0,
+    0xf, 0xe0, 0x7f, 0x87, 0xfc, 0x3, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CBB */
+    0x0, 0x20, 0xc0, 0x0, 0x7, 0xc, 0x0, 0x3f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xf8, 0x0, 0x70, 0xc1, 0xc0, 0x7, 0x1e, 0x38, 0x1f, 0xff, 0xff,
+    0x81, 0x86, 0xc, 0x0, 0x38, 0x60, 0xc0, 0x3, 0xff, 0xff, 0xfc, 0xf,
+    0xff, 0xff, 0xe0, 0x3c, 0xc, 0xc, 0x1f, 0x0, 0xc3, 0xc7, 0xff, 0xff,
+    0xf0, 0x6f, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0,
+    0x3, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xc0,
+    0x7, 0xe0, 0x7f, 0x7, 0xfc, 0x3, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CBC */
+    0x0, 0x0, 0x30, 0x0, 0xfc, 0x3, 0x0, 0x3f, 0xe0, 0x30, 0x3, 0x86,
+    0x3, 0x0, 0x30, 0x60, 0x30, 0x3, 0x6, 0x3, 0x0, 0x30, 0x60, 0x3f,
+    0xe3, 0xfe, 0x3, 0xfe, 0x3f, 0xe0, 0x30, 0x3, 0x6, 0x3, 0x0, 0x30,
+    0x60, 0x30, 0x3, 0x6, 0x3, 0x0, 0x3f, 0xe0, 0x30, 0x3, 0xfe, 0x1f,
+    0xf0, 0x30, 0x63, 0xff, 0xc3, 0x6, 0x7f, 0xfc, 0x30, 0x66, 0x0, 0xc3,
+    0x86, 0x60, 0xc, 0x3f, 0xe6, 0x0, 0xc1, 0xfc, 0x60, 0xc, 0x8, 0x6,
+    0x0, 0xc1, 0x8c, 0x60, 0xc, 0x38, 0xe6, 0x0, 0xc3, 0x6, 0x70, 0x1c,
+    0x70, 0x77, 0xff, 0xc6, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8CBF */
+    0x0, 0x30, 0x0, 0x0, 0x7f, 0x3f, 0xf8, 0x1f, 0xc3, 0xff, 0xc1, 0xc0,
+    0x6, 0x1c, 0x18, 0x60, 0x60, 0xc1, 0x83, 0xe, 0xc, 0x19, 0xf1, 0xc1,
+    0xc3, 0xff, 0xb8, 0xf8, 0x7e, 0x3, 0xf, 0x6, 0x0, 0x20, 0x0, 0xf,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0xe, 0x7, 0x0,
+    0x1f, 0xe0, 0x7f, 0xc7, 0xf8, 0x1, 0xfe, 0x78, 0x0, 0x0, 0xe0,
+
+    /* U+8CC0 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7f, 0xf8, 0xff, 0xc7, 0xff,
+    0xcf, 0xfc, 0x7, 0x1d, 0xc0, 0xc0, 0x60, 0xdc, 0xc, 0xe, 0xd, 0xc0,
+    0xc1, 0xc1, 0xce, 0x1c, 0x38, 0xf8, 0xff, 0xc7, 0x8f, 0x7, 0xf0, 0x60,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x6, 0x2, 0x0,
+    0xf, 0xe0, 0x7f, 0x87, 0xfc, 0x1, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CC4 */
+    0x0, 0x0, 0x60, 0x0, 0xf8, 0x6, 0x0, 0x3f, 0xc0, 0x60, 0x3, 0x8c,
+    0xe, 0x0, 0x30, 0xef, 0xff, 0xe3, 0xf, 0xff, 0xfe, 0x30, 0xe1, 0xc0,
+    0x3, 0xfe, 0x18, 0x0, 0x3f, 0xe1, 0x80, 0x3, 0xe, 0x3f, 0xf0, 0x30,
+    0xe3, 0xff, 0x83, 0xe, 0x7f, 0xfc, 0x3f, 0xef, 0x80, 0xc3, 0xfe, 0xf8,
+    0xc, 0x30, 0xff, 0xff, 0xc3, 0xf, 0xbf, 0xfc, 0x30, 0xe3, 0x80, 0xc3,
+    0x8c, 0x38, 0xc, 0x3f, 0xc3, 0x81, 0xc1, 0xfc, 0x3f, 0xfc, 0x0, 0x3,
+    0x81, 0xc1, 0x8c, 0x38, 0xc, 0x38, 0xc3, 0x80, 0xc3, 0xe, 0x38, 0xc,
+    0x70, 0x63, 0x87, 0xc6, 0x0, 0x30, 0x78, 0x0, 0x1, 0x7, 0x0,
+
+    /* U+8CC7 */
+    0x0, 0xc, 0x0, 0x1, 0xc1, 0xc0, 0x0, 0x1e, 0x3f, 0xff, 0x80, 0x67,
+    0xff, 0xfc, 0x0, 0xe1, 0xc1, 0xc0, 0xc, 0x1c, 0x38, 0x0, 0x3, 0xe7,
+    0x0, 0xe0, 0x77, 0x40, 0x1e, 0x1e, 0x3e, 0x3, 0xcf, 0x81, 0xfc, 0x71,
+    0xc0, 0x3, 0xe6, 0x3f, 0xff, 0xc4, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x70, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x6, 0x6, 0x0,
+    0xf, 0xe0, 0x7f, 0x7, 0xfc, 0x3, 0xfe, 0x78, 0x0, 0x3, 0xe0,
+
+    /* U+8CD3 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xfc, 0x70, 0x0, 0x0, 0xe6, 0x3f, 0xff, 0xce, 0x67, 0xff, 0xfe,
+    0xe6, 0x0, 0xe0, 0x4, 0x1, 0xc6, 0x7, 0x0, 0xf8, 0x67, 0xe0, 0x1e,
+    0x7, 0xf8, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xfc, 0x0, 0x7, 0xff, 0xff,
+    0xf0, 0x4e, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0,
+    0xe0, 0x0, 0x30, 0xe, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0,
+    0x3, 0x0, 0xe0, 0x0, 0x70, 0x7, 0xff, 0xff, 0x0, 0x6, 0x6, 0x0,
+    0x7, 0xe0, 0x7f, 0x7, 0xfc, 0x3, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CDE */
+    0x2, 0x6, 0x4, 0x0, 0x70, 0x60, 0xc0, 0x3, 0x6, 0xc, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0xe, 0x73, 0xff, 0xfc,
+    0xe7, 0x7f, 0xff, 0xce, 0x26, 0x0, 0x6, 0x40, 0x7f, 0xff, 0xe0, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xfe, 0x0, 0x6, 0x2, 0x0,
+    0xf, 0xe0, 0x7f, 0x87, 0xfc, 0x1, 0xfe, 0x78, 0x0, 0x1, 0xe0,
+
+    /* U+8CE2 */
+    0x1f, 0xfc, 0xff, 0x83, 0xff, 0xef, 0xfc, 0x30, 0xc0, 0x1, 0xc3, 0xff,
+    0x84, 0x18, 0x3f, 0xfc, 0x63, 0x83, 0x0, 0xe7, 0x30, 0x3f, 0xfc, 0x3e,
+    0x3, 0xff, 0xc1, 0xe0, 0x30, 0xc0, 0x3e, 0x3, 0xff, 0xc7, 0xf8, 0x3f,
+    0xfd, 0xe3, 0xe0, 0x0, 0x8, 0xe, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x60, 0x70, 0x0, 0x7e, 0x7, 0xf0,
+    0x7f, 0xc0, 0x3f, 0xe7, 0x80, 0x0, 0x1e,
+
+    /* U+8CE3 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0x6, 0xe, 0xe, 0x70,
+    0x60, 0x60, 0x67, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0x0, 0x3, 0x81,
+    0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x81, 0xc0, 0x0, 0x38, 0xf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xc0,
+    0x3, 0xe0, 0x7f, 0x7, 0xfc, 0x3, 0xfe, 0x7c, 0x0, 0x3, 0xe0,
+
+    /* U+8CEA */
+    0x0, 0x30, 0x3, 0x80, 0xff, 0xf, 0xf8, 0x1f, 0x1, 0xf0, 0x1, 0x80,
+    0x18, 0x0, 0x1f, 0xf9, 0xff, 0xc1, 0xff, 0xdf, 0xfe, 0x18, 0xe1, 0x87,
+    0x3, 0x8e, 0x38, 0x60, 0x30, 0xe3, 0x6, 0x7, 0xe, 0x70, 0x60, 0x60,
+    0x44, 0x2, 0x4, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0,
+    0x30, 0x1c, 0x0, 0x3, 0x1, 0xff, 0xff, 0xf0, 0x1c, 0x0, 0x3, 0x1,
+    0xc0, 0x0, 0x30, 0x1f, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf0, 0x1c, 0x0,
+    0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x6, 0x6, 0x0,
+    0xf, 0xe0, 0xff, 0x7, 0xfc, 0x3, 0xfe, 0x70, 0x0, 0x1, 0xe0,
+
+    /* U+8CF4 */
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x3, 0xff, 0xc7, 0xff,
+    0x9f, 0xfc, 0x7f, 0xf8, 0x60, 0xc0, 0x30, 0xe, 0xc, 0x3, 0x1, 0xc3,
+    0xc0, 0xfe, 0x38, 0x78, 0x3f, 0xf2, 0x0, 0x3, 0x33, 0x9f, 0xf8, 0x33,
+    0x19, 0xff, 0xc3, 0x31, 0xb8, 0x1c, 0x33, 0x1b, 0x0, 0xc3, 0x33, 0xbf,
+    0xfc, 0x3f, 0xfb, 0xff, 0xc1, 0xff, 0x30, 0xc, 0x7, 0x3, 0x81, 0xc0,
+    0x70, 0x3f, 0xfc, 0xf, 0xc3, 0x81, 0xc0, 0xf7, 0x30, 0xc, 0x1b, 0x3b,
+    0xff, 0xc3, 0xb1, 0x9f, 0xf8, 0x73, 0x0, 0x42, 0x6, 0x30, 0xc, 0x70,
+    0x43, 0x7, 0xc3, 0xc0, 0x30, 0xf0, 0x1e, 0x3, 0xc, 0x0, 0x20,
+
+    /* U+8CFC */
+    0x0, 0x3, 0x4, 0x1, 0xf0, 0x30, 0xe0, 0x3f, 0x83, 0xe, 0x3, 0xbb,
+    0xff, 0xfe, 0x31, 0x83, 0xe, 0x3, 0x18, 0x30, 0xe0, 0x31, 0x8f, 0xff,
+    0x83, 0xf8, 0xff, 0xf8, 0x3f, 0x83, 0xe, 0x3, 0x18, 0x30, 0xe0, 0x31,
+    0xbf, 0xff, 0xe3, 0x19, 0xff, 0xfc, 0x3f, 0x80, 0x60, 0x3, 0xf8, 0xff,
+    0xf8, 0x31, 0x8f, 0xff, 0x83, 0x19, 0xc6, 0x18, 0x31, 0x9c, 0x71, 0x83,
+    0x19, 0xff, 0xf8, 0x3f, 0x98, 0x61, 0x81, 0xf1, 0x86, 0x18, 0x0, 0x3f,
+    0xff, 0xe3, 0x33, 0xff, 0xfe, 0x31, 0x98, 0x1, 0x87, 0x19, 0x80, 0x18,
+    0x60, 0xd8, 0x3, 0x86, 0x1, 0x80, 0xf8, 0x0, 0x8, 0xf, 0x0,
+
+    /* U+8D8A */
+    0x1, 0x0, 0x10, 0x0, 0x38, 0x1, 0xb0, 0x3, 0x80, 0x19, 0x80, 0x38,
+    0x1, 0x88, 0x3f, 0xf0, 0x38, 0x3, 0xff, 0x3f, 0xfe, 0x3, 0x87, 0xff,
+    0xc0, 0x38, 0x71, 0x80, 0x3, 0x86, 0x18, 0x0, 0x38, 0x61, 0x84, 0x7f,
+    0xfe, 0x18, 0xc7, 0xff, 0x61, 0x9c, 0x1, 0x86, 0x19, 0x80, 0x18, 0x60,
+    0xf8, 0x19, 0x86, 0xf, 0x1, 0x9f, 0x66, 0xf0, 0x39, 0xf7, 0xee, 0x23,
+    0x18, 0x7c, 0xe6, 0x39, 0x87, 0xbf, 0x63, 0x98, 0x27, 0xbe, 0x3f, 0x80,
+    0xe1, 0xe3, 0x78, 0x1c, 0xc, 0x77, 0x80, 0x0, 0x6, 0x3f, 0x80, 0x0,
+    0x60, 0xff, 0xff, 0xe4, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8D9F */
+    0x1, 0x0, 0x10, 0x0, 0x38, 0x1, 0x80, 0x3, 0x83, 0x19, 0xc0, 0x38,
+    0x31, 0x98, 0x3f, 0xf1, 0x9b, 0x83, 0xff, 0x19, 0xb0, 0x3, 0x80, 0x18,
+    0x0, 0x38, 0x1f, 0xf0, 0x3, 0x83, 0xff, 0xc0, 0x38, 0x70, 0x1c, 0x7f,
+    0xf6, 0x0, 0xc7, 0xff, 0x67, 0xcc, 0x1, 0x86, 0x7e, 0xc0, 0x18, 0x66,
+    0x6c, 0x19, 0x86, 0x66, 0xc1, 0x9f, 0x66, 0x6c, 0x39, 0xf6, 0x6e, 0xc3,
+    0x98, 0x67, 0xcc, 0x39, 0x86, 0x18, 0xc3, 0x98, 0x60, 0xc, 0x3d, 0x86,
+    0x3, 0xc3, 0x78, 0x60, 0x78, 0x77, 0x80, 0x0, 0x6, 0x3f, 0x0, 0x0,
+    0x60, 0xff, 0xff, 0xe4, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8DA3 */
+    0x2, 0x0, 0x0, 0x0, 0x30, 0xff, 0x0, 0x3, 0x3f, 0xfc, 0x0, 0x31,
+    0xff, 0x80, 0x3f, 0xcc, 0x60, 0x3, 0xfe, 0xc7, 0xfc, 0x3, 0xc, 0xff,
+    0xe0, 0x30, 0xfe, 0xe, 0x3, 0xf, 0xe0, 0xe0, 0x70, 0xc6, 0xc, 0x7f,
+    0xec, 0x7c, 0xc7, 0xfe, 0xce, 0xcc, 0x3, 0xf, 0xe7, 0x80, 0x30, 0xfe,
+    0x78, 0x13, 0xc, 0x63, 0x83, 0x3e, 0xc6, 0x38, 0x33, 0xec, 0xe3, 0xc3,
+    0x30, 0xfe, 0x7c, 0x33, 0x1f, 0xee, 0xe3, 0xb3, 0xc6, 0xc6, 0x3f, 0x0,
+    0x7c, 0x67, 0xf0, 0x7, 0x0, 0x67, 0x0, 0x40, 0x6, 0x3f, 0x80, 0x0,
+    0x60, 0xff, 0xff, 0xe4, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8DB3 */
+    0x3, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x38, 0xc, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x38, 0xc, 0x0, 0x3,
+    0x80, 0xc0, 0x0, 0x38, 0xe, 0x0, 0x3, 0x80, 0xff, 0xff, 0xf0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x60, 0x60,
+    0x0, 0x6, 0x6, 0x0, 0x0, 0x60, 0x7f, 0xf0, 0x6, 0x7, 0xff, 0x80,
+    0xf0, 0x70, 0x0, 0xf, 0x6, 0x0, 0x0, 0xd8, 0x60, 0x0, 0x1c, 0xc6,
+    0x0, 0x3, 0x8f, 0x60, 0x0, 0x38, 0x3f, 0x80, 0x7, 0x1, 0xff, 0xfe,
+    0x60, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+8DB4 */
+    0xf, 0x80, 0x78, 0x3, 0xfe, 0xf, 0xc0, 0x38, 0xe0, 0x7e, 0x3, 0x6,
+    0x0, 0x60, 0x30, 0x60, 0x6, 0x3, 0x6, 0x30, 0x60, 0x30, 0x63, 0x6,
+    0x3, 0xfe, 0x30, 0x60, 0x3f, 0xc3, 0x6, 0x0, 0xf8, 0x30, 0x60, 0x3,
+    0x3, 0x6, 0x0, 0x30, 0x30, 0x60, 0x33, 0x3, 0x6, 0x3, 0x3c, 0x70,
+    0x60, 0x33, 0xe6, 0x7, 0x3, 0x3c, 0x60, 0x30, 0x33, 0x6, 0x3, 0x3,
+    0x30, 0xe0, 0x30, 0x33, 0xe, 0x3, 0x83, 0x30, 0xc0, 0x18, 0x33, 0x1c,
+    0x1, 0xc3, 0x3d, 0x80, 0x1c, 0x3f, 0xf8, 0x0, 0xe7, 0xe7, 0x0, 0xe,
+    0x60, 0x60, 0x0, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+8DDF */
+    0x1f, 0xc1, 0xff, 0x3, 0xfe, 0x7f, 0xf8, 0x38, 0xe7, 0x1, 0xc3, 0x6,
+    0x60, 0x1c, 0x30, 0x66, 0x1, 0xc3, 0x6, 0x60, 0x1c, 0x30, 0x67, 0xff,
+    0xc3, 0x8e, 0x7f, 0xfc, 0x3f, 0xe6, 0x1, 0xc0, 0xf8, 0x60, 0x1c, 0x3,
+    0x6, 0x1, 0xc0, 0x30, 0x7f, 0xf8, 0x33, 0x7, 0xff, 0x83, 0x3c, 0x63,
+    0x0, 0x33, 0xe6, 0x18, 0xe3, 0x3c, 0x61, 0x9c, 0x33, 0x6, 0x1b, 0x83,
+    0x30, 0x61, 0xf0, 0x33, 0x6, 0xe, 0x3, 0x30, 0x60, 0xe0, 0x33, 0x26,
+    0x37, 0x3, 0x3e, 0x6f, 0x38, 0x3f, 0xc7, 0xe3, 0xc7, 0xf1, 0xf8, 0x1e,
+    0x70, 0x1e, 0x0, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+8DE8 */
+    0x0, 0x0, 0x60, 0x1, 0xf8, 0x6, 0x0, 0x3f, 0xc0, 0x60, 0x3, 0x9c,
+    0xe, 0x0, 0x30, 0xdf, 0xff, 0xe3, 0xd, 0xff, 0xfe, 0x30, 0xc1, 0x8c,
+    0x3, 0xc, 0x38, 0xc0, 0x3f, 0xc3, 0x6, 0x3, 0xfc, 0x60, 0x38, 0xf,
+    0x1f, 0xff, 0xc0, 0x33, 0xdf, 0xce, 0x13, 0x30, 0x0, 0x63, 0x30, 0x0,
+    0x0, 0x33, 0xdf, 0xff, 0xc3, 0x3d, 0xff, 0xfc, 0x33, 0x83, 0x80, 0x3,
+    0x30, 0x30, 0x0, 0x33, 0x3, 0x0, 0x3, 0x30, 0x3f, 0xf8, 0x33, 0x1,
+    0xff, 0x83, 0x32, 0x0, 0x18, 0x37, 0xe0, 0x3, 0x83, 0xfc, 0x0, 0x38,
+    0x7e, 0x0, 0x3f, 0x6, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x7c, 0x0,
+
+    /* U+8DEF */
+    0x0, 0x0, 0x80, 0x1, 0xf8, 0x1c, 0x0, 0x3f, 0xc1, 0x80, 0x3, 0x8e,
+    0x3f, 0xf8, 0x30, 0x63, 0xff, 0x83, 0x6, 0x78, 0x18, 0x30, 0x67, 0x83,
+    0x83, 0x6, 0xec, 0x70, 0x3f, 0xec, 0xce, 0x3, 0xfd, 0x86, 0xc0, 0xf,
+    0x80, 0x78, 0x0, 0x30, 0x7, 0x80, 0x3, 0x0, 0xfe, 0x3, 0x30, 0x3c,
+    0xf8, 0x33, 0xcf, 0x83, 0xe3, 0x3f, 0xe0, 0x1e, 0x33, 0xdf, 0xff, 0x83,
+    0x30, 0x7f, 0xf8, 0x33, 0x7, 0x1, 0x83, 0x30, 0x60, 0x18, 0x33, 0x6,
+    0x1, 0x83, 0x32, 0x60, 0x18, 0x33, 0xf6, 0x1, 0x83, 0xfe, 0x70, 0x18,
+    0x7f, 0x7, 0xff, 0x87, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8DF3 */
+    0x0, 0x1, 0x8, 0x1, 0xf8, 0x19, 0x80, 0x3f, 0xc1, 0x98, 0x3, 0x8c,
+    0x19, 0x80, 0x30, 0xc1, 0x98, 0x3, 0xd, 0x19, 0x8c, 0x30, 0xf9, 0x98,
+    0xc3, 0xd, 0x99, 0x9c, 0x3f, 0xdd, 0x9b, 0x83, 0xfc, 0xd9, 0xb0, 0xf,
+    0xd, 0x98, 0x0, 0x20, 0x19, 0x80, 0x2, 0x1, 0x98, 0x3, 0x20, 0x19,
+    0xa0, 0x33, 0xc3, 0x9b, 0x3, 0x3c, 0xf9, 0xb8, 0x33, 0x1f, 0x99, 0xc3,
+    0x23, 0xb9, 0x8e, 0x32, 0x33, 0x18, 0x63, 0x20, 0x31, 0x80, 0x32, 0x7,
+    0x18, 0x3, 0x36, 0x71, 0x86, 0x37, 0xee, 0x18, 0x63, 0xf9, 0xc1, 0xce,
+    0x7e, 0x3c, 0x1f, 0xe7, 0x3, 0x80, 0xfc, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+8EAB */
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3f,
+    0xff, 0xc0, 0x7, 0xff, 0xfe, 0x0, 0x60, 0x0, 0xe0, 0x6, 0x0, 0xe,
+    0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x60, 0x0, 0xe0, 0x6,
+    0x0, 0x6, 0x0, 0x60, 0x0, 0xe6, 0x7, 0xff, 0xfe, 0xe0, 0x7f, 0xff,
+    0xfc, 0x6, 0x0, 0x7, 0x80, 0x60, 0x0, 0xf0, 0x6, 0x1f, 0xfe, 0x7,
+    0xff, 0xff, 0xe0, 0x7f, 0xf0, 0xfe, 0x0, 0x0, 0x3c, 0x60, 0x0, 0xf,
+    0x6, 0x0, 0x7, 0xe0, 0x60, 0x3, 0xf0, 0x6, 0x3, 0xfc, 0x0, 0xe0,
+    0x7e, 0x0, 0x7e, 0x7, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xf8, 0x0,
+
+    /* U+8ECA */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x60, 0x30, 0x1c,
+    0x6, 0x3, 0x81, 0xc0, 0xe0, 0x38, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xf8, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8ECD */
+    0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x78, 0xe, 0x1, 0xe7, 0x0,
+    0x60, 0xe, 0x77, 0xff, 0xfe, 0xe7, 0xff, 0xff, 0xfe, 0x20, 0x6, 0x0,
+    0x40, 0x0, 0x60, 0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xc,
+    0x6, 0x3, 0x0, 0xc0, 0x60, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x6, 0x3, 0x0, 0xe0, 0x60, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0x3f, 0xff, 0xc0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+8ED2 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x3, 0xff, 0xc7, 0xff,
+    0x9f, 0xfc, 0x7f, 0xfc, 0x1c, 0x0, 0x30, 0x1, 0xc0, 0x3, 0x0, 0x1c,
+    0x1, 0xff, 0x1, 0xc0, 0x3f, 0xf0, 0x1c, 0x3, 0x33, 0x81, 0xc0, 0x33,
+    0x18, 0x1c, 0x3, 0x3b, 0x9f, 0xfc, 0x3f, 0xfb, 0xff, 0xe3, 0xff, 0x9f,
+    0xfc, 0x33, 0x18, 0x1c, 0x3, 0x31, 0x81, 0xc0, 0x3f, 0xf8, 0x1c, 0x1,
+    0xff, 0x1, 0xc0, 0x3, 0x0, 0x1c, 0x0, 0x30, 0x1, 0xc0, 0x7f, 0xfc,
+    0x1c, 0x7, 0xff, 0xc1, 0xc0, 0x3, 0x80, 0x1c, 0x0, 0x30, 0x1, 0xc0,
+    0x3, 0x0, 0x1c, 0x0, 0x30, 0x1, 0x80, 0x1, 0x0, 0x8, 0x0,
+
+    /* U+8F09 */
+    0x0, 0x40, 0x20, 0x0, 0xe, 0x7, 0x0, 0x0, 0xe0, 0x77, 0x1, 0xff,
+    0xf7, 0x38, 0xf, 0xfc, 0x71, 0x80, 0xe, 0x3, 0x0, 0x0, 0xe0, 0x70,
+    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0xc, 0x3, 0x0, 0x1f,
+    0xff, 0x30, 0x3, 0xff, 0xfb, 0x8, 0x0, 0xc0, 0x31, 0xc0, 0xff, 0xe3,
+    0x18, 0x1f, 0xff, 0x31, 0x83, 0x8c, 0x33, 0xb8, 0x3f, 0xff, 0x1b, 0x3,
+    0xff, 0xf1, 0xf0, 0x38, 0xc3, 0x1e, 0x1, 0xff, 0xf1, 0xe0, 0x0, 0xe0,
+    0x1c, 0x60, 0xe, 0x1, 0xe6, 0x7f, 0xff, 0x3e, 0x60, 0xc, 0xe, 0x76,
+    0x0, 0xc1, 0xc3, 0xe0, 0xc, 0x38, 0x1c, 0x0, 0x41, 0x0, 0x0,
+
+    /* U+8F15 */
+    0x2, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0xf, 0xff, 0xe7, 0xff,
+    0x7f, 0xfe, 0x7f, 0xf0, 0x0, 0x0, 0x70, 0x31, 0x8c, 0x3, 0x3, 0x39,
+    0xc1, 0xfe, 0x73, 0x18, 0x3f, 0xe6, 0x33, 0x83, 0x37, 0x67, 0x30, 0x33,
+    0x36, 0x73, 0x3, 0x77, 0x63, 0x38, 0x3f, 0xf7, 0x39, 0x83, 0x77, 0x31,
+    0x8c, 0x33, 0x31, 0x9c, 0xc3, 0x33, 0x0, 0x4, 0x3f, 0xe0, 0x0, 0x3,
+    0xfe, 0x7f, 0xfe, 0x3, 0x7, 0xff, 0xc0, 0x30, 0x3, 0x80, 0x7f, 0xf0,
+    0x38, 0x7, 0xff, 0x83, 0x80, 0x7, 0x0, 0x38, 0x0, 0x30, 0x3, 0x80,
+    0x3, 0x1f, 0xff, 0xe0, 0x30, 0xff, 0xfe, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+8F29 */
+    0x0, 0x10, 0xc0, 0x0, 0x3, 0x8e, 0x0, 0x7f, 0xf8, 0xff, 0xc0, 0x3,
+    0x8c, 0x0, 0x1f, 0xf0, 0xc0, 0x3, 0xff, 0xf, 0xfc, 0x0, 0x30, 0xff,
+    0x1, 0xff, 0xc, 0x0, 0x7f, 0xf0, 0xff, 0xe0, 0x1e, 0xf, 0xfc, 0xf,
+    0xc4, 0xc0, 0x0, 0xe0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xfe, 0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0xe, 0x3, 0x81,
+    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0xf, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+8F2A */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x70, 0x7, 0xfe,
+    0xf, 0x80, 0x7f, 0xf1, 0xcc, 0x0, 0x60, 0x18, 0xe0, 0x6, 0x3, 0x7,
+    0x3, 0xfc, 0x70, 0x3c, 0x3f, 0xef, 0xff, 0xe3, 0x67, 0xff, 0xee, 0x26,
+    0x78, 0x0, 0x3, 0x66, 0x0, 0x0, 0x3f, 0xe3, 0xff, 0x3, 0xfe, 0x7f,
+    0xfc, 0x26, 0x6e, 0xcd, 0xc3, 0x66, 0xcc, 0xcc, 0x3f, 0xec, 0xcc, 0xc3,
+    0xfc, 0xcc, 0xcc, 0x6, 0xf, 0xff, 0xc0, 0x60, 0xff, 0xfc, 0x7f, 0xec,
+    0xcc, 0xc7, 0xff, 0xcc, 0xcc, 0x6, 0xc, 0xcc, 0xc0, 0x60, 0xcc, 0xcc,
+    0x6, 0xc, 0xcc, 0xc0, 0x60, 0xcc, 0xfc, 0x2, 0x4, 0x1, 0x0,
+
+    /* U+8F2F */
+    0x2, 0x0, 0x0, 0x0, 0x30, 0x1f, 0xf0, 0x3, 0x3, 0xff, 0x87, 0xfe,
+    0x70, 0x18, 0x7f, 0xf6, 0x1, 0x80, 0x70, 0x70, 0x18, 0x3, 0x7, 0xff,
+    0x81, 0xfe, 0x3f, 0xf8, 0x3f, 0xe0, 0x0, 0x3, 0x26, 0x0, 0x0, 0x32,
+    0x7f, 0xff, 0xe3, 0x76, 0xff, 0xfe, 0x3f, 0xe3, 0x1, 0x83, 0x76, 0x30,
+    0x38, 0x32, 0x63, 0xff, 0x83, 0x26, 0x3f, 0xf8, 0x3f, 0xe3, 0x1, 0x83,
+    0xfe, 0x30, 0x38, 0x7, 0x3, 0xff, 0x80, 0x30, 0x30, 0x38, 0x7f, 0xf3,
+    0x1, 0x87, 0xff, 0x30, 0x7e, 0x7, 0xf, 0xff, 0xc0, 0x31, 0xff, 0xb8,
+    0x3, 0x1c, 0x1, 0x80, 0x30, 0x0, 0x18, 0x2, 0x0, 0x1, 0x0,
+
+    /* U+8F49 */
+    0x2, 0x0, 0x0, 0x0, 0x60, 0x3, 0x0, 0x6, 0xf, 0xff, 0xe7, 0xfe,
+    0xff, 0xfe, 0x7f, 0xe0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0x7, 0xff,
+    0xc3, 0xfc, 0xe3, 0x9c, 0x3f, 0xec, 0x30, 0xc7, 0x66, 0xff, 0xfc, 0x66,
+    0x6f, 0xff, 0xc7, 0x76, 0xc3, 0xc, 0x7f, 0xe7, 0xff, 0xc7, 0xfe, 0x3f,
+    0xf8, 0x66, 0x60, 0x31, 0x86, 0x66, 0xff, 0xfc, 0x3f, 0xef, 0xff, 0xe3,
+    0xfe, 0x0, 0x30, 0x6, 0x0, 0x7, 0x0, 0x61, 0xff, 0xfe, 0x7f, 0xef,
+    0xff, 0xc7, 0xfe, 0x30, 0x30, 0x6, 0x3, 0x83, 0x0, 0x60, 0x1c, 0x30,
+    0x6, 0x0, 0xc7, 0x0, 0x60, 0x3, 0xe0, 0x2, 0x0, 0x1c, 0x0,
+
+    /* U+8FA3 */
+    0x2, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x6, 0x0, 0x30, 0x0, 0x70,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe7, 0xfe, 0x3, 0x0, 0x10, 0xc0, 0x30,
+    0x1, 0x8c, 0x3, 0x0, 0x18, 0x87, 0xff, 0xc1, 0x98, 0xff, 0xfc, 0x19,
+    0x8c, 0x30, 0xc1, 0x9c, 0xc3, 0xc, 0x7f, 0xec, 0x30, 0xc7, 0xfe, 0xc3,
+    0xc, 0x7, 0xf, 0xff, 0xc0, 0x70, 0x7f, 0xfc, 0x7, 0x60, 0x78, 0x3,
+    0xfe, 0xf, 0xc0, 0x7f, 0x81, 0xfc, 0x6, 0x60, 0x3b, 0x60, 0x6, 0x7,
+    0x33, 0x0, 0xe0, 0xe3, 0x38, 0x1c, 0x3c, 0x31, 0xc3, 0xc7, 0x83, 0xe,
+    0x78, 0x70, 0x30, 0x66, 0x4, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0,
+
+    /* U+8FA6 */
+    0x4, 0x8, 0x2, 0x0, 0xe1, 0x80, 0x70, 0xe, 0x18, 0x7, 0x0, 0xe1,
+    0x80, 0x70, 0x7f, 0x98, 0x3f, 0xe7, 0xf9, 0x83, 0xfe, 0x33, 0x3f, 0x18,
+    0x83, 0x37, 0xf9, 0x88, 0x13, 0x1d, 0x99, 0x81, 0x31, 0x98, 0x98, 0x1b,
+    0x19, 0x89, 0x83, 0xb1, 0x98, 0xd8, 0x7f, 0xd9, 0xff, 0xe7, 0xf9, 0x9b,
+    0xfe, 0xe, 0x19, 0x86, 0x0, 0xe1, 0x98, 0x60, 0xe, 0x39, 0x86, 0x3,
+    0xfb, 0x19, 0xfc, 0x7f, 0x31, 0xbf, 0xe6, 0xc3, 0x19, 0xfc, 0xc, 0x71,
+    0x86, 0x0, 0xc6, 0x18, 0x60, 0x18, 0xe3, 0x86, 0x3, 0x8c, 0xf0, 0x60,
+    0x71, 0xdf, 0x6, 0x6, 0x18, 0xe0, 0x60, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+8FAF */
+    0x4, 0x0, 0x2, 0x0, 0xe1, 0xf8, 0x70, 0xe, 0x3f, 0x87, 0x0, 0xe0,
+    0x0, 0x70, 0x7f, 0x80, 0x3f, 0xe7, 0xfb, 0xfb, 0xfe, 0x33, 0x3f, 0xd8,
+    0x83, 0x30, 0x1, 0x88, 0x13, 0x0, 0x19, 0x81, 0x31, 0xf8, 0x98, 0x1b,
+    0x3f, 0x89, 0x83, 0xb0, 0x0, 0xd8, 0x7f, 0xc0, 0x3f, 0xe7, 0xf9, 0xfb,
+    0xfe, 0xc, 0x3f, 0x86, 0x0, 0xc0, 0x0, 0x60, 0xc, 0x0, 0x6, 0x3,
+    0xf9, 0xf9, 0xfc, 0x7f, 0x3f, 0xbf, 0xe6, 0xc3, 0x19, 0xfc, 0xc, 0x31,
+    0x86, 0x0, 0xc3, 0x18, 0x60, 0x18, 0x31, 0x86, 0x3, 0x83, 0x98, 0x60,
+    0x70, 0x3f, 0x86, 0x6, 0x0, 0xf0, 0x60, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+8FB1 */
+    0x7, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc, 0x1c, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0x1, 0x8f, 0xff, 0xf0, 0x18, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xe1, 0x8e, 0x38, 0x20, 0x38,
+    0xe1, 0x87, 0x3, 0x8e, 0xd, 0xe0, 0x30, 0xe0, 0xf8, 0x7, 0xf, 0xf3,
+    0xfc, 0x77, 0xfe, 0xf, 0xe6, 0x7e, 0x0, 0x8e, 0x0, 0x0, 0xc, 0x1,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x0, 0x80,
+    0xc, 0x0, 0xe, 0x0, 0xc0, 0x0, 0xe0, 0x1c, 0x0, 0x7, 0x7, 0xc0,
+    0x0, 0x30, 0xf8, 0x0, 0x0, 0xf, 0x0,
+
+    /* U+8FB2 */
+    0x0, 0x20, 0x40, 0x0, 0x3, 0xe, 0x0, 0xf, 0xff, 0xff, 0x81, 0xff,
+    0xff, 0xf8, 0x18, 0x30, 0xe1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
+    0x81, 0x83, 0xe, 0x18, 0x1c, 0x30, 0xe1, 0x81, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc1, 0xc0, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0x3, 0x9f, 0xff, 0xf8, 0x38, 0xff, 0xff, 0x3,
+    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x30, 0xe1,
+    0xc3, 0x83, 0xe, 0xc, 0x70, 0x30, 0xe0, 0xfe, 0x7, 0xe, 0x77, 0xc0,
+    0x61, 0xff, 0x1f, 0xc6, 0x7f, 0xc0, 0x7e, 0x3, 0x0, 0x0, 0xe0,
+
+    /* U+8FCE */
+    0x0, 0x0, 0x80, 0x1, 0xc0, 0x78, 0x0, 0x1e, 0x1f, 0x80, 0x0, 0xf3,
+    0xe3, 0xfc, 0x0, 0x38, 0x3f, 0xc0, 0x3, 0x7, 0xc, 0x20, 0x30, 0x70,
+    0xc7, 0x83, 0x7, 0xc, 0x3c, 0x30, 0x70, 0xc0, 0xc3, 0x7, 0xc, 0x0,
+    0x30, 0x70, 0xc0, 0x3, 0x7, 0xc, 0x0, 0x30, 0x70, 0xc7, 0x83, 0x7,
+    0xc, 0x7c, 0x30, 0x70, 0xc3, 0xe3, 0x7, 0xc, 0xe, 0x33, 0xf0, 0xc0,
+    0xe3, 0xf7, 0x7c, 0xe, 0x7e, 0x77, 0xc0, 0xef, 0x7, 0x30, 0xe, 0xc0,
+    0x70, 0x0, 0xe0, 0x7, 0x0, 0x1f, 0x0, 0x20, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8FD1 */
+    0x0, 0x0, 0x0, 0x81, 0xc0, 0x3, 0xfc, 0x1e, 0x7, 0xff, 0x80, 0xf1,
+    0xff, 0xc0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0x80, 0x0, 0x20, 0x18, 0x0,
+    0x7, 0x81, 0x80, 0x0, 0x3c, 0x18, 0x0, 0x0, 0xc1, 0xff, 0xfe, 0x0,
+    0x1f, 0xff, 0xe0, 0x1, 0x80, 0xe0, 0x0, 0x18, 0xe, 0x7, 0x81, 0x80,
+    0xe0, 0x7c, 0x38, 0xe, 0x3, 0xc3, 0x80, 0xe0, 0xe, 0x38, 0xe, 0x0,
+    0xe3, 0x0, 0xe0, 0xe, 0x70, 0xe, 0x0, 0xe7, 0x0, 0xe0, 0xe, 0x60,
+    0xe, 0x0, 0xe0, 0x0, 0xc0, 0x1f, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
+    0x71, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8FD4 */
+    0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x1e, 0x1f, 0xff, 0xe0, 0xf1,
+    0xff, 0xfe, 0x0, 0x18, 0x0, 0x0, 0x1, 0x80, 0x0, 0x20, 0x18, 0x0,
+    0x7, 0x81, 0xff, 0xe0, 0x3c, 0x1f, 0xff, 0x80, 0xc1, 0xff, 0xf8, 0x0,
+    0x18, 0x3, 0x80, 0x1, 0x90, 0x30, 0x0, 0x39, 0x83, 0x7, 0x83, 0x1c,
+    0x60, 0x7c, 0x30, 0xce, 0x1, 0xc3, 0xf, 0xc0, 0xc, 0x70, 0x78, 0x0,
+    0xc7, 0x7, 0xc0, 0xc, 0x61, 0xff, 0x0, 0xce, 0x3c, 0x7c, 0xc, 0xcf,
+    0x83, 0xe0, 0xe0, 0x60, 0x4, 0x1f, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+8FEB */
+    0x0, 0x0, 0x40, 0x1, 0xc0, 0xe, 0x0, 0x1e, 0x0, 0xc0, 0x0, 0xf0,
+    0x1c, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x1, 0xff, 0xf8, 0x20, 0x38, 0x1,
+    0xc7, 0x83, 0x80, 0x1c, 0x3c, 0x38, 0x1, 0xc0, 0xc3, 0x80, 0x1c, 0x0,
+    0x38, 0x1, 0xc0, 0x3, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc3, 0x83, 0x80,
+    0x1c, 0x7c, 0x38, 0x1, 0xc1, 0xe3, 0x80, 0x1c, 0xe, 0x38, 0x1, 0xc0,
+    0x63, 0x80, 0x1c, 0x6, 0x38, 0x1, 0xc0, 0x61, 0xff, 0xf8, 0x6, 0x1f,
+    0xff, 0x80, 0x60, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+8FF4 */
+    0x0, 0x0, 0x0, 0x1, 0xc0, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xc0, 0xf3,
+    0xff, 0xfc, 0x2, 0x70, 0x0, 0xc0, 0x7, 0x0, 0xc, 0x20, 0x70, 0xf0,
+    0xc7, 0xc7, 0x3f, 0x8c, 0x3e, 0x73, 0x1c, 0xc0, 0xe7, 0x30, 0xcc, 0x0,
+    0x73, 0xc, 0xc0, 0x7, 0x30, 0xcc, 0x0, 0x73, 0xc, 0xc7, 0x87, 0x30,
+    0xcc, 0x7c, 0x73, 0xfc, 0xc3, 0xc7, 0x3f, 0x8c, 0xe, 0x70, 0x0, 0xc0,
+    0xe7, 0x0, 0xc, 0xe, 0x70, 0x0, 0xc0, 0xe3, 0xff, 0xfc, 0xe, 0x3f,
+    0xff, 0x80, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8FF7 */
+    0x0, 0x0, 0xc0, 0x1, 0xc0, 0xc, 0x0, 0x1e, 0x20, 0xc1, 0x0, 0xf7,
+    0xc, 0x38, 0x0, 0x30, 0xc3, 0x0, 0x3, 0x8c, 0x70, 0x20, 0x18, 0xc6,
+    0x7, 0x80, 0xc, 0x0, 0x3c, 0xff, 0xff, 0xc0, 0xdf, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xc0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x7, 0x80, 0x7f,
+    0x0, 0x7c, 0xe, 0xfc, 0x1, 0xc1, 0xcc, 0xe0, 0xc, 0x38, 0xc7, 0x0,
+    0xc7, 0xc, 0x38, 0xc, 0xe0, 0xc1, 0xc0, 0xcc, 0xc, 0xe, 0xc, 0x0,
+    0xc0, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0x0, 0xc0, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+8FFD */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x1c, 0x1, 0xc0, 0x1, 0xe0,
+    0x18, 0x0, 0xf, 0x1f, 0xff, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x38, 0x3,
+    0x82, 0x3, 0x0, 0x18, 0x78, 0x30, 0x1, 0x83, 0xc3, 0x0, 0x38, 0xc,
+    0x3f, 0xff, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x78, 0x3f, 0xfe, 0x7, 0xc3, 0xff, 0xf8, 0x1c, 0x38, 0x3, 0x80,
+    0xc3, 0x0, 0x1c, 0xc, 0x30, 0x1, 0xc0, 0xc3, 0x0, 0x1c, 0xc, 0x38,
+    0x1, 0xc0, 0xc3, 0xff, 0xf8, 0xe, 0xf, 0xff, 0x1, 0xf0, 0x0, 0x0,
+    0x3f, 0xe0, 0x0, 0x7, 0xf, 0xff, 0xfe, 0x60, 0x3f, 0xff, 0xe0,
+
+    /* U+9000 */
+    0x0, 0x0, 0x0, 0x1, 0xc0, 0xff, 0xe0, 0x1e, 0x1f, 0xff, 0x0, 0xf1,
+    0x80, 0x38, 0x0, 0x38, 0x1, 0x80, 0x3, 0x80, 0x38, 0x20, 0x3f, 0xff,
+    0x87, 0x83, 0xff, 0xf8, 0x3c, 0x38, 0x1, 0x80, 0xc3, 0x80, 0x38, 0x0,
+    0x3f, 0xff, 0x80, 0x3, 0xff, 0xf0, 0x0, 0x38, 0x0, 0x7, 0x83, 0x98,
+    0xc, 0x7c, 0x39, 0xe3, 0xc3, 0xc3, 0x8f, 0x78, 0xe, 0x38, 0x3e, 0x0,
+    0xe3, 0x81, 0xe0, 0xe, 0x38, 0xef, 0x0, 0xe3, 0xfe, 0x3c, 0xe, 0x7f,
+    0x1, 0xc0, 0xe7, 0x80, 0x4, 0x1f, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9001 */
+    0x0, 0x8, 0x2, 0x1, 0xc0, 0xc0, 0x60, 0x1e, 0xe, 0x6, 0x0, 0xf0,
+    0x60, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x3, 0xff, 0xfc, 0x20, 0x3f, 0xff,
+    0xc7, 0x80, 0xe, 0x0, 0x3c, 0x0, 0xe0, 0x0, 0xc0, 0xe, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xe7, 0x80, 0xc,
+    0x0, 0x7c, 0x1, 0xc0, 0x3, 0xc0, 0x1c, 0x0, 0xe, 0x3, 0xf8, 0x0,
+    0xe0, 0x73, 0xe0, 0xe, 0x1f, 0xf, 0x0, 0xe3, 0xc0, 0x78, 0xe, 0x78,
+    0x1, 0xc0, 0xe6, 0x0, 0x8, 0x1f, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+901A */
+    0x0, 0x0, 0x0, 0x1, 0xc7, 0xff, 0xf8, 0x1e, 0x7f, 0xff, 0x80, 0xf0,
+    0x0, 0x78, 0x0, 0x7, 0x1e, 0x0, 0x0, 0x7f, 0x80, 0x20, 0x0, 0xf8,
+    0x7, 0x81, 0xff, 0xf0, 0x3c, 0x3f, 0xff, 0xc0, 0xc3, 0x8e, 0x1c, 0x0,
+    0x70, 0x60, 0xc0, 0x7, 0xe, 0x1c, 0x0, 0x7f, 0xff, 0xc7, 0xc7, 0xff,
+    0xfc, 0x7c, 0x70, 0x60, 0xc0, 0xc7, 0xe, 0xc, 0xe, 0x7f, 0xff, 0xc0,
+    0xe7, 0xff, 0xfc, 0xe, 0x70, 0x60, 0xc0, 0xe7, 0x6, 0xc, 0xe, 0x70,
+    0x67, 0xc0, 0xe3, 0x6, 0xf8, 0x1f, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+901B */
+    0x0, 0x0, 0x0, 0x1, 0xc6, 0x10, 0x0, 0x1e, 0x73, 0x7f, 0xe0, 0xf3,
+    0xf7, 0xfe, 0x0, 0x1e, 0x6, 0x0, 0x1, 0xc0, 0x60, 0x20, 0x3c, 0x6,
+    0x7, 0x87, 0xe0, 0x60, 0x3c, 0x66, 0x6, 0x0, 0xc0, 0x60, 0x60, 0x0,
+    0x6, 0x7f, 0xc0, 0x0, 0xe7, 0xfe, 0x0, 0x1f, 0xe, 0x7, 0x83, 0xf0,
+    0x60, 0x7c, 0x73, 0x6, 0x3, 0xc6, 0x70, 0x60, 0xe, 0x7, 0x6, 0x0,
+    0xe0, 0x70, 0x60, 0xe, 0x6, 0x6, 0x0, 0xe0, 0x67, 0xfc, 0xe, 0x3e,
+    0xff, 0xe0, 0xe7, 0xc7, 0xfc, 0x1f, 0x20, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+901F */
+    0x0, 0x0, 0x40, 0x1, 0xc0, 0x6, 0x0, 0x1f, 0x0, 0xe0, 0x0, 0x77,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x6, 0x0, 0x20, 0x0, 0xe0,
+    0x3, 0xc3, 0xff, 0xf8, 0x3e, 0x3f, 0xff, 0xc0, 0xe7, 0x6, 0x1c, 0x0,
+    0x70, 0x60, 0xc0, 0x7, 0x6, 0xc, 0x0, 0x3f, 0xff, 0xc3, 0x83, 0xff,
+    0xfc, 0x7c, 0x1, 0xe0, 0x3, 0xe0, 0x1e, 0x0, 0x6, 0x3, 0xfc, 0x0,
+    0x60, 0xe7, 0xe0, 0x6, 0x3c, 0x67, 0x80, 0x67, 0x86, 0x1c, 0x6, 0xf0,
+    0x60, 0xe0, 0x60, 0x6, 0x0, 0x1f, 0x0, 0x40, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xf6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9022 */
+    0x0, 0x6, 0x0, 0x1, 0xc0, 0xe0, 0x0, 0x1e, 0x1f, 0xff, 0x0, 0xf3,
+    0xff, 0xf0, 0x0, 0x7e, 0x7, 0x0, 0xe, 0x71, 0xe0, 0x20, 0xc3, 0xb8,
+    0x7, 0x80, 0x1f, 0x0, 0x3c, 0xf, 0xfe, 0x0, 0xc7, 0xf1, 0xfe, 0x1,
+    0xf8, 0xc7, 0xe0, 0xc, 0xc, 0x0, 0x0, 0x3f, 0xff, 0x87, 0x83, 0xff,
+    0xf8, 0x7c, 0x0, 0xc0, 0x1, 0xc1, 0xff, 0xe0, 0xc, 0x3f, 0xff, 0x0,
+    0xc0, 0xe, 0x0, 0xc, 0x0, 0xc0, 0x0, 0xcf, 0xff, 0xfc, 0xc, 0xff,
+    0xff, 0xc0, 0xe0, 0xc, 0x0, 0x1f, 0x0, 0xc0, 0x3, 0xfe, 0x4, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+9023 */
+    0x0, 0x0, 0x40, 0x1, 0xc0, 0xc, 0x0, 0x1e, 0x7f, 0xff, 0xc0, 0xf7,
+    0xff, 0xfe, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xc, 0x0, 0x20, 0x3f, 0xff,
+    0x87, 0x83, 0xff, 0xf8, 0x3c, 0x70, 0xe1, 0xc0, 0xc7, 0xc, 0x1c, 0x0,
+    0x7f, 0xff, 0xc0, 0x7, 0xff, 0xfc, 0x0, 0x70, 0xe1, 0xc7, 0x87, 0xc,
+    0x1c, 0x7c, 0x3f, 0xff, 0xc1, 0xc3, 0xff, 0xf8, 0xc, 0x0, 0xe0, 0x0,
+    0xc0, 0xe, 0x0, 0xc, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xfe, 0xc, 0x0,
+    0xe0, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0x0, 0xc0, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+9031 */
+    0x0, 0x0, 0x0, 0x1, 0xc0, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0x80, 0xf3,
+    0xff, 0xfc, 0x0, 0x30, 0x40, 0xc0, 0x3, 0x6, 0xc, 0x20, 0x33, 0xfc,
+    0xc7, 0x83, 0x7f, 0xcc, 0x3c, 0x30, 0xe0, 0xc0, 0xc3, 0x6, 0xc, 0x0,
+    0x77, 0xfe, 0xc0, 0x7, 0x7f, 0xec, 0x0, 0x70, 0x0, 0xc7, 0x87, 0x3f,
+    0x8c, 0x7c, 0x77, 0xfc, 0xc1, 0xc6, 0x60, 0xcc, 0xc, 0x66, 0x4, 0xc0,
+    0xc6, 0x60, 0xcc, 0xc, 0xe7, 0xfc, 0xc0, 0xce, 0x3f, 0xcc, 0xc, 0xc0,
+    0x1, 0xc0, 0xe8, 0x0, 0xfc, 0x1f, 0x0, 0x7, 0x83, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+9032 */
+    0x0, 0x8, 0x0, 0x3, 0x81, 0x81, 0x80, 0x3e, 0x38, 0x38, 0x0, 0xe3,
+    0x3, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x7, 0xff, 0xfc, 0x60, 0xf0, 0x70,
+    0x7, 0x9f, 0x3, 0x0, 0x3d, 0xb0, 0x30, 0x0, 0xd3, 0xff, 0xf8, 0x0,
+    0x3f, 0xff, 0xc0, 0x3, 0x7, 0x0, 0x0, 0x30, 0x30, 0x7, 0x83, 0x3,
+    0x0, 0x7c, 0x3f, 0xff, 0x83, 0xe3, 0xff, 0xfc, 0xe, 0x30, 0x70, 0x0,
+    0xe3, 0x3, 0x0, 0xe, 0x30, 0x30, 0x0, 0xe3, 0xff, 0xfc, 0xe, 0x3f,
+    0xff, 0xe0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x71, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9038 */
+    0x0, 0x2, 0x0, 0x1, 0xc0, 0x60, 0x0, 0x1e, 0xf, 0xf0, 0x0, 0xf1,
+    0xff, 0xe0, 0x0, 0x38, 0x1c, 0x0, 0x7, 0x1, 0xc0, 0x20, 0xe0, 0x38,
+    0x7, 0x8f, 0xff, 0xf0, 0x3c, 0x7f, 0xff, 0x0, 0xc6, 0x18, 0x38, 0x0,
+    0x61, 0x83, 0x80, 0x6, 0x18, 0x38, 0x0, 0x61, 0x83, 0x7, 0x87, 0xff,
+    0xf0, 0x7c, 0x3f, 0xfe, 0x3, 0xc0, 0x33, 0x0, 0xe, 0x3, 0x30, 0x0,
+    0xe0, 0x73, 0x66, 0xe, 0xe, 0x33, 0xe0, 0xe1, 0xc3, 0x8e, 0xe, 0x78,
+    0x3f, 0xc0, 0xef, 0x1, 0xf8, 0x1f, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+904A */
+    0x0, 0x18, 0x18, 0x1, 0xc1, 0x81, 0x80, 0x1e, 0x18, 0x38, 0x0, 0xf1,
+    0x83, 0x0, 0x0, 0xfe, 0x7f, 0xe0, 0x1f, 0xf7, 0xfe, 0x0, 0xff, 0xe0,
+    0x7, 0x83, 0xc, 0x0, 0x3c, 0x31, 0xff, 0xc1, 0xc3, 0xb, 0xfe, 0x0,
+    0x3f, 0x1, 0xc0, 0x7, 0xf0, 0x38, 0x0, 0x63, 0x7, 0x7, 0x86, 0x30,
+    0x60, 0x7c, 0x63, 0x7, 0x1, 0xc6, 0x37, 0xfe, 0xc, 0x63, 0x3f, 0xc0,
+    0xce, 0x30, 0x60, 0xc, 0xc3, 0x6, 0x0, 0xdc, 0x30, 0x60, 0xd, 0x9e,
+    0xe, 0x0, 0xe1, 0xe3, 0xe0, 0x1f, 0x0, 0x3c, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+904B */
+    0x0, 0x0, 0x0, 0x3, 0xc7, 0xff, 0xfc, 0x1e, 0xff, 0xff, 0xc0, 0xee,
+    0xc, 0xe, 0x0, 0xc0, 0xc0, 0xe0, 0xc, 0xff, 0xee, 0x0, 0x4f, 0xfe,
+    0x47, 0x80, 0xc, 0x0, 0x3c, 0x3f, 0xff, 0x0, 0xc3, 0xff, 0xf8, 0x0,
+    0x70, 0xc1, 0x80, 0x7, 0xe, 0x18, 0x0, 0x7f, 0xff, 0x87, 0x87, 0xe,
+    0x18, 0x7c, 0x70, 0xc1, 0x81, 0xc3, 0xff, 0xf8, 0xc, 0x1f, 0xff, 0x0,
+    0xc0, 0xc, 0x0, 0xc, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xfe, 0xc, 0x0,
+    0xe0, 0x0, 0xe0, 0xc, 0x0, 0x1f, 0x0, 0xc0, 0x7, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+904E */
+    0x0, 0x0, 0x0, 0x1, 0xc0, 0xff, 0xe0, 0x1e, 0x1f, 0xff, 0x0, 0xf1,
+    0x80, 0x30, 0x0, 0x18, 0x3, 0x0, 0x1, 0x83, 0xf0, 0x20, 0x18, 0xff,
+    0x7, 0x81, 0x8e, 0x30, 0x3c, 0x18, 0xc3, 0x0, 0xc1, 0x8c, 0x30, 0x0,
+    0x3f, 0xff, 0x80, 0x7, 0xff, 0xfc, 0x0, 0x60, 0x1, 0xc7, 0xc6, 0x0,
+    0xc, 0x7c, 0x63, 0xf8, 0xc0, 0xc6, 0x7f, 0xcc, 0xc, 0x66, 0xc, 0xc0,
+    0xc6, 0x60, 0xcc, 0xc, 0x66, 0xc, 0xc0, 0xc6, 0x7f, 0xcc, 0xc, 0x63,
+    0xf8, 0xc0, 0xe6, 0x0, 0x7c, 0x1f, 0x40, 0x3, 0x87, 0xbc, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe4, 0x3, 0xff, 0xfe,
+
+    /* U+9053 */
+    0x0, 0x0, 0x4, 0x1, 0xc0, 0xc0, 0xe0, 0x1e, 0xe, 0xc, 0x0, 0xf0,
+    0xf1, 0xc0, 0x2, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfc, 0x20, 0x1, 0xc0,
+    0x7, 0x80, 0x1c, 0x0, 0x3c, 0x3f, 0xff, 0x0, 0xc3, 0xff, 0xf8, 0x0,
+    0x30, 0x1, 0x80, 0x3, 0x0, 0x18, 0x0, 0x3f, 0xff, 0x87, 0x83, 0xff,
+    0xf8, 0x7c, 0x30, 0x1, 0x83, 0xe3, 0x0, 0x18, 0xe, 0x3f, 0xff, 0x80,
+    0x63, 0xff, 0xf8, 0x6, 0x30, 0x1, 0x80, 0x63, 0x0, 0x38, 0x6, 0x3f,
+    0xff, 0x80, 0x61, 0xff, 0xf0, 0x1f, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
+    0x79, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9054 */
+    0x0, 0x0, 0xc0, 0x1, 0xc0, 0xe, 0x0, 0x1e, 0x3f, 0xff, 0x80, 0xf7,
+    0xff, 0xfc, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x20, 0xff, 0xff,
+    0xe7, 0x8f, 0xff, 0xfe, 0x3c, 0xe, 0x6, 0x0, 0xc0, 0xe0, 0xe0, 0x0,
+    0x6, 0xc, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xc7, 0x80, 0xe,
+    0x0, 0x7c, 0x0, 0xe0, 0x1, 0xc3, 0xff, 0xf8, 0xc, 0x1f, 0xff, 0x0,
+    0xc0, 0xe, 0x0, 0xc, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xfe, 0xc, 0x0,
+    0xe0, 0x0, 0xe0, 0xe, 0x0, 0x1f, 0x0, 0xc0, 0x3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+9055 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1c, 0x3, 0x80, 0x1, 0xe3,
+    0xff, 0xe0, 0xf, 0x7, 0xf, 0x0, 0x0, 0x60, 0x70, 0x0, 0xff, 0xff,
+    0xe2, 0xf, 0xff, 0xfe, 0x78, 0x0, 0x0, 0x3, 0xc1, 0xff, 0xe0, 0xc,
+    0x3f, 0xff, 0x80, 0x3, 0x0, 0x38, 0x0, 0x30, 0x3, 0x80, 0x3, 0xff,
+    0xf8, 0x78, 0x1f, 0xff, 0x7, 0xc0, 0x3, 0x0, 0x1c, 0x7f, 0xff, 0xc0,
+    0xc7, 0xff, 0xfc, 0xc, 0x0, 0x30, 0x0, 0xc3, 0x3, 0x0, 0xc, 0x3f,
+    0xff, 0xe0, 0xc7, 0xff, 0xfe, 0xe, 0x60, 0x30, 0x1, 0xf0, 0x3, 0x0,
+    0x3f, 0xe0, 0x20, 0x7, 0xf, 0xff, 0xfe, 0x60, 0x3f, 0xff, 0xe0,
+
+    /* U+9060 */
+    0x0, 0x0, 0xc0, 0x1, 0xc0, 0xc, 0x0, 0x1e, 0x1, 0xe0, 0x0, 0xf7,
+    0xff, 0xf8, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xc, 0x0, 0x20, 0xff, 0xff,
+    0xc7, 0x8f, 0xff, 0xfe, 0x3c, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x7, 0x0, 0x38, 0x0, 0x70, 0x3, 0x87, 0xc7, 0xff,
+    0xf8, 0x7c, 0x3f, 0xff, 0x0, 0xc0, 0x78, 0x0, 0xc, 0xe, 0x1, 0x80,
+    0xc3, 0xe7, 0xb8, 0xc, 0xfe, 0x3e, 0x0, 0xcc, 0x60, 0xf0, 0xc, 0xf,
+    0xe7, 0x80, 0xe3, 0xfc, 0x1c, 0x1f, 0x38, 0x0, 0xc3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+9077 */
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xfe, 0x1e, 0xff, 0xff, 0xe0, 0xf0,
+    0x31, 0x80, 0x0, 0x3f, 0xff, 0x80, 0x7, 0xff, 0xfc, 0x20, 0x63, 0x18,
+    0xc7, 0x86, 0x31, 0x8c, 0x3c, 0x7f, 0xff, 0xc0, 0xc3, 0xff, 0xf0, 0x0,
+    0x7, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xc7, 0x81, 0x80,
+    0xe0, 0x7c, 0x7f, 0xff, 0x81, 0xcf, 0xff, 0xfe, 0xd, 0xd8, 0xe, 0xe0,
+    0xd9, 0x80, 0xe2, 0xc, 0x18, 0x7c, 0x0, 0xc1, 0x87, 0x8c, 0xc, 0x18,
+    0x1, 0xc0, 0xe1, 0xff, 0xfc, 0x1f, 0xf, 0xff, 0x3, 0xbe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe4, 0x3, 0xff, 0xfe,
+
+    /* U+9078 */
+    0x0, 0x0, 0x0, 0x1, 0xc3, 0xe1, 0xf8, 0x1e, 0x7f, 0x3f, 0xc0, 0xf6,
+    0x3b, 0xc, 0x0, 0x63, 0xb0, 0xc0, 0x7, 0xf3, 0xfc, 0x20, 0x7e, 0x3f,
+    0x7, 0x86, 0xb, 0x6, 0x3c, 0x63, 0xb0, 0xe0, 0xc7, 0xfb, 0xfc, 0x0,
+    0x4, 0x8, 0x0, 0x0, 0x60, 0xc0, 0x0, 0xe, 0x1c, 0x7, 0x87, 0xff,
+    0xfc, 0x7c, 0x7f, 0xff, 0x81, 0xc0, 0xe1, 0xc0, 0xc, 0xe, 0x1c, 0x0,
+    0xdf, 0xff, 0xfe, 0xc, 0xff, 0xff, 0xc0, 0xc0, 0xe1, 0xc0, 0xc, 0x7e,
+    0x1f, 0x80, 0xe7, 0x80, 0x7c, 0x1f, 0x40, 0x1, 0xc3, 0xfe, 0x0, 0x0,
+    0x70, 0xff, 0xff, 0xe6, 0x3, 0xff, 0xfe,
+
+    /* U+907A */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x1c, 0x0, 0xe0, 0x1, 0xe3,
+    0xff, 0xf8, 0xf, 0x30, 0xc3, 0x80, 0x3, 0xc, 0x18, 0x0, 0x3f, 0xff,
+    0x82, 0x0, 0xe, 0x0, 0x78, 0x0, 0xe0, 0x3, 0xdf, 0xff, 0xfe, 0xc,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x3, 0x0,
+    0x18, 0x70, 0x7f, 0xff, 0x87, 0xc7, 0x0, 0x38, 0xc, 0x70, 0x3, 0x80,
+    0xc7, 0xff, 0xf8, 0xc, 0x30, 0x1, 0x80, 0xc3, 0xff, 0xf8, 0xc, 0x1f,
+    0xff, 0x0, 0xc0, 0xe1, 0xe0, 0xe, 0x7e, 0x1f, 0xc1, 0xff, 0x0, 0x1e,
+    0x3b, 0xc0, 0x0, 0x7, 0xf, 0xff, 0xfe, 0x40, 0x3f, 0xff, 0xe0,
+
+    /* U+9091 */
+    0x1f, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x3, 0x80, 0x1, 0xc0, 0xc0, 0x0,
+    0x30, 0x30, 0x0, 0x1c, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xe1,
+    0xff, 0xff, 0xf8, 0xe0, 0x38, 0x6, 0x38, 0xe, 0x1, 0x8e, 0x3, 0x80,
+    0x63, 0x80, 0xe0, 0x38, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe, 0x0,
+    0x0, 0x3, 0x80, 0x0, 0x6, 0xe0, 0x0, 0x1, 0xb8, 0x0, 0x0, 0xe7,
+    0xc0, 0x1, 0xf9, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xfc, 0x0,
+
+    /* U+90A3 */
+    0x1f, 0xf0, 0xf, 0x7, 0xff, 0xc7, 0xfc, 0x3f, 0xfc, 0x7f, 0xe0, 0x30,
+    0xee, 0xc, 0x3, 0xe, 0xe0, 0xc0, 0x30, 0xee, 0x1c, 0x3, 0xe, 0xe1,
+    0x87, 0xff, 0xce, 0x38, 0x3f, 0xfc, 0xe3, 0x0, 0x30, 0xce, 0x70, 0x3,
+    0xc, 0xe7, 0x0, 0x30, 0xce, 0x30, 0x7, 0xc, 0xe3, 0x83, 0xff, 0xce,
+    0x1c, 0x7f, 0xfc, 0xe0, 0xc0, 0x60, 0xce, 0xc, 0xe, 0xc, 0xe0, 0xe0,
+    0xe0, 0xce, 0x6, 0xc, 0xc, 0xe0, 0xe1, 0xc0, 0xce, 0xe, 0x18, 0x1c,
+    0xe7, 0xc3, 0x81, 0xce, 0x78, 0x70, 0xf8, 0xe0, 0x7, 0x1f, 0x8e, 0x0,
+    0x40, 0xe0, 0x60, 0x0, 0x0, 0x4, 0x0,
+
+    /* U+90A6 */
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0xf0, 0x0, 0xc0, 0x7f, 0xe0, 0xc,
+    0x7, 0xfe, 0x7f, 0xff, 0x60, 0xe3, 0xff, 0xe6, 0xc, 0x0, 0xc0, 0x60,
+    0xc0, 0xc, 0x6, 0x18, 0x0, 0xc0, 0x61, 0x81, 0xff, 0xc6, 0x30, 0x3f,
+    0xfe, 0x63, 0x1, 0xff, 0xc6, 0x70, 0x0, 0xc0, 0x63, 0x80, 0xc, 0x6,
+    0x18, 0x1, 0xc0, 0x61, 0xc3, 0xff, 0xe6, 0xc, 0x7f, 0xff, 0x60, 0x63,
+    0xff, 0xe6, 0x6, 0x1, 0x80, 0x60, 0x60, 0x38, 0x6, 0xe, 0x3, 0x80,
+    0x60, 0xe0, 0x70, 0x6, 0x7e, 0xe, 0x0, 0x67, 0xc1, 0xc0, 0x6, 0x20,
+    0x78, 0x0, 0x60, 0x7, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+90B1 */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0xf0, 0x3, 0xfe, 0x7f, 0xe0, 0xff,
+    0x7, 0xfe, 0x1e, 0x0, 0x60, 0xe1, 0x80, 0x6, 0xc, 0x18, 0x0, 0x60,
+    0xc1, 0x80, 0x6, 0x18, 0x18, 0x0, 0x61, 0x81, 0xff, 0xe6, 0x30, 0x1f,
+    0xfe, 0x63, 0x1, 0x83, 0x86, 0x30, 0x18, 0x38, 0x63, 0x1, 0x83, 0x86,
+    0x18, 0x18, 0x38, 0x61, 0xc1, 0x83, 0x86, 0xe, 0x1c, 0x38, 0x60, 0x61,
+    0xc3, 0x86, 0x6, 0x1c, 0x38, 0x60, 0x61, 0xc3, 0x86, 0x6, 0x1c, 0x3f,
+    0x60, 0xe1, 0xff, 0xe6, 0x7e, 0x7f, 0xf8, 0x67, 0xc7, 0xf0, 0x6, 0x0,
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+90B8 */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0xf8, 0x7, 0xfe, 0x3f, 0xe1, 0xff,
+    0x7, 0xfe, 0x1c, 0x60, 0x70, 0xe1, 0x86, 0x7, 0xc, 0x18, 0x60, 0x70,
+    0xc1, 0x86, 0x7, 0x18, 0x18, 0x60, 0x71, 0x81, 0x87, 0x7, 0x30, 0x1f,
+    0xff, 0x73, 0x1, 0xff, 0xe7, 0x70, 0x18, 0x30, 0x73, 0x1, 0x83, 0x7,
+    0x38, 0x18, 0x30, 0x71, 0xc1, 0x83, 0x7, 0xe, 0x18, 0x30, 0x70, 0x61,
+    0x83, 0x7, 0x6, 0x19, 0xf9, 0x70, 0x61, 0xf9, 0x97, 0x6, 0x7e, 0x1b,
+    0x70, 0xe7, 0x80, 0xf7, 0x7e, 0x0, 0xf, 0x77, 0xc3, 0xfe, 0x77, 0x0,
+    0x3f, 0xe0, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+90DD */
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0xf0, 0x0, 0xc0, 0x3f, 0xe0, 0xc,
+    0x7, 0xfe, 0x3f, 0xfe, 0x60, 0xe3, 0xff, 0xe6, 0xc, 0x0, 0xc0, 0x60,
+    0xc0, 0xc, 0x6, 0x1c, 0x0, 0xc0, 0x61, 0x83, 0xff, 0xe6, 0x38, 0x7f,
+    0xff, 0x63, 0x0, 0x3f, 0x6, 0x30, 0x3, 0x30, 0x63, 0x80, 0x33, 0x6,
+    0x18, 0x13, 0x34, 0x61, 0xc3, 0x33, 0x66, 0xe, 0x33, 0x36, 0x60, 0x67,
+    0x33, 0x76, 0x6, 0x77, 0x33, 0x60, 0x66, 0x63, 0x36, 0x6, 0x66, 0x33,
+    0x60, 0xe0, 0xe3, 0x6, 0x7e, 0xc, 0x30, 0x67, 0xc3, 0xc3, 0x6, 0x0,
+    0x78, 0x70, 0x60, 0x7, 0x1f, 0x6, 0x0, 0x1, 0xc0, 0x20, 0x0,
+
+    /* U+90E8 */
+    0x0, 0x80, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xc0, 0x3f, 0xe0, 0x1c,
+    0x7, 0xfe, 0x7f, 0xff, 0x70, 0xe3, 0xff, 0xf7, 0xc, 0xc, 0x18, 0x70,
+    0xc0, 0xc1, 0x87, 0x18, 0xc, 0x18, 0x71, 0x80, 0xc1, 0x87, 0x30, 0xe,
+    0x38, 0x73, 0x7, 0xff, 0xf7, 0x30, 0x7f, 0xff, 0x73, 0x80, 0x0, 0x7,
+    0x18, 0x0, 0x0, 0x71, 0xc0, 0x7f, 0x87, 0xc, 0x1f, 0xfc, 0x70, 0xe1,
+    0xc1, 0xe7, 0x6, 0x18, 0xe, 0x70, 0x61, 0x80, 0xe7, 0xe, 0x18, 0xe,
+    0x70, 0xe1, 0x80, 0xe7, 0x7e, 0x18, 0xe, 0x77, 0xc1, 0xff, 0xe7, 0x20,
+    0x1f, 0xfc, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+90ED */
+    0x0, 0x80, 0x0, 0x0, 0x1c, 0x0, 0xf0, 0x1, 0xc0, 0x3f, 0xe7, 0xff,
+    0xf7, 0xfe, 0x7f, 0xff, 0x60, 0xe0, 0x0, 0x6, 0xc, 0x1f, 0xfc, 0x60,
+    0xc3, 0xff, 0xe6, 0x18, 0x38, 0xe, 0x61, 0x83, 0x0, 0xe6, 0x38, 0x3f,
+    0xfe, 0x63, 0x1, 0xff, 0xc6, 0x30, 0x0, 0x0, 0x63, 0x83, 0xff, 0xe6,
+    0x18, 0x3f, 0xfe, 0x61, 0xc0, 0x1, 0xc6, 0xe, 0x0, 0x78, 0x60, 0xe0,
+    0xc, 0x6, 0x6, 0x1, 0xc7, 0x60, 0x63, 0xff, 0xf6, 0x6, 0x7f, 0xfc,
+    0x60, 0xe6, 0x1c, 0x6, 0x7e, 0x1, 0xc0, 0x67, 0xc0, 0x1c, 0x6, 0x20,
+    0xf, 0x80, 0x60, 0x0, 0xf8, 0x6, 0x0, 0x6, 0x0, 0x20, 0x0,
+
+    /* U+90FD */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x0, 0xf0, 0x3, 0x82, 0x3f, 0xe3, 0xfe,
+    0x77, 0xfe, 0x3f, 0xfe, 0x70, 0xe0, 0x39, 0xe6, 0xc, 0x3, 0x9c, 0x60,
+    0xc0, 0x3b, 0x86, 0x1c, 0x3, 0xf8, 0x61, 0x87, 0xff, 0xf6, 0x38, 0x7f,
+    0xff, 0x63, 0x0, 0x38, 0x6, 0x70, 0x7, 0x0, 0x63, 0x81, 0xff, 0x86,
+    0x18, 0x3f, 0xfc, 0x61, 0xc7, 0xc0, 0xe6, 0xe, 0x4c, 0xe, 0x60, 0xe0,
+    0xc0, 0x66, 0x6, 0xf, 0xfe, 0x60, 0x60, 0xff, 0xe6, 0x6, 0xc, 0xe,
+    0x60, 0xe0, 0xc0, 0x66, 0x3e, 0xc, 0xe, 0x67, 0xc0, 0xe0, 0xe6, 0x20,
+    0xf, 0xfc, 0x60, 0x0, 0x3f, 0x86, 0x0, 0x0, 0x0, 0x20, 0x0,
+
+    /* U+9109 */
+    0x4, 0x6, 0x0, 0x0, 0xe0, 0x60, 0x38, 0xe, 0x6, 0xf, 0xe0, 0xc1,
+    0xf9, 0xfe, 0x1c, 0x3f, 0xd8, 0x61, 0x9b, 0xd, 0x86, 0x31, 0xb0, 0xd8,
+    0xc7, 0x3b, 0xd, 0x8c, 0x73, 0x3f, 0xd9, 0xc3, 0xf3, 0xfd, 0x98, 0x1e,
+    0x30, 0xd9, 0x80, 0xe3, 0xd, 0x98, 0xd, 0x30, 0xd9, 0x80, 0xdb, 0x1d,
+    0x8c, 0x19, 0xbf, 0xd8, 0xc1, 0x9b, 0xf1, 0x86, 0x3f, 0xb0, 0x18, 0x67,
+    0xfb, 0x11, 0x86, 0x63, 0x31, 0x98, 0x60, 0x33, 0x19, 0x86, 0x7, 0x31,
+    0x98, 0x60, 0xe3, 0x3d, 0xbe, 0x1e, 0x3f, 0xdb, 0xc3, 0xcf, 0xef, 0x80,
+    0x78, 0xf0, 0x78, 0x7, 0x0, 0x1, 0x80, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+912D */
+    0x0, 0xf0, 0x1f, 0xc0, 0xcf, 0x83, 0xfe, 0x1c, 0xc, 0x38, 0xe1, 0xc0,
+    0xe3, 0xe, 0x3f, 0xff, 0x30, 0xc7, 0x1e, 0x3b, 0xc, 0x61, 0xe1, 0xf1,
+    0x81, 0xff, 0xe3, 0x18, 0x1b, 0x66, 0x33, 0x3, 0x32, 0x73, 0x30, 0x36,
+    0x3f, 0x33, 0x3, 0x60, 0x73, 0x38, 0x3f, 0xff, 0x31, 0x83, 0xff, 0xf3,
+    0xc, 0x38, 0x6, 0x30, 0xe1, 0xff, 0xe3, 0x6, 0xf, 0xfc, 0x30, 0x60,
+    0xc, 0x3, 0x6, 0x3f, 0xff, 0x30, 0xe3, 0xff, 0xfb, 0x1e, 0x1, 0xc0,
+    0x37, 0xc0, 0x1f, 0x3, 0x78, 0x7, 0xbc, 0x30, 0x1, 0xf1, 0xf3, 0x0,
+    0x7c, 0x7, 0x30, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+914D */
+    0x7f, 0xfc, 0x7f, 0x7, 0xff, 0xef, 0xfc, 0x7, 0xe0, 0x7f, 0xc0, 0x24,
+    0x0, 0xc, 0x2, 0x40, 0x0, 0xc0, 0xff, 0x80, 0xc, 0x3f, 0xfc, 0x0,
+    0xc3, 0xff, 0xc0, 0xc, 0x36, 0x4c, 0x0, 0xc3, 0x64, 0xc0, 0x1c, 0x36,
+    0x4c, 0xff, 0xc3, 0x64, 0xcf, 0xf8, 0x36, 0x6c, 0xc0, 0x3, 0xc7, 0xcc,
+    0x0, 0x3c, 0x7c, 0xc0, 0x3, 0x0, 0xcc, 0x0, 0x30, 0xc, 0xc0, 0x3,
+    0xff, 0xcc, 0x0, 0x3f, 0xfc, 0xc0, 0x3, 0x0, 0xcc, 0x6, 0x30, 0xc,
+    0xc0, 0x63, 0x0, 0xcc, 0x6, 0x30, 0xc, 0xf9, 0xe3, 0xff, 0xcf, 0xfc,
+    0x1f, 0xf8, 0x3f, 0x80,
+
+    /* U+9152 */
+    0x0, 0x0, 0x0, 0xf, 0x1f, 0xff, 0xf0, 0xf7, 0xff, 0xff, 0xe, 0x7f,
+    0xff, 0xc0, 0x0, 0x63, 0x0, 0x0, 0xc, 0x60, 0x0, 0x1, 0x9c, 0x0,
+    0x7, 0xff, 0xfc, 0x40, 0xff, 0xff, 0x9e, 0x18, 0xc6, 0x31, 0xe3, 0x18,
+    0xc6, 0xc, 0x67, 0x18, 0xc0, 0xc, 0xe3, 0x18, 0x1, 0xb8, 0x7f, 0x0,
+    0x36, 0xf, 0xe0, 0x6, 0x80, 0xc, 0xc, 0xc0, 0x1, 0x83, 0x98, 0x0,
+    0x30, 0x63, 0xff, 0xfe, 0x1c, 0x7f, 0xff, 0xc3, 0x8c, 0x0, 0x18, 0x61,
+    0x80, 0x3, 0x1c, 0x30, 0x0, 0x63, 0x87, 0x0, 0x1c, 0xe0, 0xff, 0xff,
+    0x9c, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9165 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0xfc, 0x7f, 0xfb, 0xff, 0x80, 0x7c,
+    0x3f, 0xc0, 0x6, 0xc0, 0x18, 0x0, 0x6c, 0x1, 0x80, 0x1f, 0xe0, 0x18,
+    0x3, 0xff, 0x81, 0x80, 0x36, 0xfb, 0xff, 0xc3, 0x6d, 0xff, 0xfe, 0x36,
+    0xd9, 0xff, 0xc3, 0x6d, 0x83, 0xc0, 0x34, 0xd8, 0x3e, 0x3, 0xcd, 0x87,
+    0xe0, 0x3c, 0xf8, 0x7e, 0x3, 0x8f, 0x8d, 0xb0, 0x30, 0x18, 0xdb, 0x3,
+    0x1, 0x99, 0x98, 0x3f, 0xf9, 0x99, 0xc3, 0xff, 0xb9, 0x8c, 0x30, 0x1f,
+    0x18, 0xe3, 0x1, 0xe1, 0x86, 0x30, 0x1e, 0x18, 0x23, 0x83, 0x81, 0x80,
+    0x3f, 0xf8, 0x18, 0x1, 0xfe, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+9187 */
+    0x0, 0x0, 0x18, 0x7, 0xff, 0x1, 0x80, 0x7f, 0xf8, 0x18, 0x0, 0x7c,
+    0x7f, 0xfe, 0x6, 0x87, 0xff, 0xe0, 0x68, 0x0, 0x0, 0x1f, 0xe0, 0xff,
+    0x83, 0xff, 0x3f, 0xfc, 0x36, 0xfb, 0x80, 0xc3, 0x69, 0xb0, 0xc, 0x36,
+    0x9b, 0xff, 0xc3, 0x49, 0x9f, 0xf8, 0x34, 0x98, 0x0, 0x3, 0xcd, 0x80,
+    0x0, 0x3c, 0xfb, 0xff, 0xc3, 0x8f, 0x9f, 0xfc, 0x30, 0x18, 0x7, 0x83,
+    0x1, 0x80, 0xe0, 0x3f, 0xf8, 0x18, 0x3, 0xff, 0xbf, 0xfe, 0x30, 0x1f,
+    0xff, 0xe3, 0x1, 0x81, 0x80, 0x30, 0x18, 0x18, 0x3, 0x3, 0x81, 0x80,
+    0x3f, 0xf0, 0x38, 0x1, 0xfe, 0xf, 0x80, 0x0, 0x0, 0x70, 0x0,
+
+    /* U+9192 */
+    0x7f, 0xf8, 0xff, 0x87, 0xff, 0x9f, 0xfc, 0x7, 0xc3, 0x80, 0xe0, 0x68,
+    0x30, 0x6, 0x6, 0x83, 0xff, 0xe1, 0xfe, 0x3f, 0xfe, 0x3f, 0xf3, 0x80,
+    0xe3, 0x6f, 0xb0, 0xe, 0x36, 0x9b, 0xff, 0xc3, 0x49, 0x9f, 0xfc, 0x34,
+    0x98, 0xc, 0x3, 0x49, 0x98, 0xc0, 0x3c, 0x99, 0x8c, 0x3, 0xcf, 0xbf,
+    0xfe, 0x38, 0xfb, 0xff, 0xe3, 0x1, 0xb0, 0xc0, 0x30, 0x1e, 0xc, 0x3,
+    0xff, 0xe0, 0xc0, 0x3f, 0xf9, 0xff, 0xc3, 0x1, 0x8f, 0xfc, 0x30, 0x18,
+    0xc, 0x3, 0x1, 0x80, 0xc0, 0x30, 0x38, 0xc, 0x3, 0xff, 0x7f, 0xfe,
+    0x1f, 0xe3, 0xff, 0xe0,
+
+    /* U+919C */
+    0x0, 0x0, 0x10, 0x7, 0xff, 0x83, 0x80, 0x7f, 0xfc, 0x30, 0x0, 0x7c,
+    0x1f, 0xf8, 0x6, 0x83, 0xff, 0xc0, 0x68, 0x31, 0x8c, 0x1f, 0xe3, 0x18,
+    0xc3, 0xff, 0x31, 0x8c, 0x37, 0xfb, 0xff, 0xc3, 0x69, 0xbf, 0xfc, 0x36,
+    0x9b, 0x18, 0xc3, 0x49, 0xb1, 0x8c, 0x34, 0x9b, 0x18, 0xc3, 0xcd, 0xbf,
+    0xfc, 0x3c, 0xfb, 0xff, 0xc3, 0x8f, 0x8d, 0xc0, 0x30, 0x18, 0xd9, 0x3,
+    0x1, 0x8d, 0x94, 0x3f, 0xf8, 0xd9, 0x63, 0xff, 0x8d, 0xbe, 0x30, 0x18,
+    0xdf, 0xa3, 0x1, 0x9d, 0x80, 0x30, 0x19, 0x98, 0x63, 0x3, 0xb9, 0xc6,
+    0x3f, 0xf7, 0xf, 0xe1, 0xfe, 0x70, 0xfe, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+91AB */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xc0, 0x32, 0x0, 0xce, 0x7, 0x70,
+    0x18, 0x66, 0x77, 0xf9, 0x87, 0xc7, 0x4c, 0x30, 0x38, 0x77, 0xf9, 0x0,
+    0x7, 0x7f, 0x9f, 0xf8, 0x71, 0xc0, 0x83, 0x87, 0x77, 0xc, 0x70, 0x7e,
+    0x18, 0x7c, 0x3, 0xc0, 0xf, 0xf8, 0x3f, 0xff, 0xc7, 0xe0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x31, 0x80, 0x1,
+    0xff, 0xff, 0xf8, 0x1c, 0x71, 0xc7, 0x81, 0x8e, 0x1c, 0xd8, 0x1b, 0xc0,
+    0xfd, 0x81, 0x80, 0x0, 0x18, 0x1f, 0xff, 0xff, 0x81, 0x80, 0x0, 0x18,
+    0x1c, 0x0, 0x3, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+91CB */
+    0x0, 0x40, 0x0, 0x1, 0xfc, 0xff, 0xfc, 0x7f, 0x8f, 0xff, 0xc4, 0x61,
+    0xcc, 0xce, 0x6, 0x18, 0xcc, 0x66, 0x67, 0xcc, 0xce, 0x36, 0x4f, 0xff,
+    0xc3, 0x6c, 0x7f, 0xf8, 0x16, 0xc0, 0x30, 0x0, 0x60, 0xff, 0xf8, 0x7f,
+    0xef, 0xff, 0xc7, 0xfe, 0x3, 0x0, 0xe, 0x0, 0x30, 0x0, 0xe1, 0xff,
+    0xfe, 0xe, 0x1f, 0xff, 0xe1, 0xf8, 0x30, 0x30, 0x1f, 0x83, 0x3, 0x1,
+    0xec, 0xff, 0xfe, 0x36, 0xff, 0xff, 0xe3, 0x64, 0x3, 0x0, 0x66, 0x0,
+    0x30, 0x6, 0x60, 0xff, 0xfc, 0x46, 0xf, 0xff, 0xc0, 0x60, 0x3, 0x0,
+    0x6, 0x0, 0x30, 0x0, 0x60, 0x3, 0x0, 0x2, 0x0, 0x30, 0x0,
+
+    /* U+91CC */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0x80,
+    0x60, 0x18, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x1f, 0xff, 0xff,
+    0x81, 0xff, 0xff, 0xf8, 0x18, 0x6, 0x1, 0x81, 0x80, 0x60, 0x18, 0x18,
+    0x6, 0x1, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xe0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0xf, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+91CD */
+    0x0, 0x0, 0x2, 0x0, 0x7, 0xff, 0xf0, 0x3f, 0xff, 0xfe, 0x1, 0xfe,
+    0xe0, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x1, 0xc0, 0x60, 0x38, 0x1c, 0x6, 0x3, 0x81, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x60, 0x38, 0xe, 0xe, 0x7, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+91CE */
+    0x1f, 0xf8, 0xff, 0x83, 0xff, 0xdf, 0xfc, 0x39, 0x9c, 0x1, 0xc3, 0x18,
+    0xc0, 0x18, 0x31, 0x8c, 0x43, 0x3, 0xff, 0xcf, 0x60, 0x3f, 0xfc, 0x7c,
+    0x3, 0xff, 0xc1, 0xc0, 0x31, 0x8c, 0xe, 0x3, 0x18, 0xc0, 0xe0, 0x3b,
+    0x9d, 0xff, 0xe3, 0xff, 0xdf, 0xfe, 0xf, 0xf0, 0x18, 0xe0, 0x18, 0x1,
+    0x8c, 0x1, 0x80, 0x18, 0xc3, 0xff, 0xc1, 0x98, 0x7f, 0xfe, 0x19, 0x83,
+    0xff, 0xc1, 0x90, 0x1, 0x80, 0x18, 0x0, 0x18, 0x1, 0x80, 0x1, 0x80,
+    0x18, 0x0, 0x3f, 0xe1, 0x80, 0x7f, 0xfc, 0x18, 0x7, 0xf0, 0xf, 0x80,
+    0x0, 0x1, 0xf8, 0x0, 0x0, 0xe, 0x0,
+
+    /* U+91CF */
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x0, 0xc0,
+    0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0xff, 0xff,
+    0xf0, 0xc, 0x6, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0xc0, 0x60, 0x30, 0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x6,
+    0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x60, 0x0,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+91D1 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0x79, 0xc0, 0x0, 0xf, 0xe, 0x0, 0x1, 0xc0, 0x78,
+    0x0, 0x78, 0x3, 0xc0, 0xf, 0x0, 0xf, 0x3, 0xff, 0xff, 0xfe, 0x79,
+    0xff, 0xf9, 0xe6, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0xe, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
+    0x0, 0x60, 0x0, 0x6, 0x6, 0xc, 0x0, 0x70, 0x60, 0xc0, 0x3, 0x6,
+    0x1c, 0x0, 0x38, 0x61, 0x80, 0x1, 0x6, 0x18, 0x0, 0x0, 0xe0, 0x0,
+    0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc,
+
+    /* U+91E3 */
+    0x1, 0x0, 0x60, 0x0, 0x70, 0xc, 0x0, 0x1f, 0x3, 0x80, 0x7, 0xf0,
+    0x70, 0x1, 0xc7, 0xc, 0x0, 0x78, 0x71, 0xfe, 0xe, 0x6, 0x7f, 0xf3,
+    0x80, 0x1f, 0xfe, 0x7f, 0xf3, 0x0, 0xc3, 0xfe, 0xe0, 0x18, 0xc, 0x18,
+    0x3, 0x1, 0x82, 0x0, 0x63, 0xff, 0x0, 0xc, 0x7f, 0xf3, 0x1, 0x80,
+    0xe0, 0x30, 0x30, 0x18, 0x7, 0x6, 0x33, 0x30, 0x70, 0xc6, 0x66, 0x6,
+    0x18, 0xcc, 0xc0, 0xc7, 0x19, 0x98, 0x0, 0xe3, 0x31, 0x0, 0x1c, 0x6,
+    0x0, 0x3, 0x80, 0xff, 0x0, 0x61, 0xff, 0xc0, 0x1c, 0x7f, 0xe0, 0x3f,
+    0x84, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+921E */
+    0x0, 0x0, 0x0, 0x0, 0x60, 0x10, 0x0, 0x1c, 0x6, 0x0, 0x3, 0xc0,
+    0xc0, 0x0, 0xfe, 0x18, 0x0, 0x39, 0xe7, 0xfc, 0xe, 0xc, 0xff, 0xf3,
+    0x80, 0x3f, 0xfe, 0x70, 0x6, 0x0, 0xcf, 0xfd, 0xc0, 0x18, 0x7f, 0xb0,
+    0x3, 0x1, 0x8e, 0x0, 0x60, 0x30, 0x1f, 0x8c, 0x7f, 0xc7, 0xf9, 0x9f,
+    0xfc, 0x7c, 0x30, 0xfe, 0x0, 0x6, 0x3, 0x0, 0x0, 0xc6, 0x64, 0x0,
+    0x18, 0xcc, 0xc0, 0xf3, 0x19, 0x98, 0xfc, 0x63, 0x33, 0x7e, 0xc, 0x66,
+    0x4e, 0x3, 0x80, 0xc0, 0x0, 0x70, 0x1b, 0x80, 0xc, 0x3f, 0xf0, 0x3,
+    0x8f, 0xf8, 0x7, 0xf0, 0x80, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+923A */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x78,
+    0xff, 0xfe, 0xf, 0xcf, 0xff, 0xe1, 0xce, 0x3, 0x0, 0x38, 0x70, 0x30,
+    0x7, 0x0, 0x3, 0x0, 0x70, 0x0, 0x30, 0x7, 0xfe, 0x3, 0x0, 0x1f,
+    0xe0, 0x30, 0x0, 0x30, 0x3, 0x0, 0x3, 0x0, 0x38, 0x3, 0xfe, 0x7f,
+    0xfc, 0x7f, 0xf7, 0xff, 0x81, 0xfc, 0x3, 0x0, 0x3, 0x0, 0x30, 0x3,
+    0x32, 0x3, 0x30, 0x33, 0x60, 0x33, 0x83, 0x36, 0x3, 0x18, 0x33, 0x60,
+    0x31, 0xc3, 0x32, 0x3, 0xc, 0x3, 0x0, 0x30, 0x0, 0x3e, 0x3, 0x0,
+    0x3f, 0xef, 0xff, 0xe7, 0xf0, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+9244 */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x1, 0x0, 0x7, 0x0, 0x18, 0x0, 0xf8,
+    0x1, 0x80, 0xf, 0xe3, 0x18, 0x1, 0xcf, 0x31, 0x80, 0x38, 0x33, 0x18,
+    0x7, 0x0, 0x7f, 0xfc, 0x70, 0x7, 0xff, 0xc7, 0xfe, 0x63, 0x80, 0x1f,
+    0xee, 0x18, 0x0, 0x30, 0xc3, 0x80, 0x3, 0x8, 0x38, 0x3, 0xfe, 0x3,
+    0x80, 0x7f, 0xf0, 0x38, 0x1, 0xfc, 0xff, 0xfe, 0x3, 0x7, 0xff, 0xe3,
+    0x32, 0x3, 0x80, 0x33, 0x60, 0x38, 0x3, 0x36, 0x7, 0xc0, 0x33, 0x60,
+    0x6c, 0x3, 0x32, 0xe, 0x60, 0x3, 0x0, 0xc3, 0x0, 0x3f, 0x3c, 0x38,
+    0x3f, 0xf7, 0x81, 0xc7, 0xf8, 0xf0, 0x1e, 0x20, 0x1e, 0x0, 0xe0, 0x0,
+    0x80, 0x0,
+
+    /* U+9280 */
+    0x3, 0x0, 0x0, 0x0, 0x70, 0x1f, 0xf0, 0xf, 0x83, 0xff, 0x80, 0xfe,
+    0x70, 0x18, 0x1c, 0xf6, 0x1, 0xc3, 0x83, 0x60, 0x1c, 0x70, 0x7, 0x1,
+    0xc7, 0x0, 0x7f, 0xfc, 0x7f, 0xe7, 0xff, 0xc1, 0xfe, 0x60, 0x1c, 0x3,
+    0x6, 0x1, 0xc0, 0x30, 0x60, 0x18, 0x3f, 0xe7, 0xff, 0x87, 0xff, 0x7f,
+    0xf0, 0x1f, 0xc6, 0x30, 0x0, 0x30, 0x61, 0x8e, 0x33, 0x66, 0x19, 0xc3,
+    0x36, 0x61, 0xb8, 0x33, 0x66, 0x1f, 0x3, 0x36, 0x60, 0xe0, 0x33, 0x26,
+    0xe, 0x0, 0x30, 0x60, 0x60, 0x3, 0xf7, 0xf3, 0x3, 0xfe, 0x7e, 0x3c,
+    0x7f, 0xf, 0x81, 0xe3, 0x1, 0xe0, 0xe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9298 */
+    0x2, 0x0, 0x40, 0x0, 0xe0, 0x1c, 0x0, 0x1e, 0x3, 0x0, 0x7, 0xe0,
+    0xff, 0xe1, 0xce, 0x1f, 0xfc, 0x70, 0xe6, 0x3, 0x9c, 0x1, 0xc0, 0xe3,
+    0x80, 0x70, 0x18, 0x5f, 0xed, 0x7, 0x3, 0xfb, 0xb9, 0xc0, 0xc, 0x3,
+    0xb0, 0x1, 0x80, 0x3c, 0x3, 0xfc, 0x7, 0x0, 0x7f, 0xc1, 0xc0, 0x1,
+    0xc0, 0x78, 0x0, 0x18, 0x1f, 0xfe, 0x33, 0x4f, 0xff, 0xc6, 0x6d, 0xf0,
+    0x18, 0xcd, 0xa6, 0x3, 0x19, 0xb0, 0xc0, 0x63, 0x36, 0x18, 0xc, 0x6,
+    0x3, 0x1, 0x81, 0xd8, 0x60, 0x31, 0xff, 0x8c, 0x6, 0x7f, 0x81, 0xff,
+    0xc4, 0x0, 0x1f, 0xf0,
+
+    /* U+92B3 */
+    0x2, 0x0, 0x0, 0x0, 0x70, 0x3, 0xc0, 0xf, 0x80, 0x7e, 0x0, 0xfc,
+    0x0, 0x70, 0x1c, 0xe3, 0x3, 0x3, 0x86, 0x70, 0x38, 0x30, 0x6, 0x1,
+    0xc7, 0x0, 0xe0, 0x1c, 0x7f, 0xfc, 0x0, 0xe1, 0xff, 0xff, 0xfe, 0x6,
+    0x7, 0xff, 0x80, 0x60, 0x60, 0x18, 0x3f, 0xe6, 0x1, 0x87, 0xfe, 0x60,
+    0x18, 0x7, 0x6, 0x1, 0x80, 0x60, 0x7f, 0xf8, 0x36, 0x67, 0xff, 0x83,
+    0x66, 0x1d, 0xc0, 0x36, 0x61, 0xcc, 0x3, 0x66, 0x18, 0xc0, 0x36, 0x61,
+    0x8c, 0x0, 0x60, 0x18, 0xc2, 0x7, 0xe3, 0x8c, 0x63, 0xfc, 0xf0, 0xc6,
+    0x7e, 0x1e, 0xf, 0xe0, 0x3, 0xc0, 0xfc, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+92E4 */
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x80, 0x18, 0x0, 0x30, 0x7, 0x87,
+    0x86, 0x1, 0xf8, 0xf8, 0xc0, 0x33, 0xbb, 0x18, 0xe, 0x3e, 0x63, 0x3,
+    0x80, 0xcc, 0x60, 0x60, 0x19, 0xbf, 0x8f, 0xfb, 0x37, 0xf8, 0x7e, 0x7e,
+    0x3f, 0x83, 0xf, 0xc6, 0x70, 0x61, 0x98, 0xce, 0x3f, 0x33, 0x19, 0x9f,
+    0xf6, 0x63, 0x30, 0x30, 0xcc, 0x66, 0x6, 0x1f, 0x8c, 0xc4, 0xd3, 0xf1,
+    0x98, 0xdb, 0x66, 0x73, 0x1b, 0x6c, 0xcc, 0x63, 0x6d, 0x99, 0x8c, 0x6d,
+    0x33, 0x31, 0x81, 0x86, 0x7e, 0x30, 0x3e, 0xff, 0x86, 0x3f, 0xff, 0x71,
+    0xcf, 0xc7, 0xc, 0xf8, 0x0, 0x3, 0xbe, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+92ED */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x10, 0x7, 0x6, 0x3, 0x80, 0xf8,
+    0x70, 0x30, 0xf, 0xc3, 0x87, 0x1, 0xce, 0x18, 0x60, 0x38, 0x70, 0xe,
+    0x7, 0x0, 0x7f, 0xf8, 0x70, 0x7, 0xff, 0xc7, 0xfe, 0xe0, 0x1c, 0x1f,
+    0xce, 0x0, 0xc0, 0x30, 0xe0, 0xc, 0x3, 0xe, 0x0, 0xc3, 0xfe, 0xe0,
+    0xc, 0x7f, 0xee, 0x1, 0xc1, 0xfc, 0x7f, 0xfc, 0x3, 0x7, 0xff, 0x83,
+    0x36, 0x18, 0xc0, 0x33, 0x61, 0x8c, 0x3, 0x36, 0x18, 0xc0, 0x33, 0x61,
+    0x8c, 0x3, 0x36, 0x38, 0xc2, 0x3, 0x3, 0xc, 0x60, 0x7e, 0x70, 0xc6,
+    0x1f, 0xee, 0xc, 0xe7, 0xf1, 0xc0, 0xfe, 0x30, 0x38, 0x7, 0xc0, 0x0,
+    0x0, 0x0,
+
+    /* U+9304 */
+    0x2, 0x1, 0x0, 0x0, 0x60, 0x30, 0x0, 0xf, 0x3, 0xfe, 0x0, 0xf8,
+    0x3f, 0xf8, 0x1d, 0xe7, 0x3, 0x83, 0x8e, 0x60, 0x38, 0x70, 0x26, 0x3,
+    0x87, 0x0, 0x7f, 0xf0, 0x7f, 0xc7, 0xff, 0x1, 0xfc, 0x0, 0x30, 0x6,
+    0x0, 0x3, 0x0, 0x60, 0xff, 0xfe, 0x6, 0x1f, 0xff, 0xe3, 0xfc, 0x3,
+    0x0, 0x7f, 0xe0, 0x30, 0x40, 0x70, 0xe3, 0xc, 0x6, 0x6, 0x39, 0xc3,
+    0x64, 0x73, 0xf8, 0x36, 0x40, 0x3e, 0x3, 0x64, 0x3, 0x60, 0x36, 0x41,
+    0xb3, 0x3, 0x64, 0x7b, 0x38, 0x6, 0xf, 0x31, 0xc1, 0xfd, 0xe3, 0xe,
+    0x7f, 0xd8, 0x70, 0x67, 0x80, 0x1f, 0x0, 0x0, 0x1, 0xc0, 0x0,
+
+    /* U+9320 */
+    0x3, 0x0, 0x30, 0x0, 0x70, 0x3, 0x0, 0xf, 0x80, 0x30, 0x0, 0xfc,
+    0x7, 0x80, 0x1c, 0xef, 0xff, 0xc3, 0x86, 0xff, 0xfe, 0x78, 0xc, 0x0,
+    0xe7, 0x0, 0xc0, 0x6, 0x7f, 0xec, 0x0, 0x61, 0xfc, 0xdf, 0xf6, 0x6,
+    0x3, 0xff, 0x0, 0x60, 0x3, 0x80, 0x3f, 0xc0, 0x38, 0x7, 0xfe, 0x3,
+    0x80, 0x1f, 0xc3, 0x38, 0x0, 0x60, 0x33, 0x80, 0x36, 0x63, 0x3f, 0x83,
+    0x66, 0x73, 0xf8, 0x36, 0x66, 0x38, 0x3, 0x66, 0x73, 0x80, 0x36, 0x47,
+    0x38, 0x0, 0x60, 0xfb, 0x80, 0x7, 0xed, 0xf8, 0x3, 0xff, 0xcf, 0x80,
+    0x7e, 0x38, 0x7f, 0xe2, 0x3, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9322 */
+    0x3, 0x0, 0x84, 0x0, 0x70, 0xc, 0xe0, 0xf, 0x80, 0xc7, 0x0, 0xfc,
+    0xc, 0x24, 0x1c, 0xef, 0xff, 0xe3, 0x87, 0xff, 0xf8, 0x70, 0x0, 0xe1,
+    0x7, 0x0, 0x6, 0x70, 0x7f, 0xe0, 0x3e, 0x1, 0xfc, 0x7, 0xc6, 0x7,
+    0x3, 0xfe, 0x60, 0x70, 0xf8, 0x7e, 0x3f, 0xcc, 0x8b, 0x87, 0xfe, 0xc,
+    0xc0, 0x1f, 0xc0, 0xc4, 0x0, 0x70, 0xc, 0x3e, 0x37, 0x6f, 0xff, 0xe3,
+    0x77, 0xff, 0xe0, 0x37, 0x60, 0xe1, 0x83, 0x76, 0x6, 0x70, 0x37, 0x60,
+    0x7f, 0x0, 0x70, 0x3, 0xc2, 0x7, 0xe0, 0x78, 0x63, 0xfe, 0x3f, 0xc6,
+    0x7f, 0x1f, 0x8f, 0xe2, 0x1, 0xe0, 0x3c, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+932B */
+    0x3, 0x0, 0x0, 0x0, 0xe0, 0x7f, 0xe0, 0x1e, 0x1f, 0xfe, 0x7, 0xe3,
+    0x80, 0xe1, 0xcf, 0x60, 0x1c, 0x70, 0x6e, 0x3, 0x8e, 0x1, 0xff, 0xf3,
+    0x80, 0x3f, 0xfe, 0x7f, 0xe6, 0x1, 0xc3, 0xfc, 0xe0, 0x38, 0xc, 0x1f,
+    0xfe, 0x1, 0x81, 0xff, 0x81, 0xfe, 0x18, 0x0, 0xff, 0xe6, 0x0, 0x1,
+    0xc1, 0xff, 0xf0, 0x18, 0x7f, 0xfe, 0x33, 0x6c, 0xcc, 0xc6, 0x6d, 0x19,
+    0x98, 0xcd, 0x86, 0x33, 0x19, 0xb1, 0xcc, 0x63, 0x36, 0x71, 0x8c, 0x6,
+    0x8, 0x61, 0x80, 0xfc, 0x18, 0x31, 0xff, 0x8e, 0xe, 0x7f, 0x87, 0x87,
+    0xc4, 0x1, 0xe1, 0xf0, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+934B */
+    0x2, 0x0, 0x0, 0x0, 0xc0, 0x3f, 0xc0, 0x3c, 0xf, 0xfc, 0xf, 0xe3,
+    0xff, 0xc1, 0xce, 0x60, 0x18, 0x70, 0xec, 0x3, 0x1c, 0x9, 0x87, 0xe3,
+    0x80, 0x31, 0xfc, 0x7f, 0xe6, 0x31, 0x83, 0xf8, 0xc6, 0x30, 0x18, 0x18,
+    0xc6, 0x3, 0x3, 0xb9, 0xc3, 0xfc, 0xff, 0xfc, 0xff, 0xdf, 0xff, 0x87,
+    0xf7, 0x0, 0x38, 0x30, 0xe0, 0x7, 0x36, 0x5c, 0xfc, 0xe6, 0xcf, 0xbf,
+    0x9c, 0xd9, 0xf6, 0x1b, 0x9b, 0x3e, 0xc3, 0x73, 0x65, 0xd8, 0x6e, 0xc,
+    0x3b, 0x9d, 0xc1, 0xc7, 0x3f, 0x39, 0xff, 0xe0, 0x7, 0x7f, 0xdc, 0x1,
+    0xcc, 0x1, 0x80, 0xf8, 0x0, 0x20, 0xe, 0x0,
+
+    /* U+934D */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x1, 0x0, 0x6, 0x0, 0x38, 0x0, 0xf0,
+    0x3, 0x80, 0x1f, 0xc7, 0xff, 0xe1, 0xce, 0xff, 0xfe, 0x38, 0x6c, 0x0,
+    0x7, 0x0, 0xcc, 0x30, 0x70, 0xc, 0xc3, 0x7, 0xfc, 0xff, 0xfe, 0x1f,
+    0xcd, 0xff, 0xe0, 0x60, 0xcc, 0x30, 0x6, 0xc, 0xc3, 0x3, 0xfc, 0xce,
+    0x70, 0x3f, 0xec, 0x7f, 0x0, 0x70, 0xc0, 0x0, 0x6, 0xc, 0x0, 0x3,
+    0x64, 0xdf, 0xf8, 0x36, 0x7d, 0xff, 0xc3, 0x67, 0xc0, 0x18, 0x36, 0x78,
+    0xc3, 0x83, 0x65, 0x8e, 0x70, 0x6, 0x18, 0x7e, 0x0, 0x7d, 0x83, 0xc0,
+    0x3f, 0xf8, 0xff, 0x7, 0xe3, 0x3e, 0x7e, 0x20, 0x37, 0x83, 0xe0, 0x0,
+    0x0, 0x0,
+
+    /* U+9396 */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x1, 0x0, 0x7, 0x4, 0x38, 0x40, 0xf8,
+    0x63, 0x8e, 0xf, 0xe7, 0x39, 0xc1, 0xcf, 0x33, 0x9c, 0x38, 0x33, 0x39,
+    0x83, 0x0, 0x3, 0x80, 0x70, 0x3, 0xff, 0x87, 0xfe, 0x7f, 0xfc, 0x1f,
+    0xe6, 0x0, 0xc0, 0x30, 0x60, 0xc, 0x3, 0x7, 0xff, 0xc3, 0xfe, 0x7f,
+    0xfc, 0x7f, 0xf6, 0x0, 0xc1, 0xfc, 0x60, 0xc, 0x3, 0x7, 0xff, 0xc3,
+    0x36, 0x7f, 0xfc, 0x33, 0x66, 0x0, 0xc3, 0x36, 0x60, 0xc, 0x33, 0x67,
+    0x1, 0xc3, 0x32, 0x7f, 0xfc, 0x3, 0x1, 0xff, 0x0, 0x3e, 0x18, 0x20,
+    0x3f, 0xf3, 0x87, 0x87, 0xf8, 0xf0, 0x3c, 0x20, 0x1e, 0x0, 0xe0, 0x1,
+    0x80, 0x2,
+
+    /* U+93AE */
+    0x3, 0x6, 0x1, 0x80, 0x70, 0x61, 0xf8, 0xf, 0x87, 0xff, 0x0, 0xfc,
+    0x7e, 0x4, 0x1c, 0xe6, 0x0, 0xc3, 0x87, 0x7f, 0xfc, 0x70, 0x7, 0xff,
+    0xc7, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0xff, 0x1, 0xfc, 0x1f, 0xf8, 0x6,
+    0x9, 0x81, 0xc0, 0x60, 0xdf, 0xfc, 0x3f, 0xcd, 0xff, 0xc7, 0xff, 0xd8,
+    0xc, 0x1f, 0xcd, 0xff, 0xc0, 0x60, 0xdf, 0xfc, 0x36, 0x6d, 0x81, 0xc3,
+    0x66, 0xdf, 0xf8, 0x36, 0x6c, 0xff, 0x83, 0x66, 0xc0, 0x0, 0x36, 0x4f,
+    0xff, 0xe0, 0x60, 0x7f, 0xfe, 0x7, 0xe0, 0x0, 0x3, 0xfe, 0x38, 0x70,
+    0x7f, 0xf, 0x3, 0xc0, 0x1, 0xe0, 0x1e, 0x0, 0x10, 0x0, 0x0,
+
+    /* U+93E1 */
+    0x2, 0x0, 0x30, 0x0, 0x70, 0x3, 0x0, 0xf, 0x87, 0xff, 0x80, 0xfc,
+    0xff, 0xfc, 0x1c, 0xe3, 0x87, 0x3, 0x87, 0x18, 0x70, 0x70, 0x1, 0x86,
+    0x7, 0x0, 0x1c, 0xf0, 0x7f, 0xdf, 0xff, 0xe1, 0xfc, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x60, 0x7f, 0xf8, 0x3f, 0xc7, 0xff, 0xc3, 0xfe, 0xc0,
+    0xc, 0x7, 0xf, 0xff, 0xc0, 0x60, 0xff, 0xfc, 0x16, 0x4c, 0x0, 0xc3,
+    0x66, 0xe0, 0x1c, 0x36, 0x67, 0xff, 0xc3, 0x66, 0x3f, 0xf0, 0x36, 0x41,
+    0x8c, 0x0, 0x60, 0x18, 0xc2, 0x7, 0xe3, 0x8c, 0x63, 0xfe, 0x70, 0xc6,
+    0x7f, 0x1e, 0xf, 0xe2, 0x3, 0xc0, 0xfc, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+9435 */
+    0x6, 0x3, 0xc, 0x0, 0x60, 0x30, 0xc0, 0xf, 0x3, 0xc, 0x81, 0xf9,
+    0xfe, 0xdc, 0x19, 0xdf, 0xec, 0xc3, 0x8e, 0x30, 0xc4, 0x70, 0x43, 0xc,
+    0x7, 0x3, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe1, 0xf8, 0x0, 0xc0, 0x6,
+    0x1f, 0xec, 0x0, 0x61, 0xfe, 0xc0, 0x3f, 0xd8, 0x6c, 0x67, 0xfd, 0xfe,
+    0xcc, 0x1f, 0x9f, 0xec, 0xc0, 0x60, 0x0, 0x6c, 0x36, 0xdf, 0xe7, 0x83,
+    0x6d, 0xfe, 0x78, 0x36, 0xc3, 0x7, 0x83, 0x6c, 0xfc, 0x70, 0x36, 0x9f,
+    0xe7, 0x20, 0x60, 0x30, 0x72, 0x6, 0xc3, 0xef, 0x23, 0xfd, 0xff, 0xde,
+    0x7f, 0x3f, 0x39, 0xe2, 0x0, 0x3, 0xe, 0x0, 0x0, 0x20, 0x40,
+
+    /* U+9577 */
+    0x3, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x7, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xf0, 0x7, 0xff, 0xfe,
+    0x0, 0x60, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x7,
+    0xff, 0xff, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x70, 0x60, 0x0, 0x6, 0x7, 0x1, 0x80,
+    0x60, 0x30, 0x78, 0x6, 0x3, 0x8f, 0x0, 0x60, 0x1f, 0xc0, 0x6, 0x0,
+    0xf0, 0x0, 0x60, 0xe7, 0x80, 0x7, 0xfe, 0x3f, 0x3, 0xff, 0xc0, 0xfe,
+    0x7f, 0x80, 0x3, 0xe2, 0x0, 0x0, 0x4,
+
+    /* U+9580 */
+    0x1f, 0xc0, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x39, 0x81, 0xcc,
+    0x6, 0x60, 0x73, 0x81, 0x9f, 0xfc, 0xff, 0xe7, 0xff, 0x3f, 0xf9, 0x81,
+    0xcc, 0x6, 0x60, 0x73, 0x1, 0x9c, 0x1c, 0xe0, 0x67, 0xfe, 0x1f, 0xf9,
+    0xff, 0x3, 0xfe, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0x19, 0x80, 0x0, 0x7e, 0x60, 0x0, 0x1f, 0x88, 0x0, 0x7,
+    0x80,
+
+    /* U+9583 */
+    0x3f, 0xe1, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x19, 0x80, 0xcc,
+    0x6, 0x7f, 0xf3, 0xff, 0x9f, 0xfc, 0xff, 0xe6, 0x3, 0x30, 0x19, 0x81,
+    0xce, 0x6, 0x7f, 0xe3, 0xff, 0x9f, 0xf8, 0x7f, 0xe6, 0x0, 0x0, 0x19,
+    0x80, 0x30, 0x6, 0x60, 0xc, 0x1, 0x98, 0x7, 0x0, 0x66, 0x1, 0xc0,
+    0x19, 0x80, 0x78, 0x6, 0x60, 0x3f, 0x1, 0x98, 0xc, 0xc0, 0x66, 0x7,
+    0x1c, 0x19, 0x83, 0x83, 0x86, 0x63, 0xc0, 0xf9, 0x99, 0xc0, 0xe, 0x66,
+    0x60, 0x0, 0x99, 0x80, 0x0, 0x1e, 0x60, 0x0, 0xf, 0x98, 0x0, 0x3,
+    0x80,
+
+    /* U+958B */
+    0x3f, 0xe1, 0xff, 0x1f, 0xf8, 0x7f, 0xe7, 0x7, 0x38, 0x19, 0x81, 0xcc,
+    0x6, 0x7f, 0xf3, 0xff, 0x9f, 0xfc, 0xff, 0xe6, 0x3, 0x30, 0x19, 0x81,
+    0xce, 0x6, 0x7f, 0xe1, 0xff, 0x9f, 0xf0, 0x3f, 0xe6, 0x0, 0x0, 0x19,
+    0x8f, 0xff, 0xc6, 0x63, 0xff, 0xf9, 0x98, 0x18, 0x70, 0x66, 0x6, 0x18,
+    0x19, 0x81, 0x86, 0x6, 0x60, 0x61, 0xc1, 0x99, 0xff, 0xff, 0x66, 0x7f,
+    0xff, 0x99, 0x83, 0x86, 0x6, 0x60, 0xc1, 0x81, 0x98, 0x70, 0x60, 0x66,
+    0x3c, 0x18, 0x19, 0x9e, 0x6, 0x3e, 0x66, 0x1, 0x8f, 0x98, 0x0, 0x3,
+    0x80,
+
+    /* U+9593 */
+    0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xe7, 0xfe, 0x3f, 0xf9, 0xc1, 0xce,
+    0x6, 0x60, 0x33, 0x1, 0x9f, 0xfc, 0xff, 0xe7, 0xff, 0x3f, 0xf9, 0x80,
+    0xcc, 0x6, 0x60, 0x73, 0x81, 0x9f, 0xf8, 0xff, 0xe7, 0xfe, 0x1f, 0xf9,
+    0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x7f, 0xf8, 0x66, 0x1f, 0xfe,
+    0x19, 0x86, 0x1, 0x86, 0x61, 0x80, 0x61, 0x98, 0x60, 0x18, 0x66, 0x1f,
+    0xfe, 0x19, 0x87, 0xff, 0x86, 0x61, 0x80, 0x61, 0x98, 0x60, 0x18, 0x66,
+    0x1f, 0xfe, 0x19, 0x87, 0xff, 0x86, 0x60, 0x0, 0xf, 0x98, 0x0, 0x3,
+    0xe0, 0x0, 0x0, 0x60,
+
+    /* U+95DC */
+    0x3f, 0xe1, 0xff, 0x1f, 0xf8, 0x7f, 0xe6, 0x7, 0x38, 0x19, 0xff, 0xcf,
+    0xfe, 0x7f, 0xf3, 0xff, 0x98, 0x1c, 0xe0, 0x66, 0x7, 0x38, 0x19, 0xff,
+    0x87, 0xfe, 0x7f, 0xc0, 0xff, 0x98, 0xc0, 0x30, 0x66, 0x36, 0x19, 0x99,
+    0xb9, 0x9c, 0xc6, 0x67, 0xc3, 0xe1, 0x98, 0xf4, 0x7a, 0x66, 0x1b, 0xc,
+    0xd9, 0xbf, 0xef, 0xf6, 0x6f, 0xdf, 0xf7, 0x98, 0x84, 0xc6, 0x66, 0x63,
+    0x31, 0x99, 0x98, 0xcc, 0x66, 0x67, 0xf3, 0xf9, 0x98, 0xfc, 0xfc, 0x66,
+    0x6, 0x30, 0x19, 0x87, 0x8c, 0x1e, 0x67, 0xc3, 0xf, 0x98, 0x80, 0x83,
+    0xc0,
+
+    /* U+962A */
+    0x3e, 0x0, 0x0, 0x3f, 0xe7, 0xff, 0xee, 0x3b, 0xff, 0xfb, 0xe, 0xc0,
+    0x0, 0xc3, 0x30, 0x0, 0x31, 0xcc, 0x0, 0xc, 0x63, 0x0, 0x3, 0x18,
+    0xc0, 0x0, 0xcc, 0x3f, 0xff, 0x33, 0xf, 0xff, 0xcc, 0xe3, 0x0, 0x73,
+    0x18, 0xc8, 0x1c, 0xc7, 0x36, 0x6, 0x30, 0xcc, 0xc3, 0x8c, 0x33, 0x30,
+    0xc3, 0xd, 0xcc, 0x70, 0xc7, 0x61, 0x98, 0x33, 0xd8, 0x6e, 0xd, 0xe6,
+    0xf, 0x3, 0x23, 0x83, 0xc0, 0xc0, 0xc0, 0xf0, 0x30, 0x70, 0xff, 0xc,
+    0x38, 0x79, 0xe3, 0xc, 0x78, 0x3e, 0xc2, 0x3c, 0x3, 0x90, 0x4, 0x0,
+    0x0,
+
+    /* U+9632 */
+    0x0, 0x0, 0x80, 0xf, 0xc0, 0x60, 0xf, 0xf8, 0x18, 0x3, 0x8e, 0x6,
+    0x0, 0xc3, 0x81, 0x80, 0x30, 0xdf, 0xff, 0xec, 0x37, 0xff, 0xfb, 0x18,
+    0x18, 0x0, 0xc6, 0x6, 0x0, 0x33, 0x81, 0x80, 0xc, 0xe0, 0x60, 0x3,
+    0x18, 0x1f, 0xf0, 0xc7, 0x7, 0xfe, 0x30, 0xc1, 0xff, 0xcc, 0x38, 0x60,
+    0x33, 0x6, 0x38, 0xc, 0xc1, 0x8c, 0x3, 0x30, 0xe3, 0x0, 0xcc, 0xf8,
+    0xc0, 0x73, 0x7c, 0x70, 0x1c, 0xce, 0x18, 0x7, 0x30, 0xe, 0x1, 0x8c,
+    0x7, 0x0, 0x63, 0x3, 0x80, 0x38, 0xc1, 0xc0, 0xfe, 0x30, 0xe0, 0x3f,
+    0x4, 0x0, 0x0, 0x0,
+
+    /* U+963F */
+    0x1f, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0x30, 0xc0,
+    0x1, 0xc6, 0x18, 0x0, 0x30, 0xc6, 0x0, 0x6, 0x18, 0xc0, 0x0, 0xc3,
+    0x30, 0xff, 0x18, 0x66, 0x1f, 0xe3, 0xc, 0xc3, 0xe, 0x61, 0x98, 0x61,
+    0xcc, 0x31, 0x8c, 0x39, 0x86, 0x31, 0x87, 0x30, 0xc7, 0x30, 0xe6, 0x18,
+    0x66, 0x1c, 0xc3, 0xc, 0xc3, 0x18, 0x61, 0x9f, 0xe3, 0xc, 0xf1, 0xfc,
+    0x61, 0xbc, 0x0, 0xc, 0x37, 0x0, 0x1, 0x86, 0x0, 0x0, 0x30, 0xc0,
+    0x0, 0x6, 0x18, 0x0, 0x0, 0xc3, 0x0, 0x1, 0xf8, 0x60, 0x0, 0x3f,
+    0xc, 0x0, 0x3, 0x0,
+
+    /* U+9644 */
+    0x0, 0x4, 0x2, 0x7, 0xe0, 0xc0, 0x61, 0xfe, 0x38, 0x1c, 0x39, 0xc6,
+    0x3, 0x86, 0x39, 0xc0, 0x70, 0xc6, 0x30, 0xe, 0x18, 0xc6, 0x1, 0xc3,
+    0x31, 0xdf, 0xfe, 0x66, 0x3b, 0xff, 0xcd, 0xcf, 0x0, 0xe1, 0xb9, 0xe0,
+    0x1c, 0x33, 0x6c, 0x3, 0x86, 0x7d, 0x80, 0x70, 0xc6, 0x33, 0xe, 0x18,
+    0xc6, 0x31, 0xc3, 0x1c, 0xc7, 0x38, 0x63, 0x98, 0x67, 0xc, 0x73, 0xc,
+    0xe1, 0xbc, 0x60, 0x1c, 0x37, 0x8c, 0x3, 0x86, 0xc1, 0x80, 0x70, 0xc0,
+    0x30, 0xe, 0x18, 0x6, 0x1, 0xc3, 0x0, 0xc0, 0x38, 0x60, 0x18, 0x3f,
+    0xc, 0x3, 0xf, 0xc1, 0x80, 0x20, 0x60, 0x0,
+
+    /* U+964D */
+    0x0, 0x2, 0x0, 0x3, 0xe0, 0xc0, 0x1, 0xfe, 0x3f, 0xf8, 0x39, 0xcf,
+    0xff, 0x86, 0x19, 0xf0, 0x70, 0xc3, 0x7e, 0xe, 0x18, 0xdc, 0xe3, 0x83,
+    0x1b, 0xf, 0xe0, 0x66, 0x0, 0xf0, 0xc, 0xc0, 0x7f, 0x1, 0x98, 0x7e,
+    0xfe, 0x33, 0x3e, 0x7, 0xe6, 0x77, 0x6, 0x1c, 0xc6, 0x0, 0xe0, 0x18,
+    0xef, 0xff, 0xe3, 0xd, 0xff, 0xfc, 0x61, 0x80, 0x70, 0xc, 0x33, 0xe,
+    0x1, 0x9e, 0x61, 0xc0, 0x37, 0x8c, 0x38, 0x6, 0xe3, 0xff, 0xfc, 0xc0,
+    0x7f, 0xff, 0x98, 0xc, 0x1c, 0x3, 0x1, 0x83, 0x80, 0x60, 0x0, 0x70,
+    0xc, 0x0, 0xc, 0x1, 0x80, 0x0, 0x80, 0x0,
+
+    /* U+9650 */
+    0x1f, 0x7, 0xfc, 0xf, 0xf3, 0xff, 0xe1, 0xce, 0x70, 0x1e, 0x30, 0xcc,
+    0x1, 0xc6, 0x19, 0x80, 0x38, 0xc6, 0x30, 0x7, 0x18, 0xc7, 0xff, 0xe3,
+    0x30, 0xff, 0xfc, 0x66, 0x18, 0x3, 0x8c, 0xc3, 0x0, 0x71, 0x98, 0x60,
+    0xe, 0x31, 0x8f, 0xff, 0x86, 0x31, 0xff, 0xf0, 0xc3, 0x31, 0xc0, 0x18,
+    0x66, 0x18, 0x73, 0xc, 0xc3, 0x1c, 0x61, 0x98, 0x67, 0xc, 0xf3, 0x7,
+    0xc1, 0xbc, 0x60, 0xf0, 0x37, 0xc, 0x1c, 0x6, 0x1, 0x9d, 0xc0, 0xc0,
+    0x3f, 0x9c, 0x18, 0xf, 0xc1, 0xe3, 0x7, 0xe0, 0x1e, 0x60, 0xe0, 0x1,
+    0xcc, 0x0, 0x0, 0x0,
+
+    /* U+9662 */
+    0x0, 0x0, 0xc0, 0x3, 0xe0, 0x18, 0x1, 0xfe, 0x3, 0x0, 0x39, 0xcf,
+    0xff, 0x86, 0x3b, 0xff, 0xf8, 0xc6, 0xe0, 0x3, 0x98, 0xd8, 0x0, 0x73,
+    0x3b, 0x0, 0x6, 0x66, 0x60, 0x0, 0xcc, 0xc1, 0xff, 0xc1, 0x98, 0x3f,
+    0xf8, 0x33, 0x0, 0x0, 0x6, 0x30, 0x0, 0x0, 0xc6, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xf3, 0xd, 0xff, 0xfe, 0x61, 0x86, 0x38, 0xc, 0x70, 0xc7,
+    0x1, 0x9e, 0x18, 0xe0, 0x3f, 0x83, 0x1c, 0x6, 0xe0, 0xe3, 0x80, 0xc0,
+    0x18, 0x70, 0x98, 0x7, 0xe, 0x33, 0x1, 0xc1, 0xc6, 0x60, 0xf0, 0x3f,
+    0xcc, 0x1c, 0x3, 0xf1, 0x82, 0x0, 0x0, 0x0,
+
+    /* U+9664 */
+    0x0, 0x1, 0x80, 0xf, 0xc0, 0xe0, 0xf, 0xf8, 0x7c, 0x3, 0x9e, 0x1f,
+    0x80, 0xc3, 0xe, 0x60, 0x30, 0xc7, 0xc, 0xc, 0x63, 0x81, 0xc3, 0x19,
+    0xc0, 0x3c, 0xce, 0xe0, 0x7, 0xb3, 0x7f, 0xff, 0xec, 0xdb, 0xff, 0xcb,
+    0x30, 0x6, 0x0, 0xc6, 0x1, 0x80, 0x31, 0x80, 0x60, 0xc, 0x37, 0xff,
+    0xf3, 0xd, 0xff, 0xfc, 0xc3, 0x3, 0xc0, 0x30, 0xc0, 0x60, 0xc, 0xf1,
+    0x18, 0x83, 0x78, 0xc6, 0x70, 0xdc, 0x71, 0x8e, 0x30, 0x38, 0x61, 0xcc,
+    0x1c, 0x18, 0x3b, 0xe, 0x6, 0x6, 0xc3, 0xf, 0x80, 0x30, 0x3, 0xe0,
+    0xc, 0x0, 0xe0, 0x0,
+
+    /* U+966A */
+    0x0, 0x0, 0x40, 0x3, 0xe0, 0xc, 0x1, 0xfe, 0x3, 0x80, 0x39, 0xc0,
+    0x70, 0x6, 0x1b, 0xff, 0xfc, 0xc3, 0x7f, 0xff, 0x18, 0xc1, 0x81, 0x83,
+    0x18, 0x30, 0x30, 0x66, 0x6, 0xe, 0xc, 0xc0, 0xc1, 0x81, 0x98, 0x1c,
+    0x30, 0x33, 0x3f, 0xff, 0xe6, 0x37, 0xff, 0xfc, 0xc6, 0x0, 0x0, 0x18,
+    0x60, 0x0, 0x3, 0xc, 0x0, 0x0, 0x61, 0x8f, 0xff, 0xc, 0x33, 0xff,
+    0xe1, 0x9e, 0x60, 0xe, 0x37, 0x8c, 0x1, 0xc6, 0xe1, 0x80, 0x38, 0xc0,
+    0x30, 0x7, 0x18, 0x6, 0x0, 0xe3, 0x0, 0xc0, 0x1c, 0x60, 0x1f, 0xff,
+    0xc, 0x1, 0xff, 0xe0, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+9673 */
+    0x0, 0x0, 0x40, 0x7, 0xe0, 0x18, 0x1, 0xfe, 0x3, 0x0, 0x39, 0xff,
+    0xff, 0xe6, 0x1b, 0xff, 0xfc, 0xc6, 0x1, 0x80, 0x18, 0xc0, 0x30, 0x3,
+    0x31, 0xff, 0xf8, 0x66, 0x3f, 0xff, 0x8c, 0xc6, 0x18, 0x71, 0xb8, 0xc3,
+    0xe, 0x33, 0x1f, 0xff, 0xc6, 0x73, 0xff, 0xf8, 0xc6, 0x61, 0x83, 0x18,
+    0xce, 0x30, 0xe3, 0x1d, 0xff, 0xfc, 0x61, 0x9f, 0xff, 0xc, 0x70, 0x3c,
+    0x1, 0x9c, 0xf, 0xc0, 0x3f, 0x83, 0x6c, 0x6, 0xe1, 0xcc, 0xe0, 0xc0,
+    0x71, 0x9e, 0x18, 0x3c, 0x30, 0xf3, 0xf, 0x6, 0xe, 0x61, 0x80, 0xc0,
+    0xcc, 0x0, 0x18, 0x1, 0x80, 0x1, 0x0, 0x0,
+
+    /* U+9676 */
+    0x0, 0x8, 0x0, 0xf, 0xc6, 0x0, 0x7, 0xf9, 0x80, 0x1, 0xce, 0xff,
+    0xfc, 0x63, 0xbf, 0xff, 0x98, 0xcc, 0x0, 0x76, 0x36, 0x40, 0x1d, 0x9b,
+    0xb0, 0x7, 0x66, 0xdc, 0x1, 0xdb, 0x27, 0xfe, 0x76, 0xc3, 0xff, 0x1d,
+    0x98, 0xcc, 0x7, 0x66, 0x3, 0x1, 0xd8, 0xc0, 0xe0, 0x66, 0x37, 0xff,
+    0xd9, 0x8e, 0xff, 0xf6, 0x63, 0x83, 0x1, 0x98, 0xe8, 0xc2, 0x66, 0xf3,
+    0x31, 0x99, 0xbc, 0xcc, 0x66, 0x60, 0x33, 0x19, 0x98, 0xf, 0xfe, 0x66,
+    0x3, 0xff, 0x99, 0x80, 0x0, 0xe, 0x60, 0x0, 0x1f, 0x98, 0x0, 0x7,
+    0xc4, 0x0, 0x1, 0x80,
+
+    /* U+9678 */
+    0x0, 0x0, 0xc0, 0x3, 0xe0, 0x18, 0x1, 0xfe, 0x3, 0x0, 0x39, 0xdf,
+    0xff, 0x86, 0x1b, 0xff, 0xf0, 0xc6, 0x1, 0x80, 0x18, 0xc0, 0x30, 0x3,
+    0x38, 0x6, 0x0, 0x66, 0xff, 0xff, 0xcc, 0xcf, 0xff, 0xf9, 0xb8, 0x18,
+    0xc0, 0x33, 0x3, 0x18, 0x6, 0x70, 0xc3, 0xc, 0xc6, 0x38, 0x73, 0x98,
+    0xce, 0x7, 0xf3, 0x1f, 0x86, 0x78, 0x61, 0x80, 0xc0, 0xc, 0x70, 0x18,
+    0x1, 0x9c, 0xff, 0xfe, 0x3f, 0x9f, 0xff, 0xc6, 0xe0, 0xc, 0x0, 0xc0,
+    0x1, 0x80, 0x18, 0x0, 0x30, 0x3, 0x0, 0xe, 0x0, 0x61, 0xff, 0xff,
+    0xcc, 0x3f, 0xff, 0xf9, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+967D */
+    0x0, 0x0, 0x0, 0x7, 0xe1, 0xff, 0xc1, 0xfe, 0x7f, 0xfc, 0x39, 0xcc,
+    0x1, 0x86, 0x19, 0x80, 0x30, 0xc6, 0x3f, 0xfe, 0x18, 0xc7, 0xff, 0xc3,
+    0x30, 0xc0, 0x18, 0x66, 0x1c, 0x7, 0xc, 0xc3, 0xff, 0xe1, 0xb0, 0x0,
+    0x0, 0x33, 0x0, 0x0, 0x6, 0x67, 0xff, 0xfc, 0xc6, 0xff, 0xff, 0x98,
+    0xc1, 0x80, 0x3, 0x1c, 0x70, 0x0, 0x63, 0x9f, 0xff, 0x8c, 0x77, 0xfb,
+    0xf1, 0x9d, 0xce, 0x66, 0x3f, 0xb1, 0x9c, 0xc6, 0xe4, 0x63, 0x18, 0xc0,
+    0x38, 0xe3, 0x18, 0xe, 0x38, 0x63, 0x1, 0x8e, 0x1c, 0x60, 0xf, 0x87,
+    0xc, 0x7, 0xc3, 0xe1, 0x80, 0xe0, 0x70, 0x0,
+
+    /* U+9685 */
+    0x1f, 0xf, 0xfe, 0x1f, 0xe7, 0xff, 0xc7, 0x3b, 0x8e, 0x39, 0x86, 0xc3,
+    0x6, 0x63, 0xb0, 0xc1, 0x98, 0xcf, 0xff, 0xe6, 0x73, 0xff, 0xf9, 0x98,
+    0xc3, 0x6, 0x66, 0x30, 0xc1, 0x9b, 0x8f, 0xff, 0xe6, 0x61, 0xff, 0xf1,
+    0x9c, 0x3, 0x80, 0x63, 0x0, 0xc0, 0x18, 0xc7, 0xff, 0xc6, 0x1b, 0xff,
+    0xf9, 0x87, 0xc3, 0x87, 0x63, 0xe0, 0xc0, 0xd9, 0xd8, 0x33, 0x37, 0xf6,
+    0xe, 0xcd, 0xb9, 0x9f, 0xfb, 0x60, 0x6f, 0xc6, 0xd8, 0x18, 0x0, 0x36,
+    0x6, 0x0, 0x1d, 0x81, 0x80, 0x1f, 0x60, 0x60, 0xf, 0x98, 0x8, 0x1,
+    0x80,
+
+    /* U+9686 */
+    0x0, 0x2, 0x0, 0x3, 0xf0, 0xc0, 0x1, 0xfe, 0x3f, 0xfc, 0x39, 0xcf,
+    0xff, 0xc6, 0x1b, 0xe0, 0x78, 0xc3, 0x66, 0xe, 0x18, 0xfc, 0xe7, 0x83,
+    0x1a, 0xf, 0xc0, 0x66, 0x0, 0xf0, 0xc, 0xc0, 0xff, 0x81, 0x98, 0xfc,
+    0x7f, 0x33, 0x3e, 0x3, 0xe6, 0x36, 0x7f, 0xe0, 0xc6, 0x0, 0xc0, 0x18,
+    0x63, 0x18, 0x3, 0xc, 0xff, 0xf8, 0x61, 0x9f, 0xff, 0x8c, 0x77, 0x1c,
+    0x1, 0x9e, 0xc1, 0x80, 0x37, 0xb8, 0x30, 0x6, 0xe6, 0xff, 0xf0, 0xc0,
+    0xf, 0xfc, 0x18, 0x0, 0x18, 0x3, 0x0, 0x3, 0x0, 0x60, 0xff, 0xff,
+    0xcc, 0x1f, 0xff, 0xf9, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+968E */
+    0x0, 0x10, 0x30, 0x3, 0xe7, 0x6, 0x1, 0xfe, 0xe0, 0xc0, 0x39, 0xdc,
+    0x18, 0xe6, 0x1b, 0xfb, 0x78, 0xc6, 0x7f, 0x7c, 0x18, 0xce, 0xe, 0x3,
+    0x39, 0xc1, 0x80, 0x66, 0x38, 0x30, 0x4c, 0xc7, 0x6, 0x19, 0xb8, 0xfe,
+    0xc3, 0x33, 0x3f, 0x9f, 0xe6, 0x7f, 0x83, 0xf8, 0xc6, 0x3, 0x0, 0x18,
+    0xc0, 0x60, 0x3, 0x1c, 0xff, 0xf0, 0x61, 0xbf, 0xff, 0xc, 0x77, 0x0,
+    0x71, 0x9c, 0xc0, 0xe, 0x3f, 0x98, 0x1, 0xc6, 0xe3, 0xff, 0xf8, 0xc0,
+    0x7f, 0xff, 0x18, 0xc, 0x0, 0xe3, 0x1, 0x80, 0x1c, 0x60, 0x3f, 0xff,
+    0xc, 0x3, 0xff, 0xe1, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+9694 */
+    0x3f, 0x3f, 0xff, 0xcf, 0xff, 0xff, 0xf9, 0xce, 0x0, 0x0, 0x31, 0x80,
+    0x0, 0x6, 0x31, 0xff, 0xf0, 0xc6, 0x3f, 0xfe, 0x19, 0x86, 0x0, 0xc3,
+    0x30, 0xc0, 0x18, 0x6c, 0x1f, 0xff, 0xd, 0x81, 0xff, 0xc1, 0x98, 0x0,
+    0x0, 0x33, 0xf, 0xff, 0x86, 0x33, 0xff, 0xf8, 0xc6, 0xe6, 0x63, 0x98,
+    0xd8, 0xcc, 0x33, 0x1b, 0x39, 0x86, 0x63, 0x66, 0x3f, 0xcd, 0xed, 0x81,
+    0xf9, 0xb9, 0x80, 0x3, 0x30, 0x33, 0xfe, 0x66, 0x6, 0x7f, 0xcc, 0xc0,
+    0xc1, 0x81, 0x98, 0x18, 0x30, 0x73, 0x3, 0x6, 0x3e, 0x60, 0x60, 0x4f,
+    0x88, 0x4, 0x0, 0xe0,
+
+    /* U+969B */
+    0x0, 0x8, 0x0, 0x7, 0xe3, 0x80, 0x1, 0xfe, 0x7f, 0x3e, 0x39, 0xdf,
+    0xf7, 0xe6, 0x33, 0xe, 0x1c, 0xc6, 0xe1, 0xe7, 0x18, 0xdb, 0x6c, 0xc3,
+    0x37, 0x3c, 0xf0, 0x66, 0xc3, 0x1c, 0xd, 0xb6, 0xc1, 0xc1, 0xb0, 0xf8,
+    0x1c, 0x33, 0xe, 0x1, 0xc6, 0x63, 0xff, 0xfc, 0xc6, 0xef, 0xf9, 0x98,
+    0xf8, 0x0, 0x13, 0x1e, 0x0, 0x0, 0x63, 0x9f, 0xff, 0xc, 0x6f, 0xff,
+    0xf9, 0xbc, 0xff, 0xfe, 0x37, 0x0, 0x60, 0x6, 0x1, 0x8c, 0xe0, 0xc0,
+    0x71, 0x8e, 0x18, 0x3c, 0x30, 0xe3, 0xf, 0x6, 0xe, 0x61, 0x83, 0xc0,
+    0xcc, 0x0, 0xf8, 0x1, 0x0, 0xc, 0x0, 0x0,
+
+    /* U+96AA */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x7e, 0x7, 0x0, 0x3f, 0xc1,
+    0xf0, 0x7, 0x38, 0x3f, 0x0, 0xc3, 0xe, 0x60, 0x18, 0xe3, 0x87, 0x3,
+    0x18, 0xe0, 0x70, 0x63, 0x38, 0xf, 0x8c, 0xcf, 0xff, 0xf9, 0x9b, 0x9f,
+    0xe7, 0x33, 0x60, 0x0, 0x6, 0x60, 0x0, 0x0, 0xce, 0x7e, 0x7e, 0x18,
+    0xce, 0xec, 0xe3, 0x1d, 0x8d, 0x8c, 0x61, 0xb1, 0xb1, 0x8c, 0x36, 0x36,
+    0x31, 0x8e, 0xfe, 0xfe, 0x33, 0xdf, 0x9f, 0x86, 0xf0, 0xc0, 0xc0, 0xdc,
+    0x30, 0x38, 0x18, 0x7, 0x7, 0x3, 0x1, 0xf9, 0xf0, 0x60, 0x73, 0x77,
+    0x8c, 0x1c, 0x1c, 0x79, 0x87, 0x7, 0x7, 0x30, 0x0, 0x40, 0x0,
+
+    /* U+96B1 */
+    0x0, 0x0, 0xf, 0x7, 0xe7, 0xff, 0xf1, 0xfe, 0xff, 0x80, 0x39, 0xc8,
+    0x41, 0x86, 0x33, 0xc, 0x30, 0xc6, 0x20, 0x4, 0x18, 0xc7, 0xff, 0xc3,
+    0x30, 0xff, 0xf0, 0x66, 0x0, 0xc0, 0xd, 0x8f, 0xff, 0xf9, 0xb0, 0xff,
+    0xfe, 0x33, 0x0, 0x0, 0x6, 0x63, 0xff, 0xf0, 0xc6, 0x0, 0x6, 0x18,
+    0xcf, 0xff, 0xf3, 0x1b, 0xff, 0xfe, 0x63, 0x80, 0x3, 0xc, 0x63, 0xff,
+    0xe1, 0xbc, 0x7f, 0xfc, 0x37, 0x80, 0x0, 0x6, 0xc4, 0xcc, 0x10, 0xc1,
+    0x98, 0xcb, 0x18, 0x33, 0x3, 0x73, 0xe, 0x60, 0x66, 0x61, 0x8f, 0xfc,
+    0xcc, 0x0, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96C4 */
+    0x4, 0x0, 0x42, 0x0, 0xe0, 0x1c, 0x30, 0xe, 0x1, 0xc6, 0x0, 0xe0,
+    0x18, 0x60, 0xe, 0x3, 0x8e, 0x7, 0xff, 0x30, 0xe0, 0x7f, 0xf7, 0xff,
+    0xe0, 0xc0, 0x7f, 0xfe, 0xc, 0xf, 0x8c, 0x0, 0xc1, 0xf8, 0xc0, 0xc,
+    0x1b, 0x8c, 0x0, 0xcc, 0x38, 0xe0, 0x1c, 0xc3, 0xff, 0xc1, 0xdc, 0x3f,
+    0xfc, 0x1d, 0xc3, 0x8c, 0x1, 0x98, 0x38, 0xc0, 0x19, 0x83, 0x8c, 0x3,
+    0xb9, 0x3f, 0xfc, 0x33, 0xb3, 0xff, 0xc7, 0x31, 0xb8, 0xe0, 0x73, 0x1b,
+    0x8c, 0x6, 0x37, 0xf8, 0xc0, 0x67, 0xff, 0x8c, 0x1, 0xf8, 0xf8, 0xe0,
+    0x1c, 0x5, 0xff, 0xe0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96C5 */
+    0x0, 0x0, 0x82, 0x0, 0x0, 0x18, 0x70, 0x7f, 0xf3, 0x87, 0x3, 0xff,
+    0x38, 0x60, 0x0, 0xc7, 0xe, 0x1, 0x8c, 0x70, 0xc0, 0x18, 0xcf, 0xff,
+    0xe3, 0x8c, 0xff, 0xfe, 0x30, 0xdf, 0xc, 0x3, 0xd, 0x30, 0xc0, 0x30,
+    0xc3, 0xc, 0x3, 0xff, 0xb0, 0xe0, 0x7f, 0xfb, 0xff, 0xc7, 0x1c, 0x3f,
+    0xfc, 0x61, 0xc3, 0xc, 0x0, 0x3c, 0x30, 0xc0, 0x7, 0xc3, 0xc, 0x0,
+    0xec, 0x3f, 0xfc, 0x1c, 0xc3, 0xff, 0xc3, 0x8c, 0x30, 0xc0, 0x38, 0xc3,
+    0xc, 0x7, 0xc, 0x30, 0xc0, 0x60, 0xc3, 0xc, 0x0, 0xc, 0x38, 0xc0,
+    0x7, 0xc3, 0xff, 0xe0, 0x7c, 0x1f, 0xfe, 0x7, 0x0, 0x0, 0x0,
+
+    /* U+96C6 */
+    0x3, 0x0, 0x80, 0x0, 0x70, 0x18, 0x0, 0x6, 0x3, 0x80, 0x0, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0x83, 0xe0, 0x30, 0x0, 0x7f, 0xff, 0xff,
+    0x6, 0xff, 0xff, 0xf8, 0x4e, 0x3, 0x0, 0x0, 0xe0, 0x30, 0x0, 0xf,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0xe, 0x3, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0x7, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xfc, 0x0, 0x6, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1, 0xf8, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0xe, 0x6f, 0x0, 0x7, 0xc6, 0x3e, 0x3, 0xf0, 0x60, 0xfc,
+    0x7e, 0x6, 0x7, 0xe7, 0x0, 0x60, 0xe, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+96D9 */
+    0xc, 0x20, 0xc2, 0x0, 0xc6, 0x1c, 0x60, 0x1c, 0xe1, 0x86, 0x3, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe7, 0x8c, 0x78, 0xc0, 0x7f, 0xf5, 0xff,
+    0x81, 0xff, 0x9f, 0xfc, 0x18, 0xc1, 0x8c, 0x1, 0x8c, 0x18, 0xc0, 0x1f,
+    0xf9, 0xff, 0xc1, 0xff, 0x1f, 0xfc, 0x18, 0xc1, 0x8c, 0x1, 0xdc, 0x1c,
+    0xe0, 0x1f, 0xfd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xe0,
+    0x3c, 0x0, 0x7, 0x8f, 0x80, 0x0, 0x3f, 0xe0, 0x0, 0x3, 0xfe, 0x0,
+    0x1f, 0xff, 0xff, 0xc7, 0xfc, 0x3, 0xfe, 0x38, 0x0, 0x1, 0xe0,
+
+    /* U+96DC */
+    0x1, 0x80, 0x41, 0x0, 0x18, 0xe, 0x30, 0x1, 0x80, 0xc3, 0x3, 0xff,
+    0xdc, 0x70, 0x7f, 0xfd, 0x86, 0x0, 0x0, 0x38, 0x60, 0xc, 0x23, 0xff,
+    0xe0, 0xc6, 0x7f, 0xfe, 0x1c, 0x67, 0xc6, 0x3, 0xef, 0x58, 0x60, 0x33,
+    0xf9, 0x86, 0x6, 0x18, 0xdc, 0xfc, 0x0, 0x81, 0xff, 0xc0, 0x18, 0x1f,
+    0xe0, 0x1, 0x81, 0x86, 0x7, 0xff, 0xd8, 0x60, 0x3f, 0xfd, 0x86, 0x0,
+    0x38, 0x1f, 0xfc, 0x7, 0x81, 0xff, 0xc0, 0x7e, 0x1c, 0x60, 0xd, 0xb9,
+    0x86, 0x1, 0x99, 0x98, 0x60, 0x31, 0x89, 0x86, 0x7, 0x18, 0x1c, 0x60,
+    0x61, 0x81, 0xff, 0xe0, 0x18, 0xf, 0xfe, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+96DE */
+    0x0, 0x18, 0x41, 0x7, 0xff, 0x8e, 0x30, 0x7f, 0xf0, 0xc3, 0x0, 0x1,
+    0x9c, 0x70, 0x23, 0x19, 0x86, 0x3, 0x3b, 0xb8, 0x60, 0x31, 0x33, 0xff,
+    0xe0, 0x60, 0x7f, 0xfe, 0x6, 0x67, 0x86, 0x3, 0xce, 0xd8, 0x60, 0x3c,
+    0xc1, 0x86, 0x1, 0xf8, 0x1c, 0xfc, 0x7, 0x31, 0xff, 0xc0, 0x63, 0x1f,
+    0xe0, 0x7f, 0xf9, 0x86, 0x7, 0xf9, 0x98, 0x60, 0x1, 0x1, 0x86, 0x0,
+    0x18, 0x1f, 0xfc, 0x7f, 0xfd, 0xff, 0xc7, 0xff, 0xdc, 0xe0, 0x3, 0x1,
+    0x86, 0x0, 0x70, 0x18, 0x60, 0x6, 0xe1, 0x86, 0x1, 0xc7, 0x9c, 0x60,
+    0x78, 0x19, 0xff, 0xe7, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96E2 */
+    0x1, 0x80, 0x21, 0x0, 0x18, 0x6, 0x30, 0x3, 0x80, 0x63, 0x7, 0xff,
+    0xee, 0x30, 0x7f, 0xfc, 0xc7, 0x2, 0x2, 0xc, 0x60, 0x36, 0x6d, 0xff,
+    0xe3, 0x3c, 0xdf, 0xfe, 0x33, 0xcf, 0xc6, 0x3, 0x76, 0xfc, 0x60, 0x34,
+    0x2c, 0xc6, 0x3, 0x81, 0xce, 0x70, 0x3f, 0xf8, 0xff, 0xc0, 0x38, 0xf,
+    0xfc, 0x3, 0x80, 0xc6, 0x3, 0xff, 0xcc, 0x60, 0x3f, 0xfc, 0xc6, 0x7,
+    0x30, 0xef, 0xfc, 0x73, 0x6e, 0xff, 0xc7, 0x26, 0xee, 0x70, 0x7f, 0xfe,
+    0xc6, 0x7, 0xfb, 0xec, 0x60, 0x70, 0xe, 0xc6, 0x7, 0x0, 0xee, 0x60,
+    0x70, 0x3c, 0x7f, 0xe6, 0x7, 0xc7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96E3 */
+    0x8, 0x10, 0x41, 0x1, 0x83, 0xe, 0x30, 0x1c, 0x38, 0xc3, 0x7, 0xff,
+    0xcc, 0x70, 0x1c, 0x39, 0xc6, 0x1, 0xc3, 0x18, 0x60, 0xf, 0xf1, 0xff,
+    0xe0, 0x7e, 0x3f, 0xfe, 0x1, 0x83, 0xc6, 0x3, 0xff, 0xbc, 0x60, 0x3f,
+    0xfe, 0xc6, 0x3, 0x19, 0xcc, 0x70, 0x33, 0x98, 0xff, 0xe3, 0xff, 0x8f,
+    0xfc, 0x3, 0x80, 0xc6, 0x0, 0x38, 0xc, 0x60, 0x3f, 0xfc, 0xc6, 0x0,
+    0x30, 0xf, 0xfc, 0x3, 0x80, 0xff, 0xe7, 0xff, 0xef, 0xfc, 0x7, 0x0,
+    0xc6, 0x0, 0x78, 0xc, 0x60, 0xe, 0xe0, 0xc6, 0x1, 0xc7, 0x8c, 0x60,
+    0x78, 0x1c, 0xff, 0xe7, 0x0, 0x87, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96E8 */
+    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x60, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xfc, 0x38, 0xe, 0x1, 0xc3, 0x0, 0x60, 0xc, 0x30,
+    0x6, 0x0, 0xc3, 0x38, 0x67, 0xc, 0x31, 0xc6, 0x78, 0xc3, 0xe, 0x63,
+    0xcc, 0x30, 0x66, 0xc, 0xc3, 0x0, 0x60, 0xc, 0x30, 0x6, 0x0, 0xc3,
+    0x30, 0x66, 0xc, 0x33, 0xc6, 0x78, 0xc3, 0x1e, 0x63, 0x8c, 0x30, 0xe6,
+    0x1c, 0xc3, 0x0, 0x60, 0xc, 0x30, 0x6, 0x1, 0xc3, 0x0, 0x60, 0xfc,
+    0x30, 0x6, 0xf, 0xc3, 0x0, 0x0, 0x70,
+
+    /* U+96EA */
+    0x1f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x38, 0x0, 0x0, 0x6,
+    0x0, 0x3, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xb8, 0x3, 0x0, 0x77,
+    0x0, 0x60, 0x6, 0xef, 0xcc, 0xfc, 0xdc, 0x1, 0x80, 0x1b, 0x80, 0x30,
+    0x3, 0x27, 0xe6, 0x7e, 0x60, 0x78, 0xc7, 0x80, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0x1c, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0xe, 0x0, 0x0, 0x1, 0x80, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+96EF */
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x6, 0x0,
+    0xe7, 0x7e, 0x6f, 0xee, 0x77, 0xf6, 0xfe, 0xe7, 0x0, 0x60, 0xe, 0x67,
+    0xe6, 0x7c, 0x62, 0x7f, 0x4f, 0xe4, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60,
+    0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0x3, 0xc0, 0x38, 0x0,
+    0xc, 0x7, 0x0, 0x0, 0x70, 0xe0, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x1f,
+    0x80, 0x0, 0x1, 0xf8, 0x0, 0x3, 0xff, 0xf0, 0x3, 0xfe, 0x7, 0xfc,
+    0x7f, 0x0, 0xf, 0xe3, 0x0, 0x0, 0x4,
+
+    /* U+96F2 */
+    0x1f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x6, 0x0,
+    0xe6, 0x7f, 0x67, 0xe6, 0x67, 0xe6, 0x7e, 0x66, 0x0, 0x60, 0x6, 0x67,
+    0xe6, 0x7e, 0x62, 0x7f, 0x6f, 0xe4, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0xf, 0x0, 0x0, 0x0, 0xe0,
+    0xc, 0x0, 0xc, 0x0, 0xe0, 0x1, 0xc0, 0xf, 0x83, 0xff, 0xff, 0xfc,
+    0x3f, 0xff, 0xc0, 0xe0, 0x0, 0x0, 0x4,
+
+    /* U+96F7 */
+    0x1f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x38, 0x0, 0x0, 0x6,
+    0x0, 0x7, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xb8, 0x3, 0x0, 0x77,
+    0x3e, 0x67, 0xc6, 0xef, 0xed, 0xfc, 0xdc, 0x1, 0x80, 0x1b, 0x80, 0x30,
+    0x3, 0x27, 0xf6, 0xfe, 0x60, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x30, 0xc, 0x3, 0x6, 0x1, 0x80,
+    0x60, 0xe0, 0x38, 0xc, 0x1f, 0xff, 0xff, 0x83, 0x0, 0xc0, 0x30, 0x60,
+    0x18, 0x6, 0xe, 0x3, 0x0, 0xc1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xfe,
+    0x0,
+
+    /* U+96FB */
+    0x3f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x30, 0x0, 0xf, 0xff,
+    0xff, 0x7, 0xff, 0xff, 0xfd, 0xc0, 0x1c, 0x3, 0xb8, 0x3, 0x0, 0x37,
+    0x7f, 0x6f, 0xe6, 0xe0, 0xc, 0x0, 0xdc, 0xf9, 0x9f, 0x99, 0x3f, 0xb7,
+    0xf0, 0x0, 0x6, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xfe, 0xe,
+    0x3, 0x1, 0xc1, 0x80, 0x60, 0x18, 0x3f, 0xff, 0xff, 0x7, 0xff, 0xff,
+    0xe0, 0xc0, 0x30, 0xc, 0x1c, 0x6, 0x3, 0x81, 0xff, 0xff, 0xf0, 0x1f,
+    0xff, 0xf9, 0x80, 0x3, 0x0, 0x30, 0x0, 0x7f, 0xfe, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0,
+
+    /* U+9706 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x70, 0x6, 0x0,
+    0xe6, 0x7e, 0x6f, 0xe6, 0x60, 0x6, 0x0, 0x66, 0x7e, 0x6f, 0xe6, 0x7,
+    0xe6, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x3f, 0x83, 0xfc, 0xff,
+    0xf0, 0x3, 0x8f, 0xf0, 0x0, 0x70, 0x3, 0x0, 0xe, 0x7, 0xff, 0xc1,
+    0xfe, 0xff, 0xfe, 0x1f, 0xe0, 0x30, 0x0, 0x6, 0x3, 0x0, 0x18, 0xc0,
+    0x30, 0x1, 0xcc, 0x7f, 0xf8, 0xf, 0x87, 0xff, 0x0, 0x78, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xe7, 0x87, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+9716 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x60, 0x0, 0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfc, 0x70, 0x6, 0x0,
+    0xe6, 0x7e, 0x67, 0xe6, 0x67, 0xe6, 0xfe, 0x66, 0x0, 0x60, 0x6, 0x67,
+    0xe6, 0x7e, 0x60, 0x7e, 0x67, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x1,
+    0x80, 0x3, 0x80, 0x18, 0x7, 0xff, 0xbf, 0xfe, 0x7f, 0xfb, 0xff, 0xe0,
+    0x38, 0x3, 0xc0, 0x7, 0x80, 0x7e, 0x0, 0xfe, 0x7, 0xe0, 0x1f, 0xf0,
+    0xdb, 0x1, 0xb9, 0x19, 0x98, 0x33, 0x83, 0x19, 0xe6, 0x38, 0x61, 0x8e,
+    0x43, 0x8c, 0x18, 0x60, 0x38, 0x1, 0x80, 0x1, 0x0, 0x18, 0x0,
+
+    /* U+9732 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x60, 0x0, 0x1f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x60, 0x6, 0x0,
+    0xe6, 0x7f, 0x6f, 0xe6, 0x67, 0xe6, 0x7e, 0x66, 0x0, 0x60, 0x6, 0x67,
+    0xf6, 0xfe, 0x60, 0x0, 0x64, 0x0, 0x0, 0x0, 0xc0, 0x1, 0xff, 0x1f,
+    0xf8, 0x18, 0x33, 0xc3, 0x81, 0x83, 0xec, 0x70, 0x1f, 0xfc, 0x7c, 0x1,
+    0xff, 0x7, 0xc0, 0x1, 0x80, 0xff, 0x1, 0x98, 0x78, 0x3e, 0x19, 0xf7,
+    0x1, 0xe1, 0x9e, 0x1f, 0xf8, 0x19, 0x83, 0x81, 0x81, 0x9b, 0xb0, 0x18,
+    0x7f, 0xfb, 0x83, 0x87, 0xfc, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9738 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0xe0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x60, 0xe, 0x67, 0xe6, 0xfe,
+    0x66, 0x7e, 0x67, 0xe6, 0x67, 0xe6, 0x7e, 0x60, 0x7e, 0x6f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0xc1, 0x87, 0xf8, 0x7f, 0xfe, 0x7f, 0xc1, 0xc3, 0x8c,
+    0xc, 0xc, 0x38, 0xc0, 0xc0, 0xff, 0xf, 0xfc, 0x1, 0x80, 0xff, 0xc1,
+    0xff, 0xcc, 0xc, 0x39, 0xce, 0xc0, 0xc3, 0x18, 0xef, 0xfc, 0x3f, 0xfc,
+    0xff, 0xc0, 0x18, 0xc, 0xc, 0x3f, 0xfc, 0xc0, 0xc7, 0xff, 0xfc, 0xc,
+    0x1, 0x81, 0x80, 0xc0, 0x18, 0x30, 0x7c, 0x0, 0x80, 0x7, 0x80,
+
+    /* U+973E */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0x0, 0x60, 0xe, 0x67, 0xe6, 0xfe,
+    0x66, 0x7e, 0x67, 0xe6, 0x60, 0x6, 0x0, 0x62, 0x7f, 0x6f, 0xe4, 0x1,
+    0xc0, 0x0, 0x0, 0xfc, 0x3f, 0xf8, 0x7f, 0x7, 0xff, 0xc3, 0x9b, 0xe3,
+    0x8c, 0x18, 0xf7, 0xff, 0xc0, 0xfc, 0x7f, 0xfc, 0x3f, 0x86, 0x38, 0xc7,
+    0x9c, 0x73, 0x9c, 0x7, 0xe7, 0xff, 0xc1, 0xe6, 0x3, 0x80, 0x38, 0xe0,
+    0x38, 0x0, 0x3f, 0x7f, 0xfc, 0xf, 0x77, 0xff, 0xc7, 0xc6, 0x3, 0x80,
+    0x70, 0xe7, 0xff, 0xc0, 0x7c, 0xff, 0xfe, 0x7, 0x80, 0x0, 0x0,
+
+    /* U+9748 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0,
+    0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x60, 0x6, 0x0,
+    0xe6, 0x7e, 0x6f, 0xe6, 0x60, 0x6, 0x0, 0x66, 0x7e, 0x6f, 0xe6, 0x7,
+    0xe6, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x9f, 0x9f, 0xc3, 0x1b, 0xd,
+    0x8c, 0x31, 0xb0, 0xd8, 0xc3, 0xf9, 0xf9, 0xfc, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x10, 0x60, 0x80, 0x7, 0x6,
+    0x1c, 0x0, 0xfc, 0x67, 0xe0, 0x1c, 0xe6, 0xe3, 0x81, 0x2, 0x60, 0x8,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
+
+    /* U+9752 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xfc, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe0, 0x7, 0xff, 0xfe, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x0, 0x70, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70,
+    0xe, 0x0, 0x3e, 0x0, 0xe0, 0x7, 0xe0, 0x4, 0x0, 0x38, 0x0,
+
+    /* U+975C */
+    0x3, 0x0, 0x0, 0x80, 0x30, 0x1f, 0xfc, 0x3f, 0xf3, 0xff, 0x87, 0xff,
+    0x80, 0x0, 0x3, 0x1, 0x10, 0xc0, 0x30, 0x39, 0x9c, 0x3f, 0xf1, 0x99,
+    0x81, 0xfe, 0x19, 0x98, 0x3, 0x0, 0x80, 0x0, 0x38, 0x3f, 0xf0, 0x7f,
+    0xfb, 0xff, 0x80, 0x0, 0x3, 0x1c, 0x0, 0x0, 0x31, 0xc1, 0xff, 0x3,
+    0x1c, 0x3f, 0xf7, 0xff, 0xe3, 0x3, 0x7f, 0xfe, 0x3f, 0xf0, 0x31, 0xc3,
+    0xff, 0x3, 0x1c, 0x30, 0x30, 0x31, 0xc3, 0x3, 0x3f, 0xf8, 0x3f, 0xf3,
+    0xff, 0x3, 0xff, 0x3, 0x0, 0x30, 0x30, 0x30, 0x3, 0x3, 0x3, 0x0,
+    0x30, 0xf0, 0x70, 0x3, 0x1f, 0x1f, 0x0, 0x0, 0xc1, 0xc0, 0x0,
+
+    /* U+9762 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1,
+    0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x38, 0x0,
+    0x1, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc3, 0x86, 0x6, 0x1c, 0x30,
+    0x60, 0x60, 0xc3, 0x6, 0x6, 0xc, 0x30, 0x7f, 0xe0, 0xc3, 0x7, 0xfe,
+    0xc, 0x30, 0x60, 0x60, 0xc3, 0x6, 0x6, 0xc, 0x30, 0x60, 0x60, 0xc3,
+    0x7, 0xfe, 0xc, 0x30, 0x7f, 0xe0, 0xc3, 0x6, 0xe, 0xc, 0x30, 0x60,
+    0x60, 0xc3, 0x6, 0x6, 0xc, 0x38, 0x60, 0x61, 0xc3, 0xff, 0xff, 0xfc,
+    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+9769 */
+    0x1, 0x80, 0x18, 0x0, 0x18, 0x1, 0x80, 0x1, 0xc0, 0x38, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x18, 0x1, 0x80, 0x1, 0xc0, 0x38,
+    0x0, 0x1f, 0xff, 0x80, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x60,
+    0x38, 0x1c, 0x6, 0x3, 0x81, 0xc0, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff,
+    0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xf, 0x0, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+9774 */
+    0x8, 0x40, 0x48, 0x1, 0x86, 0xe, 0xc0, 0x18, 0x60, 0xcc, 0x7, 0xff,
+    0x8c, 0xc0, 0x7f, 0xf8, 0xcc, 0x1, 0xc6, 0x18, 0xc0, 0x18, 0x61, 0x8c,
+    0x1, 0xce, 0x18, 0xce, 0xf, 0xe3, 0x8d, 0xc0, 0x78, 0x38, 0xfc, 0x3,
+    0x7, 0x8f, 0x81, 0xff, 0x78, 0xe0, 0x3f, 0xf5, 0x8c, 0x3, 0x33, 0x18,
+    0xc0, 0x33, 0x31, 0x8c, 0x3, 0x33, 0x18, 0xc0, 0x3f, 0xf1, 0x8c, 0x3,
+    0xff, 0x18, 0xc0, 0x3, 0x1, 0x8c, 0x0, 0x30, 0x18, 0xc0, 0x7f, 0xf9,
+    0x8c, 0x27, 0xff, 0x98, 0xc6, 0x3, 0x1, 0x8c, 0x60, 0x30, 0x18, 0xce,
+    0x3, 0x1, 0x8f, 0xe0, 0x30, 0x18, 0xfc, 0x3, 0x0, 0x80, 0x0,
+
+    /* U+97D3 */
+    0x2, 0x0, 0x20, 0x0, 0x30, 0x6, 0x0, 0x3, 0x3, 0xfe, 0x7, 0xff,
+    0x3f, 0xf0, 0x7f, 0xf0, 0xe3, 0x80, 0x70, 0xc, 0x38, 0x3, 0x7, 0xff,
+    0xc1, 0xfc, 0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x3, 0x7, 0x0, 0x0, 0x30,
+    0x33, 0xff, 0x83, 0xff, 0x30, 0x1c, 0x3f, 0xf7, 0x1, 0xc3, 0x3, 0x3f,
+    0xf8, 0x30, 0x73, 0xff, 0x83, 0xfe, 0x0, 0xc0, 0x1f, 0xe0, 0x1c, 0x0,
+    0x30, 0x7f, 0xfc, 0x3, 0x7, 0xff, 0xc7, 0xff, 0x20, 0xc0, 0x7f, 0xf6,
+    0xc, 0x0, 0x70, 0x7f, 0xfe, 0x3, 0x7, 0xff, 0xe0, 0x30, 0xe0, 0xc0,
+    0x3, 0x4, 0xc, 0x0, 0x30, 0x0, 0xc0, 0x2, 0x0, 0x8, 0x0,
+
+    /* U+97F3 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc0, 0x18, 0x3, 0x80, 0x1, 0x80, 0x38,
+    0x0, 0x1c, 0x3, 0x80, 0x1, 0xc0, 0x30, 0x0, 0x1c, 0x7, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0,
+    0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+97F6 */
+    0x1, 0x0, 0x0, 0x0, 0x60, 0x3f, 0xe0, 0xc, 0xf, 0xff, 0x1f, 0xfd,
+    0xff, 0xf7, 0xff, 0x86, 0xe, 0x3f, 0xe0, 0xc1, 0xc6, 0x18, 0x18, 0x38,
+    0xc3, 0x3, 0x7, 0xc, 0x60, 0xe0, 0xcf, 0xff, 0x1c, 0x19, 0xff, 0xf7,
+    0x7, 0x0, 0x1, 0xc7, 0xc0, 0x0, 0x70, 0xf8, 0x1f, 0x84, 0x0, 0x7,
+    0xfc, 0x0, 0x1, 0xc3, 0x8f, 0xfe, 0x30, 0x33, 0xff, 0xc6, 0x6, 0x70,
+    0x38, 0xff, 0xcc, 0x3, 0x1f, 0xf9, 0x80, 0x63, 0x3, 0x30, 0xc, 0x60,
+    0x66, 0x1, 0x8c, 0xc, 0xc0, 0x31, 0xff, 0x9e, 0x1e, 0x1f, 0xf3, 0xff,
+    0xc0, 0x0, 0x1f, 0xf0,
+
+    /* U+97FB */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0xf, 0xf0, 0x3, 0x1, 0xff, 0x87, 0xff,
+    0x98, 0x1c, 0x7f, 0xf9, 0x81, 0xc1, 0x87, 0x18, 0x1c, 0x18, 0x61, 0xff,
+    0x81, 0x86, 0xf, 0xf8, 0xc, 0x60, 0x0, 0x7, 0xff, 0x8f, 0xf0, 0x7f,
+    0xfd, 0xff, 0xc0, 0x0, 0x38, 0xc, 0x0, 0x3, 0x0, 0xc1, 0xff, 0x3f,
+    0xfc, 0x3f, 0xf3, 0xff, 0xc3, 0x3, 0x30, 0xc, 0x30, 0x33, 0xff, 0xc3,
+    0x3, 0x3f, 0xfc, 0x3f, 0xf3, 0x0, 0xc3, 0xff, 0x30, 0xc, 0x30, 0x33,
+    0xff, 0xc3, 0x3, 0x1f, 0xf8, 0x38, 0x30, 0x42, 0x3, 0xff, 0x1c, 0x78,
+    0x1f, 0xe3, 0xc3, 0xc0, 0x0, 0xf0, 0xe, 0x0, 0x4, 0x0, 0x20,
+
+    /* U+97FF */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x60, 0x0, 0xc, 0x1f, 0x8f, 0xc1, 0xc3,
+    0xfd, 0xfe, 0x79, 0x30, 0xd8, 0xc7, 0x33, 0xfd, 0x88, 0x3e, 0x30, 0xd9,
+    0x80, 0xc3, 0xfd, 0x98, 0x8, 0xb0, 0x18, 0xc3, 0xfb, 0xfd, 0x86, 0x7f,
+    0xb0, 0x18, 0x60, 0x33, 0xfd, 0x9e, 0xe, 0x3f, 0xdb, 0xc3, 0xc2, 0x61,
+    0x80, 0x38, 0xe, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1, 0xc0, 0x30, 0x0,
+    0xc, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9805 */
+    0x0, 0xf, 0xff, 0xc0, 0x1, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xc7, 0xfe,
+    0x6, 0x0, 0x7f, 0xe0, 0x60, 0x0, 0x60, 0x3f, 0xf0, 0x6, 0x7, 0xff,
+    0x80, 0x60, 0xe0, 0x18, 0x6, 0xc, 0x1, 0x80, 0x60, 0xff, 0xf8, 0x6,
+    0xf, 0xff, 0x80, 0x60, 0xe0, 0x18, 0x6, 0xc, 0x1, 0x80, 0x60, 0xe0,
+    0x18, 0x6, 0xf, 0xff, 0x80, 0x60, 0xff, 0xf8, 0x6, 0xec, 0x1, 0x80,
+    0xfe, 0xe0, 0x18, 0x3f, 0x8f, 0xff, 0x87, 0xc0, 0x7f, 0xf8, 0x70, 0x1,
+    0x0, 0x0, 0x0, 0x70, 0xe0, 0x0, 0x1f, 0xf, 0x80, 0x7, 0xc0, 0x3e,
+    0x0, 0xf8, 0x1, 0xe0, 0x4, 0x0, 0x0,
+
+    /* U+980C */
+    0x3, 0x83, 0xff, 0xc0, 0x3c, 0x7f, 0xfe, 0x3, 0xe3, 0xff, 0xc0, 0x86,
+    0x3, 0x80, 0x18, 0x60, 0x30, 0x1, 0x86, 0xf, 0xf8, 0x18, 0x61, 0xff,
+    0xc3, 0x83, 0x38, 0x1c, 0x30, 0x33, 0x80, 0xc3, 0x3, 0xbf, 0xfc, 0x70,
+    0x3b, 0xff, 0xc7, 0x31, 0xf8, 0x1c, 0x67, 0x1f, 0x80, 0xc4, 0x60, 0x38,
+    0x1c, 0x6, 0x3, 0xff, 0xc0, 0x60, 0x3f, 0xfc, 0xe, 0x63, 0x0, 0xc0,
+    0xc7, 0x38, 0x1c, 0xc, 0x31, 0xff, 0xc0, 0xc3, 0x9f, 0xf8, 0x1f, 0xf8,
+    0x0, 0x7, 0xfd, 0x8c, 0x70, 0x78, 0xb, 0xc3, 0x80, 0x0, 0xf8, 0x1e,
+    0x0, 0xe, 0x0, 0xe0, 0x0, 0x80, 0x0,
+
+    /* U+9810 */
+    0x3f, 0xe3, 0xff, 0xc7, 0xff, 0x7f, 0xfe, 0x1f, 0xf3, 0xff, 0xc0, 0x6,
+    0x1, 0x80, 0x0, 0xe0, 0x38, 0x1, 0xdc, 0x1f, 0xf0, 0xf, 0x83, 0xff,
+    0xc0, 0x78, 0x30, 0x1c, 0x3, 0x83, 0x0, 0xc7, 0xff, 0x38, 0x1c, 0x7f,
+    0xfb, 0xff, 0xc0, 0x73, 0xb8, 0x1c, 0x3, 0x1b, 0x0, 0xc0, 0x33, 0xb0,
+    0xc, 0x3, 0x33, 0xff, 0xc0, 0x33, 0x3f, 0xfc, 0x3, 0x3, 0x0, 0xc0,
+    0x30, 0x30, 0xc, 0x3, 0x3, 0xff, 0xc0, 0x30, 0x1f, 0xf8, 0x3, 0x0,
+    0x0, 0x0, 0x30, 0xe, 0x70, 0x3, 0x3, 0xc3, 0x81, 0xf0, 0x78, 0x1e,
+    0x3e, 0xf, 0x0, 0xe1, 0x80, 0x80, 0x2,
+
+    /* U+9818 */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x3f, 0xfc, 0x7, 0x87, 0xff, 0xe0, 0x7c,
+    0x3f, 0xfc, 0xe, 0xf0, 0x38, 0x0, 0xc7, 0x83, 0x0, 0x1c, 0x38, 0xff,
+    0x83, 0x80, 0x9f, 0xfc, 0x78, 0x3, 0x81, 0xc7, 0xff, 0x30, 0xc, 0x4f,
+    0xf3, 0xff, 0xc0, 0x0, 0x3f, 0xfc, 0x0, 0x3, 0x81, 0xc7, 0xff, 0x30,
+    0xc, 0x7f, 0xfb, 0x81, 0xc0, 0x63, 0xbf, 0xfc, 0x6, 0x1b, 0xff, 0xc0,
+    0x61, 0xb0, 0xc, 0x6, 0x1b, 0x81, 0xc0, 0x61, 0xbf, 0xfc, 0x6, 0x79,
+    0xff, 0x80, 0x6f, 0x0, 0x0, 0x6, 0x40, 0xc7, 0x0, 0x60, 0x3c, 0x38,
+    0x6, 0xf, 0x81, 0xe0, 0x60, 0xe0, 0xe, 0x0, 0x8, 0x0, 0x20,
+
+    /* U+982D */
+    0x3f, 0xf3, 0xff, 0xe7, 0xff, 0xbf, 0xfe, 0x3f, 0xf0, 0x38, 0x0, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x30, 0x1, 0xff, 0x1f, 0xf8, 0x3f, 0xf3, 0xff,
+    0xc3, 0x3, 0xb8, 0xc, 0x30, 0x3b, 0x0, 0xc3, 0x3, 0xbf, 0xfc, 0x30,
+    0x3b, 0xff, 0xc3, 0x3, 0xb0, 0xc, 0x3f, 0xf3, 0x0, 0xc3, 0xff, 0x38,
+    0xc, 0x0, 0x3, 0xff, 0xc0, 0x2, 0x3f, 0xfc, 0x18, 0x63, 0x0, 0xc1,
+    0x86, 0x30, 0xc, 0x1c, 0x63, 0xff, 0xc0, 0xc6, 0x1f, 0xf8, 0x8, 0xfc,
+    0x0, 0x0, 0x3f, 0xce, 0x70, 0x7f, 0xf1, 0xe3, 0x87, 0xe0, 0x78, 0x1e,
+    0x40, 0xf, 0x0, 0xe0, 0x0, 0x40, 0x2,
+
+    /* U+984C */
+    0x1f, 0xe0, 0x0, 0x3, 0xff, 0xbf, 0xfe, 0x30, 0x3b, 0xff, 0xe3, 0x1,
+    0x81, 0x80, 0x3f, 0xf8, 0x18, 0x3, 0xff, 0x9f, 0xf8, 0x30, 0x19, 0xff,
+    0xc3, 0x3, 0x98, 0xc, 0x3f, 0xf9, 0xff, 0xc1, 0xfe, 0x1f, 0xfc, 0x0,
+    0x1, 0x80, 0xc7, 0xff, 0x98, 0xc, 0x7f, 0xfd, 0xff, 0xc0, 0x18, 0x1f,
+    0xfc, 0x1, 0x81, 0x80, 0xc1, 0x98, 0x18, 0xc, 0x19, 0xf9, 0xff, 0xc3,
+    0x9f, 0x8f, 0xf8, 0x39, 0x80, 0x42, 0x3, 0xd8, 0x1c, 0x38, 0x3f, 0x87,
+    0x81, 0xe7, 0x78, 0x70, 0x6, 0x63, 0xf4, 0x0, 0x6, 0xf, 0xff, 0xfe,
+    0x40, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+984D */
+    0x1, 0x0, 0x0, 0x0, 0x38, 0x1f, 0xfc, 0x3, 0x83, 0xff, 0xe1, 0xff,
+    0x9f, 0xfc, 0x7f, 0xfc, 0x38, 0x7, 0x1, 0xc3, 0x80, 0x66, 0xc, 0xff,
+    0x86, 0xe0, 0xdf, 0xfc, 0x2f, 0xf1, 0xc1, 0xc1, 0xff, 0x18, 0xc, 0x38,
+    0x61, 0xff, 0xc7, 0x4e, 0x1f, 0xfc, 0x6f, 0xc1, 0x81, 0xc0, 0x3c, 0x18,
+    0xc, 0x7, 0xe1, 0x80, 0xc0, 0xe7, 0x9f, 0xfc, 0x3c, 0x1d, 0xff, 0xc7,
+    0x80, 0x18, 0xc, 0x7f, 0xf1, 0x81, 0xc1, 0xc7, 0x9f, 0xfc, 0x18, 0x18,
+    0xff, 0x81, 0x81, 0x80, 0x0, 0x1c, 0x38, 0xe7, 0x1, 0xff, 0x3c, 0x38,
+    0xf, 0xf7, 0x81, 0xc0, 0x0, 0xf0, 0xe, 0x0, 0x4, 0x0, 0x20,
+
+    /* U+984F */
+    0x1, 0x0, 0x0, 0x0, 0x18, 0x1f, 0xfc, 0x3, 0x83, 0xff, 0xe7, 0xff,
+    0xdf, 0xfc, 0x3f, 0xf8, 0x18, 0x1, 0xc3, 0x3, 0x0, 0xf, 0xe0, 0xff,
+    0x80, 0x7e, 0x1f, 0xfc, 0x1e, 0x79, 0x81, 0xc1, 0x1, 0x18, 0xc, 0x3f,
+    0xfd, 0xff, 0xc3, 0xff, 0xdf, 0xfc, 0x30, 0x1, 0x80, 0xc3, 0xf, 0x18,
+    0xc, 0x33, 0xe1, 0x81, 0xc3, 0x78, 0x1f, 0xfc, 0x34, 0x31, 0xff, 0xc3,
+    0xf, 0x18, 0xc, 0x31, 0xe1, 0x81, 0xc7, 0x78, 0x1f, 0xfc, 0x66, 0x1c,
+    0xff, 0x86, 0x3, 0x80, 0x0, 0x60, 0xf0, 0xe7, 0x6, 0x3c, 0x3c, 0x38,
+    0x6f, 0xf, 0x81, 0xe4, 0xc0, 0xe0, 0xe, 0x0, 0x8, 0x0, 0x20,
+
+    /* U+9858 */
+    0xf, 0xfc, 0xff, 0xc3, 0xff, 0xef, 0xfe, 0x38, 0xf0, 0x1e, 0x3, 0x6,
+    0x1, 0xc0, 0x30, 0x60, 0x18, 0x3, 0x1f, 0x87, 0xf8, 0x33, 0xfc, 0xff,
+    0xc3, 0x70, 0xee, 0xc, 0x36, 0x6, 0xc0, 0xc3, 0x70, 0xef, 0xfc, 0x37,
+    0xfe, 0xff, 0xc3, 0x70, 0xec, 0xc, 0x36, 0x6, 0xc0, 0xc3, 0x70, 0xec,
+    0xc, 0x33, 0xfc, 0xff, 0xc3, 0x1f, 0x8f, 0xfc, 0x30, 0x60, 0xc0, 0xc3,
+    0x26, 0x4c, 0xc, 0x73, 0x64, 0xff, 0xc7, 0x66, 0x67, 0xfc, 0x66, 0x66,
+    0x0, 0x6, 0xe6, 0x27, 0x30, 0x6c, 0x60, 0xe3, 0xc6, 0x1e, 0x3c, 0x1e,
+    0x1, 0xe7, 0x80, 0xe0, 0x18, 0x20, 0x0,
+
+    /* U+985E */
+    0x3, 0x0, 0x0, 0x2, 0x30, 0x1f, 0xfc, 0x33, 0x1b, 0xff, 0xe3, 0x33,
+    0x1f, 0xfc, 0x13, 0x30, 0x18, 0x3, 0xff, 0x81, 0x80, 0x7f, 0xfc, 0xff,
+    0x83, 0xff, 0x9f, 0xfc, 0xf, 0x1, 0x81, 0xc1, 0xfc, 0x18, 0xc, 0x3b,
+    0xf1, 0xff, 0xc7, 0x33, 0x9f, 0xfc, 0x73, 0x19, 0x80, 0xc4, 0x30, 0x18,
+    0xc, 0x0, 0x31, 0x81, 0xc0, 0x33, 0x9f, 0xfc, 0x3, 0x1, 0xff, 0xc7,
+    0xff, 0xd8, 0xc, 0x7f, 0xfd, 0x81, 0xc0, 0x70, 0x1f, 0xfc, 0x7, 0x0,
+    0xff, 0x80, 0xfe, 0x0, 0x0, 0x1c, 0xf0, 0xe7, 0x3, 0xc3, 0xbc, 0x38,
+    0x78, 0x7, 0x81, 0xe6, 0x0, 0xf0, 0xe, 0x0, 0x4, 0x0, 0x20,
+
+    /* U+9867 */
+    0x3f, 0xfc, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1c, 0x0, 0x0,
+    0x1, 0xc0, 0x1f, 0xfc, 0x18, 0x3, 0xff, 0xc7, 0xf8, 0x30, 0xc, 0xff,
+    0xc3, 0x0, 0xcc, 0xc, 0x3f, 0xfc, 0xc0, 0xc3, 0x31, 0xf, 0xfc, 0x33,
+    0x30, 0xff, 0xc3, 0x63, 0xc, 0xc, 0x37, 0xfc, 0xc0, 0xc3, 0xff, 0xcc,
+    0xc, 0x3e, 0x20, 0xff, 0xc3, 0xe6, 0xf, 0xfc, 0x37, 0xfc, 0xc0, 0xc3,
+    0x77, 0xc, 0xc, 0x36, 0x20, 0xff, 0xc7, 0x7f, 0x87, 0xfc, 0x67, 0xfc,
+    0x2, 0x6, 0x66, 0x3, 0x38, 0x66, 0x20, 0xf3, 0xc6, 0x77, 0x1e, 0x1e,
+    0x63, 0xfd, 0x80, 0xe4, 0x0, 0x0, 0x0,
+
+    /* U+986F */
+    0xf, 0xf8, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x30, 0x6, 0x1e, 0x3, 0x0,
+    0x60, 0xc0, 0x3f, 0xfe, 0xc, 0x3, 0x0, 0xe7, 0xf8, 0x30, 0x6, 0x7f,
+    0xc3, 0xff, 0xee, 0xc, 0x1f, 0xf8, 0xc0, 0xc1, 0x83, 0xf, 0xfc, 0x1a,
+    0x36, 0xff, 0xc7, 0x7e, 0x6c, 0xc, 0x76, 0xec, 0xc0, 0xc3, 0xc7, 0xcc,
+    0xc, 0x1c, 0x3a, 0xff, 0xc1, 0xb3, 0x6f, 0xfc, 0x1b, 0x3f, 0xc0, 0xc7,
+    0xff, 0xfc, 0xc, 0x7d, 0xe1, 0xff, 0xc0, 0x0, 0x47, 0xfc, 0x36, 0x66,
+    0x2, 0x3, 0x66, 0x67, 0x38, 0x63, 0x32, 0xe3, 0xc6, 0x33, 0x1c, 0x1e,
+    0x60, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+98A8 */
+    0x3, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0x1, 0xc0,
+    0x0, 0x70, 0x18, 0x0, 0xf3, 0x1, 0x9f, 0xff, 0x30, 0x1b, 0xff, 0xc3,
+    0x1, 0x80, 0xe0, 0x30, 0x18, 0xe, 0x3, 0x1, 0x8f, 0xfe, 0x30, 0x19,
+    0xff, 0xf3, 0x1, 0x9c, 0xe7, 0x30, 0x19, 0x8e, 0x33, 0x1, 0x98, 0xe3,
+    0x30, 0x19, 0x8e, 0x33, 0x1, 0x9c, 0xe7, 0x30, 0x19, 0xff, 0xf3, 0x1,
+    0x8f, 0xfe, 0x30, 0x38, 0xe, 0x23, 0x23, 0x0, 0xe7, 0x32, 0x30, 0xe,
+    0x33, 0xa3, 0x0, 0xff, 0x9a, 0x73, 0xff, 0xfd, 0xe6, 0x7f, 0xc0, 0xde,
+    0x60, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+98DB */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x18, 0x3f, 0xff, 0xf3, 0x81, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc3, 0x20, 0x3, 0xec, 0x33,
+    0x87, 0xfc, 0xc1, 0x98, 0x7f, 0xc, 0x18, 0x0, 0x30, 0xc1, 0xc6, 0x3,
+    0xc, 0xe, 0x60, 0x30, 0xc0, 0x7e, 0x7, 0xe, 0x3, 0xc7, 0xff, 0xff,
+    0x0, 0x7f, 0xff, 0xf3, 0x0, 0x30, 0xc3, 0x70, 0x7, 0xc, 0x34, 0x0,
+    0x70, 0xc3, 0x20, 0x6, 0xc, 0x3b, 0x80, 0x60, 0xc3, 0x98, 0x6, 0xc,
+    0x18, 0x80, 0xe0, 0xc1, 0x86, 0x1c, 0xc, 0x1c, 0x63, 0x80, 0xc0, 0xe6,
+    0x78, 0xc, 0x7, 0xe7, 0x0, 0xc0, 0x3c, 0x60, 0x4, 0x0, 0x80,
+
+    /* U+98DF */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x0, 0x3,
+    0xf8, 0x0, 0x0, 0x7b, 0xc0, 0x0, 0xe, 0xf, 0x0, 0x7, 0xc6, 0x3e,
+    0x1, 0xf0, 0xe1, 0xfc, 0x7e, 0xe, 0x7, 0xe7, 0xbf, 0xff, 0xde, 0x7,
+    0xff, 0xfe, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0, 0x7f, 0xff,
+    0xe0, 0x7, 0xff, 0xfe, 0x0, 0x60, 0x0, 0x60, 0x6, 0x0, 0x6, 0x0,
+    0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x80, 0x60, 0x70, 0x1c, 0x6, 0x3,
+    0x7, 0x80, 0x60, 0x19, 0xe0, 0x6, 0x1, 0xf8, 0x0, 0x60, 0x4f, 0x0,
+    0x7, 0xfe, 0x3e, 0x3, 0xff, 0xc1, 0xfc, 0x7f, 0x80, 0x7, 0xe2, 0x0,
+    0x0, 0x6,
+
+    /* U+98EF */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x78,
+    0x1f, 0xfe, 0xe, 0xe3, 0xff, 0xe1, 0xc7, 0x30, 0x0, 0x38, 0x33, 0x0,
+    0x3, 0xfd, 0x30, 0x0, 0x7f, 0xc3, 0x0, 0x6, 0x0, 0x3f, 0xf8, 0xf,
+    0xc3, 0xff, 0xc1, 0xfe, 0x30, 0x1c, 0x18, 0x63, 0x0, 0xc1, 0x86, 0x36,
+    0xc, 0x1f, 0xe3, 0x60, 0xc1, 0xfe, 0x37, 0x1c, 0x18, 0x63, 0x31, 0x81,
+    0xfe, 0x73, 0x38, 0x1f, 0xe7, 0x3b, 0x1, 0x80, 0x61, 0xb0, 0x18, 0x6,
+    0x1e, 0x1, 0xfc, 0x60, 0xe0, 0x1f, 0xce, 0x1e, 0x1, 0x80, 0xc3, 0xf8,
+    0x1f, 0xdc, 0x7b, 0xc1, 0xfd, 0x8e, 0x1e, 0x18, 0x19, 0xc0, 0xe1, 0x0,
+    0x0, 0x0,
+
+    /* U+98F2 */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x4, 0x0, 0x3, 0x80, 0x60, 0x0, 0x7c,
+    0xe, 0x0, 0xe, 0xe0, 0xc0, 0x1, 0xc7, 0xc, 0x0, 0x38, 0x39, 0xff,
+    0xc7, 0xfc, 0x1f, 0xfe, 0x7f, 0xe1, 0x80, 0xe6, 0x0, 0x31, 0xe, 0xf,
+    0xc3, 0x18, 0xc1, 0xff, 0x73, 0x9c, 0x18, 0x76, 0x39, 0x81, 0x87, 0x3,
+    0x18, 0x1f, 0xf0, 0x38, 0x1, 0xff, 0x3, 0x80, 0x18, 0x70, 0x38, 0x1,
+    0xff, 0x3, 0x80, 0x1f, 0xe0, 0x7c, 0x1, 0x80, 0x6, 0xc0, 0x18, 0x0,
+    0x66, 0x1, 0xff, 0xe, 0x70, 0x1f, 0xe0, 0xc3, 0x1, 0x80, 0x1c, 0x38,
+    0x1f, 0xe3, 0x81, 0xc1, 0xff, 0xf0, 0xe, 0x18, 0xe, 0x0, 0x61, 0x0,
+    0x80, 0x0,
+
+    /* U+990A */
+    0x0, 0x80, 0x30, 0x0, 0xc, 0x7, 0x0, 0x0, 0xe0, 0x70, 0x3, 0xff,
+    0xff, 0xfc, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff,
+    0x80, 0x0, 0xe0, 0x0, 0x0, 0x6, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xc0, 0x38, 0x61, 0x80, 0x7, 0x6, 0xe, 0x1, 0xff, 0xff,
+    0xf8, 0x7f, 0xff, 0xff, 0xe7, 0x70, 0x0, 0xee, 0x7, 0xff, 0xfe, 0x0,
+    0x7f, 0xff, 0xe0, 0x7, 0x0, 0xe, 0x0, 0x7f, 0xff, 0xc0, 0x7, 0xff,
+    0xf9, 0x80, 0x70, 0x30, 0x78, 0x7, 0x1, 0x9e, 0x0, 0x70, 0xcf, 0x80,
+    0xf, 0xfe, 0x7f, 0x87, 0xff, 0x0, 0xfe, 0x38, 0x0, 0x1, 0xe0,
+
+    /* U+9910 */
+    0x0, 0x80, 0x0, 0x0, 0x1f, 0x8f, 0xf8, 0x1, 0xfd, 0xff, 0xc0, 0xdc,
+    0x0, 0x1c, 0x1f, 0xf0, 0x1, 0x83, 0xff, 0x8e, 0x30, 0x30, 0x38, 0x7e,
+    0x6, 0xc7, 0x3, 0xe0, 0x7, 0xe6, 0x7f, 0x80, 0x3c, 0xee, 0x3c, 0x1f,
+    0x3f, 0xc0, 0xc7, 0xc7, 0x1f, 0x0, 0x63, 0xc2, 0x3f, 0x1, 0xf0, 0x60,
+    0xfe, 0x7f, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0xe0, 0x3, 0x0, 0x6, 0x0,
+    0x3f, 0xff, 0xe0, 0x3, 0xff, 0xfe, 0x0, 0x30, 0x0, 0x60, 0x3, 0xff,
+    0xfe, 0x0, 0x30, 0x70, 0x1c, 0x3, 0x3, 0x9f, 0x80, 0x30, 0x1f, 0xc0,
+    0x7, 0xfe, 0x7f, 0x3, 0xff, 0xc1, 0xfe, 0x3e, 0x0, 0x1, 0xe0,
+
+    /* U+9928 */
+    0x1, 0x80, 0x10, 0x0, 0x70, 0x3, 0x0, 0x1f, 0x0, 0xe0, 0x3, 0x70,
+    0x1c, 0x0, 0xe7, 0x3f, 0xfc, 0x38, 0x7f, 0xff, 0xcf, 0xfb, 0x80, 0x1b,
+    0xbf, 0x30, 0x3, 0x60, 0x6, 0xfe, 0x61, 0xfc, 0x3f, 0xf8, 0x7f, 0xc7,
+    0xe, 0xc, 0x18, 0xc0, 0xc1, 0x83, 0x18, 0x18, 0x3f, 0xe3, 0x7, 0x7,
+    0xfc, 0x7f, 0xe0, 0xc1, 0x8f, 0xf8, 0x1f, 0xf1, 0x80, 0x3, 0xfe, 0x30,
+    0x0, 0x60, 0x7, 0xfe, 0xc, 0x0, 0xff, 0xe1, 0xff, 0x18, 0xc, 0x3f,
+    0xc3, 0x1, 0x86, 0x0, 0x60, 0x30, 0xff, 0x8e, 0xe, 0x1f, 0xf1, 0xff,
+    0xc3, 0x0, 0x1f, 0xf0, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+9935 */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x7, 0x7, 0xff, 0x80, 0x78,
+    0x7f, 0xfc, 0xf, 0xc6, 0x31, 0xc1, 0xce, 0x63, 0xc, 0x38, 0x67, 0xff,
+    0xc7, 0xfa, 0x7f, 0xfc, 0x6f, 0x86, 0x31, 0xc4, 0x0, 0x63, 0xc, 0x1f,
+    0xc6, 0x31, 0xc1, 0xfe, 0x7f, 0xfc, 0x38, 0x67, 0xff, 0x83, 0x8e, 0x0,
+    0x0, 0x3f, 0xe0, 0x0, 0x3, 0x8f, 0xff, 0xfe, 0x38, 0x6f, 0xff, 0xe3,
+    0xfe, 0x31, 0x80, 0x3f, 0xc3, 0x18, 0x43, 0x80, 0x31, 0x9c, 0x3f, 0xc3,
+    0xf, 0x83, 0xfe, 0x30, 0xf0, 0x38, 0x3, 0x6, 0x3, 0x80, 0x31, 0x70,
+    0x3f, 0xe3, 0xf3, 0xc3, 0xfe, 0xfe, 0x1e, 0x30, 0x1f, 0x0, 0xe1, 0x0,
+    0x80, 0x0,
+
+    /* U+9957 */
+    0x4, 0x4, 0x0, 0x0, 0xc0, 0xf1, 0xfc, 0x18, 0x7f, 0xd8, 0xc7, 0x37,
+    0xd, 0x8c, 0x77, 0x7f, 0xd9, 0x83, 0xe6, 0xd, 0x98, 0x1d, 0xff, 0x99,
+    0x81, 0x9e, 0x1, 0x8c, 0x3f, 0x7f, 0xd8, 0x67, 0xf6, 0x1, 0x8e, 0x7,
+    0x7f, 0xdb, 0xc1, 0xe6, 0x61, 0xb8, 0x78, 0x3f, 0x18, 0x7, 0x7, 0xbc,
+    0x0, 0x3, 0xe0, 0xfc, 0x3, 0xf0, 0x61, 0xfc, 0x7f, 0xff, 0xff, 0xe4,
+    0x7f, 0xff, 0xe0, 0x6, 0x0, 0x6, 0x0, 0x7f, 0xff, 0xe0, 0x6, 0x0,
+    0x6, 0x0, 0x7f, 0xff, 0xe0, 0x6, 0x7, 0x1, 0xc0, 0x60, 0x39, 0xf8,
+    0x6, 0x7c, 0xfc, 0x7, 0xff, 0xc3, 0xfe, 0x3c, 0x0, 0x0, 0xe0,
+
+    /* U+9996 */
+    0x1, 0x80, 0x10, 0x0, 0x18, 0x3, 0x0, 0x1, 0xc0, 0x70, 0x0, 0xc,
+    0x7, 0x0, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xc, 0x0, 0x3, 0x0,
+    0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc0, 0x0, 0x30, 0xc, 0x0, 0x3, 0x0, 0xe0, 0x0, 0x70,
+    0xf, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0,
+
+    /* U+9999 */
+    0x0, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x1, 0xf8,
+    0xe0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x7f, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0x80, 0x0, 0x7, 0xee, 0x0, 0x0,
+    0xe6, 0x70, 0x0, 0x38, 0x63, 0xe0, 0x1f, 0x6, 0xf, 0xc7, 0xc0, 0x40,
+    0x7e, 0x77, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xe0, 0xe, 0x0, 0x7, 0x0,
+    0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xe0, 0x0, 0x70, 0xe, 0x0, 0x7, 0x0, 0xe0, 0x0, 0x70,
+    0x7, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+99AC */
+    0x7, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x38, 0x1c, 0x0, 0xe, 0x3,
+    0x80, 0x1, 0xc0, 0x70, 0x0, 0x3f, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xc0,
+    0xe0, 0x38, 0x0, 0x1c, 0x7, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x7f, 0xff,
+    0xfc, 0xe, 0x3, 0x80, 0x1, 0xc0, 0x70, 0x0, 0x18, 0xe, 0x0, 0x3,
+    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xe2, 0x0, 0x2,
+    0x18, 0xc6, 0x18, 0xc3, 0x18, 0xe3, 0xc, 0x63, 0xc, 0x71, 0x8c, 0xe1,
+    0x86, 0x11, 0x9c, 0x30, 0xc0, 0x73, 0x2, 0x0, 0xfc, 0x40, 0x0, 0x3f,
+    0x80, 0x0, 0x3, 0xc0,
+
+    /* U+99B3 */
+    0x0, 0x0, 0x8, 0x0, 0xff, 0x81, 0x80, 0x3f, 0xf8, 0x18, 0x3, 0x18,
+    0x11, 0x80, 0x31, 0x83, 0x98, 0x3, 0x38, 0x39, 0x80, 0x3f, 0xf3, 0x98,
+    0xc3, 0xfe, 0x39, 0xfc, 0x31, 0x83, 0xbf, 0xe3, 0x18, 0x3f, 0xce, 0x3f,
+    0xf7, 0xf8, 0x63, 0xff, 0xf9, 0x86, 0x31, 0x83, 0x98, 0x63, 0x18, 0x39,
+    0x86, 0x3f, 0xe3, 0x98, 0x63, 0xff, 0x39, 0x8e, 0x0, 0x3b, 0x99, 0xc0,
+    0x9, 0xb9, 0xbc, 0x6b, 0xdb, 0x9b, 0x6, 0xb7, 0x39, 0x80, 0x6b, 0x73,
+    0x98, 0x66, 0xd3, 0x38, 0x6, 0x68, 0x33, 0x80, 0x64, 0x3, 0x38, 0xe,
+    0x1, 0xf1, 0xff, 0xe0, 0x1e, 0xf, 0xf8, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+99D0 */
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x6, 0x0, 0x3f, 0xf8, 0x78, 0x3, 0x98,
+    0x3, 0x80, 0x31, 0x80, 0x8, 0x3, 0x38, 0x0, 0x0, 0x3f, 0xf7, 0xff,
+    0xe3, 0xfe, 0x7f, 0xfc, 0x31, 0x80, 0x18, 0x3, 0x18, 0x1, 0x80, 0x3f,
+    0xf0, 0x18, 0x3, 0xff, 0x1, 0x80, 0x31, 0x80, 0x18, 0x3, 0x18, 0x1,
+    0x80, 0x3f, 0xe3, 0xff, 0x83, 0xff, 0x3f, 0xf8, 0x0, 0x38, 0x38, 0x0,
+    0x1, 0x81, 0x80, 0x6a, 0xd8, 0x18, 0x6, 0xb7, 0x1, 0x80, 0x6b, 0x70,
+    0x18, 0x6, 0xd3, 0x1, 0x80, 0x68, 0x30, 0x18, 0x4, 0x3, 0x3, 0x80,
+    0x1, 0xff, 0xff, 0xe0, 0x1e, 0x7f, 0xfe, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+99D5 */
+    0x3, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1, 0xff, 0xe3, 0xff, 0x3f, 0xfe,
+    0x7f, 0xe0, 0x61, 0xdc, 0xc, 0xc, 0x1b, 0x81, 0x83, 0x3, 0x70, 0x30,
+    0xe0, 0xe7, 0xfe, 0x38, 0xf8, 0xff, 0xce, 0x1e, 0x0, 0x1, 0x9f, 0xff,
+    0xfc, 0x7, 0xff, 0xff, 0xc1, 0xc0, 0x60, 0x0, 0x3f, 0xff, 0xfc, 0x7,
+    0xff, 0xff, 0xc0, 0xe0, 0x30, 0x0, 0x1c, 0x7, 0x0, 0x3, 0xff, 0xff,
+    0xe0, 0x70, 0x1c, 0x0, 0x6, 0x3, 0x80, 0x0, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x1, 0xcc, 0x21, 0xc, 0x39, 0x8e, 0x31, 0x86, 0x70, 0xc7, 0x19,
+    0xcc, 0x18, 0x40, 0xf8, 0x0, 0x0, 0x1e, 0x0,
+
+    /* U+9A55 */
+    0x0, 0x0, 0x1, 0x81, 0xfe, 0x7f, 0xfc, 0x3f, 0xef, 0xfe, 0x3, 0x30,
+    0x6, 0x0, 0x33, 0x0, 0x60, 0x3, 0x31, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xe3, 0xfc, 0x18, 0xe0, 0x33, 0x3, 0x6, 0x3, 0x30, 0x7f, 0xf0, 0x3f,
+    0xef, 0xff, 0xc3, 0xff, 0xf0, 0x7e, 0x33, 0x1b, 0x6, 0x63, 0x30, 0x3f,
+    0xe0, 0x3f, 0x80, 0xfc, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
+    0x6, 0xff, 0xfc, 0x4a, 0xec, 0x0, 0xc7, 0xae, 0xcf, 0xcc, 0x6b, 0xec,
+    0xfc, 0xc6, 0xb6, 0xd8, 0x6c, 0x68, 0x6d, 0xce, 0xc4, 0xe, 0xcf, 0xcc,
+    0x3, 0xcc, 0x79, 0xc0, 0x7c, 0xc0, 0x3c, 0x2, 0xc, 0x3, 0x80,
+
+    /* U+9A57 */
+    0x0, 0x0, 0x30, 0x1, 0xff, 0x7, 0x0, 0x3f, 0xf0, 0x78, 0x3, 0x38,
+    0xf, 0xc0, 0x31, 0x0, 0xcc, 0x3, 0x38, 0x18, 0x60, 0x3f, 0xf3, 0x83,
+    0x83, 0xfe, 0x70, 0x3c, 0x31, 0xf, 0xff, 0xe3, 0x10, 0xcf, 0xe6, 0x3f,
+    0xf8, 0x0, 0x3, 0xff, 0x18, 0x30, 0x31, 0x7, 0xcf, 0xc3, 0x10, 0x7e,
+    0xdc, 0x3f, 0xc6, 0x6c, 0xc3, 0xff, 0x66, 0xcc, 0x0, 0x76, 0x6c, 0xc0,
+    0xb, 0x7e, 0xfc, 0x2a, 0xf7, 0xcf, 0x86, 0xbf, 0x18, 0x70, 0x6b, 0x71,
+    0x86, 0x6, 0xf3, 0x3c, 0x60, 0x68, 0x33, 0xef, 0x84, 0x6, 0x67, 0xdc,
+    0x1, 0xee, 0x18, 0xe0, 0x3e, 0xc3, 0x6, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+9AD4 */
+    0x0, 0x0, 0x44, 0x1, 0xfc, 0x6, 0x40, 0x1f, 0xe0, 0xee, 0x3, 0x86,
+    0x7f, 0xfc, 0x30, 0x67, 0xee, 0xc3, 0x3e, 0x66, 0x4c, 0x33, 0xe7, 0xff,
+    0xc3, 0x36, 0x7f, 0xfc, 0x33, 0x66, 0x64, 0xc7, 0xff, 0x66, 0x4c, 0x7f,
+    0xff, 0xff, 0xc6, 0x1, 0xbf, 0xfc, 0x67, 0x98, 0x0, 0x7, 0xff, 0x7f,
+    0xfc, 0x1c, 0xe7, 0xff, 0xe1, 0x86, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x1,
+    0xfe, 0x3f, 0xfc, 0x18, 0x67, 0x1, 0xc1, 0x86, 0x60, 0xc, 0x1f, 0xe7,
+    0xff, 0xc1, 0xfe, 0x3f, 0xf8, 0x18, 0x61, 0xc3, 0x1, 0x86, 0xc, 0x60,
+    0x18, 0xe7, 0xff, 0xc1, 0x9c, 0xff, 0xfe, 0x19, 0x80, 0x0, 0x0,
+
+    /* U+9AD8 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0x0, 0x70, 0x0, 0xe0, 0x7,
+    0x0, 0xe, 0x0, 0x7f, 0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xfc, 0x38, 0x0, 0x1, 0xc3,
+    0x0, 0x0, 0xc, 0x30, 0xff, 0xf0, 0xc3, 0x1f, 0xff, 0x8c, 0x31, 0xc0,
+    0x38, 0xc3, 0x1c, 0x3, 0x8c, 0x31, 0xff, 0xf8, 0xc3, 0xf, 0xff, 0xc,
+    0x30, 0x0, 0x7, 0xc3, 0x0, 0x0, 0xfc, 0x30, 0x0, 0x7, 0x0,
+
+    /* U+9AEE */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x78, 0x1c, 0x0, 0x1f, 0x1, 0xff,
+    0x8f, 0xc0, 0x1f, 0xf9, 0xe0, 0x1, 0xc0, 0x0, 0x38, 0x1f, 0xfc, 0x1f,
+    0x1, 0xc0, 0xf, 0xc0, 0x7f, 0xfe, 0xe0, 0xe7, 0xff, 0xe0, 0x3c, 0xc,
+    0x18, 0x1f, 0x80, 0xc7, 0xcf, 0xc0, 0x7f, 0xff, 0xe0, 0x7, 0xc0, 0x0,
+    0x80, 0x0, 0x18, 0xc, 0x0, 0x3, 0x80, 0x40, 0x7f, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xfe, 0x0, 0xf0, 0x0, 0x0, 0x1f, 0x81, 0x80, 0x7, 0x9c,
+    0x78, 0x0, 0xe0, 0xee, 0x0, 0x3c, 0x7, 0xc0, 0x7, 0x81, 0xff, 0x0,
+    0x61, 0xfc, 0x7f, 0xc0, 0x7f, 0x0, 0xfe, 0x7, 0x0, 0x0, 0xe0,
+
+    /* U+9B25 */
+    0x60, 0x0, 0x0, 0x9b, 0xfc, 0xff, 0x66, 0xff, 0x3f, 0xd9, 0x86, 0x1,
+    0x86, 0x61, 0x80, 0x61, 0x98, 0x60, 0x18, 0x66, 0x7f, 0x3f, 0x99, 0x9f,
+    0x87, 0xe6, 0x61, 0x80, 0x61, 0x98, 0x60, 0x18, 0x66, 0x1c, 0xe, 0x19,
+    0xbf, 0xdf, 0xf6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1, 0x98, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0x19, 0x80, 0x0, 0x6, 0x60, 0x0, 0x1f, 0x98, 0x0, 0x7,
+    0xe6, 0x0, 0x1, 0xe0,
+
+    /* U+9B42 */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0xe, 0x0, 0x3f, 0xc0, 0xc0, 0x3, 0xfc,
+    0xff, 0xf8, 0x0, 0xf, 0xff, 0xc0, 0x1, 0xc7, 0x1c, 0x0, 0x18, 0x70,
+    0xc0, 0x1, 0x87, 0xc, 0x0, 0x1f, 0xff, 0xc7, 0xfd, 0xff, 0xfc, 0x7f,
+    0xdc, 0x70, 0xc0, 0xc1, 0x87, 0xc, 0xc, 0x1c, 0x70, 0xc1, 0xc1, 0xff,
+    0xfc, 0x1c, 0x8f, 0xff, 0xc1, 0x8c, 0x7f, 0xe0, 0x18, 0xc3, 0x32, 0x1,
+    0x8e, 0x33, 0x20, 0x3b, 0xe7, 0x36, 0x43, 0xfe, 0x63, 0x7e, 0x7c, 0x66,
+    0x3f, 0xe6, 0x0, 0xe3, 0x0, 0x0, 0x1c, 0x30, 0x60, 0x3, 0x83, 0x6,
+    0x1, 0xf0, 0x3f, 0xe0, 0x1e, 0x3, 0xfc, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+9B5A */
+    0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x3f,
+    0xff, 0x0, 0x7, 0x0, 0xe0, 0x0, 0xe0, 0xc, 0x0, 0x3c, 0x1, 0x80,
+    0x7, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x0, 0xe0, 0x60, 0x38, 0xc,
+    0x6, 0x3, 0x80, 0xc0, 0x60, 0x38, 0xe, 0xf, 0x3, 0x80, 0xff, 0xff,
+    0xf8, 0xf, 0xff, 0xff, 0x80, 0xc0, 0x60, 0x38, 0xc, 0x6, 0x3, 0x80,
+    0xc0, 0x60, 0x38, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x1, 0x84, 0x8, 0x18, 0x38, 0x60, 0xc1, 0xc3, 0x7, 0xe, 0x1c,
+    0x70, 0x70, 0xe0, 0xe6, 0x3, 0x6, 0x6, 0x60, 0x0, 0x0, 0x60,
+
+    /* U+9B6F */
+    0x0, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x1, 0xe0,
+    0xe, 0x0, 0x3c, 0x1, 0xc0, 0x7, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff,
+    0x80, 0xc0, 0x60, 0x38, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0xc,
+    0x6, 0x1, 0x80, 0xe0, 0x70, 0x38, 0xf, 0xff, 0xff, 0x0, 0x4, 0x8,
+    0x0, 0x38, 0x60, 0xc1, 0xc7, 0x7, 0xe, 0xe, 0x70, 0x20, 0x60, 0xe6,
+    0x7f, 0xff, 0xe6, 0xf, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x38, 0x1c, 0x0,
+    0x3, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x81, 0xc0, 0x0, 0x18,
+    0xf, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9B77 */
+    0x4, 0x0, 0x20, 0x0, 0xe0, 0x3, 0x0, 0xc, 0x0, 0x33, 0x81, 0xfe,
+    0x3, 0x18, 0x1f, 0xe0, 0x31, 0xc3, 0x8e, 0x3, 0x0, 0x70, 0xc0, 0x70,
+    0x6, 0x18, 0xff, 0xfe, 0x7f, 0xe7, 0xff, 0xc3, 0xff, 0x3, 0x0, 0x33,
+    0x30, 0x70, 0x3, 0x33, 0x7, 0x0, 0x33, 0x30, 0x7c, 0x3, 0xff, 0x7,
+    0xc0, 0x3f, 0xf0, 0x6c, 0x3, 0x33, 0x6, 0xc0, 0x33, 0x30, 0xec, 0x3,
+    0xff, 0xc, 0xc0, 0x3f, 0xe0, 0xcc, 0x0, 0xfc, 0x1c, 0xc0, 0x20, 0xb1,
+    0x8c, 0x22, 0xdb, 0x38, 0xc6, 0x64, 0xd7, 0xc, 0x66, 0x6d, 0x60, 0xc6,
+    0x66, 0xce, 0xf, 0xe6, 0x61, 0xc0, 0x7c, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9BAE */
+    0x2, 0x0, 0x1, 0x0, 0x60, 0x18, 0x38, 0xe, 0x1, 0xc3, 0x0, 0xfe,
+    0xc, 0x30, 0x1f, 0xf0, 0xc6, 0x3, 0x86, 0x0, 0x60, 0x70, 0xe3, 0xff,
+    0xc6, 0xc, 0x3f, 0xfe, 0x5f, 0xf0, 0x18, 0x3, 0xff, 0x81, 0x80, 0x39,
+    0x98, 0x18, 0x3, 0x19, 0x83, 0xc0, 0x3f, 0xfb, 0xff, 0xc3, 0xff, 0x9f,
+    0xf8, 0x3b, 0x98, 0x18, 0x3, 0x19, 0x81, 0x80, 0x39, 0x98, 0x18, 0x3,
+    0xff, 0xbf, 0xfe, 0x1f, 0xf3, 0xff, 0xe0, 0x0, 0x3, 0xc0, 0x24, 0x88,
+    0x18, 0x6, 0x6c, 0xc1, 0x80, 0x66, 0x4c, 0x18, 0x6, 0x66, 0xe1, 0x80,
+    0x66, 0x66, 0x18, 0x6, 0x20, 0x1, 0x80, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+9CE5 */
+    0x0, 0x8, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf0, 0x38, 0x0, 0x6, 0x7, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xf8, 0x1c, 0x0, 0x3, 0x3, 0x80, 0x0, 0x60, 0x7f, 0xff,
+    0xfc, 0xf, 0xff, 0xff, 0x1, 0xc0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x1c, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xe0, 0x3f, 0xff, 0xff, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xe, 0x63,
+    0xc, 0x61, 0xdc, 0x71, 0x86, 0x33, 0x86, 0x38, 0xc6, 0x60, 0xc3, 0xf,
+    0xc8, 0x8, 0x1, 0xf0, 0x0, 0x0, 0x3c, 0x0,
+
+    /* U+9CF3 */
+    0x7, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xe0, 0x1e, 0x0, 0xf, 0x1, 0x80,
+    0x0, 0x70, 0x1b, 0xff, 0xf3, 0x1, 0x9f, 0xfe, 0x30, 0x18, 0x1c, 0x3,
+    0x1, 0x8f, 0xfe, 0x30, 0x19, 0xc0, 0x63, 0x1, 0x9f, 0xff, 0x30, 0x19,
+    0xff, 0xf3, 0x1, 0x98, 0x7, 0x30, 0x19, 0xff, 0xe3, 0x1, 0x9f, 0xfc,
+    0x30, 0x19, 0xc0, 0x3, 0x1, 0x9f, 0xff, 0x30, 0x19, 0xc0, 0x3, 0x1,
+    0x9f, 0xfe, 0x30, 0x38, 0xff, 0xfb, 0x23, 0x0, 0x9, 0xb2, 0x33, 0x64,
+    0x9b, 0xa7, 0x36, 0x6d, 0xba, 0x73, 0x36, 0x19, 0xe6, 0x62, 0x7, 0x1e,
+    0x60, 0x1, 0xf0, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+9D28 */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x18, 0x7, 0xfe, 0x6, 0x1, 0xff, 0x8f,
+    0xfc, 0x66, 0x67, 0xff, 0x19, 0x99, 0x80, 0xc6, 0x66, 0x7f, 0xf1, 0x99,
+    0x9f, 0xfc, 0x66, 0x66, 0x3, 0x1f, 0xf9, 0x80, 0xc7, 0xfe, 0x7f, 0xf1,
+    0x99, 0x9f, 0xf0, 0x66, 0x66, 0x0, 0x19, 0x99, 0xff, 0xe6, 0x66, 0x7f,
+    0xf9, 0x99, 0x98, 0x0, 0x7f, 0xe7, 0xff, 0x1f, 0xf8, 0xff, 0xf1, 0xf8,
+    0x0, 0x1c, 0x18, 0x20, 0x93, 0x6, 0xd, 0x36, 0xc1, 0x86, 0x6d, 0xf0,
+    0x61, 0x9b, 0x38, 0x18, 0x66, 0x46, 0x6, 0x10, 0x7, 0x81, 0x80, 0x3,
+    0xe0, 0x0, 0x0, 0xe0,
+
+    /* U+9D3B */
+    0x0, 0x0, 0x30, 0xc, 0x0, 0xc, 0x3, 0xc0, 0x7, 0x0, 0x70, 0x7,
+    0xfc, 0x3, 0xfb, 0xff, 0x0, 0xfe, 0xc0, 0xe0, 0xe, 0x3f, 0xf8, 0x3,
+    0x8f, 0xfe, 0x40, 0xe3, 0x1, 0xbc, 0x38, 0xc0, 0xe7, 0x8e, 0x3f, 0xf0,
+    0x63, 0x8f, 0xf8, 0x0, 0xe3, 0x0, 0x0, 0x38, 0xff, 0xe0, 0xe, 0x3f,
+    0xfc, 0x3, 0x8c, 0x0, 0x18, 0xeb, 0x80, 0xe, 0x3f, 0x7f, 0xe3, 0xbf,
+    0x0, 0x1c, 0xcf, 0x0, 0x93, 0x30, 0xd, 0x36, 0xdc, 0x6, 0x6d, 0xe7,
+    0x1, 0x9b, 0x39, 0x80, 0x66, 0x46, 0xe0, 0x10, 0x3, 0xb0, 0x0, 0x3,
+    0xc0, 0x0, 0x0, 0xe0,
+
+    /* U+9D5D */
+    0x0, 0x0, 0xc, 0x0, 0x36, 0x0, 0xc0, 0x3f, 0x60, 0x1c, 0x7, 0xc6,
+    0xc7, 0xfc, 0x6c, 0x6e, 0xff, 0xc0, 0xc6, 0x6c, 0xc, 0xc, 0x60, 0xff,
+    0xc0, 0xc6, 0xf, 0xfc, 0x7f, 0xfe, 0xc0, 0xc7, 0xff, 0xec, 0xc, 0xc,
+    0x60, 0xff, 0xc0, 0xc6, 0xf, 0xf0, 0xc, 0x66, 0xc0, 0x0, 0xc6, 0x6f,
+    0xfe, 0xf, 0x6e, 0xff, 0xe1, 0xf6, 0xcc, 0x0, 0x7c, 0x3c, 0xff, 0xc7,
+    0xc3, 0x87, 0xfe, 0xc, 0x38, 0x0, 0x60, 0xc3, 0xd, 0x5e, 0xc, 0x70,
+    0xd4, 0xe0, 0xcf, 0x29, 0x6e, 0xd, 0xf3, 0x96, 0xe0, 0xd9, 0xe9, 0xe,
+    0x7d, 0x1c, 0x1, 0xc7, 0x80, 0xc0, 0x3c, 0x0, 0x0, 0x3, 0x0,
+
+    /* U+9D6C */
+    0x0, 0x0, 0xc, 0x1, 0x83, 0x1, 0x80, 0xf8, 0xf8, 0x70, 0x1f, 0xbf,
+    0x3f, 0xe3, 0x36, 0x6f, 0xfc, 0x66, 0xcd, 0x81, 0x8c, 0xd9, 0xbf, 0xf1,
+    0x9b, 0x37, 0xfe, 0x3f, 0x7e, 0xc0, 0xc7, 0xef, 0xd8, 0x18, 0xcd, 0x9b,
+    0xff, 0x19, 0xb3, 0x7f, 0xc3, 0x36, 0x6c, 0x0, 0x66, 0xcd, 0xff, 0xcf,
+    0xdf, 0xbf, 0xf9, 0xfb, 0xf6, 0x0, 0x33, 0x66, 0xff, 0x86, 0x6c, 0xcf,
+    0xfc, 0xcd, 0x98, 0x3, 0x99, 0xb3, 0x50, 0xb3, 0x36, 0x6b, 0xd6, 0xc6,
+    0xcd, 0x6b, 0xd8, 0xf1, 0xed, 0x73, 0x1e, 0x3d, 0xa6, 0x6f, 0xde, 0x1,
+    0xc9, 0xc3, 0x80, 0xf8, 0x0, 0x0, 0xc, 0x0,
+
+    /* U+9E79 */
+    0x4, 0x0, 0x4, 0x0, 0xc0, 0x1, 0xf0, 0x18, 0x0, 0x3b, 0x3, 0xf8,
+    0x7, 0x60, 0x7f, 0x0, 0xe0, 0xc, 0xf, 0xff, 0x81, 0x81, 0xff, 0xf3,
+    0xff, 0x30, 0x70, 0x7f, 0xe6, 0xe, 0x1c, 0xc, 0xff, 0xc3, 0x12, 0x9f,
+    0xd9, 0x7b, 0xd3, 0x3, 0x6d, 0x9a, 0x60, 0x6d, 0x96, 0x4d, 0xcd, 0xb3,
+    0xc9, 0xbd, 0xe7, 0xb7, 0x3d, 0xbc, 0xf6, 0xe7, 0x97, 0x99, 0xec, 0xf2,
+    0xe3, 0x3c, 0x9e, 0x5c, 0x6c, 0xd7, 0xc9, 0x8f, 0xde, 0xdb, 0x75, 0xed,
+    0xd9, 0xee, 0xb0, 0x8b, 0x3b, 0xd7, 0x3, 0xe0, 0x7e, 0x7f, 0xec, 0x19,
+    0xc7, 0xf9, 0x87, 0x38, 0x0, 0x20, 0x40, 0x0,
+
+    /* U+9E7D */
+    0x0, 0x0, 0x80, 0x3, 0xff, 0x9c, 0x0, 0x3f, 0xf3, 0xff, 0xe7, 0x18,
+    0x3e, 0x0, 0x71, 0x86, 0x7f, 0x7, 0x38, 0xe7, 0xf8, 0x7f, 0xf0, 0x60,
+    0x7, 0x7, 0x3f, 0xf8, 0x70, 0x37, 0xff, 0xc7, 0x3, 0x7b, 0x2c, 0x7f,
+    0xf6, 0xcc, 0xc7, 0xfe, 0x77, 0xcc, 0x71, 0x86, 0xba, 0xc7, 0x18, 0x66,
+    0xcc, 0x71, 0x87, 0xde, 0xc3, 0xff, 0x70, 0xbc, 0x3f, 0xf7, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0xc3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x0, 0xc3, 0xc, 0x30,
+    0x7f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9E92 */
+    0x0, 0xc0, 0x20, 0x80, 0xc, 0x6, 0x18, 0x0, 0xc0, 0x61, 0x81, 0xff,
+    0xe6, 0x18, 0x3f, 0xfe, 0xff, 0xe3, 0x33, 0xf, 0xfe, 0x33, 0x30, 0x71,
+    0x83, 0xff, 0xc6, 0x18, 0x3f, 0xfe, 0x61, 0x83, 0x33, 0x67, 0xf8, 0x33,
+    0x33, 0x7f, 0x83, 0x33, 0x36, 0x18, 0x33, 0x36, 0x61, 0x83, 0xff, 0xe7,
+    0x18, 0x3f, 0xfc, 0x7f, 0x83, 0x23, 0x7, 0x18, 0x32, 0x36, 0x61, 0x83,
+    0x3b, 0xe6, 0x18, 0x33, 0xb8, 0xff, 0xc3, 0x23, 0x1f, 0xfe, 0x32, 0x30,
+    0x0, 0x7, 0x23, 0x23, 0x10, 0x63, 0xb3, 0x71, 0x86, 0xfb, 0xe6, 0x1c,
+    0x6e, 0x1e, 0xe0, 0xe0, 0x0, 0x1c, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9E97 */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xbf, 0xfe, 0x7f, 0xf9, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x3f, 0xf0, 0xff, 0xc3, 0xff, 0x1f, 0xfc, 0x31, 0x39, 0xc8,
+    0xc3, 0x33, 0x9c, 0xcc, 0x33, 0x3f, 0x8c, 0xc0, 0x0, 0x60, 0x0, 0xf,
+    0xff, 0xff, 0xe1, 0xff, 0xff, 0xfc, 0x18, 0x30, 0x60, 0x1, 0xff, 0xff,
+    0xf0, 0x1f, 0xff, 0xff, 0xc1, 0x83, 0x6, 0xc, 0x18, 0x30, 0x60, 0xc1,
+    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x1, 0x98, 0xe, 0xc, 0x39, 0xfc,
+    0xef, 0xc3, 0x1f, 0xcf, 0xe0, 0x31, 0x80, 0xe0, 0x27, 0x18, 0x6e, 0x6,
+    0x61, 0xfe, 0x7f, 0xe6, 0x7f, 0x87, 0xfe, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+9EA5 */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xf, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x10, 0x60, 0x80, 0x7, 0x6, 0x1c,
+    0x0, 0xf0, 0x63, 0xc0, 0x1f, 0xc6, 0x7f, 0x83, 0xcf, 0xfe, 0x3c, 0x38,
+    0x3f, 0xc0, 0xc0, 0xf, 0x6f, 0x0, 0x3, 0xc6, 0x3e, 0x1, 0xf8, 0x61,
+    0xfc, 0x7e, 0x38, 0x7, 0xe7, 0x87, 0x0, 0xe, 0x40, 0xff, 0xfc, 0x0,
+    0x3f, 0xff, 0xe0, 0xf, 0x80, 0x1c, 0x3, 0xe4, 0x3, 0xc0, 0x38, 0xf8,
+    0x70, 0x0, 0x3, 0xfe, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x3, 0xff, 0xc0,
+    0xf, 0xf8, 0x3f, 0x3, 0xfc, 0x0, 0x78, 0x3c, 0x0, 0x1, 0x80,
+
+    /* U+9EB5 */
+    0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x3, 0x83, 0xff, 0xe7, 0xff,
+    0xbf, 0xfe, 0x7f, 0xf8, 0x18, 0x1, 0x31, 0x1, 0x0, 0x13, 0x30, 0x7f,
+    0x3, 0xb3, 0x1f, 0xfc, 0x3b, 0x79, 0xb6, 0xe6, 0xf6, 0xd3, 0x66, 0x63,
+    0x41, 0x36, 0x64, 0x7c, 0x13, 0xe6, 0xf, 0xe1, 0x3e, 0x61, 0xb3, 0x93,
+    0x66, 0x72, 0x1d, 0x36, 0x66, 0x60, 0x93, 0x66, 0xf, 0xf1, 0x3e, 0x61,
+    0xff, 0x93, 0x66, 0x3c, 0x31, 0x36, 0x63, 0xe7, 0x13, 0x66, 0x66, 0xe1,
+    0xb6, 0xe0, 0x3c, 0x1f, 0xfc, 0x3, 0xc0, 0x0, 0x0, 0xff, 0x80, 0x0,
+    0x3e, 0x3f, 0xff, 0xf7, 0x80, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9EBC */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xfe, 0x1c, 0x0, 0x8, 0x1, 0x82, 0x0, 0x80, 0x18, 0x70, 0x1c,
+    0x1, 0xbf, 0xef, 0xfc, 0x19, 0xfc, 0x7f, 0x81, 0x83, 0x5, 0x90, 0x19,
+    0xb4, 0x59, 0x1, 0x9b, 0x45, 0xb0, 0x39, 0xb4, 0xdb, 0x23, 0xb3, 0x4d,
+    0x96, 0x3b, 0x34, 0xd9, 0xe3, 0x92, 0x8, 0x88, 0x38, 0x6, 0x0, 0x3,
+    0x80, 0xe3, 0x80, 0x39, 0xdc, 0x70, 0x3, 0xf, 0x87, 0x0, 0x30, 0x3c,
+    0xe4, 0x3, 0x0, 0xfc, 0x60, 0x70, 0x7, 0x7, 0x7, 0x0, 0xf0, 0xf8,
+    0x67, 0xff, 0xff, 0xc6, 0x7f, 0xfc, 0xe, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+9EC3 */
+    0x0, 0xc0, 0x30, 0x0, 0xc, 0x3, 0x0, 0x0, 0xc0, 0x30, 0x3, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0x80, 0xc, 0x3, 0x0, 0x0, 0xe0, 0x70,
+    0x0, 0xf, 0xff, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xe0, 0x7, 0xff, 0xff, 0x0, 0xe0, 0x60, 0x30, 0xe, 0x6, 0x3, 0x0,
+    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xe0, 0x60, 0x30, 0xe, 0x7,
+    0x7, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x40, 0x20, 0x0, 0x1e, 0x7, 0xc0,
+    0x1f, 0xc0, 0x3f, 0xc7, 0xf0, 0x0, 0xfe, 0x70, 0x0, 0x0, 0xe0,
+
+    /* U+9ED1 */
+    0x7, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x1e, 0xe, 0x7, 0x81, 0x88,
+    0x61, 0x18, 0x19, 0xc6, 0x31, 0x81, 0x8c, 0x67, 0x18, 0x18, 0x66, 0x61,
+    0x81, 0x80, 0x60, 0x38, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x0,
+    0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xf8, 0x0, 0xe, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x80, 0x0, 0x0, 0x18, 0x60,
+    0xc3, 0x81, 0x87, 0xc, 0x38, 0x38, 0x70, 0xe1, 0xc3, 0x3, 0x6, 0xc,
+    0x70, 0x30, 0x60, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+9ED4 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x1f, 0xf8, 0x18, 0x3, 0xff,
+    0xc1, 0xc0, 0x31, 0x8c, 0x3c, 0x3, 0x98, 0xc3, 0xc0, 0x3d, 0xac, 0x76,
+    0x3, 0xde, 0xc6, 0x60, 0x35, 0xec, 0xe3, 0x3, 0x18, 0xcc, 0x38, 0x3f,
+    0xfd, 0xc1, 0xc3, 0xff, 0xf8, 0xe, 0xf, 0xf3, 0xff, 0xe0, 0x18, 0x37,
+    0xf6, 0x3f, 0xf8, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x3, 0x80, 0x0, 0x0,
+    0x18, 0xf, 0xf8, 0x3, 0xfd, 0xff, 0xc7, 0xff, 0xc0, 0x1c, 0x7f, 0xc0,
+    0x1, 0x80, 0x0, 0x0, 0x18, 0x36, 0x4c, 0x1, 0x83, 0x66, 0xc0, 0x38,
+    0x76, 0x66, 0x3, 0x86, 0x36, 0x60, 0x30, 0x63, 0x20, 0x3, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+9ED8 */
+    0x0, 0x0, 0x8, 0x1, 0xff, 0x81, 0x80, 0x3f, 0xfc, 0x18, 0x3, 0x18,
+    0xe1, 0x98, 0x31, 0x86, 0x19, 0xc3, 0xdb, 0x61, 0x8c, 0x35, 0xb6, 0x18,
+    0x43, 0x5a, 0x61, 0x80, 0x31, 0x86, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x3f,
+    0xfc, 0xff, 0xc0, 0xff, 0x1, 0xc0, 0x1, 0x80, 0x1c, 0x3, 0xff, 0xc1,
+    0xc0, 0x7f, 0xfe, 0x1c, 0x0, 0x18, 0x3, 0xe0, 0x1, 0x80, 0x36, 0x0,
+    0x1f, 0xe3, 0x60, 0x7f, 0xfe, 0x33, 0x7, 0xfe, 0x7, 0x30, 0x0, 0x4,
+    0x63, 0x83, 0x66, 0xce, 0x18, 0x36, 0x66, 0xc1, 0xc7, 0x36, 0x7c, 0x1e,
+    0x63, 0x33, 0x80, 0xe6, 0x30, 0x38, 0x6, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9EDE */
+    0x0, 0x0, 0x18, 0x1, 0xff, 0x81, 0x80, 0x3f, 0xfc, 0x18, 0x3, 0x18,
+    0xc1, 0x80, 0x39, 0x8c, 0x18, 0x3, 0xdb, 0xc1, 0xc0, 0x3d, 0xac, 0x1f,
+    0xe3, 0x5a, 0xc1, 0xfe, 0x31, 0x8c, 0x18, 0x3, 0xff, 0xc1, 0x80, 0x3f,
+    0xfc, 0x18, 0x0, 0xff, 0x1, 0x80, 0x1, 0x80, 0x18, 0x3, 0xff, 0x87,
+    0xf0, 0x7f, 0xfc, 0xff, 0xc1, 0xff, 0x1f, 0xfc, 0x1, 0x81, 0x80, 0xc0,
+    0x3f, 0xd8, 0xc, 0x7f, 0xfd, 0x80, 0xc7, 0xfe, 0x18, 0xc, 0x0, 0x9,
+    0x80, 0xc2, 0x4c, 0xd8, 0xc, 0x36, 0x6d, 0x80, 0xc6, 0x66, 0xfc, 0xc,
+    0x66, 0x67, 0xff, 0xc6, 0x22, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9EE8 */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x60, 0x40, 0x7, 0x6, 0xc, 0x0, 0x30,
+    0x61, 0xc0, 0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0xe6, 0x3f, 0xff, 0xc6, 0x67, 0xff, 0xfe, 0x66, 0x70, 0x0, 0xe6, 0x7,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x1, 0xff, 0xff,
+    0xf8, 0x18, 0xc6, 0x31, 0x81, 0x8c, 0x66, 0x18, 0x1f, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xf0, 0x0, 0x6, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0x80, 0x0, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x18, 0x60, 0xc1, 0x83, 0x87, 0xe, 0x1c, 0x70, 0x70, 0x60, 0xe2, 0x2,
+    0x2, 0x4,
+
+    /* U+9F0E */
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x31, 0xff, 0xf8, 0xc3, 0x18,
+    0x3, 0x8c, 0x31, 0xff, 0xf8, 0xc3, 0x1f, 0xff, 0x8c, 0x31, 0x80, 0x18,
+    0xc3, 0x18, 0x1, 0x8c, 0x31, 0xff, 0xf8, 0xc3, 0x1f, 0xff, 0x8c, 0x31,
+    0x80, 0x18, 0xc3, 0x1f, 0xff, 0x8c, 0x31, 0xff, 0xf8, 0xc3, 0x0, 0x0,
+    0xc, 0x3c, 0x0, 0x3, 0xc3, 0xff, 0xf, 0xfc, 0x7, 0xf0, 0xfe, 0x0,
+    0x3, 0xc, 0x0, 0x0, 0x70, 0xc0, 0x7, 0xff, 0xf, 0xfe, 0x7f, 0xf0,
+    0xff, 0xe0, 0xe3, 0xc, 0x30, 0xc, 0x30, 0xc3, 0x1, 0xc3, 0xc, 0x30,
+    0x78, 0x30, 0xc3, 0x7, 0x3, 0xc, 0x30, 0x0, 0x30, 0xc1, 0x0,
+
+    /* U+9F3B */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x7f,
+    0xff, 0xe0, 0xe, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0xc0, 0x0, 0x30, 0xf, 0xff, 0xff, 0x0, 0xc0, 0x0, 0x30, 0xf,
+    0xff, 0xff, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf8, 0x3f, 0xff, 0xff, 0xc3, 0x80, 0x60, 0x1c, 0x3f, 0xff, 0xff, 0xc3,
+    0x0, 0x60, 0x1c, 0x38, 0xe, 0x1, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x1c, 0x3, 0x0,
+    0x3, 0x80, 0x30, 0x0, 0xf8, 0x3, 0x0, 0x7e, 0x0, 0x30, 0x3, 0x0,
+    0x2, 0x0,
+
+    /* U+9F4A */
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xfe, 0x0, 0x1, 0x80, 0x0, 0x3, 0x18, 0x18, 0x3f, 0x9b, 0x9f,
+    0x87, 0xfe, 0x77, 0xe0, 0xe, 0xe6, 0x77, 0x0, 0xc6, 0x66, 0x30, 0xc,
+    0x66, 0x63, 0x1, 0x8e, 0x66, 0x1c, 0x39, 0xc6, 0x7d, 0xe7, 0x3c, 0x6f,
+    0x8e, 0x44, 0x4, 0xc2, 0x20, 0xe0, 0x0, 0x70, 0xf, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf0, 0xe, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x70, 0xf, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xf0, 0x1c, 0x0, 0x7, 0x3, 0x80, 0x0, 0x70,
+    0x38, 0x0, 0x7, 0x7, 0x0, 0x0, 0x70, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+9F52 */
+    0x0, 0x6, 0x0, 0x0, 0x20, 0x60, 0x0, 0x7, 0x7, 0xff, 0x0, 0x70,
+    0x7f, 0xf8, 0x7, 0x7, 0x0, 0x0, 0x70, 0x60, 0x0, 0x3f, 0xff, 0xff,
+    0xc7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x6, 0x3, 0x0, 0x30,
+    0xe0, 0x70, 0xc3, 0x1e, 0xf, 0xc, 0x33, 0xf9, 0xf8, 0xc3, 0x39, 0xb9,
+    0xcc, 0x32, 0x3, 0x4, 0xc3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc3,
+    0x2, 0x2, 0x1c, 0x30, 0x60, 0x70, 0xc3, 0xe, 0xe, 0xc, 0x31, 0xf0,
+    0xf0, 0xc3, 0x3b, 0x9f, 0xcc, 0x37, 0xb, 0x8c, 0xc3, 0xa0, 0x20, 0x5c,
+    0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9F61 */
+    0x0, 0xc0, 0xc, 0x0, 0xc, 0x1, 0xc0, 0x18, 0xc0, 0x1c, 0x1, 0x8f,
+    0xe1, 0xe0, 0x18, 0xfe, 0x36, 0x1, 0x8c, 0x3, 0x30, 0x18, 0xc0, 0x73,
+    0x87, 0xff, 0xe6, 0x1c, 0x7f, 0xfe, 0xc0, 0xc0, 0x0, 0x1f, 0xfe, 0x32,
+    0x27, 0xff, 0xe3, 0x66, 0x60, 0x0, 0x37, 0xf6, 0x0, 0x3, 0xdf, 0xe0,
+    0x0, 0x38, 0x9e, 0xff, 0x83, 0x0, 0xef, 0xfc, 0x3f, 0xfe, 0x38, 0xc3,
+    0x22, 0xe3, 0x8c, 0x32, 0x26, 0x38, 0xc3, 0x66, 0x63, 0x8c, 0x37, 0xe6,
+    0x38, 0xc3, 0xdf, 0xe3, 0x8c, 0x38, 0xde, 0x39, 0xc3, 0x0, 0xe3, 0xfc,
+    0x3f, 0xfe, 0x3b, 0x1, 0xff, 0xc3, 0x80, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+9F8D */
+    0x1, 0x81, 0x80, 0x0, 0x38, 0x18, 0x0, 0x3, 0x81, 0xff, 0xc7, 0xff,
+    0xdf, 0xfe, 0x7f, 0xfd, 0xff, 0x81, 0x83, 0x18, 0x0, 0x1c, 0x31, 0xc0,
+    0x1, 0xc3, 0xf, 0xfc, 0x3f, 0xfc, 0x1, 0xc7, 0xff, 0xe0, 0xc, 0x3f,
+    0xfc, 0x1, 0xc0, 0x0, 0xf, 0xfc, 0x1f, 0xf1, 0xc0, 0x3, 0xff, 0x9c,
+    0x0, 0x38, 0x19, 0xff, 0xc3, 0x81, 0x9f, 0xf8, 0x3f, 0xf9, 0x80, 0x3,
+    0xff, 0x9f, 0xfc, 0x30, 0x19, 0xff, 0x83, 0xff, 0x98, 0x0, 0x3f, 0xf9,
+    0xff, 0x83, 0x81, 0x9f, 0xfc, 0x30, 0x19, 0x80, 0x63, 0x1, 0x98, 0x6,
+    0x30, 0x39, 0xff, 0xe3, 0xf, 0x8f, 0xfc, 0x10, 0xe0, 0x0, 0x0,
+
+    /* U+9F9C */
+    0x1, 0x80, 0x0, 0x0, 0x38, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x1, 0xff,
+    0xfe, 0x0, 0x78, 0x1, 0xc0, 0x7, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x81, 0xc1, 0x98, 0x18, 0xf, 0xf9, 0x83, 0x80, 0xff, 0x9f, 0xf8, 0x0,
+    0x19, 0xfe, 0x3, 0xf9, 0x98, 0x0, 0x1, 0xd9, 0x80, 0x7, 0xff, 0xff,
+    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x19, 0x9a, 0x4c, 0x3f, 0x99, 0xbc, 0xc0,
+    0x1, 0x99, 0xcc, 0x3f, 0x99, 0xbe, 0xc0, 0x19, 0x9a, 0xc, 0x7f, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xf8, 0x1, 0xd9, 0x80, 0x63, 0xf9, 0x98, 0x6,
+    0x0, 0x1f, 0xff, 0xe0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+FF01 */
+    0xf, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x66, 0x66, 0x66, 0x0, 0xf, 0xff,
+    0x0,
+
+    /* U+FF08 */
+    0x1, 0x3, 0x83, 0x81, 0x81, 0x81, 0xc0, 0xc0, 0xe0, 0x60, 0x30, 0x18,
+    0xc, 0xc, 0x6, 0x3, 0x1, 0xc0, 0x60, 0x30, 0x18, 0xe, 0x3, 0x1,
+    0xc0, 0x70, 0x18, 0xe, 0x3, 0x80, 0x40,
+
+    /* U+FF09 */
+    0x40, 0x38, 0xe, 0x3, 0x0, 0xc0, 0x70, 0x18, 0xe, 0x3, 0x1, 0x80,
+    0xc0, 0x60, 0x18, 0xc, 0xe, 0x6, 0x3, 0x1, 0x80, 0xc0, 0xe0, 0x60,
+    0x70, 0x70, 0x30, 0x38, 0x38, 0x10, 0x0,
+
+    /* U+FF0C */
+    0x10, 0xf9, 0xf3, 0xe7, 0xc1, 0x86, 0x1c, 0x70, 0xc0,
+
+    /* U+FF1A */
+    0x1, 0xe7, 0x9e, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x1e,
+    0x79, 0xe0, 0x0,
+
+    /* U+FF1F */
+    0x0, 0x0, 0xf, 0xf0, 0x1f, 0xfc, 0x38, 0x3c, 0x70, 0xe, 0x70, 0xe,
+    0x60, 0xe, 0x60, 0xe, 0x0, 0xe, 0x0, 0x1c, 0x0, 0x38, 0x0, 0x70,
+    0x0, 0xe0, 0x1, 0xc0, 0x1, 0xc0, 0x1, 0x80, 0x1, 0x80, 0x1, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0,
+    0x0, 0x0,
+
+    /* U+FF5E */
+    0x1, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x61, 0xff, 0xc0, 0x38, 0xe0, 0x78,
+    0x1c, 0x70, 0xf, 0xfe, 0x18, 0x0, 0xff, 0x0, 0x0, 0xf, 0x0,
+
+};
+
+/*-----------------
+ *    GLYPH DESCRIPTION
+ *----------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 432, .box_w = 25, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 72, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 79, .adv_w = 144, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 85, .adv_w = 128, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 90, .adv_w = 192, .box_w = 14, .box_h = 30, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 143, .adv_w = 272, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 187, .adv_w = 272, .box_w = 10, .box_h = 21, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 214, .adv_w = 272, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 256, .adv_w = 272, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 300, .adv_w = 272, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 342, .adv_w = 272, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 384, .adv_w = 272, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 426, .adv_w = 272, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 466, .adv_w = 272, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 510, .adv_w = 272, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 554, .adv_w = 128, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 567, .adv_w = 176, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 578, .adv_w = 128, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 582, .adv_w = 480, .box_w = 8, .box_h = 9, .ofs_x = 11, .ofs_y = 6},
+    {.bitmap_index = 591, .adv_w = 480, .box_w = 10, .box_h = 11, .ofs_x = 10, .ofs_y = 6},
+    {.bitmap_index = 605, .adv_w = 480, .box_w = 13, .box_h = 27, .ofs_x = 16, .ofs_y = -2},
+    {.bitmap_index = 649, .adv_w = 480, .box_w = 13, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 693, .adv_w = 480, .box_w = 12, .box_h = 25, .ofs_x = 15, .ofs_y = 1},
+    {.bitmap_index = 731, .adv_w = 480, .box_w = 11, .box_h = 25, .ofs_x = 3, .ofs_y = -3},
+    {.bitmap_index = 766, .adv_w = 480, .box_w = 28, .box_h = 4, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 780, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 871, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 962, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1057, .adv_w = 480, .box_w = 28, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1141, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1232, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1323, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1414, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1505, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1593, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1681, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1769, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1860, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1951, .adv_w = 480, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2033, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2128, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2219, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2314, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2405, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2500, .adv_w = 480, .box_w = 28, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2581, .adv_w = 480, .box_w = 28, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2665, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2760, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2848, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2943, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3038, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3133, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3228, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3323, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3418, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3513, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3608, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3703, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3798, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3893, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3988, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4080, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4175, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4266, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4358, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4453, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4548, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4643, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4738, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4833, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4928, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5023, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5115, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5210, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5305, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5400, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5495, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5590, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5685, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5780, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5878, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 5970, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6065, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6160, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6255, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6350, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6445, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6537, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6632, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6727, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6822, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6917, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7015, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7110, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7205, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7300, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7395, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7490, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7585, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7680, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7772, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7864, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7956, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8051, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8149, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8244, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8339, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8434, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8529, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8624, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8719, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8814, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8909, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9004, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9099, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9194, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9289, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9384, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9479, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9574, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9669, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9764, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9855, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9950, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10045, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10140, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10235, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10330, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10422, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10517, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10608, .adv_w = 480, .box_w = 25, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 10693, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10784, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10875, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10966, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11057, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11152, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11247, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11342, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11437, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11528, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11619, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11710, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11805, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11903, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11998, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12089, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12184, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 12269, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 12357, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12452, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12540, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12632, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12724, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12816, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12908, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12996, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13088, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13180, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13272, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13364, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13459, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13554, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13646, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13738, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13830, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13922, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14014, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14106, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14194, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14286, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14378, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14470, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14562, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14654, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 14746, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14841, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14936, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 15028, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15119, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15214, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15309, .adv_w = 480, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 15394, .adv_w = 480, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 15479, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15574, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15669, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15764, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15859, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15954, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16049, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16144, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 16242, .adv_w = 480, .box_w = 25, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 16327, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16419, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16510, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16601, .adv_w = 480, .box_w = 26, .box_h = 28, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 16692, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16787, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16878, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 16973, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17064, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17159, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17250, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 17338, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17433, .adv_w = 480, .box_w = 24, .box_h = 22, .ofs_x = 3, .ofs_y = 1},
+    {.bitmap_index = 17499, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17597, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17682, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17773, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17868, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17963, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 18048, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 18136, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 18227, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 18318, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 18403, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 18488, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 18576, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 18671, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 18766, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 18854, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 18946, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 19038, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19133, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19225, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 19313, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 19405, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 19490, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19585, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19676, .adv_w = 480, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 19761, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19852, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19943, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20028, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 20123, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20211, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20296, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 20391, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20483, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20575, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20667, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20759, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 20851, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 20942, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21034, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 21125, .adv_w = 480, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 21210, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 21298, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 21396, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 21487, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21579, .adv_w = 480, .box_w = 26, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 21657, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21742, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21827, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21912, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21997, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 22082, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 22167, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 22252, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 22337, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 22428, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22523, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22618, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22713, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 22804, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22896, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22991, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23086, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23181, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 23272, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 23363, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23458, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23553, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23648, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23743, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23838, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 23933, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24024, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24115, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24206, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24301, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24396, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24494, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24589, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24684, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24779, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24870, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24961, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25056, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25147, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25242, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25337, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25428, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 25526, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25617, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 25705, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25800, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25895, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25990, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26085, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26180, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26268, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26363, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26458, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26550, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26645, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26740, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26835, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26933, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27028, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27120, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27215, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27307, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27402, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27497, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27592, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27687, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27782, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27880, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27975, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28070, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28165, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28260, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28355, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28450, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28545, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 28636, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28731, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28826, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 28921, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29013, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29108, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29199, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29290, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29381, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29476, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29571, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29666, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29761, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29856, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 29944, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30039, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 30127, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30222, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30317, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30412, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 30497, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30592, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30683, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30778, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30869, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30964, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 31056, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 31148, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31243, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31338, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31433, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31528, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 31616, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31711, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 31803, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 31901, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31996, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32091, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32186, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32281, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32376, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32471, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32566, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32661, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32759, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32854, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32949, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33044, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33139, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33234, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33329, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33420, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33511, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33602, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33690, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33781, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33866, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 33954, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34045, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34136, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34224, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 34316, .adv_w = 480, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 34394, .adv_w = 480, .box_w = 25, .box_h = 26, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 34476, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34571, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34666, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 34761, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 34853, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 34945, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35033, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35125, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 35220, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35312, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 35407, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35499, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 35587, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 35679, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35771, .adv_w = 480, .box_w = 28, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 35852, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 35943, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36034, .adv_w = 480, .box_w = 26, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 36116, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 36207, .adv_w = 480, .box_w = 26, .box_h = 25, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 36289, .adv_w = 480, .box_w = 26, .box_h = 25, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 36371, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36466, .adv_w = 480, .box_w = 24, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 36547, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36642, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36737, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 36829, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36924, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 37016, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37111, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 37203, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 37295, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 37387, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37482, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37573, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37668, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37763, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37858, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 37950, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38045, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38140, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 38231, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38326, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38421, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38516, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38611, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38706, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38801, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38896, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 38991, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39086, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39181, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39276, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39371, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39466, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39561, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39656, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39747, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39842, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 39934, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40025, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40120, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40211, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40302, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40397, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40492, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40587, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40682, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40777, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40872, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40967, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41062, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41157, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41252, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41347, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41442, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41537, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41632, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 41723, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 41814, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41909, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42004, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42099, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42197, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42292, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42383, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42478, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42576, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42671, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42762, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42857, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42952, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43050, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43145, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 43230, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43325, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43420, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43512, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43607, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43702, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43797, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43892, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43987, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44082, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44177, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44272, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44367, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44462, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44557, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44652, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44747, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44842, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 44937, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45032, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45127, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45222, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45317, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45412, .adv_w = 480, .box_w = 26, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 45503, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45594, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45689, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45784, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45879, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45974, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46066, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46157, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46252, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46347, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46442, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46537, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46629, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46724, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46819, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46911, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47006, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47101, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47199, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47291, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47386, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47481, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47576, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47671, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47766, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47861, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 47956, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48051, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48146, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48241, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48336, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48431, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48526, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48621, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48716, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48811, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48906, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49001, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49096, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49191, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49286, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49384, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49479, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49574, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49669, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49764, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49859, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 49954, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50049, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50144, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50242, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50337, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50432, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50527, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50622, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50717, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 50809, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50904, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 50999, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51094, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51189, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51284, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51379, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51474, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51569, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51664, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51759, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51854, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 51949, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52044, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52139, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52234, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52329, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52424, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 52516, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52611, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52706, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52801, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52896, .adv_w = 480, .box_w = 21, .box_h = 25, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 52962, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 53050, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53141, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53233, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53328, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53423, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 53508, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53600, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 53692, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 53780, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 53872, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 53967, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54058, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 54150, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54245, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 54337, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54432, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54527, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54622, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 54707, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 54799, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 54891, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 54979, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55074, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55165, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 55257, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 55349, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55440, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55535, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55630, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55721, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55816, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 55911, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56009, .adv_w = 480, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56090, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56185, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56276, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 56367, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56459, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56551, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56646, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56741, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56836, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 56931, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57026, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57121, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57216, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57311, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57406, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57501, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57596, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57691, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57786, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57881, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 57976, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58067, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58162, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 58254, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58349, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58440, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58535, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58630, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58725, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58820, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 58915, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59010, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59102, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59197, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59292, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59387, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59482, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59574, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59669, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59764, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59859, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59954, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60049, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60144, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60239, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60334, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60429, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60521, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60616, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60711, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60806, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60904, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60999, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61094, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61189, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61284, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61379, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61471, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61569, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61664, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61759, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61854, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61949, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62044, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62139, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62234, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62329, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62424, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 62516, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62614, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 62705, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 62793, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62888, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62983, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63074, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63169, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63260, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63355, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63446, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63541, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 63632, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 63723, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63814, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 63909, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 64004, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 64099, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 64197, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 64295, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64387, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64479, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64571, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 64666, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64758, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64850, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 64942, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65030, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65122, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65214, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65306, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65394, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65486, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65578, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65670, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 65765, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 65857, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 65952, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66044, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66136, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66228, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66320, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66408, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66500, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66592, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66684, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66776, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66868, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 66960, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 67055, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67143, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 67235, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 67330, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67422, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67514, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67606, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67698, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67786, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67878, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 67966, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68058, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68146, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68238, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68330, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 68425, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68520, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68612, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68700, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68792, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68884, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 68976, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69068, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69160, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 69255, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 69350, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69442, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69534, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69626, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69718, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69806, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69898, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 69990, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 70082, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70177, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70272, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70367, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70462, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70557, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70652, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70747, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70839, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70931, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71026, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71121, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 71212, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71303, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71398, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 71486, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71581, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71676, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71771, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71866, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 71958, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72053, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72148, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72243, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72338, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72433, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72524, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 72616, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72711, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72806, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 72894, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 72986, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73081, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73173, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73268, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73363, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73458, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73553, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73645, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 73733, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73824, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 73919, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74014, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74109, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74200, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74295, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74386, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74481, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 74569, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74664, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74755, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 74847, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 74938, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75033, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75128, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75223, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 75308, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75396, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75491, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75586, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75677, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 75772, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 75860, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 75951, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 76043, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76128, .adv_w = 480, .box_w = 24, .box_h = 24, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 76200, .adv_w = 480, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 76278, .adv_w = 480, .box_w = 25, .box_h = 26, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 76360, .adv_w = 480, .box_w = 24, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 76441, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76526, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76618, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76713, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76805, .adv_w = 480, .box_w = 26, .box_h = 28, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 76896, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76987, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77082, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77177, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77272, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77367, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77462, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77557, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77652, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77747, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77842, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 77937, .adv_w = 480, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 78015, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 78106, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 78194, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78285, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 78380, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 78475, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78570, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78661, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78749, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 78844, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78935, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79027, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79115, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79210, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79302, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 79390, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 79482, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 79567, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 79659, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 79747, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 79839, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79934, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80029, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 80117, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80205, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80300, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80391, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80486, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80581, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80676, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 80767, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80862, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80953, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81048, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81139, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81230, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81325, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81416, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81511, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81606, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81701, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81792, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81887, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81982, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82077, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82172, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82267, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82362, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82457, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82552, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82647, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82742, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82837, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 82932, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 83027, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 83119, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 83210, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 83305, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 83393, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 83485, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 83576, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 83667, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 83762, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 83857, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 83948, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84043, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84138, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84233, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84328, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84423, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84518, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84613, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84708, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84803, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84898, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 84993, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85088, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85183, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85278, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85373, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85468, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85563, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85658, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85753, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85848, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 85940, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86035, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86130, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86225, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86313, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86408, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86500, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86595, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86690, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86785, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86880, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 86975, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87070, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87165, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87257, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87349, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87444, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87539, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87637, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87732, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87827, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 87922, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88017, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88112, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88204, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88296, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88391, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88486, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88581, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88676, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88771, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88866, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 88961, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89056, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89151, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89246, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89341, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89436, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89527, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89618, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89709, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89800, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89895, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 89986, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90081, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90176, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90261, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90356, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90448, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90536, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90628, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90719, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90817, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90909, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 91000, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 91091, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91186, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91281, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91372, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91463, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91554, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 91642, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91730, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 91815, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 91913, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92008, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92103, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92198, .adv_w = 480, .box_w = 25, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 92283, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92374, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92469, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92564, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92659, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 92757, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92852, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 92947, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93042, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93134, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93229, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93320, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93415, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93510, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 93598, .adv_w = 480, .box_w = 22, .box_h = 28, .ofs_x = 4, .ofs_y = -2},
+    {.bitmap_index = 93675, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 93763, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93858, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 93953, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94048, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94140, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94235, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94330, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94425, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94523, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94618, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94713, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94808, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94903, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 94998, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 95089, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95184, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95279, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95374, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95469, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95564, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95659, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95754, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95849, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 95944, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96039, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96134, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96229, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96324, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96419, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 96510, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96605, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96700, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96795, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96890, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 96985, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97080, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97175, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97270, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97365, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97460, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97558, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97653, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97748, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 97843, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 97941, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98036, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98131, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98226, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98321, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98416, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98511, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98606, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98701, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98796, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98891, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 98986, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 99077, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99172, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99267, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99362, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99457, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99552, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99647, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99742, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 99833, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 99924, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100019, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100114, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100209, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100304, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 100395, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100490, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100585, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100680, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100775, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100870, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100965, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101060, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101155, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101250, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101345, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101440, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101535, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101630, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 101718, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101809, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101900, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101991, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102086, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102177, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102272, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102367, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 102465, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102553, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102648, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102739, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102830, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102925, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103016, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103111, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103203, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 103291, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 103379, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103474, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103565, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103660, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103755, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 103850, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 103941, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104036, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104127, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104215, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104307, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104402, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104497, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104592, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104687, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104782, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 104880, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 104971, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105062, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105157, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105248, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105343, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105438, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105529, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105617, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105712, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105807, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 105902, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106000, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106095, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106190, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106285, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106380, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106471, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106566, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106657, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106755, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106850, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 106945, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107040, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107135, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107230, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 107318, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107413, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107508, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107603, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107698, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107793, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107888, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 107979, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108074, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108172, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108267, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108362, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108457, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108552, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108647, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108742, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108837, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 108932, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109027, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109122, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109217, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109308, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109403, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109498, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109593, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109688, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109783, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109878, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109973, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110064, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110155, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110246, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110341, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110436, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110531, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110626, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110721, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110812, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110907, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111002, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111097, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111192, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111287, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111382, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111477, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111572, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111667, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111762, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111853, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111948, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112043, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112138, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 112229, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 112320, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112415, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 112506, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 112601, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112696, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112791, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112886, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112981, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 113076, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113167, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113258, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113349, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 113444, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 113539, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113630, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113721, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113812, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 113907, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 113998, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 114093, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 114184, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 114275, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 114366, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 114461, .adv_w = 480, .box_w = 26, .box_h = 25, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 114543, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 114634, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 114729, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 114824, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 114919, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115014, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115109, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115204, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115299, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115394, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115485, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 115573, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 115665, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115760, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115855, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 115943, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116038, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116133, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116228, .adv_w = 480, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 116316, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116411, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116502, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116597, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 116688, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116780, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116875, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 116970, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117068, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117163, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 117251, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117346, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117441, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117539, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117634, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117729, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117824, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 117916, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118008, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118106, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118204, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118299, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118394, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118489, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118580, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 118665, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 118750, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 118835, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 118923, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119008, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 119093, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 119181, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119269, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119361, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119453, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119541, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119633, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 119721, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119813, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119905, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 119993, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120085, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120177, .adv_w = 480, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120262, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120354, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120446, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120534, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120626, .adv_w = 480, .box_w = 27, .box_h = 28, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120721, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 120813, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 120908, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121003, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121098, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121193, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121288, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121383, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121478, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121573, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121664, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 121752, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121843, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 121934, .adv_w = 480, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 122019, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 122107, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122202, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122297, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122392, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122487, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122582, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 122673, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122768, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122863, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 122954, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123049, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123144, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123239, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123334, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 123422, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123517, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123615, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123706, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123797, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123888, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 123983, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124074, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124165, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124260, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124355, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124446, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124541, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124632, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124723, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124814, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 124909, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125007, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125105, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125203, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125298, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125393, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125485, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125583, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125678, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 125769, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125864, .adv_w = 480, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 125952, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126047, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126142, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126234, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126329, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126424, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126519, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126614, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126709, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 126797, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126892, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 126987, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127082, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127177, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127272, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127364, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127455, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 127543, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 127631, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127726, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 127818, .adv_w = 480, .box_w = 27, .box_h = 27, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 127910, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128005, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128100, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128195, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128290, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128385, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128480, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128575, .adv_w = 480, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128666, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128764, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128859, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 128954, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129052, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129147, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129245, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129340, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129435, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129530, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129625, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 129720, .adv_w = 480, .box_w = 4, .box_h = 25, .ofs_x = 13, .ofs_y = -1},
+    {.bitmap_index = 129733, .adv_w = 480, .box_w = 9, .box_h = 27, .ofs_x = 17, .ofs_y = -2},
+    {.bitmap_index = 129764, .adv_w = 480, .box_w = 9, .box_h = 27, .ofs_x = 4, .ofs_y = -2},
+    {.bitmap_index = 129795, .adv_w = 480, .box_w = 7, .box_h = 10, .ofs_x = 12, .ofs_y = 6},
+    {.bitmap_index = 129804, .adv_w = 480, .box_w = 6, .box_h = 19, .ofs_x = 12, .ofs_y = 2},
+    {.bitmap_index = 129819, .adv_w = 480, .box_w = 16, .box_h = 25, .ofs_x = 7, .ofs_y = -1},
+    {.bitmap_index = 129869, .adv_w = 480, .box_w = 26, .box_h = 7, .ofs_x = 2, .ofs_y = 8}
+};
+
+/*-----------------
+ *    CHARACTER MAPPING
+ *----------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x5, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1a, 0x90, 0x97, 0x2fe1, 0x2fe2, 0x2fea, 0x2feb, 0x2fec,
+    0x2fed, 0x4de0, 0x4de1, 0x4de3, 0x4de8, 0x4de9, 0x4dea, 0x4deb,
+    0x4ded, 0x4df6, 0x4dff, 0x4e0d, 0x4e12, 0x4e19, 0x4e1b, 0x4e23,
+    0x4e25, 0x4e2b, 0x4e3d, 0x4e3f, 0x4e6b, 0x4e6c, 0x4e74, 0x4e75,
+    0x4e7e, 0x4e84, 0x4e8b, 0x4e8c, 0x4e8d, 0x4e9a, 0x4ea1, 0x4eaa,
+    0x4eab, 0x4eb4, 0x4eb5, 0x4eb6, 0x4eb8, 0x4eb9, 0x4ec3, 0x4ec5,
+    0x4ed2, 0x4ed6, 0x4edb, 0x4ee1, 0x4ef1, 0x4f10, 0x4f14, 0x4f16,
+    0x4f18, 0x4f28, 0x4f2d, 0x4f2e, 0x4f2f, 0x4f31, 0x4f34, 0x4f35,
+    0x4f39, 0x4f3b, 0x4f3c, 0x4f40, 0x4f53, 0x4f5f, 0x4f66, 0x4f6b,
+    0x4f7d, 0x4f8f, 0x4f95, 0x4f9f, 0x4fa2, 0x4fa3, 0x4fa4, 0x4faa,
+    0x4fbd, 0x4fc1, 0x4fce, 0x4fe9, 0x4feb, 0x4ff1, 0x4ff2, 0x4ff9,
+    0x500b, 0x501c, 0x5027, 0x5029, 0x5035, 0x503a, 0x503c, 0x5045,
+    0x5055, 0x5071, 0x5079, 0x5093, 0x50d9, 0x50e0, 0x50e4, 0x50ff,
+    0x510a, 0x5112, 0x5123, 0x5126, 0x5128, 0x5129, 0x512b, 0x512c,
+    0x512d, 0x5132, 0x5145, 0x5147, 0x5148, 0x5149, 0x514b, 0x514c,
+    0x514d, 0x5151, 0x5155, 0x5156, 0x5157, 0x516a, 0x5180, 0x518c,
+    0x5197, 0x51a6, 0x51c1, 0x51d1, 0x51da, 0x51dd, 0x51e6, 0x51ea,
+    0x51f1, 0x51fd, 0x5204, 0x5205, 0x5209, 0x5210, 0x5216, 0x521a,
+    0x521b, 0x522d, 0x524a, 0x524f, 0x5255, 0x5263, 0x5267, 0x5269,
+    0x5271, 0x527b, 0x527f, 0x5280, 0x5289, 0x528d, 0x52a7, 0x52b5,
+    0x52b9, 0x52bd, 0x52be, 0x52e5, 0x52f6, 0x52f7, 0x530f, 0x5320,
+    0x5321, 0x5323, 0x5328, 0x532a, 0x5334, 0x5337, 0x533a, 0x5341,
+    0x5350, 0x5358, 0x537d, 0x537f, 0x539b, 0x53a3, 0x53aa, 0x53ab,
+    0x53ad, 0x53b4, 0x53b6, 0x53b7, 0x53c1, 0x53c3, 0x53c4, 0x53cc,
+    0x53cf, 0x53d0, 0x53d2, 0x53d8, 0x53e3, 0x53e8, 0x53e9, 0x53ec,
+    0x53ed, 0x53fb, 0x5413, 0x542a, 0x5448, 0x5451, 0x545c, 0x545d,
+    0x546c, 0x5476, 0x548a, 0x54a1, 0x54c1, 0x54c5, 0x54c9, 0x54d2,
+    0x550e, 0x5511, 0x5526, 0x552a, 0x552f, 0x553f, 0x5541, 0x5544,
+    0x5546, 0x555e, 0x5569, 0x557c, 0x557d, 0x558e, 0x5591, 0x55b1,
+    0x55e9, 0x5648, 0x56a9, 0x56bb, 0x56be, 0x56c0, 0x56da, 0x56eb,
+    0x56f2, 0x56f3, 0x56f6, 0x56f8, 0x56ff, 0x5708, 0x5710, 0x571e,
+    0x5720, 0x5727, 0x572a, 0x5731, 0x574a, 0x5763, 0x576b, 0x57ae,
+    0x57b4, 0x57bf, 0x57c0, 0x57c4, 0x57d7, 0x57da, 0x57e2, 0x5801,
+    0x5811, 0x5814, 0x582a, 0x5834, 0x584b, 0x5863, 0x586a, 0x5873,
+    0x587e, 0x5888, 0x58a7, 0x58c2, 0x58cb, 0x58dd, 0x58ef, 0x58f5,
+    0x58f6, 0x58fa, 0x58fc, 0x5902, 0x5907, 0x5909, 0x590a, 0x590e,
+    0x5927, 0x5928, 0x5931, 0x5937, 0x594e, 0x5953, 0x5956, 0x595d,
+    0x5962, 0x597d, 0x5984, 0x5999, 0x59ab, 0x59b0, 0x59b4, 0x59c8,
+    0x59df, 0x59e1, 0x59f8, 0x59fc, 0x5a26, 0x5a29, 0x5a3a, 0x5a46,
+    0x5a57, 0x5a72, 0x5a9d, 0x5b04, 0x5b10, 0x5b30, 0x5b35, 0x5b37,
+    0x5b38, 0x5b3d, 0x5b43, 0x5b58, 0x5b65, 0x5b67, 0x5b69, 0x5b6b,
+    0x5b6c, 0x5b77, 0x5b78, 0x5b7a, 0x5b7c, 0x5b82, 0x5b84, 0x5b94,
+    0x5b95, 0x5b96, 0x5b99, 0x5b9f, 0x5ba4, 0x5ba7, 0x5bac, 0x5bb2,
+    0x5bb3, 0x5bbf, 0x5bc2, 0x5bc6, 0x5bc9, 0x5bcb, 0x5bce, 0x5bd6,
+    0x5be1, 0x5be7, 0x5be8, 0x5beb, 0x5bed, 0x5bee, 0x5bef, 0x5bf1,
+    0x5c11, 0x5c19, 0x5c1c, 0x5c1e, 0x5c20, 0x5c25, 0x5c26, 0x5c2b,
+    0x5c35, 0x5c44, 0x5c4c, 0x5c4f, 0x5c51, 0x5c81, 0x5c89, 0x5c93,
+    0x5c98, 0x5cc8, 0x5cd0, 0x5cd6, 0x5cdd, 0x5cf9, 0x5d02, 0x5d14,
+    0x5d9c, 0x5dbd, 0x5dbe, 0x5dc1, 0x5dc5, 0x5dc6, 0x5dc7, 0x5dc8,
+    0x5dce, 0x5dd1, 0x5dd4, 0x5dd7, 0x5dde, 0x5de2, 0x5de3, 0x5e0b,
+    0x5e0d, 0x5e13, 0x5e16, 0x5e18, 0x5e25, 0x5e43, 0x5e4b, 0x5e53,
+    0x5e54, 0x5e58, 0x5e59, 0x5e5c, 0x5e6a, 0x5e75, 0x5e77, 0x5e7c,
+    0x5e86, 0x5e87, 0x5e8b, 0x5e8d, 0x5e97, 0x5ea1, 0x5eb6, 0x5eba,
+    0x5ebf, 0x5ec2, 0x5ec3, 0x5ed3, 0x5ed6, 0x5eda, 0x5ee4, 0x5eef,
+    0x5ef8, 0x5f15, 0x5f17, 0x5f28, 0x5f2c, 0x5f4d, 0x5f51, 0x5f59,
+    0x5f5c, 0x5f60, 0x5f6b, 0x5f6c, 0x5f70, 0x5f77, 0x5f7e, 0x5f89,
+    0x5f8e, 0x5f97, 0x5fa3, 0x5fb7, 0x5fb8, 0x5fb9, 0x5fc0, 0x5fcb,
+    0x5fd5, 0x5fee, 0x5ffd, 0x6001, 0x6005, 0x6007, 0x6030, 0x6049,
+    0x604f, 0x6088, 0x6092, 0x6096, 0x60a5, 0x60c0, 0x60d3, 0x60d9,
+    0x60ef, 0x60fb, 0x60ff, 0x612b, 0x6135, 0x6147, 0x6156, 0x6192,
+    0x6196, 0x61a9, 0x61f0, 0x61f1, 0x61f2, 0x61f6, 0x6201, 0x620a,
+    0x6210, 0x6212, 0x6214, 0x6216, 0x621f, 0x6220, 0x622b, 0x6233,
+    0x6238, 0x6243, 0x625f, 0x6260, 0x6273, 0x6275, 0x6277, 0x629d,
+    0x62a6, 0x62a9, 0x62ad, 0x62b2, 0x62b3, 0x62b4, 0x62bb, 0x62bc,
+    0x62df, 0x62e7, 0x62f1, 0x630a, 0x631a, 0x6357, 0x6363, 0x636c,
+    0x6372, 0x6381, 0x6382, 0x6385, 0x6387, 0x63b0, 0x63bb, 0x63ca,
+    0x63d4, 0x63f6, 0x63fc, 0x640c, 0x6416, 0x6449, 0x6468, 0x6470,
+    0x6472, 0x6484, 0x6485, 0x648d, 0x6492, 0x64aa, 0x64cc, 0x64fd,
+    0x6504, 0x650f, 0x6516, 0x6519, 0x651b, 0x651e, 0x651f, 0x6525,
+    0x652f, 0x6531, 0x6538, 0x6539, 0x6546, 0x6554, 0x6558, 0x6567,
+    0x6571, 0x6577, 0x6579, 0x658f, 0x6590, 0x6597, 0x6599, 0x659c,
+    0x65a5, 0x65af, 0x65c5, 0x65c6, 0x65c9, 0x65cc, 0x65cd, 0x65ea,
+    0x65ee, 0x65f3, 0x65f5, 0x65ff, 0x6600, 0x6605, 0x660f, 0x6622,
+    0x662f, 0x663a, 0x6648, 0x664e, 0x664f, 0x6656, 0x665a, 0x6676,
+    0x6677, 0x6694, 0x66a6, 0x66a9, 0x66c6, 0x66d4, 0x66d8, 0x66d9,
+    0x66dc, 0x66de, 0x66e0, 0x66e3, 0x66e8, 0x66e9, 0x66ed, 0x66fb,
+    0x66fd, 0x66ff, 0x6708, 0x670a, 0x670b, 0x670c, 0x6711, 0x672e,
+    0x6731, 0x673f, 0x674d, 0x674f, 0x6751, 0x675e, 0x675f, 0x6770,
+    0x6777, 0x677c, 0x6796, 0x67c5, 0x67cf, 0x67f7, 0x6801, 0x6818,
+    0x681c, 0x6823, 0x6828, 0x682c, 0x6830, 0x6834, 0x6865, 0x6877,
+    0x687d, 0x688f, 0x68bf, 0x68c3, 0x68ce, 0x68ed, 0x692a, 0x694d,
+    0x6955, 0x695d, 0x6975, 0x697c, 0x698e, 0x69e2, 0x69f1, 0x69f3,
+    0x6a01, 0x6a03, 0x6a2b, 0x6a39, 0x6a3f, 0x6a74, 0x6a82, 0x6aa3,
+    0x6ac5, 0x6aea, 0x6b01, 0x6b03, 0x6b1d, 0x6b1e, 0x6b29, 0x6b2c,
+    0x6b30, 0x6b41, 0x6b42, 0x6b43, 0x6b46, 0x6b52, 0x6b57, 0x6b58,
+    0x6b5b, 0x6b95, 0x6bad, 0x6bb2, 0x6bb4, 0x6bbb, 0x6bf1, 0x6c03,
+    0x6c07, 0x6c14, 0x6c18, 0x6c22, 0x6c3f, 0x6c56, 0x6c5a, 0x6c5d,
+    0x6c63, 0x6c68, 0x6c69, 0x6c76, 0x6c79, 0x6c7b, 0x6c93, 0x6c99,
+    0x6c9b, 0x6cac, 0x6cb5, 0x6cc2, 0x6cc5, 0x6cd0, 0x6ceb, 0x6cf7,
+    0x6cfb, 0x6d0a, 0x6d12, 0x6d1b, 0x6d1e, 0x6d21, 0x6d49, 0x6d4a,
+    0x6d54, 0x6d57, 0x6d68, 0x6d8e, 0x6d95, 0x6db1, 0x6de5, 0x6dfb,
+    0x6e01, 0x6e0c, 0x6e0f, 0x6e14, 0x6e18, 0x6e36, 0x6e4f, 0x6e70,
+    0x6e76, 0x6e8a, 0x6e8b, 0x6eb4, 0x6ede, 0x6edf, 0x6ee1, 0x6ee6,
+    0x6ef4, 0x6f02, 0x6f1f, 0x6f31, 0x6f34, 0x6f42, 0x6f4d, 0x6f4e,
+    0x6f81, 0x6f84, 0x6fbf, 0x7043, 0x704b, 0x705d, 0x706e, 0x7072,
+    0x708d, 0x7098, 0x709a, 0x70af, 0x70c4, 0x7101, 0x7139, 0x7147,
+    0x716a, 0x7179, 0x7191, 0x71b2, 0x71b5, 0x71b9, 0x71bf, 0x720c,
+    0x720d, 0x7216, 0x7218, 0x721a, 0x721e, 0x7227, 0x7228, 0x722c,
+    0x7239, 0x7249, 0x7259, 0x72b7, 0x72fc, 0x7314, 0x7324, 0x732e,
+    0x7348, 0x736b, 0x7389, 0x738b, 0x7392, 0x739b, 0x73a9, 0x73cd,
+    0x73de, 0x73e3, 0x73e6, 0x740a, 0x7414, 0x7420, 0x7424, 0x742b,
+    0x743c, 0x743e, 0x7449, 0x744a, 0x7450, 0x7463, 0x7490, 0x74bc,
+    0x74c6, 0x74ff, 0x7502, 0x7508, 0x7510, 0x7511, 0x7512, 0x7513,
+    0x7517, 0x7518, 0x752c, 0x7539, 0x7556, 0x7566, 0x7571, 0x758b,
+    0x7599, 0x75bb, 0x75d2, 0x75eb, 0x75ff, 0x7606, 0x765b, 0x765c,
+    0x765d, 0x765e, 0x7664, 0x7667, 0x768e, 0x76aa, 0x76b2, 0x76bb,
+    0x76bf, 0x76c3, 0x76d4, 0x76d8, 0x76e9, 0x76eb, 0x76ff, 0x7700,
+    0x771c, 0x771e, 0x773b, 0x7741, 0x778d, 0x77cd, 0x77cf, 0x77d3,
+    0x77dd, 0x77e2, 0x77f4, 0x7814, 0x787f, 0x7887, 0x789a, 0x78a1,
+    0x791a, 0x791e, 0x7936, 0x793d, 0x7945, 0x7948, 0x794d, 0x795a,
+    0x7961, 0x796f, 0x7987, 0x798e, 0x799e, 0x79a0, 0x79a1, 0x79a9,
+    0x79ab, 0x79b1, 0x79bf, 0x79c6, 0x79eb, 0x7a11, 0x7a2e, 0x7a56,
+    0x7a5a, 0x7a5f, 0x7a77, 0x7a89, 0x7aab, 0x7ab9, 0x7abf, 0x7ac0,
+    0x7ac5, 0x7acf, 0x7ad9, 0x7adf, 0x7b0c, 0x7b29, 0x7b31, 0x7b36,
+    0x7b51, 0x7b77, 0x7b81, 0x7ba0, 0x7ba7, 0x7ba9, 0x7c1d, 0x7c1e,
+    0x7c2d, 0x7c40, 0x7c44, 0x7c53, 0x7c69, 0x7c85, 0x7c9e, 0x7cb5,
+    0x7cdb, 0x7cde, 0x7ce0, 0x7ce4, 0x7ce5, 0x7cf7, 0x7cf9, 0x7cfa,
+    0x7d00, 0x7d02, 0x7d0b, 0x7d10, 0x7d19, 0x7d22, 0x7d30, 0x7d46,
+    0x7d51, 0x7d52, 0x7d73, 0x7d80, 0x7d8d, 0x7d91, 0x7d92, 0x7dba,
+    0x7dc3, 0x7dc8, 0x7dcc, 0x7dd4, 0x7e03, 0x7e0e, 0x7e1d, 0x7e35,
+    0x7e49, 0x7e53, 0x7e6c, 0x7f49, 0x7f52, 0x7f57, 0x7f65, 0x7f6e,
+    0x7f7e, 0x7f84, 0x7f89, 0x7f9d, 0x7fa1, 0x7fae, 0x7fb2, 0x7fb4,
+    0x7fc0, 0x7fd0, 0x7fdb, 0x7fe0, 0x7fe1, 0x7fe3, 0x7fe5, 0x7fed,
+    0x8013, 0x8016, 0x8036, 0x803a, 0x803e, 0x804f, 0x8052, 0x8057,
+    0x805d, 0x8069, 0x8081, 0x8092, 0x8094, 0x809a, 0x80ac, 0x80ae,
+    0x80dd, 0x80e5, 0x8146, 0x817c, 0x8180, 0x819d, 0x81a9, 0x81c8,
+    0x81ca, 0x81d3, 0x81d4, 0x81da, 0x81db, 0x81e5, 0x81e7, 0x81e8,
+    0x81e9, 0x81ed, 0x81f2, 0x81fe, 0x820a, 0x820c, 0x8219, 0x8252,
+    0x8257, 0x825e, 0x8279, 0x828c, 0x828f, 0x8291, 0x8293, 0x82b1,
+    0x82b3, 0x82b7, 0x82d1, 0x82e2, 0x82e3, 0x82e9, 0x82fc, 0x8316,
+    0x8329, 0x8332, 0x8357, 0x8366, 0x8369, 0x836a, 0x836e, 0x8378,
+    0x838b, 0x83a1, 0x83bc, 0x83cf, 0x83d2, 0x83ea, 0x840c, 0x8429,
+    0x8453, 0x8470, 0x8492, 0x84a1, 0x84ce, 0x8501, 0x857b, 0x858a,
+    0x858f, 0x85ad, 0x85af, 0x85bd, 0x85c5, 0x85e7, 0x860d, 0x8635,
+    0x863f, 0x8659, 0x86ab, 0x86db, 0x86fc, 0x8746, 0x879a, 0x8820,
+    0x882c, 0x8833, 0x8837, 0x883b, 0x8843, 0x8848, 0x888b, 0x88b5,
+    0x88bc, 0x88bd, 0x88c1, 0x88d9, 0x88e7, 0x895f, 0x8961, 0x8966,
+    0x896b, 0x896f, 0x8976, 0x898a, 0x899d, 0x89a0, 0x89b2, 0x89c3,
+    0x89e0, 0x89e2, 0x89e8, 0x89ea, 0x89ee, 0x89f3, 0x89f8, 0x89ff,
+    0x8a0a, 0x8a0d, 0x8a11, 0x8a14, 0x8a1a, 0x8a1b, 0x8a30, 0x8a35,
+    0x8a3e, 0x8a42, 0x8a46, 0x8a49, 0x8a51, 0x8a52, 0x8a53, 0x8a59,
+    0x8a6c, 0x8a6d, 0x8a75, 0x8a7e, 0x8a8a, 0x8a90, 0x8a92, 0x8a9f,
+    0x8aa7, 0x8aab, 0x8ab6, 0x8acd, 0x8ade, 0x8af9, 0x8afb, 0x8afd,
+    0x8b29, 0x8b38, 0x8b3a, 0x8b46, 0x8b50, 0x8b57, 0x8b60, 0x8b6a,
+    0x8b73, 0x8c26, 0x8c30, 0x8c4c, 0x8c73, 0x8c7d, 0x8c80, 0x8c81,
+    0x8c82, 0x8c88, 0x8c8a, 0x8c8c, 0x8c97, 0x8c98, 0x8c9b, 0x8c9c,
+    0x8c9f, 0x8ca0, 0x8ca4, 0x8ca7, 0x8cb3, 0x8cbe, 0x8cc2, 0x8cc3,
+    0x8cca, 0x8cd4, 0x8cdc, 0x8d6a, 0x8d7f, 0x8d83, 0x8d93, 0x8d94,
+    0x8dbf, 0x8dc8, 0x8dcf, 0x8dd3, 0x8e8b, 0x8eaa, 0x8ead, 0x8eb2,
+    0x8ee9, 0x8ef5, 0x8f09, 0x8f0a, 0x8f0f, 0x8f29, 0x8f83, 0x8f86,
+    0x8f8f, 0x8f91, 0x8f92, 0x8fae, 0x8fb1, 0x8fb4, 0x8fcb, 0x8fd4,
+    0x8fd7, 0x8fdd, 0x8fe0, 0x8fe1, 0x8ffa, 0x8ffb, 0x8fff, 0x9002,
+    0x9003, 0x9011, 0x9012, 0x9018, 0x902a, 0x902b, 0x902e, 0x9033,
+    0x9034, 0x9035, 0x9040, 0x9057, 0x9058, 0x905a, 0x9071, 0x9083,
+    0x9086, 0x9091, 0x9098, 0x90bd, 0x90c8, 0x90cd, 0x90dd, 0x90e9,
+    0x910d, 0x912d, 0x9132, 0x9145, 0x9167, 0x9172, 0x917c, 0x918b,
+    0x91ab, 0x91ac, 0x91ad, 0x91ae, 0x91af, 0x91b1, 0x91c3, 0x91fe,
+    0x921a, 0x9224, 0x9260, 0x9278, 0x9293, 0x92c4, 0x92cd, 0x92e4,
+    0x9300, 0x9302, 0x930b, 0x932b, 0x932d, 0x9376, 0x938e, 0x93c1,
+    0x9415, 0x9557, 0x9560, 0x9563, 0x956b, 0x9573, 0x95bc, 0x960a,
+    0x9612, 0x961f, 0x9624, 0x962d, 0x9630, 0x9642, 0x9644, 0x964a,
+    0x9653, 0x9656, 0x9658, 0x965d, 0x9665, 0x9666, 0x966e, 0x9674,
+    0x967b, 0x968a, 0x9691, 0x96a4, 0x96a5, 0x96a6, 0x96b9, 0x96bc,
+    0x96be, 0x96c2, 0x96c3, 0x96c8, 0x96ca, 0x96cf, 0x96d2, 0x96d7,
+    0x96db, 0x96e6, 0x96f6, 0x9712, 0x9718, 0x971e, 0x9728, 0x9732,
+    0x973c, 0x9742, 0x9749, 0x9754, 0x97b3, 0x97d3, 0x97d6, 0x97db,
+    0x97df, 0x97e5, 0x97ec, 0x97f0, 0x97f8, 0x980d, 0x982c, 0x982d,
+    0x982f, 0x9838, 0x983e, 0x9847, 0x984f, 0x9888, 0x98bb, 0x98bf,
+    0x98cf, 0x98d2, 0x98ea, 0x98f0, 0x9908, 0x9915, 0x9937, 0x9976,
+    0x9979, 0x998c, 0x9993, 0x99b0, 0x99b5, 0x9a35, 0x9a37, 0x9ab4,
+    0x9ab8, 0x9ace, 0x9b05, 0x9b22, 0x9b3a, 0x9b4f, 0x9b57, 0x9b8e,
+    0x9cc5, 0x9cd3, 0x9d08, 0x9d1b, 0x9d3d, 0x9d4c, 0x9e59, 0x9e5d,
+    0x9e72, 0x9e77, 0x9e85, 0x9e95, 0x9e9c, 0x9ea3, 0x9eb1, 0x9eb4,
+    0x9eb8, 0x9ebe, 0x9ec8, 0x9eee, 0x9f1b, 0x9f2a, 0x9f32, 0x9f41,
+    0x9f6d, 0x9f7c, 0xfee1, 0xfee8, 0xfee9, 0xfeec, 0xfefa, 0xfeff,
+    0xff3e,
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 65343, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 1417, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    ALL CUSTOM DATA
+ *----------------*/
+
+/*Store all the custom data of the font*/
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 1,
+    .bpp = 1,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *    PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t jf_openhuninn_2_1_30 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 30,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = NULL,
+    .user_data = NULL,
+};
@@ -0,0 +1,266 @@
+#include "text_layout.h"
+#include <string.h>
+#include "mem_policy.h"
+#include "esp_log.h"
+#include "src/misc/lv_text_private.h"
+
+static const char *TAG = "text_layout";
+
+#define HASH_BUCKETS    64
+
+// One layout. refs > 0 while a label shows it; cached is false for layouts
+// with missing glyphs, which are freed on release instead of kept.
+typedef struct layout_entry {
+    text_layout_t layout;           // first, so the public pointer is the entry
+    struct layout_entry *hash_next;
+    struct layout_entry *lru_prev;  // towards the most recently used
+    struct layout_entry *lru_next;
+    uint32_t hash;
+    const lv_font_t *font;
+    int32_t max_width;
+    uint8_t max_lines;
+    uint16_t refs;
+    bool cached;
+    size_t size;
+} layout_entry_t;
+
+static layout_entry_t *s_buckets[HASH_BUCKETS];
+static layout_entry_t *s_lru_head = NULL;
+static layout_entry_t *s_lru_tail = NULL;
+static text_layout_stats_t s_stats;
+
+// FNV-1a over the text, mixed with the rest of the key
+static uint32_t hash_of(const char *text, const lv_font_t *font, int32_t width, int max_lines)
+{
+    uint32_t h = 2166136261u;
+    for (const uint8_t *p = (const uint8_t *)text; *p; p++) {
+        h = (h ^ *p) * 16777619u;
+    }
+    h ^= (uint32_t)(uintptr_t)font * 2654435761u;
+    h ^= (uint32_t)width << 8 ^ (uint32_t)max_lines;
+    return h;
+}
+
+static void lru_unlink(layout_entry_t *e)
+{
+    if (e->lru_prev) {
+        e->lru_prev->lru_next = e->lru_next;
+    } else {
+        s_lru_head = e->lru_next;
+    }
+    if (e->lru_next) {
+        e->lru_next->lru_prev = e->lru_prev;
+    } else {
+        s_lru_tail = e->lru_prev;
+    }
+    e->lru_prev = e->lru_next = NULL;
+}
+
+static void lru_push_front(layout_entry_t *e)
+{
+    e->lru_prev = NULL;
+    e->lru_next = s_lru_head;
+    if (s_lru_head) {
+        s_lru_head->lru_prev = e;
+    }
+    s_lru_head = e;
+    if (s_lru_tail == NULL) {
+        s_lru_tail = e;
+    }
+}
+
+static void evict(layout_entry_t *e)
+{
+    layout_entry_t **p = &s_buckets[e->hash % HASH_BUCKETS];
+    while (*p != e) {
+        p = &(*p)->hash_next;
+    }
+    *p = e->hash_next;
+    lru_unlink(e);
+    s_stats.bytes -= e->size;
+    s_stats.entries--;
+    s_stats.evictions++;
+    mem_free(MEM_TAG_EVENT_STORE, e);
+}
+
+// Evicts least recently used layouts nobody shows until one more fits
+static void make_room(void)
+{
+    layout_entry_t *e = s_lru_tail;
+    while (e && s_stats.entries >= TEXT_LAYOUT_CACHE_ENTRIES) {
+        layout_entry_t *prev = e->lru_prev;
+        if (e->refs == 0) {
+            evict(e);
+        }
+        e = prev;
+    }
+}
+
+// Advance of the glyph at text[*i]; moves *i past it. Sets *missing if the font has no glyph.
+static int32_t next_advance(const char *text, uint32_t *i, const lv_font_t *font, bool *missing)
+{
+    uint32_t letter, letter_next;
+    lv_text_encoded_letter_next_2(text, &letter, &letter_next, i);
+    lv_font_glyph_dsc_t dsc;
+    if (!lv_font_get_glyph_dsc(font, &dsc, letter, letter_next)) {
+        *missing = true;
+    }
+    return lv_font_get_glyph_width(font, letter, letter_next);
+}
+
+// Breaks the lines the way lv_label does and cuts the last one to fit an
+// ellipsis; writes the result to out, which has room for the text plus
+// max_lines newlines and an ellipsis
+static void layout_text(layout_entry_t *e, const char *text, char *out)
+{
+    const lv_font_t *font = e->font;
+    // U+2026 if the font has it, three dots like lv_label otherwise
+    lv_font_glyph_dsc_t dsc;
+    const char *ellipsis = lv_font_get_glyph_dsc(font, &dsc, 0x2026, 0) ? "\xE2\x80\xA6" : "...";
+    bool missing = false;
+    size_t n = 0;
+    uint32_t pos = 0;
+    e->layout.width = 0;
+    e->layout.line_count = 0;
+    e->layout.truncated = false;
+
+    while (text[pos] != '\0' && e->layout.line_count < e->max_lines) {
+        uint32_t len = lv_text_get_next_line(&text[pos], font, 0, e->max_width, NULL, LV_TEXT_FLAG_NONE);
+        if (len == 0) {
+            break;
+        }
+        uint32_t end = pos + len;
+        while (end > pos && (text[end - 1] == '\n' || text[end - 1] == '\r')) {
+            end--;
+        }
+        bool last = e->layout.line_count + 1 == e->max_lines && text[pos + len] != '\0';
+        // The ellipsis does not count as missing: subset fonts often lack
+        // it and the dots, and the layout is the same once they arrive
+        int32_t ellipsis_w = 0;
+        if (last) {
+            bool ignored = false;
+            for (uint32_t j = 0; ellipsis[j];) {
+                ellipsis_w += next_advance(ellipsis, &j, font, &ignored);
+            }
+        }
+
+        int32_t line_w = 0;
+        uint32_t i = pos;
+        while (i < end) {
+            uint32_t next = i;
+            int32_t adv = next_advance(text, &next, font, &missing);
+            if (last && line_w + adv + ellipsis_w > e->max_width) {
+                break;
+            }
+            line_w += adv;
+            i = next;
+        }
+        if (e->layout.line_count > 0) {
+            out[n++] = '\n';
+        }
+        memcpy(&out[n], &text[pos], i - pos);
+        n += i - pos;
+        if (last) {
+            strcpy(&out[n], ellipsis);
+            n += strlen(ellipsis);
+            line_w += ellipsis_w;
+            e->layout.truncated = true;
+        }
+        if (line_w > e->layout.width) {
+            e->layout.width = line_w;
+        }
+        e->layout.line_count++;
+        pos += len;
+    }
+    out[n] = '\0';
+    e->cached = !missing;
+}
+
+const text_layout_t *text_layout_get(const char *text, const lv_font_t *font, int32_t width, int max_lines)
+{
+    if (max_lines < 1) {
+        max_lines = 1;
+    } else if (max_lines > UINT8_MAX) {
+        max_lines = UINT8_MAX;
+    }
+    uint32_t hash = hash_of(text, font, width, max_lines);
+    for (layout_entry_t *e = s_buckets[hash % HASH_BUCKETS]; e; e = e->hash_next) {
+        if (e->hash == hash && e->font == font && e->max_width == width && e->max_lines == max_lines &&
+            strcmp(e->layout.source, text) == 0) {
+            s_stats.hits++;
+            e->refs++;
+            if (s_lru_head != e) {
+                lru_unlink(e);
+                lru_push_front(e);
+            }
+            return &e->layout;
+        }
+    }
+
+    s_stats.misses++;
+    make_room();
+    size_t len = strlen(text);
+    size_t size = sizeof(layout_entry_t) + (len + 1) + (len + max_lines + 4);
+    layout_entry_t *e = mem_calloc(MEM_TAG_EVENT_STORE, 1, size);
+    if (e == NULL) {
+        ESP_LOGE(TAG, "Out of memory for a %u byte layout", (unsigned)size);
+        return NULL;
+    }
+    e->hash = hash;
+    e->font = font;
+    e->max_width = width;
+    e->max_lines = max_lines;
+    e->refs = 1;
+    e->size = size;
+    // The text as given, then the laid out text
+    char *source = (char *)(e + 1);
+    memcpy(source, text, len + 1);
+    char *out = source + len + 1;
+    layout_text(e, text, out);
+    e->layout.source = source;
+    e->layout.text = out;
+
+    if (e->cached) {
+        uint32_t h = hash % HASH_BUCKETS;
+        e->hash_next = s_buckets[h];
+        s_buckets[h] = e;
+        lru_push_front(e);
+        s_stats.entries++;
+        s_stats.bytes += size;
+    }
+    return &e->layout;
+}
+
+void text_layout_release(const text_layout_t *layout)
+{
+    if (layout == NULL) {
+        return;
+    }
+    layout_entry_t *e = (layout_entry_t *)layout;
+    if (e->refs > 0) {
+        e->refs--;
+    }
+    if (e->refs == 0 && !e->cached) {
+        mem_free(MEM_TAG_EVENT_STORE, e);
+    }
+}
+
+void text_layout_get_stats(text_layout_stats_t *stats)
+{
+    *stats = s_stats;
+}
+
+void text_layout_reset_stats(void)
+{
+    s_stats.hits = s_stats.misses = 0;
+    s_stats.evictions = 0;
+}
+
+void text_layout_log_stats(void)
+{
+    uint32_t lookups = s_stats.hits + s_stats.misses;
+    ESP_LOGI(TAG, "layouts %lu/%lu hit (%lu%%), %lu evicted, %lu entries, %u bytes",
+             (unsigned long)s_stats.hits, (unsigned long)lookups,
+             (unsigned long)(lookups ? s_stats.hits * 100 / lookups : 0),
+             (unsigned long)s_stats.evictions, (unsigned long)s_stats.entries, (unsigned)s_stats.bytes);
+}
@@ -0,0 +1,50 @@
+#ifndef _TEXT_LAYOUT_H_
+#define _TEXT_LAYOUT_H_
+
+// Cached text layouts for labels whose text repeats, like event titles.
+//
+// A layout is the text broken into lines for a width, cut with an ellipsis
+// after max_lines, keyed by (text hash, font, width, max_lines). The laid out
+// text has the line breaks as '\n', so it is drawn with LV_TEXT_FLAG_FIT and
+// LVGL only looks for the newlines instead of measuring every glyph again on
+// each draw. Layouts with glyphs the font does not have are not kept, since
+// their advances change once the glyphs arrive (glyph_fetch).
+//
+// Not thread safe: use from the LVGL task only.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+#define TEXT_LAYOUT_CACHE_ENTRIES   64
+
+typedef struct {
+    const char *source;         // the text as given
+    const char *text;           // lines separated by '\n', ellipsis applied
+    int32_t width;              // widest line, px
+    uint8_t line_count;
+    bool truncated;
+} text_layout_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;            // layouts computed
+    uint32_t evictions;
+    uint32_t entries;
+    size_t bytes;
+} text_layout_stats_t;
+
+/**
+ * The layout of text in width px with at most max_lines lines. Valid until
+ * released; the cache keeps the least recently used unreferenced layouts.
+ * Returns NULL if out of memory.
+ */
+const text_layout_t *text_layout_get(const char *text, const lv_font_t *font, int32_t width, int max_lines);
+
+void text_layout_release(const text_layout_t *layout);
+
+void text_layout_get_stats(text_layout_stats_t *stats);
+void text_layout_reset_stats(void);
+void text_layout_log_stats(void);
+
+#endif
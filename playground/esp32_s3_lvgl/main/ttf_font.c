@@ -0,0 +1,357 @@
+#include "ttf_font.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "mem_policy.h"
+#include "esp_log.h"
+
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "libs/tiny_ttf/stb_truetype_htcw.h"
+
+static const char *TAG = "ttf_font";
+
+#define HASH_BUCKETS    256
+// Glyph entries in the pool per byte of budget; more come from the heap
+#define POOL_BYTES_PER_ENTRY    1024
+
+struct ttf_face {
+    stbtt_fontinfo info;
+    int ascent;
+    int descent;
+    int line_gap;
+};
+
+typedef struct {
+    ttf_face_t *face;
+    float scale;
+} ttf_font_dsc_t;
+
+// One glyph of one font. Metrics are filled on the first lookup, the bitmap
+// on the first draw. refs > 0 while LVGL draws from the bitmap.
+typedef struct glyph_entry {
+    struct glyph_entry *hash_next;
+    struct glyph_entry *lru_prev;   // towards the most recently used
+    struct glyph_entry *lru_next;
+    const lv_font_t *font;
+    uint32_t codepoint;
+    int glyph;
+    int advw;                       // font units, for kerning
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint16_t refs;
+    size_t bitmap_size;
+    uint8_t *bitmap;
+    lv_draw_buf_t draw_buf;
+} glyph_entry_t;
+
+static glyph_entry_t *s_buckets[HASH_BUCKETS];
+static glyph_entry_t *s_lru_head = NULL;
+static glyph_entry_t *s_lru_tail = NULL;
+// Until ttf_cache_init() every entry comes from the heap
+static mem_pool_t s_entry_pool = { .tag = MEM_TAG_FONT_CACHE, .block_size = sizeof(glyph_entry_t) };
+static ttf_cache_stats_t s_stats = { .budget = TTF_CACHE_DEFAULT_BUDGET };
+
+static inline uint32_t hash_of(const lv_font_t *font, uint32_t codepoint)
+{
+    uint32_t h = codepoint * 2654435761u ^ (uint32_t)(uintptr_t)font;
+    return (h ^ (h >> 16)) % HASH_BUCKETS;
+}
+
+static void lru_unlink(glyph_entry_t *e)
+{
+    if (e->lru_prev) {
+        e->lru_prev->lru_next = e->lru_next;
+    } else {
+        s_lru_head = e->lru_next;
+    }
+    if (e->lru_next) {
+        e->lru_next->lru_prev = e->lru_prev;
+    } else {
+        s_lru_tail = e->lru_prev;
+    }
+    e->lru_prev = e->lru_next = NULL;
+}
+
+static void lru_push_front(glyph_entry_t *e)
+{
+    e->lru_prev = NULL;
+    e->lru_next = s_lru_head;
+    if (s_lru_head) {
+        s_lru_head->lru_prev = e;
+    }
+    s_lru_head = e;
+    if (s_lru_tail == NULL) {
+        s_lru_tail = e;
+    }
+}
+
+static void touch(glyph_entry_t *e)
+{
+    if (s_lru_head != e) {
+        lru_unlink(e);
+        lru_push_front(e);
+    }
+}
+
+static void account(long delta)
+{
+    s_stats.bytes += delta;
+    if (s_stats.bytes > s_stats.peak_bytes) {
+        s_stats.peak_bytes = s_stats.bytes;
+    }
+}
+
+static void evict(glyph_entry_t *e)
+{
+    glyph_entry_t **p = &s_buckets[hash_of(e->font, e->codepoint)];
+    while (*p != e) {
+        p = &(*p)->hash_next;
+    }
+    *p = e->hash_next;
+    lru_unlink(e);
+    account(-(long)(sizeof(glyph_entry_t) + e->bitmap_size));
+    mem_free(MEM_TAG_FONT_CACHE, e->bitmap);
+    mem_pool_free(&s_entry_pool, e);
+    s_stats.entries--;
+    s_stats.evictions++;
+}
+
+// Evicts least recently used glyphs that are not being drawn until size
+// more bytes fit the budget. Pinned glyphs may leave the cache over budget.
+static void make_room(size_t size)
+{
+    glyph_entry_t *e = s_lru_tail;
+    while (e && s_stats.bytes + size > s_stats.budget) {
+        glyph_entry_t *prev = e->lru_prev;
+        if (e->refs == 0) {
+            evict(e);
+        }
+        e = prev;
+    }
+}
+
+static glyph_entry_t *lookup(const lv_font_t *font, uint32_t codepoint)
+{
+    for (glyph_entry_t *e = s_buckets[hash_of(font, codepoint)]; e; e = e->hash_next) {
+        if (e->font == font && e->codepoint == codepoint) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static glyph_entry_t *get_entry(const lv_font_t *font, uint32_t codepoint)
+{
+    glyph_entry_t *e = lookup(font, codepoint);
+    if (e) {
+        s_stats.glyph_hits++;
+        touch(e);
+        return e;
+    }
+
+    const ttf_font_dsc_t *dsc = font->dsc;
+    const stbtt_fontinfo *info = &dsc->face->info;
+    int glyph = stbtt_FindGlyphIndex(info, (int)codepoint);
+    if (glyph == 0) {
+        return NULL;
+    }
+    s_stats.glyph_misses++;
+
+    make_room(sizeof(glyph_entry_t));
+    e = mem_pool_alloc(&s_entry_pool);
+    if (e == NULL) {
+        ESP_LOGE(TAG, "Out of memory for glyph U+%04lX", (unsigned long)codepoint);
+        return NULL;
+    }
+    memset(e, 0, sizeof(glyph_entry_t));
+    e->font = font;
+    e->codepoint = codepoint;
+    e->glyph = glyph;
+
+    int x1, y1, x2, y2, lsb;
+    stbtt_GetGlyphBitmapBox(info, glyph, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    stbtt_GetGlyphHMetrics(info, glyph, &e->advw, &lsb);
+    // Same placement as tiny_ttf (which reserves an always empty extra row
+    // and column) so layouts do not move when switching font backends
+    e->adv_w = (uint16_t)floorf(e->advw * dsc->scale + 0.5f);
+    e->box_w = x2 > x1 ? x2 - x1 : 0;
+    e->box_h = y2 > y1 ? y2 - y1 : 0;
+    e->ofs_x = x1;
+    e->ofs_y = 1 - y2;
+
+    uint32_t h = hash_of(font, codepoint);
+    e->hash_next = s_buckets[h];
+    s_buckets[h] = e;
+    lru_push_front(e);
+    s_stats.entries++;
+    account(sizeof(glyph_entry_t));
+    return e;
+}
+
+static bool get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                             uint32_t letter_next)
+{
+    glyph_entry_t *e = get_entry(font, letter);
+    if (e == NULL) {
+        return false;
+    }
+    const ttf_font_dsc_t *dsc = font->dsc;
+    dsc_out->adv_w = e->adv_w;
+    if (letter_next) {
+        int next = stbtt_FindGlyphIndex(&dsc->face->info, (int)letter_next);
+        int k = next ? stbtt_GetGlyphKernAdvance(&dsc->face->info, e->glyph, next) : 0;
+        if (k) {
+            dsc_out->adv_w = (uint16_t)floorf((e->advw + k) * dsc->scale + 0.5f);
+        }
+    }
+    dsc_out->box_w = e->box_w;
+    dsc_out->box_h = e->box_h;
+    dsc_out->ofs_x = e->ofs_x;
+    dsc_out->ofs_y = e->ofs_y;
+    dsc_out->format = LV_FONT_GLYPH_FORMAT_A8;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = letter;
+    dsc_out->entry = NULL;
+    return true;
+}
+
+static const void *get_glyph_bitmap_cb(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf)
+{
+    LV_UNUSED(draw_buf);
+    const lv_font_t *font = g_dsc->resolved_font;
+    glyph_entry_t *e = lookup(font, g_dsc->gid.index);
+    if (e) {
+        touch(e);
+    } else {
+        // Evicted since the glyph was measured
+        e = get_entry(font, g_dsc->gid.index);
+    }
+    if (e == NULL || e->box_w == 0 || e->box_h == 0) {
+        return NULL;
+    }
+
+    if (e->bitmap) {
+        s_stats.bitmap_hits++;
+    } else {
+        s_stats.bitmap_misses++;
+        uint32_t stride = lv_draw_buf_width_to_stride(e->box_w, LV_COLOR_FORMAT_A8);
+        size_t size = (size_t)stride * e->box_h;
+        e->refs++;
+        make_room(size);
+        e->refs--;
+        e->bitmap = mem_alloc(MEM_TAG_FONT_CACHE, size);  // aligned to LV_DRAW_BUF_ALIGN
+        if (e->bitmap == NULL) {
+            ESP_LOGE(TAG, "Out of memory for a %ux%u glyph", e->box_w, e->box_h);
+            return NULL;
+        }
+        const ttf_font_dsc_t *dsc = font->dsc;
+        stbtt_MakeGlyphBitmap(&dsc->face->info, e->bitmap, e->box_w, e->box_h, stride,
+                              dsc->scale, dsc->scale, e->glyph);
+        lv_draw_buf_init(&e->draw_buf, e->box_w, e->box_h, LV_COLOR_FORMAT_A8, stride, e->bitmap, size);
+        e->bitmap_size = size;
+        account(size);
+    }
+    e->refs++;
+    g_dsc->entry = (lv_cache_entry_t *)e;
+    return &e->draw_buf;
+}
+
+static void release_glyph_cb(const lv_font_t *font, lv_font_glyph_dsc_t *g_dsc)
+{
+    LV_UNUSED(font);
+    glyph_entry_t *e = (glyph_entry_t *)g_dsc->entry;
+    if (e && e->refs) {
+        e->refs--;
+    }
+    g_dsc->entry = NULL;
+}
+
+esp_err_t ttf_cache_init(size_t budget)
+{
+    if (budget < sizeof(glyph_entry_t)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_entry_pool.base == NULL) {
+        uint32_t count = budget / POOL_BYTES_PER_ENTRY;
+        if (mem_pool_init(&s_entry_pool, "ttf glyph entries", MEM_TAG_FONT_CACHE, sizeof(glyph_entry_t),
+                          count ? count : 1) != ESP_OK) {
+            ESP_LOGW(TAG, "No pool for glyph entries, using the heap");
+        }
+    }
+    s_stats.budget = budget;
+    make_room(0);
+    ESP_LOGI(TAG, "Glyph cache %u KB (%s)", (unsigned)(budget / 1024), mem_tag_name(MEM_TAG_FONT_CACHE));
+    return ESP_OK;
+}
+
+ttf_face_t *ttf_face_create(const uint8_t *data, size_t size)
+{
+    ttf_face_t *face = calloc(1, sizeof(ttf_face_t));
+    if (face == NULL) {
+        return NULL;
+    }
+    int offset = stbtt_GetFontOffsetForIndex(data, 0);
+    if (offset < 0 || (size_t)offset >= size || !stbtt_InitFont(&face->info, data, offset)) {
+        ESP_LOGE(TAG, "Not a TrueType font");
+        free(face);
+        return NULL;
+    }
+    stbtt_GetFontVMetrics(&face->info, &face->ascent, &face->descent, &face->line_gap);
+    return face;
+}
+
+lv_font_t *ttf_font_create(ttf_face_t *face, int32_t px)
+{
+    if (face == NULL || px <= 0) {
+        return NULL;
+    }
+    lv_font_t *font = calloc(1, sizeof(lv_font_t) + sizeof(ttf_font_dsc_t));
+    if (font == NULL) {
+        return NULL;
+    }
+    ttf_font_dsc_t *dsc = (ttf_font_dsc_t *)(font + 1);
+    dsc->face = face;
+    dsc->scale = stbtt_ScaleForMappingEmToPixels(&face->info, (float)px);
+
+    font->get_glyph_dsc = get_glyph_dsc_cb;
+    font->get_glyph_bitmap = get_glyph_bitmap_cb;
+    font->release_glyph = release_glyph_cb;
+    font->line_height = (int32_t)(dsc->scale * (face->ascent - face->descent + face->line_gap));
+    font->base_line = (int32_t)(dsc->scale * (face->line_gap - face->descent));
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->kerning = LV_FONT_KERNING_NORMAL;
+    font->underline_position = (int8_t)floorf(-dsc->scale * (face->ascent - face->descent) / 20);
+    font->underline_thickness = px / 15 > 0 ? px / 15 : 1;
+    font->dsc = dsc;
+    return font;
+}
+
+void ttf_cache_get_stats(ttf_cache_stats_t *stats)
+{
+    *stats = s_stats;
+}
+
+void ttf_cache_reset_stats(void)
+{
+    s_stats.glyph_hits = s_stats.glyph_misses = 0;
+    s_stats.bitmap_hits = s_stats.bitmap_misses = 0;
+    s_stats.evictions = 0;
+    s_stats.peak_bytes = s_stats.bytes;
+}
+
+void ttf_cache_log_stats(void)
+{
+    uint32_t lookups = s_stats.bitmap_hits + s_stats.bitmap_misses;
+    ESP_LOGI(TAG, "glyphs %lu/%lu hit, bitmaps %lu/%lu hit (%lu%%), %lu evicted, "
+             "%lu entries, %u/%u KB (peak %u KB)",
+             (unsigned long)s_stats.glyph_hits, (unsigned long)(s_stats.glyph_hits + s_stats.glyph_misses),
+             (unsigned long)s_stats.bitmap_hits, (unsigned long)lookups,
+             (unsigned long)(lookups ? s_stats.bitmap_hits * 100 / lookups : 0),
+             (unsigned long)s_stats.evictions, (unsigned long)s_stats.entries,
+             (unsigned)(s_stats.bytes / 1024), (unsigned)(s_stats.budget / 1024),
+             (unsigned)(s_stats.peak_bytes / 1024));
+}
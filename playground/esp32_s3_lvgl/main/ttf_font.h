@@ -0,0 +1,53 @@
+#ifndef _TTF_FONT_H_
+#define _TTF_FONT_H_
+
+// TrueType fonts for LVGL with one parsed face shared by every size and one
+// byte-budgeted glyph cache shared by every font. Replaces the per-instance
+// tiny_ttf caches, which parse the TTF once per size and size their caches
+// by entry count. Glyphs are rasterized by the same stb_truetype as tiny_ttf
+// and placed the same way.
+//
+// Not thread safe: create fonts and draw with them from the LVGL task only.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#define TTF_CACHE_DEFAULT_BUDGET    (256 * 1024)
+
+typedef struct ttf_face ttf_face_t;
+
+typedef struct {
+    uint32_t glyph_hits;        // metrics lookups served from the cache
+    uint32_t glyph_misses;
+    uint32_t bitmap_hits;       // bitmap lookups served from the cache
+    uint32_t bitmap_misses;     // bitmaps rasterized
+    uint32_t evictions;
+    uint32_t entries;
+    size_t bytes;               // entries plus bitmaps
+    size_t peak_bytes;
+    size_t budget;
+} ttf_cache_stats_t;
+
+/**
+ * Sets up the shared cache. budget counts glyph bitmaps plus per-glyph
+ * bookkeeping; least recently used glyphs are evicted above it. Where the
+ * cache lives is MEM_TAG_FONT_CACHE of mem_policy; the glyph entries come from
+ * a pool sized by the budget.
+ * Fonts created before this call use TTF_CACHE_DEFAULT_BUDGET without the pool.
+ */
+esp_err_t ttf_cache_init(size_t budget);
+
+// Parses the TTF once. data must stay valid for the lifetime of the face.
+ttf_face_t *ttf_face_create(const uint8_t *data, size_t size);
+
+// A font of the face at px (em size, as lv_tiny_ttf_create_data)
+lv_font_t *ttf_font_create(ttf_face_t *face, int32_t px);
+
+void ttf_cache_get_stats(ttf_cache_stats_t *stats);
+void ttf_cache_reset_stats(void);
+void ttf_cache_log_stats(void);
+
+#endif
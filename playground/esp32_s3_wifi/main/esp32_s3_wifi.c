@@ -5,9 +5,18 @@
 #include "nvs_flash.h"
 #include "esp_log.h"
 #include "wifi_manager.h" // Include the Wi-Fi manager header
+#include "sync_scheduler.h"
 
 static const char *TAG = "APP_MAIN";
 
+// Runs with Wi-Fi connected, once per sync
+static esp_err_t fetch_ics(void* arg)
+{
+    ESP_LOGI(TAG, "Fetching ICS data...");
+    // Add your ICS fetching and e-paper update here
+    return ESP_OK;
+}
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "Starting Application");
@@ -23,55 +32,16 @@ void app_main(void)
     // 2. Initialize Wi-Fi Manager
     ESP_ERROR_CHECK(wifi_manager_init());
 
-    // 3. Start Wi-Fi Connection Process
-    ESP_ERROR_CHECK(wifi_manager_start());
-
-    ESP_LOGI(TAG, "Waiting for Wi-Fi connection...");
-
-    // 4. Wait for connection (using event group or blocking call)
-    // Using Event Group (allows checking other things)
-    EventGroupHandle_t wifi_event_group = wifi_manager_get_event_group();
-    EventBits_t bits = xEventGroupWaitBits(wifi_event_group,
-                                           WIFI_MANAGER_CONNECTED_BIT | WIFI_MANAGER_DISCONNECTED_BIT,
-                                           pdFALSE, // Don't clear
-                                           pdFALSE, // Wait for either
-                                           portMAX_DELAY); // Wait forever
-
-    esp_err_t wifi_status;
-    if (bits & WIFI_MANAGER_CONNECTED_BIT) {
-         ESP_LOGI(TAG, "Wi-Fi Connected!");
-         wifi_status = ESP_OK;
-    } else if (bits & WIFI_MANAGER_DISCONNECTED_BIT) {
-         ESP_LOGE(TAG, "Wi-Fi connection failed permanently.");
-          wifi_status = ESP_FAIL;
-    } else {
-          ESP_LOGE(TAG, "Unexpected state waiting for Wi-Fi connection.");
-          wifi_status = ESP_FAIL; // Or some other error
-    }
-
-    // 5. Proceed based on connection status
-    if (wifi_status == ESP_OK) {
-        ESP_LOGI(TAG, "Connected successfully. Starting main application tasks.");
-
-        // --- Your Main Application Loop ---
-        while (1) {
-            // Check Wi-Fi state periodically if needed
-            if (wifi_manager_get_state() == WIFI_STATE_CONNECTED) {
-                ESP_LOGI(TAG, "Main loop: Fetching ICS data...");
-                // Add your ICS fetching, e-paper update, and sleep logic here
-            } else {
-                 ESP_LOGW(TAG, "Main loop: Wi-Fi disconnected. Waiting for reconnect...");
-                 // Maybe wait for connection bit again or handle error
-                 // For now, just delay
-            }
-            vTaskDelay(pdMS_TO_TICKS(60 * 1000)); // Example: Run every minute
-        }
-        // --- End Main Loop ---
-
-    } else {
-        ESP_LOGE(TAG, "Failed to connect to Wi-Fi after all attempts.");
-        // Handle persistent failure: Deep sleep? Display error? Restart?
-        ESP_LOGE(TAG, "Halting application.");
-         vTaskDelay(portMAX_DELAY); // Halt
+    // 3. Sync on a schedule: the scheduler brings Wi-Fi up for each sync
+    //    (provisioning first if there are no credentials) and stops it after
+    sync_scheduler_config_t sync_config = SYNC_SCHEDULER_CONFIG_DEFAULT();
+    sync_config.sync = fetch_ics;
+    ESP_ERROR_CHECK(sync_scheduler_start(&sync_config));
+
+    // 4. Report the radio cost per sync and the event loop latency now and then
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(60 * 60 * 1000));
+        sync_scheduler_log_stats();
+        wifi_manager_log_event_latency();
     }
-}
\ No newline at end of file
+}
@@ -15,6 +15,9 @@
 #include <esp_http_server.h>
 #include <ctype.h>
 #include "esp_mac.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include <stdlib.h>
 
 static const char *TAG = "SOFTAP_PROV";
 
@@ -24,10 +27,56 @@ static const char *TAG = "SOFTAP_PROV";
 #define PROV_ESP_WIFI_AP_CHANNEL   1
 #define PROV_ESP_MAX_STA_CONN      1
 
+#define PROV_CONNECT_TIMEOUT_MS    20000 // Submitted network must hand out an IP by then
+#define PROV_REPORT_WAIT_MS        5000  // Keep the AP up this long for the browser to fetch the result
+#define PROV_REPORT_MOVED_WAIT_MS  30000 // Same, when the AP changed channel and the phone has to rejoin it
+#define PROV_SCAN_PERIOD_MS        20000 // Background scan interval while the portal is up
+#define PROV_SCAN_MAX_APS          20    // Networks kept in the scan list
+
 // --- Provisioning Event Group (內部同步用) ---
 static EventGroupHandle_t prov_event_group = NULL;
-const int PROV_DONE_BIT = BIT0; // Creds received and saved OK
-const int PROV_FAIL_BIT = BIT1; // Internal error during provisioning
+const int PROV_DONE_BIT = BIT0;     // Submitted credentials got an IP on the STA interface
+const int PROV_REPORTED_BIT = BIT1; // Browser fetched the final status
+const int PROV_STA_DOWN_BIT = BIT2; // Previous STA connection or attempt is gone
+
+// --- Live Credential Check (內部使用) ---
+// The portal runs in APSTA mode: /connect tries the submitted network on the
+// STA interface while the AP stays up, and the page polls /status for the
+// outcome. When the STA joins, the AP moves to the STA's channel. The phone
+// then loses the AP until it finds it on the new channel, which can take
+// several seconds; the page keeps polling through that, and the result is
+// kept up for PROV_REPORT_MOVED_WAIT_MS instead of PROV_REPORT_WAIT_MS so
+// the phone can still fetch it after rejoining.
+typedef enum {
+    PROV_TRY_IDLE,
+    PROV_TRY_CONNECTING,
+    PROV_TRY_CONNECTED,     // Connected and saved
+    PROV_TRY_FAILED,
+} prov_try_state_t;
+
+static SemaphoreHandle_t s_lock = NULL;        // Guards the try state, the scan list and s_scanning
+static prov_try_state_t s_try_state = PROV_TRY_IDLE;
+static const char* s_try_error = "";           // Why the last try failed
+static esp_ip4_addr_t s_try_ip;
+static char s_try_ssid[33];
+static char s_try_password[65];
+static esp_timer_handle_t s_try_timer = NULL;
+
+// --- Cached Scan List (內部使用) ---
+// Scanned in the background so /scan answers at once; one entry per SSID,
+// strongest AP first
+typedef struct {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    bool secured;
+} prov_scan_entry_t;
+
+static prov_scan_entry_t s_scan_list[PROV_SCAN_MAX_APS];
+static int s_scan_count = 0;
+static bool s_scanning = false;
+static esp_timer_handle_t s_scan_timer = NULL;
+static uint8_t s_ap_channel = 0;                // Channel the AP was started on
 
 // --- HTTP Server Handle (內部使用) ---
 static httpd_handle_t server = NULL;
@@ -37,29 +86,53 @@ static esp_netif_t *prov_ap_netif = NULL; // Hold the netif pointer for cleanup
 static void url_decode_helper(const char* src, char* dst, size_t dst_size);
 static esp_err_t root_get_handler(httpd_req_t *req);
 static esp_err_t connect_post_handler(httpd_req_t *req);
+static esp_err_t status_get_handler(httpd_req_t *req);
+static esp_err_t scan_get_handler(httpd_req_t *req);
 static esp_err_t start_webserver(void);
 static void stop_webserver(void);
 static void softap_prov_ap_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
+static void softap_prov_sta_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
 static esp_err_t softap_prov_init_wifi(void);
-static void softap_prov_deinit_wifi(void);
+static void softap_prov_deinit_wifi(bool keep_sta);
 
 // --- HTML Form ---
 static const char* html_form =
     "<!DOCTYPE html><html><head><title>ESP32 Wi-Fi Setup</title>"
     "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
     "<style> body { font-family: Arial, sans-serif; } "
-    "label, input { display: block; margin-bottom: 10px; width: 90%%; max-width: 300px; } "
+    "label, input { display: block; margin-bottom: 10px; width: 90%; max-width: 300px; } "
     "input[type='text'], input[type='password'] { padding: 8px; } "
     "button { padding: 10px 15px; background-color: #007bff; color: white; border: none; cursor: pointer; } "
     "</style></head><body>"
     "<h1>Wi-Fi Setup</h1>"
-    "<form method='post' action='/connect'>"
+    "<form id='f' method='post' action='/connect'>"
     "<label for='ssid'>Wi-Fi Network (SSID):</label>"
-    "<input type='text' id='ssid' name='ssid' required><br>"
+    "<input type='text' id='ssid' name='ssid' list='nets' required><br>"
+    "<datalist id='nets'></datalist>"
     "<label for='password'>Password:</label>"
     "<input type='password' id='password' name='password'><br>"
     "<button type='submit'>Connect</button>"
-    "</form></body></html>";
+    "</form><p id='msg'></p>"
+    "<script>"
+    "var m=document.getElementById('msg');"
+    "function scan(){fetch('/scan').then(r=>r.json()).then(l=>{"
+    "if(!l.length){setTimeout(scan,2000);return;}"
+    "var d=document.getElementById('nets');d.innerHTML='';"
+    "l.forEach(n=>{var o=document.createElement('option');o.value=n.ssid;"
+    "o.label=n.rssi+' dBm'+(n.secure?'':', open');d.appendChild(o);});});}"
+    "function poll(){fetch('/status').then(r=>r.json()).then(s=>{"
+    "if(s.state=='connecting'){setTimeout(poll,1000);}"
+    "else if(s.state=='connected'){m.textContent='Connected ('+s.ip+'). Setup is complete.';}"
+    "else if(s.state=='failed'){m.textContent=s.error+'. Please try again.';}"
+    "}).catch(()=>{m.textContent='Connecting... if this page stays unreachable, rejoin "
+    PROV_ESP_WIFI_AP_SSID ".';setTimeout(poll,1000);});}"
+    "document.getElementById('f').onsubmit=function(e){e.preventDefault();"
+    "m.textContent='Connecting...';"
+    "fetch('/connect',{method:'POST',body:new URLSearchParams(new FormData(this))})"
+    ".then(r=>{if(r.ok)poll();else r.text().then(t=>m.textContent=t);})"
+    ".catch(()=>setTimeout(poll,1000));};"
+    "scan();"
+    "</script></body></html>";
 
 // --- Static URL Decode Helper ---
 static void url_decode_helper(const char* src, char* dst, size_t dst_size) {
@@ -88,6 +161,156 @@ static void url_decode_helper(const char* src, char* dst, size_t dst_size) {
     *dst = '\0';
 }
 
+// --- JSON Escape Helper ---
+// SSIDs are arbitrary bytes; quotes, backslashes and control characters are escaped
+static void json_escape_helper(const char* src, char* dst, size_t dst_size) {
+    size_t len = 0;
+    for (; *src && len + 7 < dst_size; src++) {
+        unsigned char c = (unsigned char)*src;
+        if (c == '"' || c == '\\') {
+            dst[len++] = '\\';
+            dst[len++] = c;
+        } else if (c < 0x20) {
+            len += snprintf(dst + len, dst_size - len, "\\u%04x", c);
+        } else {
+            dst[len++] = c;
+        }
+    }
+    dst[len] = '\0';
+}
+
+// --- Try State (Static) ---
+static void set_try_state(prov_try_state_t state, const char* error) {
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_try_state = state;
+    s_try_error = error ? error : "";
+    xSemaphoreGive(s_lock);
+}
+
+static const char* disconnect_reason_text(uint8_t reason) {
+    switch (reason) {
+        case WIFI_REASON_AUTH_FAIL:
+        case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+        case WIFI_REASON_HANDSHAKE_TIMEOUT:
+            return "Wrong password";
+        case WIFI_REASON_NO_AP_FOUND:
+            return "Network not found";
+        default:
+            return "Could not connect to the network";
+    }
+}
+
+// Runs in the esp_timer task when the submitted network gave no IP in time
+static void try_timeout_cb(void* arg) {
+    if (s_try_state != PROV_TRY_CONNECTING) {
+        return;
+    }
+    ESP_LOGW(TAG, "No IP from [%s] within %d ms", s_try_ssid, PROV_CONNECT_TIMEOUT_MS);
+    set_try_state(PROV_TRY_FAILED, "No answer from the network");
+    esp_wifi_disconnect();
+}
+
+// Tries the submitted network on the STA interface; the outcome arrives as events
+static esp_err_t start_try(void) {
+    esp_timer_stop(s_try_timer);
+
+    // Drop a previous connection or attempt first, so its disconnect event is
+    // not taken for the outcome
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK || s_try_state == PROV_TRY_CONNECTING) {
+        set_try_state(PROV_TRY_IDLE, NULL);
+        xEventGroupClearBits(prov_event_group, PROV_STA_DOWN_BIT);
+        esp_wifi_disconnect();
+        xEventGroupWaitBits(prov_event_group, PROV_STA_DOWN_BIT, pdTRUE, pdFALSE, pdMS_TO_TICKS(1000));
+    }
+
+    wifi_config_t wifi_config = { 0 };
+    strncpy((char*)wifi_config.sta.ssid, s_try_ssid, sizeof(wifi_config.sta.ssid) - 1);
+    strncpy((char*)wifi_config.sta.password, s_try_password, sizeof(wifi_config.sta.password) - 1);
+    wifi_config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+    wifi_config.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+
+    // Claims the radio: once the try is connecting, scan_timer_cb starts no
+    // new scan, and one in flight is aborted (the STA cannot connect during it)
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_scanning) {
+        esp_wifi_scan_stop();
+        s_scanning = false;
+    }
+    s_try_state = PROV_TRY_CONNECTING;
+    s_try_error = "";
+    for (int i = 0; i < s_scan_count; i++) {
+        if (strcmp(s_scan_list[i].ssid, s_try_ssid) == 0) {
+            wifi_config.sta.channel = s_scan_list[i].channel; // Searched first
+            break;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    esp_err_t err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+    if (err == ESP_OK) {
+        err = esp_wifi_connect();
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot try [%s] (%s)", s_try_ssid, esp_err_to_name(err));
+        set_try_state(PROV_TRY_FAILED, "Could not start the connection");
+        return err;
+    }
+    esp_timer_start_once(s_try_timer, PROV_CONNECT_TIMEOUT_MS * 1000);
+    ESP_LOGI(TAG, "Trying [%s]...", s_try_ssid);
+    return ESP_OK;
+}
+
+// --- Background Scan (Static) ---
+// Runs in the esp_timer task; skipped while a network is being tried
+static void scan_timer_cb(void* arg) {
+    wifi_scan_config_t scan_config = {
+        .show_hidden = false,
+        .scan_type = WIFI_SCAN_TYPE_ACTIVE,
+        .scan_time.active = { .min = 50, .max = 100 }, // Short dwell: the AP is off-channel meanwhile
+    };
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_scanning && s_try_state != PROV_TRY_CONNECTING &&
+        esp_wifi_scan_start(&scan_config, false) == ESP_OK) {
+        s_scanning = true;
+    }
+    xSemaphoreGive(s_lock);
+}
+
+// On the event loop: replaces the scan list with the results just in
+static void update_scan_list(void) {
+    uint16_t ap_count = PROV_SCAN_MAX_APS;
+    wifi_ap_record_t* records = calloc(ap_count, sizeof(wifi_ap_record_t));
+    if (records == NULL || esp_wifi_scan_get_ap_records(&ap_count, records) != ESP_OK) {
+        esp_wifi_clear_ap_list();
+        free(records);
+        return;
+    }
+
+    // Records come strongest first, so the first AP of each SSID is kept
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_scan_count = 0;
+    for (int i = 0; i < ap_count; i++) {
+        const char* ssid = (const char*)records[i].ssid;
+        bool seen = ssid[0] == '\0';
+        for (int j = 0; j < s_scan_count && !seen; j++) {
+            seen = strcmp(s_scan_list[j].ssid, ssid) == 0;
+        }
+        if (seen) {
+            continue;
+        }
+        prov_scan_entry_t* e = &s_scan_list[s_scan_count++];
+        strncpy(e->ssid, ssid, sizeof(e->ssid) - 1);
+        e->ssid[sizeof(e->ssid) - 1] = '\0';
+        e->rssi = records[i].rssi;
+        e->channel = records[i].primary;
+        e->secured = records[i].authmode != WIFI_AUTH_OPEN;
+    }
+    xSemaphoreGive(s_lock);
+    ESP_LOGD(TAG, "Scan list updated: %d networks", s_scan_count);
+    free(records);
+}
+
 // --- HTTP Handlers (Static) ---
 static esp_err_t root_get_handler(httpd_req_t *req) {
     ESP_LOGI(TAG, "Serving provisioning page");
@@ -101,17 +324,16 @@ static esp_err_t connect_post_handler(httpd_req_t *req) {
     int ret, remaining = req->content_len;
     memset(buf, 0, sizeof(buf));
 
+    // A bad request leaves the portal open for another try
     if (remaining >= sizeof(buf)) {
         ESP_LOGE(TAG, "POST Content too long (%d bytes)", remaining);
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Content too long");
-        if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_FAIL_BIT); // Signal internal failure
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Content too long");
         return ESP_FAIL;
     }
     ret = httpd_req_recv(req, buf, remaining);
      if (ret <= 0) {
         if (ret == HTTPD_SOCK_ERR_TIMEOUT) { httpd_resp_send_408(req); }
         ESP_LOGE(TAG, "Error receiving POST data (ret: %d)", ret);
-        if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_FAIL_BIT);
         return ESP_FAIL;
     }
     buf[ret] = '\0';
@@ -125,14 +347,12 @@ static esp_err_t connect_post_handler(httpd_req_t *req) {
     if (httpd_query_key_value(buf, "ssid", encoded_ssid, sizeof(encoded_ssid)) != ESP_OK || strlen(encoded_ssid) == 0) {
          ESP_LOGE(TAG, "SSID parameter is missing or empty in POST data.");
          httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing or empty SSID parameter");
-         if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_FAIL_BIT);
          return ESP_FAIL;
     }
     // Password can be empty, don't check error strictly for it
     httpd_query_key_value(buf, "password", encoded_password, sizeof(encoded_password));
 
     ESP_LOGD(TAG, "Value from httpd_query_key_value for SSID: [%s]", encoded_ssid);
-    ESP_LOGD(TAG, "Value from httpd_query_key_value for Password: [%s]", encoded_password);
 
     url_decode_helper(encoded_ssid, ssid, sizeof(ssid));
     url_decode_helper(encoded_password, password, sizeof(password));
@@ -143,25 +363,80 @@ static esp_err_t connect_post_handler(httpd_req_t *req) {
      if (strlen(ssid) == 0) { // Should not happen if parsing was OK, but double check
          ESP_LOGE(TAG, "Decoded SSID is empty.");
          httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Failed to decode SSID");
-         if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_FAIL_BIT);
          return ESP_FAIL;
      }
+    if (s_try_state == PROV_TRY_CONNECTED) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Already connected, setup is finishing");
+        return ESP_FAIL;
+    }
 
-    // --- Save Credentials using wifi_storage ---
-    esp_err_t save_err = save_wifi_credentials(ssid, password);
-    if (save_err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save Wi-Fi credentials (%s)", esp_err_to_name(save_err));
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save credentials");
-        if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_FAIL_BIT);
+    // --- Try the network; saved only once it hands out an IP ---
+    memcpy(s_try_ssid, ssid, sizeof(s_try_ssid));
+    memcpy(s_try_password, password, sizeof(s_try_password));
+    if (start_try() != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Could not start the connection");
         return ESP_FAIL;
     }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, "{\"state\":\"connecting\"}");
+    return ESP_OK;
+}
 
-    // --- Respond and Signal Success ---
-    const char* resp_str = "Credentials received. Setup will continue.";
-    httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
-    vTaskDelay(pdMS_TO_TICKS(100)); // Short delay for response
-    if(prov_event_group) xEventGroupSetBits(prov_event_group, PROV_DONE_BIT); // Signal success
+static esp_err_t status_get_handler(httpd_req_t *req) {
+    char ssid[33 * 6 + 1];
+    char resp[320];
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    prov_try_state_t state = s_try_state;
+    const char* error = s_try_error;
+    esp_ip4_addr_t ip = s_try_ip;
+    xSemaphoreGive(s_lock);
+
+    json_escape_helper(s_try_ssid, ssid, sizeof(ssid));
+    switch (state) {
+        case PROV_TRY_CONNECTING:
+            snprintf(resp, sizeof(resp), "{\"state\":\"connecting\",\"ssid\":\"%s\"}", ssid);
+            break;
+        case PROV_TRY_CONNECTED:
+            snprintf(resp, sizeof(resp), "{\"state\":\"connected\",\"ssid\":\"%s\",\"ip\":\"" IPSTR "\"}",
+                     ssid, IP2STR(&ip));
+            break;
+        case PROV_TRY_FAILED:
+            snprintf(resp, sizeof(resp), "{\"state\":\"failed\",\"ssid\":\"%s\",\"error\":\"%s\"}", ssid, error);
+            break;
+        default:
+            snprintf(resp, sizeof(resp), "{\"state\":\"idle\"}");
+            break;
+    }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_sendstr(req, resp);
+    if (state == PROV_TRY_CONNECTED && prov_event_group) {
+        xEventGroupSetBits(prov_event_group, PROV_REPORTED_BIT); // The AP may go now
+    }
+    return ESP_OK;
+}
 
+// Answers from the cached list; it is refreshed in the background
+static esp_err_t scan_get_handler(httpd_req_t *req) {
+    prov_scan_entry_t list[PROV_SCAN_MAX_APS];
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int count = s_scan_count;
+    memcpy(list, s_scan_list, count * sizeof(prov_scan_entry_t));
+    xSemaphoreGive(s_lock);
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_sendstr_chunk(req, "[");
+    for (int i = 0; i < count; i++) {
+        char ssid[33 * 6 + 1];
+        char item[256];
+        json_escape_helper(list[i].ssid, ssid, sizeof(ssid));
+        snprintf(item, sizeof(item), "%s{\"ssid\":\"%s\",\"rssi\":%d,\"secure\":%s}",
+                 i ? "," : "", ssid, list[i].rssi, list[i].secured ? "true" : "false");
+        httpd_resp_sendstr_chunk(req, item);
+    }
+    httpd_resp_sendstr_chunk(req, "]");
+    httpd_resp_sendstr_chunk(req, NULL);
     return ESP_OK;
 }
 
@@ -179,6 +454,20 @@ static const httpd_uri_t uri_post = {
     .user_ctx = NULL
 };
 
+static const httpd_uri_t uri_status = {
+    .uri      = "/status",
+    .method   = HTTP_GET,
+    .handler  = status_get_handler,
+    .user_ctx = NULL
+};
+
+static const httpd_uri_t uri_scan = {
+    .uri      = "/scan",
+    .method   = HTTP_GET,
+    .handler  = scan_get_handler,
+    .user_ctx = NULL
+};
+
 // --- Web Server Start/Stop (Static) ---
 static esp_err_t start_webserver(void) {
     if (server == NULL) {
@@ -188,6 +477,8 @@ static esp_err_t start_webserver(void) {
         if (httpd_start(&server, &config) == ESP_OK) {
             httpd_register_uri_handler(server, &uri_get);
             httpd_register_uri_handler(server, &uri_post);
+            httpd_register_uri_handler(server, &uri_status);
+            httpd_register_uri_handler(server, &uri_scan);
             ESP_LOGI(TAG, "HTTP server started.");
             return ESP_OK;
         } else {
@@ -220,6 +511,42 @@ static void softap_prov_ap_event_handler(void* arg, esp_event_base_t event_base,
     }
 }
 
+// --- STA Event Handler (Static) ---
+// The outcome of a try and the background scan; wifi_manager ignores STA
+// events while provisioning
+static void softap_prov_sta_event_handler(void* arg, esp_event_base_t event_base,
+                                          int32_t event_id, void* event_data) {
+    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_SCAN_DONE) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        bool ours = s_scanning;
+        s_scanning = false;
+        xSemaphoreGive(s_lock);
+        if (ours) {
+            update_scan_list();
+        }
+    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*) event_data;
+        if (s_try_state != PROV_TRY_CONNECTING) {
+            xEventGroupSetBits(prov_event_group, PROV_STA_DOWN_BIT);
+            return;
+        }
+        esp_timer_stop(s_try_timer);
+        ESP_LOGW(TAG, "Trying [%s] failed (reason %d)", s_try_ssid, event->reason);
+        set_try_state(PROV_TRY_FAILED, disconnect_reason_text(event->reason));
+    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
+        if (s_try_state != PROV_TRY_CONNECTING) {
+            return;
+        }
+        esp_timer_stop(s_try_timer);
+        ESP_LOGI(TAG, "[%s] works, got IP " IPSTR, s_try_ssid, IP2STR(&event->ip_info.ip));
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_try_ip = event->ip_info.ip;
+        xSemaphoreGive(s_lock);
+        xEventGroupSetBits(prov_event_group, PROV_DONE_BIT); // Saved by the provisioning task
+    }
+}
+
 // --- SoftAP Wi-Fi Init/Deinit (Static) ---
 static esp_err_t softap_prov_init_wifi(void) {
     ESP_LOGI(TAG, "Initializing Wi-Fi for SoftAP provisioning...");
@@ -240,19 +567,26 @@ static esp_err_t softap_prov_init_wifi(void) {
         prov_ap_netif = NULL;
         return ret;
     }
-    // Must unregister handlers before re-registering or check instance
-    // Simpler: Assume handlers are managed correctly by calling context (wifi_manager)
-    // or ensure wifi is stopped before calling this init.
     // We will register handlers specific to this provisioning session.
     ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_AP_STACONNECTED, &softap_prov_ap_event_handler, NULL));
     ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_AP_STADISCONNECTED, &softap_prov_ap_event_handler, NULL));
-
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE, &softap_prov_sta_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &softap_prov_sta_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &softap_prov_sta_event_handler, NULL));
+
+    // An existing STA connection stays up; the AP has to share its channel
+    uint8_t channel = PROV_ESP_WIFI_AP_CHANNEL;
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK) {
+        channel = ap.primary;
+    }
+    s_ap_channel = channel;
 
     wifi_config_t wifi_ap_config = {
         .ap = {
             .ssid = PROV_ESP_WIFI_AP_SSID,
             .ssid_len = strlen(PROV_ESP_WIFI_AP_SSID),
-            .channel = PROV_ESP_WIFI_AP_CHANNEL,
+            .channel = channel,
             .password = PROV_ESP_WIFI_AP_PASSWORD,
             .max_connection = PROV_ESP_MAX_STA_CONN,
             .authmode = (strlen(PROV_ESP_WIFI_AP_PASSWORD) == 0) ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA_WPA2_PSK,
@@ -264,9 +598,9 @@ static esp_err_t softap_prov_init_wifi(void) {
     memset(wifi_ap_config.ap.password, 0, sizeof(wifi_ap_config.ap.password));
     }
 
-    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_AP));
+    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_APSTA));
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_AP, &wifi_ap_config));
-    ESP_ERROR_CHECK(esp_wifi_start()); // Start Wi-Fi in AP mode
+    ESP_ERROR_CHECK(esp_wifi_start()); // No-op if the STA already started it
 
     ESP_LOGI(TAG, "SoftAP Wi-Fi initialized. SSID: %s", PROV_ESP_WIFI_AP_SSID);
     esp_netif_ip_info_t ip_info;
@@ -277,19 +611,34 @@ static esp_err_t softap_prov_init_wifi(void) {
     return ESP_OK;
 }
 
-static void softap_prov_deinit_wifi(void) {
+// keep_sta leaves the radio on in STA mode, with whatever connection the STA has
+static void softap_prov_deinit_wifi(bool keep_sta) {
     ESP_LOGI(TAG, "Deinitializing SoftAP provisioning Wi-Fi...");
     stop_webserver(); // Stop HTTP server first
+    esp_timer_stop(s_scan_timer);
+    esp_timer_stop(s_try_timer);
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_scanning) {
+        esp_wifi_scan_stop();
+        s_scanning = false;
+    }
+    xSemaphoreGive(s_lock);
 
      // Unregister event handlers registered by this module
      esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_AP_STACONNECTED, &softap_prov_ap_event_handler);
      esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_AP_STADISCONNECTED, &softap_prov_ap_event_handler);
+     esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_SCAN_DONE, &softap_prov_sta_event_handler);
+     esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &softap_prov_sta_event_handler);
+     esp_event_handler_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, &softap_prov_sta_event_handler);
 
-    // Stop Wi-Fi
-    // Check if wifi is initialized before stopping?
+    // Stop the AP only, or Wi-Fi altogether
      wifi_mode_t mode;
      if (esp_wifi_get_mode(&mode) == ESP_OK) { // Check if wifi is running
-        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_wifi_stop());
+        if (keep_sta) {
+            ESP_ERROR_CHECK_WITHOUT_ABORT(esp_wifi_set_mode(WIFI_MODE_STA));
+        } else {
+            ESP_ERROR_CHECK_WITHOUT_ABORT(esp_wifi_stop());
+        }
      }
 
 
@@ -308,17 +657,25 @@ static void softap_prov_deinit_wifi(void) {
 esp_err_t start_softap_provisioning(TickType_t timeout_ticks) {
     ESP_LOGI(TAG, "Starting SoftAP provisioning sequence...");
 
-    // Create internal event group if it doesn't exist
+    // Create internal sync objects if they don't exist
     if (prov_event_group == NULL) {
         prov_event_group = xEventGroupCreate();
-        if (prov_event_group == NULL) {
+        s_lock = xSemaphoreCreateMutex();
+        const esp_timer_create_args_t try_timer_args = { .callback = try_timeout_cb, .name = "prov_try" };
+        const esp_timer_create_args_t scan_timer_args = { .callback = scan_timer_cb, .name = "prov_scan" };
+        if (prov_event_group == NULL || s_lock == NULL ||
+            esp_timer_create(&try_timer_args, &s_try_timer) != ESP_OK ||
+            esp_timer_create(&scan_timer_args, &s_scan_timer) != ESP_OK) {
              ESP_LOGE(TAG, "Failed to create provisioning event group");
              return ESP_FAIL;
         }
     }
-    xEventGroupClearBits(prov_event_group, PROV_DONE_BIT | PROV_FAIL_BIT);
+    xEventGroupClearBits(prov_event_group, PROV_DONE_BIT | PROV_REPORTED_BIT | PROV_STA_DOWN_BIT);
+    s_try_state = PROV_TRY_IDLE;
+    s_try_ssid[0] = '\0';
+    s_scan_count = 0;
 
-    // Initialize Wi-Fi in AP mode for provisioning
+    // Initialize Wi-Fi in AP+STA mode for provisioning
     if (softap_prov_init_wifi() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize SoftAP Wi-Fi for provisioning.");
         // No need to call deinit here as init failed during setup
@@ -328,39 +685,52 @@ esp_err_t start_softap_provisioning(TickType_t timeout_ticks) {
     // Start the web server
     if (start_webserver() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start webserver for provisioning.");
-        softap_prov_deinit_wifi(); // Cleanup Wi-Fi if webserver fails
+        softap_prov_deinit_wifi(false); // Cleanup Wi-Fi if webserver fails
         return ESP_FAIL;
     }
 
-    ESP_LOGI(TAG, "Waiting for provisioning data via HTTP POST (Timeout: %lu ticks)...", (unsigned long)timeout_ticks);
+    // The first scan now, so the list is ready when the page loads
+    scan_timer_cb(NULL);
+    esp_timer_start_periodic(s_scan_timer, PROV_SCAN_PERIOD_MS * 1000);
+
+    ESP_LOGI(TAG, "Waiting for working credentials via HTTP (Timeout: %lu ticks)...", (unsigned long)timeout_ticks);
     EventBits_t bits = xEventGroupWaitBits(prov_event_group,
-                                           PROV_DONE_BIT | PROV_FAIL_BIT,
+                                           PROV_DONE_BIT,
                                            pdFALSE, // Don't clear bits on exit
-                                           pdFALSE, // Wait for EITHER bit
+                                           pdFALSE,
                                            timeout_ticks); // Use provided timeout
 
     esp_err_t result;
     if (bits & PROV_DONE_BIT) {
-        ESP_LOGI(TAG, "Provisioning data received and saved successfully.");
-        result = ESP_OK;
-    } else if (bits & PROV_FAIL_BIT) {
-        ESP_LOGE(TAG, "Provisioning process failed internally (e.g., save error).");
-        result = ESP_FAIL;
+        // Connected already: save, then give the browser time to pick up the result
+        esp_err_t save_err = save_wifi_credentials(s_try_ssid, s_try_password);
+        if (save_err == ESP_OK) {
+            ESP_LOGI(TAG, "Provisioning data verified and saved successfully.");
+            set_try_state(PROV_TRY_CONNECTED, NULL);
+            uint32_t wait_ms = PROV_REPORT_WAIT_MS;
+            wifi_ap_record_t ap;
+            if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK && ap.primary != s_ap_channel) {
+                ESP_LOGI(TAG, "AP moved from channel %d to %d, waiting for the phone to rejoin",
+                         s_ap_channel, ap.primary);
+                wait_ms = PROV_REPORT_MOVED_WAIT_MS;
+            }
+            xEventGroupWaitBits(prov_event_group, PROV_REPORTED_BIT, pdFALSE, pdFALSE, pdMS_TO_TICKS(wait_ms));
+            vTaskDelay(pdMS_TO_TICKS(100)); // Short delay for response
+            result = ESP_OK;
+        } else {
+            ESP_LOGE(TAG, "Failed to save Wi-Fi credentials (%s)", esp_err_to_name(save_err));
+            result = ESP_FAIL;
+        }
     } else {
         // Timeout occurred
         ESP_LOGW(TAG, "Provisioning timed out.");
         result = ESP_ERR_TIMEOUT;
     }
 
-    // Cleanup provisioning resources regardless of outcome
-    softap_prov_deinit_wifi();
-
-    // Optionally delete event group if not reused
-    // if (prov_event_group) {
-    //    vEventGroupDelete(prov_event_group);
-    //    prov_event_group = NULL;
-    // }
+    // Cleanup provisioning resources regardless of outcome; a working STA
+    // connection is kept for wifi_manager to take over
+    softap_prov_deinit_wifi(result != ESP_FAIL);
 
     ESP_LOGI(TAG, "SoftAP provisioning sequence finished with status: %d", result);
     return result;
-}
\ No newline at end of file
+}
@@ -8,15 +8,18 @@
 /**
  * @brief 啟動 SoftAP 配網流程
  *
- * 此函數會啟動一個 SoftAP 熱點和一個 HTTP 伺服器，
- * 等待使用者透過瀏覽器提交 Wi-Fi 憑證。
- * 成功收到並儲存憑證後函數返回。
- * 注意：此函數內部會管理 Wi-Fi 的啟動(AP模式)和停止。
+ * 此函數以 AP+STA 模式啟動一個 SoftAP 熱點和一個 HTTP 伺服器，
+ * 等待使用者透過瀏覽器提交 Wi-Fi 憑證。提交的憑證會立即在 STA 介面上
+ * 試連，結果回報給瀏覽器 (/status)；密碼錯誤時可直接重試，不需重新配網。
+ * 頁面的網路清單來自背景掃描的快取 (/scan)。
+ * 試連成功 (取得 IP) 並儲存憑證後函數返回，STA 連線保持不斷，
+ * 由 wifi_manager 直接接手。既有的 STA 連線在配網期間也保持不變。
+ * 注意：此函數內部會管理 AP 的啟動和停止；失敗時會停止 Wi-Fi。
  *
  * @param timeout_ms 等待使用者設定的超時時間 (毫秒)，0 或 portMAX_DELAY 表示永不超時。
  *
  * @return esp_err_t
- * - ESP_OK: 成功收到並儲存 Wi-Fi 憑證。
+ * - ESP_OK: 憑證已驗證 (STA 已取得 IP) 並儲存。
  * - ESP_ERR_TIMEOUT: 等待使用者設定超時。
  * - ESP_FAIL: 過程中發生其他錯誤 (例如無法啟動 SoftAP 或 Server)。
  */
@@ -0,0 +1,178 @@
+// main/sync_scheduler.c
+#include "sync_scheduler.h"
+#include "wifi_manager.h"
+#include "wifi_storage.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+#include <string.h>
+
+#define NVS_KEY_SYNC_STATS "sync_stats"
+
+// Rough average currents of the S3 module, for the charge estimate only;
+// replace them with figures measured on the board
+#define SYNC_SCHEDULER_RADIO_ON_MA 90     // Connecting / transferring
+#define SYNC_SCHEDULER_MODEM_SLEEP_MA 15  // Associated, WIFI_PS_MAX_MODEM
+
+static const char *TAG = "SYNC_SCHED";
+
+// --- Module State ---
+static sync_scheduler_config_t s_config;
+static TaskHandle_t s_task = NULL;
+static sync_stats_t s_stats;
+
+// --- Persistent Counters ---
+static void sync_scheduler_load_stats(void) {
+    nvs_handle_t nvs_handle;
+    memset(&s_stats, 0, sizeof(s_stats));
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    size_t size = sizeof(s_stats);
+    if (nvs_get_blob(nvs_handle, NVS_KEY_SYNC_STATS, &s_stats, &size) != ESP_OK || size != sizeof(s_stats)) {
+        memset(&s_stats, 0, sizeof(s_stats)); // Missing or an older layout: start over
+    }
+    nvs_close(nvs_handle);
+}
+
+// One write per sync; NVS spreads it over its pages
+static esp_err_t sync_scheduler_save_stats(void) {
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) opening NVS handle!", esp_err_to_name(err));
+        return err;
+    }
+    err = nvs_set_blob(nvs_handle, NVS_KEY_SYNC_STATS, &s_stats, sizeof(s_stats));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) saving sync stats!", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
+
+// --- One Sync ---
+static void sync_scheduler_run_once(void) {
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = ESP_OK;
+    if (wifi_manager_get_state() != WIFI_STATE_CONNECTED) {
+        err = wifi_manager_start();
+    }
+    if (err == ESP_OK) {
+        err = wifi_manager_wait_for_ip(pdMS_TO_TICKS(s_config.connect_timeout_ms));
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "No IP within %lu ms (%s), skipping this sync",
+                     (unsigned long)s_config.connect_timeout_ms, esp_err_to_name(err));
+        }
+    }
+    int64_t ip_us = esp_timer_get_time();
+
+    bool fetched = false;
+    if (err == ESP_OK) {
+        err = s_config.sync(s_config.arg);
+        fetched = err == ESP_OK;
+        if (!fetched) {
+            ESP_LOGW(TAG, "Sync failed (%s)", esp_err_to_name(err));
+        }
+    }
+    int64_t done_us = esp_timer_get_time();
+
+    if (s_config.policy == SYNC_POLICY_TEARDOWN) {
+        wifi_manager_stop(); // Refused while provisioning, which keeps its AP up
+    }
+    int64_t off_us = s_config.policy == SYNC_POLICY_TEARDOWN ? esp_timer_get_time() : done_us;
+
+    uint32_t connect_ms = (uint32_t)((ip_us - start_us) / 1000);
+    uint32_t fetch_ms = (uint32_t)((done_us - ip_us) / 1000);
+    uint32_t radio_on_ms = (uint32_t)((off_us - start_us) / 1000);
+    s_stats.syncs++;
+    s_stats.failures += fetched ? 0 : 1;
+    s_stats.connect_ms += connect_ms;
+    s_stats.fetch_ms += fetch_ms;
+    s_stats.radio_on_ms += radio_on_ms;
+    sync_scheduler_save_stats();
+
+    ESP_LOGI(TAG, "Sync %lu %s: connect %lu ms, fetch %lu ms, radio on %lu ms",
+             (unsigned long)s_stats.syncs, fetched ? "done" : "failed",
+             (unsigned long)connect_ms, (unsigned long)fetch_ms, (unsigned long)radio_on_ms);
+}
+
+// --- Scheduler Task ---
+static void sync_scheduler_task(void* arg) {
+    TickType_t period = pdMS_TO_TICKS((uint64_t)s_config.interval_s * 1000);
+    for (;;) {
+        TickType_t start = xTaskGetTickCount();
+        sync_scheduler_run_once();
+
+        // Sleep out the rest of the interval, or until sync_scheduler_trigger()
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        int64_t idle_start_us = esp_timer_get_time();
+        ulTaskNotifyTake(pdTRUE, elapsed < period ? period - elapsed : 0);
+        if (s_config.policy == SYNC_POLICY_MODEM_SLEEP && wifi_manager_get_state() == WIFI_STATE_CONNECTED) {
+            s_stats.modem_sleep_ms += (uint64_t)(esp_timer_get_time() - idle_start_us) / 1000;
+        }
+    }
+}
+
+// --- Public Functions ---
+
+esp_err_t sync_scheduler_start(const sync_scheduler_config_t* config) {
+    if (config == NULL || config->sync == NULL || config->interval_s == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task != NULL) {
+        ESP_LOGW(TAG, "Sync scheduler already running.");
+        return ESP_OK;
+    }
+    s_config = *config;
+    sync_scheduler_load_stats();
+    ESP_ERROR_CHECK_WITHOUT_ABORT(wifi_manager_set_power_save(s_config.ps_type, s_config.listen_interval));
+
+    ESP_LOGI(TAG, "Syncing every %lu s, %s between syncs", (unsigned long)s_config.interval_s,
+             s_config.policy == SYNC_POLICY_TEARDOWN ? "Wi-Fi off" : "modem sleep");
+    if (xTaskCreate(sync_scheduler_task, "sync", 6144, NULL, 5, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create sync task");
+        s_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void sync_scheduler_trigger(void) {
+    if (s_task) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+void sync_scheduler_get_stats(sync_stats_t* stats) {
+    *stats = s_stats;
+}
+
+void sync_scheduler_log_stats(void) {
+    if (s_stats.syncs == 0) {
+        ESP_LOGI(TAG, "No syncs yet.");
+        return;
+    }
+    // mA * ms / 3600 = uAh
+    uint64_t charge_uah = (s_stats.radio_on_ms * SYNC_SCHEDULER_RADIO_ON_MA +
+                           s_stats.modem_sleep_ms * SYNC_SCHEDULER_MODEM_SLEEP_MA) / 3600;
+    ESP_LOGI(TAG, "%lu syncs (%lu failed): avg connect %llu ms, fetch %llu ms, radio on %llu ms; "
+             "modem sleep %llu s total; ~%llu uAh per sync",
+             (unsigned long)s_stats.syncs, (unsigned long)s_stats.failures,
+             (unsigned long long)(s_stats.connect_ms / s_stats.syncs),
+             (unsigned long long)(s_stats.fetch_ms / s_stats.syncs),
+             (unsigned long long)(s_stats.radio_on_ms / s_stats.syncs),
+             (unsigned long long)(s_stats.modem_sleep_ms / 1000),
+             (unsigned long long)(charge_uah / s_stats.syncs));
+}
+
+esp_err_t sync_scheduler_reset_stats(void) {
+    memset(&s_stats, 0, sizeof(s_stats));
+    return sync_scheduler_save_stats();
+}
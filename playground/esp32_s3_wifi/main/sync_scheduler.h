@@ -0,0 +1,85 @@
+// main/sync_scheduler.h
+#ifndef SYNC_SCHEDULER_H
+#define SYNC_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+
+// What the radio does between syncs
+typedef enum {
+    SYNC_POLICY_TEARDOWN,    // Wi-Fi stopped after the data is in; reconnect (fast path) per sync
+    SYNC_POLICY_MODEM_SLEEP, // Stay associated in modem sleep with the configured listen interval
+} sync_policy_t;
+
+/**
+ * @brief Fetches and processes the data of one sync. Called from the scheduler
+ * task with Wi-Fi connected.
+ *
+ * @return esp_err_t ESP_OK if the data is in; anything else counts as a failed sync.
+ */
+typedef esp_err_t (*sync_fn_t)(void* arg);
+
+typedef struct {
+    sync_fn_t sync;                // The fetch
+    void* arg;                     // Passed to sync
+    uint32_t interval_s;           // From the start of one sync to the start of the next
+    uint32_t connect_timeout_ms;   // Give up on a sync if there is no IP by then
+    sync_policy_t policy;
+    wifi_ps_type_t ps_type;        // Power save while connected, usually WIFI_PS_MAX_MODEM
+    uint16_t listen_interval;      // Beacons between wakes with WIFI_PS_MAX_MODEM
+} sync_scheduler_config_t;
+
+#define SYNC_SCHEDULER_CONFIG_DEFAULT() {           \
+    .sync = NULL,                                   \
+    .arg = NULL,                                    \
+    .interval_s = 15 * 60,                          \
+    .connect_timeout_ms = 15000,                    \
+    .policy = SYNC_POLICY_TEARDOWN,                 \
+    .ps_type = WIFI_PS_MAX_MODEM,                   \
+    .listen_interval = 10,                          \
+}
+
+// Radio time, kept in NVS across resets so the cost of a policy can be compared
+// over days. Times are wall-clock milliseconds.
+typedef struct {
+    uint32_t syncs;              // Syncs attempted
+    uint32_t failures;           // Syncs without the data in (no IP, or sync returned an error)
+    uint64_t connect_ms;         // Sync start until IP
+    uint64_t fetch_ms;           // IP until the data is in
+    uint64_t radio_on_ms;        // Radio awake for syncs: connect + fetch (+ stop with teardown)
+    uint64_t modem_sleep_ms;     // Associated in modem sleep between syncs (SYNC_POLICY_MODEM_SLEEP)
+} sync_stats_t;
+
+/**
+ * @brief Starts the scheduler task: a sync now, then one every interval_s.
+ * Uses wifi_manager_start/wifi_manager_wait_for_ip to bring the radio up, so
+ * wifi_manager_init must have been called.
+ *
+ * @param config Scheduler configuration; sync is required.
+ * @return esp_err_t ESP_OK if the task started, ESP_ERR_INVALID_ARG or ESP_ERR_NO_MEM otherwise.
+ */
+esp_err_t sync_scheduler_start(const sync_scheduler_config_t* config);
+
+/**
+ * @brief Runs the next sync now instead of at the end of the interval.
+ */
+void sync_scheduler_trigger(void);
+
+/**
+ * @brief Gets the radio time counters, including earlier boots.
+ */
+void sync_scheduler_get_stats(sync_stats_t* stats);
+
+/**
+ * @brief Logs the counters and the estimated charge per sync.
+ */
+void sync_scheduler_log_stats(void);
+
+/**
+ * @brief Clears the counters, in RAM and NVS (e.g. before trying another policy).
+ */
+esp_err_t sync_scheduler_reset_stats(void);
+
+#endif // SYNC_SCHEDULER_H
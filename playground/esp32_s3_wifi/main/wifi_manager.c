@@ -7,14 +7,24 @@
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
 #include "esp_system.h"
+#include "esp_random.h"
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "esp_timer.h"
+#include "esp_mac.h"
+#include "esp_attr.h"
 #include "nvs_flash.h"
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
-#define WIFI_MANAGER_MAX_RETRY 5 // Max connection retries before giving up/provisioning
+#define WIFI_MANAGER_PROBE_PERIOD_MS 5000 // Event loop latency probe interval, 0 disables it
+#define WIFI_MANAGER_FAST_MAGIC 0x57464331 // "WFC1": s_rtc_fast holds a connection
+#define WIFI_MANAGER_LEASE_REUSE_MAX_S (30 * 60) // Reuse a DHCP lease this long after it was obtained
+#define WIFI_MANAGER_SCAN_MAX_APS 20 // Scan results looked at when choosing a network
+#define WIFI_MANAGER_RETRY_REPOST_MS 100 // Delay before posting a retry again when the event queue was full
 
 static const char *TAG = "WIFI_MANAGER";
 
@@ -26,83 +36,483 @@ static esp_netif_t *s_sta_netif = NULL;
 // static esp_netif_t *s_ap_netif = NULL; // Keep AP netif handle if needed globally
 static esp_event_handler_instance_t instance_any_id; // For wifi events
 static esp_event_handler_instance_t instance_got_ip; // For IP events
-static bool provisioning_triggered_manually = false; // Flag for manual trigger
+
+// --- Reconnect State ---
+// Retries are scheduled on an esp_timer with exponential backoff instead of
+// waiting in the event handler, so the default event loop never blocks. The
+// timer only posts WIFI_MANAGER_EVENT_RETRY: every state change happens on the
+// event loop.
+// Provisioning blocks for minutes and runs in its own task.
+static wifi_manager_backoff_t s_backoff = WIFI_MANAGER_BACKOFF_DEFAULT();
+static esp_timer_handle_t s_retry_timer = NULL;
+static TaskHandle_t s_prov_task = NULL;
+
+// --- Power Save ---
+static wifi_ps_type_t s_ps_type = WIFI_PS_MIN_MODEM; // The driver's default
+static uint16_t s_listen_interval = 0;               // 0: the driver's default (3 beacons)
+
+// --- Event Loop Latency ---
+// A probe event is posted periodically with its post time; the delay until it
+// is dispatched shows whether any handler on the default loop is stalling it.
+// The probe runs from wifi_manager_start() to wifi_manager_stop() only, so a
+// stopped manager does not wake the chip every period.
+ESP_EVENT_DEFINE_BASE(WIFI_MANAGER_EVENT);
+enum { WIFI_MANAGER_EVENT_PROBE, WIFI_MANAGER_EVENT_RETRY };
+static esp_timer_handle_t s_probe_timer = NULL;
+static wifi_manager_latency_t s_latency;
+static uint64_t s_latency_sum_us = 0;
+
+// --- Fast Reconnect State ---
+// The last good BSSID, channel and lease survive deep sleep in RTC memory and
+// power loss in NVS. A connection first joins that BSSID on its channel (no
+// scan) and reuses a recent lease (no DHCP exchange); any disconnect on that
+// path falls back to a full scan with DHCP.
+RTC_DATA_ATTR static uint32_t s_rtc_fast_magic;
+RTC_DATA_ATTR static wifi_fast_info_t s_rtc_fast;
+static wifi_fast_info_t s_fast;         // Connection the current attempt is based on
+static bool s_fast_valid = false;
+static bool s_lease_reused = false;     // IP was set from s_fast instead of DHCP
+static wifi_static_ip_t s_static_ip;
+static bool s_static_ip_valid = false;
+static int64_t s_connect_start_us = 0;  // For connect-to-IP latency
+static char s_ssid[33];                 // Credentials of the current attempt
+static char s_password[65];
+
+// --- Known Networks ---
+// Without a usable cached connection, one scan is matched against the known
+// network table and the candidates are tried best first, each on the BSSID and
+// channel the scan found, so no attempt scans again.
+typedef enum {
+    CONNECT_PATH_CACHED,    // Cached BSSID and channel (fast reconnect)
+    CONNECT_PATH_SCAN,      // A candidate from our scan
+    CONNECT_PATH_FULL,      // The driver's all-channel scan (hidden or unseen networks)
+} connect_path_t;
+
+typedef struct {
+    int cred;               // Index into s_table
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;
+} candidate_t;
+
+static wifi_cred_table_t s_table;
+static candidate_t s_candidates[WIFI_CRED_MAX];
+static int s_candidate_count = 0;
+static int s_candidate_next = 0;        // Next candidate to try after a failure
+static connect_path_t s_path = CONNECT_PATH_FULL;
+static bool s_scanning = false;
 
 
 // --- Forward Declarations ---
 static void wifi_manager_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
-static esp_err_t wifi_manager_connect_sta(const char* ssid, const char* password);
+static esp_err_t wifi_manager_connect_known(void);
+static void wifi_manager_start_scan(void);
+static void wifi_manager_rank_scan(void);
+static void wifi_manager_connect_next_candidate(void);
 static void wifi_manager_do_provisioning(void);
+static esp_err_t wifi_manager_start_provisioning_task(void);
+static void wifi_manager_remember_connection(const esp_netif_ip_info_t* ip_info);
+
+
+// --- Reconnect Backoff ---
+
+// Delay before retry number attempt (1-based): base doubled per retry up to the
+// ceiling, half of it random so devices that lost the same AP do not retry in step
+static uint32_t wifi_manager_backoff_ms(int attempt) {
+    uint32_t delay = s_backoff.base_ms;
+    for (int i = 1; i < attempt && delay < s_backoff.max_ms; i++) {
+        delay *= 2;
+    }
+    if (delay > s_backoff.max_ms) {
+        delay = s_backoff.max_ms;
+    }
+    return delay / 2 + esp_random() % (delay / 2 + 1);
+}
+
+// Runs in the esp_timer task, so it touches no state and hands the retry to the event loop
+static void wifi_manager_retry_timer_cb(void* arg) {
+    if (esp_event_post(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_RETRY, NULL, 0, 0) != ESP_OK) {
+        // Queue full: try again shortly rather than lose the retry
+        esp_timer_start_once(s_retry_timer, WIFI_MANAGER_RETRY_REPOST_MS * 1000);
+    }
+}
 
+static void wifi_manager_cancel_retry(void) {
+    if (s_retry_timer) {
+        esp_timer_stop(s_retry_timer); // ESP_ERR_INVALID_STATE if not running
+    }
+}
+
+// Called on the event loop after a disconnect: schedules the next retry, or
+// starts provisioning once the retries are used up
+static void wifi_manager_schedule_retry(void) {
+    if (s_backoff.max_retries > 0 && s_retry_num >= s_backoff.max_retries) {
+        ESP_LOGE(TAG, "Connection failed after %d retries. Starting provisioning.", s_retry_num);
+        if (s_wifi_event_group) {
+            xEventGroupSetBits(s_wifi_event_group, WIFI_MANAGER_DISCONNECTED_BIT); // Signal persistent failure
+        }
+        wifi_manager_start_provisioning_task();
+        return;
+    }
+    s_retry_num++;
+    uint32_t delay_ms = wifi_manager_backoff_ms(s_retry_num);
+    if (s_backoff.max_retries > 0) {
+        ESP_LOGI(TAG, "Retry to connect to the AP in %lu ms (%d/%d)", (unsigned long)delay_ms, s_retry_num, s_backoff.max_retries);
+    } else {
+        ESP_LOGI(TAG, "Retry to connect to the AP in %lu ms (%d)", (unsigned long)delay_ms, s_retry_num);
+    }
+    wifi_manager_cancel_retry();
+    esp_err_t err = esp_timer_start_once(s_retry_timer, (uint64_t)delay_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to schedule the retry (%s)", esp_err_to_name(err));
+    }
+}
+
+// --- Event Loop Latency Probe ---
+
+static void wifi_manager_probe_timer_cb(void* arg) {
+    int64_t posted_us = esp_timer_get_time();
+    if (esp_event_post(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_PROBE, &posted_us, sizeof(posted_us), 0) != ESP_OK) {
+        s_latency.dropped++; // Queue full: the loop is not keeping up
+    }
+}
+
+static void wifi_manager_probe_start(void) {
+    if (s_probe_timer && !esp_timer_is_active(s_probe_timer)) {
+        esp_timer_start_periodic(s_probe_timer, WIFI_MANAGER_PROBE_PERIOD_MS * 1000);
+    }
+}
+
+static void wifi_manager_probe_stop(void) {
+    if (s_probe_timer) {
+        esp_timer_stop(s_probe_timer); // ESP_ERR_INVALID_STATE if not running
+    }
+}
+
+static void wifi_manager_probe_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
+    uint32_t waited_us = (uint32_t)(esp_timer_get_time() - *(int64_t*)event_data);
+    s_latency.probes++;
+    s_latency_sum_us += waited_us;
+    s_latency.avg_us = (uint32_t)(s_latency_sum_us / s_latency.probes);
+    if (waited_us > s_latency.max_us) {
+        s_latency.max_us = waited_us;
+    }
+}
+
+// Connected with an address, to s_ssid: cache the connection for the next fast
+// reconnect, update the network's recency and wake the waiters
+static void wifi_manager_on_connected(const esp_netif_ip_info_t* ip_info) {
+    wifi_manager_remember_connection(ip_info);
+    // Recency feeds the ranking; written only when another network was used last
+    int used = wifi_cred_table_find(&s_table, s_ssid);
+    if (used >= 0 && used != wifi_cred_table_most_recent(&s_table)) {
+        wifi_cred_table_mark_success(&s_table, s_ssid);
+        save_wifi_cred_table(&s_table);
+    }
+    s_retry_num = 0;
+    s_current_state = WIFI_STATE_CONNECTED;
+    if (s_wifi_event_group) {
+        xEventGroupSetBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT);
+         xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_DISCONNECTED_BIT);
+    }
+}
 
 // --- Event Handler ---
-static void wifi_manager_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
+static void wifi_manager_handle_event(esp_event_base_t event_base, int32_t event_id, void* event_data) {
+    if (s_current_state == WIFI_STATE_PROVISIONING) {
+        return; // softap_provisioning drives the STA while its portal is up
+    }
     if (event_base == WIFI_EVENT) {
         switch (event_id) {
             case WIFI_EVENT_STA_START:
                 ESP_LOGI(TAG, "WIFI_EVENT_STA_START");
                 // Connection attempt is usually called after this
-                // esp_wifi_connect(); // connect_sta calls this
+                // esp_wifi_connect(); // connect_known calls this
                 s_current_state = WIFI_STATE_CONNECTING;
                 break;
             case WIFI_EVENT_STA_CONNECTED:
                 ESP_LOGI(TAG, "WIFI_EVENT_STA_CONNECTED");
-                s_retry_num = 0; // Reset retry counter on successful connection event
-                 // State changes to CONNECTED only after getting IP
+                // State changes to CONNECTED, and the retry counter resets, only
+                // after getting IP: an AP that associates but never hands out an
+                // address still ends in provisioning
                 break;
             case WIFI_EVENT_STA_DISCONNECTED:
                 ESP_LOGW(TAG, "WIFI_EVENT_STA_DISCONNECTED");
+                if (s_current_state == WIFI_STATE_INITIALIZED) {
+                    break; // STA stopped by wifi_manager_stop()
+                }
                 s_current_state = WIFI_STATE_DISCONNECTED;
                 if (s_wifi_event_group) {
                     xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT); // Clear connected bit
                 }
 
-                // Check if disconnection was intentional (e.g., before provisioning)
-                if (!provisioning_triggered_manually) {
-                     if (s_retry_num < WIFI_MANAGER_MAX_RETRY) {
-                         s_retry_num++;
-                         ESP_LOGI(TAG, "Retry to connect to the AP (%d/%d)", s_retry_num, WIFI_MANAGER_MAX_RETRY);
-                          vTaskDelay(pdMS_TO_TICKS(2000)); // Wait before retry
-                         esp_wifi_connect();
-                         s_current_state = WIFI_STATE_CONNECTING;
+                {
+                    wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*) event_data;
+                    if (s_path == CONNECT_PATH_CACHED) {
+                        // The cached AP is gone or moved: choose again from a scan. Not counted
+                        // as a retry; dropped from RTC memory so the next wake does not try it.
+                        ESP_LOGW(TAG, "Fast reconnect failed (reason %d), scanning", event->reason);
+                        s_rtc_fast_magic = 0;
+                        wifi_manager_start_scan();
+                    } else if (s_path == CONNECT_PATH_SCAN && s_candidate_next < s_candidate_count) {
+                        ESP_LOGW(TAG, "Connection to [%s] failed (reason %d), trying the next network", s_ssid, event->reason);
+                        wifi_manager_connect_next_candidate();
                     } else {
-                        ESP_LOGE(TAG, "Connection failed after %d retries.", WIFI_MANAGER_MAX_RETRY);
-                        if (s_wifi_event_group) {
-                            xEventGroupSetBits(s_wifi_event_group, WIFI_MANAGER_DISCONNECTED_BIT); // Signal persistent failure
-                        }
-                        // Decide whether to auto-trigger provisioning here
-                        // wifi_manager_do_provisioning();
+                        wifi_manager_schedule_retry();
                     }
-                } else {
-                    ESP_LOGI(TAG, "Disconnection seems intentional (manual provisioning trigger).");
-                     // Reset flag after handling intentional disconnect
-                     provisioning_triggered_manually = false;
                 }
-
+                break;
+            case WIFI_EVENT_SCAN_DONE:
+                if (s_scanning) {
+                    s_scanning = false;
+                    wifi_manager_rank_scan();
+                    wifi_manager_connect_next_candidate();
+                }
                 break;
             default:
                 break;
         }
+    } else if (event_base == WIFI_MANAGER_EVENT && event_id == WIFI_MANAGER_EVENT_RETRY) {
+        // Each retry scans again, as the best network may have changed. Any other
+        // state means wifi_manager_stop(), provisioning or a new connection came first.
+        if (s_current_state == WIFI_STATE_DISCONNECTED) {
+            wifi_manager_start_scan();
+        }
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
-        s_retry_num = 0;
-        s_current_state = WIFI_STATE_CONNECTED;
-        if (s_wifi_event_group) {
-            xEventGroupSetBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT);
-             xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_DISCONNECTED_BIT);
+        ESP_LOGI(TAG, "Connect to IP took %lld ms (%s)",
+                 (long long)((esp_timer_get_time() - s_connect_start_us) / 1000),
+                 s_path == CONNECT_PATH_FULL ? "full scan" :
+                 s_path == CONNECT_PATH_SCAN ? "scan pick" :
+                 s_lease_reused ? "fast path, cached lease" : "fast path, DHCP");
+        wifi_manager_on_connected(&event->ip_info);
+    }
+}
+
+static void wifi_manager_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
+    int64_t start_us = esp_timer_get_time();
+    wifi_manager_handle_event(event_base, event_id, event_data);
+    uint32_t took_us = (uint32_t)(esp_timer_get_time() - start_us);
+    if (took_us > s_latency.handler_max_us) {
+        s_latency.handler_max_us = took_us;
+    }
+}
+
+// --- Fast Reconnect Helpers ---
+
+// Loads the last good connection, if it is to a known network: RTC memory
+// first, NVS after a power loss
+static void wifi_manager_load_fast_info(void) {
+    s_fast_valid = false;
+    if (s_rtc_fast_magic == WIFI_MANAGER_FAST_MAGIC) {
+        s_fast = s_rtc_fast;
+        s_fast_valid = true;
+    } else if (read_wifi_fast_info(&s_fast) == ESP_OK) {
+        s_rtc_fast = s_fast;
+        s_rtc_fast_magic = WIFI_MANAGER_FAST_MAGIC;
+        s_fast_valid = true;
+    }
+    s_fast_valid = s_fast_valid && s_fast.channel != 0 && wifi_cred_table_find(&s_table, s_fast.ssid) >= 0;
+}
+
+// A lease is reused only shortly after DHCP handed it out. time() keeps counting
+// through deep sleep but restarts on power-on, so a lease from a previous power
+// cycle (or from before SNTP set the clock) looks too old or in the future.
+static bool wifi_manager_lease_usable(void) {
+    int64_t age = (int64_t)time(NULL) - s_fast.lease_time;
+    return s_fast.ip != 0 && age >= 0 && age < WIFI_MANAGER_LEASE_REUSE_MAX_S;
+}
+
+// Static IP if configured, else the given lease, else DHCP
+static void wifi_manager_apply_ip(const wifi_fast_info_t* lease) {
+    const wifi_static_ip_t* st = s_static_ip_valid ? &s_static_ip : NULL;
+    esp_err_t err;
+    if (st == NULL && lease == NULL) {
+        err = esp_netif_dhcpc_start(s_sta_netif);
+        if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STARTED) {
+            ESP_LOGE(TAG, "esp_netif_dhcpc_start failed (%s)", esp_err_to_name(err));
         }
+        return;
+    }
+
+    err = esp_netif_dhcpc_stop(s_sta_netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STOPPED) {
+        ESP_LOGE(TAG, "esp_netif_dhcpc_stop failed (%s)", esp_err_to_name(err));
+    }
+    esp_netif_ip_info_t ip_info = { 0 };
+    ip_info.ip.addr = st ? st->ip : lease->ip;
+    ip_info.netmask.addr = st ? st->netmask : lease->netmask;
+    ip_info.gw.addr = st ? st->gw : lease->gw;
+    ESP_ERROR_CHECK_WITHOUT_ABORT(esp_netif_set_ip_info(s_sta_netif, &ip_info));
+
+    uint32_t dns = st ? st->dns : lease->dns;
+    if (dns != 0) {
+        esp_netif_dns_info_t dns_info = { 0 };
+        dns_info.ip.type = ESP_IPADDR_TYPE_V4;
+        dns_info.ip.u_addr.ip4.addr = dns;
+        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_netif_set_dns_info(s_sta_netif, ESP_NETIF_DNS_MAIN, &dns_info));
     }
 }
 
-// --- Internal STA Connection Function ---
-static esp_err_t wifi_manager_connect_sta(const char* ssid, const char* password) {
-    ESP_LOGI(TAG, "Attempting to connect to SSID: [%s]", ssid);
+// STA config for the credentials in s_ssid/s_password, locked to bssid on
+// channel if given, else left to the driver's all-channel scan
+static esp_err_t wifi_manager_set_sta_config(const uint8_t* bssid, uint8_t channel) {
+    wifi_config_t wifi_config = { 0 };
+    strncpy((char*)wifi_config.sta.ssid, s_ssid, sizeof(wifi_config.sta.ssid) - 1);
+    strncpy((char*)wifi_config.sta.password, s_password, sizeof(wifi_config.sta.password) - 1);
+    wifi_config.sta.threshold.authmode = strlen(s_password) > 0 ? WIFI_AUTH_WPA2_PSK : WIFI_AUTH_OPEN;
+    wifi_config.sta.pmf_cfg.capable = true;
+    wifi_config.sta.pmf_cfg.required = false;
+    wifi_config.sta.listen_interval = s_listen_interval; // Used with WIFI_PS_MAX_MODEM
+    if (bssid) {
+        memcpy(wifi_config.sta.bssid, bssid, sizeof(wifi_config.sta.bssid));
+        wifi_config.sta.bssid_set = true;
+        wifi_config.sta.channel = channel;
+        wifi_config.sta.scan_method = WIFI_FAST_SCAN;
+    } else {
+        wifi_config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+        wifi_config.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+    }
+    return esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+}
 
+// Connects to table entry cred; bssid NULL leaves finding the AP to the driver
+static void wifi_manager_connect_to(int cred, const uint8_t* bssid, uint8_t channel, connect_path_t path) {
+    const wifi_cred_t* e = &s_table.entries[cred];
+    memset(s_ssid, 0, sizeof(s_ssid));
+    memset(s_password, 0, sizeof(s_password));
+    strncpy(s_ssid, e->ssid, sizeof(s_ssid) - 1);
+    strncpy(s_password, e->password, sizeof(s_password) - 1);
+    s_path = path;
+    s_lease_reused = path == CONNECT_PATH_CACHED && !s_static_ip_valid && wifi_manager_lease_usable();
+    wifi_manager_apply_ip(s_lease_reused ? &s_fast : NULL);
+    ESP_ERROR_CHECK_WITHOUT_ABORT(wifi_manager_set_sta_config(bssid, channel));
+
+    esp_err_t err = esp_wifi_connect();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_wifi_connect failed (%s)", esp_err_to_name(err));
+    }
+    s_current_state = WIFI_STATE_CONNECTING;
+}
+
+// Starts the scan that chooses the network; the rest happens on WIFI_EVENT_SCAN_DONE
+static void wifi_manager_start_scan(void) {
+    s_candidate_count = 0;
+    s_candidate_next = 0;
+    s_lease_reused = false;
+    s_scanning = true;
+    s_current_state = WIFI_STATE_CONNECTING;
+    esp_err_t err = esp_wifi_scan_start(NULL, false); // Returns at once
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_wifi_scan_start failed (%s)", esp_err_to_name(err));
+        s_scanning = false;
+        wifi_manager_connect_next_candidate(); // No candidates: let the driver scan
+    }
+}
+
+// Ranks the scan results against the known networks into s_candidates
+static void wifi_manager_rank_scan(void) {
+    uint16_t ap_count = WIFI_MANAGER_SCAN_MAX_APS;
+    wifi_ap_record_t* records = calloc(ap_count, sizeof(wifi_ap_record_t));
+    wifi_scan_entry_t* scan = calloc(ap_count, sizeof(wifi_scan_entry_t));
+    if (records == NULL || scan == NULL || esp_wifi_scan_get_ap_records(&ap_count, records) != ESP_OK) {
+        ap_count = 0;
+        esp_wifi_clear_ap_list();
+    }
+    for (int i = 0; i < ap_count; i++) {
+        strncpy(scan[i].ssid, (const char*)records[i].ssid, sizeof(scan[i].ssid) - 1);
+        memcpy(scan[i].bssid, records[i].bssid, sizeof(scan[i].bssid));
+        scan[i].channel = records[i].primary;
+        scan[i].rssi = records[i].rssi;
+        scan[i].secured = records[i].authmode != WIFI_AUTH_OPEN;
+    }
+
+    wifi_candidate_t ranked[WIFI_CRED_MAX];
+    s_candidate_count = wifi_select_rank(&s_table, scan, ap_count, ranked, WIFI_CRED_MAX);
+    for (int i = 0; i < s_candidate_count; i++) {
+        const wifi_scan_entry_t* ap = &scan[ranked[i].scan];
+        s_candidates[i].cred = ranked[i].cred;
+        memcpy(s_candidates[i].bssid, ap->bssid, sizeof(ap->bssid));
+        s_candidates[i].channel = ap->channel;
+        s_candidates[i].rssi = ap->rssi;
+        ESP_LOGI(TAG, "Candidate %d: [%s] %d dBm on channel %d (score %d)", i + 1,
+                 s_table.entries[ranked[i].cred].ssid, ap->rssi, ap->channel, ranked[i].score);
+    }
+    ESP_LOGI(TAG, "Scan found %d APs, %d known networks in range", ap_count, s_candidate_count);
+    free(records);
+    free(scan);
+}
+
+// After the scan, or when a candidate failed: the next candidate, or without
+// any the most recent network through the driver's own scan (it may be hidden)
+static void wifi_manager_connect_next_candidate(void) {
+    if (s_candidate_next < s_candidate_count) {
+        const candidate_t* c = &s_candidates[s_candidate_next++];
+        ESP_LOGI(TAG, "Connecting to [%s] " MACSTR " on channel %d", s_table.entries[c->cred].ssid,
+                 MAC2STR(c->bssid), c->channel);
+        wifi_manager_connect_to(c->cred, c->bssid, c->channel, CONNECT_PATH_SCAN);
+        return;
+    }
+    int recent = wifi_cred_table_most_recent(&s_table);
+    if (recent < 0) {
+        return;
+    }
+    s_candidate_next = s_candidate_count = 0;
+    ESP_LOGI(TAG, "No known network seen, trying [%s] with a full scan", s_table.entries[recent].ssid);
+    wifi_manager_connect_to(recent, NULL, 0, CONNECT_PATH_FULL);
+}
+
+// Stores the connection just made for the next fast reconnect. RTC memory is
+// updated on every connect; NVS only when the AP or address changed, to spare
+// the flash.
+static void wifi_manager_remember_connection(const esp_netif_ip_info_t* ip_info) {
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+        return;
+    }
+    wifi_fast_info_t info = { 0 };
+    strncpy(info.ssid, s_ssid, sizeof(info.ssid) - 1);
+    memcpy(info.bssid, ap.bssid, sizeof(info.bssid));
+    info.channel = ap.primary;
+    info.ip = ip_info->ip.addr;
+    info.netmask = ip_info->netmask.addr;
+    info.gw = ip_info->gw.addr;
+    esp_netif_dns_info_t dns_info;
+    if (esp_netif_get_dns_info(s_sta_netif, ESP_NETIF_DNS_MAIN, &dns_info) == ESP_OK &&
+        dns_info.ip.type == ESP_IPADDR_TYPE_V4) {
+        info.dns = dns_info.ip.u_addr.ip4.addr;
+    }
+    // A reused lease was not renewed, so it keeps its age
+    info.lease_time = s_lease_reused ? s_fast.lease_time : (int64_t)time(NULL);
+
+    bool changed = !s_fast_valid || strcmp(info.ssid, s_fast.ssid) != 0 ||
+                   memcmp(info.bssid, s_fast.bssid, sizeof(info.bssid)) != 0 ||
+                   info.channel != s_fast.channel || info.ip != s_fast.ip ||
+                   info.gw != s_fast.gw || info.dns != s_fast.dns;
+    s_rtc_fast = info;
+    s_rtc_fast_magic = WIFI_MANAGER_FAST_MAGIC;
+    if (changed) {
+        ESP_LOGI(TAG, "Caching AP " MACSTR " on channel %d for fast reconnect", MAC2STR(info.bssid), info.channel);
+        save_wifi_fast_info(&info);
+    }
+    s_fast = info;
+    s_fast_valid = true;
+}
+
+// --- Internal STA Connection Function ---
+// Joins one of the networks in s_table: the cached AP if the last connection
+// was to a known network, else the best one from a scan
+static esp_err_t wifi_manager_connect_known(void) {
      if (s_current_state == WIFI_STATE_UNINITIALIZED || s_sta_netif == NULL) {
          ESP_LOGE(TAG, "Wi-Fi Manager not initialized properly.");
          return ESP_FAIL;
      }
+    if (s_table.count == 0) {
+        ESP_LOGE(TAG, "No known networks.");
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "Connecting to one of %d known networks", s_table.count);
 
     // Ensure Wi-Fi is initialized
     esp_err_t init_err = esp_wifi_init(& (wifi_init_config_t)WIFI_INIT_CONFIG_DEFAULT());
@@ -111,43 +521,64 @@ static esp_err_t wifi_manager_connect_sta(const char* ssid, const char* password
          return init_err;
      }
 
-
-    // Set mode and config
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
-    wifi_config_t wifi_config = { 0 };
-    strncpy((char*)wifi_config.sta.ssid, ssid, sizeof(wifi_config.sta.ssid) - 1);
-    strncpy((char*)wifi_config.sta.password, password, sizeof(wifi_config.sta.password) - 1);
-    wifi_config.sta.threshold.authmode = strlen(password) > 0 ? WIFI_AUTH_WPA2_PSK : WIFI_AUTH_OPEN;
-    wifi_config.sta.pmf_cfg.capable = true;
-    wifi_config.sta.pmf_cfg.required = false;
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
 
-    // Start and Connect
+    // Start
+    s_connect_start_us = esp_timer_get_time();
     esp_err_t start_err = esp_wifi_start();
      if (start_err != ESP_OK) {
          ESP_LOGE(TAG, "esp_wifi_start failed (%s)", esp_err_to_name(start_err));
          return start_err;
      }
+    ESP_ERROR_CHECK_WITHOUT_ABORT(esp_wifi_set_ps(s_ps_type));
 
-    esp_err_t connect_err = esp_wifi_connect();
-    if (connect_err != ESP_OK) {
-        ESP_LOGE(TAG, "esp_wifi_connect failed (%s)", esp_err_to_name(connect_err));
-        // Don't return error immediately, let event handler manage retries
-    } else {
-        s_current_state = WIFI_STATE_CONNECTING;
-         ESP_LOGI(TAG, "esp_wifi_connect() called.");
-    }
      // Reset retry counter when initiating a new connection attempt
+     wifi_manager_cancel_retry();
      s_retry_num = 0;
      // Clear event bits related to connection state
      if (s_wifi_event_group) {
          xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT | WIFI_MANAGER_DISCONNECTED_BIT);
      }
 
+    // The fast path skips the scan if the last connection is cached
+    wifi_manager_load_fast_info();
+    if (s_fast_valid) {
+        int cred = wifi_cred_table_find(&s_table, s_fast.ssid);
+        ESP_LOGI(TAG, "Fast reconnect to [%s] " MACSTR " on channel %d", s_fast.ssid,
+                 MAC2STR(s_fast.bssid), s_fast.channel);
+        wifi_manager_connect_to(cred, s_fast.bssid, s_fast.channel, CONNECT_PATH_CACHED);
+        if (s_lease_reused) {
+            ESP_LOGI(TAG, "Reusing the cached lease");
+        }
+    } else {
+        wifi_manager_start_scan();
+    }
     return ESP_OK; // Indicate connection attempt was initiated
 }
 
 
+// Takes over the STA connection the portal leaves behind: the network that
+// was just verified, or the one that stayed up while the portal ran
+static bool wifi_manager_adopt_connection(void) {
+    wifi_ap_record_t ap;
+    esp_netif_ip_info_t ip_info;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK || esp_netif_get_ip_info(s_sta_netif, &ip_info) != ESP_OK ||
+        ip_info.ip.addr == 0) {
+        return false;
+    }
+    memset(s_ssid, 0, sizeof(s_ssid));
+    memset(s_password, 0, sizeof(s_password));
+    strncpy(s_ssid, (const char*)ap.ssid, sizeof(s_ssid) - 1);
+    int cred = wifi_cred_table_find(&s_table, s_ssid);
+    if (cred >= 0) {
+        strncpy(s_password, s_table.entries[cred].password, sizeof(s_password) - 1);
+    }
+    s_path = CONNECT_PATH_FULL;
+    s_lease_reused = false;
+    wifi_manager_on_connected(&ip_info);
+    return true;
+}
+
 // --- Internal Provisioning Trigger ---
 static void wifi_manager_do_provisioning(void) {
 
@@ -155,18 +586,16 @@ static void wifi_manager_do_provisioning(void) {
           ESP_LOGW(TAG, "Provisioning already in progress.");
           return;
      }
+     wifi_manager_cancel_retry();
 
-     // Stop current connection attempts or disconnect if connected
-     if (s_current_state == WIFI_STATE_CONNECTING || s_current_state == WIFI_STATE_CONNECTED) {
-          ESP_LOGI(TAG, "Stopping current Wi-Fi connection for provisioning...");
-          provisioning_triggered_manually = true; // Prevent auto-retry on disconnect
-          ESP_ERROR_CHECK_WITHOUT_ABORT(esp_wifi_disconnect());
-          // Wait a moment for disconnect event? Or proceed assuming cleanup happens.
-          vTaskDelay(pdMS_TO_TICKS(500)); // Give some time for disconnect
-          // Do not stop wifi here, start_softap_provisioning manages its wifi lifecycle
-     }
-
+     // A current connection stays up next to the portal (APSTA); until the
+     // portal closes, STA events are left to softap_provisioning
      s_current_state = WIFI_STATE_PROVISIONING;
+     s_scanning = false;
+     if (s_wifi_event_group) {
+          xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT);
+     }
+     wifi_manager_apply_ip(NULL); // A reused lease would not fit a network tried from the portal
      ESP_LOGI(TAG, "Starting SoftAP provisioning...");
 
      // Call the provisioning module function
@@ -174,22 +603,27 @@ static void wifi_manager_do_provisioning(void) {
      TickType_t prov_timeout = pdMS_TO_TICKS(5 * 60 * 1000);
      esp_err_t prov_status = start_softap_provisioning(prov_timeout);
 
-      if (prov_status == ESP_OK) {
-            ESP_LOGI(TAG, "Provisioning successful. Attempting connection with new credentials...");
-             // Read new credentials and attempt connection again
-            char ssid[33] = {0};
-            char password[65] = {0};
-            if (read_wifi_credentials(ssid, sizeof(ssid), password, sizeof(password)) == ESP_OK) {
-                 wifi_manager_connect_sta(ssid, password);
+      // Reload the table, which now holds a provisioned network as the most recent
+      read_wifi_cred_table(&s_table);
+      if (prov_status != ESP_FAIL && wifi_manager_adopt_connection()) {
+            ESP_LOGI(TAG, "Provisioning finished, staying connected to [%s].", s_ssid);
+      } else if (prov_status == ESP_OK) {
+            ESP_LOGI(TAG, "Provisioning successful, but the connection dropped. Reconnecting...");
+            s_current_state = WIFI_STATE_DISCONNECTED;
+            if (s_table.count > 0) {
+                 wifi_manager_connect_known();
             } else {
                  ESP_LOGE(TAG, "Failed to read credentials after successful provisioning!");
-                  s_current_state = WIFI_STATE_ERROR; // Or DISCONNECTED?
-                 // Signal failure?
+                  s_current_state = WIFI_STATE_ERROR;
             }
 
       } else if (prov_status == ESP_ERR_TIMEOUT) {
           ESP_LOGW(TAG, "Provisioning timed out.");
            s_current_state = WIFI_STATE_DISCONNECTED; // Revert state
+           // A known network may be back by now: start over with the stored ones
+           if (s_table.count > 0) {
+                wifi_manager_connect_known();
+           }
       } else {
            ESP_LOGE(TAG, "Provisioning failed.");
             s_current_state = WIFI_STATE_DISCONNECTED; // Revert state
@@ -198,7 +632,26 @@ static void wifi_manager_do_provisioning(void) {
        if (s_wifi_event_group) {
             xEventGroupSetBits(s_wifi_event_group, WIFI_MANAGER_PROV_DONE_BIT);
        }
-      provisioning_triggered_manually = false; // Reset flag
+}
+
+static void wifi_manager_provisioning_task(void* arg) {
+    wifi_manager_do_provisioning();
+    s_prov_task = NULL;
+    vTaskDelete(NULL);
+}
+
+// Provisioning waits for the user for minutes, so it never runs on the event loop
+static esp_err_t wifi_manager_start_provisioning_task(void) {
+    if (s_prov_task != NULL) {
+        ESP_LOGW(TAG, "Provisioning already in progress.");
+        return ESP_OK;
+    }
+    if (xTaskCreate(wifi_manager_provisioning_task, "wifi_prov", 4096, NULL, 5, &s_prov_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create provisioning task");
+        s_prov_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
 }
 
 // --- Public Functions ---
@@ -229,7 +682,30 @@ esp_err_t wifi_manager_init(void) {
      ESP_ERROR_CHECK(esp_wifi_init(&cfg));
 
 
-    // 5. Register event handlers
+    // 5. Load the static IP configuration, if any
+    s_static_ip_valid = read_wifi_static_ip(&s_static_ip) == ESP_OK && s_static_ip.ip != 0;
+    if (s_static_ip_valid) {
+        esp_ip4_addr_t ip = { .addr = s_static_ip.ip };
+        ESP_LOGI(TAG, "Using static IP " IPSTR, IP2STR(&ip));
+    }
+
+    // 6. Create the retry and latency probe timers
+    const esp_timer_create_args_t retry_timer_args = {
+        .callback = wifi_manager_retry_timer_cb,
+        .name = "wifi_retry",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&retry_timer_args, &s_retry_timer));
+    if (WIFI_MANAGER_PROBE_PERIOD_MS > 0) {
+        const esp_timer_create_args_t probe_timer_args = {
+            .callback = wifi_manager_probe_timer_cb,
+            .name = "wifi_probe",
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&probe_timer_args, &s_probe_timer));
+        ESP_ERROR_CHECK(esp_event_handler_register(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_PROBE,
+                                                   &wifi_manager_probe_handler, NULL));
+    }
+
+    // 7. Register event handlers
      ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT,
                                                         ESP_EVENT_ANY_ID,
                                                         &wifi_manager_event_handler,
@@ -240,8 +716,10 @@ esp_err_t wifi_manager_init(void) {
                                                         &wifi_manager_event_handler,
                                                         NULL,
                                                         &instance_got_ip));
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_RETRY,
+                                               &wifi_manager_event_handler, NULL));
 
-    // 6. Create event group
+    // 8. Create event group
     s_wifi_event_group = xEventGroupCreate();
     if (s_wifi_event_group == NULL) {
         ESP_LOGE(TAG, "Failed to create Wi-Fi event group");
@@ -265,18 +743,15 @@ esp_err_t wifi_manager_start(void) {
      }
 
     ESP_LOGI(TAG, "Starting Wi-Fi connection process...");
-    char ssid[33] = {0};
-    char password[65] = {0};
-
-    esp_err_t read_status = read_wifi_credentials(ssid, sizeof(ssid), password, sizeof(password));
+    wifi_manager_probe_start();
+    esp_err_t read_status = read_wifi_cred_table(&s_table);
 
     if (read_status == ESP_OK) {
-        ESP_LOGI(TAG, "Stored credentials found. Attempting connection...");
-        return wifi_manager_connect_sta(ssid, password); // Initiate connection
+        ESP_LOGI(TAG, "%d known networks found. Attempting connection...", s_table.count);
+        return wifi_manager_connect_known(); // Initiate connection
     } else if (read_status == ESP_ERR_NVS_NOT_FOUND) {
         ESP_LOGI(TAG, "No credentials found in NVS. Starting provisioning...");
-        wifi_manager_do_provisioning(); // Start provisioning
-        return ESP_OK; // Indicate process started
+        return wifi_manager_start_provisioning_task();
     } else {
         ESP_LOGE(TAG, "Error reading NVS (%s). Cannot start Wi-Fi.", esp_err_to_name(read_status));
         s_current_state = WIFI_STATE_ERROR;
@@ -321,8 +796,113 @@ esp_err_t wifi_manager_trigger_provisioning(void) {
      }
 
      ESP_LOGI(TAG, "Manual provisioning triggered.");
-     wifi_manager_do_provisioning();
-     return ESP_OK;
+     return wifi_manager_start_provisioning_task();
+}
+
+esp_err_t wifi_manager_stop(void) {
+    if (s_current_state == WIFI_STATE_UNINITIALIZED || s_current_state == WIFI_STATE_PROVISIONING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_current_state == WIFI_STATE_INITIALIZED) {
+        return ESP_OK; // Already stopped
+    }
+    ESP_LOGI(TAG, "Stopping Wi-Fi.");
+    wifi_manager_cancel_retry();
+    wifi_manager_probe_stop();
+    // Set first so the disconnect event from esp_wifi_stop() is not retried
+    s_current_state = WIFI_STATE_INITIALIZED;
+    s_scanning = false; // Stopping aborts a scan without SCAN_DONE
+    if (s_wifi_event_group) {
+        xEventGroupClearBits(s_wifi_event_group, WIFI_MANAGER_CONNECTED_BIT | WIFI_MANAGER_DISCONNECTED_BIT);
+    }
+    esp_err_t err = esp_wifi_stop();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_wifi_stop failed (%s)", esp_err_to_name(err));
+    }
+    return err;
+}
+
+esp_err_t wifi_manager_set_power_save(wifi_ps_type_t ps_type, uint16_t listen_interval) {
+    s_ps_type = ps_type;
+    s_listen_interval = listen_interval;
+    if (s_current_state != WIFI_STATE_CONNECTING && s_current_state != WIFI_STATE_CONNECTED) {
+        return ESP_OK; // Applied on the next connection
+    }
+    // The listen interval is part of the STA config; changing that now would
+    // reassociate, so it waits for the next connection
+    return esp_wifi_set_ps(ps_type);
+}
+
+esp_err_t wifi_manager_set_backoff(const wifi_manager_backoff_t* backoff) {
+    if (backoff == NULL || backoff->base_ms == 0 || backoff->max_ms < backoff->base_ms || backoff->max_retries < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_backoff = *backoff;
+    return ESP_OK;
+}
+
+void wifi_manager_get_event_latency(wifi_manager_latency_t* latency) {
+    *latency = s_latency;
+}
+
+void wifi_manager_log_event_latency(void) {
+    ESP_LOGI(TAG, "Event loop latency: avg %lu us, max %lu us over %lu probes (%lu dropped); handler max %lu us",
+             (unsigned long)s_latency.avg_us, (unsigned long)s_latency.max_us, (unsigned long)s_latency.probes,
+             (unsigned long)s_latency.dropped, (unsigned long)s_latency.handler_max_us);
+}
+
+esp_err_t wifi_manager_set_static_ip(const esp_netif_ip_info_t* ip_info, const esp_ip4_addr_t* dns) {
+    wifi_static_ip_t static_ip = { 0 };
+    if (ip_info) {
+        static_ip.ip = ip_info->ip.addr;
+        static_ip.netmask = ip_info->netmask.addr;
+        static_ip.gw = ip_info->gw.addr;
+        static_ip.dns = dns ? dns->addr : 0;
+    }
+    esp_err_t err = save_wifi_static_ip(ip_info ? &static_ip : NULL);
+    if (err == ESP_OK) {
+        s_static_ip = static_ip;
+        s_static_ip_valid = ip_info != NULL && static_ip.ip != 0;
+        ESP_LOGI(TAG, "Static IP %s; applies from the next connection.", s_static_ip_valid ? "set" : "cleared");
+    }
+    return err;
+}
+
+esp_err_t wifi_manager_add_network(const char* ssid, const char* password, uint8_t priority) {
+    wifi_cred_table_t table;
+    esp_err_t err = read_wifi_cred_table(&table);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+    if (wifi_cred_table_upsert(&table, ssid, password, priority) < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    err = save_wifi_cred_table(&table);
+    if (err == ESP_OK) {
+        s_table = table; // Used from the next scan
+        ESP_LOGI(TAG, "Network [%s] saved with priority %d (%d known).", ssid, priority, table.count);
+    }
+    return err;
+}
+
+esp_err_t wifi_manager_forget_network(const char* ssid) {
+    wifi_cred_table_t table;
+    esp_err_t err = read_wifi_cred_table(&table);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (!wifi_cred_table_remove(&table, ssid)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    err = save_wifi_cred_table(&table);
+    if (err == ESP_OK) {
+        s_table = table;
+        if (strcmp(s_rtc_fast.ssid, ssid) == 0) {
+            s_rtc_fast_magic = 0; // The cached AP must not bring it back
+        }
+        ESP_LOGI(TAG, "Network [%s] forgotten (%d known).", ssid, table.count);
+    }
+    return err;
 }
 
 EventGroupHandle_t wifi_manager_get_event_group(void) {
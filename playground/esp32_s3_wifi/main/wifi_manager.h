@@ -3,6 +3,8 @@
 #define WIFI_MANAGER_H
 
 #include "esp_err.h"
+#include "esp_netif.h"
+#include "esp_wifi_types.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 
@@ -18,9 +20,29 @@ typedef enum {
 
 // Event bits for signaling main application
 #define WIFI_MANAGER_CONNECTED_BIT BIT0
-#define WIFI_MANAGER_DISCONNECTED_BIT BIT1 // Persistent disconnection after retries
+#define WIFI_MANAGER_DISCONNECTED_BIT BIT1 // Retries used up; provisioning has started
 #define WIFI_MANAGER_PROV_DONE_BIT BIT2    // Provisioning process attempted (success or fail)
 
+// Reconnect backoff: retry n waits between half and all of
+// min(base_ms * 2^(n-1), max_ms), the rest being random jitter
+typedef struct {
+    uint32_t base_ms;   // Delay before the first retry
+    uint32_t max_ms;    // Ceiling for the delay
+    int max_retries;    // Retries before provisioning starts; 0 retries forever
+} wifi_manager_backoff_t;
+
+#define WIFI_MANAGER_BACKOFF_DEFAULT() { .base_ms = 1000, .max_ms = 60000, .max_retries = 5 }
+
+// Default event loop latency, from a probe event posted every few seconds
+// between wifi_manager_start() and wifi_manager_stop()
+typedef struct {
+    uint32_t probes;          // Probe events dispatched
+    uint32_t dropped;         // Probes the full event queue did not take
+    uint32_t avg_us;          // Mean delay from post to dispatch
+    uint32_t max_us;          // Longest delay from post to dispatch
+    uint32_t handler_max_us;  // Longest run of the manager's own event handler
+} wifi_manager_latency_t;
+
 
 /**
  * @brief Initializes the Wi-Fi Manager
@@ -33,7 +55,9 @@ esp_err_t wifi_manager_init(void);
 
 /**
  * @brief Starts the Wi-Fi connection process.
- * Reads credentials from NVS. If found, attempts to connect as STA.
+ * Reads the known networks from NVS. If there are any, attempts to connect as
+ * STA, first to the last good AP on its channel without a scan (fast
+ * reconnect), else to the best known network from one scan.
  * If not found, or if connection fails permanently, triggers provisioning.
  * This is non-blocking; use wifi_manager_wait_for_ip or event group to check status.
  *
@@ -58,12 +82,90 @@ esp_err_t wifi_manager_wait_for_ip(TickType_t timeout_ticks);
 
 /**
  * @brief Manually triggers the provisioning process.
- * Disconnects if currently connected.
+ * The portal runs next to the STA (APSTA), so a current connection stays up.
+ * Submitted credentials are tried live and the working connection is kept,
+ * with no reconnect after the portal closes. Provisioning runs in its own
+ * task; it also starts on its own when the reconnect retries are used up.
  *
  * @return esp_err_t ESP_OK if provisioning was triggered, error code otherwise.
  */
 esp_err_t wifi_manager_trigger_provisioning(void);
 
+/**
+ * @brief Stops Wi-Fi (radio off) until the next wifi_manager_start().
+ * The manager does not reconnect in between. Not allowed while provisioning.
+ *
+ * @return esp_err_t ESP_OK if stopped, ESP_ERR_INVALID_STATE while provisioning or uninitialized.
+ */
+esp_err_t wifi_manager_stop(void);
+
+/**
+ * @brief Sets the STA power save mode, applied on every connection.
+ * With WIFI_PS_MAX_MODEM the radio wakes every listen_interval beacons
+ * (about 102 ms each) instead of every DTIM, trading latency for current.
+ * The listen interval applies from the next connection.
+ *
+ * @param ps_type WIFI_PS_NONE, WIFI_PS_MIN_MODEM (default) or WIFI_PS_MAX_MODEM.
+ * @param listen_interval Beacons between wakes for WIFI_PS_MAX_MODEM; 0 for the driver default.
+ * @return esp_err_t ESP_OK on success, error code from the Wi-Fi driver otherwise.
+ */
+esp_err_t wifi_manager_set_power_save(wifi_ps_type_t ps_type, uint16_t listen_interval);
+
+/**
+ * @brief Sets the reconnect backoff. Applies from the next retry.
+ *
+ * @param backoff Backoff parameters; see WIFI_MANAGER_BACKOFF_DEFAULT().
+ * @return esp_err_t ESP_OK, or ESP_ERR_INVALID_ARG for a zero base or a ceiling below it.
+ */
+esp_err_t wifi_manager_set_backoff(const wifi_manager_backoff_t* backoff);
+
+/**
+ * @brief Gets the default event loop latency measured so far.
+ *
+ * @param latency Filled with the probe statistics.
+ */
+void wifi_manager_get_event_latency(wifi_manager_latency_t* latency);
+
+/**
+ * @brief Logs the default event loop latency measured so far.
+ */
+void wifi_manager_log_event_latency(void);
+
+/**
+ * @brief Sets a static IP for the STA interface instead of DHCP, stored in NVS.
+ * Takes effect from the next connection. Without a static IP, reconnects reuse
+ * the last DHCP lease for up to 30 minutes after it was obtained.
+ *
+ * @param ip_info Address, netmask and gateway; NULL clears the static IP.
+ * @param dns DNS server, or NULL to keep the one from the network.
+ * @return esp_err_t ESP_OK on success, NVS error code otherwise.
+ */
+esp_err_t wifi_manager_set_static_ip(const esp_netif_ip_info_t* ip_info, const esp_ip4_addr_t* dns);
+
+/**
+ * @brief Adds a network to the known network table in NVS, or updates its
+ * password and priority. The table holds WIFI_CRED_MAX networks; a full table
+ * drops the one with the lowest priority, least recently used first.
+ *
+ * When connecting, one scan is matched against the table and the networks in
+ * range are tried best first: signal strength plus a bonus for priority and
+ * for recent use.
+ *
+ * @param ssid Network name.
+ * @param password Password, empty for an open network.
+ * @param priority Higher is preferred; provisioned networks get 0.
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG for a bad SSID, NVS error code otherwise.
+ */
+esp_err_t wifi_manager_add_network(const char* ssid, const char* password, uint8_t priority);
+
+/**
+ * @brief Removes a network from the known network table in NVS.
+ *
+ * @param ssid Network name.
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if it is not known, NVS error code otherwise.
+ */
+esp_err_t wifi_manager_forget_network(const char* ssid);
+
 /**
  * @brief Get the event group handle used by the Wi-Fi manager.
  * Allows external tasks to wait on specific events.
@@ -0,0 +1,124 @@
+// main/wifi_select.c
+#include "wifi_select.h"
+#include <string.h>
+
+#define WEAK_PENALTY 1000 // Puts weak networks after every usable one
+
+int wifi_cred_table_find(const wifi_cred_table_t* table, const char* ssid) {
+    for (int i = 0; i < table->count; i++) {
+        if (strcmp(table->entries[i].ssid, ssid) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int wifi_cred_table_most_recent(const wifi_cred_table_t* table) {
+    int best = -1;
+    for (int i = 0; i < table->count; i++) {
+        if (best < 0 || table->entries[i].last_success > table->entries[best].last_success) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+bool wifi_cred_table_remove(wifi_cred_table_t* table, const char* ssid) {
+    int i = wifi_cred_table_find(table, ssid);
+    if (i < 0) {
+        return false;
+    }
+    memmove(&table->entries[i], &table->entries[i + 1], (table->count - i - 1) * sizeof(wifi_cred_t));
+    table->count--;
+    memset(&table->entries[table->count], 0, sizeof(wifi_cred_t));
+    return true;
+}
+
+bool wifi_cred_table_mark_success(wifi_cred_table_t* table, const char* ssid) {
+    int i = wifi_cred_table_find(table, ssid);
+    if (i < 0) {
+        return false;
+    }
+    table->entries[i].last_success = ++table->stamp;
+    return true;
+}
+
+int wifi_cred_table_upsert(wifi_cred_table_t* table, const char* ssid, const char* password, uint8_t priority) {
+    size_t ssid_len = strlen(ssid);
+    if (ssid_len == 0 || ssid_len >= sizeof(table->entries[0].ssid)) {
+        return -1;
+    }
+    int i = wifi_cred_table_find(table, ssid);
+    if (i < 0) {
+        if (table->count == WIFI_CRED_MAX) {
+            // Drop the least preferred: lowest priority, then least recently used
+            int drop = 0;
+            for (int j = 1; j < table->count; j++) {
+                const wifi_cred_t* e = &table->entries[j];
+                const wifi_cred_t* d = &table->entries[drop];
+                if (e->priority < d->priority || (e->priority == d->priority && e->last_success < d->last_success)) {
+                    drop = j;
+                }
+            }
+            wifi_cred_table_remove(table, table->entries[drop].ssid);
+        }
+        i = table->count++;
+        memset(&table->entries[i], 0, sizeof(wifi_cred_t));
+        memcpy(table->entries[i].ssid, ssid, ssid_len + 1);
+    }
+    wifi_cred_t* e = &table->entries[i];
+    strncpy(e->password, password ? password : "", sizeof(e->password) - 1);
+    e->password[sizeof(e->password) - 1] = '\0';
+    e->priority = priority;
+    e->last_success = ++table->stamp;
+    return i;
+}
+
+// Strongest AP with the entry's SSID and matching security, or -1
+static int strongest_ap(const wifi_cred_t* cred, const wifi_scan_entry_t* scan, int scan_count) {
+    bool secured = cred->password[0] != '\0';
+    int best = -1;
+    for (int i = 0; i < scan_count; i++) {
+        if (scan[i].secured == secured && strcmp(scan[i].ssid, cred->ssid) == 0 &&
+            (best < 0 || scan[i].rssi > scan[best].rssi)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+int wifi_select_rank(const wifi_cred_table_t* table, const wifi_scan_entry_t* scan, int scan_count,
+                     wifi_candidate_t* out, int max_out) {
+    wifi_candidate_t ranked[WIFI_CRED_MAX];
+    int recent = wifi_cred_table_most_recent(table);
+    int n = 0;
+    for (int c = 0; c < table->count; c++) {
+        const wifi_cred_t* cred = &table->entries[c];
+        int ap = strongest_ap(cred, scan, scan_count);
+        if (ap < 0) {
+            continue;
+        }
+        int score = scan[ap].rssi + cred->priority * WIFI_SELECT_PRIORITY_DB;
+        if (cred->last_success > 0) {
+            score += c == recent ? WIFI_SELECT_LAST_USED_DB : WIFI_SELECT_USED_DB;
+        }
+        if (scan[ap].rssi < WIFI_SELECT_WEAK_RSSI) {
+            score -= WEAK_PENALTY;
+        }
+
+        // Insertion sort, best first; equal scores go to the stronger signal
+        wifi_candidate_t cand = { .cred = c, .scan = ap, .score = score };
+        int i = n++;
+        while (i > 0 && (ranked[i - 1].score < score ||
+                         (ranked[i - 1].score == score && scan[ranked[i - 1].scan].rssi < scan[ap].rssi))) {
+            ranked[i] = ranked[i - 1];
+            i--;
+        }
+        ranked[i] = cand;
+    }
+    if (n > max_out) {
+        n = max_out;
+    }
+    memcpy(out, ranked, n * sizeof(wifi_candidate_t));
+    return n;
+}
@@ -0,0 +1,91 @@
+// main/wifi_select.h
+// Known-network table and the choice of which network to join from one scan.
+// Plain C without ESP-IDF dependencies, so it is unit tested on the host
+// (playground/wifi_host_test).
+#ifndef WIFI_SELECT_H
+#define WIFI_SELECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WIFI_CRED_MAX 8                 // Known networks kept
+#define WIFI_SELECT_WEAK_RSSI -85       // Below this a network is tried only after all stronger ones
+#define WIFI_SELECT_PRIORITY_DB 6       // Score per priority level, in dB of RSSI
+#define WIFI_SELECT_LAST_USED_DB 8      // Bonus for the network joined most recently
+#define WIFI_SELECT_USED_DB 3           // Bonus for any network joined before
+
+typedef struct {
+    char ssid[33];
+    char password[65];
+    uint32_t last_success; // Table stamp of the last connection (or provisioning), 0 = never
+    uint8_t priority;      // Higher is preferred; 0 by default
+} wifi_cred_t;
+
+// Recency is a table-wide counter rather than a clock time, so it stays
+// ordered without SNTP and across resets
+typedef struct {
+    uint32_t stamp;        // Last stamp handed out
+    uint8_t count;
+    wifi_cred_t entries[WIFI_CRED_MAX];
+} wifi_cred_table_t;
+
+// One AP from a scan
+typedef struct {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;
+    bool secured;          // Not an open network
+} wifi_scan_entry_t;
+
+typedef struct {
+    int cred;              // Index into the table
+    int scan;              // Index into the scan results: the strongest AP with that SSID
+    int score;
+} wifi_candidate_t;
+
+/**
+ * @brief Adds a network or updates its password and priority, and stamps it as
+ * the most recent. A full table drops the entry with the lowest priority, least
+ * recently used first.
+ *
+ * @return Index of the entry, or -1 for an empty or too long SSID.
+ */
+int wifi_cred_table_upsert(wifi_cred_table_t* table, const char* ssid, const char* password, uint8_t priority);
+
+/**
+ * @brief Index of the entry for ssid, or -1.
+ */
+int wifi_cred_table_find(const wifi_cred_table_t* table, const char* ssid);
+
+/**
+ * @brief Stamps ssid as the most recently joined network.
+ *
+ * @return false if ssid is not in the table.
+ */
+bool wifi_cred_table_mark_success(wifi_cred_table_t* table, const char* ssid);
+
+/**
+ * @brief Removes ssid from the table.
+ *
+ * @return false if ssid is not in the table.
+ */
+bool wifi_cred_table_remove(wifi_cred_table_t* table, const char* ssid);
+
+/**
+ * @brief Index of the most recently used entry, or -1 for an empty table.
+ */
+int wifi_cred_table_most_recent(const wifi_cred_table_t* table);
+
+/**
+ * @brief Matches scan results against the table and ranks the known networks,
+ * best first: RSSI of the strongest AP plus bonuses for priority and recency,
+ * with weak networks after all others. An SSID whose security does not match
+ * the stored password (open vs. secured) is another network and is skipped.
+ *
+ * @return Number of candidates written to out (at most max_out).
+ */
+int wifi_select_rank(const wifi_cred_table_t* table, const wifi_scan_entry_t* scan, int scan_count,
+                     wifi_candidate_t* out, int max_out);
+
+#endif // WIFI_SELECT_H
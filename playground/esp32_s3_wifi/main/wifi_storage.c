@@ -6,38 +6,78 @@
 
 static const char *TAG = "WIFI_STORAGE";
 
-esp_err_t save_wifi_credentials(const char* ssid, const char* password) {
+// --- Blob helpers ---
+static esp_err_t save_blob(const char* key, const void* data, size_t size) {
     nvs_handle_t nvs_handle;
     esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Error (%s) opening NVS handle!", esp_err_to_name(err));
         return err;
     }
+    if (data) {
+        err = nvs_set_blob(nvs_handle, key, data, size);
+    } else {
+        err = nvs_erase_key(nvs_handle, key);
+        if (err == ESP_ERR_NVS_NOT_FOUND) {
+            err = ESP_OK;
+        }
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) writing %s to NVS!", esp_err_to_name(err), key);
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
 
-    err = nvs_set_str(nvs_handle, NVS_KEY_WIFI_SSID, ssid);
+// A blob of another size (written by an older layout) counts as not found
+static esp_err_t read_blob(const char* key, void* data, size_t size) {
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error (%s) writing SSID to NVS!", esp_err_to_name(err));
-        nvs_close(nvs_handle);
         return err;
     }
-    err = nvs_set_str(nvs_handle, NVS_KEY_WIFI_PASS, password);
+    size_t stored_size = size;
+    err = nvs_get_blob(nvs_handle, key, data, &stored_size);
+    if (err == ESP_ERR_NVS_INVALID_LENGTH || (err == ESP_OK && stored_size != size)) {
+        ESP_LOGW(TAG, "Ignoring %s in NVS: unexpected size", key);
+        err = ESP_ERR_NVS_NOT_FOUND;
+    } else if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGE(TAG, "Error (%s) reading %s from NVS!", esp_err_to_name(err), key);
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
 
-     if (err == ESP_OK) {
-        err = nvs_commit(nvs_handle);
-        if (err == ESP_OK) {
-            ESP_LOGI(TAG, "Wi-Fi credentials saved to NVS.");
-        } else {
-            ESP_LOGE(TAG, "Error (%s) committing NVS!", esp_err_to_name(err));
-        }
-    } else {
-         ESP_LOGE(TAG, "Error (%s) writing Password to NVS!", esp_err_to_name(err));
+esp_err_t save_wifi_fast_info(const wifi_fast_info_t* info) {
+    return save_blob(NVS_KEY_WIFI_FAST, info, sizeof(*info));
+}
+
+esp_err_t read_wifi_fast_info(wifi_fast_info_t* info) {
+    esp_err_t err = read_blob(NVS_KEY_WIFI_FAST, info, sizeof(*info));
+    if (err != ESP_OK) {
+        memset(info, 0, sizeof(*info));
     }
+    return err;
+}
 
-    nvs_close(nvs_handle);
+esp_err_t save_wifi_static_ip(const wifi_static_ip_t* static_ip) {
+    return save_blob(NVS_KEY_WIFI_STATIC, static_ip, sizeof(*static_ip));
+}
+
+esp_err_t read_wifi_static_ip(wifi_static_ip_t* static_ip) {
+    esp_err_t err = read_blob(NVS_KEY_WIFI_STATIC, static_ip, sizeof(*static_ip));
+    if (err != ESP_OK) {
+        memset(static_ip, 0, sizeof(*static_ip));
+    }
     return err;
 }
 
-esp_err_t read_wifi_credentials(char* ssid, size_t ssid_len, char* password, size_t pass_len) {
+// --- Known Networks ---
+// The single network stored before the table, under two string keys
+static esp_err_t read_legacy_credentials(char* ssid, size_t ssid_len, char* password, size_t pass_len) {
     nvs_handle_t nvs_handle;
     memset(ssid, 0, ssid_len);
     memset(password, 0, pass_len);
@@ -68,3 +108,60 @@ esp_err_t read_wifi_credentials(char* ssid, size_t ssid_len, char* password, siz
     nvs_close(nvs_handle);
     return (err == ESP_OK && strlen(ssid) > 0) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
 }
+
+esp_err_t save_wifi_cred_table(const wifi_cred_table_t* table) {
+    return save_blob(NVS_KEY_WIFI_CREDS, table, sizeof(*table));
+}
+
+esp_err_t read_wifi_cred_table(wifi_cred_table_t* table) {
+    esp_err_t err = read_blob(NVS_KEY_WIFI_CREDS, table, sizeof(*table));
+    if (err == ESP_OK && table->count <= WIFI_CRED_MAX) {
+        return ESP_OK;
+    }
+    memset(table, 0, sizeof(*table));
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+
+    // No table yet: take over the network saved by an older firmware
+    char ssid[33];
+    char password[65];
+    if (read_legacy_credentials(ssid, sizeof(ssid), password, sizeof(password)) != ESP_OK) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "Moving the stored network [%s] into the known network table.", ssid);
+    wifi_cred_table_upsert(table, ssid, password, 0);
+    save_wifi_cred_table(table);
+    return ESP_OK;
+}
+
+esp_err_t save_wifi_credentials(const char* ssid, const char* password) {
+    wifi_cred_table_t table;
+    esp_err_t err = read_wifi_cred_table(&table);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+    if (wifi_cred_table_upsert(&table, ssid, password, 0) < 0) {
+        ESP_LOGE(TAG, "Invalid SSID [%s]", ssid);
+        return ESP_ERR_INVALID_ARG;
+    }
+    err = save_wifi_cred_table(&table);
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "Wi-Fi credentials saved to NVS (%d known networks).", table.count);
+    }
+    return err;
+}
+
+esp_err_t read_wifi_credentials(char* ssid, size_t ssid_len, char* password, size_t pass_len) {
+    memset(ssid, 0, ssid_len);
+    memset(password, 0, pass_len);
+    wifi_cred_table_t table;
+    esp_err_t err = read_wifi_cred_table(&table);
+    int i = err == ESP_OK ? wifi_cred_table_most_recent(&table) : -1;
+    if (i < 0) {
+        return err == ESP_OK ? ESP_ERR_NVS_NOT_FOUND : err;
+    }
+    strncpy(ssid, table.entries[i].ssid, ssid_len - 1);
+    strncpy(password, table.entries[i].password, pass_len - 1);
+    return ESP_OK;
+}
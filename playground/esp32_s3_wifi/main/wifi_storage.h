@@ -3,12 +3,51 @@
 
 #include "esp_err.h"
 #include <stddef.h>
+#include <stdint.h>
+#include "wifi_select.h"
 
 #define NVS_NAMESPACE "storage"
-#define NVS_KEY_WIFI_SSID "wifi_ssid"
+#define NVS_KEY_WIFI_SSID "wifi_ssid" // Single network of older firmware, moved into the table
 #define NVS_KEY_WIFI_PASS "wifi_pass"
+#define NVS_KEY_WIFI_CREDS "wifi_creds"
+#define NVS_KEY_WIFI_FAST "wifi_fast"
+#define NVS_KEY_WIFI_STATIC "wifi_static"
 
+// Last good connection, used to reconnect without a scan or DHCP exchange.
+// Addresses are IPv4 in network byte order (as in esp_ip4_addr_t).
+typedef struct {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t dns;
+    int64_t lease_time; // time() when the lease was obtained from DHCP
+} wifi_fast_info_t;
+
+// Static IP configuration; replaces DHCP when set
+typedef struct {
+    uint32_t ip;
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t dns;
+} wifi_static_ip_t;
+
+// Adds or updates a network in the known network table, as the most recent
 esp_err_t save_wifi_credentials(const char* ssid, const char* password);
+// The most recently used known network
 esp_err_t read_wifi_credentials(char* ssid, size_t ssid_len, char* password, size_t pass_len);
 
+esp_err_t save_wifi_cred_table(const wifi_cred_table_t* table);
+// ESP_ERR_NVS_NOT_FOUND (and an empty table) if no network is known
+esp_err_t read_wifi_cred_table(wifi_cred_table_t* table);
+
+esp_err_t save_wifi_fast_info(const wifi_fast_info_t* info);
+esp_err_t read_wifi_fast_info(wifi_fast_info_t* info);
+
+// NULL erases the static IP configuration
+esp_err_t save_wifi_static_ip(const wifi_static_ip_t* static_ip);
+esp_err_t read_wifi_static_ip(wifi_static_ip_t* static_ip);
+
 #endif // WIFI_STORAGE_H
\ No newline at end of file
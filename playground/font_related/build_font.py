@@ -0,0 +1,217 @@
+"""把行事曆字元清單 + 固定 UI 字串子集化成嵌入用的 TTF C 陣列
+
+可重現：同樣的字型、字元與選項一定產生同樣的輸出 (不更新 head 的時間戳)。
+增量：輸入的內容雜湊記在 stamp 檔，沒有變化就不重寫輸出，
+     依賴輸出的編譯也不會重跑。
+"""
+
+import argparse
+import hashlib
+import io
+import os
+import re
+import sys
+
+from fontTools import subset
+from fontTools.pens.recordingPen import DecomposingRecordingPen
+from fontTools.pens.transformPen import TransformPen
+from fontTools.pens.ttGlyphPen import TTGlyphPen
+from fontTools.ttLib import TTFont
+
+# 裝置上的 stb_truetype 用不到的表：排版 (GPOS/GSUB/GDEF/BASE/JSTF)、
+# 直排 (vmtx/vhea/VORG)、hinting (fpgm/prep/cvt/gasp/hdmx/LTSH/VDMX) 與簽章
+DROP_TABLES = [
+    'GPOS', 'GSUB', 'GDEF', 'BASE', 'JSTF',
+    'vmtx', 'vhea', 'VORG',
+    'fpgm', 'prep', 'cvt ', 'gasp', 'hdmx', 'LTSH', 'VDMX',
+    'DSIG',
+]
+
+# 改了子集化方式就加一，舊的輸出會重新產生
+PIPELINE_VERSION = 2
+
+
+def read_chars(path):
+    """檔案裡所有非空白字元；grab_letter_from_ics.py 的輸出是一行一字"""
+    with open(path, 'r', encoding='utf-8') as f:
+        return {ch for ch in f.read() if not ch.isspace()}
+
+
+def c_symbol(path):
+    """與 xxd -i 相同的命名：路徑中非英數字元換成底線"""
+    return re.sub(r'[^A-Za-z0-9]', '_', path)
+
+
+def subset_options():
+    options = subset.Options()
+    options.drop_tables += DROP_TABLES
+    options.layout_features = []
+    options.hinting = False
+    options.name_IDs = [0, 1, 2, 3, 4, 5, 6]
+    options.notdef_outline = True
+    options.recalc_timestamp = False
+    return options
+
+
+def add_fallback_glyphs(font, fallback_path, chars):
+    """把 font 沒有的字從 fallback 字型複製進來 (縮放到 font 的 em，組合字形拆開)，
+    回傳補上的字"""
+    fallback = TTFont(fallback_path)
+    fb_cmap = fallback.getBestCmap()
+    found = sorted(ch for ch in chars if ord(ch) in fb_cmap)
+    if not found:
+        fallback.close()
+        return []
+
+    scale = font['head'].unitsPerEm / fallback['head'].unitsPerEm
+    fb_glyphs = fallback.getGlyphSet()
+    glyph_order = font.getGlyphOrder()
+    glyf = font['glyf']
+    hmtx = font['hmtx']
+    for ch in found:
+        src = fb_cmap[ord(ch)]
+        name = f'fallback.{src}'
+        if name not in glyf:
+            recording = DecomposingRecordingPen(fb_glyphs)
+            fb_glyphs[src].draw(recording)
+            pen = TTGlyphPen(None)
+            recording.replay(TransformPen(pen, (scale, 0, 0, scale, 0, 0)))
+            glyph = pen.glyph()
+            glyph.recalcBounds(glyf)
+            glyph_order.append(name)
+            glyf[name] = glyph
+            lsb = glyph.xMin if glyph.numberOfContours else 0
+            hmtx[name] = (round(fallback['hmtx'][src][0] * scale), lsb)
+        for table in font['cmap'].tables:
+            if table.isUnicode():
+                table.cmap[ord(ch)] = name
+    font.setGlyphOrder(glyph_order)
+    fallback.close()
+    return found
+
+
+def subset_font(font_path, chars, fallback_paths):
+    options = subset_options()
+    font = subset.load_font(font_path, options)
+    cmap = font.getBestCmap()
+    missing = sorted(ch for ch in chars if ord(ch) not in cmap)
+    subsetter = subset.Subsetter(options)
+    subsetter.populate(unicodes=[ord(ch) for ch in chars])
+    subsetter.subset(font)
+
+    added = []
+    for path in fallback_paths:
+        found = add_fallback_glyphs(font, path, missing)
+        added += found
+        missing = [ch for ch in missing if ch not in found]
+
+    buf = io.BytesIO()
+    font.recalcTimestamp = False
+    font.save(buf)
+    font.close()
+    return buf.getvalue(), sorted(added), missing
+
+
+def to_c_array(data, symbol):
+    """輸出格式與 build_subset_font.sh 過去的 xxd -i | sed 相同"""
+    lines = [f'const unsigned char {symbol}[] = {{']
+    for i in range(0, len(data), 12):
+        chunk = ', '.join(f'0x{b:02x}' for b in data[i:i + 12])
+        lines.append(f'  {chunk}' + (',' if i + 12 < len(data) else ''))
+    lines.append('};')
+    lines.append(f'unsigned int {symbol}_len = {len(data)};')
+    return '\n'.join(lines) + '\n'
+
+
+def table_sizes(data):
+    font = TTFont(io.BytesIO(data), lazy=True)
+    return {tag: font.reader.tables[tag].length for tag in font.reader.keys()}
+
+
+def report(font_path, before, after, chars, added, missing):
+    print(f'📊 {os.path.basename(font_path)}：{len(chars)} 字 '
+          f'({len(added)} 字取自備用字型，{len(missing)} 字不在字型中)')
+    if added:
+        print('    備用：' + ''.join(added))
+    if missing:
+        print('    缺字：' + ''.join(missing[:80]) + (' …' if len(missing) > 80 else ''))
+    print(f'    原始 {len(before):>9} bytes')
+    print(f'    子集 {len(after):>9} bytes ({len(after) * 100 // max(len(before), 1)}%)')
+    sizes = table_sizes(after)
+    for tag, size in sorted(sizes.items(), key=lambda kv: -kv[1]):
+        print(f'      {tag:<4} {size:>9}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--font', required=True, help='原始字型 (.ttf)')
+    parser.add_argument('--chars', action='append', default=[],
+                        help='字元清單 (可多次指定，不存在的檔案略過)')
+    parser.add_argument('--ui-strings', action='append', default=[],
+                        help='固定 UI 字串檔 (必須存在)')
+    parser.add_argument('--fallback-font', action='append', default=[],
+                        help='原始字型缺的字改用這個字型 (可多次指定，依序查找)')
+    parser.add_argument('--ttf-out', required=True, help='子集字型輸出 (.ttf)')
+    parser.add_argument('--c-out', required=True, help='C 陣列輸出 (.c)')
+    parser.add_argument('--symbol', help='C 陣列名稱，預設由 --ttf-out 路徑產生 (同 xxd -i)')
+    parser.add_argument('--stamp', help='記錄輸入雜湊的 stamp 檔，預設為 --c-out 加 .stamp')
+    args = parser.parse_args()
+
+    chars = set()
+    for path in args.chars:
+        if os.path.exists(path):
+            chars |= read_chars(path)
+        else:
+            print(f'⚠️ 找不到字元清單 {path}，略過')
+    for path in args.ui_strings:
+        chars |= read_chars(path)
+    if not chars:
+        print('❌ 沒有任何字元')
+        return 1
+    # 空白不在字元清單裡 (略過空白字元)，但時間與標題都會用到
+    chars.add(' ')
+
+    symbol = args.symbol or c_symbol(args.ttf_out)
+    stamp = args.stamp or args.c_out + '.stamp'
+
+    with open(args.font, 'rb') as f:
+        font_data = f.read()
+    key = hashlib.sha256()
+    key.update(f'{PIPELINE_VERSION}\0{symbol}\0'.encode())
+    key.update(''.join(sorted(chars)).encode('utf-8'))
+    key.update(hashlib.sha256(font_data).digest())
+    for path in args.fallback_font:
+        with open(path, 'rb') as f:
+            key.update(hashlib.sha256(f.read()).digest())
+    key = key.hexdigest()
+
+    if (os.path.exists(stamp) and os.path.exists(args.c_out) and os.path.exists(args.ttf_out)):
+        with open(stamp, 'r') as f:
+            if f.read().strip() == key:
+                print(f'✅ {args.c_out} 已是最新')
+                return 0
+
+    data, added, missing = subset_font(args.font, chars, args.fallback_font)
+    report(args.font, font_data, data, chars, added, missing)
+
+    for path in (args.ttf_out, args.c_out, stamp):
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(args.ttf_out, 'wb') as f:
+        f.write(data)
+    c_text = to_c_array(data, symbol)
+    old = None
+    if os.path.exists(args.c_out):
+        with open(args.c_out, 'r') as f:
+            old = f.read()
+    # 內容相同就不碰 .c，避免 3 MB 的陣列重新編譯
+    if c_text != old:
+        with open(args.c_out, 'w') as f:
+            f.write(c_text)
+        print(f'    ✅ C 檔：{args.c_out}')
+    with open(stamp, 'w') as f:
+        f.write(key + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,15 +1,15 @@
 #!/bin/bash
 
-# 檢查 pyftsubset 是否存在
-if ! command -v pyftsubset &> /dev/null; then
-    echo "❌ pyftsubset 尚未安裝，請先執行 install.sh"
+# 檢查 fontTools 是否存在
+if ! python3 -c "import fontTools.subset" &> /dev/null; then
+    echo "❌ fontTools 尚未安裝，請先執行 install.sh"
     exit 1
 fi
 
 # === 確保必要的資料夾存在 ===
 mkdir -p collection
 mkdir -p subset_font
-mkdir -p output    # 🔧 為 xxd 輸出預先建立
+mkdir -p output    # 🔧 C 檔輸出
 
 # === 步驟 1: 分析所有 .ics 檔案，產生 used_letters.txt ===
 echo "🔍 收集 ICS 中使用的中文字..."
@@ -19,44 +19,63 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
-# === 步驟 2: 使用 pyftsubset 建立子集字型 ===
+# === 步驟 2 + 3: 子集化字型並轉成 C 陣列 ===
+# 字元 = ICS 中用到的字 + ui_strings.txt 的固定 UI 字串；
+# 字元與字型沒變時 build_font.py 不會重新產生；
+# 原始字型缺的字 (例如沒有 ASCII 時的數字) 取自 LVGL 附的 Ubuntu-Medium.ttf
+FALLBACK_FONT=../esp32_s3_lvgl/managed_components/lvgl__lvgl/examples/libs/tiny_ttf/Ubuntu-Medium.ttf
 echo "✂️ 開始製作字型子集..."
 
 for font_file in font/*.{ttf,otf}; do
     [ -e "$font_file" ] || continue  # 如果沒有符合的檔案就跳過
 
     filename=$(basename "$font_file")
-    output_file="subset_font/subset_$filename"
+    base="${filename%.*}"
 
     echo "  ➤ 子集化 $filename..."
-    pyftsubset "$font_file" \
-        --text-file=collection/used_letters.txt \
-        --output-file="$output_file" \
+    python3 build_font.py --font "$font_file" \
+        --chars collection/used_letters.txt \
+        --ui-strings ui_strings.txt \
+        --fallback-font "$FALLBACK_FONT" \
+        --ttf-out "subset_font/subset_${base}.ttf" \
+        --c-out "output/subset_${base}.c"
 
     if [ $? -eq 0 ]; then
-        echo "    ✅ 完成：$output_file"
+        echo "    ✅ 完成：output/subset_${base}.c"
     else
         echo "    ❌ 失敗：$filename"
     fi
 done
 
-echo "📦 開始轉換 subset_font/* 為 .c 檔案..."
+# === 步驟 4: 預先點陣化成 LVGL 點陣字型 (取代執行時的 tiny_ttf) ===
+# PRERENDER_SIZES / PRERENDER_BPP 可用環境變數覆寫
+PRERENDER_SIZES=${PRERENDER_SIZES:-"30 40 50"}
+PRERENDER_BPP=${PRERENDER_BPP:-1}
+LVGL_TTF_DIR=../esp32_s3_lvgl/managed_components/lvgl__lvgl/src/libs/tiny_ttf
+
+echo "🖋️ 編譯 prerender_font..."
+cc -O2 -I "$LVGL_TTF_DIR" prerender_font.c -lm -o collection/prerender_font
+if [ $? -ne 0 ]; then
+    echo "❌ prerender_font 編譯失敗"
+    exit 1
+fi
 
-# === 步驟 3: 使用 xxd -i 將 subset 字型轉成 C 陣列 ===
 for subset in subset_font/*.ttf; do
     [ -e "$subset" ] || continue
+    # subset_jf-openhuninn-2.1.ttf -> jf-openhuninn-2.1 / jf_openhuninn_2_1
     base=$(basename "$subset" .ttf)
-    output_path="output/${base}.c"
+    base=${base#subset_}
+    symbol=$(echo "$base" | sed 's/[^A-Za-z0-9]/_/g')
 
-    echo "  ➤ 產生 C 檔案：$output_path"
-    xxd -i "$subset" | sed 's/^unsigned char /const unsigned char /' \
-    | sed 's/^unsigned int /const unsigned int /' > "$output_path"
-
-    if [ $? -eq 0 ]; then
-        echo "    ✅ C 檔完成：$output_path"
-    else
-        echo "    ❌ 轉換失敗：$subset"
-    fi
+    for size in $PRERENDER_SIZES; do
+        output_path="output/prerendered_${base}_${size}.c"
+        echo "  ➤ 點陣化 ${size}px：$output_path"
+        collection/prerender_font --font "$subset" --size "$size" --bpp "$PRERENDER_BPP" \
+            --name "${symbol}_${size}" -o "$output_path"
+        if [ $? -ne 0 ]; then
+            echo "    ❌ 點陣化失敗：$subset ${size}px"
+        fi
+    done
 done
 
 echo "🎉 全部完成！C 檔案已儲存至 output/"
@@ -0,0 +1,173 @@
+"""裝置缺字時的字形伺服器 (esp32_s3_lvgl/main/glyph_fetch)
+
+請求：POST /glyphs，純文字，每種大小一行："<px> <hex cp> <hex cp> ..."
+回應：glyph_fetch 的字形紀錄 (由 prerender_font --records 點陣化)，
+     字型裡沒有的字不回，裝置就不會再要；超出 BMP 的字
+     (prerender_font 只到 U+FFFF) 直接略過，不讓一個表情符號拖垮整批
+
+  python3 glyph_server.py --font font/jf-openhuninn-2.1.ttf [--port 8000]
+  python3 glyph_server.py --font font/jf-openhuninn-2.1.ttf --self-test
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import urllib.error
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+RECORD_HEADER = struct.Struct('<IBBBbbBH')
+MAX_REQUEST = 16 * 1024
+MAX_PX = 255
+MAX_CODEPOINT = 0xFFFF     # 同 prerender_font.c
+
+
+def parse_request(text):
+    """回傳 {px: [codepoint, ...]}，格式錯誤丟 ValueError，點陣化不了的字略過"""
+    wanted = {}
+    for line in text.splitlines():
+        fields = line.split()
+        if not fields:
+            continue
+        px = int(fields[0])
+        if not 0 < px <= MAX_PX:
+            raise ValueError(f'bad size {px}')
+        cps = wanted.setdefault(px, [])
+        for field in fields[1:]:
+            cp = int(field, 16)
+            if 0x20 <= cp <= MAX_CODEPOINT:
+                cps.append(cp)
+    return wanted
+
+
+def render(tool, font, px, codepoints):
+    """用 prerender_font 點陣化，與裝置上的字形相同"""
+    with tempfile.TemporaryDirectory() as tmp:
+        chars = os.path.join(tmp, 'chars.txt')
+        out = os.path.join(tmp, 'glyphs.bin')
+        with open(chars, 'w', encoding='utf-8') as f:
+            f.write(''.join(chr(cp) for cp in codepoints))
+        subprocess.run([tool, '--font', font, '--size', str(px), '--bpp', '1',
+                        '--records', '--symbols', chars, '-o', out],
+                       check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        with open(out, 'rb') as f:
+            return f.read()
+
+
+def parse_records(data):
+    """(codepoint, px, box_w, box_h, ofs_x, ofs_y, adv_w, bitmap) 的清單，順便檢查格式"""
+    records = []
+    pos = 0
+    while pos < len(data):
+        cp, px, w, h, ofs_x, ofs_y, check, adv_w = RECORD_HEADER.unpack_from(data, pos)
+        n = (w * h + 7) // 8
+        bitmap = data[pos + RECORD_HEADER.size:pos + RECORD_HEADER.size + n]
+        if len(bitmap) != n:
+            raise ValueError(f'U+{cp:04X}: truncated')
+        x = 0
+        for b in bitmap:
+            x ^= b
+        if x != check:
+            raise ValueError(f'U+{cp:04X}: check byte mismatch')
+        records.append((cp, px, w, h, ofs_x, ofs_y, adv_w, bitmap))
+        pos += (RECORD_HEADER.size + n + 3) & ~3
+    return records
+
+
+def make_handler(tool, font):
+    class Handler(BaseHTTPRequestHandler):
+        def do_POST(self):
+            length = int(self.headers.get('Content-Length', 0))
+            if self.path.rstrip('/') != '/glyphs' or not 0 < length <= MAX_REQUEST:
+                self.send_error(400)
+                return
+            try:
+                wanted = parse_request(self.rfile.read(length).decode('ascii'))
+            except (UnicodeDecodeError, ValueError) as e:
+                self.send_error(400, str(e))
+                return
+            body = b''.join(render(tool, font, px, cps) for px, cps in sorted(wanted.items()) if cps)
+            count = sum(len(cps) for cps in wanted.values())
+            self.log_message('%d glyphs asked, %d returned, %d bytes',
+                             count, len(parse_records(body)), len(body))
+            self.send_response(200)
+            self.send_header('Content-Type', 'application/octet-stream')
+            self.send_header('Content-Length', str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+    return Handler
+
+
+def self_test(server):
+    """在背景啟動伺服器，用裝置的請求格式要字，檢查回來的紀錄"""
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    url = f'http://127.0.0.1:{server.server_address[1]}/glyphs'
+
+    def post(body):
+        req = urllib.request.Request(url, data=body.encode('ascii'), method='POST')
+        with urllib.request.urlopen(req) as resp:
+            return resp.read()
+
+    # 兩種大小，含一個所有字型都沒有的私用區字 (U+E000)，和一個超出 BMP 的表情符號
+    wanted = {30: [0x661f, 0x671f, 0xe000, 0x1f600], 50: [0x661f], 40: [0x1f600]}
+    body = '\n'.join(f'{px} ' + ' '.join(f'{cp:x}' for cp in cps) for px, cps in wanted.items()) + '\n'
+    records = parse_records(post(body))
+    got = {(r[1], r[0]) for r in records}
+    expect = {(30, 0x661f), (30, 0x671f), (50, 0x661f)}
+    ok = True
+    if got != expect:
+        print(f'❌ 回傳 {sorted(got)}，預期 {sorted(expect)}')
+        ok = False
+    for cp, px, w, h, ofs_x, ofs_y, adv_w, bitmap in records:
+        if not (0 < w <= px * 2 and 0 < h <= px * 2 and 0 < adv_w <= px * 2) or not any(bitmap):
+            print(f'❌ U+{cp:04X} {px}px：度量不合理 {w}x{h} adv {adv_w}')
+            ok = False
+    big = next((r for r in records if r[0] == 0x661f and r[1] == 50), None)
+    small = next((r for r in records if r[0] == 0x661f and r[1] == 30), None)
+    if big and small and big[2] <= small[2]:
+        print('❌ 50px 的字沒有比 30px 大')
+        ok = False
+    try:
+        post('30 zz\n')
+        print('❌ 格式錯誤的請求沒有被拒絕')
+        ok = False
+    except urllib.error.HTTPError as e:
+        ok = ok and e.code == 400
+    server.shutdown()
+    print('✅ self-test 通過' if ok else '❌ self-test 失敗')
+    return 0 if ok else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--font', required=True, help='完整字型 (.ttf)')
+    parser.add_argument('--tool', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'prerender_font'),
+                        help='prerender_font 執行檔')
+    parser.add_argument('--host', default='0.0.0.0')
+    parser.add_argument('--port', type=int, default=8000)
+    parser.add_argument('--self-test', action='store_true', help='在隨機埠啟動並自我測試後結束')
+    args = parser.parse_args()
+
+    if not os.access(args.tool, os.X_OK):
+        print(f'❌ 找不到 {args.tool}，請先編譯 prerender_font.c')
+        return 1
+    handler = make_handler(args.tool, args.font)
+    if args.self_test:
+        return self_test(ThreadingHTTPServer(('127.0.0.1', 0), handler))
+    server = ThreadingHTTPServer((args.host, args.port), handler)
+    print(f'🚀 字形伺服器：http://{args.host}:{args.port}/glyphs ({os.path.basename(args.font)})')
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
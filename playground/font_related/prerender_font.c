@@ -0,0 +1,665 @@
+// 把 TTF 在 host 端預先點陣化成 LVGL lv_font_fmt_txt 字型 (.c)
+//
+// 與裝置上 tiny_ttf 使用同一份 stb_truetype，字形、度量與 tiny_ttf 相同，
+// 差別只在於點陣在編譯時就產生好，執行時不需要 stbtt 也不需要 glyph cache。
+//
+//   1bpp: 未壓縮 (LVGL 9.2 的 RLE 解碼只支援 2/3/4 bpp)
+//   2bpp: LVGL RLE + 逐行 XOR prefilter 壓縮 (需開啟 CONFIG_LV_USE_FONT_COMPRESSED)
+//
+// 編譯：
+//   cc -O2 -I ../esp32_s3_lvgl/managed_components/lvgl__lvgl/src/libs/tiny_ttf
+//      prerender_font.c -lm -o prerender_font
+// 使用：
+//   ./prerender_font --font subset_font/x.ttf --size 30 --bpp 2 --name font_30
+//      [--symbols collection/used_letters.txt] -o output/font_30.c
+//
+// --records：改輸出裝置端 glyph_fetch 的字形紀錄 (二進位，只有 symbols 中的字，
+// 不另外加 ASCII)，給 glyph_server.py 回應缺字請求用：
+//   ./prerender_font --font font/x.ttf --size 30 --bpp 1 --records --symbols chars.txt -o out.bin
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "stb_truetype_htcw.h"
+
+#define MAX_CODEPOINT   0xFFFF
+// LV_FONT_FMT_TXT_LARGE == 0 欄位上限
+#define MAX_BITMAP_SIZE (1u << 20)
+#define MAX_ADV_W       ((1 << 12) - 1)
+
+typedef struct {
+    uint32_t codepoint;
+    int glyph;              // stbtt glyph index
+    uint32_t bitmap_index;
+    uint32_t adv_w;         // 1/16 px
+    int box_w, box_h, ofs_x, ofs_y;
+} glyph_t;
+
+typedef struct {
+    uint16_t left, right;
+    int value;              // 1/16 px
+} kern_t;
+
+static stbtt_fontinfo s_font;
+static float s_scale;
+static int s_bpp;
+
+static glyph_t *s_glyphs;
+static int s_glyph_count;
+static uint8_t *s_bitmap;
+static uint32_t s_bitmap_size;
+static uint32_t s_bitmap_cap;
+
+// ---------------------------------------------------------------------------
+// 位元輸出，MSB first，與 lv_font_fmt_txt.c 的 get_bits() 相同
+
+static uint32_t s_bit_pos;
+
+static void bits_put(uint32_t value, int len)
+{
+    for (int i = len - 1; i >= 0; i--) {
+        uint32_t byte = s_bit_pos >> 3;
+        if (byte >= s_bitmap_cap) {
+            s_bitmap_cap = s_bitmap_cap ? s_bitmap_cap * 2 : 65536;
+            s_bitmap = realloc(s_bitmap, s_bitmap_cap);
+            memset(s_bitmap + byte, 0, s_bitmap_cap - byte);
+        }
+        if (value & (1u << i)) {
+            s_bitmap[byte] |= 0x80 >> (s_bit_pos & 7);
+        }
+        s_bit_pos++;
+    }
+}
+
+// 每個字形從 byte 邊界開始
+static void bits_align(void)
+{
+    s_bit_pos = (s_bit_pos + 7) & ~7u;
+    s_bitmap_size = s_bit_pos >> 3;
+}
+
+// ---------------------------------------------------------------------------
+// LVGL RLE 編碼。狀態機對應 lv_font_fmt_txt.c 的 rle_next()：
+//   SINGLE   讀一個值，與前一個值相同就進入 REPEATED
+//   REPEATED 每個 1 bit 重複前值；第 11 個 1 之後讀 6 bit 計數 c，
+//            c > 0 時再重複 c - 1 次並接一個新值，c == 0 時直接接一個新值
+//            0 bit 之後接一個新值
+
+static void rle_encode(const uint8_t *v, int n, int bpp)
+{
+    enum { SINGLE, REPEATED } state = SINGLE;
+    int prev = -1;
+    int count = 0;
+    int i = 0;
+    while (i < n) {
+        if (state == SINGLE) {
+            bits_put(v[i], bpp);
+            if (i != 0 && v[i] == prev) {
+                state = REPEATED;
+                count = 0;
+            }
+            prev = v[i++];
+            continue;
+        }
+        if (v[i] != prev) {
+            bits_put(0, 1);
+            bits_put(v[i], bpp);
+            prev = v[i++];
+            state = SINGLE;
+            continue;
+        }
+        bits_put(1, 1);
+        if (++count < 11) {
+            i++;
+            continue;
+        }
+        // 之後還有幾個相同值
+        int run = 0;
+        while (i + 1 + run < n && v[i + 1 + run] == prev) {
+            run++;
+        }
+        if (run == 0) {
+            bits_put(0, 6);
+            bits_put(v[i], bpp);
+            i++;
+        } else {
+            int c = (run < 62 ? run : 62) + 1;
+            bits_put(c, 6);
+            i += c;
+            if (i < n) {
+                bits_put(v[i], bpp);
+                prev = v[i];
+            }
+            i++;
+        }
+        state = SINGLE;
+    }
+}
+
+// 解碼自我檢查，邏輯照抄 rle_next()
+static uint32_t get_bits(const uint8_t *in, uint32_t pos, int len)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < len; i++, pos++) {
+        v = (v << 1) | ((in[pos >> 3] >> (7 - (pos & 7))) & 1);
+    }
+    return v;
+}
+
+static int rle_verify(const uint8_t *in, const uint8_t *expect, int n, int bpp)
+{
+    enum { SINGLE, REPEATED, COUNTER } state = SINGLE;
+    uint32_t rdp = 0;
+    int prev = 0, count = 0;
+    for (int i = 0; i < n; i++) {
+        int ret = 0;
+        if (state == SINGLE) {
+            ret = get_bits(in, rdp, bpp);
+            if (rdp != 0 && prev == ret) {
+                count = 0;
+                state = REPEATED;
+            }
+            prev = ret;
+            rdp += bpp;
+        } else if (state == REPEATED) {
+            int bit = get_bits(in, rdp, 1);
+            count++;
+            rdp++;
+            if (bit) {
+                ret = prev;
+                if (count == 11) {
+                    count = get_bits(in, rdp, 6);
+                    rdp += 6;
+                    if (count != 0) {
+                        state = COUNTER;
+                    } else {
+                        ret = prev = get_bits(in, rdp, bpp);
+                        rdp += bpp;
+                        state = SINGLE;
+                    }
+                }
+            } else {
+                ret = prev = get_bits(in, rdp, bpp);
+                rdp += bpp;
+                state = SINGLE;
+            }
+        } else {
+            ret = prev;
+            if (--count == 0) {
+                ret = prev = get_bits(in, rdp, bpp);
+                rdp += bpp;
+                state = SINGLE;
+            }
+        }
+        if (ret != expect[i]) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+// 與 tiny_ttf 相同的門檻：A8 >= 128 在 I1 畫面上是黑點
+static uint8_t quantize(uint8_t a8)
+{
+    if (s_bpp == 1) {
+        return a8 >= 128;
+    }
+    return (uint8_t)((a8 * 3 + 127) / 255);
+}
+
+static int render_glyph(glyph_t *g)
+{
+    int x1, y1, x2, y2, advw, lsb;
+    stbtt_GetGlyphBitmapBox(&s_font, g->glyph, s_scale, s_scale, &x1, &y1, &x2, &y2);
+    stbtt_GetGlyphHMetrics(&s_font, g->glyph, &advw, &lsb);
+
+    // tiny_ttf 的框是 (x2 - x1 + 1) x (y2 - y1 + 1)、ofs_y = -y2，多出的一行一列
+    // 永遠是空的；這裡存實際大小並把 ofs_y 加 1，畫出來的位置與 tiny_ttf 相同
+    int w = x2 > x1 ? x2 - x1 : 0;
+    int h = y2 > y1 ? y2 - y1 : 0;
+    g->adv_w = (uint32_t)floorf(advw * s_scale + 0.5f) * 16;
+    g->box_w = w;
+    g->box_h = h;
+    g->ofs_x = w ? x1 : 0;
+    g->ofs_y = h ? 1 - y2 : 0;
+    if (w > 255 || h > 255 || g->adv_w > MAX_ADV_W || g->ofs_x < -128 || g->ofs_x > 127 ||
+        g->ofs_y < -128 || g->ofs_y > 127) {
+        fprintf(stderr, "U+%04X: glyph too large for lv_font_fmt_txt\n", g->codepoint);
+        return -1;
+    }
+
+    bits_align();
+    g->bitmap_index = s_bitmap_size;
+    if (w == 0 || h == 0) {
+        return 0;
+    }
+
+    uint8_t *a8 = malloc((size_t)w * h);
+    uint8_t *v = malloc((size_t)w * h);
+    stbtt_MakeGlyphBitmap(&s_font, a8, w, h, w, s_scale, s_scale, g->glyph);
+    for (int i = 0; i < w * h; i++) {
+        v[i] = quantize(a8[i]);
+    }
+
+    if (s_bpp == 1) {
+        for (int i = 0; i < w * h; i++) {
+            bits_put(v[i], 1);
+        }
+    } else {
+        // prefilter：除第一行外，每行與上一行 XOR
+        uint8_t *f = malloc((size_t)w * h);
+        memcpy(f, v, w);
+        for (int i = w; i < w * h; i++) {
+            f[i] = v[i] ^ v[i - w];
+        }
+        uint32_t start = s_bit_pos;
+        rle_encode(f, w * h, s_bpp);
+        // 解碼器可能多讀一個 byte
+        bits_put(0, 8);
+        s_bit_pos -= 8;
+        if (rle_verify(s_bitmap + (start >> 3), f, w * h, s_bpp) != 0) {
+            fprintf(stderr, "U+%04X: RLE self check failed\n", g->codepoint);
+            return -1;
+        }
+        free(f);
+    }
+    free(v);
+    free(a8);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+static int decode_utf8(const unsigned char **p)
+{
+    const unsigned char *s = *p;
+    int c = s[0], n = 0;
+    if (c < 0x80) {
+        n = 1;
+    } else if ((c & 0xE0) == 0xC0) {
+        c &= 0x1F;
+        n = 2;
+    } else if ((c & 0xF0) == 0xE0) {
+        c &= 0x0F;
+        n = 3;
+    } else if ((c & 0xF8) == 0xF0) {
+        c &= 0x07;
+        n = 4;
+    } else {
+        *p += 1;
+        return -1;
+    }
+    for (int i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *p += i;
+            return -1;
+        }
+        c = (c << 6) | (s[i] & 0x3F);
+    }
+    *p += n;
+    return c;
+}
+
+static unsigned char *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char *buf = malloc(n + 1);
+    if (fread(buf, 1, n, f) != (size_t)n) {
+        perror(path);
+        fclose(f);
+        free(buf);
+        return NULL;
+    }
+    fclose(f);
+    buf[n] = 0;
+    *size = n;
+    return buf;
+}
+
+// 要點陣化的字：symbols 檔中的字 (with_ascii 時加上空白與 ASCII 可見字元)，
+// 沒有指定就是字型裡全部的字
+static int collect_glyphs(const char *symbols_path, int with_ascii)
+{
+    static uint8_t wanted[MAX_CODEPOINT + 1];
+    if (symbols_path) {
+        size_t size;
+        unsigned char *text = read_file(symbols_path, &size);
+        if (text == NULL) {
+            return -1;
+        }
+        for (const unsigned char *p = text; *p;) {
+            int c = decode_utf8(&p);
+            if (c > 0 && c <= MAX_CODEPOINT) {
+                wanted[c] = 1;
+            }
+        }
+        free(text);
+        for (int c = 0x20; c < 0x7F && with_ascii; c++) {
+            wanted[c] = 1;
+        }
+    } else {
+        memset(wanted, 1, sizeof(wanted));
+    }
+
+    s_glyphs = calloc(MAX_CODEPOINT + 2, sizeof(glyph_t));
+    s_glyph_count = 1;  // id 0 保留
+    for (int c = 0x20; c <= MAX_CODEPOINT; c++) {
+        if (!wanted[c]) {
+            continue;
+        }
+        int g = stbtt_FindGlyphIndex(&s_font, c);
+        if (g == 0) {
+            if (symbols_path && c >= 0x80) {
+                fprintf(stderr, "warning: U+%04X not in font\n", c);
+            }
+            continue;
+        }
+        s_glyphs[s_glyph_count].codepoint = c;
+        s_glyphs[s_glyph_count].glyph = g;
+        s_glyph_count++;
+    }
+    return 0;
+}
+
+// 只查 CJK 以前的字 (拉丁、標點)；方塊字之間沒有 pair kerning，
+// 全部兩兩查詢在上千字時要好幾分鐘
+#define KERN_MAX_CODEPOINT  0x2E7F
+
+static kern_t *collect_kerning(int *count, int *kern_scale)
+{
+    kern_t *pairs = NULL;
+    int n = 0, cap = 0, max = 0;
+    int last = 1;
+    while (last < s_glyph_count && s_glyphs[last].codepoint <= KERN_MAX_CODEPOINT) {
+        last++;
+    }
+    for (int l = 1; l < last; l++) {
+        for (int r = 1; r < last; r++) {
+            int k = stbtt_GetGlyphKernAdvance(&s_font, s_glyphs[l].glyph, s_glyphs[r].glyph);
+            int v = (int)lroundf(k * s_scale * 16);
+            if (v == 0) {
+                continue;
+            }
+            if (n == cap) {
+                cap = cap ? cap * 2 : 256;
+                pairs = realloc(pairs, cap * sizeof(kern_t));
+            }
+            pairs[n++] = (kern_t) { (uint16_t)l, (uint16_t)r, v };
+            if (abs(v) > max) {
+                max = abs(v);
+            }
+        }
+    }
+    // value * kern_scale >> 4 是 1/16 px，value 要放得進 int8
+    *kern_scale = max > 127 ? (max * 16 + 126) / 127 : 16;
+    *count = n;
+    return pairs;
+}
+
+static void write_array_header(FILE *out, const char *comment)
+{
+    fprintf(out, "\n/*-----------------\n *    %s\n *----------------*/\n\n", comment);
+}
+
+static void write_font(FILE *out, const char *name, int size, const char *opts,
+                       const kern_t *kern, int kern_count, int kern_scale)
+{
+    int ascent, descent, line_gap;
+    stbtt_GetFontVMetrics(&s_font, &ascent, &descent, &line_gap);
+    int line_height = (int)(s_scale * (ascent - descent + line_gap));
+    int base_line = (int)(s_scale * (line_gap - descent));
+
+    fprintf(out, "/*******************************************************************************\n");
+    fprintf(out, " * Size: %d px\n * Bpp: %d\n * Opts: %s\n", size, s_bpp, opts);
+    fprintf(out, " * Generated by font_related/prerender_font, do not edit\n");
+    fprintf(out, " ******************************************************************************/\n\n");
+    fprintf(out, "#include \"lvgl.h\"\n");
+    if (s_bpp > 1) {
+        fprintf(out, "\n#if !LV_USE_FONT_COMPRESSED\n"
+                "#error \"%s needs CONFIG_LV_USE_FONT_COMPRESSED\"\n#endif\n", name);
+    }
+
+    write_array_header(out, "BITMAPS");
+    fprintf(out, "/*Store the image of the glyphs*/\n");
+    fprintf(out, "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {\n");
+    for (int i = 1; i < s_glyph_count; i++) {
+        const glyph_t *g = &s_glyphs[i];
+        uint32_t end = i + 1 < s_glyph_count ? s_glyphs[i + 1].bitmap_index : s_bitmap_size;
+        fprintf(out, "    /* U+%04X */", g->codepoint);
+        for (uint32_t b = g->bitmap_index; b < end; b++) {
+            fprintf(out, "%s0x%x,", (b - g->bitmap_index) % 12 ? " " : "\n    ", s_bitmap[b]);
+        }
+        fprintf(out, "\n\n");
+    }
+    // 壓縮字形的解碼器會多讀一個 byte
+    fprintf(out, s_bpp > 1 ? "    0x0\n};\n" : "};\n");
+
+    write_array_header(out, "GLYPH DESCRIPTION");
+    fprintf(out, "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n");
+    fprintf(out, "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */");
+    for (int i = 1; i < s_glyph_count; i++) {
+        const glyph_t *g = &s_glyphs[i];
+        fprintf(out, ",\n    {.bitmap_index = %u, .adv_w = %u, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}",
+                g->bitmap_index, g->adv_w, g->box_w, g->box_h, g->ofs_x, g->ofs_y);
+    }
+    fprintf(out, "\n};\n");
+
+    // 全部在 BMP，一個 sparse cmap 就放得下 (range_length / unicode_list 都是 16 bit)
+    uint32_t range_start = s_glyphs[1].codepoint;
+    uint32_t range_len = s_glyphs[s_glyph_count - 1].codepoint - range_start + 1;
+    write_array_header(out, "CHARACTER MAPPING");
+    fprintf(out, "static const uint16_t unicode_list_0[] = {");
+    for (int i = 1; i < s_glyph_count; i++) {
+        fprintf(out, "%s0x%x,", (i - 1) % 8 ? " " : "\n    ", s_glyphs[i].codepoint - range_start);
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "/*Collect the unicode lists and glyph_id offsets*/\n");
+    fprintf(out, "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n");
+    fprintf(out, "    {\n        .range_start = %u, .range_length = %u, .glyph_id_start = 1,\n", range_start, range_len);
+    fprintf(out, "        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = %d, "
+            ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }\n};\n", s_glyph_count - 1);
+
+    if (kern_count) {
+        write_array_header(out, "KERNING");
+        fprintf(out, "/*Pair left and right glyphs for kerning*/\n");
+        fprintf(out, "static const uint16_t kern_pair_glyph_ids[] =\n{");
+        for (int i = 0; i < kern_count; i++) {
+            fprintf(out, "%s%u, %u,", i % 6 ? " " : "\n    ", kern[i].left, kern[i].right);
+        }
+        fprintf(out, "\n};\n\n/* Kerning between the respective left and right glyphs\n"
+                " * 4.4 format which needs to scaled with `kern_scale`*/\n");
+        fprintf(out, "static const int8_t kern_pair_values[] =\n{");
+        for (int i = 0; i < kern_count; i++) {
+            int v = (int)lroundf(kern[i].value * 16.0f / kern_scale);
+            fprintf(out, "%s%d,", i % 12 ? " " : "\n    ", v);
+        }
+        fprintf(out, "\n};\n\n/*Collect the kern pair's data in one place*/\n");
+        fprintf(out, "static const lv_font_fmt_txt_kern_pair_t kern_pairs =\n{\n"
+                "    .glyph_ids = kern_pair_glyph_ids,\n    .values = kern_pair_values,\n"
+                "    .pair_cnt = %d,\n    .glyph_ids_size = 1\n};\n", kern_count);
+    }
+
+    write_array_header(out, "ALL CUSTOM DATA");
+    fprintf(out, "/*Store all the custom data of the font*/\n");
+    fprintf(out, "static const lv_font_fmt_txt_dsc_t font_dsc = {\n");
+    fprintf(out, "    .glyph_bitmap = glyph_bitmap,\n    .glyph_dsc = glyph_dsc,\n    .cmaps = cmaps,\n");
+    fprintf(out, "    .kern_dsc = %s,\n    .kern_scale = %d,\n", kern_count ? "&kern_pairs" : "NULL",
+            kern_count ? kern_scale : 0);
+    fprintf(out, "    .cmap_num = 1,\n    .bpp = %d,\n    .kern_classes = 0,\n    .bitmap_format = %d,\n};\n",
+            s_bpp, s_bpp > 1 ? 1 : 0);
+
+    write_array_header(out, "PUBLIC FONT");
+    fprintf(out, "/*Initialize a public general font descriptor*/\n");
+    fprintf(out, "const lv_font_t %s = {\n", name);
+    fprintf(out, "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/\n");
+    fprintf(out, "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/\n");
+    fprintf(out, "    .line_height = %d,          /*The maximum line height required by the font*/\n", line_height);
+    fprintf(out, "    .base_line = %d,             /*Baseline measured from the bottom of the line*/\n", base_line);
+    fprintf(out, "    .subpx = LV_FONT_SUBPX_NONE,\n");
+    fprintf(out, "    .underline_position = %d,\n", (int)lroundf(-s_scale * (ascent - descent) / 20));
+    fprintf(out, "    .underline_thickness = %d,\n", size / 15 > 0 ? size / 15 : 1);
+    fprintf(out, "    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */\n");
+    fprintf(out, "    .fallback = NULL,\n    .user_data = NULL,\n};\n");
+}
+
+// glyph_fetch.h 的字形紀錄：12 byte 表頭 + 1bpp 點陣 (列之間不補齊)，補 0 到 4 的倍數
+static void write_records(FILE *out, int size)
+{
+    for (int i = 1; i < s_glyph_count; i++) {
+        const glyph_t *g = &s_glyphs[i];
+        uint32_t n = ((uint32_t)g->box_w * g->box_h + 7) / 8;
+        const uint8_t *bitmap = s_bitmap + g->bitmap_index;
+        uint8_t check = 0;
+        for (uint32_t j = 0; j < n; j++) {
+            check ^= bitmap[j];
+        }
+        uint32_t adv_w = g->adv_w / 16;
+        uint8_t header[12] = {
+            g->codepoint & 0xFF, (g->codepoint >> 8) & 0xFF, (g->codepoint >> 16) & 0xFF, g->codepoint >> 24,
+            (uint8_t)size, (uint8_t)g->box_w, (uint8_t)g->box_h, (uint8_t)(int8_t)g->ofs_x,
+            (uint8_t)(int8_t)g->ofs_y, check, adv_w & 0xFF, adv_w >> 8,
+        };
+        static const uint8_t pad[3];
+        fwrite(header, 1, sizeof(header), out);
+        fwrite(bitmap, 1, n, out);
+        fwrite(pad, 1, (4 - n % 4) % 4, out);
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: prerender_font --font FILE --size PX --bpp 1|2 --name SYMBOL "
+            "[--symbols FILE] [--no-kerning] -o OUT.c\n"
+            "       prerender_font --font FILE --size PX --bpp 1 --records --symbols FILE -o OUT.bin\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *font_path = NULL, *symbols = NULL, *name = NULL, *out_path = NULL;
+    int size = 0, kerning = 1, records = 0;
+    s_bpp = 0;
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *next = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(a, "--no-kerning") == 0) {
+            kerning = 0;
+            continue;
+        }
+        if (strcmp(a, "--records") == 0) {
+            records = 1;
+            continue;
+        }
+        if (next == NULL) {
+            usage();
+            return 1;
+        }
+        if (strcmp(a, "--font") == 0) {
+            font_path = next;
+        } else if (strcmp(a, "--size") == 0) {
+            size = atoi(next);
+        } else if (strcmp(a, "--bpp") == 0) {
+            s_bpp = atoi(next);
+        } else if (strcmp(a, "--name") == 0) {
+            name = next;
+        } else if (strcmp(a, "--symbols") == 0) {
+            symbols = next;
+        } else if (strcmp(a, "-o") == 0) {
+            out_path = next;
+        } else {
+            usage();
+            return 1;
+        }
+        i++;
+    }
+    if (!font_path || (!name && !records) || !out_path || size <= 0 || size > 255 ||
+        (s_bpp != 1 && s_bpp != 2) || (records && (s_bpp != 1 || !symbols))) {
+        usage();
+        return 1;
+    }
+
+    size_t font_size;
+    unsigned char *ttf = read_file(font_path, &font_size);
+    if (ttf == NULL) {
+        return 1;
+    }
+    if (!stbtt_InitFont(&s_font, ttf, stbtt_GetFontOffsetForIndex(ttf, 0))) {
+        fprintf(stderr, "%s: not a TrueType font\n", font_path);
+        return 1;
+    }
+    // tiny_ttf 的 font_size 就是 em 大小
+    s_scale = stbtt_ScaleForMappingEmToPixels(&s_font, (float)size);
+
+    if (collect_glyphs(symbols, !records) != 0) {
+        return 1;
+    }
+    if (s_glyph_count < 2 && !records) {
+        fprintf(stderr, "no glyphs to render\n");
+        return 1;
+    }
+    for (int i = 1; i < s_glyph_count; i++) {
+        if (render_glyph(&s_glyphs[i]) != 0) {
+            return 1;
+        }
+    }
+    bits_align();
+    if (records) {
+        FILE *out = fopen(out_path, "wb");
+        if (out == NULL) {
+            perror(out_path);
+            return 1;
+        }
+        write_records(out, size);
+        fclose(out);
+        free(ttf);
+        return 0;
+    }
+    if (s_bitmap_size >= MAX_BITMAP_SIZE) {
+        fprintf(stderr, "bitmap is %u bytes, lv_font_fmt_txt allows 1 MB\n", s_bitmap_size);
+        return 1;
+    }
+
+    int kern_count = 0, kern_scale = 16;
+    kern_t *kern = kerning ? collect_kerning(&kern_count, &kern_scale) : NULL;
+
+    char opts[512];
+    snprintf(opts, sizeof(opts), "--size %d --bpp %d%s%s%s", size, s_bpp,
+             s_bpp > 1 ? " --compress" : "", symbols ? " --symbols " : "", symbols ? symbols : "");
+
+    FILE *out = fopen(out_path, "w");
+    if (out == NULL) {
+        perror(out_path);
+        return 1;
+    }
+    write_font(out, name, size, opts, kern, kern_count, kern_scale);
+    fclose(out);
+
+    // 估計的 flash 用量 (glyph_dsc 8 byte、unicode_list 2 byte、每組 kerning 5 byte)
+    size_t dsc_size = (size_t)s_glyph_count * 8;
+    size_t cmap_size = (size_t)(s_glyph_count - 1) * 2;
+    size_t kern_size = (size_t)kern_count * 5;
+    size_t bitmap_size = s_bitmap_size + (s_bpp > 1 ? 1 : 0);
+    size_t raw_size = 0;
+    for (int i = 1; i < s_glyph_count; i++) {
+        raw_size += ((size_t)s_glyphs[i].box_w * s_glyphs[i].box_h * s_bpp + 7) / 8;
+    }
+    printf("%s: %d glyphs, %dpx %dbpp, bitmap %zu bytes (uncompressed %zu), glyph_dsc %zu, "
+           "cmap %zu, kerning %d pairs %zu, total %zu bytes\n",
+           name, s_glyph_count - 1, size, s_bpp, bitmap_size, raw_size, dsc_size, cmap_size,
+           kern_count, kern_size, bitmap_size + dsc_size + cmap_size + kern_size);
+    free(kern);
+    free(ttf);
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Checks the drift arithmetic of time_drift.c against 128-bit references,
+// over 0 to 48 h since the last sync. Exits nonzero if any check fails.
+//
+//   cmake -S . -B build && cmake --build build && ./build/time_drift_test
+#include <stdio.h>
+#include <stdint.h>
+#include "time_drift.h"
+
+#define PPB     1000000000LL
+#define HOUR_US (3600LL * 1000000)
+
+static int failures = 0;
+
+#define CHECK(cond) do {                                              \
+        if (!(cond)) {                                                \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                               \
+        }                                                             \
+    } while (0)
+
+static const int32_t drifts_ppb[] = { -1000000, -100000, -20000, 0, 20000, 100000, 1000000 };
+#define DRIFT_COUNT ((int)(sizeof(drifts_ppb) / sizeof(drifts_ppb[0])))
+
+static int64_t utc_elapsed_ref(int64_t rtc_elapsed_us, int32_t drift_ppb)
+{
+    return (int64_t)((__int128)rtc_elapsed_us * PPB / (PPB + drift_ppb));
+}
+
+static void test_utc_elapsed(void)
+{
+    for (int d = 0; d < DRIFT_COUNT; d++) {
+        // Every 7 s and a bit, so the remainders vary
+        for (int64_t us = 0; us <= 48 * HOUR_US; us += 7000001) {
+            int64_t got = time_drift_utc_elapsed_us(us, drifts_ppb[d]);
+            int64_t want = utc_elapsed_ref(us, drifts_ppb[d]);
+            if (got != want) {
+                fprintf(stderr, "drift %ld ppb, %lld us: got %lld, want %lld\n", (long)drifts_ppb[d],
+                        (long long)us, (long long)got, (long long)want);
+                failures++;
+                break;
+            }
+        }
+    }
+
+    // 3 h at 100 ppm fast: 1.08 s less UTC than RTC time
+    CHECK(time_drift_utc_elapsed_us(3 * HOUR_US, 100000) == 3 * HOUR_US - 1079893);
+    CHECK(time_drift_utc_elapsed_us(48 * HOUR_US, 0) == 48 * HOUR_US);
+    // A year does not overflow either
+    CHECK(time_drift_utc_elapsed_us(8766 * HOUR_US, 20000) == utc_elapsed_ref(8766 * HOUR_US, 20000));
+}
+
+static void test_measure(void)
+{
+    for (int d = 0; d < DRIFT_COUNT; d++) {
+        for (int64_t utc = HOUR_US / 2; utc <= 48 * HOUR_US; utc += HOUR_US / 2) {
+            int64_t rtc = utc + (int64_t)((__int128)utc * drifts_ppb[d] / PPB);
+            int32_t got = time_drift_measure_ppb(rtc, utc);
+            // Exact up to the truncation of rtc to whole microseconds
+            int64_t err = got - drifts_ppb[d];
+            if (err < -1 || err > 1) {
+                fprintf(stderr, "drift %ld ppb over %lld us: measured %ld\n", (long)drifts_ppb[d],
+                        (long long)utc, (long)got);
+                failures++;
+                break;
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    test_utc_elapsed();
+    test_measure();
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
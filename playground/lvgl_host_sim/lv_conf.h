@@ -0,0 +1,33 @@
+// LVGL configuration for the host simulator. The device is configured through
+// Kconfig; only what differs from LVGL's defaults or matters for the
+// comparison with the device is set here.
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING    LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_CLIB
+
+#define LV_USE_OS   LV_OS_NONE
+
+// Same font settings as the device (prerendered 1bpp and 2bpp RLE fonts)
+#define LV_FONT_FMT_TXT_LARGE   0
+#define LV_USE_FONT_COMPRESSED  1
+
+// Errors only: the checked-in fonts have no ASCII, so every digit would warn
+// "glyph dsc. not found" (digits render as placeholders until the font is
+// rebuilt from ui_strings.txt)
+#define LV_USE_LOG      1
+#define LV_LOG_LEVEL    LV_LOG_LEVEL_ERROR
+// Printed to stderr by lvgl_host_sim, so stdout only has the timings
+#define LV_LOG_PRINTF   0
+
+// Per-stage render timing; the trace buffer holds a whole frame
+#define LV_USE_PROFILER                 1
+#define LV_USE_PROFILER_BUILTIN         1
+#define LV_PROFILER_BUILTIN_BUF_SIZE    (4 * 1024 * 1024)
+#define LV_PROFILER_INCLUDE             "src/misc/lv_profiler_builtin.h"
+
+#endif
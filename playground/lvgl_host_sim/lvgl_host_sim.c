@@ -0,0 +1,735 @@
+// Renders the esp32_s3_lvgl calendar UI (main/gui_ui.c) on the host with the
+// same LVGL 9.2 component, render mode and fonts as the device. Every frame of
+// a scenario is written as a 1bpp image, timed per LVGL stage with LVGL's
+// built-in profiler and optionally compared against golden images.
+//
+//   cmake -S . -B build && cmake --build build
+//   ./build/lvgl_host_sim [--out DIR] [--png] [--trace] [--repeat N]
+//                         [--golden DIR [--update-golden]] scenario.txt...
+//
+// Scenario script, one command per line, # starts a comment:
+//   font prerendered          1bpp fonts prerendered on the host (the default)
+//   font ttf [FILE.ttf]       rasterize with ttf_font; without a file the embedded subset
+//   date 2025-01-06           the day to show; the weekday is computed
+//   event 09:00 TITLE         append an event ("-" instead of the time: all day)
+//   clear                     remove all events
+//   drop                      remove the first event, as when it is over
+//   layout_cache on|off       event titles from text_layout or plain lv_label
+//   redraw                    invalidate the whole screen before the next frame
+//   view day|month|month_objects
+//                             the day screen, the gui_month grid, or the same
+//                             grid built from label and bar objects
+//   mark DAY COUNT            events on a day of the month views
+//   frame NAME                show the day and render; writes NAME.pbm
+//
+// Like on the device, LVGL renders only invalidated areas in 40 line bands;
+// the image is the panel RAM after the frame. --golden exits with 1 when a
+// frame differs from DIR/NAME.pbm and writes NAME.diff.pbm with the
+// differing pixels. The checked-in goldens are for calendar.txt, month.txt and agenda.txt:
+//   ./build/lvgl_host_sim --golden golden scenarios/calendar.txt scenarios/month.txt scenarios/agenda.txt
+//
+// scenarios/month.txt with --repeat is the gui_month benchmark: "view" prints
+// the object count and heap of each grid, "frame" the render times.
+// scenarios/agenda.txt is the same for the event title layout cache; "frame"
+// also prints the text_layout hits and misses.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "lvgl.h"
+#include "misc/lv_profiler_builtin_private.h"
+#include "gui_ui.h"
+#include "gui_month.h"
+#include "month_objects.h"
+#include "text_layout.h"
+#include "ttf_font.h"
+
+#define WIDTH           800
+#define HEIGHT          480
+#define STRIDE          (WIDTH / 8)
+#define BAND_LINES      40
+#define I1_PALETTE_SIZE 8
+#define MAX_STAGES      128
+#define TOP_STAGES      10
+#define MONTH_X         16
+#define MONTH_Y         20
+#define MONTH_WIDTH     768
+#define MONTH_HEIGHT    440
+
+int host_log_level = 1;
+
+LV_FONT_DECLARE(jf_openhuninn_2_1_30);
+LV_FONT_DECLARE(jf_openhuninn_2_1_40);
+LV_FONT_DECLARE(jf_openhuninn_2_1_50);
+extern const unsigned char subset_font_subset_jf_openhuninn_2_1_ttf[];
+extern unsigned int subset_font_subset_jf_openhuninn_2_1_ttf_len;
+
+static const char *out_dir = ".";
+static const char *golden_dir = NULL;
+static bool update_golden = false;
+static bool write_png = false;
+static bool write_trace = false;
+static int repeat = 0;
+
+// Panel RAM: bit set = white, as the panel takes it
+static uint8_t frame[STRIDE * HEIGHT];
+static uint32_t flushed_px;
+static uint32_t flushed_bands;
+
+static gui_fonts_t fonts;
+static bool screen_dirty = true;
+static enum { VIEW_DAY, VIEW_MONTH, VIEW_MONTH_OBJECTS } view = VIEW_DAY;
+static lv_obj_t *month_grid;
+static gui_month_t month;
+static gui_event_t events[GUI_MAX_EVENTS];
+static gui_day_t day = { .year = 2025, .month = 1, .day = 6, .weekday = 1, .events = events };
+static int failures;
+
+// ---------------------------------------------------------------------------
+// Time
+
+static void log_cb(lv_log_level_t level, const char *buf)
+{
+    (void)level;
+    fputs(buf, stderr);
+}
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static uint32_t tick_ms_cb(void)
+{
+    return (uint32_t)(now_us() / 1000);
+}
+
+static uint32_t tick_us_cb(void)
+{
+    return (uint32_t)now_us();
+}
+
+// ---------------------------------------------------------------------------
+// Per-stage timing from the built-in profiler's trace lines
+// ("... 12.000345: tracing_mark_write: B|1|func"), inclusive of nested stages
+
+typedef struct {
+    const char *name;
+    uint64_t us;
+    uint32_t calls;
+} stage_t;
+
+static stage_t stages[MAX_STAGES];
+static int stage_count;
+static struct {
+    char name[64];
+    uint64_t start;
+} stack[64];
+static int depth;
+static FILE *trace_file;
+
+static void stage_add(const char *name, uint64_t us)
+{
+    for (int i = 0; i < stage_count; i++) {
+        if (strcmp(stages[i].name, name) == 0) {
+            stages[i].us += us;
+            stages[i].calls++;
+            return;
+        }
+    }
+    if (stage_count < MAX_STAGES) {
+        stages[stage_count++] = (stage_t) { strdup(name), us, 1 };
+    }
+}
+
+static void profiler_flush_cb(const char *line)
+{
+    if (trace_file) {
+        fputs(line, trace_file);
+    }
+    const char *mark = strstr(line, ": tracing_mark_write: ");
+    if (mark == NULL) {
+        return;
+    }
+    const char *ts = mark;
+    while (ts > line && ts[-1] != ' ') {
+        ts--;
+    }
+    unsigned long sec = 0, usec = 0;
+    sscanf(ts, "%lu.%lu", &sec, &usec);
+    uint64_t t = (uint64_t)sec * 1000000u + usec;
+    char tag = mark[22];
+    const char *name = mark + 26;
+    size_t len = strcspn(name, "\n");
+
+    if (tag == 'B') {
+        if (depth < (int)(sizeof(stack) / sizeof(stack[0]))) {
+            snprintf(stack[depth].name, sizeof(stack[depth].name), "%.*s", (int)len, name);
+            stack[depth].start = t;
+        }
+        depth++;
+    } else if (tag == 'E' && depth > 0) {
+        depth--;
+        if (depth < (int)(sizeof(stack) / sizeof(stack[0]))) {
+            stage_add(stack[depth].name, t - stack[depth].start);
+        }
+    }
+}
+
+static int compare_stages(const void *a, const void *b)
+{
+    const stage_t *x = a, *y = b;
+    return x->us < y->us ? 1 : x->us > y->us ? -1 : 0;
+}
+
+static void profiler_start(const char *name)
+{
+    for (int i = 0; i < stage_count; i++) {
+        free((void *)stages[i].name);
+    }
+    stage_count = 0;
+    depth = 0;
+    if (write_trace) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.trace", out_dir, name);
+        trace_file = fopen(path, "w");
+    }
+    // Re-initializing is the only way to empty the trace buffer
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = LV_PROFILER_BUILTIN_BUF_SIZE;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = tick_us_cb;
+    config.flush_cb = profiler_flush_cb;
+    lv_profiler_builtin_init(&config);
+}
+
+static void profiler_stop(void)
+{
+    lv_profiler_builtin_flush();
+    lv_profiler_builtin_set_enable(false);
+    if (trace_file) {
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    qsort(stages, stage_count, sizeof(stage_t), compare_stages);
+}
+
+// ---------------------------------------------------------------------------
+// Images
+
+static int write_pbm(const char *path, const uint8_t *white_bits)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    // PBM: bit set = black
+    fprintf(f, "P4\n%d %d\n", WIDTH, HEIGHT);
+    for (int i = 0; i < STRIDE * HEIGHT; i++) {
+        fputc(~white_bits[i] & 0xFF, f);
+    }
+    fclose(f);
+    return 0;
+}
+
+static int read_pbm(const char *path, uint8_t *white_bits)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return -1;
+    }
+    int w, h;
+    int ok = fscanf(f, "P4 %d %d", &w, &h) == 2 && w == WIDTH && h == HEIGHT && fgetc(f) != EOF &&
+             fread(white_bits, 1, STRIDE * HEIGHT, f) == STRIDE * HEIGHT;
+    fclose(f);
+    if (!ok) {
+        return -1;
+    }
+    for (int i = 0; i < STRIDE * HEIGHT; i++) {
+        white_bits[i] = ~white_bits[i];
+    }
+    return 0;
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+    crc = ~crc;
+    while (n--) {
+        crc = table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t head[8];
+    put_be32(head, len);
+    memcpy(head + 4, type, 4);
+    fwrite(head, 1, 8, f);
+    fwrite(data, 1, len, f);
+    uint32_t crc = crc32_update(crc32_update(0, (const uint8_t *)type, 4), data, len);
+    put_be32(head, crc);
+    fwrite(head, 1, 4, f);
+}
+
+// 1 bit grayscale PNG (bit set = white) with stored, uncompressed deflate blocks
+static int write_png_file(const char *path, const uint8_t *white_bits)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, 8, f);
+    uint8_t ihdr[13] = { 0 };
+    put_be32(ihdr, WIDTH);
+    put_be32(ihdr + 4, HEIGHT);
+    ihdr[8] = 1;    // bit depth, color type 0 (gray)
+    png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+
+    size_t raw_len = (size_t)(STRIDE + 1) * HEIGHT;
+    uint8_t *raw = malloc(raw_len);
+    for (int y = 0; y < HEIGHT; y++) {
+        raw[y * (STRIDE + 1)] = 0;  // filter: none
+        memcpy(raw + y * (STRIDE + 1) + 1, white_bits + y * STRIDE, STRIDE);
+    }
+    size_t blocks = (raw_len + 65534) / 65535;
+    uint8_t *z = malloc(2 + raw_len + blocks * 5 + 4);
+    size_t zl = 0;
+    z[zl++] = 0x78;
+    z[zl++] = 0x01;
+    uint32_t a = 1, b = 0;
+    for (size_t pos = 0; pos < raw_len;) {
+        uint32_t n = raw_len - pos > 65535 ? 65535 : (uint32_t)(raw_len - pos);
+        z[zl++] = pos + n == raw_len;
+        z[zl++] = n & 0xFF;
+        z[zl++] = n >> 8;
+        z[zl++] = ~n & 0xFF;
+        z[zl++] = (~n >> 8) & 0xFF;
+        memcpy(z + zl, raw + pos, n);
+        zl += n;
+        for (uint32_t i = 0; i < n; i++) {
+            a = (a + raw[pos + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        pos += n;
+    }
+    put_be32(z + zl, (b << 16) | a);
+    zl += 4;
+    png_chunk(f, "IDAT", z, (uint32_t)zl);
+    png_chunk(f, "IEND", NULL, 0);
+    fclose(f);
+    free(z);
+    free(raw);
+    return 0;
+}
+
+static void check_golden(const char *name)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.pbm", golden_dir, name);
+    if (update_golden) {
+        write_pbm(path, frame);
+        printf("    golden updated: %s\n", path);
+        return;
+    }
+    static uint8_t golden[STRIDE * HEIGHT];
+    if (read_pbm(path, golden) != 0) {
+        printf("    FAIL: no golden image %s\n", path);
+        failures++;
+        return;
+    }
+    static uint8_t diff[STRIDE * HEIGHT];
+    uint32_t count = 0;
+    int x0 = WIDTH, y0 = HEIGHT, x1 = -1, y1 = -1;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            int i = y * STRIDE + x / 8, bit = 0x80 >> (x % 8);
+            bool differs = (frame[i] ^ golden[i]) & bit;
+            // Differing pixels black on white
+            diff[i] = differs ? diff[i] & ~bit : diff[i] | bit;
+            if (differs) {
+                count++;
+                x0 = x < x0 ? x : x0;
+                y0 = y < y0 ? y : y0;
+                x1 = x > x1 ? x : x1;
+                y1 = y > y1 ? y : y1;
+            }
+        }
+    }
+    if (count == 0) {
+        printf("    golden: match\n");
+        return;
+    }
+    snprintf(path, sizeof(path), "%s/%s.diff.pbm", out_dir, name);
+    write_pbm(path, diff);
+    printf("    FAIL: %u pixels differ from the golden image in (%d,%d)-(%d,%d), see %s\n",
+           count, x0, y0, x1, y1, path);
+    failures++;
+}
+
+// ---------------------------------------------------------------------------
+// Display
+
+static void flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
+{
+    // Same as epd_lvgl: skip the palette, a set bit is a light pixel.
+    // LVGL rounds I1 areas to whole bytes horizontally.
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_I1);
+    const uint8_t *src = px_map + I1_PALETTE_SIZE;
+    int32_t bytes = lv_area_get_width(area) / 8;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&frame[y * STRIDE + area->x1 / 8], src, bytes);
+        src += stride;
+    }
+    flushed_px += lv_area_get_size(area);
+    flushed_bands++;
+    lv_display_flush_ready(display);
+}
+
+static lv_display_t *display_create(void)
+{
+    lv_display_t *display = lv_display_create(WIDTH, HEIGHT);
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_I1);
+    static uint8_t band_buf[2][(STRIDE * BAND_LINES + I1_PALETTE_SIZE + LV_DRAW_BUF_ALIGN - 1)
+                               / LV_DRAW_BUF_ALIGN * LV_DRAW_BUF_ALIGN] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+    lv_display_set_buffers(display, band_buf[0], band_buf[1], sizeof(band_buf[0]),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display, flush_cb);
+    return display;
+}
+
+// ---------------------------------------------------------------------------
+// Scenario commands
+
+static int day_of_week(int y, int m, int d)
+{
+    static const int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    if (m < 3) {
+        y--;
+    }
+    return (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
+}
+
+static int set_fonts(const char *kind, const char *file)
+{
+    if (strcmp(kind, "prerendered") == 0) {
+        fonts = (gui_fonts_t) { &jf_openhuninn_2_1_50, &jf_openhuninn_2_1_40, &jf_openhuninn_2_1_30 };
+    } else if (strcmp(kind, "ttf") == 0) {
+        const uint8_t *data = subset_font_subset_jf_openhuninn_2_1_ttf;
+        size_t size = subset_font_subset_jf_openhuninn_2_1_ttf_len;
+        if (file) {
+            FILE *f = fopen(file, "rb");
+            if (f == NULL) {
+                perror(file);
+                return -1;
+            }
+            fseek(f, 0, SEEK_END);
+            size = ftell(f);
+            fseek(f, 0, SEEK_SET);
+            uint8_t *buf = malloc(size);
+            size = fread(buf, 1, size, f);
+            fclose(f);
+            data = buf;     // fonts keep pointing into it
+        }
+        ttf_face_t *face = ttf_face_create(data, size);
+        if (face == NULL) {
+            return -1;
+        }
+        fonts = (gui_fonts_t) { ttf_font_create(face, 50), ttf_font_create(face, 40), ttf_font_create(face, 30) };
+    } else {
+        return -1;
+    }
+    screen_dirty = true;
+    return 0;
+}
+
+static uint32_t count_objects(lv_obj_t *obj)
+{
+    uint32_t n = 1;
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        n += count_objects(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+static size_t heap_used(void)
+{
+#ifdef __GLIBC__
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+static void build_screen(void)
+{
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_clean(screen);
+    size_t heap = heap_used();
+    month_grid = NULL;
+    if (view == VIEW_DAY) {
+        gui_ui_create(screen, &fonts);
+        return;
+    }
+    // x a multiple of 8 so gui_month copies whole bytes
+    if (view == VIEW_MONTH) {
+        month_grid = gui_month_create(screen, MONTH_WIDTH, MONTH_HEIGHT, fonts.medium);
+    } else {
+        month_grid = month_objects_create(screen, MONTH_WIDTH, MONTH_HEIGHT, fonts.medium);
+    }
+    lv_obj_set_pos(month_grid, MONTH_X, MONTH_Y);
+    printf("view %-25s %5u objects  %6zu bytes of heap\n", view == VIEW_MONTH ? "month" : "month_objects",
+           count_objects(month_grid), heap_used() - heap);
+}
+
+static void show(void)
+{
+    if (view == VIEW_DAY) {
+        gui_ui_show_day(&day);
+        return;
+    }
+    month.year = day.year;
+    month.month = day.month;
+    month.today = day.day;
+    if (view == VIEW_MONTH) {
+        gui_month_show(month_grid, &month);
+    } else {
+        month_objects_show(month_grid, &month);
+    }
+}
+
+static void render_frame(const char *name)
+{
+    char path[512];
+    if (screen_dirty) {
+        build_screen();
+        screen_dirty = false;
+    }
+
+    flushed_px = 0;
+    flushed_bands = 0;
+    text_layout_reset_stats();
+    profiler_start(name);
+    uint64_t start = now_us();
+    LV_PROFILER_BEGIN_TAG("frame");
+    show();
+    lv_refr_now(NULL);
+    LV_PROFILER_END_TAG("frame");
+    uint64_t total = now_us() - start;
+    profiler_stop();
+
+    printf("frame %-24s %8.2f ms  %3u bands  %6u px rendered (%u%% of the panel)\n", name,
+           total / 1000.0, flushed_bands, flushed_px, flushed_px * 100 / (WIDTH * HEIGHT));
+    for (int i = 0; i < stage_count && i < TOP_STAGES; i++) {
+        printf("    %-36s %8.2f ms %6u calls\n", stages[i].name, stages[i].us / 1000.0, stages[i].calls);
+    }
+    text_layout_stats_t layouts;
+    text_layout_get_stats(&layouts);
+    if (layouts.hits + layouts.misses) {
+        printf("    text layouts: %u hits, %u laid out, %u cached\n", layouts.hits, layouts.misses, layouts.entries);
+    }
+
+    if (repeat > 0) {
+        // Full redraws of the same content, without the profiler's overhead
+        uint64_t best = UINT64_MAX, sum = 0;
+        for (int i = 0; i < repeat; i++) {
+            lv_obj_invalidate(lv_screen_active());
+            uint64_t t = now_us();
+            lv_refr_now(NULL);
+            t = now_us() - t;
+            sum += t;
+            best = t < best ? t : best;
+        }
+        printf("    full redraw x%d: avg %.2f ms, best %.2f ms\n", repeat, sum / 1000.0 / repeat, best / 1000.0);
+    }
+
+    snprintf(path, sizeof(path), "%s/%s.pbm", out_dir, name);
+    write_pbm(path, frame);
+    if (write_png) {
+        snprintf(path, sizeof(path), "%s/%s.png", out_dir, name);
+        write_png_file(path, frame);
+    }
+    if (golden_dir) {
+        check_golden(name);
+    }
+}
+
+static int run_scenario(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    printf("== %s\n", path);
+    // Every scenario starts on the day view without events; fonts and date carry over
+    day.event_count = 0;
+    memset(month.events, 0, sizeof(month.events));
+    if (view != VIEW_DAY) {
+        view = VIEW_DAY;
+        screen_dirty = true;
+    }
+    char line[512];
+    int line_no = 0;
+    while (fgets(line, sizeof(line), f)) {
+        line_no++;
+        line[strcspn(line, "\r\n")] = 0;
+        char *cmd = line + strspn(line, " \t");
+        if (*cmd == 0 || *cmd == '#') {
+            continue;
+        }
+        char *arg = cmd + strcspn(cmd, " \t");
+        if (*arg) {
+            *arg++ = 0;
+            arg += strspn(arg, " \t");
+        }
+
+        int err = 0;
+        if (strcmp(cmd, "font") == 0) {
+            char *file = arg + strcspn(arg, " \t");
+            if (*file) {
+                *file++ = 0;
+                file += strspn(file, " \t");
+            }
+            err = set_fonts(arg, *file ? file : NULL);
+        } else if (strcmp(cmd, "date") == 0) {
+            err = sscanf(arg, "%d-%d-%d", &day.year, &day.month, &day.day) != 3 ||
+                  day.month < 1 || day.month > 12 || day.day < 1 || day.day > 31;
+            if (!err) {
+                day.weekday = day_of_week(day.year, day.month, day.day);
+            }
+        } else if (strcmp(cmd, "event") == 0) {
+            char *title = arg + strcspn(arg, " \t");
+            if (*title) {
+                *title++ = 0;
+                title += strspn(title, " \t");
+            }
+            if (day.event_count < GUI_MAX_EVENTS) {
+                gui_event_t *ev = &events[day.event_count++];
+                snprintf(ev->time, sizeof(ev->time), "%s", strcmp(arg, "-") == 0 ? "" : arg);
+                snprintf(ev->title, sizeof(ev->title), "%s", title);
+            }
+        } else if (strcmp(cmd, "clear") == 0) {
+            day.event_count = 0;
+        } else if (strcmp(cmd, "drop") == 0) {
+            if (day.event_count > 0) {
+                memmove(&events[0], &events[1], --day.event_count * sizeof(events[0]));
+            }
+        } else if (strcmp(cmd, "layout_cache") == 0) {
+            err = strcmp(arg, "on") != 0 && strcmp(arg, "off") != 0;
+            gui_ui_use_layout_cache(strcmp(arg, "on") == 0);
+            screen_dirty = true;
+        } else if (strcmp(cmd, "view") == 0) {
+            if (strcmp(arg, "day") == 0) {
+                view = VIEW_DAY;
+            } else if (strcmp(arg, "month") == 0) {
+                view = VIEW_MONTH;
+            } else if (strcmp(arg, "month_objects") == 0) {
+                view = VIEW_MONTH_OBJECTS;
+            } else {
+                err = 1;
+            }
+            screen_dirty = true;
+        } else if (strcmp(cmd, "mark") == 0) {
+            int d, count;
+            err = sscanf(arg, "%d %d", &d, &count) != 2 || d < 1 || d > 31 || count < 0 || count > 255;
+            if (!err) {
+                month.events[d] = count;
+            }
+        } else if (strcmp(cmd, "redraw") == 0) {
+            lv_obj_invalidate(lv_screen_active());
+        } else if (strcmp(cmd, "frame") == 0 && *arg) {
+            render_frame(arg);
+        } else {
+            err = 1;
+        }
+        if (err) {
+            fprintf(stderr, "%s:%d: cannot run \"%s %s\"\n", path, line_no, cmd, arg);
+            fclose(f);
+            return -1;
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: lvgl_host_sim [--out DIR] [--png] [--trace] [--repeat N] "
+            "[--golden DIR [--update-golden]] scenario.txt...\n");
+}
+
+int main(int argc, char **argv)
+{
+    int first = argc;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_dir = argv[++i];
+        } else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            golden_dir = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--update-golden") == 0) {
+            update_golden = true;
+        } else if (strcmp(argv[i], "--png") == 0) {
+            write_png = true;
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            write_trace = true;
+        } else if (argv[i][0] == '-') {
+            usage();
+            return 2;
+        } else {
+            first = i;
+            break;
+        }
+    }
+    if (first == argc || (update_golden && golden_dir == NULL)) {
+        usage();
+        return 2;
+    }
+
+    lv_init();
+    lv_log_register_print_cb(log_cb);
+    lv_tick_set_cb(tick_ms_cb);
+    display_create();
+    set_fonts("prerendered", NULL);
+
+    for (int i = first; i < argc; i++) {
+        if (run_scenario(argv[i]) != 0) {
+            return 2;
+        }
+    }
+    if (failures) {
+        printf("%d frame(s) differ from the golden images\n", failures);
+        return 1;
+    }
+    return 0;
+}
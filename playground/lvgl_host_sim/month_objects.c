@@ -0,0 +1,137 @@
+#include "month_objects.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COLS            7
+#define ROWS            6
+#define PAD             6
+#define MARKER_HEIGHT   4
+#define MARKER_GAP      3
+
+typedef struct {
+    lv_obj_t *cell;
+    lv_obj_t *label;
+    lv_obj_t *bars[GUI_MONTH_MAX_MARKERS];
+} cell_t;
+
+typedef struct {
+    cell_t cells[COLS * ROWS];
+} grid_t;
+
+static int day_of_week(int y, int m, int d)
+{
+    static const int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    if (m < 3) {
+        y--;
+    }
+    return (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
+}
+
+static int days_in_month(int y, int m)
+{
+    static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return m == 2 && leap ? 29 : days[m - 1];
+}
+
+static void set_visible(lv_obj_t *obj, bool visible)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == visible) {
+        if (visible) {
+            lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+static void delete_event_cb(lv_event_t *e)
+{
+    free(lv_obj_get_user_data(lv_event_get_target(e)));
+}
+
+lv_obj_t *month_objects_create(lv_obj_t *parent, int32_t width, int32_t height, const lv_font_t *font)
+{
+    grid_t *grid = calloc(1, sizeof(grid_t));
+    int32_t cell_w = (width - 1) / COLS;
+    int32_t cell_h = (height - 1) / ROWS;
+    font = gui_month_digit_font(font);
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, cell_w * COLS + 1, cell_h * ROWS + 1);
+    lv_obj_set_user_data(obj, grid);
+    lv_obj_add_event_cb(obj, delete_event_cb, LV_EVENT_DELETE, NULL);
+
+    for (int i = 0; i < COLS * ROWS; i++) {
+        cell_t *c = &grid->cells[i];
+        // Neighbouring borders overlap into 1 pixel lines
+        c->cell = lv_obj_create(obj);
+        lv_obj_remove_style_all(c->cell);
+        lv_obj_set_style_bg_opa(c->cell, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(c->cell, lv_color_white(), 0);
+        lv_obj_set_style_border_width(c->cell, 1, 0);
+        lv_obj_set_style_border_color(c->cell, lv_color_black(), 0);
+        lv_obj_set_pos(c->cell, (i % COLS) * cell_w, (i / COLS) * cell_h);
+        lv_obj_set_size(c->cell, cell_w + 1, cell_h + 1);
+
+        c->label = lv_label_create(c->cell);
+        lv_obj_set_style_text_font(c->label, font, 0);
+        lv_obj_set_style_text_color(c->label, lv_color_black(), 0);
+        lv_obj_set_pos(c->label, PAD, PAD);
+        lv_label_set_text(c->label, "");
+
+        int32_t top = cell_h - 1 - PAD - MARKER_HEIGHT;
+        for (int m = 0; m < GUI_MONTH_MAX_MARKERS; m++) {
+            lv_obj_t *bar = lv_obj_create(c->cell);
+            lv_obj_remove_style_all(bar);
+            lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
+            lv_obj_set_style_bg_color(bar, lv_color_black(), 0);
+            lv_obj_set_pos(bar, PAD, top);
+            lv_obj_set_size(bar, cell_w - 1 - 2 * PAD, MARKER_HEIGHT);
+            lv_obj_add_flag(bar, LV_OBJ_FLAG_HIDDEN);
+            // Bars that would overlap the day number are never shown
+            if (top < PAD + font->line_height) {
+                lv_obj_add_flag(bar, LV_OBJ_FLAG_USER_1);
+            }
+            c->bars[m] = bar;
+            top -= MARKER_HEIGHT + MARKER_GAP;
+        }
+    }
+    return obj;
+}
+
+void month_objects_show(lv_obj_t *obj, const gui_month_t *month)
+{
+    grid_t *grid = lv_obj_get_user_data(obj);
+    int first = day_of_week(month->year, month->month, 1);
+    int days = days_in_month(month->year, month->month);
+    for (int i = 0; i < COLS * ROWS; i++) {
+        cell_t *c = &grid->cells[i];
+        int day = i - first + 1;
+        bool valid = day >= 1 && day <= days;
+        bool today = valid && day == month->today;
+        int markers = valid ? month->events[day] : 0;
+
+        char text[12] = "";
+        if (valid) {
+            snprintf(text, sizeof(text), "%d", day);
+        }
+        if (strcmp(lv_label_get_text(c->label), text) != 0) {
+            lv_label_set_text(c->label, text);
+        }
+        lv_color_t bg = today ? lv_color_black() : lv_color_white();
+        lv_color_t ink = today ? lv_color_white() : lv_color_black();
+        if (!lv_color_eq(lv_obj_get_style_bg_color(c->cell, 0), bg)) {
+            lv_obj_set_style_bg_color(c->cell, bg, 0);
+            lv_obj_set_style_text_color(c->label, ink, 0);
+            for (int m = 0; m < GUI_MONTH_MAX_MARKERS; m++) {
+                lv_obj_set_style_bg_color(c->bars[m], ink, 0);
+            }
+        }
+        for (int m = 0; m < GUI_MONTH_MAX_MARKERS; m++) {
+            set_visible(c->bars[m], m < markers && !lv_obj_has_flag(c->bars[m], LV_OBJ_FLAG_USER_1));
+        }
+    }
+}
@@ -0,0 +1,13 @@
+// The month grid built the generic way, for comparison with gui_month:
+// a bordered object, a day label and GUI_MONTH_MAX_MARKERS bar objects per
+// cell, same geometry and look.
+#ifndef _MONTH_OBJECTS_H_
+#define _MONTH_OBJECTS_H_
+
+#include "lvgl.h"
+#include "gui_month.h"
+
+lv_obj_t *month_objects_create(lv_obj_t *parent, int32_t width, int32_t height, const lv_font_t *font);
+void month_objects_show(lv_obj_t *grid, const gui_month_t *month);
+
+#endif
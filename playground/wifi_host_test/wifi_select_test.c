@@ -0,0 +1,162 @@
+// Checks the known-network table and the scan ranking of wifi_select.c.
+// Exits nonzero if any check fails.
+//
+//   cmake -S . -B build && cmake --build build && ./build/wifi_select_test
+#include <stdio.h>
+#include <string.h>
+#include "wifi_select.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do {                                              \
+        if (!(cond)) {                                                \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                               \
+        }                                                             \
+    } while (0)
+
+static wifi_scan_entry_t ap(const char *ssid, uint8_t last_octet, int8_t rssi, bool secured)
+{
+    wifi_scan_entry_t e = { .channel = 6, .rssi = rssi, .secured = secured };
+    strncpy(e.ssid, ssid, sizeof(e.ssid) - 1);
+    e.bssid[5] = last_octet;
+    return e;
+}
+
+// Ranks and returns the SSID of candidate i, or "" if there are fewer
+static const char *ranked_ssid(const wifi_cred_table_t *t, const wifi_scan_entry_t *scan, int n, int i)
+{
+    wifi_candidate_t out[WIFI_CRED_MAX];
+    int count = wifi_select_rank(t, scan, n, out, WIFI_CRED_MAX);
+    return i < count ? t->entries[out[i].cred].ssid : "";
+}
+
+static void test_upsert(void)
+{
+    wifi_cred_table_t t = { 0 };
+    CHECK(wifi_cred_table_upsert(&t, "home", "pw1", 0) == 0);
+    CHECK(wifi_cred_table_upsert(&t, "office", "pw2", 1) == 1);
+    CHECK(t.count == 2);
+
+    // Updating keeps the slot and replaces the password
+    CHECK(wifi_cred_table_upsert(&t, "home", "pw3", 0) == 0);
+    CHECK(t.count == 2);
+    CHECK(strcmp(t.entries[0].password, "pw3") == 0);
+    CHECK(wifi_cred_table_most_recent(&t) == 0);
+
+    CHECK(wifi_cred_table_upsert(&t, "", "pw", 0) == -1);
+    CHECK(wifi_cred_table_upsert(&t, "0123456789012345678901234567890123", "pw", 0) == -1);
+    CHECK(t.count == 2);
+
+    CHECK(wifi_cred_table_remove(&t, "home"));
+    CHECK(!wifi_cred_table_remove(&t, "home"));
+    CHECK(t.count == 1 && wifi_cred_table_find(&t, "office") == 0);
+}
+
+static void test_evict(void)
+{
+    wifi_cred_table_t t = { 0 };
+    char ssid[16];
+    for (int i = 0; i < WIFI_CRED_MAX; i++) {
+        snprintf(ssid, sizeof(ssid), "net%d", i);
+        wifi_cred_table_upsert(&t, ssid, "pw", i == 0 || i == 3 ? 0 : 1);
+    }
+    CHECK(t.count == WIFI_CRED_MAX);
+
+    // net0 and net3 have the lowest priority; net0 was used longest ago
+    wifi_cred_table_upsert(&t, "new", "pw", 1);
+    CHECK(t.count == WIFI_CRED_MAX);
+    CHECK(wifi_cred_table_find(&t, "net0") < 0);
+    CHECK(wifi_cred_table_find(&t, "net3") >= 0);
+    CHECK(wifi_cred_table_find(&t, "new") >= 0);
+
+    // Priority comes before recency: net3 goes next even as the most recent,
+    // then the least recently used of the priority 1 entries, net1
+    CHECK(wifi_cred_table_mark_success(&t, "net3"));
+    CHECK(!wifi_cred_table_mark_success(&t, "missing"));
+    CHECK(wifi_cred_table_most_recent(&t) == wifi_cred_table_find(&t, "net3"));
+    wifi_cred_table_upsert(&t, "new2", "pw", 1);
+    CHECK(wifi_cred_table_find(&t, "net3") < 0);
+    wifi_cred_table_upsert(&t, "new3", "pw", 1);
+    CHECK(wifi_cred_table_find(&t, "net1") < 0);
+}
+
+static void test_rank_match(void)
+{
+    wifi_cred_table_t t = { 0 };
+    wifi_cred_table_upsert(&t, "home", "pw", 0);
+    wifi_cred_table_upsert(&t, "cafe", "", 0);
+
+    // Open "home" and secured "cafe" are other networks with the same name
+    wifi_scan_entry_t scan[] = {
+        ap("home", 1, -40, false),
+        ap("cafe", 2, -40, true),
+        ap("stranger", 3, -30, true),
+    };
+    CHECK(strcmp(ranked_ssid(&t, scan, 3, 0), "") == 0);
+
+    // The strongest AP of an SSID is the one picked
+    wifi_scan_entry_t mesh[] = {
+        ap("home", 1, -70, true),
+        ap("home", 2, -50, true),
+        ap("home", 3, -60, true),
+    };
+    wifi_candidate_t out[WIFI_CRED_MAX];
+    CHECK(wifi_select_rank(&t, mesh, 3, out, WIFI_CRED_MAX) == 1);
+    CHECK(out[0].scan == 1);
+    CHECK(wifi_select_rank(&t, mesh, 0, out, WIFI_CRED_MAX) == 0);
+}
+
+static void test_rank_order(void)
+{
+    wifi_cred_table_t t = { 0 };
+    wifi_cred_table_upsert(&t, "home", "pw", 0);
+    wifi_cred_table_upsert(&t, "office", "pw", 0);
+    wifi_cred_table_upsert(&t, "phone", "pw", 0);
+    wifi_cred_table_mark_success(&t, "home");
+
+    // The last used network wins over a slightly stronger one...
+    wifi_scan_entry_t scan[] = {
+        ap("home", 1, -60, true),
+        ap("office", 2, -56, true),
+    };
+    CHECK(strcmp(ranked_ssid(&t, scan, 2, 0), "home") == 0);
+    CHECK(strcmp(ranked_ssid(&t, scan, 2, 1), "office") == 0);
+
+    // ...but not over a much stronger one
+    scan[1].rssi = -45;
+    CHECK(strcmp(ranked_ssid(&t, scan, 2, 0), "office") == 0);
+
+    // Priority outweighs a few dB
+    wifi_cred_table_upsert(&t, "phone", "pw", 3);
+    wifi_cred_table_mark_success(&t, "home");
+    wifi_scan_entry_t with_phone[] = {
+        ap("home", 1, -60, true),
+        ap("office", 2, -45, true),
+        ap("phone", 3, -55, true),
+    };
+    CHECK(strcmp(ranked_ssid(&t, with_phone, 3, 0), "phone") == 0);
+
+    // A weak network comes after every usable one, whatever its priority
+    with_phone[2].rssi = -88;
+    CHECK(strcmp(ranked_ssid(&t, with_phone, 3, 2), "phone") == 0);
+
+    // max_out keeps the best ones
+    wifi_candidate_t out[1];
+    CHECK(wifi_select_rank(&t, with_phone, 3, out, 1) == 1);
+    CHECK(strcmp(t.entries[out[0].cred].ssid, "office") == 0);
+}
+
+int main(void)
+{
+    test_upsert();
+    test_evict();
+    test_rank_match();
+    test_rank_order();
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}